@@ -24,6 +24,7 @@
 #include <jit_templates/templates/output_iterator.h>
 #include <nvrtc/command_list.h>
 #include <nvrtc/ltoir_list_appender.h>
+#include <util/build_cache.h>
 #include <util/build_utils.h>
 #include <util/context.h>
 #include <util/errors.h>
@@ -231,8 +232,11 @@ void binary_search_kernel({1} d_data, OffsetT num_data, {3} d_values, OffsetT nu
     }
   }
 
-  nvrtc_link_result result =
-    begin_linking_nvrtc_program(num_lto_args, lopts)
+  cccl::detail::build_cache_key cache_key;
+  cache_key.add(src).add(args.data(), args.size()).add(lopts, num_lto_args).add(linkable_list);
+  cache_key.add({"binary_search_kernel"});
+  nvrtc_link_result result = cccl::detail::cached_build(cache_key, {&lowered_name}, [&] {
+    return begin_linking_nvrtc_program(num_lto_args, lopts)
       ->add_program(nvrtc_translation_unit{src, name})
       ->add_expression({"binary_search_kernel"})
       ->compile_program({args.data(), args.size()})
@@ -240,6 +244,7 @@ void binary_search_kernel({1} d_data, OffsetT num_data, {3} d_values, OffsetT nu
       ->link_program()
       ->add_link_list(linkable_list)
       ->finalize_program();
+  });
 
   cuLibraryLoadData(&build_ptr->library, result.data.get(), nullptr, nullptr, 0, nullptr, nullptr, 0);
   check(cuLibraryGetKernel(&build_ptr->kernel, build_ptr->library, lowered_name.c_str()));
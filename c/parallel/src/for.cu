@@ -21,6 +21,7 @@
 #include <for/for_op_helper.h>
 #include <nvrtc/command_list.h>
 #include <nvrtc/ltoir_list_appender.h>
+#include <util/build_cache.h>
 #include <util/build_utils.h>
 #include <util/context.h>
 #include <util/errors.h>
@@ -128,8 +129,11 @@ try
     appender.append_operation(d_data.dereference);
   }
 
-  nvrtc_link_result result =
-    begin_linking_nvrtc_program(num_lto_args, lopts)
+  cccl::detail::build_cache_key cache_key;
+  cache_key.add(device_for_kernel).add(args.data(), args.size()).add(lopts, num_lto_args).add(linkable_list);
+  cache_key.add({for_kernel_name});
+  nvrtc_link_result result = cccl::detail::cached_build(cache_key, {&lowered_name}, [&] {
+    return begin_linking_nvrtc_program(num_lto_args, lopts)
       ->add_program(nvrtc_translation_unit{device_for_kernel, name})
       ->add_expression({for_kernel_name})
       ->compile_program({args.data(), args.size()})
@@ -137,6 +141,7 @@ try
       ->link_program()
       ->add_link_list(linkable_list)
       ->finalize_program();
+  });
 
   cuLibraryLoadData(&build_ptr->library, result.data.get(), nullptr, nullptr, 0, nullptr, nullptr, 0);
   check(cuLibraryGetKernel(&build_ptr->static_kernel, build_ptr->library, lowered_name.c_str()));
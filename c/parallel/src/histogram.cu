@@ -26,6 +26,7 @@
 #include "util/types.h"
 #include <cccl/c/histogram.h>
 #include <nvrtc/ltoir_list_appender.h>
+#include <util/build_cache.h>
 #include <util/build_utils.h>
 
 struct device_histogram_policy;
@@ -382,17 +383,24 @@ __device__ consteval auto& policy_generator() {{
   appender.add_iterator_definition(d_samples);
   appender.add_iterator_definition(d_output_histograms);
 
-  nvrtc_link_result result =
-    begin_linking_nvrtc_program(num_lto_args, lopts)
-      ->add_program(nvrtc_translation_unit({final_src.c_str(), name}))
-      ->add_expression({init_kernel_name})
-      ->add_expression({sweep_kernel_name})
-      ->compile_program({args.data(), args.size()})
-      ->get_name({init_kernel_name, init_kernel_lowered_name})
-      ->get_name({sweep_kernel_name, sweep_kernel_lowered_name})
-      ->link_program()
-      ->add_link_list(linkable_list)
-      ->finalize_program();
+  cccl::detail::build_cache_key cache_key;
+  cache_key.add(final_src).add(args.data(), args.size()).add(lopts, num_lto_args).add(linkable_list);
+  cache_key.add({init_kernel_name, sweep_kernel_name});
+  nvrtc_link_result result = cccl::detail::cached_build(
+    cache_key,
+    {&init_kernel_lowered_name, &sweep_kernel_lowered_name},
+    [&] {
+      return begin_linking_nvrtc_program(num_lto_args, lopts)
+        ->add_program(nvrtc_translation_unit({final_src.c_str(), name}))
+        ->add_expression({init_kernel_name})
+        ->add_expression({sweep_kernel_name})
+        ->compile_program({args.data(), args.size()})
+        ->get_name({init_kernel_name, init_kernel_lowered_name})
+        ->get_name({sweep_kernel_name, sweep_kernel_lowered_name})
+        ->link_program()
+        ->add_link_list(linkable_list)
+        ->finalize_program();
+    });
 
   cuLibraryLoadData(&build_ptr->library, result.data.get(), nullptr, nullptr, 0, nullptr, nullptr, 0);
   check(cuLibraryGetKernel(&build_ptr->init_kernel, build_ptr->library, init_kernel_lowered_name.c_str()));
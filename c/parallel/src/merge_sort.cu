@@ -25,6 +25,7 @@
 #include <cccl/c/merge_sort.h>
 #include <nvrtc/command_list.h>
 #include <nvrtc/ltoir_list_appender.h>
+#include <util/build_cache.h>
 #include <util/build_utils.h>
 
 struct op_wrapper;
@@ -383,19 +384,26 @@ __device__ consteval auto& policy_generator() {{
   list_appender.add_iterator_definition(output_keys_it);
   list_appender.add_iterator_definition(output_items_it);
 
-  nvrtc_link_result result =
-    begin_linking_nvrtc_program(num_lto_args, lopts)
-      ->add_program(nvrtc_translation_unit{final_src.c_str(), name})
-      ->add_expression({block_sort_kernel_name})
-      ->add_expression({partition_kernel_name})
-      ->add_expression({merge_kernel_name})
-      ->compile_program({args.data(), args.size()})
-      ->get_name({block_sort_kernel_name, block_sort_kernel_lowered_name})
-      ->get_name({partition_kernel_name, partition_kernel_lowered_name})
-      ->get_name({merge_kernel_name, merge_kernel_lowered_name})
-      ->link_program()
-      ->add_link_list(linkable_list)
-      ->finalize_program();
+  cccl::detail::build_cache_key cache_key;
+  cache_key.add(final_src).add(args.data(), args.size()).add(lopts, num_lto_args).add(linkable_list);
+  cache_key.add({block_sort_kernel_name, partition_kernel_name, merge_kernel_name});
+  nvrtc_link_result result = cccl::detail::cached_build(
+    cache_key,
+    {&block_sort_kernel_lowered_name, &partition_kernel_lowered_name, &merge_kernel_lowered_name},
+    [&] {
+      return begin_linking_nvrtc_program(num_lto_args, lopts)
+        ->add_program(nvrtc_translation_unit{final_src.c_str(), name})
+        ->add_expression({block_sort_kernel_name})
+        ->add_expression({partition_kernel_name})
+        ->add_expression({merge_kernel_name})
+        ->compile_program({args.data(), args.size()})
+        ->get_name({block_sort_kernel_name, block_sort_kernel_lowered_name})
+        ->get_name({partition_kernel_name, partition_kernel_lowered_name})
+        ->get_name({merge_kernel_name, merge_kernel_lowered_name})
+        ->link_program()
+        ->add_link_list(linkable_list)
+        ->finalize_program();
+    });
 
   cuLibraryLoadData(&build_ptr->library, result.data.get(), nullptr, nullptr, 0, nullptr, nullptr, 0);
   check(cuLibraryGetKernel(&build_ptr->block_sort_kernel, build_ptr->library, block_sort_kernel_lowered_name.c_str()));
@@ -23,6 +23,7 @@
 #include "util/types.h"
 #include <cccl/c/radix_sort.h>
 #include <nvrtc/ltoir_list_appender.h>
+#include <util/build_cache.h>
 #include <util/build_utils.h>
 
 using OffsetT = unsigned long long;
@@ -334,31 +335,54 @@ static_assert(device_radix_sort_policy()(::cuda::arch_id{{CUB_PTX_ARCH / 10}}) =
   nvrtc_linkable_list_appender appender{linkable_list};
   appender.append_operation(decomposer);
 
-  nvrtc_link_result result =
-    begin_linking_nvrtc_program(num_lto_args, lopts)
-      ->add_program(nvrtc_translation_unit{final_src.c_str(), name})
-      ->add_expression({single_tile_kernel_name})
-      ->add_expression({upsweep_kernel_name})
-      ->add_expression({alt_upsweep_kernel_name})
-      ->add_expression({scan_bins_kernel_name})
-      ->add_expression({downsweep_kernel_name})
-      ->add_expression({alt_downsweep_kernel_name})
-      ->add_expression({histogram_kernel_name})
-      ->add_expression({exclusive_sum_kernel_name})
-      ->add_expression({onesweep_kernel_name})
-      ->compile_program({args.data(), args.size()})
-      ->get_name({single_tile_kernel_name, single_tile_kernel_lowered_name})
-      ->get_name({upsweep_kernel_name, upsweep_kernel_lowered_name})
-      ->get_name({alt_upsweep_kernel_name, alt_upsweep_kernel_lowered_name})
-      ->get_name({scan_bins_kernel_name, scan_bins_kernel_lowered_name})
-      ->get_name({downsweep_kernel_name, downsweep_kernel_lowered_name})
-      ->get_name({alt_downsweep_kernel_name, alt_downsweep_kernel_lowered_name})
-      ->get_name({histogram_kernel_name, histogram_kernel_lowered_name})
-      ->get_name({exclusive_sum_kernel_name, exclusive_sum_kernel_lowered_name})
-      ->get_name({onesweep_kernel_name, onesweep_kernel_lowered_name})
-      ->link_program()
-      ->add_link_list(linkable_list)
-      ->finalize_program();
+  cccl::detail::build_cache_key cache_key;
+  cache_key.add(final_src).add(args.data(), args.size()).add(lopts, num_lto_args).add(linkable_list);
+  cache_key.add({single_tile_kernel_name,
+                 upsweep_kernel_name,
+                 alt_upsweep_kernel_name,
+                 scan_bins_kernel_name,
+                 downsweep_kernel_name,
+                 alt_downsweep_kernel_name,
+                 histogram_kernel_name,
+                 exclusive_sum_kernel_name,
+                 onesweep_kernel_name});
+  nvrtc_link_result result = cccl::detail::cached_build(
+    cache_key,
+    {&single_tile_kernel_lowered_name,
+     &upsweep_kernel_lowered_name,
+     &alt_upsweep_kernel_lowered_name,
+     &scan_bins_kernel_lowered_name,
+     &downsweep_kernel_lowered_name,
+     &alt_downsweep_kernel_lowered_name,
+     &histogram_kernel_lowered_name,
+     &exclusive_sum_kernel_lowered_name,
+     &onesweep_kernel_lowered_name},
+    [&] {
+      return begin_linking_nvrtc_program(num_lto_args, lopts)
+        ->add_program(nvrtc_translation_unit{final_src.c_str(), name})
+        ->add_expression({single_tile_kernel_name})
+        ->add_expression({upsweep_kernel_name})
+        ->add_expression({alt_upsweep_kernel_name})
+        ->add_expression({scan_bins_kernel_name})
+        ->add_expression({downsweep_kernel_name})
+        ->add_expression({alt_downsweep_kernel_name})
+        ->add_expression({histogram_kernel_name})
+        ->add_expression({exclusive_sum_kernel_name})
+        ->add_expression({onesweep_kernel_name})
+        ->compile_program({args.data(), args.size()})
+        ->get_name({single_tile_kernel_name, single_tile_kernel_lowered_name})
+        ->get_name({upsweep_kernel_name, upsweep_kernel_lowered_name})
+        ->get_name({alt_upsweep_kernel_name, alt_upsweep_kernel_lowered_name})
+        ->get_name({scan_bins_kernel_name, scan_bins_kernel_lowered_name})
+        ->get_name({downsweep_kernel_name, downsweep_kernel_lowered_name})
+        ->get_name({alt_downsweep_kernel_name, alt_downsweep_kernel_lowered_name})
+        ->get_name({histogram_kernel_name, histogram_kernel_lowered_name})
+        ->get_name({exclusive_sum_kernel_name, exclusive_sum_kernel_lowered_name})
+        ->get_name({onesweep_kernel_name, onesweep_kernel_lowered_name})
+        ->link_program()
+        ->add_link_list(linkable_list)
+        ->finalize_program();
+    });
 
   cuLibraryLoadData(&build_ptr->library, result.data.get(), nullptr, nullptr, 0, nullptr, nullptr, 0);
   check(
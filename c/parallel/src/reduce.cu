@@ -33,6 +33,7 @@
 #include <cccl/c/reduce.h>
 #include <nvrtc/command_list.h>
 #include <nvrtc/ltoir_list_appender.h>
+#include <util/build_cache.h>
 #include <util/build_utils.h>
 
 struct device_reduce_policy;
@@ -338,21 +339,32 @@ static_assert(device_reduce_policy()(::cuda::arch_id{{CUB_PTX_ARCH / 10}}) == {7
   appender.add_iterator_definition(input_it);
   appender.add_iterator_definition(output_it);
 
-  nvrtc_link_result result =
-    begin_linking_nvrtc_program(num_lto_args, lopts)
-      ->add_program(nvrtc_translation_unit{final_src.c_str(), name})
-      ->add_expression({single_tile_kernel_name})
-      ->add_expression({single_tile_second_kernel_name})
-      ->add_expression({reduction_kernel_name})
-      ->add_expression_if(build_nondeterministic, {nondeterministic_kernel_name})
-      ->compile_program({args.data(), args.size()})
-      ->get_name({single_tile_kernel_name, single_tile_kernel_lowered_name})
-      ->get_name({single_tile_second_kernel_name, single_tile_second_kernel_lowered_name})
-      ->get_name({reduction_kernel_name, reduction_kernel_lowered_name})
-      ->get_name_if(build_nondeterministic, {nondeterministic_kernel_name, nondeterministic_kernel_lowered_name})
-      ->link_program()
-      ->add_link_list(linkable_list)
-      ->finalize_program();
+  cccl::detail::build_cache_key cache_key;
+  cache_key.add(final_src).add(args.data(), args.size()).add(lopts, num_lto_args).add(linkable_list);
+  cache_key.add(
+    {single_tile_kernel_name, single_tile_second_kernel_name, reduction_kernel_name, nondeterministic_kernel_name});
+  nvrtc_link_result result = cccl::detail::cached_build(
+    cache_key,
+    {&single_tile_kernel_lowered_name,
+     &single_tile_second_kernel_lowered_name,
+     &reduction_kernel_lowered_name,
+     &nondeterministic_kernel_lowered_name},
+    [&] {
+      return begin_linking_nvrtc_program(num_lto_args, lopts)
+        ->add_program(nvrtc_translation_unit{final_src.c_str(), name})
+        ->add_expression({single_tile_kernel_name})
+        ->add_expression({single_tile_second_kernel_name})
+        ->add_expression({reduction_kernel_name})
+        ->add_expression_if(build_nondeterministic, {nondeterministic_kernel_name})
+        ->compile_program({args.data(), args.size()})
+        ->get_name({single_tile_kernel_name, single_tile_kernel_lowered_name})
+        ->get_name({single_tile_second_kernel_name, single_tile_second_kernel_lowered_name})
+        ->get_name({reduction_kernel_name, reduction_kernel_lowered_name})
+        ->get_name_if(build_nondeterministic, {nondeterministic_kernel_name, nondeterministic_kernel_lowered_name})
+        ->link_program()
+        ->add_link_list(linkable_list)
+        ->finalize_program();
+    });
 
   cuLibraryLoadData(&build->library, result.data.get(), nullptr, nullptr, 0, nullptr, nullptr, 0);
   check(cuLibraryGetKernel(&build->single_tile_kernel, build->library, single_tile_kernel_lowered_name.c_str()));
@@ -31,6 +31,7 @@
 #include <cccl/c/types.h> // cccl_type_info
 #include <nvrtc/command_list.h>
 #include <nvrtc/ltoir_list_appender.h>
+#include <util/build_cache.h>
 #include <util/build_utils.h>
 #include <util/context.h>
 #include <util/errors.h>
@@ -276,8 +277,11 @@ static_assert(
   appender.add_iterator_definition(start_offset_it);
   appender.add_iterator_definition(end_offset_it);
 
-  nvrtc_link_result result =
-    begin_linking_nvrtc_program(num_lto_args, lopts)
+  cccl::detail::build_cache_key cache_key;
+  cache_key.add(final_src).add(args.data(), args.size()).add(lopts, num_lto_args).add(linkable_list);
+  cache_key.add({segmented_reduce_kernel_name});
+  nvrtc_link_result result = cccl::detail::cached_build(cache_key, {&segmented_reduce_kernel_lowered_name}, [&] {
+    return begin_linking_nvrtc_program(num_lto_args, lopts)
       ->add_program(nvrtc_translation_unit{final_src.c_str(), name})
       ->add_expression({segmented_reduce_kernel_name})
       ->compile_program({args.data(), args.size()})
@@ -285,6 +289,7 @@ static_assert(
       ->link_program()
       ->add_link_list(linkable_list)
       ->finalize_program();
+  });
 
   // populate build struct members
   cuLibraryLoadData(&build_ptr->library, result.data.get(), nullptr, nullptr, 0, nullptr, nullptr, 0);
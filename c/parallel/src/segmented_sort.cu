@@ -33,6 +33,7 @@
 #include <cccl/c/types.h> // cccl_type_info
 #include <nvrtc/command_list.h>
 #include <nvrtc/ltoir_list_appender.h>
+#include <util/build_cache.h>
 #include <util/build_utils.h>
 
 struct device_segmented_sort_policy_selector;
@@ -613,23 +614,38 @@ static_assert(
   appender.append_operation(large_selector_op);
   appender.append_operation(small_selector_op);
 
-  nvrtc_link_result result =
-    begin_linking_nvrtc_program(num_lto_args, lopts)
-      ->add_program(nvrtc_translation_unit{final_src.c_str(), name})
-      ->add_expression({segmented_sort_fallback_kernel_name})
-      ->add_expression({segmented_sort_kernel_small_name})
-      ->add_expression({segmented_sort_kernel_large_name})
-      ->add_expression({three_way_partition_init_kernel_name})
-      ->add_expression({three_way_partition_kernel_name})
-      ->compile_program({args.data(), args.size()})
-      ->get_name({segmented_sort_fallback_kernel_name, segmented_sort_fallback_kernel_lowered_name})
-      ->get_name({segmented_sort_kernel_small_name, segmented_sort_kernel_small_lowered_name})
-      ->get_name({segmented_sort_kernel_large_name, segmented_sort_kernel_large_lowered_name})
-      ->get_name({three_way_partition_init_kernel_name, three_way_partition_init_kernel_lowered_name})
-      ->get_name({three_way_partition_kernel_name, three_way_partition_kernel_lowered_name})
-      ->link_program()
-      ->add_link_list(linkable_list)
-      ->finalize_program();
+  cccl::detail::build_cache_key cache_key;
+  cache_key.add(final_src).add(args.data(), args.size()).add(lopts, num_lto_args).add(linkable_list);
+  cache_key.add({segmented_sort_fallback_kernel_name,
+                 segmented_sort_kernel_small_name,
+                 segmented_sort_kernel_large_name,
+                 three_way_partition_init_kernel_name,
+                 three_way_partition_kernel_name});
+  nvrtc_link_result result = cccl::detail::cached_build(
+    cache_key,
+    {&segmented_sort_fallback_kernel_lowered_name,
+     &segmented_sort_kernel_small_lowered_name,
+     &segmented_sort_kernel_large_lowered_name,
+     &three_way_partition_init_kernel_lowered_name,
+     &three_way_partition_kernel_lowered_name},
+    [&] {
+      return begin_linking_nvrtc_program(num_lto_args, lopts)
+        ->add_program(nvrtc_translation_unit{final_src.c_str(), name})
+        ->add_expression({segmented_sort_fallback_kernel_name})
+        ->add_expression({segmented_sort_kernel_small_name})
+        ->add_expression({segmented_sort_kernel_large_name})
+        ->add_expression({three_way_partition_init_kernel_name})
+        ->add_expression({three_way_partition_kernel_name})
+        ->compile_program({args.data(), args.size()})
+        ->get_name({segmented_sort_fallback_kernel_name, segmented_sort_fallback_kernel_lowered_name})
+        ->get_name({segmented_sort_kernel_small_name, segmented_sort_kernel_small_lowered_name})
+        ->get_name({segmented_sort_kernel_large_name, segmented_sort_kernel_large_lowered_name})
+        ->get_name({three_way_partition_init_kernel_name, three_way_partition_init_kernel_lowered_name})
+        ->get_name({three_way_partition_kernel_name, three_way_partition_kernel_lowered_name})
+        ->link_program()
+        ->add_link_list(linkable_list)
+        ->finalize_program();
+    });
 
   // populate build struct members
   cuLibraryLoadData(&build_ptr->library, result.data.get(), nullptr, nullptr, 0, nullptr, nullptr, 0);
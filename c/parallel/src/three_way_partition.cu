@@ -33,6 +33,7 @@
 #include <cccl/c/types.h>
 #include <nvrtc/command_list.h>
 #include <nvrtc/ltoir_list_appender.h>
+#include <util/build_cache.h>
 #include <util/build_utils.h>
 
 struct device_three_way_partition_policy_selector;
@@ -261,17 +262,24 @@ static_assert(
   appender.add_iterator_definition(d_unselected_out);
   appender.add_iterator_definition(d_num_selected_out);
 
-  nvrtc_link_result result =
-    begin_linking_nvrtc_program(num_lto_args, lopts)
-      ->add_program(nvrtc_translation_unit{final_src.c_str(), name})
-      ->add_expression({three_way_partition_init_kernel_name})
-      ->add_expression({three_way_partition_kernel_name})
-      ->compile_program({args.data(), args.size()})
-      ->get_name({three_way_partition_init_kernel_name, three_way_partition_init_kernel_lowered_name})
-      ->get_name({three_way_partition_kernel_name, three_way_partition_kernel_lowered_name})
-      ->link_program()
-      ->add_link_list(linkable_list)
-      ->finalize_program();
+  cccl::detail::build_cache_key cache_key;
+  cache_key.add(final_src).add(args.data(), args.size()).add(lopts, num_lto_args).add(linkable_list);
+  cache_key.add({three_way_partition_init_kernel_name, three_way_partition_kernel_name});
+  nvrtc_link_result result = cccl::detail::cached_build(
+    cache_key,
+    {&three_way_partition_init_kernel_lowered_name, &three_way_partition_kernel_lowered_name},
+    [&] {
+      return begin_linking_nvrtc_program(num_lto_args, lopts)
+        ->add_program(nvrtc_translation_unit{final_src.c_str(), name})
+        ->add_expression({three_way_partition_init_kernel_name})
+        ->add_expression({three_way_partition_kernel_name})
+        ->compile_program({args.data(), args.size()})
+        ->get_name({three_way_partition_init_kernel_name, three_way_partition_init_kernel_lowered_name})
+        ->get_name({three_way_partition_kernel_name, three_way_partition_kernel_lowered_name})
+        ->link_program()
+        ->add_link_list(linkable_list)
+        ->finalize_program();
+    });
 
   cuLibraryLoadData(&build_ptr->library, result.data.get(), nullptr, nullptr, 0, nullptr, nullptr, 0);
   check(cuLibraryGetKernel(&build_ptr->three_way_partition_init_kernel,
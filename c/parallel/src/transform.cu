@@ -35,6 +35,7 @@
 #include <cccl/c/types.h> // cccl_type_info
 #include <nvrtc/command_list.h>
 #include <nvrtc/ltoir_list_appender.h>
+#include <util/build_cache.h>
 #include <util/build_utils.h>
 #include <util/context.h>
 #include <util/errors.h>
@@ -307,8 +308,11 @@ static_assert(device_transform_policy()(::cuda::arch_id{{CUB_PTX_ARCH / 10}}) ==
   appender.add_iterator_definition(input_it);
   appender.add_iterator_definition(output_it);
 
-  nvrtc_link_result result =
-    begin_linking_nvrtc_program(num_lto_args, lopts)
+  cccl::detail::build_cache_key cache_key;
+  cache_key.add(final_src).add(args.data(), args.size()).add(lopts, num_lto_args).add(linkable_list);
+  cache_key.add({kernel_name});
+  nvrtc_link_result result = cccl::detail::cached_build(cache_key, {&kernel_lowered_name}, [&] {
+    return begin_linking_nvrtc_program(num_lto_args, lopts)
       ->add_program(nvrtc_translation_unit{final_src.c_str(), name})
       ->add_expression({kernel_name})
       ->compile_program({args.data(), args.size()})
@@ -316,6 +320,7 @@ static_assert(device_transform_policy()(::cuda::arch_id{{CUB_PTX_ARCH / 10}}) ==
       ->link_program()
       ->add_link_list(linkable_list)
       ->finalize_program();
+  });
 
   cuLibraryLoadData(&build_ptr->library, result.data.get(), nullptr, nullptr, 0, nullptr, nullptr, 0);
   check(cuLibraryGetKernel(&build_ptr->transform_kernel, build_ptr->library, kernel_lowered_name.c_str()));
@@ -508,8 +513,11 @@ static_assert(device_transform_policy()(::cuda::arch_id{{CUB_PTX_ARCH / 10}}) ==
   appender.add_iterator_definition(input2_it);
   appender.add_iterator_definition(output_it);
 
-  nvrtc_link_result result =
-    begin_linking_nvrtc_program(num_lto_args, lopts)
+  cccl::detail::build_cache_key cache_key;
+  cache_key.add(final_src).add(args.data(), args.size()).add(lopts, num_lto_args).add(linkable_list);
+  cache_key.add({kernel_name});
+  nvrtc_link_result result = cccl::detail::cached_build(cache_key, {&kernel_lowered_name}, [&] {
+    return begin_linking_nvrtc_program(num_lto_args, lopts)
       ->add_program(nvrtc_translation_unit{final_src.c_str(), name})
       ->add_expression({kernel_name})
       ->compile_program({args.data(), args.size()})
@@ -517,6 +525,7 @@ static_assert(device_transform_policy()(::cuda::arch_id{{CUB_PTX_ARCH / 10}}) ==
       ->link_program()
       ->add_link_list(linkable_list)
       ->finalize_program();
+  });
 
   cuLibraryLoadData(&build_ptr->library, result.data.get(), nullptr, nullptr, 0, nullptr, nullptr, 0);
   check(cuLibraryGetKernel(&build_ptr->transform_kernel, build_ptr->library, kernel_lowered_name.c_str()));
@@ -0,0 +1,277 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA Core Compute Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/version>
+
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <optional>
+#include <random>
+#include <system_error>
+#include <type_traits>
+#include <variant>
+
+#include "build_cache.h"
+#include "errors.h"
+
+namespace cccl::detail
+{
+namespace
+{
+constexpr char entry_magic[8] = {'C', 'C', 'C', 'L', 'B', 'C', '0', '1'};
+
+// Upper bound of any size stored in an entry, to reject corrupted entries before allocating
+constexpr std::uint64_t max_entry_size = std::uint64_t{1} << 32;
+
+std::uint64_t splitmix64(std::uint64_t x)
+{
+  x += 0x9e3779b97f4a7c15ull;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+  return x ^ (x >> 31);
+}
+
+std::optional<std::filesystem::path> cache_directory()
+{
+  const char* dir = std::getenv("CCCL_C_PARALLEL_BUILD_CACHE_DIR");
+  if (dir == nullptr || *dir == '\0')
+  {
+    return std::nullopt;
+  }
+  return std::filesystem::path{dir};
+}
+
+std::filesystem::path entry_path(const std::filesystem::path& dir, const build_cache_key& key)
+{
+  return dir / (key.str() + ".cubin");
+}
+
+void write_u64(std::ostream& os, std::uint64_t value)
+{
+  os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void write_bytes(std::ostream& os, const char* data, std::size_t size)
+{
+  write_u64(os, size);
+  os.write(data, static_cast<std::streamsize>(size));
+}
+
+bool read_u64(std::istream& is, std::uint64_t& value)
+{
+  return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(value)));
+}
+
+bool read_string(std::istream& is, std::string& str)
+{
+  std::uint64_t size{};
+  if (!read_u64(is, size) || size > max_entry_size)
+  {
+    return false;
+  }
+  str.resize(size);
+  return static_cast<bool>(is.read(str.data(), static_cast<std::streamsize>(size)));
+}
+} // namespace
+
+build_cache_key::build_cache_key()
+{
+  int nvrtc_major{};
+  int nvrtc_minor{};
+  check(nvrtcVersion(&nvrtc_major, &nvrtc_minor));
+  add(std::format("nvrtc {}.{} cccl {}", nvrtc_major, nvrtc_minor, CCCL_VERSION));
+}
+
+build_cache_key& build_cache_key::add(std::string_view bytes)
+{
+  const std::uint64_t size = bytes.size();
+
+  // FNV-1a over the size and the bytes
+  for (std::size_t i = 0; i < sizeof(size); ++i)
+  {
+    m_fnv = (m_fnv ^ ((size >> (8 * i)) & 0xff)) * 0x100000001b3ull;
+  }
+  for (const char c : bytes)
+  {
+    m_fnv = (m_fnv ^ static_cast<unsigned char>(c)) * 0x100000001b3ull;
+  }
+
+  // An independent hash of 8 byte words, so that a collision of the key requires collisions of both hashes
+  m_mix = splitmix64(m_mix ^ size);
+  std::size_t i = 0;
+  for (; i + sizeof(std::uint64_t) <= bytes.size(); i += sizeof(std::uint64_t))
+  {
+    std::uint64_t word{};
+    std::memcpy(&word, bytes.data() + i, sizeof(word));
+    m_mix = splitmix64(m_mix ^ word);
+  }
+  std::uint64_t tail{};
+  if (i < bytes.size())
+  {
+    std::memcpy(&tail, bytes.data() + i, bytes.size() - i);
+  }
+  m_mix = splitmix64(m_mix ^ tail);
+
+  return *this;
+}
+
+build_cache_key& build_cache_key::add(const char* const* args, std::size_t num_args)
+{
+  for (std::size_t i = 0; i < num_args; ++i)
+  {
+    // Unused optional arguments are null
+    add(args[i] == nullptr ? std::string_view{} : std::string_view{args[i]});
+  }
+  return *this;
+}
+
+build_cache_key& build_cache_key::add(std::initializer_list<std::string_view> pieces)
+{
+  for (const auto piece : pieces)
+  {
+    add(piece);
+  }
+  return *this;
+}
+
+build_cache_key& build_cache_key::add(const nvrtc_linkable_list& linkables)
+{
+  for (const auto& linkable : linkables)
+  {
+    std::visit(
+      [&](const auto& l) {
+        using linkable_t = std::decay_t<decltype(l)>;
+        if constexpr (std::is_same_v<linkable_t, nvrtc_ltoir>)
+        {
+          add({"ltoir", std::string_view{l.ltoir, l.size}});
+        }
+        else
+        {
+          add({"code", std::string_view{l.code, l.size}});
+        }
+      },
+      linkable);
+  }
+  return *this;
+}
+
+std::string build_cache_key::str() const
+{
+  return std::format("{:016x}{:016x}", m_fnv, m_mix);
+}
+
+bool build_cache_enabled()
+{
+  return cache_directory().has_value();
+}
+
+bool load_cached_build(
+  const build_cache_key& key, nvrtc_link_result& result, std::initializer_list<std::string*> lowered_names)
+{
+  const auto dir = cache_directory();
+  if (!dir)
+  {
+    return false;
+  }
+
+  std::ifstream is(entry_path(*dir, key), std::ios::binary);
+  char magic[sizeof(entry_magic)]{};
+  if (!is.read(magic, sizeof(magic)) || std::memcmp(magic, entry_magic, sizeof(magic)) != 0)
+  {
+    return false;
+  }
+
+  std::string stored_key;
+  if (!read_string(is, stored_key) || stored_key != key.str())
+  {
+    return false;
+  }
+
+  std::uint64_t num_names{};
+  if (!read_u64(is, num_names) || num_names != lowered_names.size())
+  {
+    return false;
+  }
+  for (std::string* name : lowered_names)
+  {
+    if (!read_string(is, *name))
+    {
+      return false;
+    }
+  }
+
+  std::uint64_t size{};
+  if (!read_u64(is, size) || size == 0 || size > max_entry_size)
+  {
+    return false;
+  }
+  result.data = std::unique_ptr<char[]>(new char[size]);
+  result.size = size;
+  if (!is.read(result.data.get(), static_cast<std::streamsize>(size)))
+  {
+    return false;
+  }
+
+  // Trailing bytes indicate a corrupted entry
+  return is.peek() == std::ifstream::traits_type::eof();
+}
+
+void store_cached_build(
+  const build_cache_key& key, const nvrtc_link_result& result, std::initializer_list<std::string*> lowered_names)
+try
+{
+  const auto dir = cache_directory();
+  if (!dir || !result.data || result.size == 0)
+  {
+    return;
+  }
+
+  std::error_code ec;
+  std::filesystem::create_directories(*dir, ec);
+  if (ec)
+  {
+    return;
+  }
+
+  const auto path     = entry_path(*dir, key);
+  const auto tmp_path = *dir / std::format("{}.{:x}.tmp", key.str(), std::random_device{}());
+  {
+    std::ofstream os(tmp_path, std::ios::binary | std::ios::trunc);
+    os.write(entry_magic, sizeof(entry_magic));
+    const auto key_str = key.str();
+    write_bytes(os, key_str.data(), key_str.size());
+    write_u64(os, lowered_names.size());
+    for (const std::string* name : lowered_names)
+    {
+      write_bytes(os, name->data(), name->size());
+    }
+    write_bytes(os, result.data.get(), result.size);
+    if (!os.flush())
+    {
+      os.close();
+      std::filesystem::remove(tmp_path, ec);
+      return;
+    }
+  }
+
+  std::filesystem::rename(tmp_path, path, ec);
+  if (ec)
+  {
+    std::filesystem::remove(tmp_path, ec);
+  }
+}
+catch (const std::exception&)
+{
+  // The cache only affects build times
+}
+} // namespace cccl::detail
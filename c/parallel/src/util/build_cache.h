@@ -0,0 +1,99 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA Core Compute Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <nvrtc/command_list.h>
+
+namespace cccl::detail
+{
+/**
+ * @brief Content hash of everything that determines the output of an NVRTC + nvJitLink build
+ *
+ * The generated source embeds the iterator, operation and type descriptors and the tuning policy, and the compile
+ * and link options contain the target architecture. The NVRTC and CCCL versions are added on construction.
+ */
+class build_cache_key
+{
+  std::uint64_t m_fnv = 0xcbf29ce484222325ull;
+  std::uint64_t m_mix = 0x9e3779b97f4a7c15ull;
+
+public:
+  build_cache_key();
+
+  // Every piece is length-prefixed, so that different splits of the same bytes yield different keys
+  build_cache_key& add(std::string_view bytes);
+  build_cache_key& add(const char* const* args, std::size_t num_args);
+  build_cache_key& add(std::initializer_list<std::string_view> pieces);
+  build_cache_key& add(const nvrtc_linkable_list& linkables);
+
+  // 32 hexadecimal digits, used as the file name of the cache entry
+  std::string str() const;
+};
+
+/**
+ * @brief Returns whether build caching is enabled
+ *
+ * Caching is enabled by setting the environment variable `CCCL_C_PARALLEL_BUILD_CACHE_DIR` to a writable directory.
+ * Entries are never evicted; the directory can be deleted at any time.
+ */
+bool build_cache_enabled();
+
+/**
+ * @brief Reads the cached build for `key` into `result` and `lowered_names`
+ *
+ * @return false if there is no valid entry for `key`, in which case the outputs are unspecified
+ */
+bool load_cached_build(
+  const build_cache_key& key, nvrtc_link_result& result, std::initializer_list<std::string*> lowered_names);
+
+/**
+ * @brief Writes `result` and `lowered_names` as the cached build for `key`
+ *
+ * Failures are ignored: the cache only affects build times. The entry is written to a temporary file that is renamed
+ * afterwards, so that concurrent processes never read partially written entries.
+ */
+void store_cached_build(
+  const build_cache_key& key, const nvrtc_link_result& result, std::initializer_list<std::string*> lowered_names);
+
+/**
+ * @brief Returns the cached build for `key`, or the result of `build` after caching it
+ *
+ * @param key Content hash of the build inputs
+ * @param lowered_names Lowered kernel names written by `build`, which are cached with its result
+ * @param build Callable that compiles and links the program and returns the `nvrtc_link_result`
+ */
+template <typename BuildFn>
+nvrtc_link_result
+cached_build(const build_cache_key& key, std::initializer_list<std::string*> lowered_names, BuildFn&& build)
+{
+  if (!build_cache_enabled())
+  {
+    return std::forward<BuildFn>(build)();
+  }
+
+  nvrtc_link_result result{};
+  if (load_cached_build(key, result, lowered_names))
+  {
+    return result;
+  }
+
+  result = std::forward<BuildFn>(build)();
+  store_cached_build(key, result, lowered_names);
+  return result;
+}
+} // namespace cccl::detail
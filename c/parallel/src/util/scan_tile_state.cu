@@ -11,6 +11,7 @@
 #include <format>
 #include <regex>
 
+#include "build_cache.h"
 #include "scan_tile_state.h"
 
 // TODO: NVRTC doesn't currently support extracting basic type
@@ -55,12 +56,15 @@ std::pair<size_t, size_t> get_tile_state_bytes_per_tile(
         )XXX";
 
   const std::string ptx_src = std::format(ptx_src_template, accum_t.size, accum_t.alignment, accum_cpp);
-  auto compile_result =
-    begin_linking_nvrtc_program(num_ptx_lto_args, ptx_lopts)
+  cccl::detail::build_cache_key cache_key;
+  cache_key.add(ptx_src).add(ptx_args, num_ptx_args).add(ptx_lopts, num_ptx_lto_args);
+  auto compile_result = cccl::detail::cached_build(cache_key, {}, [&] {
+    return begin_linking_nvrtc_program(num_ptx_lto_args, ptx_lopts)
       ->add_program(nvrtc_translation_unit{ptx_src.c_str(), "tile_state_info"})
       ->compile_program({ptx_args, num_ptx_args})
       ->link_program()
       ->finalize_program();
+  });
   auto ptx_code = compile_result.data.get();
 
   size_t description_bytes_per_tile;
@@ -9,9 +9,15 @@
 //===----------------------------------------------------------------------===//
 
 #include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
 #include <iostream> // std::cerr
+#include <iterator>
 #include <optional> // std::optional
 #include <string>
+#include <utility>
 
 #include <cuda_runtime.h>
 #include <stdint.h>
@@ -304,6 +310,104 @@ C2H_TEST("For works with C++ source operations using custom headers", "[for]")
   REQUIRE(CUDA_SUCCESS == cccl_device_for_cleanup(&build));
 }
 
+// Sets an environment variable and restores its previous value on destruction
+class scoped_env_var
+{
+  std::string m_name;
+  std::optional<std::string> m_previous_value;
+
+public:
+  scoped_env_var(std::string name, const std::string& value)
+      : m_name(std::move(name))
+  {
+    if (const char* previous_value = std::getenv(m_name.c_str()))
+    {
+      m_previous_value = previous_value;
+    }
+    REQUIRE(0 == setenv(m_name.c_str(), value.c_str(), 1));
+  }
+
+  scoped_env_var(const scoped_env_var&)            = delete;
+  scoped_env_var& operator=(const scoped_env_var&) = delete;
+
+  ~scoped_env_var()
+  {
+    if (m_previous_value)
+    {
+      setenv(m_name.c_str(), m_previous_value->c_str(), 1);
+    }
+    else
+    {
+      unsetenv(m_name.c_str());
+    }
+  }
+};
+
+C2H_TEST("for reuses builds from the on-disk build cache", "[for]")
+{
+  namespace fs = std::filesystem;
+
+  const fs::path cache_dir = fs::temp_directory_path() / "cccl_c_parallel_test_build_cache";
+  fs::remove_all(cache_dir);
+  scoped_env_var cache_dir_env("CCCL_C_PARALLEL_BUILD_CACHE_DIR", cache_dir.string());
+
+  const auto num_entries = [&] {
+    return std::distance(fs::directory_iterator{cache_dir}, fs::directory_iterator{});
+  };
+
+  const uint64_t num_items = 1 << 12;
+  operation_t op           = make_operation("op", get_for_op(get_type_info<int32_t>().type));
+
+  const auto build_and_run = [&] {
+    std::vector<int32_t> input(num_items, 1);
+    pointer_t<int32_t> input_ptr(input);
+
+    for_each_uncached(input_ptr, num_items, op);
+
+    input = input_ptr;
+    REQUIRE(std::all_of(input.begin(), input.end(), [](auto&& v) {
+      return v == 2;
+    }));
+    REQUIRE(num_entries() == 1);
+  };
+
+  // The first build populates the cache
+  build_and_run();
+  const fs::path entry = fs::directory_iterator{cache_dir}->path();
+
+  // Every miss replaces the entry, so an entry that keeps its modification time was loaded rather than rebuilt
+  const auto sentinel_time = fs::last_write_time(entry) - std::chrono::hours{24};
+  fs::last_write_time(entry, sentinel_time);
+
+  build_and_run();
+  REQUIRE(fs::last_write_time(entry) == sentinel_time);
+
+  // An entry whose stored key does not match its file name is rejected and rebuilt. The key follows the 8 byte magic
+  // and its 8 byte length.
+  constexpr std::streamoff stored_key_offset = 16;
+  char first_key_digit{};
+  {
+    std::fstream file(entry, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekg(stored_key_offset);
+    REQUIRE(file.get(first_key_digit).good());
+    file.seekp(stored_key_offset);
+    REQUIRE(file.put(first_key_digit == '0' ? '1' : '0').good());
+  }
+  fs::last_write_time(entry, sentinel_time);
+
+  build_and_run();
+  REQUIRE(fs::last_write_time(entry) != sentinel_time);
+  {
+    std::ifstream file(entry, std::ios::binary);
+    file.seekg(stored_key_offset);
+    char restored_key_digit{};
+    REQUIRE(file.get(restored_key_digit).good());
+    REQUIRE(restored_key_digit == first_key_digit);
+  }
+
+  fs::remove_all(cache_dir);
+}
+
 // TODO:
 /*
 C2H_TEST("for works with iterators", "[for]")
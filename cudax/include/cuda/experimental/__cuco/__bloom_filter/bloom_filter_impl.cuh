@@ -0,0 +1,313 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO___BLOOM_FILTER_BLOOM_FILTER_IMPL_CUH
+#define _CUDAX___CUCO___BLOOM_FILTER_BLOOM_FILTER_IMPL_CUH
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__memory/is_aligned.h>
+#include <cuda/atomic>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__host_stdlib/stdexcept>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__memory/assume_aligned.h>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+
+#include <cuda/experimental/__cuco/__utility/host_threads.cuh>
+
+#include <cuda/std/__cccl/prologue.h>
+
+namespace cuda::experimental::cuco
+{
+namespace __bloom_filter_ns
+{
+//! Minimum number of keys a host thread processes in the bulk operations, so that the cost of starting the thread is
+//! amortized.
+inline constexpr ::cuda::std::size_t __host_items_per_thread = 1 << 14;
+} // namespace __bloom_filter_ns
+
+//! @brief Implementation shared by `bloom_filter_ref` and `bloom_filter`.
+//!
+//! The filter is a flat array of `__num_blocks() * __words_per_block` words. Block `b` occupies the words
+//! [`b * __words_per_block`, `(b + 1) * __words_per_block`). The layout is the same on host and device, so a filter
+//! can be serialized by copying the words and deserialized by constructing a ref over a copy of them.
+//!
+//! @tparam _Key Type of the keys
+//! @tparam _Scope The scope in which operations will be performed by individual threads
+//! @tparam _Policy Fingerprint policy, see `default_filter_policy`
+template <class _Key, ::cuda::thread_scope _Scope, class _Policy>
+class __bloom_filter_impl
+{
+public:
+  using __key_type    = _Key; ///< Key type
+  using __policy_type = _Policy; ///< Fingerprint policy type
+  using __word_type   = typename _Policy::word_type; ///< Type of the words of a block
+  using __size_type   = ::cuda::std::size_t; ///< Size type
+
+  static constexpr auto __thread_scope                     = _Scope; ///< CUDA thread scope
+  static constexpr ::cuda::std::uint32_t __words_per_block = _Policy::words_per_block; ///< Number of words per block
+  static constexpr ::cuda::std::size_t __block_bytes = __words_per_block * sizeof(__word_type); ///< Bytes per block
+
+private:
+  _Policy __policy; ///< Fingerprint policy
+  ::cuda::std::span<__word_type> __words; ///< Filter storage
+
+  //! @brief Returns a pointer to the first word of block `__block`.
+  [[nodiscard]] _CCCL_API __word_type* __block_ptr(__size_type __block) const noexcept
+  {
+    return ::cuda::std::assume_aligned<__block_bytes>(__words.data() + __block * __words_per_block);
+  }
+
+public:
+  //! @brief Constructs a non-owning `__bloom_filter_impl` object.
+  //!
+  //! @throw If the storage is empty, its size is not a multiple of `__words_per_block` or it is not aligned to
+  //! `__block_bytes`.
+  //!
+  //! @param __words Reference to the filter storage
+  //! @param __policy Fingerprint policy
+  _CCCL_API constexpr __bloom_filter_impl(::cuda::std::span<__word_type> __words, const _Policy& __policy)
+      : __policy{__policy}
+      , __words{__words}
+  {
+    if (__words.empty() || __words.size() % __words_per_block != 0)
+    {
+      _CCCL_THROW(::std::invalid_argument, "Filter storage size must be a positive multiple of the block size");
+    }
+    if (!::cuda::is_aligned(__words.data(), __block_bytes))
+    {
+      _CCCL_THROW(::std::invalid_argument, "Filter storage has insufficient alignment");
+    }
+  }
+
+  //! @brief Returns the number of words of a filter with `__num_blocks` blocks.
+  [[nodiscard]] _CCCL_API static constexpr __size_type __storage_words(__size_type __num_blocks) noexcept
+  {
+    return __num_blocks * __words_per_block;
+  }
+
+  //! @brief Gets the number of blocks.
+  [[nodiscard]] _CCCL_API constexpr __size_type __num_blocks() const noexcept
+  {
+    return __words.size() / __words_per_block;
+  }
+
+  //! @brief Gets the filter storage.
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::span<__word_type> __storage() const noexcept
+  {
+    return __words;
+  }
+
+  //! @brief Gets the fingerprint policy.
+  [[nodiscard]] _CCCL_API constexpr const _Policy& __fingerprint_policy() const noexcept
+  {
+    return __policy;
+  }
+
+  //! @brief Adds a key to the filter.
+  //!
+  //! @param __key The key to add
+  _CCCL_API void __add(const _Key& __key) const noexcept
+  {
+    const auto __hash   = __policy.hash(__key);
+    auto* const __block = __block_ptr(__policy.block_index(__hash, __num_blocks()));
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (::cuda::std::uint32_t __i = 0; __i < __words_per_block; ++__i)
+    {
+      __set_bits(__block[__i], __policy.word_pattern(__hash, __i));
+    }
+  }
+
+  //! @brief Cooperatively adds a key to the filter. Thread `r` of the group sets the bits of the words `r`,
+  //! `r + __group.size()`, ... of the block.
+  //!
+  //! @tparam _CG Cooperative group type of at most `__words_per_block` threads
+  //!
+  //! @param __group The cooperative group this operation is executed in
+  //! @param __key The key to add
+  template <class _CG>
+  _CCCL_DEVICE void __add(const _CG& __group, const _Key& __key) const noexcept
+  {
+    const auto __hash   = __policy.hash(__key);
+    auto* const __block = __block_ptr(__policy.block_index(__hash, __num_blocks()));
+    for (auto __i = static_cast<::cuda::std::uint32_t>(__group.thread_rank()); __i < __words_per_block;
+         __i += static_cast<::cuda::std::uint32_t>(__group.size()))
+    {
+      __set_bits(__block[__i], __policy.word_pattern(__hash, __i));
+    }
+  }
+
+  //! @brief Returns whether a key may have been added to the filter.
+  //!
+  //! The fingerprint is computed before the block is read. The block is then tested as a whole with a branch free
+  //! reduction over its words, which host compilers vectorize and device compilers turn into vector loads.
+  //!
+  //! @param __key The key to query
+  //!
+  //! @return `false` if the key has definitely not been added, `true` otherwise
+  [[nodiscard]] _CCCL_API bool __contains(const _Key& __key) const noexcept
+  {
+    const auto __hash = __policy.hash(__key);
+    __word_type __pattern[__words_per_block];
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (::cuda::std::uint32_t __i = 0; __i < __words_per_block; ++__i)
+    {
+      __pattern[__i] = __policy.word_pattern(__hash, __i);
+    }
+
+    const auto* const __block = __block_ptr(__policy.block_index(__hash, __num_blocks()));
+    __word_type __missing     = 0;
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (::cuda::std::uint32_t __i = 0; __i < __words_per_block; ++__i)
+    {
+      __missing |= __pattern[__i] & ~__block[__i];
+    }
+    return __missing == 0;
+  }
+
+  //! @brief Cooperatively returns whether a key may have been added to the filter. Thread `r` of the group tests the
+  //! words `r`, `r + __group.size()`, ... of the block.
+  //!
+  //! @tparam _CG Cooperative group type of at most `__words_per_block` threads
+  //!
+  //! @param __group The cooperative group this operation is executed in
+  //! @param __key The key to query
+  //!
+  //! @return `false` if the key has definitely not been added, `true` otherwise
+  template <class _CG>
+  [[nodiscard]] _CCCL_DEVICE bool __contains(const _CG& __group, const _Key& __key) const noexcept
+  {
+    const auto __hash         = __policy.hash(__key);
+    const auto* const __block = __block_ptr(__policy.block_index(__hash, __num_blocks()));
+    __word_type __missing     = 0;
+    for (auto __i = static_cast<::cuda::std::uint32_t>(__group.thread_rank()); __i < __words_per_block;
+         __i += static_cast<::cuda::std::uint32_t>(__group.size()))
+    {
+      __missing |= __policy.word_pattern(__hash, __i) & ~__block[__i];
+    }
+    return __group.all(__missing == 0);
+  }
+
+  //! @brief Clears all bits of the filter on the host.
+  //!
+  //! @note The filter storage must be host accessible.
+  _CCCL_HOST void __clear_host(unsigned __max_threads) const
+  {
+    const auto __num_threads = ::cuda::experimental::cuco::__host_thread_count(
+      __words.size(), 16 * __bloom_filter_ns::__host_items_per_thread, __max_threads);
+    ::cuda::experimental::cuco::__host_parallel_for(
+      __words.size(), __num_threads, [this](__size_type __begin, __size_type __end) {
+        for (auto __i = __begin; __i < __end; ++__i)
+        {
+          __words[__i] = 0;
+        }
+      });
+  }
+
+  //! @brief Adds the keys of [`__first`, `__last`) to the filter on the host.
+  //!
+  //! @note The filter storage must be host accessible. Host threads set bits with atomic operations, so this
+  //! function may run concurrently with other additions.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator whose value type is convertible to `_Key`
+  //!
+  //! @param __first Beginning of the sequence of keys
+  //! @param __last End of the sequence of keys
+  //! @param __max_threads Upper bound of the number of host threads, or 0 for the number of hardware threads
+  template <class _InputIt>
+  _CCCL_HOST void __add_host(_InputIt __first, _InputIt __last, unsigned __max_threads) const
+  {
+    const auto __num_items = static_cast<__size_type>(::cuda::std::distance(__first, __last));
+    const auto __num_threads = ::cuda::experimental::cuco::__host_thread_count(
+      __num_items, __bloom_filter_ns::__host_items_per_thread, __max_threads);
+    ::cuda::experimental::cuco::__host_parallel_for(
+      __num_items, __num_threads, [&](__size_type __begin, __size_type __end) {
+        for (auto __i = __begin; __i < __end; ++__i)
+        {
+          __add(static_cast<_Key>(*(__first + __i)));
+        }
+      });
+  }
+
+  //! @brief Writes whether each key of [`__first`, `__last`) may have been added to `__output_begin` on the host.
+  //!
+  //! @note The filter storage must be host accessible. This function must not run concurrently with additions.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator whose value type is convertible to `_Key`
+  //! @tparam _OutputIt Host accessible random access output iterator assignable from `bool`
+  //!
+  //! @param __first Beginning of the sequence of keys
+  //! @param __last End of the sequence of keys
+  //! @param __output_begin Beginning of the sequence of results
+  //! @param __max_threads Upper bound of the number of host threads, or 0 for the number of hardware threads
+  template <class _InputIt, class _OutputIt>
+  _CCCL_HOST void
+  __contains_host(_InputIt __first, _InputIt __last, _OutputIt __output_begin, unsigned __max_threads) const
+  {
+    const auto __num_items = static_cast<__size_type>(::cuda::std::distance(__first, __last));
+    const auto __num_threads = ::cuda::experimental::cuco::__host_thread_count(
+      __num_items, __bloom_filter_ns::__host_items_per_thread, __max_threads);
+    ::cuda::experimental::cuco::__host_parallel_for(
+      __num_items, __num_threads, [&](__size_type __begin, __size_type __end) {
+        for (auto __i = __begin; __i < __end; ++__i)
+        {
+          __output_begin[__i] = __contains(static_cast<_Key>(*(__first + __i)));
+        }
+      });
+  }
+
+  //! @brief Merges the bits of another filter into this filter on the host.
+  //!
+  //! @note The storage of both filters must be host accessible.
+  //!
+  //! @throw If the filters have different numbers of blocks.
+  //!
+  //! @param __other Filter with the same number of blocks and an equivalent fingerprint policy
+  template <::cuda::thread_scope _OtherScope>
+  _CCCL_HOST void __merge_host(const __bloom_filter_impl<_Key, _OtherScope, _Policy>& __other) const
+  {
+    const auto __other_words = __other.__storage();
+    if (__other_words.size() != __words.size())
+    {
+      _CCCL_THROW(::std::invalid_argument, "Cannot merge filters with different numbers of blocks");
+    }
+    for (__size_type __i = 0; __i < __words.size(); ++__i)
+    {
+      __words[__i] |= __other_words[__i];
+    }
+  }
+
+private:
+  //! @brief Atomically sets the bits of `__pattern` in `__word`. The atomic operation is skipped if all of them are
+  //! already set, which is common once the filter fills up and avoids contention on the block.
+  _CCCL_API static void __set_bits(__word_type& __word, __word_type __pattern) noexcept
+  {
+    ::cuda::atomic_ref<__word_type, _Scope> __ref{__word};
+    if ((__ref.load(::cuda::std::memory_order_relaxed) & __pattern) != __pattern)
+    {
+      __ref.fetch_or(__pattern, ::cuda::std::memory_order_relaxed);
+    }
+  }
+};
+} // namespace cuda::experimental::cuco
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO___BLOOM_FILTER_BLOOM_FILTER_IMPL_CUH
@@ -0,0 +1,104 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO___BLOOM_FILTER_KERNELS_CUH
+#define _CUDAX___CUCO___BLOOM_FILTER_KERNELS_CUH
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/cstdint>
+
+#include <cooperative_groups.h>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_DIAG_PUSH
+_CCCL_DIAG_SUPPRESS_GCC("-Wattributes")
+
+namespace cuda::experimental::cuco::__bloom_filter_ns
+{
+//! Number of threads per block of the bulk operation kernels
+inline constexpr int __block_size = 128;
+
+//! @brief Returns the global thread ID in a 1D grid
+[[nodiscard]] _CCCL_DEVICE inline ::cuda::std::int64_t __global_thread_id() noexcept
+{
+  return static_cast<::cuda::std::int64_t>(blockDim.x) * blockIdx.x + threadIdx.x;
+}
+
+//! @brief Returns the grid stride of a 1D grid
+[[nodiscard]] _CCCL_DEVICE inline ::cuda::std::int64_t __grid_stride() noexcept
+{
+  return static_cast<::cuda::std::int64_t>(gridDim.x) * blockDim.x;
+}
+
+template <int _CGSize, class _InputIt, class _RefType>
+CCCL_DETAIL_KERNEL_ATTRIBUTES void __add(_InputIt __first, ::cuda::std::int64_t __n, _RefType __ref)
+{
+  using __key_type = typename _RefType::__key_type;
+
+  if constexpr (_CGSize == 1)
+  {
+    for (auto __idx = __global_thread_id(); __idx < __n; __idx += __grid_stride())
+    {
+      __ref.__add(static_cast<__key_type>(*(__first + __idx)));
+    }
+  }
+  else
+  {
+    const auto __tile = ::cooperative_groups::tiled_partition<_CGSize>(::cooperative_groups::this_thread_block());
+    for (auto __idx = __global_thread_id() / _CGSize; __idx < __n; __idx += __grid_stride() / _CGSize)
+    {
+      __ref.__add(__tile, static_cast<__key_type>(*(__first + __idx)));
+    }
+  }
+}
+
+template <int _CGSize, class _InputIt, class _OutputIt, class _RefType>
+CCCL_DETAIL_KERNEL_ATTRIBUTES void
+__contains(_InputIt __first, ::cuda::std::int64_t __n, _OutputIt __output_begin, _RefType __ref)
+{
+  using __key_type = typename _RefType::__key_type;
+
+  if constexpr (_CGSize == 1)
+  {
+    for (auto __idx = __global_thread_id(); __idx < __n; __idx += __grid_stride())
+    {
+      *(__output_begin + __idx) = __ref.__contains(static_cast<__key_type>(*(__first + __idx)));
+    }
+  }
+  else
+  {
+    const auto __tile = ::cooperative_groups::tiled_partition<_CGSize>(::cooperative_groups::this_thread_block());
+    for (auto __idx = __global_thread_id() / _CGSize; __idx < __n; __idx += __grid_stride() / _CGSize)
+    {
+      const bool __found = __ref.__contains(__tile, static_cast<__key_type>(*(__first + __idx)));
+      if (__tile.thread_rank() == 0)
+      {
+        *(__output_begin + __idx) = __found;
+      }
+    }
+  }
+}
+} // namespace cuda::experimental::cuco::__bloom_filter_ns
+
+_CCCL_DIAG_POP
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO___BLOOM_FILTER_KERNELS_CUH
@@ -112,7 +112,86 @@ struct _MurmurHash3_32
     return __compute_hash_span(__keys);
   }
 
+  //! @brief Hashes every key of `__keys` into the corresponding element of `__out`. The results are identical to
+  //! hashing the keys one by one, but several keys are hashed at a time in lanes.
+  //! @param __keys The keys to hash
+  //! @param __out The resulting hash values, which must hold at least `__keys.size()` elements
+  _CCCL_API void
+  hash_bulk(::cuda::std::span<const _Key> __keys, ::cuda::std::span<::cuda::std::uint32_t> __out) const noexcept
+  {
+    auto __hash_lanes = [this](auto __lanes, const _Key* __first, ::cuda::std::uint32_t* __result) {
+      __compute_hash_lanes<decltype(__lanes)::value>(__first, __result);
+    };
+    auto __hash_one = [this](const _Key& __key) {
+      return (*this)(__key);
+    };
+    ::cuda::experimental::cuco::__hash_bulk<16, 4>(__keys, __out, __hash_lanes, __hash_one);
+  }
+
 private:
+  //! @brief Hashes `_Lanes` keys at a time. Every statement of `__compute_hash` is applied to all lanes before the
+  //! next one, so that the compiler can map the lanes onto vector registers.
+  template <size_t _Lanes>
+  _CCCL_API void __compute_hash_lanes(const _Key* __keys, ::cuda::std::uint32_t* __out) const noexcept
+  {
+    using _Holder = _Byte_holder<sizeof(_Key), __chunk_size, __block_size, false, ::cuda::std::uint32_t>;
+    _Holder __holders[_Lanes];
+    ::cuda::std::uint32_t __h1[_Lanes];
+
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (size_t __l = 0; __l < _Lanes; ++__l)
+    {
+      __holders[__l] = ::cuda::std::bit_cast<_Holder>(__keys[__l]);
+      __h1[__l]      = __seed_;
+    }
+
+    //----------
+    // body
+    if constexpr (_Holder::__num_blocks > 0)
+    {
+      ::cuda::static_for<_Holder::__num_blocks>([&](auto __i) {
+        _CCCL_PRAGMA_UNROLL_FULL()
+        for (size_t __l = 0; __l < _Lanes; ++__l)
+        {
+          ::cuda::std::uint32_t __k1 = __holders[__l].__blocks[__i];
+          __k1 *= __c1;
+          __k1 = ::cuda::std::rotl(__k1, 15);
+          __k1 *= __c2;
+          __h1[__l] ^= __k1;
+          __h1[__l] = ::cuda::std::rotl(__h1[__l], 13);
+          __h1[__l] = __h1[__l] * 5 + 0xe6546b64;
+        }
+      });
+    }
+
+    //----------
+    // tail
+    if constexpr (_Holder::__tail_size > 0)
+    {
+      _CCCL_PRAGMA_UNROLL_FULL()
+      for (size_t __l = 0; __l < _Lanes; ++__l)
+      {
+        ::cuda::std::uint32_t __k1 = 0;
+        ::cuda::static_for<_Holder::__tail_size>([&](auto __i) {
+          __k1 ^= ::cuda::std::to_integer<::cuda::std::uint32_t>(__holders[__l].__bytes[__i]) << (8 * __i);
+        });
+        __k1 *= __c1;
+        __k1 = ::cuda::std::rotl(__k1, 15);
+        __k1 *= __c2;
+        __h1[__l] ^= __k1;
+      }
+    }
+
+    //----------
+    // finalization
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (size_t __l = 0; __l < _Lanes; ++__l)
+    {
+      __h1[__l] ^= ::cuda::std::uint32_t{sizeof(_Holder)};
+      __out[__l] = ::cuda::experimental::cuco::__fmix32(__h1[__l]);
+    }
+  }
+
   template <class _Holder>
   [[nodiscard]] _CCCL_API ::cuda::std::uint32_t __compute_hash(_Holder __holder) const noexcept
   {
@@ -250,6 +329,21 @@ public:
     return __compute_hash_span(__keys);
   }
 
+  //! @brief Hashes every key of `__keys` into the corresponding element of `__out`. The results are identical to
+  //! hashing the keys one by one.
+  //! @param __keys The keys to hash
+  //! @param __out The resulting hash values, which must hold at least `__keys.size()` elements
+  _CCCL_HOST_DEVICE void
+  hash_bulk(::cuda::std::span<const _Key> __keys, ::cuda::std::span<__uint128_t> __out) const noexcept
+  {
+    _CCCL_ASSERT(__out.size() >= __keys.size(), "The output must hold a hash value for every key");
+    _CCCL_PRAGMA_UNROLL(4)
+    for (size_t __i = 0; __i < __keys.size(); ++__i)
+    {
+      __out[__i] = (*this)(__keys[__i]);
+    }
+  }
+
 private:
   template <class _Holder>
   [[nodiscard]] _CCCL_HOST_DEVICE constexpr __uint128_t __compute_hash(_Holder __holder) const noexcept
@@ -607,6 +701,21 @@ public:
     return __compute_hash_span(__keys);
   }
 
+  //! @brief Hashes every key of `__keys` into the corresponding element of `__out`. The results are identical to
+  //! hashing the keys one by one.
+  //! @param __keys The keys to hash
+  //! @param __out The resulting hash values, which must hold at least `__keys.size()` elements
+  _CCCL_HOST_DEVICE void
+  hash_bulk(::cuda::std::span<const _Key> __keys, ::cuda::std::span<__uint128_t> __out) const noexcept
+  {
+    _CCCL_ASSERT(__out.size() >= __keys.size(), "The output must hold a hash value for every key");
+    _CCCL_PRAGMA_UNROLL(4)
+    for (size_t __i = 0; __i < __keys.size(); ++__i)
+    {
+      __out[__i] = (*this)(__keys[__i]);
+    }
+  }
+
 private:
   template <class _Holder>
   [[nodiscard]] _CCCL_HOST_DEVICE constexpr __uint128_t __compute_hash(_Holder __holder) const noexcept
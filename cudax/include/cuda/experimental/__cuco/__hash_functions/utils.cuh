@@ -21,9 +21,14 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__cccl/assert.h>
 #include <cuda/std/__memory/assume_aligned.h>
+#include <cuda/std/__type_traits/integral_constant.h>
 #include <cuda/std/cstddef>
 #include <cuda/std/cstring>
+#include <cuda/std/span>
+
+#include <nv/target>
 
 #include <cuda/std/__cccl/prologue.h>
 
@@ -65,6 +70,19 @@ template <typename _Tp, typename _Extent>
   return __chunk;
 }
 
+//! @brief Loads a value of type _Tp from a byte pointer without any alignment requirement
+//!
+//! @tparam _Tp The type of the value to load
+//! @param __ptr Pointer to the first byte of the value
+//! @return The loaded value
+template <typename _Tp>
+[[nodiscard]] _CCCL_API inline _Tp __load_unaligned(::cuda::std::byte const* __ptr) noexcept
+{
+  _Tp __value;
+  ::cuda::std::memcpy(&__value, __ptr, sizeof(_Tp));
+  return __value;
+}
+
 //! @brief Type erased holder of all the bytes
 //!
 //! @tparam _KeySize The size of the key in bytes
@@ -139,6 +157,53 @@ struct _Byte_holder<_KeySize, _ChunkSize, _BlockSize, _UseTailBlock, _BlockT, tr
 
   _BlockT __blocks[__num_blocks];
 };
+
+//! @brief Hashes `__n` keys into `__out`, `_Lanes` keys at a time with `__hash_lanes` and the remaining keys one by
+//! one with `__hash_one`.
+//!
+//! @param __hash_lanes Callable invoked as `__hash_lanes(integral_constant<size_t, _Lanes>{}, __keys, __out)`
+//! @param __hash_one Callable invoked as `__hash_one(__key)`
+template <size_t _Lanes, typename _Key, typename _Result, typename _HashLanes, typename _HashOne>
+_CCCL_API constexpr void __hash_bulk_n(
+  const _Key* __keys, size_t __n, _Result* __out, _HashLanes& __hash_lanes, _HashOne& __hash_one) noexcept
+{
+  size_t __i = 0;
+  for (; __i + _Lanes <= __n; __i += _Lanes)
+  {
+    __hash_lanes(::cuda::std::integral_constant<size_t, _Lanes>{}, __keys + __i, __out + __i);
+  }
+  for (; __i < __n; ++__i)
+  {
+    __out[__i] = __hash_one(__keys[__i]);
+  }
+}
+
+//! @brief Hashes every key of `__keys` into the corresponding element of `__out`.
+//!
+//! On the host, `_HostLanes` keys are hashed at a time, so that the rounds of independent keys can be mapped onto the
+//! lanes of vector registers. On the device, `_DeviceLanes` keys are hashed at a time in unrolled loops, which
+//! interleaves their multiply-rotate chains.
+//!
+//! @tparam _HostLanes Number of keys hashed at a time on the host
+//! @tparam _DeviceLanes Number of keys hashed at a time on the device
+template <size_t _HostLanes,
+          size_t _DeviceLanes,
+          typename _Key,
+          typename _Result,
+          typename _HashLanes,
+          typename _HashOne>
+_CCCL_API void __hash_bulk(::cuda::std::span<const _Key> __keys,
+                           ::cuda::std::span<_Result> __out,
+                           _HashLanes __hash_lanes,
+                           _HashOne __hash_one) noexcept
+{
+  _CCCL_ASSERT(__out.size() >= __keys.size(), "The output must hold a hash value for every key");
+  NV_IF_ELSE_TARGET(NV_IS_HOST,
+                    (::cuda::experimental::cuco::__hash_bulk_n<_HostLanes>(
+                       __keys.data(), __keys.size(), __out.data(), __hash_lanes, __hash_one);),
+                    (::cuda::experimental::cuco::__hash_bulk_n<_DeviceLanes>(
+                       __keys.data(), __keys.size(), __out.data(), __hash_lanes, __hash_one);))
+}
 } // namespace cuda::experimental::cuco
 
 #include <cuda/std/__cccl/epilogue.h>
@@ -114,7 +114,125 @@ public:
     return __compute_hash_span(__keys);
   }
 
+  //! @brief Hashes every key of `__keys` into the corresponding element of `__out`. The results are identical to
+  //! hashing the keys one by one, but several keys are hashed at a time in lanes.
+  //! @param __keys The keys to hash
+  //! @param __out The resulting hash values, which must hold at least `__keys.size()` elements
+  _CCCL_API void
+  hash_bulk(::cuda::std::span<const _Key> __keys, ::cuda::std::span<::cuda::std::uint32_t> __out) const noexcept
+  {
+    auto __hash_lanes = [this](auto __lanes, const _Key* __first, ::cuda::std::uint32_t* __result) {
+      __compute_hash_lanes<decltype(__lanes)::value>(__first, __result);
+    };
+    auto __hash_one = [this](const _Key& __key) {
+      return (*this)(__key);
+    };
+    ::cuda::experimental::cuco::__hash_bulk<16, 4>(__keys, __out, __hash_lanes, __hash_one);
+  }
+
 private:
+  //! @brief Hashes `_Lanes` keys at a time. Every statement of `__compute_hash` is applied to all lanes before the
+  //! next one, so that the compiler can map the lanes onto vector registers.
+  //!
+  //! @tparam _Lanes The number of keys
+  //! @param __keys The keys to hash
+  //! @param __out The resulting hash values
+  template <size_t _Lanes>
+  _CCCL_API void __compute_hash_lanes(const _Key* __keys, ::cuda::std::uint32_t* __out) const noexcept
+  {
+    using _Holder = _Byte_holder<sizeof(_Key), __chunk_size, __block_size, true, ::cuda::std::uint32_t>;
+    _Holder __holders[_Lanes];
+    ::cuda::std::uint32_t __h32[_Lanes];
+
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (size_t __l = 0; __l < _Lanes; ++__l)
+    {
+      __holders[__l] = ::cuda::std::bit_cast<_Holder>(__keys[__l]);
+    }
+
+    // process data in 16-byte chunks
+    if constexpr (_Holder::__num_chunks > 0)
+    {
+      ::cuda::std::uint32_t __v[4][_Lanes];
+      _CCCL_PRAGMA_UNROLL_FULL()
+      for (size_t __l = 0; __l < _Lanes; ++__l)
+      {
+        __v[0][__l] = __seed_ + __prime1 + __prime2;
+        __v[1][__l] = __seed_ + __prime2;
+        __v[2][__l] = __seed_;
+        __v[3][__l] = __seed_ - __prime1;
+      }
+
+      for (::cuda::std::uint32_t __i = 0; __i < _Holder::__num_chunks; ++__i)
+      {
+        ::cuda::static_for<4>([&](auto i) {
+          _CCCL_PRAGMA_UNROLL_FULL()
+          for (size_t __l = 0; __l < _Lanes; ++__l)
+          {
+            __v[i][__l] += __holders[__l].__blocks[__i * 4 + i] * __prime2;
+            __v[i][__l] = ::cuda::std::rotl(__v[i][__l], 13);
+            __v[i][__l] *= __prime1;
+          }
+        });
+      }
+
+      _CCCL_PRAGMA_UNROLL_FULL()
+      for (size_t __l = 0; __l < _Lanes; ++__l)
+      {
+        __h32[__l] = ::cuda::std::rotl(__v[0][__l], 1) + ::cuda::std::rotl(__v[1][__l], 7)
+                   + ::cuda::std::rotl(__v[2][__l], 12) + ::cuda::std::rotl(__v[3][__l], 18);
+      }
+    }
+    else
+    {
+      _CCCL_PRAGMA_UNROLL_FULL()
+      for (size_t __l = 0; __l < _Lanes; ++__l)
+      {
+        __h32[__l] = __seed_ + __prime5;
+      }
+    }
+
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (size_t __l = 0; __l < _Lanes; ++__l)
+    {
+      __h32[__l] += ::cuda::std::uint32_t{sizeof(_Holder)};
+    }
+
+    // remaining data can be processed in 4-byte chunks
+    if constexpr (_Holder::__num_blocks > _Holder::__num_chunks * 4)
+    {
+      for (size_t __offset = _Holder::__num_chunks * 4; __offset < _Holder::__num_blocks; ++__offset)
+      {
+        _CCCL_PRAGMA_UNROLL_FULL()
+        for (size_t __l = 0; __l < _Lanes; ++__l)
+        {
+          __h32[__l] += __holders[__l].__blocks[__offset] * __prime3;
+          __h32[__l] = ::cuda::std::rotl(__h32[__l], 17) * __prime4;
+        }
+      }
+    }
+
+    // the following loop is only needed if the size of the key is not a multiple of the block size
+    if constexpr (_Holder::__tail_size > 0)
+    {
+      for (::cuda::std::uint32_t __i = 0; __i < _Holder::__tail_size; ++__i)
+      {
+        _CCCL_PRAGMA_UNROLL_FULL()
+        for (size_t __l = 0; __l < _Lanes; ++__l)
+        {
+          __h32[__l] += (static_cast<::cuda::std::uint32_t>(__holders[__l].__bytes[__i])) * __prime5;
+          __h32[__l] = ::cuda::std::rotl(__h32[__l], 11) * __prime1;
+        }
+      }
+    }
+
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (size_t __l = 0; __l < _Lanes; ++__l)
+    {
+      __out[__l] = __finalize(__h32[__l]);
+    }
+  }
+
   //! @brief Returns a hash value for its argument, as a value of type `::cuda::std::uint32_t`.
   //!
   //! @tparam _Extent The extent type
@@ -310,7 +428,159 @@ public:
     return __compute_hash_span(__keys);
   }
 
+  //! @brief Hashes every key of `__keys` into the corresponding element of `__out`. The results are identical to
+  //! hashing the keys one by one, but several keys are hashed at a time in lanes.
+  //!
+  //! @param __keys The keys to hash
+  //! @param __out The resulting hash values, which must hold at least `__keys.size()` elements
+  _CCCL_API void
+  hash_bulk(::cuda::std::span<const _Key> __keys, ::cuda::std::span<::cuda::std::uint64_t> __out) const noexcept
+  {
+    auto __hash_lanes = [this](auto __lanes, const _Key* __first, ::cuda::std::uint64_t* __result) {
+      __compute_hash_lanes<decltype(__lanes)::value>(__first, __result);
+    };
+    auto __hash_one = [this](const _Key& __key) {
+      return (*this)(__key);
+    };
+    ::cuda::experimental::cuco::__hash_bulk<8, 4>(__keys, __out, __hash_lanes, __hash_one);
+  }
+
 private:
+  //! @brief Hashes `_Lanes` keys at a time. Every statement of `__compute_hash_span` is applied to all lanes before
+  //! the next one, so that the compiler can map the lanes onto vector registers. As all keys have the same size, the
+  //! offsets are shared by the lanes.
+  //!
+  //! @tparam _Lanes The number of keys
+  //! @param __keys The keys to hash
+  //! @param __out The resulting hash values
+  template <size_t _Lanes>
+  _CCCL_API void __compute_hash_lanes(const _Key* __keys, ::cuda::std::uint64_t* __out) const noexcept
+  {
+    constexpr size_t __size = sizeof(_Key);
+    const auto __bytes      = reinterpret_cast<const ::cuda::std::byte*>(__keys);
+
+    size_t __offset = 0;
+    ::cuda::std::uint64_t __h64[_Lanes];
+
+    // process data in 32-byte chunks
+    if constexpr (__size >= 32)
+    {
+      ::cuda::std::uint64_t __v[4][_Lanes];
+      _CCCL_PRAGMA_UNROLL_FULL()
+      for (size_t __l = 0; __l < _Lanes; ++__l)
+      {
+        __v[0][__l] = __seed_ + __prime1 + __prime2;
+        __v[1][__l] = __seed_ + __prime2;
+        __v[2][__l] = __seed_;
+        __v[3][__l] = __seed_ - __prime1;
+      }
+
+      for (; __offset <= __size - 32; __offset += 32)
+      {
+        // pipeline 4*8byte computations
+        ::cuda::static_for<4>([&](auto i) {
+          _CCCL_PRAGMA_UNROLL_FULL()
+          for (size_t __l = 0; __l < _Lanes; ++__l)
+          {
+            __v[i][__l] += ::cuda::experimental::cuco::__load_unaligned<::cuda::std::uint64_t>(
+                             __bytes + __l * __size + __offset + 8 * i)
+                         * __prime2;
+            __v[i][__l] = ::cuda::std::rotl(__v[i][__l], 31);
+            __v[i][__l] *= __prime1;
+          }
+        });
+      }
+
+      _CCCL_PRAGMA_UNROLL_FULL()
+      for (size_t __l = 0; __l < _Lanes; ++__l)
+      {
+        __h64[__l] = ::cuda::std::rotl(__v[0][__l], 1) + ::cuda::std::rotl(__v[1][__l], 7)
+                   + ::cuda::std::rotl(__v[2][__l], 12) + ::cuda::std::rotl(__v[3][__l], 18);
+      }
+
+      ::cuda::static_for<4>([&](auto i) {
+        _CCCL_PRAGMA_UNROLL_FULL()
+        for (size_t __l = 0; __l < _Lanes; ++__l)
+        {
+          __v[i][__l] *= __prime2;
+          __v[i][__l] = ::cuda::std::rotl(__v[i][__l], 31);
+          __v[i][__l] *= __prime1;
+          __h64[__l] ^= __v[i][__l];
+          __h64[__l] = __h64[__l] * __prime1 + __prime4;
+        }
+      });
+    }
+    else
+    {
+      _CCCL_PRAGMA_UNROLL_FULL()
+      for (size_t __l = 0; __l < _Lanes; ++__l)
+      {
+        __h64[__l] = __seed_ + __prime5;
+      }
+    }
+
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (size_t __l = 0; __l < _Lanes; ++__l)
+    {
+      __h64[__l] += __size;
+    }
+
+    // remaining data can be processed in 8-byte chunks
+    if constexpr ((__size % 32) >= 8)
+    {
+      for (; __offset <= __size - 8; __offset += 8)
+      {
+        _CCCL_PRAGMA_UNROLL_FULL()
+        for (size_t __l = 0; __l < _Lanes; ++__l)
+        {
+          ::cuda::std::uint64_t __k1 =
+            ::cuda::experimental::cuco::__load_unaligned<::cuda::std::uint64_t>(__bytes + __l * __size + __offset)
+            * __prime2;
+          __k1 = ::cuda::std::rotl(__k1, 31) * __prime1;
+          __h64[__l] ^= __k1;
+          __h64[__l] = ::cuda::std::rotl(__h64[__l], 27) * __prime1 + __prime4;
+        }
+      }
+    }
+
+    // remaining data can be processed in 4-byte chunks
+    if constexpr ((__size % 8) >= 4)
+    {
+      for (; __offset <= __size - 4; __offset += 4)
+      {
+        _CCCL_PRAGMA_UNROLL_FULL()
+        for (size_t __l = 0; __l < _Lanes; ++__l)
+        {
+          __h64[__l] ^=
+            ::cuda::experimental::cuco::__load_unaligned<::cuda::std::uint32_t>(__bytes + __l * __size + __offset)
+            * __prime1;
+          __h64[__l] = ::cuda::std::rotl(__h64[__l], 23) * __prime2 + __prime3;
+        }
+      }
+    }
+
+    // the following loop is only needed if the size of the key is not a multiple of a previous
+    // block size
+    if constexpr (__size % 4 != 0)
+    {
+      for (; __offset < __size; ++__offset)
+      {
+        _CCCL_PRAGMA_UNROLL_FULL()
+        for (size_t __l = 0; __l < _Lanes; ++__l)
+        {
+          __h64[__l] ^= (::cuda::std::to_integer<::cuda::std::uint32_t>(__bytes[__l * __size + __offset])) * __prime5;
+          __h64[__l] = ::cuda::std::rotl(__h64[__l], 11) * __prime1;
+        }
+      }
+    }
+
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (size_t __l = 0; __l < _Lanes; ++__l)
+    {
+      __out[__l] = __finalize(__h64[__l]);
+    }
+  }
+
   //! @brief Returns a hash value for its argument, as a value of type `::cuda::std::uint64_t`.
   //!
   //! @tparam _Extent The extent type
@@ -0,0 +1,148 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO___HYPERLOGLOG_HOST_CUH
+#define _CUDAX___CUCO___HYPERLOGLOG_HOST_CUH
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__type_traits/void_t.h>
+#include <cuda/std/__utility/declval.h>
+#include <cuda/std/array>
+#include <cuda/std/span>
+
+#include <cuda/experimental/__cuco/__utility/host_threads.cuh>
+
+#include <cuda/std/__cccl/prologue.h>
+
+namespace cuda::experimental::cuco::__hyperloglog_ns
+{
+//! Number of lanes used by the host register loops, chosen so that the compiler can map them onto vector registers.
+inline constexpr int __host_lanes = 8;
+
+//! Minimum number of items a host thread processes, so that the cost of clearing and merging its local sketch is
+//! amortized.
+inline constexpr ::cuda::std::size_t __host_items_per_thread = 1 << 16;
+
+//! Whether `_Hash` hashes a span of `_Tp` into a span of `_Result` with `hash_bulk`, as the cuco hash functions do.
+template <class _Hash, class _Tp, class _Result, class = void>
+inline constexpr bool __has_hash_bulk = false;
+
+template <class _Hash, class _Tp, class _Result>
+inline constexpr bool __has_hash_bulk<
+  _Hash,
+  _Tp,
+  _Result,
+  ::cuda::std::void_t<decltype(::cuda::std::declval<const _Hash&>().hash_bulk(
+    ::cuda::std::declval<::cuda::std::span<const _Tp>>(), ::cuda::std::declval<::cuda::std::span<_Result>>()))>> =
+  true;
+
+//! @brief Returns the table of 2^-r for every register value r.
+//!
+//! @note Register values are at most 65 - precision, so 64 entries cover every precision.
+[[nodiscard]] _CCCL_HOST_API constexpr ::cuda::std::array<double, 64> __make_inverse_powers_of_two() noexcept
+{
+  ::cuda::std::array<double, 64> __table{};
+  double __value = 1.0;
+  for (auto& __entry : __table)
+  {
+    __entry = __value;
+    __value *= 0.5;
+  }
+  return __table;
+}
+
+inline constexpr ::cuda::std::array<double, 64> __inverse_powers_of_two = __make_inverse_powers_of_two();
+
+//! @brief Intermediate result of the estimate that is passed to the `_Finalizer`.
+struct __register_sum
+{
+  double __sum; ///< Sum of 2^-r over all registers
+  int __zeroes; ///< Number of registers that are 0
+};
+
+//! @brief Computes the sum of 2^-r over the registers and counts the registers that are 0.
+//!
+//! @param __registers Pointer to the host accessible registers
+//! @param __n Number of registers
+//!
+//! @return The sum and the number of zero registers
+[[nodiscard]] _CCCL_HOST_API inline __register_sum
+__harmonic_sum(const int* __registers, ::cuda::std::size_t __n) noexcept
+{
+  double __sums[__host_lanes] = {};
+  int __zeroes[__host_lanes]  = {};
+
+  ::cuda::std::size_t __i = 0;
+  for (; __i + __host_lanes <= __n; __i += __host_lanes)
+  {
+    for (int __lane = 0; __lane < __host_lanes; ++__lane)
+    {
+      const auto __reg = __registers[__i + __lane];
+      __sums[__lane] += __inverse_powers_of_two[__reg];
+      __zeroes[__lane] += __reg == 0;
+    }
+  }
+  for (; __i < __n; ++__i)
+  {
+    __sums[0] += __inverse_powers_of_two[__registers[__i]];
+    __zeroes[0] += __registers[__i] == 0;
+  }
+
+  __register_sum __result{0.0, 0};
+  for (int __lane = 0; __lane < __host_lanes; ++__lane)
+  {
+    __result.__sum += __sums[__lane];
+    __result.__zeroes += __zeroes[__lane];
+  }
+  return __result;
+}
+
+//! @brief Sets every register of `__dst` to the maximum of itself and the corresponding register of `__src`.
+//!
+//! @param __dst Pointer to the host accessible registers that are updated
+//! @param __src Pointer to the host accessible registers that are merged into `__dst`
+//! @param __n Number of registers
+_CCCL_HOST_API inline void __max_registers(int* __dst, const int* __src, ::cuda::std::size_t __n) noexcept
+{
+  for (::cuda::std::size_t __i = 0; __i < __n; ++__i)
+  {
+    __dst[__i] = ::cuda::std::max(__dst[__i], __src[__i]);
+  }
+}
+
+//! @brief Returns the number of host threads used to add `__num_items` items to a sketch of `__num_registers`
+//! registers.
+//!
+//! @param __num_items Number of items to add
+//! @param __num_registers Number of registers of the sketch
+//! @param __max_threads Upper bound of the number of threads, or 0 for the number of hardware threads
+[[nodiscard]] _CCCL_HOST_API inline unsigned
+__host_thread_count(::cuda::std::size_t __num_items, ::cuda::std::size_t __num_registers, unsigned __max_threads)
+{
+  // Every additional thread clears and merges a sketch of its own
+  const auto __min_items = ::cuda::std::max(__host_items_per_thread, 4 * __num_registers);
+  return ::cuda::experimental::cuco::__host_thread_count(__num_items, __min_items, __max_threads);
+}
+} // namespace cuda::experimental::cuco::__hyperloglog_ns
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO___HYPERLOGLOG_HOST_CUH
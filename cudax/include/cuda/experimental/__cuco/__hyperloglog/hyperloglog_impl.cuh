@@ -21,6 +21,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/__cmath/ceil_div.h>
 #include <cuda/__container/buffer.h>
 #include <cuda/__memory/is_aligned.h>
 #include <cuda/__memory_resource/legacy_pinned_memory_resource.h>
@@ -29,22 +30,29 @@
 #include <cuda/__utility/in_range.h>
 #include <cuda/atomic>
 #include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__bit/countr.h>
 #include <cuda/std/__bit/integral.h>
 #include <cuda/std/__cstddef/types.h>
 #include <cuda/std/__host_stdlib/stdexcept>
 #include <cuda/std/__iterator/concepts.h>
+#include <cuda/std/__iterator/distance.h>
 #include <cuda/std/__memory/addressof.h>
 #include <cuda/std/__memory/pointer_traits.h>
+#include <cuda/std/__type_traits/is_default_constructible.h>
+#include <cuda/std/__type_traits/is_same.h>
 #include <cuda/std/__utility/declval.h>
 #include <cuda/std/span>
 
 #include <cuda/experimental/__cuco/__hyperloglog/finalizer.cuh>
+#include <cuda/experimental/__cuco/__hyperloglog/host.cuh>
 #include <cuda/experimental/__cuco/__hyperloglog/kernels.cuh>
 #include <cuda/experimental/__cuco/__utility/strong_type.cuh>
 #include <cuda/experimental/__cuco/hash_functions.cuh>
 #include <cuda/experimental/memory_resource.cuh>
 
+#include <vector>
+
 #include <cooperative_groups.h>
 
 #include <cooperative_groups/reduce.h>
@@ -461,23 +469,110 @@ public:
       __host_sketch_buf.data(), __sketch.data(), sizeof(__register_type) * __num_regs, __stream.get());
     __stream.sync();
 
-    __fp_type __sum = 0;
-    int __zeroes    = 0;
-
     // geometric mean computation + count registers with 0s
-    for (const auto __reg : __host_sketch_buf)
-    {
-      __sum += __fp_type{1} / static_cast<__fp_type>(1ull << __reg);
-      __zeroes += __reg == 0;
-    }
+    const auto __result =
+      ::cuda::experimental::cuco::__hyperloglog_ns::__harmonic_sum(__host_sketch_buf.data(), __num_regs);
 
     const auto __finalize = ::cuda::experimental::cuco::__hyperloglog_ns::_Finalizer(__precision);
 
     // pass intermediate result to _Finalizer for bias correction, etc.
-    return __finalize(__sum, __zeroes);
+    return __finalize(__result.__sum, __result.__zeroes);
+  }
+
+  //! @brief Resets the estimator on the host, i.e., clears the current count estimate.
+  //!
+  //! @note The sketch storage must be host accessible.
+  _CCCL_HOST void __clear_host() noexcept
+  {
+    for (auto& __reg : __sketch)
+    {
+      __reg = 0;
+    }
   }
 
-  // #endif
+  //! @brief Adds to be counted items to the estimator on the host.
+  //!
+  //! Large inputs are split among host threads. Every thread but the calling one counts its part in a sketch of its
+  //! own, which is merged into `*this` once all threads are done.
+  //!
+  //! @note The sketch storage must be host accessible. No other operation may access the sketch concurrently.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator where
+  //! <tt>std::is_convertible<std::iterator_traits<_InputIt>::value_type,
+  //! _Tp></tt> is `true`
+  //!
+  //! @param __first Beginning of the sequence of items
+  //! @param __last End of the sequence of items
+  //! @param __max_threads Upper bound of the number of host threads, or 0 for the number of hardware threads
+  template <class _InputIt>
+  _CCCL_HOST void __add_host(_InputIt __first, _InputIt __last, unsigned __max_threads)
+  {
+    const auto __num_items = static_cast<::cuda::std::size_t>(::cuda::std::distance(__first, __last));
+    if (__num_items == 0)
+    {
+      return;
+    }
+
+    const auto __num_regs    = __sketch.size();
+    const auto __num_threads = ::cuda::experimental::cuco::__hyperloglog_ns::__host_thread_count(
+      __num_items, __num_regs, __max_threads);
+    if (__num_threads <= 1)
+    {
+      __add_host_range(__first, __num_items, __sketch.data());
+      return;
+    }
+
+    ::std::vector<__register_type> __local_sketches((__num_threads - 1) * __num_regs, 0);
+    const auto __items_per_thread = ::cuda::ceil_div(__num_items, ::cuda::std::size_t{__num_threads});
+
+    auto __add_part = [&](unsigned __t) {
+      const auto __begin = ::cuda::std::min(__t * __items_per_thread, __num_items);
+      const auto __count = ::cuda::std::min(__items_per_thread, __num_items - __begin);
+      auto* __registers  = __t == 0 ? __sketch.data() : __local_sketches.data() + (__t - 1) * __num_regs;
+      __add_host_range(__first + __begin, __count, __registers);
+    };
+    ::cuda::experimental::cuco::__run_on_host_threads(__num_threads, __add_part);
+
+    for (unsigned __t = 1; __t < __num_threads; ++__t)
+    {
+      ::cuda::experimental::cuco::__hyperloglog_ns::__max_registers(
+        __sketch.data(), __local_sketches.data() + (__t - 1) * __num_regs, __num_regs);
+    }
+  }
+
+  //! @brief Merges the result of `other` estimator into `*this` estimator on the host.
+  //!
+  //! @note The sketch storage of both estimators must be host accessible.
+  //!
+  //! @throw If __sketch_bytes() != __other.__sketch_bytes()
+  //!
+  //! @tparam _OtherScope Thread scope of `other` estimator
+  //!
+  //! @param __other Other estimator to be merged into `*this`
+  template <::cuda::thread_scope _OtherScope>
+  _CCCL_HOST void __merge_host(const __hyperloglog_impl<_Tp, _OtherScope, _Hash>& __other)
+  {
+    if (__other.__precision != __precision)
+    {
+      _CCCL_THROW(::std::invalid_argument, "Cannot merge estimators with different sketch sizes");
+    }
+
+    ::cuda::experimental::cuco::__hyperloglog_ns::__max_registers(
+      __sketch.data(), __other.__sketch.data(), __sketch.size());
+  }
+
+  //! @brief Compute the estimated distinct items count on the host.
+  //!
+  //! @note The sketch storage must be host accessible.
+  //!
+  //! @return Approximate distinct items count
+  [[nodiscard]] _CCCL_HOST ::cuda::std::size_t __estimate_host() const noexcept
+  {
+    const auto __result =
+      ::cuda::experimental::cuco::__hyperloglog_ns::__harmonic_sum(__sketch.data(), __sketch.size());
+    const auto __finalize = ::cuda::experimental::cuco::__hyperloglog_ns::_Finalizer(__precision);
+    return __finalize(__result.__sum, __result.__zeroes);
+  }
 
   //! @brief Gets the hash function.
   //!
@@ -580,6 +675,58 @@ private:
     __register_ref.fetch_max(__value, ::cuda::memory_order_relaxed);
   }
 
+  //! @brief Adds `__n` items starting at `__first` to the registers at `__registers` on the host.
+  //!
+  //! The items are hashed in batches before the registers are updated. If the hash function provides `hash_bulk`, a
+  //! batch is hashed by it, in place if the items are contiguous and otherwise after copying them, so that the hash
+  //! computations of a batch can be vectorized. Otherwise the items are hashed one by one, which still lets the
+  //! independent hash computations of a batch overlap.
+  template <class _InputIt>
+  _CCCL_HOST void __add_host_range(_InputIt __first, ::cuda::std::size_t __n, __register_type* __registers) const
+  {
+    constexpr ::cuda::std::size_t __batch_size = 64;
+    constexpr bool __has_hash_bulk =
+      ::cuda::experimental::cuco::__hyperloglog_ns::__has_hash_bulk<_Hash, _Tp, __hash_value_type>;
+    constexpr bool __hash_in_place = __has_hash_bulk && ::cuda::std::contiguous_iterator<_InputIt>
+                                  && ::cuda::std::is_same_v<::cuda::std::iter_value_t<_InputIt>, _Tp>;
+    constexpr bool __hash_copies = __has_hash_bulk && !__hash_in_place && ::cuda::std::is_default_constructible_v<_Tp>;
+    __hash_value_type __hashes[__batch_size];
+
+    for (::cuda::std::size_t __i = 0; __i < __n; __i += __batch_size)
+    {
+      const auto __count = ::cuda::std::min(__batch_size, __n - __i);
+      if constexpr (__hash_in_place)
+      {
+        __hash.hash_bulk(::cuda::std::span<const _Tp>(::cuda::std::to_address(__first) + __i, __count),
+                         ::cuda::std::span<__hash_value_type>(__hashes, __count));
+      }
+      else if constexpr (__hash_copies)
+      {
+        _Tp __items[__batch_size];
+        for (::cuda::std::size_t __j = 0; __j < __count; ++__j)
+        {
+          __items[__j] = static_cast<_Tp>(__first[__i + __j]);
+        }
+        __hash.hash_bulk(::cuda::std::span<const _Tp>(__items, __count),
+                         ::cuda::std::span<__hash_value_type>(__hashes, __count));
+      }
+      else
+      {
+        for (::cuda::std::size_t __j = 0; __j < __count; ++__j)
+        {
+          __hashes[__j] = __hash(static_cast<_Tp>(__first[__i + __j]));
+        }
+      }
+      for (::cuda::std::size_t __j = 0; __j < __count; ++__j)
+      {
+        const auto __h      = __hashes[__j];
+        const auto __reg    = __h & __register_mask();
+        const auto __zeroes = ::cuda::std::countl_zero(__h | __register_mask()) + 1;
+        __registers[__reg]  = ::cuda::std::max(__registers[__reg], static_cast<__register_type>(__zeroes));
+      }
+    }
+  }
+
   //! @brief Try expanding the shmem partition for a given kernel beyond 48KB if necessary.
   //!
   //! @tparam _Kernel Type of kernel function
@@ -0,0 +1,240 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO___OPEN_ADDRESSING_KERNELS_CUH
+#define _CUDAX___CUCO___OPEN_ADDRESSING_KERNELS_CUH
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/atomic>
+#include <cuda/std/__bit/popcount.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/cstdint>
+
+#include <cooperative_groups.h>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_DIAG_PUSH
+_CCCL_DIAG_SUPPRESS_GCC("-Wattributes")
+
+namespace cuda::experimental::cuco::__open_addressing_ns
+{
+//! Number of threads per block of the bulk operation kernels
+inline constexpr int __block_size = 128;
+
+//! @brief Returns the global thread ID in a 1D grid
+[[nodiscard]] _CCCL_DEVICE inline ::cuda::std::int64_t __global_thread_id() noexcept
+{
+  return static_cast<::cuda::std::int64_t>(blockDim.x) * blockIdx.x + threadIdx.x;
+}
+
+//! @brief Returns the grid stride of a 1D grid
+[[nodiscard]] _CCCL_DEVICE inline ::cuda::std::int64_t __grid_stride() noexcept
+{
+  return static_cast<::cuda::std::int64_t>(gridDim.x) * blockDim.x;
+}
+
+//! @brief Adds `__value` to the device counter `__counter` unless it is null.
+_CCCL_DEVICE inline void __add_to_counter(::cuda::std::size_t* __counter, ::cuda::std::size_t __value) noexcept
+{
+  if (__counter != nullptr && __value != 0)
+  {
+    ::cuda::atomic_ref<::cuda::std::size_t, ::cuda::thread_scope_device>{*__counter}.fetch_add(
+      __value, ::cuda::std::memory_order_relaxed);
+  }
+}
+
+template <class _Slot>
+CCCL_DETAIL_KERNEL_ATTRIBUTES void __initialize(_Slot* __slots, ::cuda::std::int64_t __n, _Slot __empty_slot)
+{
+  for (auto __idx = __global_thread_id(); __idx < __n; __idx += __grid_stride())
+  {
+    __slots[__idx] = __empty_slot;
+  }
+}
+
+template <int _CGSize, class _InputIt, class _RefType>
+CCCL_DETAIL_KERNEL_ATTRIBUTES void
+__insert(_InputIt __first, ::cuda::std::int64_t __n, ::cuda::std::size_t* __num_inserted, _RefType __ref)
+{
+  using __value_type = typename _RefType::__value_type;
+
+  ::cuda::std::size_t __local = 0;
+  if constexpr (_CGSize == 1)
+  {
+    for (auto __idx = __global_thread_id(); __idx < __n; __idx += __grid_stride())
+    {
+      __local += __ref.__insert(static_cast<__value_type>(*(__first + __idx)));
+    }
+  }
+  else
+  {
+    const auto __tile = ::cooperative_groups::tiled_partition<_CGSize>(::cooperative_groups::this_thread_block());
+    for (auto __idx = __global_thread_id() / _CGSize; __idx < __n; __idx += __grid_stride() / _CGSize)
+    {
+      const bool __inserted = __ref.__insert(__tile, static_cast<__value_type>(*(__first + __idx)));
+      __local += __inserted && __tile.thread_rank() == 0;
+    }
+  }
+  __add_to_counter(__num_inserted, __local);
+}
+
+template <class _InputIt, class _RefType>
+CCCL_DETAIL_KERNEL_ATTRIBUTES void __insert_or_assign(_InputIt __first, ::cuda::std::int64_t __n, _RefType __ref)
+{
+  using __value_type = typename _RefType::__value_type;
+
+  for (auto __idx = __global_thread_id(); __idx < __n; __idx += __grid_stride())
+  {
+    __ref.__insert_or_assign(static_cast<__value_type>(*(__first + __idx)));
+  }
+}
+
+template <int _CGSize, class _InputIt, class _OutputIt, class _RefType>
+CCCL_DETAIL_KERNEL_ATTRIBUTES void
+__contains(_InputIt __first, ::cuda::std::int64_t __n, _OutputIt __output_begin, _RefType __ref)
+{
+  using __key_type = typename _RefType::__key_type;
+
+  if constexpr (_CGSize == 1)
+  {
+    for (auto __idx = __global_thread_id(); __idx < __n; __idx += __grid_stride())
+    {
+      *(__output_begin + __idx) = __ref.__contains(static_cast<__key_type>(*(__first + __idx)));
+    }
+  }
+  else
+  {
+    const auto __tile = ::cooperative_groups::tiled_partition<_CGSize>(::cooperative_groups::this_thread_block());
+    for (auto __idx = __global_thread_id() / _CGSize; __idx < __n; __idx += __grid_stride() / _CGSize)
+    {
+      const bool __found = __ref.__contains(__tile, static_cast<__key_type>(*(__first + __idx)));
+      if (__tile.thread_rank() == 0)
+      {
+        *(__output_begin + __idx) = __found;
+      }
+    }
+  }
+}
+
+//! @brief Returns the stored key (sets) or mapped value (maps) of `__slot`, or the matching sentinel if it is null.
+template <class _RefType, class _Slot>
+[[nodiscard]] _CCCL_DEVICE auto __found_value(const _RefType& __ref, const _Slot* __slot) noexcept
+{
+  if constexpr (_RefType::__has_payload)
+  {
+    return __slot ? __slot->second : __ref.__empty_slot_sentinel().second;
+  }
+  else
+  {
+    return __slot ? *__slot : __ref.__empty_slot_sentinel();
+  }
+}
+
+template <int _CGSize, class _InputIt, class _OutputIt, class _RefType>
+CCCL_DETAIL_KERNEL_ATTRIBUTES void
+__find(_InputIt __first, ::cuda::std::int64_t __n, _OutputIt __output_begin, _RefType __ref)
+{
+  using __key_type = typename _RefType::__key_type;
+
+  if constexpr (_CGSize == 1)
+  {
+    for (auto __idx = __global_thread_id(); __idx < __n; __idx += __grid_stride())
+    {
+      const auto* __slot        = __ref.__find(static_cast<__key_type>(*(__first + __idx)));
+      *(__output_begin + __idx) = __found_value(__ref, __slot);
+    }
+  }
+  else
+  {
+    const auto __tile = ::cooperative_groups::tiled_partition<_CGSize>(::cooperative_groups::this_thread_block());
+    for (auto __idx = __global_thread_id() / _CGSize; __idx < __n; __idx += __grid_stride() / _CGSize)
+    {
+      const auto* __slot = __ref.__find(__tile, static_cast<__key_type>(*(__first + __idx)));
+      if (__tile.thread_rank() == 0)
+      {
+        *(__output_begin + __idx) = __found_value(__ref, __slot);
+      }
+    }
+  }
+}
+
+template <class _RefType>
+CCCL_DETAIL_KERNEL_ATTRIBUTES void __size(::cuda::std::size_t* __num_filled, _RefType __ref)
+{
+  const auto __slots = __ref.__slots();
+  const auto __n     = static_cast<::cuda::std::int64_t>(__slots.size());
+
+  ::cuda::std::size_t __local = 0;
+  for (auto __idx = __global_thread_id(); __idx < __n; __idx += __grid_stride())
+  {
+    __local += !__ref.__is_empty_key(_RefType::__key_of(__slots[__idx]));
+  }
+  __add_to_counter(__num_filled, __local);
+}
+
+//! @brief Writes the content of every filled slot to the outputs, in unspecified order. The warps of the grid reserve
+//! the output positions of their filled slots with a single atomic operation per iteration.
+template <class _KeyOut, class _ValueOut, class _RefType>
+CCCL_DETAIL_KERNEL_ATTRIBUTES void
+__retrieve_all(_KeyOut __keys_out, _ValueOut __values_out, ::cuda::std::size_t* __num_retrieved, _RefType __ref)
+{
+  const auto __slots = __ref.__slots();
+  const auto __n     = static_cast<::cuda::std::int64_t>(__slots.size());
+  const auto __warp  = ::cooperative_groups::tiled_partition<32>(::cooperative_groups::this_thread_block());
+  const auto __lane  = static_cast<int>(__warp.thread_rank());
+
+  // Every thread of a warp runs the same number of iterations, so that the warp stays converged
+  for (auto __base = __global_thread_id() - __lane; __base < __n; __base += __grid_stride())
+  {
+    const auto __idx    = __base + __lane;
+    const bool __filled = __idx < __n && !__ref.__is_empty_key(_RefType::__key_of(__slots[__idx]));
+    const auto __mask   = __warp.ballot(__filled);
+    if (__mask == 0)
+    {
+      continue;
+    }
+
+    ::cuda::std::size_t __offset = 0;
+    if (__lane == 0)
+    {
+      __offset = ::cuda::atomic_ref<::cuda::std::size_t, ::cuda::thread_scope_device>{*__num_retrieved}.fetch_add(
+        ::cuda::std::popcount(__mask), ::cuda::std::memory_order_relaxed);
+    }
+    __offset = __warp.shfl(__offset, 0);
+
+    if (__filled)
+    {
+      const auto __out      = __offset + ::cuda::std::popcount(__mask & ((1u << __lane) - 1u));
+      const auto& __slot    = __slots[__idx];
+      *(__keys_out + __out) = _RefType::__key_of(__slot);
+      if constexpr (_RefType::__has_payload)
+      {
+        *(__values_out + __out) = __slot.second;
+      }
+    }
+  }
+}
+} // namespace cuda::experimental::cuco::__open_addressing_ns
+
+_CCCL_DIAG_POP
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO___OPEN_ADDRESSING_KERNELS_CUH
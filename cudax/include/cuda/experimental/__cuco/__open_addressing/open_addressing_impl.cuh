@@ -0,0 +1,235 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO___OPEN_ADDRESSING_OPEN_ADDRESSING_IMPL_CUH
+#define _CUDAX___CUCO___OPEN_ADDRESSING_OPEN_ADDRESSING_IMPL_CUH
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/__container/buffer.h>
+#include <cuda/__driver/driver_api.h>
+#include <cuda/__stream/stream_ref.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__utility/forward.h>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+
+#include <cuda/experimental/__cuco/__open_addressing/kernels.cuh>
+#include <cuda/experimental/__cuco/__open_addressing/open_addressing_ref_impl.cuh>
+#include <cuda/experimental/memory_resource.cuh>
+
+#include <cuda/std/__cccl/prologue.h>
+
+namespace cuda::experimental::cuco
+{
+//! @brief Owning storage and stream ordered bulk operations shared by `static_set` and `static_map`.
+//!
+//! @tparam _RefImpl Type of the `__open_addressing_ref_impl` that operates on the storage
+template <class _RefImpl>
+class __open_addressing_impl
+{
+public:
+  using __ref_impl_type = _RefImpl; ///< Type of the implementation object of the refs
+  using __value_type    = typename _RefImpl::__value_type; ///< Slot type
+  using __size_type     = typename _RefImpl::__size_type; ///< Size type
+
+private:
+  ::cuda::device_buffer<__value_type> __slot_buffer; ///< Storage for slots
+  _RefImpl __ref_impl; ///< Implementation object operating on `__slot_buffer`
+
+  //! Upper bound of the number of blocks of the bulk operation kernels, which use grid stride loops
+  static constexpr ::cuda::std::int64_t __max_grid_size = 1 << 16;
+
+  //! @brief Returns the number of blocks used to process `__n` items with groups of `__cg_size` threads.
+  [[nodiscard]] static int __grid_size(::cuda::std::int64_t __n, int __cg_size) noexcept
+  {
+    return static_cast<int>(::cuda::std::min(
+      ::cuda::ceil_div(__n * __cg_size, ::cuda::std::int64_t{__open_addressing_ns::__block_size}), __max_grid_size));
+  }
+
+  //! @brief Allocates a device counter that is set to zero in stream order.
+  [[nodiscard]] ::cuda::device_buffer<__size_type> __make_counter(::cuda::stream_ref __stream) const
+  {
+    ::cuda::device_buffer<__size_type> __counter{__stream, __slot_buffer.memory_resource(), 1, ::cuda::no_init};
+    ::cuda::__driver::__memsetAsync(__counter.data(), ::cuda::std::uint8_t{0}, sizeof(__size_type), __stream.get());
+    return __counter;
+  }
+
+  //! @brief Copies the value of a device counter to the host.
+  //!
+  //! @note This function synchronizes the given stream.
+  [[nodiscard]] static __size_type
+  __read_counter(const ::cuda::device_buffer<__size_type>& __counter, ::cuda::stream_ref __stream)
+  {
+    __size_type __value = 0;
+    ::cuda::__driver::__memcpyAsync(&__value, __counter.data(), sizeof(__size_type), __stream.get());
+    __stream.sync();
+    return __value;
+  }
+
+public:
+  //! @brief Allocates the slots for at least `__capacity` keys and initializes them in stream order.
+  //!
+  //! @param __memory_resource A memory resource used for allocating device storage
+  //! @param __capacity Requested capacity
+  //! @param __empty_slot Value of an empty slot
+  //! @param __predicate Key equality
+  //! @param __probing_scheme Probing scheme
+  //! @param __stream CUDA stream used to initialize the storage
+  template <class _MemoryResource>
+  __open_addressing_impl(_MemoryResource&& __memory_resource,
+                         __size_type __capacity,
+                         const __value_type& __empty_slot,
+                         const typename _RefImpl::__key_equal& __predicate,
+                         const typename _RefImpl::__probing_scheme_type& __probing_scheme,
+                         ::cuda::stream_ref __stream)
+      : __slot_buffer{__stream,
+                      ::cuda::std::forward<_MemoryResource>(__memory_resource),
+                      _RefImpl::__storage_size(__capacity),
+                      ::cuda::no_init}
+      , __ref_impl{
+          ::cuda::std::span{__slot_buffer.data(), __slot_buffer.size()}, __empty_slot, __predicate, __probing_scheme}
+  {
+    __clear_async(__stream);
+  }
+
+  //! @brief Gets the implementation object of the refs.
+  [[nodiscard]] const _RefImpl& __ref() const noexcept
+  {
+    return __ref_impl;
+  }
+
+  //! @brief Asynchronously fills the storage with empty slots.
+  void __clear_async(::cuda::stream_ref __stream)
+  {
+    const auto __n = static_cast<::cuda::std::int64_t>(__slot_buffer.size());
+    __open_addressing_ns::__initialize<<<__grid_size(__n, 1), __open_addressing_ns::__block_size, 0, __stream.get()>>>(
+      __slot_buffer.data(), __n, __ref_impl.__empty_slot_sentinel());
+  }
+
+  //! @brief Asynchronously inserts values.
+  //!
+  //! @param __num_inserted Device counter the number of inserted values is added to, or `nullptr`
+  template <class _InputIt>
+  void __insert_async(_InputIt __first, _InputIt __last, __size_type* __num_inserted, ::cuda::stream_ref __stream)
+  {
+    const auto __n = static_cast<::cuda::std::int64_t>(::cuda::std::distance(__first, __last));
+    if (__n == 0)
+    {
+      return;
+    }
+    constexpr int __cg_size = _RefImpl::__cg_size;
+    __open_addressing_ns::__insert<__cg_size>
+      <<<__grid_size(__n, __cg_size), __open_addressing_ns::__block_size, 0, __stream.get()>>>(
+        __first, __n, __num_inserted, __ref_impl);
+  }
+
+  //! @brief Inserts values and returns the number of inserted values.
+  //!
+  //! @note This function synchronizes the given stream.
+  template <class _InputIt>
+  [[nodiscard]] __size_type __insert(_InputIt __first, _InputIt __last, ::cuda::stream_ref __stream)
+  {
+    auto __counter = __make_counter(__stream);
+    __insert_async(__first, __last, __counter.data(), __stream);
+    return __read_counter(__counter, __stream);
+  }
+
+  //! @brief Asynchronously inserts key/value pairs or assigns the values to the present equal keys.
+  template <class _InputIt>
+  void __insert_or_assign_async(_InputIt __first, _InputIt __last, ::cuda::stream_ref __stream)
+  {
+    const auto __n = static_cast<::cuda::std::int64_t>(::cuda::std::distance(__first, __last));
+    if (__n == 0)
+    {
+      return;
+    }
+    __open_addressing_ns::__insert_or_assign<<<__grid_size(__n, 1),
+                                               __open_addressing_ns::__block_size,
+                                               0,
+                                               __stream.get()>>>(__first, __n, __ref_impl);
+  }
+
+  //! @brief Asynchronously writes whether each key of [`__first`, `__last`) is present to `__output_begin`.
+  template <class _InputIt, class _OutputIt>
+  void __contains_async(_InputIt __first, _InputIt __last, _OutputIt __output_begin, ::cuda::stream_ref __stream) const
+  {
+    const auto __n = static_cast<::cuda::std::int64_t>(::cuda::std::distance(__first, __last));
+    if (__n == 0)
+    {
+      return;
+    }
+    constexpr int __cg_size = _RefImpl::__cg_size;
+    __open_addressing_ns::__contains<__cg_size>
+      <<<__grid_size(__n, __cg_size), __open_addressing_ns::__block_size, 0, __stream.get()>>>(
+        __first, __n, __output_begin, __ref_impl);
+  }
+
+  //! @brief Asynchronously writes the stored key (sets) or mapped value (maps) of each key of [`__first`, `__last`),
+  //! or the matching sentinel, to `__output_begin`.
+  template <class _InputIt, class _OutputIt>
+  void __find_async(_InputIt __first, _InputIt __last, _OutputIt __output_begin, ::cuda::stream_ref __stream) const
+  {
+    const auto __n = static_cast<::cuda::std::int64_t>(::cuda::std::distance(__first, __last));
+    if (__n == 0)
+    {
+      return;
+    }
+    constexpr int __cg_size = _RefImpl::__cg_size;
+    __open_addressing_ns::__find<__cg_size>
+      <<<__grid_size(__n, __cg_size), __open_addressing_ns::__block_size, 0, __stream.get()>>>(
+        __first, __n, __output_begin, __ref_impl);
+  }
+
+  //! @brief Writes the content of every filled slot to the outputs, in unspecified order, and returns the number of
+  //! written slots.
+  //!
+  //! @note This function synchronizes the given stream.
+  template <class _KeyOut, class _ValueOut>
+  [[nodiscard]] __size_type
+  __retrieve_all(_KeyOut __keys_out, _ValueOut __values_out, ::cuda::stream_ref __stream) const
+  {
+    auto __counter = __make_counter(__stream);
+    const auto __n = static_cast<::cuda::std::int64_t>(__slot_buffer.size());
+    __open_addressing_ns::__retrieve_all<<<__grid_size(__n, 1),
+                                           __open_addressing_ns::__block_size,
+                                           0,
+                                           __stream.get()>>>(__keys_out, __values_out, __counter.data(), __ref_impl);
+    return __read_counter(__counter, __stream);
+  }
+
+  //! @brief Returns the number of filled slots.
+  //!
+  //! @note This function synchronizes the given stream.
+  [[nodiscard]] __size_type __size(::cuda::stream_ref __stream) const
+  {
+    auto __counter = __make_counter(__stream);
+    const auto __n = static_cast<::cuda::std::int64_t>(__slot_buffer.size());
+    __open_addressing_ns::__size<<<__grid_size(__n, 1), __open_addressing_ns::__block_size, 0, __stream.get()>>>(
+      __counter.data(), __ref_impl);
+    return __read_counter(__counter, __stream);
+  }
+};
+} // namespace cuda::experimental::cuco
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO___OPEN_ADDRESSING_OPEN_ADDRESSING_IMPL_CUH
@@ -0,0 +1,797 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO___OPEN_ADDRESSING_OPEN_ADDRESSING_REF_IMPL_CUH
+#define _CUDAX___CUCO___OPEN_ADDRESSING_OPEN_ADDRESSING_REF_IMPL_CUH
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/atomic>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__bit/bit_cast.h>
+#include <cuda/std/__bit/countr.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__host_stdlib/stdexcept>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__type_traits/is_trivially_copyable.h>
+#include <cuda/std/__type_traits/is_void.h>
+#include <cuda/std/__utility/pair.h>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+
+#include <cuda/experimental/__cuco/__utility/host_threads.cuh>
+#include <cuda/experimental/__cuco/sentinel.cuh>
+
+#include <atomic>
+#include <vector>
+
+#include <cuda/std/__cccl/prologue.h>
+
+namespace cuda::experimental::cuco
+{
+namespace __open_addressing_ns
+{
+//! Minimum number of items a host thread processes in the bulk operations, so that the cost of starting the thread
+//! is amortized.
+inline constexpr ::cuda::std::size_t __host_items_per_thread = 1 << 14;
+
+//! @brief Returns whether `__n` is a prime number.
+[[nodiscard]] _CCCL_API constexpr bool __is_prime(::cuda::std::size_t __n) noexcept
+{
+  if (__n < 4)
+  {
+    return __n >= 2;
+  }
+  if (__n % 2 == 0 || __n % 3 == 0)
+  {
+    return false;
+  }
+  for (::cuda::std::size_t __i = 5; __i <= __n / __i; __i += 6)
+  {
+    if (__n % __i == 0 || __n % (__i + 2) == 0)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//! @brief Returns the smallest prime number that is not less than `__n`.
+[[nodiscard]] _CCCL_API constexpr ::cuda::std::size_t __next_prime(::cuda::std::size_t __n) noexcept
+{
+  while (!__is_prime(__n))
+  {
+    ++__n;
+  }
+  return __n;
+}
+
+//! @brief Unsigned integer type of `_Size` bytes, used to compare slots against the sentinels bitwise.
+template <::cuda::std::size_t _Size>
+using __bits_t = ::cuda::std::conditional_t<
+  _Size == 1,
+  ::cuda::std::uint8_t,
+  ::cuda::std::conditional_t<_Size == 2,
+                             ::cuda::std::uint16_t,
+                             ::cuda::std::conditional_t<_Size == 4, ::cuda::std::uint32_t, ::cuda::std::uint64_t>>>;
+
+//! @brief Returns whether `__lhs` and `__rhs` have the same object representation.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr bool __bitwise_equal(const _Tp& __lhs, const _Tp& __rhs) noexcept
+{
+  using __bits = __bits_t<sizeof(_Tp)>;
+  return ::cuda::std::bit_cast<__bits>(__lhs) == ::cuda::std::bit_cast<__bits>(__rhs);
+}
+
+//! @brief Whether slots of type `_Tp` can be updated through `::cuda::atomic_ref`. `void` stands for the absent
+//! payload of sets.
+template <class _Tp>
+inline constexpr bool __is_atomic_compatible_v =
+  ::cuda::std::is_trivially_copyable_v<_Tp>
+  && (sizeof(_Tp) == 1 || sizeof(_Tp) == 2 || sizeof(_Tp) == 4 || sizeof(_Tp) == 8);
+
+template <>
+inline constexpr bool __is_atomic_compatible_v<void> = true;
+
+//! @brief Slot type of an open addressing container: the key for sets and the key/value pair for maps.
+template <class _Key, class _Tp>
+struct __slot
+{
+  using type = ::cuda::std::pair<_Key, _Tp>;
+};
+
+template <class _Key>
+struct __slot<_Key, void>
+{
+  using type = _Key;
+};
+
+//! @brief Outcome of an attempt to claim an empty slot.
+enum class __insert_result : int
+{
+  __continue, ///< Another key claimed the slot first, probing continues
+  __success, ///< The slot was claimed
+  __duplicate ///< An equal key claimed the slot first
+};
+} // namespace __open_addressing_ns
+
+//! @brief Common implementation of the open addressing containers `static_set` and `static_map`.
+//!
+//! The storage is a flat array of slots. It is probed in windows of `cg_size * _BucketSize` consecutive slots, whose
+//! sequence is given by the probing scheme. Empty slots hold the empty key sentinel. A key is inserted by claiming an
+//! empty slot with a compare-and-swap through `::cuda::atomic_ref`, so the same storage can be operated on by host
+//! threads and device threads. Map payloads are written after their key and read once they differ from the empty
+//! value sentinel.
+//!
+//! @tparam _Key Type of the keys
+//! @tparam _Tp Type of the mapped values, or `void` for sets
+//! @tparam _Scope The scope in which operations will be performed by individual threads
+//! @tparam _KeyEqual Binary callable type used to compare two keys for equality
+//! @tparam _ProbingScheme Probing scheme type, see `linear_probing` and `double_hashing`
+//! @tparam _BucketSize Number of consecutive slots a thread inspects per probe
+template <class _Key, class _Tp, ::cuda::thread_scope _Scope, class _KeyEqual, class _ProbingScheme, int _BucketSize>
+class __open_addressing_ref_impl
+{
+  static_assert(__open_addressing_ns::__is_atomic_compatible_v<_Key>,
+                "Key type must be trivially copyable and 1, 2, 4 or 8 bytes large");
+  static_assert(__open_addressing_ns::__is_atomic_compatible_v<_Tp>,
+                "Mapped type must be trivially copyable and 1, 2, 4 or 8 bytes large");
+  static_assert(_BucketSize > 0, "Bucket size must be positive");
+
+public:
+  static constexpr bool __has_payload = !::cuda::std::is_void_v<_Tp>; ///< Whether slots hold a mapped value
+
+  using __key_type            = _Key; ///< Key type
+  using __mapped_type         = _Tp; ///< Mapped type, `void` for sets
+  using __value_type          = typename __open_addressing_ns::__slot<_Key, _Tp>::type; ///< Slot type
+  using __key_equal           = _KeyEqual; ///< Key equality type
+  using __probing_scheme_type = _ProbingScheme; ///< Probing scheme type
+  using __hasher              = typename _ProbingScheme::hasher; ///< Hash function type
+  using __size_type           = ::cuda::std::size_t; ///< Size type
+
+  static constexpr auto __thread_scope = _Scope; ///< CUDA thread scope
+  static constexpr int __cg_size       = _ProbingScheme::cg_size; ///< Cooperative group size
+  static constexpr int __bucket_size   = _BucketSize; ///< Number of slots per bucket
+  static constexpr int __window_size   = __cg_size * _BucketSize; ///< Number of slots probed at once
+
+private:
+  __key_equal __predicate; ///< Key equality
+  __probing_scheme_type __probing_scheme; ///< Probing scheme
+  ::cuda::std::span<__value_type> __storage; ///< Slot storage
+  __value_type __empty_slot; ///< Value of an empty slot, i.e. the sentinels
+
+public:
+  //! @brief Constructs a non-owning `__open_addressing_ref_impl` object.
+  //!
+  //! @throw If the storage is empty or its size is not a multiple of the window size.
+  //!
+  //! @param __storage Reference to the slot storage, see `__storage_size`
+  //! @param __empty_slot Value of an empty slot
+  //! @param __predicate Key equality
+  //! @param __probing_scheme Probing scheme
+  _CCCL_API constexpr __open_addressing_ref_impl(
+    ::cuda::std::span<__value_type> __storage,
+    const __value_type& __empty_slot,
+    const _KeyEqual& __predicate,
+    const _ProbingScheme& __probing_scheme)
+      : __predicate{__predicate}
+      , __probing_scheme{__probing_scheme}
+      , __storage{__storage}
+      , __empty_slot{__empty_slot}
+  {
+    if (__storage.empty() || __storage.size() % __window_size != 0)
+    {
+      _CCCL_THROW(::std::invalid_argument, "Slot storage size must be a positive multiple of the window size");
+    }
+  }
+
+  //! @brief Returns the number of slots required to store at least `__capacity` keys.
+  //!
+  //! The number of windows is rounded up to a prime number, so that every probing scheme visits every window.
+  //!
+  //! @param __capacity Requested capacity
+  //!
+  //! @return Number of slots
+  [[nodiscard]] _CCCL_API static constexpr __size_type __storage_size(__size_type __capacity) noexcept
+  {
+    const auto __num_windows =
+      ::cuda::std::max(::cuda::ceil_div(__capacity, __size_type{__window_size}), __size_type{1});
+    return __open_addressing_ns::__next_prime(__num_windows) * __window_size;
+  }
+
+  //! @brief Gets the number of slots.
+  [[nodiscard]] _CCCL_API constexpr __size_type __capacity() const noexcept
+  {
+    return __storage.size();
+  }
+
+  //! @brief Gets the slot storage.
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::span<__value_type> __slots() const noexcept
+  {
+    return __storage;
+  }
+
+  //! @brief Gets the value of an empty slot.
+  [[nodiscard]] _CCCL_API constexpr const __value_type& __empty_slot_sentinel() const noexcept
+  {
+    return __empty_slot;
+  }
+
+  //! @brief Gets the empty key sentinel.
+  [[nodiscard]] _CCCL_API constexpr const _Key& __empty_key_sentinel() const noexcept
+  {
+    return __key_of(__empty_slot);
+  }
+
+  //! @brief Gets the key equality.
+  [[nodiscard]] _CCCL_API constexpr __key_equal __key_eq() const noexcept
+  {
+    return __predicate;
+  }
+
+  //! @brief Gets the probing scheme.
+  [[nodiscard]] _CCCL_API constexpr __probing_scheme_type __probing() const noexcept
+  {
+    return __probing_scheme;
+  }
+
+  //! @brief Returns the key of a slot.
+  [[nodiscard]] _CCCL_API static constexpr _Key& __key_of(__value_type& __slot) noexcept
+  {
+    if constexpr (__has_payload)
+    {
+      return __slot.first;
+    }
+    else
+    {
+      return __slot;
+    }
+  }
+
+  //! @brief Returns the key of a slot.
+  [[nodiscard]] _CCCL_API static constexpr const _Key& __key_of(const __value_type& __slot) noexcept
+  {
+    if constexpr (__has_payload)
+    {
+      return __slot.first;
+    }
+    else
+    {
+      return __slot;
+    }
+  }
+
+  //! @brief Atomically loads the key of a slot.
+  [[nodiscard]] _CCCL_API _Key __load_key(__value_type& __slot) const noexcept
+  {
+    return ::cuda::atomic_ref<_Key, _Scope>{__key_of(__slot)}.load(::cuda::std::memory_order_relaxed);
+  }
+
+  //! @brief Returns whether `__key` is the empty key sentinel.
+  [[nodiscard]] _CCCL_API constexpr bool __is_empty_key(const _Key& __key) const noexcept
+  {
+    return __open_addressing_ns::__bitwise_equal(__key, __key_of(__empty_slot));
+  }
+
+  //! @brief Inserts a value.
+  //!
+  //! @param __value The key, or key/value pair for maps, to insert
+  //!
+  //! @return `true` if the key was inserted, `false` if an equal key is present or the container is full
+  [[nodiscard]] _CCCL_API bool __insert(const __value_type& __value) const noexcept
+  {
+    const auto& __key = __key_of(__value);
+    auto __probe      = __probing_scheme(__key, __num_windows());
+    for (__size_type __attempt = 0; __attempt < __num_windows(); ++__attempt, ++__probe)
+    {
+      auto* __window = __storage.data() + *__probe * __window_size;
+      for (int __i = 0; __i < __window_size; ++__i)
+      {
+        const auto __slot_key = __load_key(__window[__i]);
+        if (__is_empty_key(__slot_key))
+        {
+          switch (__attempt_insert(__window[__i], __value))
+          {
+            case __open_addressing_ns::__insert_result::__success:
+              return true;
+            case __open_addressing_ns::__insert_result::__duplicate:
+              return false;
+            default:
+              break;
+          }
+        }
+        else if (__predicate(__key, __slot_key))
+        {
+          return false;
+        }
+      }
+    }
+    return false;
+  }
+
+  //! @brief Inserts a key/value pair, or assigns the value if an equal key is present.
+  //!
+  //! @param __value The key/value pair to insert or assign
+  _CCCL_API void __insert_or_assign(const __value_type& __value) const noexcept
+  {
+    static_assert(__has_payload, "insert_or_assign requires a mapped type");
+    const auto& __key = __key_of(__value);
+    auto __probe      = __probing_scheme(__key, __num_windows());
+    for (__size_type __attempt = 0; __attempt < __num_windows(); ++__attempt, ++__probe)
+    {
+      auto* __window = __storage.data() + *__probe * __window_size;
+      for (int __i = 0; __i < __window_size; ++__i)
+      {
+        const auto __slot_key = __load_key(__window[__i]);
+        if (__is_empty_key(__slot_key))
+        {
+          switch (__attempt_insert(__window[__i], __value))
+          {
+            case __open_addressing_ns::__insert_result::__success:
+              return;
+            case __open_addressing_ns::__insert_result::__duplicate:
+              __store_payload(__window[__i], __value.second);
+              return;
+            default:
+              break;
+          }
+        }
+        else if (__predicate(__key, __slot_key))
+        {
+          __store_payload(__window[__i], __value.second);
+          return;
+        }
+      }
+    }
+  }
+
+  //! @brief Finds the slot holding a key equal to `__key`.
+  //!
+  //! @note For maps, waits until the payload of the slot is written.
+  //!
+  //! @param __key The key to search for
+  //!
+  //! @return Pointer to the slot, or `nullptr` if no equal key is present
+  [[nodiscard]] _CCCL_API __value_type* __find(const _Key& __key) const noexcept
+  {
+    auto __probe = __probing_scheme(__key, __num_windows());
+    for (__size_type __attempt = 0; __attempt < __num_windows(); ++__attempt, ++__probe)
+    {
+      auto* __window = __storage.data() + *__probe * __window_size;
+      for (int __i = 0; __i < __window_size; ++__i)
+      {
+        const auto __slot_key = __load_key(__window[__i]);
+        if (__is_empty_key(__slot_key))
+        {
+          return nullptr;
+        }
+        if (__predicate(__key, __slot_key))
+        {
+          __wait_for_payload(__window[__i]);
+          return __window + __i;
+        }
+      }
+    }
+    return nullptr;
+  }
+
+  //! @brief Returns whether a key equal to `__key` is present.
+  [[nodiscard]] _CCCL_API bool __contains(const _Key& __key) const noexcept
+  {
+    auto __probe = __probing_scheme(__key, __num_windows());
+    for (__size_type __attempt = 0; __attempt < __num_windows(); ++__attempt, ++__probe)
+    {
+      auto* __window = __storage.data() + *__probe * __window_size;
+      for (int __i = 0; __i < __window_size; ++__i)
+      {
+        const auto __slot_key = __load_key(__window[__i]);
+        if (__is_empty_key(__slot_key))
+        {
+          return false;
+        }
+        if (__predicate(__key, __slot_key))
+        {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  //! @brief Cooperatively inserts a value. Every thread of `__group` inspects one bucket of each probed window.
+  //!
+  //! @tparam _CG Cooperative group type of `cg_size` threads
+  //!
+  //! @param __group The cooperative group this operation is executed in
+  //! @param __value The key, or key/value pair for maps, to insert
+  //!
+  //! @return `true` if the key was inserted, `false` if an equal key is present or the container is full
+  template <class _CG>
+  [[nodiscard]] _CCCL_DEVICE bool __insert(const _CG& __group, const __value_type& __value) const noexcept
+  {
+    const auto& __key = __key_of(__value);
+    const auto __rank = static_cast<int>(__group.thread_rank());
+    auto __probe      = __probing_scheme(__key, __num_windows());
+    for (__size_type __attempt = 0; __attempt < __num_windows(); ++__attempt, ++__probe)
+    {
+      auto* __bucket = __storage.data() + *__probe * __window_size + __rank * _BucketSize;
+      while (true)
+      {
+        int __empty_idx = -1;
+        bool __equal    = false;
+        for (int __i = 0; __i < _BucketSize; ++__i)
+        {
+          const auto __slot_key = __load_key(__bucket[__i]);
+          if (__is_empty_key(__slot_key))
+          {
+            __empty_idx = __i;
+            break;
+          }
+          if (__predicate(__key, __slot_key))
+          {
+            __equal = true;
+            break;
+          }
+        }
+        if (__group.any(__equal))
+        {
+          return false;
+        }
+
+        // The first empty slot of the window belongs to the lowest thread that found one
+        const auto __empty_mask = __group.ballot(__empty_idx >= 0);
+        if (__empty_mask == 0)
+        {
+          break;
+        }
+        const auto __src = ::cuda::std::countr_zero(__empty_mask);
+        auto __status    = __open_addressing_ns::__insert_result::__continue;
+        if (__rank == __src)
+        {
+          __status = __attempt_insert(__bucket[__empty_idx], __value);
+        }
+        __status = static_cast<__open_addressing_ns::__insert_result>(__group.shfl(static_cast<int>(__status), __src));
+        if (__status != __open_addressing_ns::__insert_result::__continue)
+        {
+          return __status == __open_addressing_ns::__insert_result::__success;
+        }
+        // The slot was claimed by another key in the meantime, inspect the window again
+      }
+    }
+    return false;
+  }
+
+  //! @brief Cooperatively finds the slot holding a key equal to `__key`.
+  //!
+  //! @tparam _CG Cooperative group type of `cg_size` threads
+  //!
+  //! @param __group The cooperative group this operation is executed in
+  //! @param __key The key to search for
+  //!
+  //! @return Pointer to the slot, or `nullptr` if no equal key is present
+  template <class _CG>
+  [[nodiscard]] _CCCL_DEVICE __value_type* __find(const _CG& __group, const _Key& __key) const noexcept
+  {
+    const auto __rank = static_cast<int>(__group.thread_rank());
+    auto __probe      = __probing_scheme(__key, __num_windows());
+    for (__size_type __attempt = 0; __attempt < __num_windows(); ++__attempt, ++__probe)
+    {
+      auto* __window  = __storage.data() + *__probe * __window_size;
+      int __match_idx = -1;
+      bool __empty    = false;
+      for (int __i = 0; __i < _BucketSize; ++__i)
+      {
+        const auto __slot_key = __load_key(__window[__rank * _BucketSize + __i]);
+        if (__is_empty_key(__slot_key))
+        {
+          __empty = true;
+          break;
+        }
+        if (__predicate(__key, __slot_key))
+        {
+          __match_idx = __rank * _BucketSize + __i;
+          break;
+        }
+      }
+
+      const auto __match_mask = __group.ballot(__match_idx >= 0);
+      if (__match_mask != 0)
+      {
+        auto* __slot = __window + __group.shfl(__match_idx, ::cuda::std::countr_zero(__match_mask));
+        __wait_for_payload(*__slot);
+        return __slot;
+      }
+      if (__group.any(__empty))
+      {
+        return nullptr;
+      }
+    }
+    return nullptr;
+  }
+
+  //! @brief Cooperatively returns whether a key equal to `__key` is present.
+  template <class _CG>
+  [[nodiscard]] _CCCL_DEVICE bool __contains(const _CG& __group, const _Key& __key) const noexcept
+  {
+    const auto __rank = static_cast<int>(__group.thread_rank());
+    auto __probe      = __probing_scheme(__key, __num_windows());
+    for (__size_type __attempt = 0; __attempt < __num_windows(); ++__attempt, ++__probe)
+    {
+      auto* __bucket = __storage.data() + *__probe * __window_size + __rank * _BucketSize;
+      bool __match   = false;
+      bool __empty   = false;
+      for (int __i = 0; __i < _BucketSize; ++__i)
+      {
+        const auto __slot_key = __load_key(__bucket[__i]);
+        if (__is_empty_key(__slot_key))
+        {
+          __empty = true;
+          break;
+        }
+        if (__predicate(__key, __slot_key))
+        {
+          __match = true;
+          break;
+        }
+      }
+      if (__group.any(__match))
+      {
+        return true;
+      }
+      if (__group.any(__empty))
+      {
+        return false;
+      }
+    }
+    return false;
+  }
+
+  //! @brief Fills the storage with empty slots on the host.
+  //!
+  //! @param __max_threads Upper bound of the number of host threads, or 0 for the number of hardware threads
+  _CCCL_HOST void __initialize_host(unsigned __max_threads) const
+  {
+    const auto __num_threads = ::cuda::experimental::cuco::__host_thread_count(
+      __storage.size(), 16 * __open_addressing_ns::__host_items_per_thread, __max_threads);
+    ::cuda::experimental::cuco::__host_parallel_for(
+      __storage.size(), __num_threads, [this](__size_type __begin, __size_type __end) {
+        for (auto __i = __begin; __i < __end; ++__i)
+        {
+          __storage[__i] = __empty_slot;
+        }
+      });
+  }
+
+  //! @brief Inserts the values of [`__first`, `__last`) on the host.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator whose value type is convertible to the slot type
+  //!
+  //! @param __first Beginning of the sequence of values
+  //! @param __last End of the sequence of values
+  //! @param __max_threads Upper bound of the number of host threads, or 0 for the number of hardware threads
+  //!
+  //! @return Number of inserted values
+  template <class _InputIt>
+  _CCCL_HOST __size_type __insert_host(_InputIt __first, _InputIt __last, unsigned __max_threads) const
+  {
+    ::std::atomic<__size_type> __num_inserted{0};
+    __for_each_host(__first, __last, __max_threads, [&](_InputIt __part_first, __size_type __n) {
+      __size_type __local = 0;
+      for (__size_type __i = 0; __i < __n; ++__i)
+      {
+        __local += __insert(static_cast<__value_type>(*(__part_first + __i)));
+      }
+      __num_inserted.fetch_add(__local, ::std::memory_order_relaxed);
+    });
+    return __num_inserted.load(::std::memory_order_relaxed);
+  }
+
+  //! @brief Inserts or assigns the key/value pairs of [`__first`, `__last`) on the host.
+  template <class _InputIt>
+  _CCCL_HOST void __insert_or_assign_host(_InputIt __first, _InputIt __last, unsigned __max_threads) const
+  {
+    __for_each_host(__first, __last, __max_threads, [&](_InputIt __part_first, __size_type __n) {
+      for (__size_type __i = 0; __i < __n; ++__i)
+      {
+        __insert_or_assign(static_cast<__value_type>(*(__part_first + __i)));
+      }
+    });
+  }
+
+  //! @brief Writes whether each key of [`__first`, `__last`) is present to `__output_begin` on the host.
+  template <class _InputIt, class _OutputIt>
+  _CCCL_HOST void
+  __contains_host(_InputIt __first, _InputIt __last, _OutputIt __output_begin, unsigned __max_threads) const
+  {
+    __for_each_host(__first, __last, __max_threads, [&](_InputIt __part_first, __size_type __n) {
+      auto __out = __output_begin + ::cuda::std::distance(__first, __part_first);
+      for (__size_type __i = 0; __i < __n; ++__i)
+      {
+        __out[__i] = __contains(static_cast<_Key>(*(__part_first + __i)));
+      }
+    });
+  }
+
+  //! @brief Writes the stored key (sets) or mapped value (maps) of each key of [`__first`, `__last`) to
+  //! `__output_begin` on the host, or the empty key or empty value sentinel if the key is not present.
+  template <class _InputIt, class _OutputIt>
+  _CCCL_HOST void __find_host(_InputIt __first, _InputIt __last, _OutputIt __output_begin, unsigned __max_threads) const
+  {
+    __for_each_host(__first, __last, __max_threads, [&](_InputIt __part_first, __size_type __n) {
+      auto __out = __output_begin + ::cuda::std::distance(__first, __part_first);
+      for (__size_type __i = 0; __i < __n; ++__i)
+      {
+        const auto* __slot = __find(static_cast<_Key>(*(__part_first + __i)));
+        if constexpr (__has_payload)
+        {
+          __out[__i] = __slot ? __slot->second : __empty_slot.second;
+        }
+        else
+        {
+          __out[__i] = __slot ? *__slot : __empty_slot;
+        }
+      }
+    });
+  }
+
+  //! @brief Writes the content of every filled slot, in slot order, on the host.
+  //!
+  //! @param __keys_out Random access output iterator the keys are written to
+  //! @param __values_out Random access output iterator the mapped values are written to, ignored for sets
+  //! @param __max_threads Upper bound of the number of host threads, or 0 for the number of hardware threads
+  //!
+  //! @return Number of written slots
+  template <class _KeyOut, class _ValueOut>
+  _CCCL_HOST __size_type __retrieve_all_host(_KeyOut __keys_out, _ValueOut __values_out, unsigned __max_threads) const
+  {
+    const auto __num_slots   = __storage.size();
+    const auto __num_threads = ::cuda::experimental::cuco::__host_thread_count(
+      __num_slots, 16 * __open_addressing_ns::__host_items_per_thread, __max_threads);
+    const auto __slots_per_thread = ::cuda::ceil_div(__num_slots, __size_type{__num_threads});
+
+    // The first pass counts the filled slots of every part, the second one writes them at their offset
+    ::std::vector<__size_type> __offsets(__num_threads + 1, 0);
+    auto __count_part = [&](unsigned __t) {
+      const auto __begin = ::cuda::std::min(__t * __slots_per_thread, __num_slots);
+      const auto __end   = ::cuda::std::min(__begin + __slots_per_thread, __num_slots);
+      __size_type __count = 0;
+      for (auto __i = __begin; __i < __end; ++__i)
+      {
+        __count += !__is_empty_key(__key_of(__storage[__i]));
+      }
+      __offsets[__t + 1] = __count;
+    };
+    ::cuda::experimental::cuco::__run_on_host_threads(__num_threads, __count_part);
+    for (unsigned __t = 0; __t < __num_threads; ++__t)
+    {
+      __offsets[__t + 1] += __offsets[__t];
+    }
+
+    auto __write_part = [&](unsigned __t) {
+      const auto __begin = ::cuda::std::min(__t * __slots_per_thread, __num_slots);
+      const auto __end   = ::cuda::std::min(__begin + __slots_per_thread, __num_slots);
+      auto __out         = __offsets[__t];
+      for (auto __i = __begin; __i < __end; ++__i)
+      {
+        const auto& __slot = __storage[__i];
+        if (!__is_empty_key(__key_of(__slot)))
+        {
+          __keys_out[__out] = __key_of(__slot);
+          if constexpr (__has_payload)
+          {
+            __values_out[__out] = __slot.second;
+          }
+          ++__out;
+        }
+      }
+    };
+    ::cuda::experimental::cuco::__run_on_host_threads(__num_threads, __write_part);
+    return __offsets[__num_threads];
+  }
+
+  //! @brief Returns the number of filled slots on the host.
+  _CCCL_HOST __size_type __size_host(unsigned __max_threads) const
+  {
+    ::std::atomic<__size_type> __size{0};
+    const auto __num_threads = ::cuda::experimental::cuco::__host_thread_count(
+      __storage.size(), 16 * __open_addressing_ns::__host_items_per_thread, __max_threads);
+    ::cuda::experimental::cuco::__host_parallel_for(
+      __storage.size(), __num_threads, [&](__size_type __begin, __size_type __end) {
+        __size_type __local = 0;
+        for (auto __i = __begin; __i < __end; ++__i)
+        {
+          __local += !__is_empty_key(__key_of(__storage[__i]));
+        }
+        __size.fetch_add(__local, ::std::memory_order_relaxed);
+      });
+    return __size.load(::std::memory_order_relaxed);
+  }
+
+private:
+  //! @brief Gets the number of windows.
+  [[nodiscard]] _CCCL_API constexpr __size_type __num_windows() const noexcept
+  {
+    return __storage.size() / __window_size;
+  }
+
+  //! @brief Tries to claim the empty `__slot` for `__value`.
+  [[nodiscard]] _CCCL_API __open_addressing_ns::__insert_result
+  __attempt_insert(__value_type& __slot, const __value_type& __value) const noexcept
+  {
+    auto __expected = __key_of(__empty_slot);
+    if (::cuda::atomic_ref<_Key, _Scope>{__key_of(__slot)}.compare_exchange_strong(
+          __expected, __key_of(__value), ::cuda::std::memory_order_relaxed))
+    {
+      if constexpr (__has_payload)
+      {
+        __store_payload(__slot, __value.second);
+      }
+      return __open_addressing_ns::__insert_result::__success;
+    }
+    // __expected now holds the key that claimed the slot first
+    return __predicate(__key_of(__value), __expected)
+           ? __open_addressing_ns::__insert_result::__duplicate
+           : __open_addressing_ns::__insert_result::__continue;
+  }
+
+  //! @brief Publishes the payload of a claimed slot.
+  template <class _Payload>
+  _CCCL_API void __store_payload(__value_type& __slot, const _Payload& __payload) const noexcept
+  {
+    ::cuda::atomic_ref<_Tp, _Scope>{__slot.second}.store(__payload, ::cuda::std::memory_order_release);
+  }
+
+  //! @brief Waits until the payload of a claimed slot is published. No-op for sets.
+  _CCCL_API void __wait_for_payload([[maybe_unused]] __value_type& __slot) const noexcept
+  {
+    if constexpr (__has_payload)
+    {
+      ::cuda::atomic_ref<_Tp, _Scope> __payload{__slot.second};
+      while (__open_addressing_ns::__bitwise_equal(__payload.load(::cuda::std::memory_order_acquire),
+                                                   __empty_slot.second))
+      {
+      }
+    }
+  }
+
+  //! @brief Splits [`__first`, `__last`) over host threads and invokes `__fn(__part_first, __part_size)` for every
+  //! part.
+  template <class _InputIt, class _Fn>
+  _CCCL_HOST void __for_each_host(_InputIt __first, _InputIt __last, unsigned __max_threads, _Fn __fn) const
+  {
+    const auto __num_items = static_cast<__size_type>(::cuda::std::distance(__first, __last));
+    if (__num_items == 0)
+    {
+      return;
+    }
+    const auto __num_threads = ::cuda::experimental::cuco::__host_thread_count(
+      __num_items, __open_addressing_ns::__host_items_per_thread, __max_threads);
+    ::cuda::experimental::cuco::__host_parallel_for(
+      __num_items, __num_threads, [&](__size_type __begin, __size_type __end) {
+        __fn(__first + __begin, __end - __begin);
+      });
+  }
+};
+} // namespace cuda::experimental::cuco
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO___OPEN_ADDRESSING_OPEN_ADDRESSING_REF_IMPL_CUH
@@ -0,0 +1,124 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO___QUANTILE_SKETCH_KERNELS_CUH
+#define _CUDAX___CUCO___QUANTILE_SKETCH_KERNELS_CUH
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/atomic>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/cstdint>
+
+#include <cooperative_groups.h>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_DIAG_PUSH
+_CCCL_DIAG_SUPPRESS_GCC("-Wattributes")
+
+namespace cuda::experimental::cuco::__quantile_sketch_ns
+{
+//! Number of threads per block of the bulk operation kernels
+inline constexpr int __block_size = 256;
+
+//! @brief Returns the global thread ID in a 1D grid
+[[nodiscard]] _CCCL_DEVICE inline ::cuda::std::int64_t __global_thread_id() noexcept
+{
+  return static_cast<::cuda::std::int64_t>(blockDim.x) * blockIdx.x + threadIdx.x;
+}
+
+//! @brief Returns the grid stride of a 1D grid
+[[nodiscard]] _CCCL_DEVICE inline ::cuda::std::int64_t __grid_stride() noexcept
+{
+  return static_cast<::cuda::std::int64_t>(gridDim.x) * blockDim.x;
+}
+
+//! @brief Adds values to a block-local copy of the sketch in shared memory and adds it to the sketch at the end.
+//!
+//! @note The kernel must be launched with `__ref.__sketch_bytes()` bytes of dynamic shared memory.
+template <class _InputIt, class _RefType>
+CCCL_DETAIL_KERNEL_ATTRIBUTES void __add_shmem(_InputIt __first, ::cuda::std::int64_t __n, _RefType __ref)
+{
+  using __value_type   = typename _RefType::__value_type;
+  using __counter_type = typename _RefType::__counter_type;
+
+  // Dynamic shared memory must be declared with the same type in all instantiations
+  extern __shared__ ::cuda::std::byte __local_sketch[];
+  auto* const __local_counters = reinterpret_cast<__counter_type*>(__local_sketch);
+
+  const auto __block       = ::cooperative_groups::this_thread_block();
+  const int __num_counters = __ref.__num_counters();
+  for (int __i = __block.thread_rank(); __i < __num_counters; __i += __block.size())
+  {
+    __local_counters[__i] = 0;
+  }
+  __block.sync();
+
+  for (auto __idx = __global_thread_id(); __idx < __n; __idx += __grid_stride())
+  {
+    const auto __index = __ref.__counter_index(static_cast<__value_type>(*(__first + __idx)));
+    if (__index >= 0)
+    {
+      ::cuda::atomic_ref<__counter_type, ::cuda::thread_scope_block> __counter_ref(__local_counters[__index]);
+      __counter_ref.fetch_add(1, ::cuda::std::memory_order_relaxed);
+    }
+  }
+  __block.sync();
+
+  for (int __i = __block.thread_rank(); __i < __num_counters; __i += __block.size())
+  {
+    if (__local_counters[__i] != 0)
+    {
+      __ref.__add_to_counter(__i, __local_counters[__i]);
+    }
+  }
+}
+
+//! @brief Adds values directly to the sketch in global memory.
+template <class _InputIt, class _RefType>
+CCCL_DETAIL_KERNEL_ATTRIBUTES void __add_gmem(_InputIt __first, ::cuda::std::int64_t __n, _RefType __ref)
+{
+  using __value_type = typename _RefType::__value_type;
+
+  for (auto __idx = __global_thread_id(); __idx < __n; __idx += __grid_stride())
+  {
+    __ref.__add(static_cast<__value_type>(*(__first + __idx)));
+  }
+}
+
+template <class _OtherRefType, class _RefType>
+CCCL_DETAIL_KERNEL_ATTRIBUTES void __merge(_OtherRefType __other_ref, _RefType __ref)
+{
+  const auto __other_counters = __other_ref.__counter_span();
+  const int __num_counters    = __ref.__num_counters();
+  for (auto __idx = __global_thread_id(); __idx < __num_counters; __idx += __grid_stride())
+  {
+    if (__other_counters[__idx] != 0)
+    {
+      __ref.__add_to_counter(static_cast<int>(__idx), __other_counters[__idx]);
+    }
+  }
+}
+} // namespace cuda::experimental::cuco::__quantile_sketch_ns
+
+_CCCL_DIAG_POP
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO___QUANTILE_SKETCH_KERNELS_CUH
@@ -0,0 +1,673 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO___QUANTILE_SKETCH_QUANTILE_SKETCH_IMPL_CUH
+#define _CUDAX___CUCO___QUANTILE_SKETCH_QUANTILE_SKETCH_IMPL_CUH
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/__container/buffer.h>
+#include <cuda/__driver/driver_api.h>
+#include <cuda/__memory/is_aligned.h>
+#include <cuda/__runtime/api_wrapper.h>
+#include <cuda/__stream/stream_ref.h>
+#include <cuda/atomic>
+#include <cuda/std/__algorithm/clamp.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__host_stdlib/stdexcept>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/cmath>
+#include <cuda/std/cstdint>
+#include <cuda/std/limits>
+#include <cuda/std/span>
+
+#include <cuda/experimental/__cuco/__quantile_sketch/kernels.cuh>
+#include <cuda/experimental/__cuco/__utility/host_threads.cuh>
+#include <cuda/experimental/__cuco/__utility/strong_type.cuh>
+
+#include <vector>
+
+#include <cuda/std/__cccl/prologue.h>
+
+namespace cuda::experimental::cuco
+{
+//! A strong type wrapper of `double` for the relative accuracy of the values returned by
+//! `cuda::experimental::cuco::quantile_sketch(_ref)`.
+CUDAX_CUCO_DEFINE_STRONG_TYPE(__relative_accuracy_t, double);
+
+namespace __quantile_sketch_ns
+{
+//! Minimum number of items a host thread processes in `__add_host`, so that the costs of starting the thread and of
+//! merging its counters are amortized.
+inline constexpr ::cuda::std::size_t __host_items_per_thread = 1 << 16;
+
+//! Largest sketch that the device ingestion privatizes in shared memory, which every device supports without opt-in
+inline constexpr ::cuda::std::size_t __max_shmem_sketch_bytes = 48 * 1024;
+} // namespace __quantile_sketch_ns
+
+//! @brief Implementation of `quantile_sketch_ref`, a logarithmically bucketed histogram of values.
+//!
+//! The sketch is an array of `2 * __num_buckets + 1` counters. Counter 0 counts the values whose magnitude is below
+//! the minimum value. Counter `1 + __k` counts the positive values of bucket `__k`, counter `1 + __num_buckets + __k`
+//! the negative values of bucket `__k`. Bucket `__k` holds the magnitudes in (`gamma^(__j - 1)`, `gamma^__j`] with
+//! `__j = __min_index + __k` and `gamma = (1 + alpha) / (1 - alpha)`. The last bucket also holds all larger magnitudes.
+//!
+//! @tparam _Tp Type of the values, an arithmetic type
+//! @tparam _Scope The scope in which operations will be performed by individual threads
+template <class _Tp, ::cuda::thread_scope _Scope>
+class __quantile_sketch_impl
+{
+public:
+  using __value_type   = _Tp; ///< Type of the values
+  using __counter_type = ::cuda::std::uint64_t; ///< Type of the counters
+
+  static constexpr auto __thread_scope = _Scope; ///< CUDA thread scope
+
+private:
+  double __alpha; ///< Relative accuracy
+  double __log_gamma; ///< Natural logarithm of the bucket growth factor
+  double __min_value; ///< Smallest magnitude that is not counted as zero
+  int __min_index; ///< Logarithmic index of the first bucket
+  int __num_buckets; ///< Number of buckets per sign
+  ::cuda::std::span<__counter_type> __counters; ///< Sketch storage
+
+  template <class _Tp_, ::cuda::thread_scope _Scope_>
+  friend class __quantile_sketch_impl;
+
+  //! @brief Returns the natural logarithm of the bucket growth factor of relative accuracy `__alpha`.
+  [[nodiscard]] _CCCL_API static double __log_gamma_of(double __alpha) noexcept
+  {
+    return ::cuda::std::log((1.0 + __alpha) / (1.0 - __alpha));
+  }
+
+  //! @brief Returns the logarithmic index of the bucket holding the magnitude `__magnitude`, which is infinite for an
+  //! infinite magnitude. It is only converted to `int` once it is known to be in range.
+  [[nodiscard]] _CCCL_API static double __log_index(double __magnitude, double __log_gamma) noexcept
+  {
+    return ::cuda::std::ceil(::cuda::std::log(__magnitude) / __log_gamma);
+  }
+
+public:
+  //! @brief Constructs a non-owning `__quantile_sketch_impl` object.
+  //!
+  //! @throw If the relative accuracy is not in (0, 1), the minimum value is not positive, the storage holds fewer
+  //! than three counters or it is not aligned to `__sketch_alignment()`.
+  //!
+  //! @param __sketch_span Reference to sketch storage
+  //! @param __alpha Relative accuracy
+  //! @param __min_value Smallest magnitude that is not counted as zero
+  _CCCL_API __quantile_sketch_impl(::cuda::std::span<::cuda::std::byte> __sketch_span,
+                                   ::cuda::experimental::cuco::__relative_accuracy_t __alpha,
+                                   double __min_value)
+      : __alpha{__alpha}
+      , __log_gamma{__log_gamma_of(__alpha)}
+      , __min_value{__min_value}
+      , __min_index{0}
+      , __num_buckets{static_cast<int>((__sketch_span.size() / sizeof(__counter_type) - 1) / 2)}
+      , __counters{reinterpret_cast<__counter_type*>(__sketch_span.data()),
+                   static_cast<::cuda::std::size_t>(2 * __num_buckets + 1)}
+  {
+    if (!(__alpha > 0.0 && __alpha < 1.0))
+    {
+      _CCCL_THROW(::std::invalid_argument, "Relative accuracy must be in (0, 1)");
+    }
+    if (!(__min_value > 0.0))
+    {
+      _CCCL_THROW(::std::invalid_argument, "Minimum value must be positive");
+    }
+    if (__sketch_span.size() < 3 * sizeof(__counter_type))
+    {
+      _CCCL_THROW(::std::invalid_argument, "Sketch storage must hold at least three counters");
+    }
+    if (!::cuda::is_aligned(__sketch_span.data(), __sketch_alignment()))
+    {
+      _CCCL_THROW(::std::invalid_argument, "Sketch storage has insufficient alignment");
+    }
+    // The logarithmic indices of all buckets must be representable
+    const auto __first_index = __log_index(__min_value, __log_gamma);
+    if (!(__first_index >= static_cast<double>(::cuda::std::numeric_limits<int>::min())
+          && __first_index + __num_buckets - 1 <= static_cast<double>(::cuda::std::numeric_limits<int>::max())))
+    {
+      _CCCL_THROW(::std::invalid_argument, "Minimum value is out of range for the relative accuracy");
+    }
+    __min_index = static_cast<int>(__first_index);
+  }
+
+  //! @brief Returns the index of the counter `__value` is counted in, or -1 if `__value` is NaN.
+  [[nodiscard]] _CCCL_API int __counter_index(__value_type __value) const noexcept
+  {
+    const auto __x = static_cast<double>(__value);
+    if (__x != __x)
+    {
+      return -1;
+    }
+    const auto __magnitude = __x < 0.0 ? -__x : __x;
+    if (__magnitude < __min_value)
+    {
+      return 0;
+    }
+    // Magnitudes close to the bucket boundaries may be rounded into the neighboring bucket, which stays within the
+    // relative accuracy. Larger magnitudes, including infinity, are clamped into the last bucket before the index is
+    // converted to int.
+    const auto __index = ::cuda::std::clamp(__log_index(__magnitude, __log_gamma),
+                                            static_cast<double>(__min_index),
+                                            static_cast<double>(__min_index + __num_buckets - 1));
+    const auto __bucket = static_cast<int>(__index) - __min_index;
+    return 1 + __bucket + (__x < 0.0 ? __num_buckets : 0);
+  }
+
+  //! @brief Returns the value that represents the values counted in counter `__index`.
+  [[nodiscard]] _CCCL_API double __representative(int __index) const noexcept
+  {
+    if (__index == 0)
+    {
+      return 0.0;
+    }
+    const bool __negative = __index > __num_buckets;
+    const int __bucket    = __index - 1 - (__negative ? __num_buckets : 0);
+    // 2 * gamma^j / (gamma + 1) is within the relative accuracy of every magnitude in (gamma^(j - 1), gamma^j]
+    const auto __gamma     = ::cuda::std::exp(__log_gamma);
+    const auto __magnitude = 2.0 * ::cuda::std::exp((__min_index + __bucket) * __log_gamma) / (__gamma + 1.0);
+    return __negative ? -__magnitude : __magnitude;
+  }
+
+  //! @brief Returns the index of the counter at position `__position` of the ascending value order.
+  [[nodiscard]] _CCCL_API int __counter_in_value_order(int __position) const noexcept
+  {
+    if (__position < __num_buckets)
+    {
+      return 2 * __num_buckets - __position;
+    }
+    return __position - __num_buckets;
+  }
+
+  //! @brief Atomically adds `__n` to counter `__index`.
+  _CCCL_API void __add_to_counter(int __index, __counter_type __n) const noexcept
+  {
+    ::cuda::atomic_ref<__counter_type, _Scope> __counter_ref(__counters[__index]);
+    __counter_ref.fetch_add(__n, ::cuda::std::memory_order_relaxed);
+  }
+
+  //! @brief Resets the sketch.
+  //!
+  //! @tparam _CG CUDA Cooperative Group type
+  //!
+  //! @param __group CUDA Cooperative group this operation is executed in
+  template <class _CG>
+  _CCCL_DEVICE void __clear(_CG __group) noexcept
+  {
+    for (int __i = __group.thread_rank(); __i < static_cast<int>(__counters.size()); __i += __group.size())
+    {
+      __counters[__i] = 0;
+    }
+  }
+
+  //! @brief Asynchronously resets the sketch.
+  //!
+  //! @param __stream CUDA stream this operation is executed in
+  _CCCL_HOST void __clear_async(::cuda::stream_ref __stream)
+  {
+    ::cuda::__driver::__memsetAsync(__counters.data(), ::cuda::std::uint8_t{0}, __sketch_bytes(), __stream.get());
+  }
+
+  //! @brief Resets the sketch.
+  //!
+  //! @note This function synchronizes the given stream. For asynchronous execution use `__clear_async`.
+  //!
+  //! @param __stream CUDA stream this operation is executed in
+  _CCCL_HOST void __clear(::cuda::stream_ref __stream)
+  {
+    __clear_async(__stream);
+    __stream.sync();
+  }
+
+  //! @brief Adds a value to the sketch. NaN values are ignored.
+  //!
+  //! @param __value The value to add
+  _CCCL_API void __add(__value_type __value) const noexcept
+  {
+    const auto __index = __counter_index(__value);
+    if (__index >= 0)
+    {
+      __add_to_counter(__index, 1);
+    }
+  }
+
+  //! @brief Asynchronously adds values to the sketch.
+  //!
+  //! Sketches of up to 48KB are privatized per thread block in shared memory and merged into the sketch at the end of
+  //! every block. Larger sketches are updated directly in global memory.
+  //!
+  //! @tparam _InputIt Device accessible random access input iterator whose value type is convertible to `_Tp`
+  //!
+  //! @param __first Beginning of the sequence of values
+  //! @param __last End of the sequence of values
+  //! @param __stream CUDA stream this operation is executed in
+  template <class _InputIt>
+  _CCCL_HOST void __add_async(_InputIt __first, _InputIt __last, ::cuda::stream_ref __stream)
+  {
+    const auto __num_items = static_cast<::cuda::std::int64_t>(::cuda::std::distance(__first, __last));
+    if (__num_items == 0)
+    {
+      return;
+    }
+
+    if (__sketch_bytes() <= __quantile_sketch_ns::__max_shmem_sketch_bytes)
+    {
+      // The occupancy calculator yields the minimum number of blocks which still saturates the GPU. This reduces the
+      // shmem initialization overhead and atomic contention when the block-local sketches are added to the sketch.
+      const auto __kernel =
+        ::cuda::experimental::cuco::__quantile_sketch_ns::__add_shmem<_InputIt, __quantile_sketch_impl>;
+      int __grid_size  = 0;
+      int __block_size = 0;
+      _CCCL_TRY_CUDA_API(
+        ::cudaOccupancyMaxPotentialBlockSize,
+        "cudaOccupancyMaxPotentialBlockSize failed",
+        &__grid_size,
+        &__block_size,
+        __kernel,
+        __sketch_bytes());
+      __kernel<<<__grid_size, __block_size, __sketch_bytes(), __stream.get()>>>(__first, __num_items, *this);
+    }
+    else
+    {
+      constexpr int __block_size = __quantile_sketch_ns::__block_size;
+      const auto __grid_size     = static_cast<int>(::cuda::std::min(
+        ::cuda::ceil_div(__num_items, ::cuda::std::int64_t{__block_size}), ::cuda::std::int64_t{1} << 16));
+      ::cuda::experimental::cuco::__quantile_sketch_ns::__add_gmem<<<__grid_size, __block_size, 0, __stream.get()>>>(
+        __first, __num_items, *this);
+    }
+  }
+
+  //! @brief Adds values to the sketch.
+  //!
+  //! @note This function synchronizes the given stream. For asynchronous execution use `__add_async`.
+  template <class _InputIt>
+  _CCCL_HOST void __add(_InputIt __first, _InputIt __last, ::cuda::stream_ref __stream)
+  {
+    __add_async(__first, __last, __stream);
+    __stream.sync();
+  }
+
+  //! @brief Merges the counters of `__other` into `*this`.
+  //!
+  //! @throw If the sketches have different parameters. Throws if called from host; __trap() if called from device.
+  //!
+  //! @tparam _CG CUDA Cooperative Group type
+  //! @tparam _OtherScope Thread scope of `__other`
+  //!
+  //! @param __group CUDA Cooperative group this operation is executed in
+  //! @param __other Other sketch to be merged into `*this`
+  template <class _CG, ::cuda::thread_scope _OtherScope>
+  _CCCL_DEVICE void __merge(_CG __group, const __quantile_sketch_impl<_Tp, _OtherScope>& __other) const
+  {
+    __check_compatible(__other);
+    for (int __i = __group.thread_rank(); __i < static_cast<int>(__counters.size()); __i += __group.size())
+    {
+      __add_to_counter(__i, __other.__counters[__i]);
+    }
+  }
+
+  //! @brief Asynchronously merges the counters of `__other` into `*this`.
+  //!
+  //! @throw If the sketches have different parameters.
+  template <::cuda::thread_scope _OtherScope>
+  _CCCL_HOST void __merge_async(const __quantile_sketch_impl<_Tp, _OtherScope>& __other, ::cuda::stream_ref __stream)
+  {
+    __check_compatible(__other);
+    const auto __grid_size = static_cast<int>(::cuda::ceil_div(__counters.size(), __quantile_sketch_ns::__block_size));
+    ::cuda::experimental::cuco::__quantile_sketch_ns::__merge<<<__grid_size,
+                                                                __quantile_sketch_ns::__block_size,
+                                                                0,
+                                                                __stream.get()>>>(__other, *this);
+  }
+
+  //! @brief Merges the counters of `__other` into `*this`.
+  //!
+  //! @note This function synchronizes the given stream. For asynchronous execution use `__merge_async`.
+  //!
+  //! @throw If the sketches have different parameters.
+  template <::cuda::thread_scope _OtherScope>
+  _CCCL_HOST void __merge(const __quantile_sketch_impl<_Tp, _OtherScope>& __other, ::cuda::stream_ref __stream)
+  {
+    __merge_async(__other, __stream);
+    __stream.sync();
+  }
+
+  //! @brief Returns the number of added values.
+  //!
+  //! @note This function synchronizes the given stream.
+  template <class _HostMemoryResource>
+  [[nodiscard]] _CCCL_HOST __counter_type __count(_HostMemoryResource __host_mr, ::cuda::stream_ref __stream) const
+  {
+    const auto __host_counters = __copy_to_host(__host_mr, __stream);
+    return __count_of(__host_counters.data());
+  }
+
+  //! @brief Returns the approximate `__q`-quantile of the added values.
+  //!
+  //! @note This function synchronizes the given stream.
+  template <class _HostMemoryResource>
+  [[nodiscard]] _CCCL_HOST double
+  __quantile(double __q, _HostMemoryResource __host_mr, ::cuda::stream_ref __stream) const
+  {
+    const auto __host_counters = __copy_to_host(__host_mr, __stream);
+    return __quantile_of(__host_counters.data(), __q);
+  }
+
+  //! @brief Writes the approximate quantiles of the probabilities [`__first`, `__last`) to `__output_begin`.
+  //!
+  //! @note This function synchronizes the given stream.
+  template <class _InputIt, class _OutputIt, class _HostMemoryResource>
+  _CCCL_HOST void __quantiles(_InputIt __first,
+                              _InputIt __last,
+                              _OutputIt __output_begin,
+                              _HostMemoryResource __host_mr,
+                              ::cuda::stream_ref __stream) const
+  {
+    const auto __host_counters = __copy_to_host(__host_mr, __stream);
+    for (; __first != __last; ++__first, ++__output_begin)
+    {
+      *__output_begin = __quantile_of(__host_counters.data(), static_cast<double>(*__first));
+    }
+  }
+
+  //! @brief Returns the approximate number of added values that are less than or equal to `__value`.
+  //!
+  //! @note This function synchronizes the given stream.
+  template <class _HostMemoryResource>
+  [[nodiscard]] _CCCL_HOST __counter_type
+  __rank(__value_type __value, _HostMemoryResource __host_mr, ::cuda::stream_ref __stream) const
+  {
+    const auto __host_counters = __copy_to_host(__host_mr, __stream);
+    return __rank_of(__host_counters.data(), __value);
+  }
+
+  //! @brief Resets the sketch on the host.
+  //!
+  //! @note The sketch storage must be host accessible.
+  _CCCL_HOST void __clear_host() noexcept
+  {
+    for (auto& __counter : __counters)
+    {
+      __counter = 0;
+    }
+  }
+
+  //! @brief Adds values to the sketch on the host.
+  //!
+  //! Large inputs are split among host threads. Every thread but the calling one counts its part in counters of its
+  //! own, which are added to `*this` once all threads are done.
+  //!
+  //! @note The sketch storage must be host accessible. No other operation may access the sketch concurrently.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator whose value type is convertible to `_Tp`
+  //!
+  //! @param __first Beginning of the sequence of values
+  //! @param __last End of the sequence of values
+  //! @param __max_threads Upper bound of the number of host threads, or 0 for the number of hardware threads
+  template <class _InputIt>
+  _CCCL_HOST void __add_host(_InputIt __first, _InputIt __last, unsigned __max_threads)
+  {
+    const auto __num_items = static_cast<::cuda::std::size_t>(::cuda::std::distance(__first, __last));
+    const auto __num_counters = __counters.size();
+    const auto __num_threads  = ::cuda::experimental::cuco::__host_thread_count(
+      __num_items, ::cuda::std::max(__quantile_sketch_ns::__host_items_per_thread, 4 * __num_counters), __max_threads);
+    if (__num_threads <= 1)
+    {
+      __add_host_range(__first, __num_items, __counters.data());
+      return;
+    }
+
+    ::std::vector<__counter_type> __local_counters((__num_threads - 1) * __num_counters, 0);
+    const auto __items_per_thread = ::cuda::ceil_div(__num_items, ::cuda::std::size_t{__num_threads});
+
+    auto __add_part = [&](unsigned __t) {
+      const auto __begin  = ::cuda::std::min(__t * __items_per_thread, __num_items);
+      const auto __count  = ::cuda::std::min(__items_per_thread, __num_items - __begin);
+      auto* __destination = __t == 0 ? __counters.data() : __local_counters.data() + (__t - 1) * __num_counters;
+      __add_host_range(__first + __begin, __count, __destination);
+    };
+    ::cuda::experimental::cuco::__run_on_host_threads(__num_threads, __add_part);
+
+    for (unsigned __t = 1; __t < __num_threads; ++__t)
+    {
+      const auto* __local = __local_counters.data() + (__t - 1) * __num_counters;
+      for (::cuda::std::size_t __i = 0; __i < __num_counters; ++__i)
+      {
+        __counters[__i] += __local[__i];
+      }
+    }
+  }
+
+  //! @brief Merges the counters of `__other` into `*this` on the host.
+  //!
+  //! @note The storage of both sketches must be host accessible.
+  //!
+  //! @throw If the sketches have different parameters.
+  template <::cuda::thread_scope _OtherScope>
+  _CCCL_HOST void __merge_host(const __quantile_sketch_impl<_Tp, _OtherScope>& __other)
+  {
+    __check_compatible(__other);
+    for (::cuda::std::size_t __i = 0; __i < __counters.size(); ++__i)
+    {
+      __counters[__i] += __other.__counters[__i];
+    }
+  }
+
+  //! @brief Returns the number of values counted by `__counters`.
+  [[nodiscard]] _CCCL_API __counter_type __count_of(const __counter_type* __counters_) const noexcept
+  {
+    __counter_type __total = 0;
+    for (::cuda::std::size_t __i = 0; __i < __counters.size(); ++__i)
+    {
+      __total += __counters_[__i];
+    }
+    return __total;
+  }
+
+  //! @brief Returns the approximate `__q`-quantile of the values counted by `__counters`, i.e. the value of rank
+  //! `floor(__q * (count - 1))` in ascending order, or NaN if there are no values.
+  [[nodiscard]] _CCCL_API double __quantile_of(const __counter_type* __counters_, double __q) const noexcept
+  {
+    const auto __total = __count_of(__counters_);
+    if (__total == 0 || !(__q >= 0.0 && __q <= 1.0))
+    {
+      return ::cuda::std::numeric_limits<double>::quiet_NaN();
+    }
+
+    const auto __rank         = static_cast<__counter_type>(__q * static_cast<double>(__total - 1));
+    __counter_type __seen     = 0;
+    const int __num_positions = static_cast<int>(__counters.size());
+    for (int __position = 0; __position < __num_positions; ++__position)
+    {
+      const auto __index = __counter_in_value_order(__position);
+      __seen += __counters_[__index];
+      if (__seen > __rank)
+      {
+        return __representative(__index);
+      }
+    }
+    return __representative(__counter_in_value_order(__num_positions - 1));
+  }
+
+  //! @brief Returns the number of values counted by `__counters` that are counted in the same or a smaller bucket
+  //! than `__value`.
+  [[nodiscard]] _CCCL_API __counter_type
+  __rank_of(const __counter_type* __counters_, __value_type __value) const noexcept
+  {
+    const auto __index = __counter_index(__value);
+    if (__index < 0)
+    {
+      return 0;
+    }
+    __counter_type __seen = 0;
+    for (int __position = 0;; ++__position)
+    {
+      const auto __current = __counter_in_value_order(__position);
+      __seen += __counters_[__current];
+      if (__current == __index)
+      {
+        return __seen;
+      }
+    }
+  }
+
+  //! @brief Returns the number of added values on the host.
+  //!
+  //! @note The sketch storage must be host accessible.
+  [[nodiscard]] _CCCL_HOST __counter_type __count_host() const noexcept
+  {
+    return __count_of(__counters.data());
+  }
+
+  //! @brief Returns the approximate `__q`-quantile of the added values on the host.
+  //!
+  //! @note The sketch storage must be host accessible.
+  [[nodiscard]] _CCCL_HOST double __quantile_host(double __q) const noexcept
+  {
+    return __quantile_of(__counters.data(), __q);
+  }
+
+  //! @brief Returns the approximate number of added values that are less than or equal to `__value` on the host.
+  //!
+  //! @note The sketch storage must be host accessible.
+  [[nodiscard]] _CCCL_HOST __counter_type __rank_host(__value_type __value) const noexcept
+  {
+    return __rank_of(__counters.data(), __value);
+  }
+
+  //! @brief Gets the relative accuracy.
+  [[nodiscard]] _CCCL_API constexpr double __relative_accuracy() const noexcept
+  {
+    return __alpha;
+  }
+
+  //! @brief Gets the smallest magnitude that is not counted as zero.
+  [[nodiscard]] _CCCL_API constexpr double __min_magnitude() const noexcept
+  {
+    return __min_value;
+  }
+
+  //! @brief Gets the largest magnitude the relative accuracy holds for.
+  [[nodiscard]] _CCCL_API double __max_magnitude() const noexcept
+  {
+    return ::cuda::std::exp((__min_index + __num_buckets - 1) * __log_gamma);
+  }
+
+  //! @brief Gets the number of counters.
+  [[nodiscard]] _CCCL_API constexpr int __num_counters() const noexcept
+  {
+    return static_cast<int>(__counters.size());
+  }
+
+  //! @brief Gets the counters.
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::span<__counter_type> __counter_span() const noexcept
+  {
+    return __counters;
+  }
+
+  //! @brief Gets the span of the sketch.
+  [[nodiscard]] _CCCL_API ::cuda::std::span<::cuda::std::byte> __sketch_span() const noexcept
+  {
+    return ::cuda::std::span<::cuda::std::byte>(
+      reinterpret_cast<::cuda::std::byte*>(__counters.data()), __sketch_bytes());
+  }
+
+  //! @brief Gets the number of bytes of the sketch storage.
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::size_t __sketch_bytes() const noexcept
+  {
+    return __counters.size() * sizeof(__counter_type);
+  }
+
+  //! @brief Gets the number of bytes required for a sketch that holds magnitudes up to `__max_value` with the given
+  //! relative accuracy.
+  //!
+  //! @param __alpha Relative accuracy
+  //! @param __min_value Smallest magnitude that is not counted as zero
+  //! @param __max_value Largest magnitude the relative accuracy must hold for
+  [[nodiscard]] _CCCL_API static ::cuda::std::size_t
+  __sketch_bytes(::cuda::experimental::cuco::__relative_accuracy_t __alpha, double __min_value, double __max_value)
+  {
+    if (!(__alpha > 0.0 && __alpha < 1.0) || !(__min_value > 0.0) || !(__max_value >= __min_value))
+    {
+      _CCCL_THROW(::std::invalid_argument, "Invalid quantile sketch parameters");
+    }
+    const auto __log_gamma   = __log_gamma_of(__alpha);
+    const auto __num_buckets = __log_index(__max_value, __log_gamma) - __log_index(__min_value, __log_gamma) + 1;
+    // The counters of both signs must be indexable by int, which also rejects an infinite maximum value
+    if (!(__num_buckets <= static_cast<double>((::cuda::std::numeric_limits<int>::max() - 1) / 2)))
+    {
+      _CCCL_THROW(::std::invalid_argument, "Invalid quantile sketch parameters");
+    }
+    return (2 * static_cast<::cuda::std::size_t>(__num_buckets) + 1) * sizeof(__counter_type);
+  }
+
+  //! @brief Gets the alignment required for the sketch storage.
+  [[nodiscard]] _CCCL_API static constexpr ::cuda::std::size_t __sketch_alignment() noexcept
+  {
+    return alignof(__counter_type);
+  }
+
+private:
+  //! @brief Throws if `__other` has different parameters than `*this`.
+  template <::cuda::thread_scope _OtherScope>
+  _CCCL_API void __check_compatible(const __quantile_sketch_impl<_Tp, _OtherScope>& __other) const
+  {
+    if (__other.__log_gamma != __log_gamma || __other.__min_index != __min_index
+        || __other.__num_buckets != __num_buckets || __other.__min_value != __min_value)
+    {
+      _CCCL_THROW(::std::invalid_argument, "Cannot merge sketches with different parameters");
+    }
+  }
+
+  //! @brief Copies the counters to a host buffer allocated from `__host_mr`.
+  //!
+  //! @note This function synchronizes the given stream.
+  template <class _HostMemoryResource>
+  [[nodiscard]] _CCCL_HOST ::cuda::host_buffer<__counter_type>
+  __copy_to_host(_HostMemoryResource __host_mr, ::cuda::stream_ref __stream) const
+  {
+    ::cuda::host_buffer<__counter_type> __host_counters{__stream, __host_mr, __counters.size(), ::cuda::no_init};
+    ::cuda::__driver::__memcpyAsync(__host_counters.data(), __counters.data(), __sketch_bytes(), __stream.get());
+    __stream.sync();
+    return __host_counters;
+  }
+
+  //! @brief Adds `__n` values starting at `__first` to the counters at `__destination` on the host.
+  template <class _InputIt>
+  _CCCL_HOST void __add_host_range(_InputIt __first, ::cuda::std::size_t __n, __counter_type* __destination) const
+  {
+    for (::cuda::std::size_t __i = 0; __i < __n; ++__i)
+    {
+      const auto __index = __counter_index(static_cast<__value_type>(__first[__i]));
+      if (__index >= 0)
+      {
+        ++__destination[__index];
+      }
+    }
+  }
+};
+} // namespace cuda::experimental::cuco
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO___QUANTILE_SKETCH_QUANTILE_SKETCH_IMPL_CUH
@@ -0,0 +1,108 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO___UTILITY_HOST_THREADS_CUH
+#define _CUDAX___CUCO___UTILITY_HOST_THREADS_CUH
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__cstddef/types.h>
+
+#include <thread>
+#include <vector>
+
+#include <cuda/std/__cccl/prologue.h>
+
+namespace cuda::experimental::cuco
+{
+//! @brief Returns the number of host threads used to process `__num_items` items.
+//!
+//! @param __num_items Number of items to process
+//! @param __min_items_per_thread Minimum number of items that justifies an additional thread
+//! @param __max_threads Upper bound of the number of threads, or 0 for the number of hardware threads
+[[nodiscard]] _CCCL_HOST_API inline unsigned __host_thread_count(
+  ::cuda::std::size_t __num_items, ::cuda::std::size_t __min_items_per_thread, unsigned __max_threads)
+{
+  if (__max_threads == 0)
+  {
+    __max_threads = ::cuda::std::max(::std::thread::hardware_concurrency(), 1u);
+  }
+  const auto __threads =
+    ::cuda::ceil_div(__num_items, ::cuda::std::max(__min_items_per_thread, ::cuda::std::size_t{1}));
+  return static_cast<unsigned>(::cuda::std::min<::cuda::std::size_t>(__threads, __max_threads));
+}
+
+//! @brief Invokes `__fn(__t)` for every `__t` in [0, `__num_threads`), each on a thread of its own. `__fn(0)` runs
+//! on the calling thread. Returns once all invocations have returned.
+template <class _Fn>
+_CCCL_HOST_API void __run_on_host_threads(unsigned __num_threads, _Fn& __fn)
+{
+  struct __joiner
+  {
+    ::std::vector<::std::thread> __threads;
+
+    ~__joiner()
+    {
+      for (auto& __worker : __threads)
+      {
+        __worker.join();
+      }
+    }
+  } __workers;
+
+  __workers.__threads.reserve(__num_threads - 1);
+  for (unsigned __t = 1; __t < __num_threads; ++__t)
+  {
+    __workers.__threads.emplace_back([&__fn, __t] {
+      __fn(__t);
+    });
+  }
+  __fn(0u);
+}
+
+//! @brief Splits [0, `__num_items`) into `__num_threads` contiguous chunks and invokes `__fn(__begin, __end)` for
+//! every chunk, each on a thread of its own.
+//!
+//! @param __num_items Number of items to process
+//! @param __num_threads Number of threads as returned by `__host_thread_count`
+//! @param __fn Callable invoked with the bounds of every chunk
+template <class _Fn>
+_CCCL_HOST_API void __host_parallel_for(::cuda::std::size_t __num_items, unsigned __num_threads, _Fn __fn)
+{
+  if (__num_threads <= 1)
+  {
+    __fn(::cuda::std::size_t{0}, __num_items);
+    return;
+  }
+
+  const auto __items_per_thread = ::cuda::ceil_div(__num_items, ::cuda::std::size_t{__num_threads});
+  auto __run_chunk              = [&](unsigned __t) {
+    const auto __begin = ::cuda::std::min(__t * __items_per_thread, __num_items);
+    const auto __end   = ::cuda::std::min(__begin + __items_per_thread, __num_items);
+    __fn(__begin, __end);
+  };
+  ::cuda::experimental::cuco::__run_on_host_threads(__num_threads, __run_chunk);
+}
+} // namespace cuda::experimental::cuco
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO___UTILITY_HOST_THREADS_CUH
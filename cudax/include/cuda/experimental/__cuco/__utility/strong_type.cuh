@@ -61,6 +61,16 @@ struct __strong_type
     {}                                                                 \
   };
 
+//! Convenience wrapper for defining a strong type template over its underlying type
+#define CUDAX_CUCO_DEFINE_TEMPLATE_STRONG_TYPE(Name)                  \
+  template <class _Tp>                                                \
+  struct Name : public ::cuda::experimental::cuco::__strong_type<_Tp> \
+  {                                                                   \
+    _CCCL_API explicit constexpr Name(_Tp __value)                    \
+        : ::cuda::experimental::cuco::__strong_type<_Tp>(__value)     \
+    {}                                                                \
+  };
+
 #include <cuda/std/__cccl/epilogue.h>
 
 #endif // _CUDAX___CUCO___UTILITY_STRONG_TYPE_CUH
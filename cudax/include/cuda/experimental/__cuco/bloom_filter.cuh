@@ -0,0 +1,277 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO_BLOOM_FILTER_CUH
+#define _CUDAX___CUCO_BLOOM_FILTER_CUH
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/__driver/driver_api.h>
+#include <cuda/__stream/stream_ref.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__utility/forward.h>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+
+#include <cuda/experimental/__cuco/__bloom_filter/bloom_filter_impl.cuh>
+#include <cuda/experimental/__cuco/__bloom_filter/kernels.cuh>
+#include <cuda/experimental/__cuco/bloom_filter_policy.cuh>
+#include <cuda/experimental/__cuco/bloom_filter_ref.cuh>
+#include <cuda/experimental/__cuco/hash_functions.cuh>
+#include <cuda/experimental/container.cuh>
+#include <cuda/experimental/memory_resource.cuh>
+#include <cuda/experimental/stream.cuh>
+
+#include <cuda/std/__cccl/prologue.h>
+
+namespace cuda::experimental::cuco
+{
+//! @brief A GPU-accelerated blocked Bloom filter.
+//!
+//! A Bloom filter answers approximate membership queries: `contains` never returns `false` for an added key, and
+//! returns `true` for a key that was not added with a probability that decreases with the size of the filter. Every
+//! key sets the bits of its fingerprint in a single block, so that adding or querying a key touches one block.
+//!
+//! @tparam _Key Type of the keys
+//! @tparam _MemoryResource Type of memory resource used for device storage
+//! @tparam _Scope The scope in which operations will be performed by individual threads
+//! @tparam _Policy Fingerprint policy, see `default_filter_policy`
+template <class _Key,
+          class _MemoryResource       = ::cuda::device_memory_pool_ref,
+          ::cuda::thread_scope _Scope = ::cuda::thread_scope_device,
+          class _Policy               = ::cuda::experimental::cuco::default_filter_policy<
+            ::cuda::experimental::cuco::hash<_Key, ::cuda::experimental::cuco::hash_algorithm::xxhash_64>,
+            ::cuda::std::uint32_t,
+            8>>
+class bloom_filter
+{
+public:
+  using ref_type = bloom_filter_ref<_Key, _Scope, _Policy>; ///< Non-owning reference type
+
+  static constexpr auto thread_scope                     = ref_type::thread_scope; ///< CUDA thread scope
+  static constexpr ::cuda::std::uint32_t words_per_block = ref_type::words_per_block; ///< Words per block
+
+  using key_type    = typename ref_type::key_type; ///< Key type
+  using policy_type = typename ref_type::policy_type; ///< Fingerprint policy type
+  using word_type   = typename ref_type::word_type; ///< Type of the words of a block
+  using size_type   = typename ref_type::size_type; ///< Size type
+
+private:
+  using __impl_type = ::cuda::experimental::cuco::__bloom_filter_impl<_Key, _Scope, _Policy>;
+
+  //! Number of threads that cooperatively add or query a key in the bulk operations, one per word of a block
+  static constexpr int __cg_size = static_cast<int>(words_per_block < 32 ? words_per_block : 32);
+
+  //! Upper bound of the number of blocks of the bulk operation kernels, which use grid stride loops
+  static constexpr ::cuda::std::int64_t __max_grid_size = 1 << 16;
+
+  ::cuda::device_buffer<word_type> __word_buffer; ///< Storage for the filter
+  __impl_type __impl; ///< Implementation object operating on `__word_buffer`
+
+  //! @brief Returns the number of blocks used to process `__n` keys.
+  [[nodiscard]] static int __grid_size(::cuda::std::int64_t __n) noexcept
+  {
+    return static_cast<int>(::cuda::std::min(
+      ::cuda::ceil_div(__n * __cg_size, ::cuda::std::int64_t{__bloom_filter_ns::__block_size}), __max_grid_size));
+  }
+
+public:
+  //! @brief Constructs a `bloom_filter` with `__num_blocks` blocks and clears it.
+  //!
+  //! @note The filter is cleared in stream order on the given stream.
+  //!
+  //! @throw If `__num_blocks` is zero.
+  //!
+  //! @param __memory_resource A memory resource used for allocating device storage
+  //! @param __num_blocks Number of blocks of the filter
+  //! @param __policy Fingerprint policy
+  //! @param __stream CUDA stream used to initialize the object
+  template <typename _MemoryResource_ = _MemoryResource>
+  bloom_filter(_MemoryResource_&& __memory_resource,
+               size_type __num_blocks,
+               const _Policy& __policy     = _Policy{},
+               ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+      : __word_buffer{__stream,
+                      ::cuda::std::forward<_MemoryResource_>(__memory_resource),
+                      ref_type::storage_words(__num_blocks),
+                      ::cuda::no_init}
+      , __impl{::cuda::std::span{__word_buffer.data(), __word_buffer.size()}, __policy}
+  {
+    clear_async(__stream);
+  }
+
+  //! @brief Constructs a `bloom_filter` with `__num_blocks` blocks in the default memory pool of device 0 and clears
+  //! it.
+  //!
+  //! @note The filter is cleared in stream order on the given stream.
+  //!
+  //! @throw If `__num_blocks` is zero.
+  //!
+  //! @param __num_blocks Number of blocks of the filter
+  //! @param __policy Fingerprint policy
+  //! @param __stream CUDA stream used to initialize the object
+  bloom_filter(size_type __num_blocks,
+               const _Policy& __policy     = _Policy{},
+               ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+      : bloom_filter{::cuda::device_default_memory_pool(::cuda::device_ref{0}), __num_blocks, __policy, __stream}
+  {}
+
+  ~bloom_filter() = default;
+
+  bloom_filter(const bloom_filter&)            = delete;
+  bloom_filter& operator=(const bloom_filter&) = delete;
+  bloom_filter(bloom_filter&&)                 = default; ///< Move constructor
+  bloom_filter& operator=(bloom_filter&&)      = default; ///< Move-assignment operator
+
+  //! @brief Asynchronously clears all bits of the filter.
+  //!
+  //! @param __stream CUDA stream this operation is executed in
+  void clear_async(::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    ::cuda::__driver::__memsetAsync(
+      __word_buffer.data(), ::cuda::std::uint8_t{0}, __word_buffer.size() * sizeof(word_type), __stream.get());
+  }
+
+  //! @brief Clears all bits of the filter.
+  //!
+  //! @note This function synchronizes the given stream. For asynchronous execution use `clear_async`.
+  //!
+  //! @param __stream CUDA stream this operation is executed in
+  void clear(::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    clear_async(__stream);
+    __stream.sync();
+  }
+
+  //! @brief Asynchronously adds keys to the filter.
+  //!
+  //! @tparam _InputIt Device accessible random access input iterator whose value type is convertible to `key_type`
+  //!
+  //! @param __first Beginning of the sequence of keys
+  //! @param __last End of the sequence of keys
+  //! @param __stream CUDA stream this operation is executed in
+  template <class _InputIt>
+  void add_async(_InputIt __first,
+                 _InputIt __last,
+                 ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    const auto __n = static_cast<::cuda::std::int64_t>(::cuda::std::distance(__first, __last));
+    if (__n == 0)
+    {
+      return;
+    }
+    __bloom_filter_ns::__add<__cg_size>
+      <<<__grid_size(__n), __bloom_filter_ns::__block_size, 0, __stream.get()>>>(__first, __n, __impl);
+  }
+
+  //! @brief Adds keys to the filter.
+  //!
+  //! @note This function synchronizes the given stream. For asynchronous execution use `add_async`.
+  //!
+  //! @tparam _InputIt Device accessible random access input iterator whose value type is convertible to `key_type`
+  //!
+  //! @param __first Beginning of the sequence of keys
+  //! @param __last End of the sequence of keys
+  //! @param __stream CUDA stream this operation is executed in
+  template <class _InputIt>
+  void add(_InputIt __first, _InputIt __last, ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    add_async(__first, __last, __stream);
+    __stream.sync();
+  }
+
+  //! @brief Asynchronously writes whether each key of [`__first`, `__last`) may have been added to `__output_begin`.
+  //!
+  //! @tparam _InputIt Device accessible random access input iterator whose value type is convertible to `key_type`
+  //! @tparam _OutputIt Device accessible random access output iterator assignable from `bool`
+  //!
+  //! @param __first Beginning of the sequence of keys
+  //! @param __last End of the sequence of keys
+  //! @param __output_begin Beginning of the sequence of results
+  //! @param __stream CUDA stream this operation is executed in
+  template <class _InputIt, class _OutputIt>
+  void contains_async(_InputIt __first,
+                      _InputIt __last,
+                      _OutputIt __output_begin,
+                      ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}}) const
+  {
+    const auto __n = static_cast<::cuda::std::int64_t>(::cuda::std::distance(__first, __last));
+    if (__n == 0)
+    {
+      return;
+    }
+    __bloom_filter_ns::__contains<__cg_size>
+      <<<__grid_size(__n), __bloom_filter_ns::__block_size, 0, __stream.get()>>>(
+        __first, __n, __output_begin, __impl);
+  }
+
+  //! @brief Writes whether each key of [`__first`, `__last`) may have been added to `__output_begin`.
+  //!
+  //! @note This function synchronizes the given stream. For asynchronous execution use `contains_async`.
+  //!
+  //! @tparam _InputIt Device accessible random access input iterator whose value type is convertible to `key_type`
+  //! @tparam _OutputIt Device accessible random access output iterator assignable from `bool`
+  //!
+  //! @param __first Beginning of the sequence of keys
+  //! @param __last End of the sequence of keys
+  //! @param __output_begin Beginning of the sequence of results
+  //! @param __stream CUDA stream this operation is executed in
+  template <class _InputIt, class _OutputIt>
+  void contains(_InputIt __first,
+                _InputIt __last,
+                _OutputIt __output_begin,
+                ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}}) const
+  {
+    contains_async(__first, __last, __output_begin, __stream);
+    __stream.sync();
+  }
+
+  //! @brief Gets the number of blocks.
+  [[nodiscard]] size_type block_extent() const noexcept
+  {
+    return __impl.__num_blocks();
+  }
+
+  //! @brief Gets the fingerprint policy.
+  [[nodiscard]] policy_type policy() const noexcept
+  {
+    return __impl.__fingerprint_policy();
+  }
+
+  //! @brief Gets the device storage of the filter, e.g. to copy it to the host for serialization.
+  [[nodiscard]] ::cuda::std::span<word_type> storage() const noexcept
+  {
+    return __impl.__storage();
+  }
+
+  //! @brief Gets a non-owning reference to the filter.
+  //!
+  //! @return Ref object of the current `bloom_filter` object
+  [[nodiscard]] ref_type ref() const noexcept
+  {
+    return ref_type{__impl.__storage(), __impl.__fingerprint_policy()};
+  }
+};
+} // namespace cuda::experimental::cuco
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO_BLOOM_FILTER_CUH
@@ -0,0 +1,160 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO_BLOOM_FILTER_POLICY_CUH
+#define _CUDAX___CUCO_BLOOM_FILTER_POLICY_CUH
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__bit/countr.h>
+#include <cuda/std/__bit/has_single_bit.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__host_stdlib/stdexcept>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/experimental/__cuco/hash_functions.cuh>
+
+#include <cuda/std/__cccl/prologue.h>
+
+namespace cuda::experimental::cuco
+{
+//! @brief The default fingerprint policy of `bloom_filter` and `bloom_filter_ref`.
+//!
+//! A key is hashed once. The hash value selects the block of the filter and the `pattern_bits` bits that are set
+//! within the block. The bits are spread evenly over the `_WordsPerBlock` words of the block, so that every word
+//! holds at least one bit of the fingerprint.
+//!
+//! A fingerprint policy is any copyable type that provides the same members as this class: `hasher`, `word_type`,
+//! `words_per_block`, `hash(key)`, `block_index(hash, num_blocks)` and `word_pattern(hash, word_index)`.
+//!
+//! @tparam _Hash Hash function used to hash keys, e.g. `hash<_Key, hash_algorithm::xxhash_64>`
+//! @tparam _Word Type of the words of a block, `::cuda::std::uint32_t` or `::cuda::std::uint64_t`
+//! @tparam _WordsPerBlock Number of words per block, a power of two. A block is at most 128 bytes large.
+template <class _Hash, class _Word, ::cuda::std::uint32_t _WordsPerBlock>
+class default_filter_policy
+{
+  static_assert(::cuda::std::is_same_v<_Word, ::cuda::std::uint32_t>
+                  || ::cuda::std::is_same_v<_Word, ::cuda::std::uint64_t>,
+                "Word type must be uint32_t or uint64_t");
+  static_assert(::cuda::std::has_single_bit(_WordsPerBlock), "Number of words per block must be a power of two");
+  static_assert(_WordsPerBlock * sizeof(_Word) <= 128, "A block must not be larger than 128 bytes");
+
+public:
+  using hasher    = _Hash; ///< Hash function type
+  using word_type = _Word; ///< Type of the words of a block
+
+  static constexpr ::cuda::std::uint32_t words_per_block = _WordsPerBlock; ///< Number of words per block
+  static constexpr ::cuda::std::uint32_t bits_per_word   = sizeof(_Word) * 8; ///< Number of bits per word
+
+private:
+  static constexpr int __log2_bits_per_word             = ::cuda::std::countr_zero(bits_per_word);
+  static constexpr ::cuda::std::uint64_t __golden_ratio = 0x9E3779B97F4A7C15ull;
+
+  //! @brief The finalizer of SplitMix64, which maps similar inputs to unrelated outputs.
+  [[nodiscard]] _CCCL_API static constexpr ::cuda::std::uint64_t __mix(::cuda::std::uint64_t __x) noexcept
+  {
+    __x = (__x ^ (__x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    __x = (__x ^ (__x >> 27)) * 0x94D049BB133111EBull;
+    return __x ^ (__x >> 31);
+  }
+
+  _Hash __hash; ///< Hash function used to hash keys
+  ::cuda::std::uint32_t __pattern_bits; ///< Number of bits set per key
+
+public:
+  //! @brief Constructs the policy.
+  //!
+  //! @throw If `__pattern_bits` is outside [`words_per_block`, `words_per_block * bits_per_word`].
+  //!
+  //! @param __pattern_bits Number of bits set per key
+  //! @param __hash The hash function used to hash keys
+  _CCCL_API constexpr explicit default_filter_policy(::cuda::std::uint32_t __pattern_bits = words_per_block,
+                                                     const _Hash& __hash                  = {})
+      : __hash{__hash}
+      , __pattern_bits{__pattern_bits}
+  {
+    if (__pattern_bits < words_per_block || __pattern_bits > words_per_block * bits_per_word)
+    {
+      _CCCL_THROW(::std::invalid_argument, "Number of pattern bits must be in [words_per_block, block bits]");
+    }
+  }
+
+  //! @brief Hashes a key.
+  template <class _Key>
+  [[nodiscard]] _CCCL_API constexpr auto hash(const _Key& __key) const noexcept
+  {
+    return __hash(__key);
+  }
+
+  //! @brief Returns the index of the block a hash value belongs to.
+  //!
+  //! @param __hash_value Hash value of a key
+  //! @param __num_blocks Number of blocks of the filter
+  template <class _HashValue>
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::size_t
+  block_index(_HashValue __hash_value, ::cuda::std::size_t __num_blocks) const noexcept
+  {
+    return static_cast<::cuda::std::size_t>(__hash_value % __num_blocks);
+  }
+
+  //! @brief Returns the bits of the fingerprint of a hash value that fall into the given word of its block.
+  //!
+  //! @param __hash_value Hash value of a key
+  //! @param __word_index Index of the word within the block
+  template <class _HashValue>
+  [[nodiscard]] _CCCL_API constexpr word_type
+  word_pattern(_HashValue __hash_value, ::cuda::std::uint32_t __word_index) const noexcept
+  {
+    const auto __num_bits =
+      __pattern_bits / words_per_block + (__word_index < __pattern_bits % words_per_block ? 1 : 0);
+
+    // Every word draws its bit positions from a mixed value of its own, consuming `__log2_bits_per_word` bits of it
+    // per position and remixing once they are used up
+    constexpr ::cuda::std::uint32_t __positions_per_mix = 64 / __log2_bits_per_word;
+    auto __mixed = __mix(static_cast<::cuda::std::uint64_t>(__hash_value) + (__word_index + 1) * __golden_ratio);
+    word_type __pattern = 0;
+    for (::cuda::std::uint32_t __i = 0; __i < __num_bits; ++__i)
+    {
+      const auto __slot = __i % __positions_per_mix;
+      if (__i != 0 && __slot == 0)
+      {
+        __mixed = __mix(__mixed + __golden_ratio);
+      }
+      __pattern |= word_type{1} << ((__mixed >> (__slot * __log2_bits_per_word)) & (bits_per_word - 1));
+    }
+    return __pattern;
+  }
+
+  //! @brief Gets the number of bits set per key.
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::uint32_t pattern_bits() const noexcept
+  {
+    return __pattern_bits;
+  }
+
+  //! @brief Gets the hash function.
+  [[nodiscard]] _CCCL_API constexpr hasher hash_function() const noexcept
+  {
+    return __hash;
+  }
+};
+} // namespace cuda::experimental::cuco
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO_BLOOM_FILTER_POLICY_CUH
@@ -0,0 +1,221 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO_BLOOM_FILTER_REF_CUH
+#define _CUDAX___CUCO_BLOOM_FILTER_REF_CUH
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+
+#include <cuda/experimental/__cuco/__bloom_filter/bloom_filter_impl.cuh>
+#include <cuda/experimental/__cuco/bloom_filter_policy.cuh>
+#include <cuda/experimental/__cuco/hash_functions.cuh>
+
+#include <cuda/std/__cccl/prologue.h>
+
+namespace cuda::experimental::cuco
+{
+//! @brief A non-owning reference to a blocked Bloom filter.
+//!
+//! The filter is an array of blocks of `words_per_block` words. A key sets the bits of its fingerprint in a single
+//! block, so that adding or querying a key touches one block, which is at most a cache line large.
+//!
+//! @note If the storage is host accessible, the `*_host` member functions operate on it without a CUDA stream or
+//! device. The layout of the storage is the same on host and device: `storage()` can be copied to serialize the
+//! filter, and a filter built on the host can be queried on the device and vice versa.
+//!
+//! @tparam _Key Type of the keys
+//! @tparam _Scope The scope in which operations will be performed by individual threads
+//! @tparam _Policy Fingerprint policy, see `default_filter_policy`
+template <class _Key,
+          ::cuda::thread_scope _Scope = ::cuda::thread_scope_device,
+          class _Policy               = ::cuda::experimental::cuco::default_filter_policy<
+            ::cuda::experimental::cuco::hash<_Key, ::cuda::experimental::cuco::hash_algorithm::xxhash_64>,
+            ::cuda::std::uint32_t,
+            8>>
+class bloom_filter_ref
+{
+  using __impl_type = ::cuda::experimental::cuco::__bloom_filter_impl<_Key, _Scope, _Policy>;
+
+  __impl_type __impl; ///< Implementation object
+
+  // Needs to be friends with other instantiations of this class template to have access to their storage
+  template <class _Key_, ::cuda::thread_scope _Scope_, class _Policy_>
+  friend class bloom_filter_ref;
+
+public:
+  static constexpr auto thread_scope                     = __impl_type::__thread_scope; ///< CUDA thread scope
+  static constexpr ::cuda::std::uint32_t words_per_block = __impl_type::__words_per_block; ///< Words per block
+
+  using key_type    = _Key; ///< Key type
+  using policy_type = _Policy; ///< Fingerprint policy type
+  using word_type   = typename __impl_type::__word_type; ///< Type of the words of a block
+  using size_type   = typename __impl_type::__size_type; ///< Size type
+
+  template <::cuda::thread_scope _NewScope>
+  using with_scope = bloom_filter_ref<_Key, _NewScope, _Policy>; ///< Ref type with different thread scope
+
+  //! @brief Constructs a `bloom_filter_ref` over the given storage.
+  //!
+  //! @note The storage must be initialized, e.g. with `clear_host` or by the owning `bloom_filter`.
+  //!
+  //! @throw If the storage is empty, its size is not a multiple of `words_per_block` or it is not aligned to the size
+  //! of a block.
+  //!
+  //! @param __storage Reference to the filter storage, see `storage_words`
+  //! @param __policy Fingerprint policy
+  _CCCL_API constexpr bloom_filter_ref(::cuda::std::span<word_type> __storage, const _Policy& __policy = _Policy{})
+      : __impl{__storage, __policy}
+  {}
+
+  //! @brief Adds a key to the filter.
+  //!
+  //! @param __key The key to add
+  _CCCL_API void add(const key_type& __key) const noexcept
+  {
+    __impl.__add(__key);
+  }
+
+  //! @brief Cooperatively adds a key to the filter, each thread of the group setting the bits of different words.
+  //!
+  //! @tparam _CG Cooperative group type of at most `words_per_block` threads
+  //!
+  //! @param __group The cooperative group this operation is executed in
+  //! @param __key The key to add
+  template <class _CG>
+  _CCCL_DEVICE void add(const _CG& __group, const key_type& __key) const noexcept
+  {
+    __impl.__add(__group, __key);
+  }
+
+  //! @brief Returns whether a key may have been added to the filter.
+  //!
+  //! @param __key The key to query
+  //!
+  //! @return `false` if the key has definitely not been added, `true` otherwise
+  [[nodiscard]] _CCCL_API bool contains(const key_type& __key) const noexcept
+  {
+    return __impl.__contains(__key);
+  }
+
+  //! @brief Cooperatively returns whether a key may have been added to the filter, each thread of the group testing
+  //! different words.
+  //!
+  //! @tparam _CG Cooperative group type of at most `words_per_block` threads
+  //!
+  //! @param __group The cooperative group this operation is executed in
+  //! @param __key The key to query
+  //!
+  //! @return `false` if the key has definitely not been added, `true` otherwise
+  template <class _CG>
+  [[nodiscard]] _CCCL_DEVICE bool contains(const _CG& __group, const key_type& __key) const noexcept
+  {
+    return __impl.__contains(__group, __key);
+  }
+
+  //! @brief Clears all bits of the filter on the host.
+  //!
+  //! @param __max_threads Upper bound of the number of host threads, or 0 for the number of hardware threads
+  _CCCL_HOST void clear_host(unsigned __max_threads = 0) const
+  {
+    __impl.__clear_host(__max_threads);
+  }
+
+  //! @brief Adds keys to the filter on the host, in parallel on up to `__max_threads` threads.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator whose value type is convertible to `key_type`
+  //!
+  //! @param __first Beginning of the sequence of keys
+  //! @param __last End of the sequence of keys
+  //! @param __max_threads Upper bound of the number of host threads, or 0 for the number of hardware threads
+  template <class _InputIt>
+  _CCCL_HOST void add_host(_InputIt __first, _InputIt __last, unsigned __max_threads = 0) const
+  {
+    __impl.__add_host(__first, __last, __max_threads);
+  }
+
+  //! @brief Writes whether each key of [`__first`, `__last`) may have been added to `__output_begin`, in parallel on
+  //! up to `__max_threads` host threads.
+  //!
+  //! @note This function must not run concurrently with additions to the filter.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator whose value type is convertible to `key_type`
+  //! @tparam _OutputIt Host accessible random access output iterator assignable from `bool`
+  //!
+  //! @param __first Beginning of the sequence of keys
+  //! @param __last End of the sequence of keys
+  //! @param __output_begin Beginning of the sequence of results
+  //! @param __max_threads Upper bound of the number of host threads, or 0 for the number of hardware threads
+  template <class _InputIt, class _OutputIt>
+  _CCCL_HOST void
+  contains_host(_InputIt __first, _InputIt __last, _OutputIt __output_begin, unsigned __max_threads = 0) const
+  {
+    __impl.__contains_host(__first, __last, __output_begin, __max_threads);
+  }
+
+  //! @brief Merges the keys of another filter into this filter on the host.
+  //!
+  //! @note Both filters must use the same fingerprint policy, e.g. the same number of pattern bits.
+  //!
+  //! @throw If the filters have different numbers of blocks.
+  //!
+  //! @tparam _OtherScope Thread scope of the other filter
+  //!
+  //! @param __other Filter to merge into this filter
+  template <::cuda::thread_scope _OtherScope>
+  _CCCL_HOST void merge_host(const bloom_filter_ref<_Key, _OtherScope, _Policy>& __other) const
+  {
+    __impl.__merge_host(__other.__impl);
+  }
+
+  //! @brief Returns the number of words of a filter with `__num_blocks` blocks.
+  //!
+  //! @param __num_blocks Number of blocks
+  //!
+  //! @return Number of words
+  [[nodiscard]] _CCCL_API static constexpr size_type storage_words(size_type __num_blocks) noexcept
+  {
+    return __impl_type::__storage_words(__num_blocks);
+  }
+
+  //! @brief Gets the number of blocks.
+  [[nodiscard]] _CCCL_API constexpr size_type block_extent() const noexcept
+  {
+    return __impl.__num_blocks();
+  }
+
+  //! @brief Gets the filter storage.
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::span<word_type> storage() const noexcept
+  {
+    return __impl.__storage();
+  }
+
+  //! @brief Gets the fingerprint policy.
+  [[nodiscard]] _CCCL_API constexpr policy_type policy() const noexcept
+  {
+    return __impl.__fingerprint_policy();
+  }
+};
+} // namespace cuda::experimental::cuco
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO_BLOOM_FILTER_REF_CUH
@@ -40,6 +40,9 @@ namespace cuda::experimental::cuco
 //! @note This implementation is based on the HyperLogLog++ algorithm:
 //! https://static.googleusercontent.com/media/research.google.com/de//pubs/archive/40671.pdf.
 //!
+//! @note If the sketch storage is host accessible, the `*_host` member functions operate on it without a CUDA
+//! stream or device. The binary layout of the sketch is the same on host and device.
+//!
 //! @tparam _Tp Type of items to count
 //! @tparam _Scope The scope in which operations will be performed by individual threads
 //! @tparam _Hash Hash function used to hash items
@@ -251,6 +254,59 @@ public:
     return __impl.__estimate(__host_mr, __stream);
   }
 
+  //! @brief Resets the estimator on the host, i.e., clears the current count estimate.
+  //!
+  //! @note The sketch storage must be host accessible. No CUDA stream is involved.
+  _CCCL_HOST void clear_host() noexcept
+  {
+    __impl.__clear_host();
+  }
+
+  //! @brief Adds to be counted items to the estimator on the host.
+  //!
+  //! The items are hashed and counted by up to `__max_threads` host threads. The resulting sketch is identical to
+  //! the one computed by `add` on a device, so sketches may be built on either side and merged.
+  //!
+  //! @note The sketch storage must be host accessible. No CUDA stream is involved.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator where
+  //! <tt>std::is_convertible<std::iterator_traits<_InputIt>::value_type,
+  //! _Tp></tt> is `true`
+  //!
+  //! @param __first Beginning of the sequence of items
+  //! @param __last End of the sequence of items
+  //! @param __max_threads Upper bound of the number of host threads, or 0 for the number of hardware threads
+  template <class _InputIt>
+  _CCCL_HOST void add_host(_InputIt __first, _InputIt __last, unsigned __max_threads = 0)
+  {
+    __impl.__add_host(__first, __last, __max_threads);
+  }
+
+  //! @brief Merges the result of `other` estimator reference into `*this` estimator on the host.
+  //!
+  //! @note The sketch storage of both estimators must be host accessible. No CUDA stream is involved.
+  //!
+  //! @throw If sketch_bytes() != __other.sketch_bytes()
+  //!
+  //! @tparam _OtherScope Thread scope of `other` estimator
+  //!
+  //! @param __other Other estimator reference to be merged into `*this`
+  template <::cuda::thread_scope _OtherScope>
+  _CCCL_HOST void merge_host(const hyperloglog_ref<_Tp, _OtherScope, _Hash>& __other)
+  {
+    __impl.__merge_host(__other.__impl);
+  }
+
+  //! @brief Compute the estimated distinct items count on the host.
+  //!
+  //! @note The sketch storage must be host accessible. No CUDA stream is involved.
+  //!
+  //! @return Approximate distinct items count
+  [[nodiscard]] _CCCL_HOST ::cuda::std::size_t estimate_host() const noexcept
+  {
+    return __impl.__estimate_host();
+  }
+
   //! @brief Gets the hash function.
   //!
   //! @return The hash function
@@ -0,0 +1,182 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO_PROBING_SCHEME_CUH
+#define _CUDAX___CUCO_PROBING_SCHEME_CUH
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cstddef/types.h>
+
+#include <cuda/experimental/__cuco/hash_functions.cuh>
+
+#include <cuda/std/__cccl/prologue.h>
+
+namespace cuda::experimental::cuco
+{
+//! @brief Iterator over the sequence of windows an open addressing probe visits.
+//!
+//! A window is the group of `cg_size * bucket_size` consecutive slots that are inspected at once by a probe.
+class __probing_iterator
+{
+  ::cuda::std::size_t __curr; ///< Index of the current window
+  ::cuda::std::size_t __step; ///< Distance between two consecutive windows
+  ::cuda::std::size_t __upper; ///< Number of windows
+
+public:
+  //! @brief Constructs a probing iterator.
+  //!
+  //! @param __start Index of the first window, in [0, `__upper`)
+  //! @param __step Distance between two consecutive windows, in [1, `__upper`]
+  //! @param __upper Number of windows
+  _CCCL_API constexpr __probing_iterator(
+    ::cuda::std::size_t __start, ::cuda::std::size_t __step, ::cuda::std::size_t __upper) noexcept
+      : __curr{__start}
+      , __step{__step}
+      , __upper{__upper}
+  {}
+
+  //! @brief Returns the index of the current window.
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::size_t operator*() const noexcept
+  {
+    return __curr;
+  }
+
+  //! @brief Advances to the next window of the sequence.
+  _CCCL_API constexpr __probing_iterator& operator++() noexcept
+  {
+    // Both summands are below __upper, so the sum does not overflow
+    __curr = (__curr + __step) % __upper;
+    return *this;
+  }
+};
+
+//! @brief Linear probing scheme: a probe visits consecutive windows starting at the hash of the key.
+//!
+//! @note Linear probing is efficient when few collisions are expected, e.g. for well distributed keys at low load
+//! factors. Otherwise `double_hashing` is more robust.
+//!
+//! @tparam _CGSize Number of threads of a cooperative group that probe a window together
+//! @tparam _Hash Hash function used to compute the first window
+template <int _CGSize, class _Hash>
+class linear_probing
+{
+  static_assert(_CGSize > 0 && (_CGSize & (_CGSize - 1)) == 0 && _CGSize <= 32,
+                "The cooperative group size must be a power of two not greater than 32");
+
+  _Hash __hash; ///< Hash function
+
+public:
+  static constexpr int cg_size = _CGSize; ///< Cooperative group size
+  using hasher                 = _Hash; ///< Hash function type
+
+  //! @brief Constructs a linear probing scheme.
+  //!
+  //! @param __hash Hash function used to compute the first window
+  _CCCL_API constexpr linear_probing(const _Hash& __hash = {})
+      : __hash{__hash}
+  {}
+
+  //! @brief Returns the sequence of windows probed for `__key`.
+  //!
+  //! @tparam _ProbeKey Type of the probe key
+  //!
+  //! @param __key The probe key
+  //! @param __num_windows Number of windows of the container
+  //!
+  //! @return Iterator over the probed windows
+  template <class _ProbeKey>
+  [[nodiscard]] _CCCL_API constexpr __probing_iterator
+  operator()(const _ProbeKey& __key, ::cuda::std::size_t __num_windows) const
+  {
+    return {static_cast<::cuda::std::size_t>(__hash(__key)) % __num_windows, 1, __num_windows};
+  }
+
+  //! @brief Gets the hash function.
+  //!
+  //! @return The hash function
+  [[nodiscard]] _CCCL_API constexpr hasher hash_function() const noexcept
+  {
+    return __hash;
+  }
+};
+
+//! @brief Double hashing probing scheme: the first hash of the key selects the first window and the second hash the
+//! distance between two consecutive windows.
+//!
+//! @note Double hashing spreads colliding keys over the whole container, which keeps probe sequences short for
+//! skewed keys or high load factors. Every window is visited only if the number of windows is prime, which the
+//! containers' `storage_size` guarantees.
+//!
+//! @tparam _CGSize Number of threads of a cooperative group that probe a window together
+//! @tparam _Hash1 Hash function used to compute the first window
+//! @tparam _Hash2 Hash function used to compute the step size
+template <int _CGSize, class _Hash1, class _Hash2 = _Hash1>
+class double_hashing
+{
+  static_assert(_CGSize > 0 && (_CGSize & (_CGSize - 1)) == 0 && _CGSize <= 32,
+                "The cooperative group size must be a power of two not greater than 32");
+
+  _Hash1 __hash1; ///< Hash function of the first window
+  _Hash2 __hash2; ///< Hash function of the step size
+
+public:
+  static constexpr int cg_size = _CGSize; ///< Cooperative group size
+  using hasher                 = _Hash1; ///< Type of the first hash function
+
+  //! @brief Constructs a double hashing probing scheme.
+  //!
+  //! @param __hash1 Hash function used to compute the first window
+  //! @param __hash2 Hash function used to compute the step size, by default `_Hash2` with seed 1 so that both hashes
+  //! differ
+  _CCCL_API constexpr double_hashing(const _Hash1& __hash1 = {}, const _Hash2& __hash2 = _Hash2{1})
+      : __hash1{__hash1}
+      , __hash2{__hash2}
+  {}
+
+  //! @brief Returns the sequence of windows probed for `__key`.
+  //!
+  //! @tparam _ProbeKey Type of the probe key
+  //!
+  //! @param __key The probe key
+  //! @param __num_windows Number of windows of the container
+  //!
+  //! @return Iterator over the probed windows
+  template <class _ProbeKey>
+  [[nodiscard]] _CCCL_API constexpr __probing_iterator
+  operator()(const _ProbeKey& __key, ::cuda::std::size_t __num_windows) const
+  {
+    const auto __start = static_cast<::cuda::std::size_t>(__hash1(__key)) % __num_windows;
+    const auto __step =
+      __num_windows > 1 ? static_cast<::cuda::std::size_t>(__hash2(__key)) % (__num_windows - 1) + 1 : 1;
+    return {__start, __step, __num_windows};
+  }
+
+  //! @brief Gets the hash function.
+  //!
+  //! @return The hash function used to compute the first window
+  [[nodiscard]] _CCCL_API constexpr hasher hash_function() const noexcept
+  {
+    return __hash1;
+  }
+};
+} // namespace cuda::experimental::cuco
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO_PROBING_SCHEME_CUH
@@ -0,0 +1,388 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO_QUANTILE_SKETCH_CUH
+#define _CUDAX___CUCO_QUANTILE_SKETCH_CUH
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__stream/stream_ref.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__utility/forward.h>
+#include <cuda/std/span>
+
+#include <cuda/experimental/__cuco/quantile_sketch_ref.cuh>
+#include <cuda/experimental/container.cuh>
+#include <cuda/experimental/memory_resource.cuh>
+#include <cuda/experimental/stream.cuh>
+
+#include <cuda/std/__cccl/prologue.h>
+
+namespace cuda::experimental::cuco
+{
+//! @brief A GPU-accelerated, mergeable sketch for approximating the quantiles of a multiset of values.
+//!
+//! See `quantile_sketch_ref` for the error bounds.
+//!
+//! @tparam _Tp Type of the values, an arithmetic type
+//! @tparam _MemoryResource Type of memory resource used for device storage
+//! @tparam _Scope The scope in which operations will be performed by individual threads
+template <class _Tp,
+          class _MemoryResource       = ::cuda::device_memory_pool_ref,
+          ::cuda::thread_scope _Scope = ::cuda::thread_scope_device>
+class quantile_sketch
+{
+public:
+  static constexpr auto thread_scope = _Scope; ///< CUDA thread scope
+
+  template <::cuda::thread_scope _NewScope = thread_scope>
+  using ref_type = quantile_sketch_ref<_Tp, _NewScope>; ///< Non-owning reference type
+
+  using value_type   = typename ref_type<>::value_type; ///< Type of the values
+  using counter_type = typename ref_type<>::counter_type; ///< Type of the counters
+
+  //! A strong type wrapper `relative_accuracy` of `double`, for specifying the relative accuracy of the values
+  //! returned by `cuda::experimental::cuco::quantile_sketch(_ref)`.
+  //!
+  //! @note Valid relative accuracies are in (0, 1). The sketch size grows with `1 / relative_accuracy`.
+  using relative_accuracy = ::cuda::experimental::cuco::__relative_accuracy_t;
+
+private:
+  ::cuda::device_buffer<counter_type> __sketch_buffer; ///< Storage for sketch
+  ref_type<> __ref; ///< Device ref of the current `quantile_sketch` object
+
+  // Needs to be friends with other instantiations of this class template to have access to their storage
+  template <class _Tp_, class _MemoryResource_, ::cuda::thread_scope _Scope_>
+  friend class quantile_sketch;
+
+public:
+  //! @brief Constructs a `quantile_sketch` host object.
+  //!
+  //! @note The sketch is cleared in stream order on the given stream.
+  //!
+  //! @throw If the relative accuracy is not in (0, 1), the minimum value is not positive or the maximum value is
+  //! smaller than the minimum value.
+  //!
+  //! @param __memory_resource A memory resource used for allocating device storage
+  //! @param __alpha Relative accuracy
+  //! @param __min_value Smallest magnitude that is not represented by zero
+  //! @param __max_value Largest magnitude the relative accuracy must hold for
+  //! @param __stream CUDA stream used to initialize the object
+  template <typename _MemoryResource_ = _MemoryResource>
+  quantile_sketch(_MemoryResource_&& __memory_resource,
+                  relative_accuracy __alpha   = relative_accuracy{0.01},
+                  double __min_value          = 1e-9,
+                  double __max_value          = 1e9,
+                  ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+      : __sketch_buffer{__stream,
+                        ::cuda::std::forward<_MemoryResource_>(__memory_resource),
+                        ref_type<>::sketch_bytes(__alpha, __min_value, __max_value) / sizeof(counter_type),
+                        ::cuda::no_init}
+      , __ref{::cuda::std::as_writable_bytes(::cuda::std::span{__sketch_buffer.data(), __sketch_buffer.size()}),
+              __alpha,
+              __min_value}
+  {
+    clear_async(__stream);
+  }
+
+  //! @brief Constructs a `quantile_sketch` host object in the default memory pool of device 0.
+  //!
+  //! @note The sketch is cleared in stream order on the given stream.
+  //!
+  //! @throw If the relative accuracy is not in (0, 1), the minimum value is not positive or the maximum value is
+  //! smaller than the minimum value.
+  //!
+  //! @param __alpha Relative accuracy
+  //! @param __min_value Smallest magnitude that is not represented by zero
+  //! @param __max_value Largest magnitude the relative accuracy must hold for
+  //! @param __stream CUDA stream used to initialize the object
+  quantile_sketch(relative_accuracy __alpha   = relative_accuracy{0.01},
+                  double __min_value          = 1e-9,
+                  double __max_value          = 1e9,
+                  ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+      : quantile_sketch{
+          ::cuda::device_default_memory_pool(::cuda::device_ref{0}), __alpha, __min_value, __max_value, __stream}
+  {}
+
+  ~quantile_sketch() = default;
+
+  quantile_sketch(const quantile_sketch&)            = delete;
+  quantile_sketch& operator=(const quantile_sketch&) = delete;
+  quantile_sketch(quantile_sketch&&)                 = default; ///< Move constructor
+  quantile_sketch& operator=(quantile_sketch&&)      = default; ///< Move-assignment operator
+
+  //! @brief Asynchronously resets the sketch.
+  //!
+  //! @param __stream CUDA stream this operation is executed in
+  void clear_async(::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    __ref.clear_async(__stream);
+  }
+
+  //! @brief Resets the sketch.
+  //!
+  //! @note This function synchronizes the given stream. For asynchronous execution use `clear_async`.
+  //!
+  //! @param __stream CUDA stream this operation is executed in
+  void clear(::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    __ref.clear(__stream);
+  }
+
+  //! @brief Asynchronously adds values to the sketch. NaN values are ignored.
+  //!
+  //! @tparam _InputIt Device accessible random access input iterator where
+  //! <tt>std::is_convertible<std::iterator_traits<_InputIt>::value_type,
+  //! _Tp></tt> is `true`
+  //!
+  //! @param __first Beginning of the sequence of values
+  //! @param __last End of the sequence of values
+  //! @param __stream CUDA stream this operation is executed in
+  template <class _InputIt>
+  void
+  add_async(_InputIt __first, _InputIt __last, ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    __ref.add_async(__first, __last, __stream);
+  }
+
+  //! @brief Adds values to the sketch. NaN values are ignored.
+  //!
+  //! @note This function synchronizes the given stream. For asynchronous execution use `add_async`.
+  //!
+  //! @tparam _InputIt Device accessible random access input iterator where
+  //! <tt>std::is_convertible<std::iterator_traits<_InputIt>::value_type,
+  //! _Tp></tt> is `true`
+  //!
+  //! @param __first Beginning of the sequence of values
+  //! @param __last End of the sequence of values
+  //! @param __stream CUDA stream this operation is executed in
+  template <class _InputIt>
+  void add(_InputIt __first, _InputIt __last, ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    __ref.add(__first, __last, __stream);
+  }
+
+  //! @brief Asynchronously merges the values of the `other` sketch into `*this` sketch.
+  //!
+  //! @throw If the sketches have different parameters
+  //!
+  //! @tparam _OtherScope Thread scope of `other` sketch
+  //! @tparam _OtherMemoryResource Memory resource type of `other` sketch
+  //!
+  //! @param __other Other sketch to be merged into `*this`
+  //! @param __stream CUDA stream this operation is executed in
+  template <::cuda::thread_scope _OtherScope, class _OtherMemoryResource>
+  void merge_async(const quantile_sketch<_Tp, _OtherMemoryResource, _OtherScope>& __other,
+                   ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    __ref.merge_async(__other.__ref, __stream);
+  }
+
+  //! @brief Merges the values of the `other` sketch into `*this` sketch.
+  //!
+  //! @note This function synchronizes the given stream. For asynchronous execution use `merge_async`.
+  //!
+  //! @throw If the sketches have different parameters
+  //!
+  //! @tparam _OtherScope Thread scope of `other` sketch
+  //! @tparam _OtherMemoryResource Memory resource type of `other` sketch
+  //!
+  //! @param __other Other sketch to be merged into `*this`
+  //! @param __stream CUDA stream this operation is executed in
+  template <::cuda::thread_scope _OtherScope, class _OtherMemoryResource>
+  void merge(const quantile_sketch<_Tp, _OtherMemoryResource, _OtherScope>& __other,
+             ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    __ref.merge(__other.__ref, __stream);
+  }
+
+  //! @brief Asynchronously merges the values of the `other` sketch reference into `*this` sketch.
+  //!
+  //! @throw If the sketches have different parameters
+  //!
+  //! @tparam _OtherScope Thread scope of `other` sketch
+  //!
+  //! @param __other_ref Other sketch reference to be merged into `*this`
+  //! @param __stream CUDA stream this operation is executed in
+  template <::cuda::thread_scope _OtherScope>
+  void merge_async(const ref_type<_OtherScope>& __other_ref,
+                   ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    __ref.merge_async(__other_ref, __stream);
+  }
+
+  //! @brief Merges the values of the `other` sketch reference into `*this` sketch.
+  //!
+  //! @note This function synchronizes the given stream. For asynchronous execution use `merge_async`.
+  //!
+  //! @throw If the sketches have different parameters
+  //!
+  //! @tparam _OtherScope Thread scope of `other` sketch
+  //!
+  //! @param __other_ref Other sketch reference to be merged into `*this`
+  //! @param __stream CUDA stream this operation is executed in
+  template <::cuda::thread_scope _OtherScope>
+  void merge(const ref_type<_OtherScope>& __other_ref,
+             ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    __ref.merge(__other_ref, __stream);
+  }
+
+  //! @brief Returns the number of added values.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @param __host_mr Host memory resource used for copying the sketch
+  //! @param __stream CUDA stream this operation is executed in
+  //!
+  //! @return Number of added values
+  template <typename _HostMemoryResource = ::cuda::mr::legacy_pinned_memory_resource>
+  [[nodiscard]] counter_type count(
+    _HostMemoryResource __host_mr = {}, ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}}) const
+  {
+    return __ref.count(__host_mr, __stream);
+  }
+
+  //! @brief Computes the approximate `__q`-quantile of the added values, see `quantile_sketch_ref::quantile`.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @param __q Quantile in [0, 1]
+  //! @param __host_mr Host memory resource used for copying the sketch
+  //! @param __stream CUDA stream this operation is executed in
+  //!
+  //! @return Approximate quantile, or NaN if the sketch is empty or `__q` is not in [0, 1]
+  template <typename _HostMemoryResource = ::cuda::mr::legacy_pinned_memory_resource>
+  [[nodiscard]] double quantile(double __q,
+                                _HostMemoryResource __host_mr = {},
+                                ::cuda::stream_ref __stream   = ::cuda::stream_ref{cudaStream_t{nullptr}}) const
+  {
+    return __ref.quantile(__q, __host_mr, __stream);
+  }
+
+  //! @brief Computes the approximate quantiles of several probabilities with a single copy of the sketch.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @tparam _InputIt Host accessible input iterator whose value type is convertible to `double`
+  //! @tparam _OutputIt Host accessible output iterator assignable from `double`
+  //!
+  //! @param __first Beginning of the sequence of quantiles in [0, 1]
+  //! @param __last End of the sequence of quantiles
+  //! @param __output_begin Beginning of the sequence of approximate quantile values
+  //! @param __host_mr Host memory resource used for copying the sketch
+  //! @param __stream CUDA stream this operation is executed in
+  template <class _InputIt, class _OutputIt, typename _HostMemoryResource = ::cuda::mr::legacy_pinned_memory_resource>
+  void quantiles(_InputIt __first,
+                 _InputIt __last,
+                 _OutputIt __output_begin,
+                 _HostMemoryResource __host_mr = {},
+                 ::cuda::stream_ref __stream   = ::cuda::stream_ref{cudaStream_t{nullptr}}) const
+  {
+    __ref.quantiles(__first, __last, __output_begin, __host_mr, __stream);
+  }
+
+  //! @brief Computes the approximate number of added values that are less than or equal to `__value`, see
+  //! `quantile_sketch_ref::rank`.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @param __value The value to rank
+  //! @param __host_mr Host memory resource used for copying the sketch
+  //! @param __stream CUDA stream this operation is executed in
+  //!
+  //! @return Approximate rank of `__value`, or zero if `__value` is NaN
+  template <typename _HostMemoryResource = ::cuda::mr::legacy_pinned_memory_resource>
+  [[nodiscard]] counter_type rank(const _Tp& __value,
+                                  _HostMemoryResource __host_mr = {},
+                                  ::cuda::stream_ref __stream   = ::cuda::stream_ref{cudaStream_t{nullptr}}) const
+  {
+    return __ref.rank(__value, __host_mr, __stream);
+  }
+
+  //! @brief Get device ref.
+  //!
+  //! @return Device ref object of the current `quantile_sketch` host object
+  [[nodiscard]] ref_type<> ref() const noexcept
+  {
+    return __ref;
+  }
+
+  //! @brief Gets the relative accuracy.
+  [[nodiscard]] double accuracy() const noexcept
+  {
+    return __ref.accuracy();
+  }
+
+  //! @brief Gets the smallest magnitude that is not represented by zero.
+  [[nodiscard]] double min_value() const noexcept
+  {
+    return __ref.min_value();
+  }
+
+  //! @brief Gets the largest magnitude the relative accuracy holds for.
+  [[nodiscard]] double max_value() const noexcept
+  {
+    return __ref.max_value();
+  }
+
+  //! @brief Gets the span of the sketch.
+  //!
+  //! @return The ::cuda::std::span of the sketch
+  [[nodiscard]] ::cuda::std::span<::cuda::std::byte> sketch() const noexcept
+  {
+    return __ref.sketch();
+  }
+
+  //! @brief Gets the number of bytes required for the sketch storage.
+  //!
+  //! @return The number of bytes required for the sketch
+  [[nodiscard]] ::cuda::std::size_t sketch_bytes() const noexcept
+  {
+    return __ref.sketch_bytes();
+  }
+
+  //! @brief Gets the number of bytes required for the sketch storage.
+  //!
+  //! @throw If the relative accuracy is not in (0, 1), the minimum value is not positive or the maximum value is
+  //! smaller than the minimum value.
+  //!
+  //! @param __alpha Relative accuracy
+  //! @param __min_value Smallest magnitude that is not represented by zero
+  //! @param __max_value Largest magnitude the relative accuracy must hold for
+  //!
+  //! @return The number of bytes required for the sketch
+  [[nodiscard]] static ::cuda::std::size_t
+  sketch_bytes(relative_accuracy __alpha, double __min_value = 1e-9, double __max_value = 1e9)
+  {
+    return ref_type<>::sketch_bytes(__alpha, __min_value, __max_value);
+  }
+
+  //! @brief Gets the alignment required for the sketch storage.
+  //!
+  //! @return The required alignment
+  [[nodiscard]] static constexpr ::cuda::std::size_t sketch_alignment() noexcept
+  {
+    return ref_type<>::sketch_alignment();
+  }
+};
+} // namespace cuda::experimental::cuco
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO_QUANTILE_SKETCH_CUH
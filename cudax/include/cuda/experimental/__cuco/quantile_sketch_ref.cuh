@@ -0,0 +1,437 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO_QUANTILE_SKETCH_REF_CUH
+#define _CUDAX___CUCO_QUANTILE_SKETCH_REF_CUH
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__memory_resource/legacy_pinned_memory_resource.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+#include <cuda/stream>
+
+#include <cuda/experimental/__cuco/__quantile_sketch/quantile_sketch_impl.cuh>
+
+#include <cuda/std/__cccl/prologue.h>
+
+namespace cuda::experimental::cuco
+{
+//! @brief A non-owning reference to a mergeable sketch for approximating the quantiles of a multiset of values.
+//!
+//! The sketch counts values in logarithmically sized buckets, as in DDSketch: https://arxiv.org/abs/1908.10693. With
+//! relative accuracy `alpha`, every value `x` whose magnitude is in [`min_value()`, `max_value()`] is represented by a
+//! value `y` with `|y - x| <= alpha * |x|`. Hence `quantile(q)` is within `alpha * |x_q|` of the exact quantile `x_q`,
+//! for any data distribution and regardless of how the values were split among merged sketches. Magnitudes below
+//! `min_value()` are represented by zero, magnitudes above `max_value()` by approximately `max_value()`.
+//!
+//! Adding a value increments a single counter, and merging two sketches adds their counters, so the result does not
+//! depend on the order of additions and merges.
+//!
+//! @note If the sketch storage is host accessible, the `*_host` member functions operate on it without a CUDA
+//! stream or device. The binary layout of the sketch is the same on host and device.
+//!
+//! @tparam _Tp Type of the values, an arithmetic type
+//! @tparam _Scope The scope in which operations will be performed by individual threads
+template <class _Tp, ::cuda::thread_scope _Scope = ::cuda::thread_scope_device>
+class quantile_sketch_ref
+{
+  using __impl_type = ::cuda::experimental::cuco::__quantile_sketch_impl<_Tp, _Scope>;
+
+  __impl_type __impl; ///< Implementation object
+
+  template <class _Tp_, ::cuda::thread_scope _Scope_>
+  friend class quantile_sketch_ref;
+
+public:
+  static constexpr auto thread_scope = __impl_type::__thread_scope; ///< CUDA thread scope
+
+  using value_type   = typename __impl_type::__value_type; ///< Type of the values
+  using counter_type = typename __impl_type::__counter_type; ///< Type of the counters
+
+  //! A strong type wrapper `relative_accuracy` of `double`, for specifying the relative accuracy of the values
+  //! returned by `cuda::experimental::cuco::quantile_sketch(_ref)`.
+  //!
+  //! @note Valid relative accuracies are in (0, 1). The sketch size grows with `1 / relative_accuracy`.
+  using relative_accuracy = ::cuda::experimental::cuco::__relative_accuracy_t;
+
+  template <::cuda::thread_scope _NewScope>
+  using with_scope = quantile_sketch_ref<_Tp, _NewScope>; ///< Ref type with different thread scope
+
+  //! @brief Constructs a non-owning `quantile_sketch_ref` object.
+  //!
+  //! @note The largest magnitude the relative accuracy holds for is implied by the size of the storage, see
+  //! `sketch_bytes`.
+  //!
+  //! @throw If the relative accuracy is not in (0, 1) or the minimum value is not positive. Throws if called from
+  //! host; __trap() if called from device.
+  //! @throw If the sketch storage holds fewer than three counters or has insufficient alignment. Throws if called
+  //! from host; __trap() if called from device.
+  //!
+  //! @param __sketch_span Reference to sketch storage
+  //! @param __alpha Relative accuracy
+  //! @param __min_value Smallest magnitude that is not represented by zero
+  _CCCL_API quantile_sketch_ref(::cuda::std::span<::cuda::std::byte> __sketch_span,
+                                relative_accuracy __alpha = relative_accuracy{0.01},
+                                double __min_value        = 1e-9)
+      : __impl{__sketch_span, __alpha, __min_value}
+  {}
+
+  //! @brief Resets the sketch.
+  //!
+  //! @tparam _CG CUDA Cooperative Group type
+  //!
+  //! @param __group CUDA Cooperative group this operation is executed in
+  template <class _CG>
+  _CCCL_DEVICE void clear(_CG __group) noexcept
+  {
+    __impl.__clear(__group);
+  }
+
+  //! @brief Asynchronously resets the sketch.
+  //!
+  //! @param __stream CUDA stream this operation is executed in
+  _CCCL_HOST void clear_async(::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    __impl.__clear_async(__stream);
+  }
+
+  //! @brief Resets the sketch.
+  //!
+  //! @note This function synchronizes the given stream. For asynchronous execution use `clear_async`.
+  //!
+  //! @param __stream CUDA stream this operation is executed in
+  _CCCL_HOST void clear(::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    __impl.__clear(__stream);
+  }
+
+  //! @brief Adds a value to the sketch. NaN values are ignored.
+  //!
+  //! @param __value The value to add
+  _CCCL_DEVICE void add(const _Tp& __value) const noexcept
+  {
+    __impl.__add(__value);
+  }
+
+  //! @brief Asynchronously adds values to the sketch. NaN values are ignored.
+  //!
+  //! @tparam _InputIt Device accessible random access input iterator where
+  //! <tt>std::is_convertible<std::iterator_traits<_InputIt>::value_type,
+  //! _Tp></tt> is `true`
+  //!
+  //! @param __first Beginning of the sequence of values
+  //! @param __last End of the sequence of values
+  //! @param __stream CUDA stream this operation is executed in
+  template <class _InputIt>
+  _CCCL_HOST void
+  add_async(_InputIt __first, _InputIt __last, ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    __impl.__add_async(__first, __last, __stream);
+  }
+
+  //! @brief Adds values to the sketch. NaN values are ignored.
+  //!
+  //! @note This function synchronizes the given stream. For asynchronous execution use `add_async`.
+  //!
+  //! @tparam _InputIt Device accessible random access input iterator where
+  //! <tt>std::is_convertible<std::iterator_traits<_InputIt>::value_type,
+  //! _Tp></tt> is `true`
+  //!
+  //! @param __first Beginning of the sequence of values
+  //! @param __last End of the sequence of values
+  //! @param __stream CUDA stream this operation is executed in
+  template <class _InputIt>
+  _CCCL_HOST void
+  add(_InputIt __first, _InputIt __last, ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    __impl.__add(__first, __last, __stream);
+  }
+
+  //! @brief Merges the values of the `other` sketch reference into `*this` sketch reference.
+  //!
+  //! @throw If the sketches have different parameters, then terminates execution with a device __trap()
+  //!
+  //! @tparam _CG CUDA Cooperative Group type
+  //! @tparam _OtherScope Thread scope of `other` sketch
+  //!
+  //! @param __group CUDA Cooperative group this operation is executed in
+  //! @param __other Other sketch reference to be merged into `*this`
+  template <class _CG, ::cuda::thread_scope _OtherScope>
+  _CCCL_DEVICE void merge(_CG __group, const quantile_sketch_ref<_Tp, _OtherScope>& __other) const
+  {
+    __impl.__merge(__group, __other.__impl);
+  }
+
+  //! @brief Asynchronously merges the values of the `other` sketch reference into `*this` sketch.
+  //!
+  //! @throw If the sketches have different parameters
+  //!
+  //! @tparam _OtherScope Thread scope of `other` sketch
+  //!
+  //! @param __other Other sketch reference to be merged into `*this`
+  //! @param __stream CUDA stream this operation is executed in
+  template <::cuda::thread_scope _OtherScope>
+  _CCCL_HOST void merge_async(const quantile_sketch_ref<_Tp, _OtherScope>& __other,
+                              ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    __impl.__merge_async(__other.__impl, __stream);
+  }
+
+  //! @brief Merges the values of the `other` sketch reference into `*this` sketch.
+  //!
+  //! @note This function synchronizes the given stream. For asynchronous execution use `merge_async`.
+  //!
+  //! @throw If the sketches have different parameters
+  //!
+  //! @tparam _OtherScope Thread scope of `other` sketch
+  //!
+  //! @param __other Other sketch reference to be merged into `*this`
+  //! @param __stream CUDA stream this operation is executed in
+  template <::cuda::thread_scope _OtherScope>
+  _CCCL_HOST void merge(const quantile_sketch_ref<_Tp, _OtherScope>& __other,
+                        ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    __impl.__merge(__other.__impl, __stream);
+  }
+
+  //! @brief Returns the number of added values.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @tparam _HostMemoryResource Host memory resource used for allocating the host buffer the sketch is copied to
+  //!
+  //! @param __host_mr Host memory resource used for copying the sketch
+  //! @param __stream CUDA stream this operation is executed in
+  //!
+  //! @return Number of added values
+  template <typename _HostMemoryResource = ::cuda::mr::legacy_pinned_memory_resource>
+  [[nodiscard]] _CCCL_HOST counter_type count(
+    _HostMemoryResource __host_mr = {}, ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}}) const
+  {
+    return __impl.__count(__host_mr, __stream);
+  }
+
+  //! @brief Computes the approximate `__q`-quantile of the added values, i.e. the value of rank
+  //! `floor(__q * (count() - 1))` in ascending order, within the relative accuracy.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @tparam _HostMemoryResource Host memory resource used for allocating the host buffer the sketch is copied to
+  //!
+  //! @param __q Quantile in [0, 1]
+  //! @param __host_mr Host memory resource used for copying the sketch
+  //! @param __stream CUDA stream this operation is executed in
+  //!
+  //! @return Approximate quantile, or NaN if the sketch is empty or `__q` is not in [0, 1]
+  template <typename _HostMemoryResource = ::cuda::mr::legacy_pinned_memory_resource>
+  [[nodiscard]] _CCCL_HOST double
+  quantile(double __q,
+           _HostMemoryResource __host_mr = {},
+           ::cuda::stream_ref __stream   = ::cuda::stream_ref{cudaStream_t{nullptr}}) const
+  {
+    return __impl.__quantile(__q, __host_mr, __stream);
+  }
+
+  //! @brief Computes the approximate quantiles of several probabilities with a single copy of the sketch.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @tparam _InputIt Host accessible input iterator whose value type is convertible to `double`
+  //! @tparam _OutputIt Host accessible output iterator assignable from `double`
+  //! @tparam _HostMemoryResource Host memory resource used for allocating the host buffer the sketch is copied to
+  //!
+  //! @param __first Beginning of the sequence of quantiles in [0, 1]
+  //! @param __last End of the sequence of quantiles
+  //! @param __output_begin Beginning of the sequence of approximate quantile values
+  //! @param __host_mr Host memory resource used for copying the sketch
+  //! @param __stream CUDA stream this operation is executed in
+  template <class _InputIt, class _OutputIt, typename _HostMemoryResource = ::cuda::mr::legacy_pinned_memory_resource>
+  _CCCL_HOST void quantiles(_InputIt __first,
+                            _InputIt __last,
+                            _OutputIt __output_begin,
+                            _HostMemoryResource __host_mr = {},
+                            ::cuda::stream_ref __stream   = ::cuda::stream_ref{cudaStream_t{nullptr}}) const
+  {
+    __impl.__quantiles(__first, __last, __output_begin, __host_mr, __stream);
+  }
+
+  //! @brief Computes the approximate number of added values that are less than or equal to `__value`.
+  //!
+  //! The result counts all values represented by the same value as `__value`, so it may include values that exceed
+  //! `__value` by up to twice the relative accuracy.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @tparam _HostMemoryResource Host memory resource used for allocating the host buffer the sketch is copied to
+  //!
+  //! @param __value The value to rank
+  //! @param __host_mr Host memory resource used for copying the sketch
+  //! @param __stream CUDA stream this operation is executed in
+  //!
+  //! @return Approximate rank of `__value`, or zero if `__value` is NaN
+  template <typename _HostMemoryResource = ::cuda::mr::legacy_pinned_memory_resource>
+  [[nodiscard]] _CCCL_HOST counter_type
+  rank(const _Tp& __value,
+       _HostMemoryResource __host_mr = {},
+       ::cuda::stream_ref __stream   = ::cuda::stream_ref{cudaStream_t{nullptr}}) const
+  {
+    return __impl.__rank(__value, __host_mr, __stream);
+  }
+
+  //! @brief Resets the sketch on the host.
+  //!
+  //! @note The sketch storage must be host accessible. No CUDA stream is involved.
+  _CCCL_HOST void clear_host() noexcept
+  {
+    __impl.__clear_host();
+  }
+
+  //! @brief Adds values to the sketch on the host. NaN values are ignored.
+  //!
+  //! The values are counted by up to `__max_threads` host threads in sketches of their own, which are merged at the
+  //! end. The resulting sketch is identical to the one computed by `add` on a device, so sketches may be built on
+  //! either side and merged.
+  //!
+  //! @note The sketch storage must be host accessible. No CUDA stream is involved.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator where
+  //! <tt>std::is_convertible<std::iterator_traits<_InputIt>::value_type,
+  //! _Tp></tt> is `true`
+  //!
+  //! @param __first Beginning of the sequence of values
+  //! @param __last End of the sequence of values
+  //! @param __max_threads Upper bound of the number of host threads, or 0 for the number of hardware threads
+  template <class _InputIt>
+  _CCCL_HOST void add_host(_InputIt __first, _InputIt __last, unsigned __max_threads = 0)
+  {
+    __impl.__add_host(__first, __last, __max_threads);
+  }
+
+  //! @brief Merges the values of the `other` sketch reference into `*this` sketch on the host.
+  //!
+  //! @note The sketch storage of both sketches must be host accessible. No CUDA stream is involved.
+  //!
+  //! @throw If the sketches have different parameters
+  //!
+  //! @tparam _OtherScope Thread scope of `other` sketch
+  //!
+  //! @param __other Other sketch reference to be merged into `*this`
+  template <::cuda::thread_scope _OtherScope>
+  _CCCL_HOST void merge_host(const quantile_sketch_ref<_Tp, _OtherScope>& __other)
+  {
+    __impl.__merge_host(__other.__impl);
+  }
+
+  //! @brief Returns the number of added values on the host.
+  //!
+  //! @note The sketch storage must be host accessible. No CUDA stream is involved.
+  [[nodiscard]] _CCCL_HOST counter_type count_host() const noexcept
+  {
+    return __impl.__count_host();
+  }
+
+  //! @brief Computes the approximate `__q`-quantile of the added values on the host, see `quantile`.
+  //!
+  //! @note The sketch storage must be host accessible. No CUDA stream is involved.
+  //!
+  //! @param __q Quantile in [0, 1]
+  //!
+  //! @return Approximate quantile, or NaN if the sketch is empty or `__q` is not in [0, 1]
+  [[nodiscard]] _CCCL_HOST double quantile_host(double __q) const noexcept
+  {
+    return __impl.__quantile_host(__q);
+  }
+
+  //! @brief Computes the approximate number of added values that are less than or equal to `__value` on the host,
+  //! see `rank`.
+  //!
+  //! @note The sketch storage must be host accessible. No CUDA stream is involved.
+  //!
+  //! @param __value The value to rank
+  //!
+  //! @return Approximate rank of `__value`, or zero if `__value` is NaN
+  [[nodiscard]] _CCCL_HOST counter_type rank_host(const _Tp& __value) const noexcept
+  {
+    return __impl.__rank_host(__value);
+  }
+
+  //! @brief Gets the relative accuracy.
+  [[nodiscard]] _CCCL_API constexpr double accuracy() const noexcept
+  {
+    return __impl.__relative_accuracy();
+  }
+
+  //! @brief Gets the smallest magnitude that is not represented by zero.
+  [[nodiscard]] _CCCL_API constexpr double min_value() const noexcept
+  {
+    return __impl.__min_magnitude();
+  }
+
+  //! @brief Gets the largest magnitude the relative accuracy holds for.
+  [[nodiscard]] _CCCL_API double max_value() const noexcept
+  {
+    return __impl.__max_magnitude();
+  }
+
+  //! @brief Gets the span of the sketch.
+  //!
+  //! @return The ::cuda::std::span of the sketch
+  [[nodiscard]] _CCCL_API ::cuda::std::span<::cuda::std::byte> sketch() const noexcept
+  {
+    return __impl.__sketch_span();
+  }
+
+  //! @brief Gets the number of bytes required for the sketch storage.
+  //!
+  //! @return The number of bytes required for the sketch
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::size_t sketch_bytes() const noexcept
+  {
+    return __impl.__sketch_bytes();
+  }
+
+  //! @brief Gets the number of bytes required for the sketch storage.
+  //!
+  //! @throw If the relative accuracy is not in (0, 1), the minimum value is not positive or the maximum value is
+  //! smaller than the minimum value.
+  //!
+  //! @param __alpha Relative accuracy
+  //! @param __min_value Smallest magnitude that is not represented by zero
+  //! @param __max_value Largest magnitude the relative accuracy must hold for
+  //!
+  //! @return The number of bytes required for the sketch
+  [[nodiscard]] _CCCL_API static ::cuda::std::size_t
+  sketch_bytes(relative_accuracy __alpha, double __min_value = 1e-9, double __max_value = 1e9)
+  {
+    return __impl_type::__sketch_bytes(__alpha, __min_value, __max_value);
+  }
+
+  //! @brief Gets the alignment required for the sketch storage.
+  //!
+  //! @return The required alignment
+  [[nodiscard]] _CCCL_API static constexpr ::cuda::std::size_t sketch_alignment() noexcept
+  {
+    return __impl_type::__sketch_alignment();
+  }
+};
+} // namespace cuda::experimental::cuco
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO_QUANTILE_SKETCH_REF_CUH
@@ -0,0 +1,43 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO_SENTINEL_CUH
+#define _CUDAX___CUCO_SENTINEL_CUH
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/experimental/__cuco/__utility/strong_type.cuh>
+
+#include <cuda/std/__cccl/prologue.h>
+
+namespace cuda::experimental::cuco
+{
+//! A strong type wrapper `empty_key` for the key value that marks an empty slot of an open addressing container.
+//!
+//! @note The sentinel must never be inserted as a key. Slots are compared against it bitwise.
+CUDAX_CUCO_DEFINE_TEMPLATE_STRONG_TYPE(empty_key)
+
+//! A strong type wrapper `empty_value` for the mapped value that marks a slot whose payload is not written yet.
+//!
+//! @note The sentinel must never be inserted as a mapped value. Slots are compared against it bitwise.
+CUDAX_CUCO_DEFINE_TEMPLATE_STRONG_TYPE(empty_value)
+} // namespace cuda::experimental::cuco
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO_SENTINEL_CUH
@@ -0,0 +1,346 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO_STATIC_MAP_REF_CUH
+#define _CUDAX___CUCO_STATIC_MAP_REF_CUH
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__functional/operations.h>
+#include <cuda/std/__utility/pair.h>
+#include <cuda/std/span>
+
+#include <cuda/experimental/__cuco/__open_addressing/open_addressing_ref_impl.cuh>
+#include <cuda/experimental/__cuco/hash_functions.cuh>
+#include <cuda/experimental/__cuco/probing_scheme.cuh>
+#include <cuda/experimental/__cuco/sentinel.cuh>
+
+#include <cuda/std/__cccl/prologue.h>
+
+namespace cuda::experimental::cuco
+{
+//! @brief A non-owning reference to an open addressing hash map of unique keys.
+//!
+//! The map is a flat array of key/value slots. Empty slots hold the empty key and empty value sentinels. A slot is
+//! claimed by a compare-and-swap on its key, after which its value is published, so the map can be operated on
+//! concurrently by device threads, cooperative groups of `cg_size` device threads, and host threads.
+//!
+//! @note If the slot storage is host accessible, the `*_host` member functions operate on it without a CUDA stream or
+//! device. The layout of the storage is the same on host and device, so a map built on the host can be queried on the
+//! device and vice versa.
+//!
+//! @note Keys cannot be erased. Insertions fail once every probed window is full.
+//!
+//! @tparam _Key Type of the keys, trivially copyable and 1, 2, 4 or 8 bytes large
+//! @tparam _Tp Type of the mapped values, trivially copyable and 1, 2, 4 or 8 bytes large
+//! @tparam _Scope The scope in which operations will be performed by individual threads
+//! @tparam _KeyEqual Binary callable type used to compare two keys for equality
+//! @tparam _ProbingScheme Probing scheme, see `linear_probing` and `double_hashing`
+//! @tparam _BucketSize Number of consecutive slots a thread inspects per probe
+template <class _Key,
+          class _Tp,
+          ::cuda::thread_scope _Scope = ::cuda::thread_scope_device,
+          class _KeyEqual             = ::cuda::std::equal_to<_Key>,
+          class _ProbingScheme =
+            ::cuda::experimental::cuco::double_hashing<4, ::cuda::experimental::cuco::hash<_Key>>,
+          int _BucketSize = 1>
+class static_map_ref
+{
+  using __impl_type =
+    ::cuda::experimental::cuco::__open_addressing_ref_impl<_Key, _Tp, _Scope, _KeyEqual, _ProbingScheme, _BucketSize>;
+
+  __impl_type __impl; ///< Implementation object
+
+public:
+  static constexpr auto thread_scope = __impl_type::__thread_scope; ///< CUDA thread scope
+  static constexpr int cg_size       = __impl_type::__cg_size; ///< Cooperative group size
+  static constexpr int bucket_size   = __impl_type::__bucket_size; ///< Number of slots per bucket
+  static constexpr int window_size   = __impl_type::__window_size; ///< Number of slots probed at once
+
+  using key_type            = _Key; ///< Key type
+  using mapped_type         = _Tp; ///< Mapped type
+  using value_type          = typename __impl_type::__value_type; ///< Slot type, `::cuda::std::pair<_Key, _Tp>`
+  using key_equal           = _KeyEqual; ///< Key equality type
+  using probing_scheme_type = _ProbingScheme; ///< Probing scheme type
+  using hasher              = typename __impl_type::__hasher; ///< Hash function type
+  using size_type           = typename __impl_type::__size_type; ///< Size type
+  using const_iterator      = const value_type*; ///< Iterator to a slot, see `find`
+
+  //! @brief Constructs a `static_map_ref` over the given slot storage.
+  //!
+  //! @note The storage must be initialized, e.g. with `initialize_host` or by the owning `static_map`.
+  //!
+  //! @throw If the storage is empty or its size is not a multiple of `window_size`.
+  //!
+  //! @param __storage Reference to the slot storage, see `storage_size`
+  //! @param __empty_key_sentinel Key that marks an empty slot
+  //! @param __empty_value_sentinel Mapped value that marks a slot whose value is not written yet
+  //! @param __predicate Key equality
+  //! @param __probing_scheme Probing scheme
+  _CCCL_API constexpr static_map_ref(::cuda::std::span<value_type> __storage,
+                                     ::cuda::experimental::cuco::empty_key<_Key> __empty_key_sentinel,
+                                     ::cuda::experimental::cuco::empty_value<_Tp> __empty_value_sentinel,
+                                     const _KeyEqual& __predicate           = {},
+                                     const _ProbingScheme& __probing_scheme = {})
+      : __impl{__storage,
+               value_type{__empty_key_sentinel.__value, __empty_value_sentinel.__value},
+               __predicate,
+               __probing_scheme}
+  {}
+
+  //! @brief Inserts a key/value pair.
+  //!
+  //! @param __value The key/value pair to insert
+  //!
+  //! @return `true` if the pair was inserted, `false` if an equal key is present or the map is full
+  _CCCL_API bool insert(const value_type& __value) const noexcept
+  {
+    return __impl.__insert(__value);
+  }
+
+  //! @brief Cooperatively inserts a key/value pair.
+  //!
+  //! @tparam _CG Cooperative group type of `cg_size` threads
+  //!
+  //! @param __group The cooperative group this operation is executed in
+  //! @param __value The key/value pair to insert
+  //!
+  //! @return `true` if the pair was inserted, `false` if an equal key is present or the map is full
+  template <class _CG>
+  _CCCL_DEVICE bool insert(const _CG& __group, const value_type& __value) const noexcept
+  {
+    return __impl.__insert(__group, __value);
+  }
+
+  //! @brief Inserts a key/value pair, or assigns the value to the present equal key.
+  //!
+  //! @param __value The key/value pair to insert or assign
+  _CCCL_API void insert_or_assign(const value_type& __value) const noexcept
+  {
+    __impl.__insert_or_assign(__value);
+  }
+
+  //! @brief Returns whether a key equal to `__key` is present.
+  //!
+  //! @param __key The key to search for
+  [[nodiscard]] _CCCL_API bool contains(const key_type& __key) const noexcept
+  {
+    return __impl.__contains(__key);
+  }
+
+  //! @brief Cooperatively returns whether a key equal to `__key` is present.
+  //!
+  //! @tparam _CG Cooperative group type of `cg_size` threads
+  //!
+  //! @param __group The cooperative group this operation is executed in
+  //! @param __key The key to search for
+  template <class _CG>
+  [[nodiscard]] _CCCL_DEVICE bool contains(const _CG& __group, const key_type& __key) const noexcept
+  {
+    return __impl.__contains(__group, __key);
+  }
+
+  //! @brief Finds the slot holding a key equal to `__key`.
+  //!
+  //! @note If the key is being inserted concurrently, waits until its value is written.
+  //!
+  //! @param __key The key to search for
+  //!
+  //! @return Iterator to the slot, or `end()` if no equal key is present
+  [[nodiscard]] _CCCL_API const_iterator find(const key_type& __key) const noexcept
+  {
+    return __impl.__find(__key);
+  }
+
+  //! @brief Cooperatively finds the slot holding a key equal to `__key`.
+  //!
+  //! @tparam _CG Cooperative group type of `cg_size` threads
+  //!
+  //! @param __group The cooperative group this operation is executed in
+  //! @param __key The key to search for
+  //!
+  //! @return Iterator to the slot, or `end()` if no equal key is present
+  template <class _CG>
+  [[nodiscard]] _CCCL_DEVICE const_iterator find(const _CG& __group, const key_type& __key) const noexcept
+  {
+    return __impl.__find(__group, __key);
+  }
+
+  //! @brief Returns the iterator that `find` returns for absent keys.
+  [[nodiscard]] _CCCL_API constexpr const_iterator end() const noexcept
+  {
+    return nullptr;
+  }
+
+  //! @brief Fills the storage with empty slots on the host.
+  //!
+  //! @param __max_threads Upper bound of the number of host threads, or 0 for the number of hardware threads
+  _CCCL_HOST void initialize_host(unsigned __max_threads = 0) const
+  {
+    __impl.__initialize_host(__max_threads);
+  }
+
+  //! @brief Inserts key/value pairs on the host, in parallel on up to `__max_threads` threads.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator whose value type is convertible to `value_type`
+  //!
+  //! @param __first Beginning of the sequence of pairs
+  //! @param __last End of the sequence of pairs
+  //! @param __max_threads Upper bound of the number of host threads, or 0 for the number of hardware threads
+  //!
+  //! @return Number of inserted pairs
+  template <class _InputIt>
+  _CCCL_HOST size_type insert_host(_InputIt __first, _InputIt __last, unsigned __max_threads = 0) const
+  {
+    return __impl.__insert_host(__first, __last, __max_threads);
+  }
+
+  //! @brief Inserts key/value pairs, or assigns the values to the present equal keys, on the host, in parallel on up
+  //! to `__max_threads` threads.
+  //!
+  //! @note If a key occurs several times in [`__first`, `__last`), which of its values is kept is unspecified.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator whose value type is convertible to `value_type`
+  //!
+  //! @param __first Beginning of the sequence of pairs
+  //! @param __last End of the sequence of pairs
+  //! @param __max_threads Upper bound of the number of host threads, or 0 for the number of hardware threads
+  template <class _InputIt>
+  _CCCL_HOST void insert_or_assign_host(_InputIt __first, _InputIt __last, unsigned __max_threads = 0) const
+  {
+    __impl.__insert_or_assign_host(__first, __last, __max_threads);
+  }
+
+  //! @brief Writes whether each key of [`__first`, `__last`) is present to `__output_begin`, in parallel on up to
+  //! `__max_threads` host threads.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator whose value type is convertible to `key_type`
+  //! @tparam _OutputIt Host accessible random access output iterator assignable from `bool`
+  //!
+  //! @param __first Beginning of the sequence of keys
+  //! @param __last End of the sequence of keys
+  //! @param __output_begin Beginning of the sequence of results
+  //! @param __max_threads Upper bound of the number of host threads, or 0 for the number of hardware threads
+  template <class _InputIt, class _OutputIt>
+  _CCCL_HOST void
+  contains_host(_InputIt __first, _InputIt __last, _OutputIt __output_begin, unsigned __max_threads = 0) const
+  {
+    __impl.__contains_host(__first, __last, __output_begin, __max_threads);
+  }
+
+  //! @brief Writes the value mapped to each key of [`__first`, `__last`), or the empty value sentinel if the key is
+  //! not present, to `__output_begin`, in parallel on up to `__max_threads` host threads.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator whose value type is convertible to `key_type`
+  //! @tparam _OutputIt Host accessible random access output iterator assignable from `mapped_type`
+  //!
+  //! @param __first Beginning of the sequence of keys
+  //! @param __last End of the sequence of keys
+  //! @param __output_begin Beginning of the sequence of results
+  //! @param __max_threads Upper bound of the number of host threads, or 0 for the number of hardware threads
+  template <class _InputIt, class _OutputIt>
+  _CCCL_HOST void
+  find_host(_InputIt __first, _InputIt __last, _OutputIt __output_begin, unsigned __max_threads = 0) const
+  {
+    __impl.__find_host(__first, __last, __output_begin, __max_threads);
+  }
+
+  //! @brief Writes every key and its mapped value to `__keys_out` and `__values_out` on the host, in slot order.
+  //!
+  //! @tparam _KeyOut Host accessible random access output iterator assignable from `key_type`
+  //! @tparam _ValueOut Host accessible random access output iterator assignable from `mapped_type`
+  //!
+  //! @param __keys_out Beginning of the output sequence of keys, large enough for `size_host()` keys
+  //! @param __values_out Beginning of the output sequence of values, large enough for `size_host()` values
+  //! @param __max_threads Upper bound of the number of host threads, or 0 for the number of hardware threads
+  //!
+  //! @return Iterators past the last written key and value
+  template <class _KeyOut, class _ValueOut>
+  _CCCL_HOST ::cuda::std::pair<_KeyOut, _ValueOut>
+  retrieve_all_host(_KeyOut __keys_out, _ValueOut __values_out, unsigned __max_threads = 0) const
+  {
+    const auto __n = __impl.__retrieve_all_host(__keys_out, __values_out, __max_threads);
+    return {__keys_out + __n, __values_out + __n};
+  }
+
+  //! @brief Returns the number of keys of the map on the host.
+  //!
+  //! @param __max_threads Upper bound of the number of host threads, or 0 for the number of hardware threads
+  [[nodiscard]] _CCCL_HOST size_type size_host(unsigned __max_threads = 0) const
+  {
+    return __impl.__size_host(__max_threads);
+  }
+
+  //! @brief Returns the number of slots required to store at least `__capacity` keys.
+  //!
+  //! @param __capacity Requested capacity
+  //!
+  //! @return Number of slots
+  [[nodiscard]] _CCCL_API static constexpr size_type storage_size(size_type __capacity) noexcept
+  {
+    return __impl_type::__storage_size(__capacity);
+  }
+
+  //! @brief Gets the number of slots.
+  [[nodiscard]] _CCCL_API constexpr size_type capacity() const noexcept
+  {
+    return __impl.__capacity();
+  }
+
+  //! @brief Gets the slot storage.
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::span<value_type> storage() const noexcept
+  {
+    return __impl.__slots();
+  }
+
+  //! @brief Gets the empty key sentinel.
+  [[nodiscard]] _CCCL_API constexpr key_type empty_key_sentinel() const noexcept
+  {
+    return __impl.__empty_key_sentinel();
+  }
+
+  //! @brief Gets the empty value sentinel.
+  [[nodiscard]] _CCCL_API constexpr mapped_type empty_value_sentinel() const noexcept
+  {
+    return __impl.__empty_slot_sentinel().second;
+  }
+
+  //! @brief Gets the key equality.
+  [[nodiscard]] _CCCL_API constexpr key_equal key_eq() const noexcept
+  {
+    return __impl.__key_eq();
+  }
+
+  //! @brief Gets the probing scheme.
+  [[nodiscard]] _CCCL_API constexpr probing_scheme_type probing_scheme() const noexcept
+  {
+    return __impl.__probing();
+  }
+
+  //! @brief Gets the hash function.
+  [[nodiscard]] _CCCL_API constexpr hasher hash_function() const noexcept
+  {
+    return __impl.__probing().hash_function();
+  }
+};
+} // namespace cuda::experimental::cuco
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO_STATIC_MAP_REF_CUH
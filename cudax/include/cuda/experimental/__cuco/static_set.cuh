@@ -0,0 +1,339 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO_STATIC_SET_CUH
+#define _CUDAX___CUCO_STATIC_SET_CUH
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__stream/stream_ref.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__functional/operations.h>
+#include <cuda/std/__utility/forward.h>
+
+#include <cuda/experimental/__cuco/__open_addressing/open_addressing_impl.cuh>
+#include <cuda/experimental/__cuco/hash_functions.cuh>
+#include <cuda/experimental/__cuco/probing_scheme.cuh>
+#include <cuda/experimental/__cuco/sentinel.cuh>
+#include <cuda/experimental/__cuco/static_set_ref.cuh>
+#include <cuda/experimental/container.cuh>
+#include <cuda/experimental/memory_resource.cuh>
+#include <cuda/experimental/stream.cuh>
+
+#include <cuda/std/__cccl/prologue.h>
+
+namespace cuda::experimental::cuco
+{
+//! @brief A GPU-accelerated open addressing hash set of unique keys with a fixed capacity.
+//!
+//! Keys are stored in a flat array of slots in device memory, probed in windows of `cg_size * _BucketSize` slots.
+//! Bulk operations run as kernels in stream order. `ref()` returns a non-owning `static_set_ref` for operations from
+//! device code.
+//!
+//! @tparam _Key Type of the keys, trivially copyable and 1, 2, 4 or 8 bytes large
+//! @tparam _MemoryResource Type of memory resource used for device storage
+//! @tparam _Scope The scope in which operations will be performed by individual threads
+//! @tparam _KeyEqual Binary callable type used to compare two keys for equality
+//! @tparam _ProbingScheme Probing scheme, see `linear_probing` and `double_hashing`
+//! @tparam _BucketSize Number of consecutive slots a thread inspects per probe
+template <class _Key,
+          class _MemoryResource       = ::cuda::device_memory_pool_ref,
+          ::cuda::thread_scope _Scope = ::cuda::thread_scope_device,
+          class _KeyEqual             = ::cuda::std::equal_to<_Key>,
+          class _ProbingScheme =
+            ::cuda::experimental::cuco::double_hashing<4, ::cuda::experimental::cuco::hash<_Key>>,
+          int _BucketSize = 1>
+class static_set
+{
+public:
+  using ref_type = static_set_ref<_Key, _Scope, _KeyEqual, _ProbingScheme, _BucketSize>; ///< Non-owning reference type
+
+  static constexpr auto thread_scope = ref_type::thread_scope; ///< CUDA thread scope
+  static constexpr int cg_size       = ref_type::cg_size; ///< Cooperative group size
+  static constexpr int bucket_size   = ref_type::bucket_size; ///< Number of slots per bucket
+  static constexpr int window_size   = ref_type::window_size; ///< Number of slots probed at once
+
+  using key_type            = typename ref_type::key_type; ///< Key type
+  using value_type          = typename ref_type::value_type; ///< Slot type, same as `key_type`
+  using key_equal           = typename ref_type::key_equal; ///< Key equality type
+  using probing_scheme_type = typename ref_type::probing_scheme_type; ///< Probing scheme type
+  using hasher              = typename ref_type::hasher; ///< Hash function type
+  using size_type           = typename ref_type::size_type; ///< Size type
+
+private:
+  using __impl_type = ::cuda::experimental::cuco::__open_addressing_impl<
+    ::cuda::experimental::cuco::__open_addressing_ref_impl<_Key, void, _Scope, _KeyEqual, _ProbingScheme, _BucketSize>>;
+
+  __impl_type __impl; ///< Storage and bulk operations
+
+public:
+  //! @brief Constructs a `static_set` with room for at least `__capacity` keys.
+  //!
+  //! @note The slots are initialized in stream order on the given stream.
+  //!
+  //! @param __memory_resource A memory resource used for allocating device storage
+  //! @param __capacity Requested capacity, rounded up to a prime number of windows
+  //! @param __empty_key_sentinel Key that marks an empty slot, must never be inserted
+  //! @param __predicate Key equality
+  //! @param __probing_scheme Probing scheme
+  //! @param __stream CUDA stream used to initialize the object
+  template <typename _MemoryResource_ = _MemoryResource>
+  static_set(_MemoryResource_&& __memory_resource,
+             size_type __capacity,
+             ::cuda::experimental::cuco::empty_key<_Key> __empty_key_sentinel,
+             const _KeyEqual& __predicate           = {},
+             const _ProbingScheme& __probing_scheme = {},
+             ::cuda::stream_ref __stream            = ::cuda::stream_ref{cudaStream_t{nullptr}})
+      : __impl{::cuda::std::forward<_MemoryResource_>(__memory_resource),
+               __capacity,
+               __empty_key_sentinel.__value,
+               __predicate,
+               __probing_scheme,
+               __stream}
+  {}
+
+  //! @brief Constructs a `static_set` with room for at least `__capacity` keys in the default memory pool of
+  //! device 0.
+  //!
+  //! @note The slots are initialized in stream order on the given stream.
+  //!
+  //! @param __capacity Requested capacity, rounded up to a prime number of windows
+  //! @param __empty_key_sentinel Key that marks an empty slot, must never be inserted
+  //! @param __predicate Key equality
+  //! @param __probing_scheme Probing scheme
+  //! @param __stream CUDA stream used to initialize the object
+  static_set(size_type __capacity,
+             ::cuda::experimental::cuco::empty_key<_Key> __empty_key_sentinel,
+             const _KeyEqual& __predicate           = {},
+             const _ProbingScheme& __probing_scheme = {},
+             ::cuda::stream_ref __stream            = ::cuda::stream_ref{cudaStream_t{nullptr}})
+      : static_set{::cuda::device_default_memory_pool(::cuda::device_ref{0}),
+                   __capacity,
+                   __empty_key_sentinel,
+                   __predicate,
+                   __probing_scheme,
+                   __stream}
+  {}
+
+  ~static_set() = default;
+
+  static_set(const static_set&)            = delete;
+  static_set& operator=(const static_set&) = delete;
+  static_set(static_set&&)                 = default; ///< Move constructor
+  static_set& operator=(static_set&&)      = default; ///< Move-assignment operator
+
+  //! @brief Asynchronously erases every key.
+  //!
+  //! @param __stream CUDA stream this operation is executed in
+  void clear_async(::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    __impl.__clear_async(__stream);
+  }
+
+  //! @brief Erases every key.
+  //!
+  //! @note This function synchronizes the given stream. For asynchronous execution use `clear_async`.
+  //!
+  //! @param __stream CUDA stream this operation is executed in
+  void clear(::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    __impl.__clear_async(__stream);
+    __stream.sync();
+  }
+
+  //! @brief Inserts keys and returns the number of inserted keys.
+  //!
+  //! @note This function synchronizes the given stream. For asynchronous execution use `insert_async`.
+  //!
+  //! @tparam _InputIt Device accessible random access input iterator whose value type is convertible to `key_type`
+  //!
+  //! @param __first Beginning of the sequence of keys
+  //! @param __last End of the sequence of keys
+  //! @param __stream CUDA stream this operation is executed in
+  //!
+  //! @return Number of inserted keys
+  template <class _InputIt>
+  size_type
+  insert(_InputIt __first, _InputIt __last, ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    return __impl.__insert(__first, __last, __stream);
+  }
+
+  //! @brief Asynchronously inserts keys.
+  //!
+  //! @tparam _InputIt Device accessible random access input iterator whose value type is convertible to `key_type`
+  //!
+  //! @param __first Beginning of the sequence of keys
+  //! @param __last End of the sequence of keys
+  //! @param __stream CUDA stream this operation is executed in
+  template <class _InputIt>
+  void insert_async(_InputIt __first,
+                    _InputIt __last,
+                    ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}})
+  {
+    __impl.__insert_async(__first, __last, nullptr, __stream);
+  }
+
+  //! @brief Asynchronously writes whether each key of [`__first`, `__last`) is present to `__output_begin`.
+  //!
+  //! @tparam _InputIt Device accessible random access input iterator whose value type is convertible to `key_type`
+  //! @tparam _OutputIt Device accessible random access output iterator assignable from `bool`
+  //!
+  //! @param __first Beginning of the sequence of keys
+  //! @param __last End of the sequence of keys
+  //! @param __output_begin Beginning of the sequence of results
+  //! @param __stream CUDA stream this operation is executed in
+  template <class _InputIt, class _OutputIt>
+  void contains_async(_InputIt __first,
+                      _InputIt __last,
+                      _OutputIt __output_begin,
+                      ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}}) const
+  {
+    __impl.__contains_async(__first, __last, __output_begin, __stream);
+  }
+
+  //! @brief Writes whether each key of [`__first`, `__last`) is present to `__output_begin`.
+  //!
+  //! @note This function synchronizes the given stream. For asynchronous execution use `contains_async`.
+  //!
+  //! @tparam _InputIt Device accessible random access input iterator whose value type is convertible to `key_type`
+  //! @tparam _OutputIt Device accessible random access output iterator assignable from `bool`
+  //!
+  //! @param __first Beginning of the sequence of keys
+  //! @param __last End of the sequence of keys
+  //! @param __output_begin Beginning of the sequence of results
+  //! @param __stream CUDA stream this operation is executed in
+  template <class _InputIt, class _OutputIt>
+  void contains(_InputIt __first,
+                _InputIt __last,
+                _OutputIt __output_begin,
+                ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}}) const
+  {
+    __impl.__contains_async(__first, __last, __output_begin, __stream);
+    __stream.sync();
+  }
+
+  //! @brief Asynchronously writes the stored key equal to each key of [`__first`, `__last`), or the empty key
+  //! sentinel if there is none, to `__output_begin`.
+  //!
+  //! @tparam _InputIt Device accessible random access input iterator whose value type is convertible to `key_type`
+  //! @tparam _OutputIt Device accessible random access output iterator assignable from `key_type`
+  //!
+  //! @param __first Beginning of the sequence of keys
+  //! @param __last End of the sequence of keys
+  //! @param __output_begin Beginning of the sequence of results
+  //! @param __stream CUDA stream this operation is executed in
+  template <class _InputIt, class _OutputIt>
+  void find_async(_InputIt __first,
+                  _InputIt __last,
+                  _OutputIt __output_begin,
+                  ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}}) const
+  {
+    __impl.__find_async(__first, __last, __output_begin, __stream);
+  }
+
+  //! @brief Writes the stored key equal to each key of [`__first`, `__last`), or the empty key sentinel if there is
+  //! none, to `__output_begin`.
+  //!
+  //! @note This function synchronizes the given stream. For asynchronous execution use `find_async`.
+  //!
+  //! @tparam _InputIt Device accessible random access input iterator whose value type is convertible to `key_type`
+  //! @tparam _OutputIt Device accessible random access output iterator assignable from `key_type`
+  //!
+  //! @param __first Beginning of the sequence of keys
+  //! @param __last End of the sequence of keys
+  //! @param __output_begin Beginning of the sequence of results
+  //! @param __stream CUDA stream this operation is executed in
+  template <class _InputIt, class _OutputIt>
+  void find(_InputIt __first,
+            _InputIt __last,
+            _OutputIt __output_begin,
+            ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}}) const
+  {
+    __impl.__find_async(__first, __last, __output_begin, __stream);
+    __stream.sync();
+  }
+
+  //! @brief Writes every key of the set to `__output_begin`, in unspecified order.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @tparam _OutputIt Device accessible random access output iterator assignable from `key_type`
+  //!
+  //! @param __output_begin Beginning of the output sequence, large enough for `size()` keys
+  //! @param __stream CUDA stream this operation is executed in
+  //!
+  //! @return Iterator past the last written key
+  template <class _OutputIt>
+  _OutputIt
+  retrieve_all(_OutputIt __output_begin, ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}}) const
+  {
+    return __output_begin + __impl.__retrieve_all(__output_begin, __output_begin, __stream);
+  }
+
+  //! @brief Returns the number of keys of the set.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @param __stream CUDA stream this operation is executed in
+  [[nodiscard]] size_type size(::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}}) const
+  {
+    return __impl.__size(__stream);
+  }
+
+  //! @brief Gets the number of slots.
+  [[nodiscard]] size_type capacity() const noexcept
+  {
+    return __impl.__ref().__capacity();
+  }
+
+  //! @brief Gets the empty key sentinel.
+  [[nodiscard]] key_type empty_key_sentinel() const noexcept
+  {
+    return __impl.__ref().__empty_key_sentinel();
+  }
+
+  //! @brief Gets the key equality.
+  [[nodiscard]] key_equal key_eq() const noexcept
+  {
+    return __impl.__ref().__key_eq();
+  }
+
+  //! @brief Gets the hash function.
+  [[nodiscard]] hasher hash_function() const noexcept
+  {
+    return __impl.__ref().__probing().hash_function();
+  }
+
+  //! @brief Gets a non-owning reference to the set.
+  //!
+  //! @return Ref object of the current `static_set` object
+  [[nodiscard]] ref_type ref() const noexcept
+  {
+    const auto& __ref_impl = __impl.__ref();
+    return ref_type{__ref_impl.__slots(),
+                    ::cuda::experimental::cuco::empty_key<_Key>{__ref_impl.__empty_key_sentinel()},
+                    __ref_impl.__key_eq(),
+                    __ref_impl.__probing()};
+  }
+};
+} // namespace cuda::experimental::cuco
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO_STATIC_SET_CUH
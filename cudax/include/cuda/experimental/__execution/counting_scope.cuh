@@ -0,0 +1,304 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_COUNTING_SCOPE
+#define __CUDAX_EXECUTION_COUNTING_SCOPE
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__concepts/boolean_testable.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__concepts/copyable.h>
+#include <cuda/std/__utility/exchange.h>
+#include <cuda/std/atomic>
+
+#include <cuda/experimental/__execution/completion_signatures.cuh>
+#include <cuda/experimental/__execution/cpos.cuh>
+#include <cuda/experimental/__execution/queries.cuh>
+#include <cuda/experimental/__execution/stop_token.cuh>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+//! @brief A token that associates work with an async scope. @c spawn and @c spawn_future call @c try_associate
+//! before they start work, and @c disassociate once the work has completed.
+template <class _Token>
+_CCCL_CONCEPT scope_token = _CCCL_REQUIRES_EXPR((_Token), const _Token& __token)( //
+  requires(::cuda::std::copyable<_Token>), //
+  _Satisfies(::cuda::std::__boolean_testable) __token.try_associate(), //
+  __token.disassociate());
+
+//! @brief An async scope that counts the operations associated with it, so that they can be joined.
+//!
+//! Work is associated with the scope through the token returned by @c get_token, usually by @c spawn and
+//! @c spawn_future. The sender returned by @c join completes once no work is associated with the scope anymore.
+//! @c close prevents further associations, and @c request_stop requests all associated work to stop through the
+//! @c get_stop_token query of its environment.
+//!
+//! The scope must not be destroyed while work is still associated with it.
+//!
+//! @code
+//! counting_scope scope;
+//! for (auto& request : requests)
+//! {
+//!   spawn(handle(request), scope.get_token(), env{prop{get_allocator, pool_allocator}});
+//! }
+//! scope.close();
+//! sync_wait(scope.join());
+//! @endcode
+class _CCCL_TYPE_VISIBILITY_DEFAULT counting_scope
+{
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __join_waiter_t
+  {
+    __join_waiter_t* __next_;
+    void (*__complete_)(__join_waiter_t*) noexcept;
+  };
+
+  template <class _Rcvr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __join_opstate_t;
+
+  // All decisions are made on a single state word. Its lowest bit is set once the scope is closed. The next bit guards
+  // the list of join waiters, and the one after it is set while that list is not empty. The remaining bits count the
+  // associations.
+  static constexpr size_t __closed_bit  = 1;
+  static constexpr size_t __locked_bit  = 2;
+  static constexpr size_t __waiters_bit = 4;
+  static constexpr size_t __one_assoc   = 8;
+
+public:
+  class _CCCL_TYPE_VISIBILITY_DEFAULT token;
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __join_sndr_t;
+
+  _CCCL_HIDE_FROM_ABI counting_scope() = default;
+
+  _CCCL_IMMOVABLE(counting_scope);
+
+  _CCCL_API ~counting_scope()
+  {
+    _CCCL_ASSERT(__state_.load(::cuda::std::memory_order_relaxed) / __one_assoc == 0,
+                 "counting_scope destroyed while work is still associated with it");
+  }
+
+  //! @brief Returns a token that associates work with this scope.
+  [[nodiscard]] _CCCL_API auto get_token() noexcept -> token;
+
+  //! @brief Prevents further work from being associated with this scope. Work that is already associated is not
+  //! affected.
+  _CCCL_API void close() noexcept
+  {
+    __state_.fetch_or(__closed_bit);
+  }
+
+  //! @brief Requests all work associated with this scope to stop.
+  _CCCL_API void request_stop() noexcept
+  {
+    __stop_source_.request_stop();
+  }
+
+  //! @brief Returns a sender that completes with @c set_value() once no work is associated with this scope.
+  //!
+  //! The sender completes on the thread that completes the last associated operation, or inline when it is started
+  //! while no work is associated. Call @c close before @c join to make sure no work is associated afterwards.
+  [[nodiscard]] _CCCL_API auto join() noexcept -> __join_sndr_t;
+
+private:
+  [[nodiscard]] _CCCL_API auto __try_associate() noexcept -> bool
+  {
+    size_t __old = __state_.load(::cuda::std::memory_order_relaxed);
+    do
+    {
+      if (__old & __closed_bit)
+      {
+        return false;
+      }
+      if (__old & __locked_bit)
+      {
+        __old = __state_.load(::cuda::std::memory_order_relaxed);
+        continue;
+      }
+    } while (!__state_.compare_exchange_weak(__old, __old + __one_assoc, ::cuda::std::memory_order_relaxed));
+    return true;
+  }
+
+  _CCCL_API void __disassociate() noexcept
+  {
+    size_t __old = __state_.load(::cuda::std::memory_order_relaxed);
+    while (true)
+    {
+      if (__old & __locked_bit)
+      {
+        __old = __state_.load(::cuda::std::memory_order_relaxed);
+      }
+      else if (__old / __one_assoc > 1 || !(__old & __waiters_bit))
+      {
+        // No join has to be completed, and the scope is not touched after this update.
+        if (__state_.compare_exchange_weak(__old, __old - __one_assoc, ::cuda::std::memory_order_release))
+        {
+          return;
+        }
+      }
+      else if (__state_.compare_exchange_weak(__old, __old | __locked_bit, ::cuda::std::memory_order_acquire))
+      {
+        // This is the last association and joins are waiting. Take the waiters before the final update, which
+        // drops the count, the lock and the waiters bit at once. Only the closed bit can change concurrently.
+        __join_waiter_t* __waiter = ::cuda::std::exchange(__waiters_, nullptr);
+        __state_.fetch_and(__closed_bit, ::cuda::std::memory_order_acq_rel);
+        __complete_joins(__waiter);
+        return;
+      }
+    }
+  }
+
+  _CCCL_API void __start_join(__join_waiter_t* __waiter) noexcept
+  {
+    size_t __old = __state_.load(::cuda::std::memory_order_acquire);
+    while (true)
+    {
+      if (__old & __locked_bit)
+      {
+        __old = __state_.load(::cuda::std::memory_order_acquire);
+      }
+      else if (__old / __one_assoc == 0)
+      {
+        __complete_joins(__waiter);
+        return;
+      }
+      else if (__state_.compare_exchange_weak(
+                 __old, __old | __locked_bit | __waiters_bit, ::cuda::std::memory_order_acquire))
+      {
+        // The last association completes the waiter once it observes the waiters bit after the lock is released.
+        __waiter->__next_ = __waiters_;
+        __waiters_        = __waiter;
+        __state_.fetch_and(~__locked_bit, ::cuda::std::memory_order_release);
+        return;
+      }
+    }
+  }
+
+  // Completes a list of waiters that has been removed from the scope, so that the scope is not touched anymore.
+  _CCCL_API static void __complete_joins(__join_waiter_t* __waiter) noexcept
+  {
+    while (__waiter != nullptr)
+    {
+      __join_waiter_t* __next = __waiter->__next_;
+      __waiter->__complete_(__waiter);
+      __waiter = __next;
+    }
+  }
+
+  ::cuda::std::atomic<size_t> __state_{0};
+  __join_waiter_t* __waiters_{nullptr}; // guarded by the lock bit of the state
+  inplace_stop_source __stop_source_{};
+};
+
+//! @brief The token of a @c counting_scope. Its @c get_stop_token query returns the stop token of the scope.
+class _CCCL_TYPE_VISIBILITY_DEFAULT counting_scope::token
+{
+  friend class counting_scope;
+
+  _CCCL_API constexpr explicit token(counting_scope* __scope) noexcept
+      : __scope_(__scope)
+  {}
+
+  counting_scope* __scope_;
+
+public:
+  //! @brief Associates one operation with the scope.
+  //! @return @c false if the scope is closed, in which case the operation must not be started.
+  [[nodiscard]] _CCCL_API auto try_associate() const noexcept -> bool
+  {
+    return __scope_->__try_associate();
+  }
+
+  //! @brief Ends one association made by a successful call to @c try_associate.
+  _CCCL_API void disassociate() const noexcept
+  {
+    __scope_->__disassociate();
+  }
+
+  [[nodiscard]] _CCCL_API auto query(get_stop_token_t) const noexcept -> inplace_stop_token
+  {
+    return __scope_->__stop_source_.get_token();
+  }
+};
+
+template <class _Rcvr>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT counting_scope::__join_opstate_t : counting_scope::__join_waiter_t
+{
+  using operation_state_concept = operation_state_t;
+
+  _CCCL_API explicit __join_opstate_t(counting_scope* __scope, _Rcvr __rcvr) noexcept
+      : __join_waiter_t{nullptr, &__complete}
+      , __scope_(__scope)
+      , __rcvr_(static_cast<_Rcvr&&>(__rcvr))
+  {}
+
+  _CCCL_IMMOVABLE(__join_opstate_t);
+
+  _CCCL_API void start() noexcept
+  {
+    __scope_->__start_join(this);
+  }
+
+private:
+  _CCCL_API static void __complete(__join_waiter_t* __waiter) noexcept
+  {
+    auto* __self = static_cast<__join_opstate_t*>(__waiter);
+    execution::set_value(static_cast<_Rcvr&&>(__self->__rcvr_));
+  }
+
+  counting_scope* __scope_;
+  _Rcvr __rcvr_;
+};
+
+struct _CCCL_TYPE_VISIBILITY_DEFAULT counting_scope::__join_sndr_t
+{
+  using sender_concept = sender_t;
+
+  template <class _Self, class... _Env>
+  [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto get_completion_signatures() noexcept
+  {
+    return completion_signatures<set_value_t()>{};
+  }
+
+  template <class _Rcvr>
+  [[nodiscard]] _CCCL_API auto connect(_Rcvr __rcvr) const noexcept(__nothrow_movable<_Rcvr>)
+    -> __join_opstate_t<_Rcvr>
+  {
+    return __join_opstate_t<_Rcvr>{__scope_, static_cast<_Rcvr&&>(__rcvr)};
+  }
+
+  counting_scope* __scope_;
+};
+
+[[nodiscard]] _CCCL_API inline auto counting_scope::get_token() noexcept -> token
+{
+  return token{this};
+}
+
+[[nodiscard]] _CCCL_API inline auto counting_scope::join() noexcept -> __join_sndr_t
+{
+  return __join_sndr_t{this};
+}
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_COUNTING_SCOPE
@@ -210,6 +210,11 @@ struct _CCCL_TYPE_VISIBILITY_DEFAULT bulk_unchunked_t;
 // sender consumer algorithms:
 struct _CCCL_TYPE_VISIBILITY_DEFAULT sync_wait_t;
 struct _CCCL_TYPE_VISIBILITY_DEFAULT start_detached_t;
+struct _CCCL_TYPE_VISIBILITY_DEFAULT spawn_t;
+struct _CCCL_TYPE_VISIBILITY_DEFAULT spawn_future_t;
+
+// async scopes:
+class _CCCL_TYPE_VISIBILITY_DEFAULT counting_scope;
 
 // queries:
 struct _CCCL_TYPE_VISIBILITY_DEFAULT get_allocator_t;
@@ -0,0 +1,387 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_IO_CONTEXT
+#define __CUDAX_EXECUTION_IO_CONTEXT
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_OS(LINUX) && __has_include(<linux/io_uring.h>)
+
+#  include <cuda/__utility/immovable.h>
+#  include <cuda/std/cstddef>
+#  include <cuda/std/cstdint>
+#  include <cuda/std/span>
+
+#  include <cuda/experimental/__execution/completion_signatures.cuh>
+#  include <cuda/experimental/__execution/cpos.cuh>
+#  include <cuda/experimental/__execution/env.cuh>
+#  include <cuda/experimental/__execution/io_engine.cuh>
+#  include <cuda/experimental/__execution/queries.cuh>
+
+#  include <system_error>
+#  include <vector>
+
+#  include <sys/uio.h>
+
+#  include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+//! @brief A host buffer registered with an @c io_context. @c index is the position of the buffer in the list passed
+//! to @c io_context::register_buffers, and @c data may be any part of that buffer.
+struct registered_buffer
+{
+  ::cuda::std::span<::cuda::std::byte> data;
+  unsigned index;
+};
+
+//! @brief An execution context for asynchronous reads and writes of file descriptors.
+//!
+//! The scheduler of the context returns senders for @c async_read, @c async_read_at, @c async_write and
+//! @c async_write_at. They complete with @c set_value(size_t) and the number of bytes transferred, which may be less
+//! than requested just like for @c read and @c write, or with @c set_error(std::error_code).
+//!
+//! On Linux kernels with io_uring, the requests are submitted in batches by a thread of the context, which also reaps
+//! their completions and completes the receivers. Buffers passed to @c register_buffers are pinned by the kernel once,
+//! and requests on a @c registered_buffer skip mapping them for every request. On other kernels, a pool of threads
+//! performs the requests with blocking system calls and completes the receivers.
+//!
+//! A stop request is honored when the operation is started. Requests that were already submitted are not cancelled.
+//!
+//! @code
+//! io_context ctx;
+//! auto sched = ctx.get_scheduler();
+//! auto [bytes] = sync_wait(async_read_at(sched, fd, offset, buffer) | then(parse)).value();
+//! @endcode
+class _CCCL_TYPE_VISIBILITY_DEFAULT io_context : __immovable
+{
+public:
+  class _CCCL_TYPE_VISIBILITY_DEFAULT scheduler;
+
+  //! @brief Creates the context.
+  //! @param __entries The size of the submission queue of the ring.
+  //! @param __fallback_threads The number of threads that perform requests when io_uring is not available.
+  _CCCL_HOST_API explicit io_context(unsigned __entries = 256, unsigned __fallback_threads = 4)
+      : __engine_{__entries, __fallback_threads}
+  {}
+
+  //! @brief Waits for the submitted requests to complete, then joins the threads of the context.
+  _CCCL_HOST_API void join() noexcept
+  {
+    __engine_.__join();
+  }
+
+  //! @brief Returns whether the requests are performed with io_uring rather than with a pool of threads.
+  [[nodiscard]] _CCCL_HOST_API auto uses_io_uring() const noexcept -> bool
+  {
+    return __engine_.__uses_io_uring();
+  }
+
+  //! @brief Registers host buffers for use with @c registered_buffer. May be called at most once.
+  //! @throws std::system_error if the kernel cannot register the buffers.
+  _CCCL_HOST_API void register_buffers(::cuda::std::span<const ::cuda::std::span<::cuda::std::byte>> __buffers)
+  {
+    ::std::vector<::iovec> __iovecs;
+    __iovecs.reserve(__buffers.size());
+    for (const auto& __buffer : __buffers)
+    {
+      __iovecs.push_back(::iovec{__buffer.data(), __buffer.size()});
+    }
+    __engine_.__register_buffers(__iovecs.data(), static_cast<unsigned>(__iovecs.size()));
+  }
+
+  [[nodiscard]] _CCCL_API auto get_scheduler() noexcept -> scheduler;
+
+private:
+  template <class _Rcvr, bool _TransfersBytes>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_t;
+
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __attrs_t;
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __sndr_t;
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __io_sndr_t;
+
+  __io_engine __engine_;
+};
+
+// schedule() submits a no-operation request, which completes with set_value() instead of set_value(size_t).
+template <class _Rcvr, bool _TransfersBytes>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT io_context::__opstate_t : __io_op
+{
+  using operation_state_concept = operation_state_t;
+
+  _CCCL_API explicit __opstate_t(__io_engine* __engine, __io_request __request, _Rcvr __rcvr) noexcept
+      : __io_op{__request, &__complete}
+      , __engine_{__engine}
+      , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+  {}
+
+  _CCCL_HOST_API void start() noexcept
+  {
+    if (get_stop_token(get_env(__rcvr_)).stop_requested())
+    {
+      execution::set_stopped(static_cast<_Rcvr&&>(__rcvr_));
+    }
+    else
+    {
+      __engine_->__submit(this);
+    }
+  }
+
+private:
+  _CCCL_HOST_API static void __complete(__io_op* __op, long __res) noexcept
+  {
+    auto* __self = static_cast<__opstate_t*>(__op);
+    if (__res < 0)
+    {
+      execution::set_error(static_cast<_Rcvr&&>(__self->__rcvr_),
+                           ::std::error_code{static_cast<int>(-__res), ::std::system_category()});
+    }
+    else if constexpr (_TransfersBytes)
+    {
+      execution::set_value(static_cast<_Rcvr&&>(__self->__rcvr_), static_cast<size_t>(__res));
+    }
+    else
+    {
+      execution::set_value(static_cast<_Rcvr&&>(__self->__rcvr_));
+    }
+  }
+
+  __io_engine* __engine_;
+  _Rcvr __rcvr_;
+};
+
+struct _CCCL_TYPE_VISIBILITY_DEFAULT io_context::__attrs_t
+{
+  [[nodiscard]] _CCCL_API auto query(get_completion_scheduler_t<set_value_t>) const noexcept -> scheduler;
+
+  [[nodiscard]] _CCCL_API constexpr auto query(get_completion_behavior_t) const noexcept
+  {
+    return completion_behavior::asynchronous;
+  }
+
+  io_context* __ctx_;
+};
+
+struct _CCCL_TYPE_VISIBILITY_DEFAULT io_context::__sndr_t
+{
+  using sender_concept = sender_t;
+
+  template <class _Self>
+  [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto get_completion_signatures() noexcept
+  {
+    return completion_signatures<set_value_t(), set_error_t(::std::error_code), set_stopped_t()>{};
+  }
+
+  template <class _Rcvr>
+  [[nodiscard]] _CCCL_API auto connect(_Rcvr __rcvr) const noexcept -> __opstate_t<_Rcvr, false>
+  {
+    const __io_request __nop{__io_opcode::__nop, -1, nullptr, 0, -1, -1};
+    return __opstate_t<_Rcvr, false>{&__ctx_->__engine_, __nop, static_cast<_Rcvr&&>(__rcvr)};
+  }
+
+  [[nodiscard]] _CCCL_API auto get_env() const noexcept -> __attrs_t
+  {
+    return __attrs_t{__ctx_};
+  }
+
+  io_context* __ctx_;
+};
+
+struct _CCCL_TYPE_VISIBILITY_DEFAULT io_context::__io_sndr_t
+{
+  using sender_concept = sender_t;
+
+  template <class _Self>
+  [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto get_completion_signatures() noexcept
+  {
+    return completion_signatures<set_value_t(size_t), set_error_t(::std::error_code), set_stopped_t()>{};
+  }
+
+  template <class _Rcvr>
+  [[nodiscard]] _CCCL_API auto connect(_Rcvr __rcvr) const noexcept -> __opstate_t<_Rcvr, true>
+  {
+    return __opstate_t<_Rcvr, true>{&__ctx_->__engine_, __request_, static_cast<_Rcvr&&>(__rcvr)};
+  }
+
+  [[nodiscard]] _CCCL_API auto get_env() const noexcept -> __attrs_t
+  {
+    return __attrs_t{__ctx_};
+  }
+
+  io_context* __ctx_;
+  __io_request __request_;
+};
+
+class _CCCL_TYPE_VISIBILITY_DEFAULT io_context::scheduler
+{
+  friend io_context;
+
+  _CCCL_API constexpr explicit scheduler(io_context* __ctx) noexcept
+      : __ctx_(__ctx)
+  {}
+
+  [[nodiscard]] _CCCL_API auto __make_sndr(
+    __io_opcode __opcode, int __fd, ::cuda::std::int64_t __offset, const void* __data, size_t __size, int __index)
+    const noexcept -> __io_sndr_t
+  {
+    return __io_sndr_t{__ctx_, __io_request{__opcode, __fd, const_cast<void*>(__data), __size, __offset, __index}};
+  }
+
+  io_context* __ctx_;
+
+public:
+  using scheduler_concept = scheduler_t;
+
+  [[nodiscard]] _CCCL_API auto schedule() const noexcept -> __sndr_t
+  {
+    return __sndr_t{__ctx_};
+  }
+
+  //! @brief Reads from @c __fd at its current file position into @c __buffer.
+  [[nodiscard]] _CCCL_API auto async_read(int __fd, ::cuda::std::span<::cuda::std::byte> __buffer) const noexcept
+    -> __io_sndr_t
+  {
+    return __make_sndr(__io_opcode::__read, __fd, -1, __buffer.data(), __buffer.size(), -1);
+  }
+
+  [[nodiscard]] _CCCL_API auto async_read(int __fd, registered_buffer __buffer) const noexcept -> __io_sndr_t
+  {
+    return __make_sndr(__io_opcode::__read, __fd, -1, __buffer.data.data(), __buffer.data.size(), __buffer.index);
+  }
+
+  //! @brief Reads from @c __fd at @c __offset into @c __buffer, without changing the file position.
+  [[nodiscard]] _CCCL_API auto
+  async_read_at(int __fd, ::cuda::std::int64_t __offset, ::cuda::std::span<::cuda::std::byte> __buffer) const noexcept
+    -> __io_sndr_t
+  {
+    return __make_sndr(__io_opcode::__read, __fd, __offset, __buffer.data(), __buffer.size(), -1);
+  }
+
+  [[nodiscard]] _CCCL_API auto
+  async_read_at(int __fd, ::cuda::std::int64_t __offset, registered_buffer __buffer) const noexcept -> __io_sndr_t
+  {
+    return __make_sndr(__io_opcode::__read, __fd, __offset, __buffer.data.data(), __buffer.data.size(), __buffer.index);
+  }
+
+  //! @brief Writes @c __buffer to @c __fd at its current file position.
+  [[nodiscard]] _CCCL_API auto async_write(int __fd, ::cuda::std::span<const ::cuda::std::byte> __buffer) const noexcept
+    -> __io_sndr_t
+  {
+    return __make_sndr(__io_opcode::__write, __fd, -1, __buffer.data(), __buffer.size(), -1);
+  }
+
+  [[nodiscard]] _CCCL_API auto async_write(int __fd, registered_buffer __buffer) const noexcept -> __io_sndr_t
+  {
+    return __make_sndr(__io_opcode::__write, __fd, -1, __buffer.data.data(), __buffer.data.size(), __buffer.index);
+  }
+
+  //! @brief Writes @c __buffer to @c __fd at @c __offset, without changing the file position.
+  [[nodiscard]] _CCCL_API auto async_write_at(
+    int __fd, ::cuda::std::int64_t __offset, ::cuda::std::span<const ::cuda::std::byte> __buffer) const noexcept
+    -> __io_sndr_t
+  {
+    return __make_sndr(__io_opcode::__write, __fd, __offset, __buffer.data(), __buffer.size(), -1);
+  }
+
+  [[nodiscard]] _CCCL_API auto
+  async_write_at(int __fd, ::cuda::std::int64_t __offset, registered_buffer __buffer) const noexcept -> __io_sndr_t
+  {
+    return __make_sndr(
+      __io_opcode::__write, __fd, __offset, __buffer.data.data(), __buffer.data.size(), __buffer.index);
+  }
+
+  [[nodiscard]] _CCCL_API auto query(get_completion_scheduler_t<set_value_t>) const noexcept -> scheduler
+  {
+    return *this;
+  }
+
+  [[nodiscard]] _CCCL_API constexpr auto query(get_forward_progress_guarantee_t) const noexcept
+    -> forward_progress_guarantee
+  {
+    return forward_progress_guarantee::parallel;
+  }
+
+  [[nodiscard]] _CCCL_API friend constexpr bool operator==(const scheduler& __a, const scheduler& __b) noexcept
+  {
+    return __a.__ctx_ == __b.__ctx_;
+  }
+
+  [[nodiscard]] _CCCL_API friend constexpr bool operator!=(const scheduler& __a, const scheduler& __b) noexcept
+  {
+    return __a.__ctx_ != __b.__ctx_;
+  }
+};
+
+_CCCL_API inline auto io_context::get_scheduler() noexcept -> scheduler
+{
+  return scheduler{this};
+}
+
+_CCCL_API inline auto io_context::__attrs_t::query(get_completion_scheduler_t<set_value_t>) const noexcept -> scheduler
+{
+  return scheduler{__ctx_};
+}
+
+struct async_read_t
+{
+  template <class _Sch, class... _Args>
+  _CCCL_HOST_API auto operator()(_Sch&& __sch, _Args&&... __args) const noexcept
+  {
+    return static_cast<_Sch&&>(__sch).async_read(static_cast<_Args&&>(__args)...);
+  }
+};
+
+struct async_read_at_t
+{
+  template <class _Sch, class... _Args>
+  _CCCL_HOST_API auto operator()(_Sch&& __sch, _Args&&... __args) const noexcept
+  {
+    return static_cast<_Sch&&>(__sch).async_read_at(static_cast<_Args&&>(__args)...);
+  }
+};
+
+struct async_write_t
+{
+  template <class _Sch, class... _Args>
+  _CCCL_HOST_API auto operator()(_Sch&& __sch, _Args&&... __args) const noexcept
+  {
+    return static_cast<_Sch&&>(__sch).async_write(static_cast<_Args&&>(__args)...);
+  }
+};
+
+struct async_write_at_t
+{
+  template <class _Sch, class... _Args>
+  _CCCL_HOST_API auto operator()(_Sch&& __sch, _Args&&... __args) const noexcept
+  {
+    return static_cast<_Sch&&>(__sch).async_write_at(static_cast<_Args&&>(__args)...);
+  }
+};
+
+_CCCL_GLOBAL_CONSTANT async_read_t async_read{};
+_CCCL_GLOBAL_CONSTANT async_read_at_t async_read_at{};
+_CCCL_GLOBAL_CONSTANT async_write_t async_write{};
+_CCCL_GLOBAL_CONSTANT async_write_at_t async_write_at{};
+} // namespace cuda::experimental::execution
+
+#  include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // _CCCL_OS(LINUX) && __has_include(<linux/io_uring.h>)
+
+#endif // __CUDAX_EXECUTION_IO_CONTEXT
@@ -0,0 +1,539 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_IO_ENGINE
+#define __CUDAX_EXECUTION_IO_ENGINE
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_OS(LINUX) && __has_include(<linux/io_uring.h>)
+
+#  include <cuda/__utility/immovable.h>
+#  include <cuda/std/__algorithm/max.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__exception/exception_macros.h>
+#  include <cuda/std/__exception/terminate.h>
+#  include <cuda/std/atomic>
+#  include <cuda/std/cstdint>
+
+#  include <cuda/experimental/__execution/atomic_intrusive_queue.cuh>
+#  include <cuda/experimental/__execution/intrusive_queue.cuh>
+
+#  include <condition_variable>
+#  include <memory>
+#  include <mutex>
+#  include <system_error>
+#  include <thread>
+#  include <vector>
+
+#  include <errno.h>
+#  include <linux/io_uring.h>
+#  include <sys/eventfd.h>
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#  include <sys/uio.h>
+#  include <unistd.h>
+
+#  include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+enum class __io_opcode : unsigned char
+{
+  __nop,
+  __read,
+  __write
+};
+
+//! A read or a write of a file descriptor. A negative offset means the current file position, and a negative buffer
+//! index means that the buffer is not registered with the ring.
+struct __io_request
+{
+  __io_opcode __opcode_;
+  int __fd_;
+  void* __data_;
+  size_t __size_;
+  ::cuda::std::int64_t __offset_;
+  int __buffer_index_;
+};
+
+//! The type-erased operation state of an I/O request. The engine calls @c __complete_ with the number of bytes
+//! transferred, or with a negated @c errno value.
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __io_op : __immovable
+{
+  using __complete_fn_t _CCCL_NODEBUG_ALIAS = void(__io_op*, long) noexcept;
+
+  _CCCL_API explicit __io_op(__io_request __request, __complete_fn_t* __complete) noexcept
+      : __request_(__request)
+      , __complete_(__complete)
+  {}
+
+  __io_request __request_;
+  __complete_fn_t* __complete_;
+  __io_op* __next_ = nullptr;
+};
+
+//! A thin wrapper of an io_uring instance, set up with the raw system calls so that liburing is not needed.
+class __io_uring : __immovable
+{
+public:
+  // The largest transfer Linux performs in one read or write.
+  static constexpr size_t __max_transfer = 0x7ffff000;
+
+  _CCCL_HOST_API explicit __io_uring(unsigned __entries) noexcept
+  {
+    ::io_uring_params __params{};
+    __fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, __entries, &__params));
+    if (__fd_ < 0)
+    {
+      return;
+    }
+
+    __sq_entries_   = __params.sq_entries;
+    __cq_entries_   = __params.cq_entries;
+    __sq_ring_size_ = __params.sq_off.array + __params.sq_entries * sizeof(unsigned);
+    __cq_ring_size_ = __params.cq_off.cqes + __params.cq_entries * sizeof(::io_uring_cqe);
+
+    const bool __single_mmap = (__params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (__single_mmap)
+    {
+      __sq_ring_size_ = __cq_ring_size_ = (::cuda::std::max) (__sq_ring_size_, __cq_ring_size_);
+    }
+
+    __sq_ring_ = __map(__sq_ring_size_, IORING_OFF_SQ_RING);
+    __cq_ring_ = __single_mmap ? __sq_ring_ : __map(__cq_ring_size_, IORING_OFF_CQ_RING);
+    __sqes_    = static_cast<::io_uring_sqe*>(__map(__params.sq_entries * sizeof(::io_uring_sqe), IORING_OFF_SQES));
+    if (__sq_ring_ == nullptr || __cq_ring_ == nullptr || __sqes_ == nullptr || !__supports_required_ops())
+    {
+      __reset();
+      return;
+    }
+
+    __sq_head_  = __field(__sq_ring_, __params.sq_off.head);
+    __sq_tail_  = __field(__sq_ring_, __params.sq_off.tail);
+    __sq_mask_  = *__field(__sq_ring_, __params.sq_off.ring_mask);
+    __sq_array_ = __field(__sq_ring_, __params.sq_off.array);
+    __cq_head_  = __field(__cq_ring_, __params.cq_off.head);
+    __cq_tail_  = __field(__cq_ring_, __params.cq_off.tail);
+    __cq_mask_  = *__field(__cq_ring_, __params.cq_off.ring_mask);
+    __cqes_     = reinterpret_cast<::io_uring_cqe*>(static_cast<char*>(__cq_ring_) + __params.cq_off.cqes);
+  }
+
+  _CCCL_HOST_API ~__io_uring()
+  {
+    __reset();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API explicit operator bool() const noexcept
+  {
+    return __fd_ >= 0;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __cq_entries() const noexcept -> unsigned
+  {
+    return __cq_entries_;
+  }
+
+  //! Returns a cleared submission queue entry, or @c nullptr if the submission queue is full.
+  [[nodiscard]] _CCCL_HOST_API auto __get_sqe() noexcept -> ::io_uring_sqe*
+  {
+    const unsigned __tail = *__sq_tail_;
+    if (__tail - ::cuda::std::atomic_ref<unsigned>{*__sq_head_}.load(::cuda::std::memory_order_acquire)
+        == __sq_entries_)
+    {
+      return nullptr;
+    }
+    const unsigned __index = __tail & __sq_mask_;
+    ::io_uring_sqe* __sqe  = &__sqes_[__index];
+    *__sqe                 = ::io_uring_sqe{};
+    __sq_array_[__index]   = __index;
+    ::cuda::std::atomic_ref<unsigned>{*__sq_tail_}.store(__tail + 1, ::cuda::std::memory_order_release);
+    return __sqe;
+  }
+
+  //! Submits the queued entries and waits until at least @c __wait_nr completions are available. Interrupted and
+  //! busy submissions return early, so that the caller can reap completions and try again.
+  _CCCL_HOST_API void __submit_and_wait(unsigned __wait_nr) noexcept
+  {
+    const unsigned __to_submit =
+      *__sq_tail_ - ::cuda::std::atomic_ref<unsigned>{*__sq_head_}.load(::cuda::std::memory_order_acquire);
+    if (::syscall(__NR_io_uring_enter, __fd_, __to_submit, __wait_nr, IORING_ENTER_GETEVENTS, nullptr, 0) < 0)
+    {
+      if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+      {
+        ::cuda::std::terminate();
+      }
+    }
+  }
+
+  //! Calls @c __fn(user_data, res) for every available completion.
+  template <class _Fn>
+  _CCCL_HOST_API void __reap(_Fn __fn) noexcept
+  {
+    unsigned __head       = *__cq_head_;
+    const unsigned __tail = ::cuda::std::atomic_ref<unsigned>{*__cq_tail_}.load(::cuda::std::memory_order_acquire);
+    for (; __head != __tail; ++__head)
+    {
+      const ::io_uring_cqe& __cqe = __cqes_[__head & __cq_mask_];
+      const auto __user_data      = __cqe.user_data;
+      const auto __res            = __cqe.res;
+      // The entry is copied, so it can be handed back to the kernel before __fn runs.
+      ::cuda::std::atomic_ref<unsigned>{*__cq_head_}.store(__head + 1, ::cuda::std::memory_order_release);
+      __fn(__user_data, __res);
+    }
+  }
+
+  _CCCL_HOST_API void __register_buffers(const ::iovec* __iovecs, unsigned __count)
+  {
+    if (::syscall(__NR_io_uring_register, __fd_, IORING_REGISTER_BUFFERS, __iovecs, __count) < 0)
+    {
+      _CCCL_THROW(::std::system_error, errno, ::std::system_category(), "io_uring_register failed");
+    }
+  }
+
+private:
+  [[nodiscard]] _CCCL_HOST_API auto __map(size_t __size, ::off_t __offset) noexcept -> void*
+  {
+    void* __ptr = ::mmap(nullptr, __size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, __fd_, __offset);
+    return __ptr == MAP_FAILED ? nullptr : __ptr;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static auto __field(void* __ring, unsigned __offset) noexcept -> unsigned*
+  {
+    return reinterpret_cast<unsigned*>(static_cast<char*>(__ring) + __offset);
+  }
+
+  // Reads and writes at the current file position need Linux 5.6, which is also when probing was added.
+  [[nodiscard]] _CCCL_HOST_API auto __supports_required_ops() const noexcept -> bool
+  {
+    constexpr unsigned __nops = IORING_OP_LAST;
+    ::std::unique_ptr<unsigned char[]> __storage{
+      new (::std::nothrow) unsigned char[sizeof(::io_uring_probe) + __nops * sizeof(::io_uring_probe_op)]()};
+    auto* __probe = reinterpret_cast<::io_uring_probe*>(__storage.get());
+    if (__probe == nullptr || ::syscall(__NR_io_uring_register, __fd_, IORING_REGISTER_PROBE, __probe, __nops) < 0)
+    {
+      return false;
+    }
+    for (unsigned __op : {IORING_OP_NOP, IORING_OP_READ, IORING_OP_WRITE, IORING_OP_READ_FIXED, IORING_OP_WRITE_FIXED})
+    {
+      if (__op > __probe->last_op || !(__probe->ops[__op].flags & IO_URING_OP_SUPPORTED))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  _CCCL_HOST_API void __reset() noexcept
+  {
+    if (__sqes_ != nullptr)
+    {
+      ::munmap(__sqes_, __sq_entries_ * sizeof(::io_uring_sqe));
+    }
+    if (__cq_ring_ != nullptr && __cq_ring_ != __sq_ring_)
+    {
+      ::munmap(__cq_ring_, __cq_ring_size_);
+    }
+    if (__sq_ring_ != nullptr)
+    {
+      ::munmap(__sq_ring_, __sq_ring_size_);
+    }
+    if (__fd_ >= 0)
+    {
+      ::close(__fd_);
+    }
+    __fd_      = -1;
+    __sq_ring_ = __cq_ring_ = nullptr;
+    __sqes_    = nullptr;
+  }
+
+  int __fd_               = -1;
+  void* __sq_ring_        = nullptr;
+  void* __cq_ring_        = nullptr;
+  size_t __sq_ring_size_  = 0;
+  size_t __cq_ring_size_  = 0;
+  ::io_uring_sqe* __sqes_ = nullptr;
+  ::io_uring_cqe* __cqes_ = nullptr;
+  unsigned __sq_entries_  = 0;
+  unsigned __cq_entries_  = 0;
+  unsigned* __sq_head_    = nullptr;
+  unsigned* __sq_tail_    = nullptr;
+  unsigned* __sq_array_   = nullptr;
+  unsigned __sq_mask_     = 0;
+  unsigned* __cq_head_    = nullptr;
+  unsigned* __cq_tail_    = nullptr;
+  unsigned __cq_mask_     = 0;
+};
+
+//! Executes I/O requests asynchronously, and completes them on threads owned by the engine.
+//!
+//! When io_uring is available, one thread submits the requests in batches and reaps their completions. Requests are
+//! handed to it through a lock-free queue, and an eventfd read that is always pending on the ring wakes it up. On
+//! kernels without io_uring, a pool of threads performs the requests with blocking system calls instead.
+class __io_engine : __immovable
+{
+public:
+  _CCCL_HOST_API explicit __io_engine(unsigned __entries, unsigned __fallback_threads)
+      : __ring_{__entries}
+  {
+    _CCCL_TRY
+    {
+      if (__ring_)
+      {
+        __event_fd_ = ::eventfd(0, EFD_CLOEXEC);
+        if (__event_fd_ < 0)
+        {
+          _CCCL_THROW(::std::system_error, errno, ::std::system_category(), "eventfd failed");
+        }
+        __threads_.emplace_back([this] {
+          __run_ring();
+        });
+      }
+      else
+      {
+        for (unsigned __i = 0; __i < (::cuda::std::max) (__fallback_threads, 1u); ++__i)
+        {
+          __threads_.emplace_back([this] {
+            __run_worker();
+          });
+        }
+      }
+    }
+    _CCCL_CATCH_ALL
+    {
+      __join();
+      _CCCL_RETHROW;
+    }
+  }
+
+  _CCCL_HOST_API ~__io_engine()
+  {
+    __join();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __uses_io_uring() const noexcept -> bool
+  {
+    return static_cast<bool>(__ring_);
+  }
+
+  _CCCL_HOST_API void __submit(__io_op* __op) noexcept
+  {
+    if (__ring_)
+    {
+      // Only the push that makes the queue non-empty needs to wake up the ring thread.
+      if (__pending_.push(__op))
+      {
+        __wake();
+      }
+    }
+    else
+    {
+      {
+        ::std::lock_guard<::std::mutex> __guard{__mutex_};
+        __work_.push_back(__op);
+      }
+      __cv_.notify_one();
+    }
+  }
+
+  //! Registers buffers with the ring for requests with a non-negative buffer index. Does nothing without io_uring.
+  _CCCL_HOST_API void __register_buffers(const ::iovec* __iovecs, unsigned __count)
+  {
+    if (__ring_)
+    {
+      __ring_.__register_buffers(__iovecs, __count);
+    }
+  }
+
+  //! Completes the requests that were already submitted and joins the threads of the engine.
+  _CCCL_HOST_API void __join() noexcept
+  {
+    {
+      ::std::lock_guard<::std::mutex> __guard{__mutex_};
+      __stopping_.store(true, ::cuda::std::memory_order_release);
+    }
+    if (__ring_ && __event_fd_ >= 0)
+    {
+      __wake();
+    }
+    __cv_.notify_all();
+    for (auto& __worker : __threads_)
+    {
+      if (__worker.joinable())
+      {
+        __worker.join();
+      }
+    }
+    __threads_.clear();
+    if (__event_fd_ >= 0)
+    {
+      ::close(__event_fd_);
+      __event_fd_ = -1;
+    }
+  }
+
+private:
+  static constexpr ::__u64 __wake_tag = 0;
+
+  _CCCL_HOST_API void __wake() noexcept
+  {
+    ::eventfd_write(__event_fd_, 1);
+  }
+
+  _CCCL_HOST_API static void __prep(::io_uring_sqe* __sqe, const __io_request& __request) noexcept
+  {
+    switch (__request.__opcode_)
+    {
+      case __io_opcode::__nop:
+        __sqe->opcode = IORING_OP_NOP;
+        return;
+      case __io_opcode::__read:
+        __sqe->opcode = __request.__buffer_index_ < 0 ? IORING_OP_READ : IORING_OP_READ_FIXED;
+        break;
+      case __io_opcode::__write:
+        __sqe->opcode = __request.__buffer_index_ < 0 ? IORING_OP_WRITE : IORING_OP_WRITE_FIXED;
+        break;
+    }
+    __sqe->fd   = __request.__fd_;
+    __sqe->addr = reinterpret_cast<::__u64>(__request.__data_);
+    __sqe->len  = static_cast<::__u32>((::cuda::std::min) (__request.__size_, __io_uring::__max_transfer));
+    __sqe->off  = static_cast<::__u64>(__request.__offset_ < 0 ? -1 : __request.__offset_);
+    if (__request.__buffer_index_ >= 0)
+    {
+      __sqe->buf_index = static_cast<::__u16>(__request.__buffer_index_);
+    }
+  }
+
+  _CCCL_HOST_API void __run_ring() noexcept
+  {
+    __intrusive_queue<&__io_op::__next_> __backlog{};
+    unsigned __in_flight = 0;
+    bool __wake_pending  = false;
+    // One completion queue entry is kept for the read of the eventfd.
+    const unsigned __max_in_flight = __ring_.__cq_entries() - 1;
+
+    for (;;)
+    {
+      if (!__wake_pending)
+      {
+        ::io_uring_sqe* __sqe = __ring_.__get_sqe();
+        if (__sqe != nullptr)
+        {
+          __sqe->opcode    = IORING_OP_READ;
+          __sqe->fd        = __event_fd_;
+          __sqe->addr      = reinterpret_cast<::__u64>(&__event_count_);
+          __sqe->len       = sizeof(__event_count_);
+          __sqe->user_data = __wake_tag;
+          __wake_pending   = true;
+        }
+      }
+
+      __backlog.append(__pending_.pop_all());
+      while (!__backlog.empty() && __in_flight < __max_in_flight)
+      {
+        ::io_uring_sqe* __sqe = __ring_.__get_sqe();
+        if (__sqe == nullptr)
+        {
+          break;
+        }
+        __io_op* __op = __backlog.pop_front();
+        __prep(__sqe, __op->__request_);
+        __sqe->user_data = reinterpret_cast<::__u64>(__op);
+        ++__in_flight;
+      }
+
+      if (__in_flight == 0 && __backlog.empty() && __stopping_.load(::cuda::std::memory_order_acquire))
+      {
+        // The pending read of the eventfd is cancelled when the ring is closed.
+        return;
+      }
+
+      __ring_.__submit_and_wait(1);
+      __ring_.__reap([&](::__u64 __user_data, int __res) {
+        if (__user_data == __wake_tag)
+        {
+          __wake_pending = false;
+        }
+        else
+        {
+          --__in_flight;
+          auto* __op = reinterpret_cast<__io_op*>(__user_data);
+          __op->__complete_(__op, __res);
+        }
+      });
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static auto __perform(const __io_request& __request) noexcept -> long
+  {
+    const size_t __size = (::cuda::std::min) (__request.__size_, __io_uring::__max_transfer);
+    ::ssize_t __res     = 0;
+    switch (__request.__opcode_)
+    {
+      case __io_opcode::__nop:
+        return 0;
+      case __io_opcode::__read:
+        __res = __request.__offset_ < 0
+                ? ::read(__request.__fd_, __request.__data_, __size)
+                : ::pread(__request.__fd_, __request.__data_, __size, static_cast<::off_t>(__request.__offset_));
+        break;
+      case __io_opcode::__write:
+        __res = __request.__offset_ < 0
+                ? ::write(__request.__fd_, __request.__data_, __size)
+                : ::pwrite(__request.__fd_, __request.__data_, __size, static_cast<::off_t>(__request.__offset_));
+        break;
+    }
+    return __res < 0 ? -errno : static_cast<long>(__res);
+  }
+
+  _CCCL_HOST_API void __run_worker() noexcept
+  {
+    ::std::unique_lock<::std::mutex> __lock{__mutex_};
+    for (;;)
+    {
+      __cv_.wait(__lock, [this] {
+        return !__work_.empty() || __stopping_.load(::cuda::std::memory_order_relaxed);
+      });
+      if (__work_.empty())
+      {
+        return;
+      }
+      __io_op* __op = __work_.pop_front();
+      __lock.unlock();
+      __op->__complete_(__op, __perform(__op->__request_));
+      __lock.lock();
+    }
+  }
+
+  __io_uring __ring_;
+  int __event_fd_ = -1;
+  ::eventfd_t __event_count_{};
+  __atomic_intrusive_queue<&__io_op::__next_> __pending_{};
+  ::cuda::std::atomic<bool> __stopping_{false};
+  ::std::mutex __mutex_;
+  ::std::condition_variable __cv_;
+  __intrusive_queue<&__io_op::__next_> __work_{};
+  ::std::vector<::std::thread> __threads_;
+};
+} // namespace cuda::experimental::execution
+
+#  include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // _CCCL_OS(LINUX) && __has_include(<linux/io_uring.h>)
+
+#endif // __CUDAX_EXECUTION_IO_ENGINE
@@ -0,0 +1,170 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_SPAWN
+#define __CUDAX_EXECUTION_SPAWN
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__exception/exception_macros.h>
+#include <cuda/std/__exception/terminate.h>
+
+#include <cuda/experimental/__execution/counting_scope.cuh>
+#include <cuda/experimental/__execution/cpos.cuh>
+#include <cuda/experimental/__execution/env.cuh>
+#include <cuda/experimental/__execution/queries.cuh>
+#include <cuda/experimental/__execution/utility.cuh>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+namespace __detail
+{
+//! The environment of work started by @c spawn and @c spawn_future: the stop token of the scope, followed by the
+//! environment passed by the caller.
+template <class _Token, class _Env>
+using __scope_env_t _CCCL_NODEBUG_ALIAS =
+  env<prop<get_stop_token_t, stop_token_of_t<_Token>>, __env_ref_t<const _Env&>>;
+
+template <class _Token, class _Env>
+[[nodiscard]] _CCCL_API auto __mk_scope_env(const _Token& __token, const _Env& __env) noexcept
+  -> __scope_env_t<_Token, _Env>
+{
+  return __scope_env_t<_Token, _Env>{{get_stop_token, get_stop_token(__token)}, __env_ref(__env)};
+}
+
+} // namespace __detail
+
+struct spawn_t
+{
+  _CUDAX_SEMI_PRIVATE :
+  template <class _Token, class _Env>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_base_t
+  {
+    _Token __token_;
+    _Env __env_;
+    void (*__complete_)(__opstate_base_t*) noexcept;
+  };
+
+  template <class _Token, class _Env>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __rcvr_t
+  {
+    using receiver_concept = receiver_t;
+
+    template <class... _As>
+    _CCCL_API void set_value(_As&&...) noexcept
+    {
+      __opstate_->__complete_(__opstate_);
+    }
+
+    template <class _Error>
+    _CCCL_API void set_error(_Error&&) noexcept
+    {
+      ::cuda::std::terminate();
+    }
+
+    _CCCL_API void set_stopped() noexcept
+    {
+      __opstate_->__complete_(__opstate_);
+    }
+
+    [[nodiscard]] _CCCL_API auto get_env() const noexcept -> __detail::__scope_env_t<_Token, _Env>
+    {
+      return __detail::__mk_scope_env(__opstate_->__token_, __opstate_->__env_);
+    }
+
+    __opstate_base_t<_Token, _Env>* __opstate_;
+  };
+
+  template <class _Sndr, class _Token, class _Env, class _Alloc>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_t : __opstate_base_t<_Token, _Env>
+  {
+    using operation_state_concept = operation_state_t;
+    using __base_t                = __opstate_base_t<_Token, _Env>;
+
+    _CCCL_API explicit __opstate_t(_Sndr&& __sndr, _Token __token, _Env __env, _Alloc __alloc)
+        : __base_t{static_cast<_Token&&>(__token), static_cast<_Env&&>(__env), &__complete}
+        , __alloc_(static_cast<_Alloc&&>(__alloc))
+        , __opstate_(execution::connect(static_cast<_Sndr&&>(__sndr), __rcvr_t<_Token, _Env>{this}))
+    {}
+
+    _CCCL_IMMOVABLE(__opstate_t);
+
+    _CCCL_API void start() noexcept
+    {
+      execution::start(__opstate_);
+    }
+
+    // The association ends after the operation state is deallocated, so that the allocator may be destroyed as soon
+    // as the scope is joined.
+    _CCCL_API static void __complete(__base_t* __base) noexcept
+    {
+      auto* __self   = static_cast<__opstate_t*>(__base);
+      _Token __token = __self->__token_;
+      execution::__delete_with_allocator(__self, __self->__alloc_);
+      __token.disassociate();
+    }
+
+    _Alloc __alloc_;
+    connect_result_t<_Sndr, __rcvr_t<_Token, _Env>> __opstate_;
+  };
+
+public:
+  //! @brief Starts @c __sndr as work associated with the scope of @c __token, without waiting for its completion.
+  //!
+  //! The operation state is allocated with the allocator returned by @c get_allocator(__env), so that detached work
+  //! can be allocated from a pool. If the scope is closed, @c __sndr is not started. If the allocation or the
+  //! connection of @c __sndr throws, the association is ended and the exception is rethrown.
+  //!
+  //! The environment of the started operation answers @c get_stop_token with the stop token of @c __token, and
+  //! forwards other queries to @c __env. The operation must not complete with an error.
+  template <class _Sndr, class _Token, class _Env = env<>>
+  _CCCL_API void operator()(_Sndr __sndr, _Token __token, _Env __env = {}) const
+  {
+    static_assert(scope_token<_Token>, "spawn requires a scope token, such as the one of a counting_scope");
+    using __alloc_t   = decay_t<__call_result_t<get_allocator_t, const _Env&>>;
+    using __opstate_t = spawn_t::__opstate_t<_Sndr, _Token, _Env, __alloc_t>;
+
+    if (!__token.try_associate())
+    {
+      return;
+    }
+
+    _CCCL_TRY
+    {
+      __alloc_t __alloc = get_allocator(__env);
+      auto* __opstate   = execution::__new_with_allocator<__opstate_t>(
+        __alloc, static_cast<_Sndr&&>(__sndr), __token, static_cast<_Env&&>(__env), __alloc);
+      execution::start(*__opstate);
+    }
+    _CCCL_CATCH_ALL
+    {
+      __token.disassociate();
+      _CCCL_RETHROW;
+    }
+  }
+};
+
+_CCCL_GLOBAL_CONSTANT spawn_t spawn{};
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_SPAWN
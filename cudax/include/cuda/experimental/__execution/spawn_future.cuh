@@ -0,0 +1,346 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_SPAWN_FUTURE
+#define __CUDAX_EXECUTION_SPAWN_FUTURE
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__exception/exception_macros.h>
+#include <cuda/std/__type_traits/conjunction.h>
+#include <cuda/std/__utility/exchange.h>
+#include <cuda/std/__utility/pod_tuple.h>
+#include <cuda/std/atomic>
+
+#include <cuda/experimental/__execution/completion_signatures.cuh>
+#include <cuda/experimental/__execution/counting_scope.cuh>
+#include <cuda/experimental/__execution/cpos.cuh>
+#include <cuda/experimental/__execution/env.cuh>
+#include <cuda/experimental/__execution/exception.cuh>
+#include <cuda/experimental/__execution/queries.cuh>
+#include <cuda/experimental/__execution/spawn.cuh>
+#include <cuda/experimental/__execution/utility.cuh>
+#include <cuda/experimental/__execution/variant.cuh>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+struct spawn_future_t
+{
+  _CUDAX_SEMI_PRIVATE :
+  template <class _Tag, class... _As>
+  using __decayed_sig_t _CCCL_NODEBUG_ALIAS = _Tag(decay_t<_As>...);
+
+  template <class _Sigs>
+  using __nothrow_results_t _CCCL_NODEBUG_ALIAS =
+    typename _Sigs::template __transform_q<__nothrow_decay_copyable_t, ::cuda::std::_And>;
+
+  //! The completions of the spawned sender, plus an exception_ptr error if decay-copying its results may throw.
+  template <class _Sigs>
+  using __child_completions_t _CCCL_NODEBUG_ALIAS =
+    __concat_completion_signatures_t<_Sigs, __eptr_completion_if_t<!__nothrow_results_t<_Sigs>::value>>;
+
+  struct __send_result_fn
+  {
+    template <class _Rcvr, class _Tag, class... _As>
+    _CCCL_API void operator()(_Rcvr& __rcvr, _Tag, _As&... __args) const noexcept
+    {
+      _Tag{}(static_cast<_Rcvr&&>(__rcvr), static_cast<_As&&>(__args)...);
+    }
+  };
+
+  struct __send_result_visitor
+  {
+    template <class _Rcvr, class _Tuple>
+    _CCCL_API void operator()(_Rcvr& __rcvr, _Tuple& __tuple) const noexcept
+    {
+      ::cuda::std::__apply(__send_result_fn{}, __tuple, __rcvr);
+    }
+  };
+
+  static constexpr int __child_done        = 1;
+  static constexpr int __consumer_attached = 2;
+
+  //! The state shared by the spawned operation and the future. It is released by both, and the last one destroys it.
+  template <class _Results, class _Token, class _Env>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __state_base_t
+  {
+    _CCCL_API explicit __state_base_t(_Token __token, _Env __env, void (*__destroy)(__state_base_t*) noexcept)
+        : __token_(static_cast<_Token&&>(__token))
+        , __env_(static_cast<_Env&&>(__env))
+        , __destroy_(__destroy)
+    {}
+
+    _CCCL_IMMOVABLE(__state_base_t);
+
+    //! Called by the future once it is started. The results are delivered now if the spawned operation has already
+    //! completed, or by the spawned operation when it completes.
+    _CCCL_API void __attach(void* __consumer, void (*__deliver)(void*, _Results&) noexcept) noexcept
+    {
+      __consumer_ = __consumer;
+      __deliver_  = __deliver;
+      if (__flags_.fetch_or(__consumer_attached, ::cuda::std::memory_order_acq_rel) & __child_done)
+      {
+        __deliver_(__consumer_, __results_);
+      }
+    }
+
+    //! Called by the spawned operation once its results are stored.
+    _CCCL_API void __complete() noexcept
+    {
+      if (__flags_.fetch_or(__child_done, ::cuda::std::memory_order_acq_rel) & __consumer_attached)
+      {
+        __deliver_(__consumer_, __results_);
+      }
+      __release();
+    }
+
+    _CCCL_API void __release() noexcept
+    {
+      if (__refs_.fetch_sub(1, ::cuda::std::memory_order_acq_rel) == 1)
+      {
+        __destroy_(this);
+      }
+    }
+
+    _Token __token_;
+    _Env __env_;
+    _Results __results_{};
+    ::cuda::std::atomic<int> __flags_{0};
+    ::cuda::std::atomic<int> __refs_{2};
+    void* __consumer_                             = nullptr;
+    void (*__deliver_)(void*, _Results&) noexcept = nullptr;
+    void (*__destroy_)(__state_base_t*) noexcept;
+  };
+
+  // This receiver is connected to the spawned sender. It stashes the results into the shared state.
+  template <class _Results, class _Token, class _Env>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __rcvr_t
+  {
+    using receiver_concept = receiver_t;
+
+    template <class _Tag, class... _As>
+    _CCCL_API void __set_result(_Tag, _As&&... __as) noexcept
+    {
+      using __tupl_t _CCCL_NODEBUG_ALIAS = ::cuda::std::__tuple<_Tag, decay_t<_As>...>;
+      _CCCL_TRY
+      {
+        __state_->__results_.template __emplace<__tupl_t>(_Tag{}, static_cast<_As&&>(__as)...);
+      }
+      _CCCL_CATCH_ALL
+      {
+        // Avoid ODR-using this completion operation if this code path is not taken.
+        if constexpr (!__nothrow_decay_copyable<_As...>)
+        {
+          using __eptr_tupl_t _CCCL_NODEBUG_ALIAS = ::cuda::std::__tuple<set_error_t, exception_ptr>;
+          __state_->__results_.template __emplace<__eptr_tupl_t>(set_error_t{}, execution::current_exception());
+        }
+      }
+      __state_->__complete();
+    }
+
+    template <class... _As>
+    _CCCL_API void set_value(_As&&... __as) noexcept
+    {
+      __set_result(set_value_t{}, static_cast<_As&&>(__as)...);
+    }
+
+    template <class _Error>
+    _CCCL_API void set_error(_Error&& __error) noexcept
+    {
+      __set_result(set_error_t{}, static_cast<_Error&&>(__error));
+    }
+
+    _CCCL_API void set_stopped() noexcept
+    {
+      __set_result(set_stopped_t{});
+    }
+
+    [[nodiscard]] _CCCL_API auto get_env() const noexcept -> __detail::__scope_env_t<_Token, _Env>
+    {
+      return __detail::__mk_scope_env(__state_->__token_, __state_->__env_);
+    }
+
+    __state_base_t<_Results, _Token, _Env>* __state_;
+  };
+
+  template <class _Sndr, class _Results, class _Token, class _Env, class _Alloc>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __state_t : __state_base_t<_Results, _Token, _Env>
+  {
+    using __base_t = __state_base_t<_Results, _Token, _Env>;
+
+    _CCCL_API explicit __state_t(_Sndr&& __sndr, _Token __token, _Env __env, _Alloc __alloc)
+        : __base_t{static_cast<_Token&&>(__token), static_cast<_Env&&>(__env), &__destroy}
+        , __alloc_(static_cast<_Alloc&&>(__alloc))
+        , __opstate_(execution::connect(static_cast<_Sndr&&>(__sndr), __rcvr_t<_Results, _Token, _Env>{this}))
+    {}
+
+    _CCCL_API static void __destroy(__base_t* __base) noexcept
+    {
+      auto* __self   = static_cast<__state_t*>(__base);
+      _Token __token = __self->__token_;
+      execution::__delete_with_allocator(__self, __self->__alloc_);
+      __token.disassociate();
+    }
+
+    _Alloc __alloc_;
+    connect_result_t<_Sndr, __rcvr_t<_Results, _Token, _Env>> __opstate_;
+  };
+
+  template <class _Results, class _Token, class _Env, class _Rcvr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_t
+  {
+    using operation_state_concept = operation_state_t;
+
+    _CCCL_API explicit __opstate_t(__state_base_t<_Results, _Token, _Env>* __state, _Rcvr __rcvr) noexcept
+        : __state_(__state)
+        , __rcvr_(static_cast<_Rcvr&&>(__rcvr))
+    {}
+
+    _CCCL_IMMOVABLE(__opstate_t);
+
+    _CCCL_API ~__opstate_t()
+    {
+      if (__state_ != nullptr)
+      {
+        __state_->__release();
+      }
+    }
+
+    _CCCL_API void start() noexcept
+    {
+      if (__state_ == nullptr)
+      {
+        // The scope was closed when the future was spawned.
+        execution::set_stopped(static_cast<_Rcvr&&>(__rcvr_));
+      }
+      else
+      {
+        __state_->__attach(this, &__deliver);
+      }
+    }
+
+  private:
+    _CCCL_API static void __deliver(void* __ptr, _Results& __results) noexcept
+    {
+      auto* __self = static_cast<__opstate_t*>(__ptr);
+      __visit(__send_result_visitor{}, __results, __self->__rcvr_);
+    }
+
+    __state_base_t<_Results, _Token, _Env>* __state_;
+    _Rcvr __rcvr_;
+  };
+
+public:
+  //! @brief The sender returned by @c spawn_future. It completes with the results of the spawned sender.
+  template <class _Completions, class _Results, class _Token, class _Env>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __sndr_t
+  {
+    using sender_concept = sender_t;
+
+    _CCCL_API explicit __sndr_t(__state_base_t<_Results, _Token, _Env>* __state) noexcept
+        : __state_(__state)
+    {}
+
+    _CCCL_API __sndr_t(__sndr_t&& __other) noexcept
+        : __state_(::cuda::std::exchange(__other.__state_, nullptr))
+    {}
+
+    //! Dropping the future without starting it does not stop the spawned operation. Its results are discarded when
+    //! it completes.
+    _CCCL_API ~__sndr_t()
+    {
+      if (__state_ != nullptr)
+      {
+        __state_->__release();
+      }
+    }
+
+    template <class _Self, class... _RcvrEnv>
+    [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto get_completion_signatures() noexcept
+    {
+      return _Completions{};
+    }
+
+    template <class _Rcvr>
+    [[nodiscard]] _CCCL_API auto connect(_Rcvr __rcvr) && noexcept(__nothrow_movable<_Rcvr>)
+      -> __opstate_t<_Results, _Token, _Env, _Rcvr>
+    {
+      return __opstate_t<_Results, _Token, _Env, _Rcvr>{
+        ::cuda::std::exchange(__state_, nullptr), static_cast<_Rcvr&&>(__rcvr)};
+    }
+
+  private:
+    __state_base_t<_Results, _Token, _Env>* __state_;
+  };
+
+  //! @brief Starts @c __sndr as work associated with the scope of @c __token, and returns a sender that completes
+  //! with its results.
+  //!
+  //! The spawned operation and the storage for its results are allocated with the allocator returned by
+  //! @c get_allocator(__env). The association with the scope ends once both the spawned operation has completed and
+  //! the returned sender has been destroyed, or its operation state has. If the scope is closed, @c __sndr is not
+  //! started and the returned sender completes with @c set_stopped().
+  //!
+  //! The environment of the spawned operation answers @c get_stop_token with the stop token of @c __token, and
+  //! forwards other queries to @c __env.
+  template <class _Sndr, class _Token, class _Env = env<>>
+  [[nodiscard]] _CCCL_API auto operator()(_Sndr __sndr, _Token __token, _Env __env = {}) const
+  {
+    static_assert(scope_token<_Token>, "spawn_future requires a scope token, such as the one of a counting_scope");
+    using __alloc_t      = decay_t<__call_result_t<get_allocator_t, const _Env&>>;
+    using __child_env_t  = __detail::__scope_env_t<_Token, _Env>;
+    using __child_sigs_t = __child_completions_t<completion_signatures_of_t<_Sndr, __child_env_t>>;
+    using __results_t    = typename __child_sigs_t::template __transform_q<::cuda::std::__decayed_tuple, __variant>;
+    using __sigs_t       = __concat_completion_signatures_t<
+      typename __child_sigs_t::template __transform_q<__decayed_sig_t, completion_signatures>,
+      completion_signatures<set_stopped_t()>>;
+    using __state_t      = spawn_future_t::__state_t<_Sndr, __results_t, _Token, _Env, __alloc_t>;
+    using __sndr_t       = spawn_future_t::__sndr_t<__sigs_t, __results_t, _Token, _Env>;
+
+    if (!__token.try_associate())
+    {
+      // The scope is closed, so __sndr is not started and the future completes with set_stopped.
+      return __sndr_t{nullptr};
+    }
+
+    __state_t* __state = nullptr;
+    _CCCL_TRY
+    {
+      __alloc_t __alloc = get_allocator(__env);
+      __state           = execution::__new_with_allocator<__state_t>(
+        __alloc, static_cast<_Sndr&&>(__sndr), __token, static_cast<_Env&&>(__env), __alloc);
+    }
+    _CCCL_CATCH_ALL
+    {
+      __token.disassociate();
+      _CCCL_RETHROW;
+    }
+    execution::start(__state->__opstate_);
+    return __sndr_t{__state};
+  }
+};
+
+_CCCL_GLOBAL_CONSTANT spawn_future_t spawn_future{};
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_SPAWN_FUTURE
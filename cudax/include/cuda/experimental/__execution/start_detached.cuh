@@ -28,6 +28,7 @@
 #include <cuda/experimental/__execution/apply_sender.cuh>
 #include <cuda/experimental/__execution/cpos.cuh>
 #include <cuda/experimental/__execution/env.cuh>
+#include <cuda/experimental/__execution/queries.cuh>
 #include <cuda/experimental/__execution/utility.cuh>
 
 #include <cuda/experimental/__execution/prologue.cuh>
@@ -37,20 +38,22 @@ namespace cuda::experimental::execution
 struct start_detached_t
 {
 private:
+  template <class _Env>
   struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_base_t
-  {};
+  {
+    _Env __env_;
+    void (*__destroy_)(__opstate_base_t*) noexcept;
+  };
 
+  template <class _Env>
   struct _CCCL_TYPE_VISIBILITY_DEFAULT __rcvr_t
   {
     using receiver_concept = receiver_t;
 
-    __opstate_base_t* __opstate_;
-    void (*__destroy)(__opstate_base_t*) noexcept;
-
     template <class... _As>
     constexpr void set_value(_As&&...) noexcept
     {
-      __destroy(__opstate_);
+      __opstate_->__destroy_(__opstate_);
     }
 
     template <class _Error>
@@ -61,23 +64,33 @@ private:
 
     constexpr void set_stopped() noexcept
     {
-      __destroy(__opstate_);
+      __opstate_->__destroy_(__opstate_);
+    }
+
+    [[nodiscard]] _CCCL_API constexpr auto get_env() const noexcept -> __env_ref_t<const _Env&>
+    {
+      return __env_ref(__opstate_->__env_);
     }
+
+    __opstate_base_t<_Env>* __opstate_;
   };
 
-  template <class _Sndr>
-  struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_t : __opstate_base_t
+  template <class _Sndr, class _Env, class _Alloc>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_t : __opstate_base_t<_Env>
   {
     using operation_state_concept = operation_state_t;
-    connect_result_t<_Sndr, __rcvr_t> __opstate_;
+    using __base_t                = __opstate_base_t<_Env>;
 
-    static void __destroy(__opstate_base_t* __ptr) noexcept
+    _CCCL_API static void __destroy(__base_t* __ptr) noexcept
     {
-      delete static_cast<__opstate_t*>(__ptr);
+      auto* __self = static_cast<__opstate_t*>(__ptr);
+      execution::__delete_with_allocator(__self, __self->__alloc_);
     }
 
-    _CCCL_API constexpr explicit __opstate_t(_Sndr&& __sndr)
-        : __opstate_(execution::connect(static_cast<_Sndr&&>(__sndr), __rcvr_t{this, &__destroy}))
+    _CCCL_API explicit __opstate_t(_Sndr&& __sndr, _Env __env, _Alloc __alloc)
+        : __base_t{static_cast<_Env&&>(__env), &__destroy}
+        , __alloc_(static_cast<_Alloc&&>(__alloc))
+        , __opstate_(execution::connect(static_cast<_Sndr&&>(__sndr), __rcvr_t<_Env>{this}))
     {}
 
     _CCCL_IMMOVABLE(__opstate_t);
@@ -86,21 +99,29 @@ private:
     {
       execution::start(__opstate_);
     }
+
+    _Alloc __alloc_;
+    connect_result_t<_Sndr, __rcvr_t<_Env>> __opstate_;
   };
 
 public:
-  template <class _Sndr>
-  _CCCL_API static auto apply_sender(_Sndr __sndr)
+  template <class _Sndr, class _Env = env<>>
+  _CCCL_API static auto apply_sender(_Sndr __sndr, _Env __env = {})
   {
-    execution::start(*new __opstate_t<_Sndr>{static_cast<_Sndr&&>(__sndr)});
+    using __alloc_t   = decay_t<__call_result_t<get_allocator_t, const _Env&>>;
+    using __opstate_t = start_detached_t::__opstate_t<_Sndr, _Env, __alloc_t>;
+    __alloc_t __alloc = get_allocator(__env);
+    execution::start(*execution::__new_with_allocator<__opstate_t>(
+      __alloc, static_cast<_Sndr&&>(__sndr), static_cast<_Env&&>(__env), __alloc));
   }
 
-  /// run detached.
-  template <class _Sndr>
-  _CCCL_API void operator()(_Sndr __sndr) const
+  /// run detached. The operation state is allocated with the allocator returned by `get_allocator(__env)`, and the
+  /// environment of the operation forwards all queries to `__env`.
+  template <class _Sndr, class _Env = env<>>
+  _CCCL_API void operator()(_Sndr __sndr, _Env __env = {}) const
   {
-    using __domain_t _CCCL_NODEBUG_ALIAS = __completion_domain_of_t<set_value_t, _Sndr, env<>>;
-    execution::apply_sender(__domain_t{}, *this, static_cast<_Sndr&&>(__sndr));
+    using __domain_t _CCCL_NODEBUG_ALIAS = __completion_domain_of_t<set_value_t, _Sndr, __env_ref_t<const _Env&>>;
+    execution::apply_sender(__domain_t{}, *this, static_cast<_Sndr&&>(__sndr), static_cast<_Env&&>(__env));
   }
 };
 
@@ -0,0 +1,616 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_TIMED_RUN_LOOP
+#define __CUDAX_EXECUTION_TIMED_RUN_LOOP
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/__utility/swap.h>
+
+#include <cuda/experimental/__execution/completion_signatures.cuh>
+#include <cuda/experimental/__execution/cpos.cuh>
+#include <cuda/experimental/__execution/env.cuh>
+#include <cuda/experimental/__execution/intrusive_queue.cuh>
+#include <cuda/experimental/__execution/lazy.cuh>
+#include <cuda/experimental/__execution/queries.cuh>
+#include <cuda/experimental/__execution/stop_token.cuh>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+struct schedule_after_t
+{
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _Sch, class _Duration>
+  _CCCL_TRIVIAL_API constexpr auto operator()(_Sch&& __sch, const _Duration& __duration) const noexcept
+  {
+    static_assert(noexcept(static_cast<_Sch&&>(__sch).schedule_after(__duration)));
+    return static_cast<_Sch&&>(__sch).schedule_after(__duration);
+  }
+};
+
+struct schedule_at_t
+{
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _Sch, class _TimePoint>
+  _CCCL_TRIVIAL_API constexpr auto operator()(_Sch&& __sch, const _TimePoint& __time_point) const noexcept
+  {
+    static_assert(noexcept(static_cast<_Sch&&>(__sch).schedule_at(__time_point)));
+    return static_cast<_Sch&&>(__sch).schedule_at(__time_point);
+  }
+};
+
+_CCCL_GLOBAL_CONSTANT schedule_after_t schedule_after{};
+_CCCL_GLOBAL_CONSTANT schedule_at_t schedule_at{};
+
+//! @brief A run loop whose scheduler can also schedule work at a point in time.
+//!
+//! In addition to @c schedule(), the scheduler offers @c schedule_after(duration) and @c schedule_at(time_point).
+//! Timers are kept in an intrusive pairing heap, so scheduling a timer never allocates and takes constant time, and
+//! cancelling one takes logarithmic amortized time. All operations, including the expired timers, complete on the
+//! thread that calls @c run().
+//!
+//! A timer whose receiver has a stop token completes with @c set_stopped() as soon as stop is requested. Once
+//! @c finish() has been called, pending timers complete with @c set_stopped() rather than waiting for their deadline.
+class _CCCL_TYPE_VISIBILITY_DEFAULT timed_run_loop : __immovable
+{
+public:
+  using clock_type = ::std::chrono::steady_clock;
+  using time_point = clock_type::time_point;
+  using duration   = clock_type::duration;
+
+  class _CCCL_TYPE_VISIBILITY_DEFAULT scheduler;
+
+  _CCCL_HIDE_FROM_ABI timed_run_loop() = default;
+
+  _CCCL_HOST_API ~timed_run_loop()
+  {
+    _CCCL_ASSERT(__ready_.empty() && __timers_ == nullptr, "timed_run_loop destroyed while work is still pending");
+  }
+
+  //! @brief Executes scheduled work and expired timers until @c finish() is called and no work is left.
+  _CCCL_HOST_API void run()
+  {
+    ::std::unique_lock<::std::mutex> __lock{__mutex_};
+    for (;;)
+    {
+      if (__timers_ != nullptr)
+      {
+        __expire_timers(clock_type::now());
+      }
+
+      if (!__ready_.empty())
+      {
+        // Execute the ready tasks without holding the lock, so that they can schedule more work.
+        auto __tasks = ::cuda::std::move(__ready_);
+        __lock.unlock();
+        while (!__tasks.empty())
+        {
+          __tasks.pop_front()->__execute();
+        }
+        __lock.lock();
+        continue;
+      }
+
+      if (__finishing_)
+      {
+        return;
+      }
+
+      if (__timers_ != nullptr)
+      {
+        __cv_.wait_until(__lock, __timers_->__deadline_);
+      }
+      else
+      {
+        __cv_.wait(__lock);
+      }
+    }
+  }
+
+  //! @brief Makes @c run() return once no work is left. Pending timers complete with @c set_stopped().
+  _CCCL_HOST_API void finish()
+  {
+    {
+      ::std::lock_guard<::std::mutex> __guard{__mutex_};
+      __finishing_ = true;
+      while (__timers_ != nullptr)
+      {
+        __timer_node* __timer = __timers_;
+        __erase_timer(__timer);
+        __timer->__stopped_ = true;
+        __enqueue_timer(__timer);
+      }
+    }
+    __cv_.notify_one();
+  }
+
+  [[nodiscard]] _CCCL_API auto get_scheduler() noexcept -> scheduler;
+
+private:
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __task : __immovable
+  {
+    using __execute_fn_t _CCCL_NODEBUG_ALIAS = void(__task*) noexcept;
+
+    _CCCL_API explicit __task(__execute_fn_t* __execute_fn) noexcept
+        : __execute_fn_(__execute_fn)
+    {}
+
+    _CCCL_API void __execute() noexcept
+    {
+      (*__execute_fn_)(this);
+    }
+
+    __execute_fn_t* __execute_fn_;
+    __task* __next_ = nullptr;
+  };
+
+  enum class __timer_state : unsigned char
+  {
+    __unscheduled,
+    __pending,
+    __ready
+  };
+
+  // A node of the pairing heap of timers. __prev_ points to the parent of the leftmost child, and to the left
+  // sibling of every other child.
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __timer_node : __task
+  {
+    using __task::__task;
+
+    time_point __deadline_{};
+    __timer_node* __child_   = nullptr;
+    __timer_node* __sibling_ = nullptr;
+    __timer_node* __prev_    = nullptr;
+    __timer_state __state_   = __timer_state::__unscheduled;
+    bool __stopped_          = false;
+  };
+
+  template <class _Rcvr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_t;
+
+  template <class _Time, class _Rcvr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __timer_opstate_t;
+
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __attrs_t;
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __sndr_t;
+
+  template <class _Time>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __timer_sndr_t;
+
+  [[nodiscard]] _CCCL_HOST_API static auto __deadline_of(time_point __time_point) noexcept -> time_point
+  {
+    return __time_point;
+  }
+
+  // A relative timer is measured from the start of its operation, so that a sender can be started more than once.
+  [[nodiscard]] _CCCL_HOST_API static auto __deadline_of(duration __duration) noexcept -> time_point
+  {
+    return clock_type::now() + __duration;
+  }
+
+  _CCCL_HOST_API void __push(__task* __item)
+  {
+    bool __was_empty = false;
+    {
+      ::std::lock_guard<::std::mutex> __guard{__mutex_};
+      __was_empty = __ready_.empty();
+      __ready_.push_back(__item);
+    }
+    if (__was_empty)
+    {
+      __cv_.notify_one();
+    }
+  }
+
+  _CCCL_HOST_API void __schedule_timer(__timer_node* __timer)
+  {
+    bool __notify = false;
+    {
+      ::std::lock_guard<::std::mutex> __guard{__mutex_};
+      // start() schedules a timer exactly once, and a stop request that arrives before only marks it as stopped, so
+      // nothing else can have enqueued it yet.
+      _CCCL_ASSERT(__timer->__state_ == __timer_state::__unscheduled, "a timer must only be scheduled once");
+      if (__finishing_)
+      {
+        __timer->__stopped_ = true;
+      }
+      if (__timer->__stopped_)
+      {
+        __notify = __ready_.empty();
+        __enqueue_timer(__timer);
+      }
+      else
+      {
+        __timer->__state_ = __timer_state::__pending;
+        __timers_         = __meld(__timers_, __timer);
+        // Wake up the loop if it is waiting for a later deadline.
+        __notify = __timers_ == __timer;
+      }
+    }
+    if (__notify)
+    {
+      __cv_.notify_one();
+    }
+  }
+
+  _CCCL_HOST_API void __cancel_timer(__timer_node* __timer)
+  {
+    bool __notify = false;
+    {
+      ::std::lock_guard<::std::mutex> __guard{__mutex_};
+      switch (__timer->__state_)
+      {
+        case __timer_state::__unscheduled:
+          // __schedule_timer has not been called yet. It will enqueue the timer right away.
+          __timer->__stopped_ = true;
+          break;
+        case __timer_state::__pending:
+          __erase_timer(__timer);
+          __timer->__stopped_ = true;
+          __notify            = __ready_.empty();
+          __enqueue_timer(__timer);
+          break;
+        case __timer_state::__ready:
+          break;
+      }
+    }
+    if (__notify)
+    {
+      __cv_.notify_one();
+    }
+  }
+
+  // The following functions must be called with the mutex held.
+  _CCCL_HOST_API void __enqueue_timer(__timer_node* __timer) noexcept
+  {
+    __timer->__state_ = __timer_state::__ready;
+    __ready_.push_back(__timer);
+  }
+
+  _CCCL_HOST_API void __expire_timers(time_point __now) noexcept
+  {
+    while (__timers_ != nullptr && __timers_->__deadline_ <= __now)
+    {
+      __timer_node* __timer = __timers_;
+      __erase_timer(__timer);
+      __enqueue_timer(__timer);
+    }
+  }
+
+  _CCCL_HOST_API void __erase_timer(__timer_node* __timer) noexcept
+  {
+    if (__timer == __timers_)
+    {
+      __timers_ = __merge_pairs(__timer->__child_);
+    }
+    else
+    {
+      (__timer->__prev_->__child_ == __timer ? __timer->__prev_->__child_ : __timer->__prev_->__sibling_) =
+        __timer->__sibling_;
+      if (__timer->__sibling_ != nullptr)
+      {
+        __timer->__sibling_->__prev_ = __timer->__prev_;
+      }
+      __timers_ = __meld(__timers_, __merge_pairs(__timer->__child_));
+    }
+    __timer->__child_ = __timer->__sibling_ = __timer->__prev_ = nullptr;
+  }
+
+  // Links two heaps whose roots have no siblings and returns the root of the result.
+  [[nodiscard]] _CCCL_HOST_API static auto __meld(__timer_node* __first, __timer_node* __second) noexcept
+    -> __timer_node*
+  {
+    if (__first == nullptr || __second == nullptr)
+    {
+      return __first == nullptr ? __second : __first;
+    }
+    if (__second->__deadline_ < __first->__deadline_)
+    {
+      ::cuda::std::swap(__first, __second);
+    }
+    __second->__prev_    = __first;
+    __second->__sibling_ = __first->__child_;
+    if (__first->__child_ != nullptr)
+    {
+      __first->__child_->__prev_ = __second;
+    }
+    __first->__child_ = __second;
+    return __first;
+  }
+
+  // Merges a list of siblings into one heap: first pairwise from left to right, then from right to left.
+  [[nodiscard]] _CCCL_HOST_API static auto __merge_pairs(__timer_node* __first) noexcept -> __timer_node*
+  {
+    __timer_node* __pairs = nullptr; // linked through __sibling_, last pair first
+    while (__first != nullptr)
+    {
+      __timer_node* __second = __first->__sibling_;
+      __timer_node* __next   = __second != nullptr ? __second->__sibling_ : nullptr;
+      __first->__sibling_    = __first->__prev_ = nullptr;
+      if (__second != nullptr)
+      {
+        __second->__sibling_ = __second->__prev_ = nullptr;
+      }
+      __timer_node* __pair = __meld(__first, __second);
+      __pair->__sibling_   = __pairs;
+      __pairs              = __pair;
+      __first              = __next;
+    }
+
+    __timer_node* __root = nullptr;
+    while (__pairs != nullptr)
+    {
+      __timer_node* __next = __pairs->__sibling_;
+      __pairs->__sibling_  = nullptr;
+      __root               = __meld(__root, __pairs);
+      __pairs              = __next;
+    }
+    return __root;
+  }
+
+  ::std::mutex __mutex_;
+  ::std::condition_variable __cv_;
+  __intrusive_queue<&__task::__next_> __ready_{};
+  __timer_node* __timers_ = nullptr;
+  bool __finishing_  = false;
+};
+
+template <class _Rcvr>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT timed_run_loop::__opstate_t : timed_run_loop::__task
+{
+  using operation_state_concept = operation_state_t;
+
+  _CCCL_API explicit __opstate_t(timed_run_loop* __loop, _Rcvr __rcvr) noexcept
+      : __task{&__execute_impl}
+      , __loop_{__loop}
+      , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+  {}
+
+  _CCCL_HOST_API void start() noexcept
+  {
+    __loop_->__push(this);
+  }
+
+private:
+  _CCCL_API static void __execute_impl(__task* __p) noexcept
+  {
+    auto& __rcvr = static_cast<__opstate_t*>(__p)->__rcvr_;
+    if (get_stop_token(get_env(__rcvr)).stop_requested())
+    {
+      execution::set_stopped(static_cast<_Rcvr&&>(__rcvr));
+    }
+    else
+    {
+      execution::set_value(static_cast<_Rcvr&&>(__rcvr));
+    }
+  }
+
+  timed_run_loop* __loop_;
+  _Rcvr __rcvr_;
+};
+
+template <class _Time, class _Rcvr>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT timed_run_loop::__timer_opstate_t : timed_run_loop::__timer_node
+{
+  using operation_state_concept = operation_state_t;
+
+  _CCCL_API explicit __timer_opstate_t(timed_run_loop* __loop, _Time __time, _Rcvr __rcvr) noexcept
+      : __timer_node{&__execute_impl}
+      , __loop_{__loop}
+      , __time_{__time}
+      , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+  {}
+
+  _CCCL_HOST_API void start() noexcept
+  {
+    this->__deadline_ = timed_run_loop::__deadline_of(__time_);
+    // If stop has already been requested, the callback runs here and the timer is enqueued without being added to
+    // the heap.
+    __on_stop_.__construct(get_stop_token(get_env(__rcvr_)), __on_stop_t{this});
+    __loop_->__schedule_timer(this);
+  }
+
+private:
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __on_stop_t
+  {
+    _CCCL_HOST_API void operator()() const noexcept
+    {
+      __self_->__loop_->__cancel_timer(__self_);
+    }
+
+    __timer_opstate_t* __self_;
+  };
+
+  using __stop_token_t _CCCL_NODEBUG_ALIAS    = stop_token_of_t<env_of_t<_Rcvr>>;
+  using __stop_callback_t _CCCL_NODEBUG_ALIAS = stop_callback_for_t<__stop_token_t, __on_stop_t>;
+
+  _CCCL_API static void __execute_impl(__task* __p) noexcept
+  {
+    auto* __self = static_cast<__timer_opstate_t*>(__p);
+    // Destroying the callback waits for it to return if it is running on another thread.
+    __self->__on_stop_.__destroy();
+    if (__self->__stopped_ || get_stop_token(get_env(__self->__rcvr_)).stop_requested())
+    {
+      execution::set_stopped(static_cast<_Rcvr&&>(__self->__rcvr_));
+    }
+    else
+    {
+      execution::set_value(static_cast<_Rcvr&&>(__self->__rcvr_));
+    }
+  }
+
+  timed_run_loop* __loop_;
+  _Time __time_;
+  _Rcvr __rcvr_;
+  __lazy<__stop_callback_t> __on_stop_;
+};
+
+struct _CCCL_TYPE_VISIBILITY_DEFAULT timed_run_loop::__attrs_t
+{
+  [[nodiscard]] _CCCL_API auto query(get_completion_scheduler_t<set_value_t>) const noexcept -> scheduler;
+  [[nodiscard]] _CCCL_API auto query(get_completion_scheduler_t<set_stopped_t>) const noexcept -> scheduler;
+
+  [[nodiscard]] _CCCL_API constexpr auto query(get_completion_behavior_t) const noexcept
+  {
+    return completion_behavior::asynchronous;
+  }
+
+  timed_run_loop* __loop_;
+};
+
+struct _CCCL_TYPE_VISIBILITY_DEFAULT timed_run_loop::__sndr_t
+{
+  using sender_concept = sender_t;
+
+  template <class _Self>
+  [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto get_completion_signatures() noexcept
+  {
+    return completion_signatures<set_value_t(), set_stopped_t()>{};
+  }
+
+  template <class _Rcvr>
+  [[nodiscard]] _CCCL_API auto connect(_Rcvr __rcvr) const noexcept -> __opstate_t<_Rcvr>
+  {
+    return __opstate_t<_Rcvr>{__loop_, static_cast<_Rcvr&&>(__rcvr)};
+  }
+
+  [[nodiscard]] _CCCL_API auto get_env() const noexcept -> __attrs_t
+  {
+    return __attrs_t{__loop_};
+  }
+
+  timed_run_loop* __loop_;
+};
+
+template <class _Time>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT timed_run_loop::__timer_sndr_t
+{
+  using sender_concept = sender_t;
+
+  template <class _Self>
+  [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto get_completion_signatures() noexcept
+  {
+    return completion_signatures<set_value_t(), set_stopped_t()>{};
+  }
+
+  template <class _Rcvr>
+  [[nodiscard]] _CCCL_API auto connect(_Rcvr __rcvr) const noexcept -> __timer_opstate_t<_Time, _Rcvr>
+  {
+    return __timer_opstate_t<_Time, _Rcvr>{__loop_, __time_, static_cast<_Rcvr&&>(__rcvr)};
+  }
+
+  [[nodiscard]] _CCCL_API auto get_env() const noexcept -> __attrs_t
+  {
+    return __attrs_t{__loop_};
+  }
+
+  timed_run_loop* __loop_;
+  _Time __time_;
+};
+
+class _CCCL_TYPE_VISIBILITY_DEFAULT timed_run_loop::scheduler
+{
+  friend timed_run_loop;
+
+  _CCCL_API constexpr explicit scheduler(timed_run_loop* __loop) noexcept
+      : __loop_(__loop)
+  {}
+
+  timed_run_loop* __loop_;
+
+public:
+  using scheduler_concept = scheduler_t;
+
+  //! @brief Returns the current time of the clock of the loop.
+  [[nodiscard]] _CCCL_HOST_API static auto now() noexcept -> time_point
+  {
+    return clock_type::now();
+  }
+
+  [[nodiscard]] _CCCL_API auto schedule() const noexcept -> __sndr_t
+  {
+    return __sndr_t{__loop_};
+  }
+
+  //! @brief Returns a sender that completes on the loop once @c __time_point has been reached.
+  [[nodiscard]] _CCCL_API auto schedule_at(time_point __time_point) const noexcept -> __timer_sndr_t<time_point>
+  {
+    return __timer_sndr_t<time_point>{__loop_, __time_point};
+  }
+
+  //! @brief Returns a sender that completes on the loop once @c __duration has elapsed since the operation was
+  //! started.
+  template <class _Rep, class _Period>
+  [[nodiscard]] _CCCL_HOST_API auto schedule_after(::std::chrono::duration<_Rep, _Period> __duration) const noexcept
+    -> __timer_sndr_t<duration>
+  {
+    return __timer_sndr_t<duration>{__loop_, ::std::chrono::ceil<duration>(__duration)};
+  }
+
+  [[nodiscard]] _CCCL_API auto query(get_completion_scheduler_t<set_value_t>) const noexcept -> scheduler
+  {
+    return *this;
+  }
+
+  [[nodiscard]] _CCCL_API constexpr auto query(get_forward_progress_guarantee_t) const noexcept
+    -> forward_progress_guarantee
+  {
+    return forward_progress_guarantee::parallel;
+  }
+
+  [[nodiscard]] _CCCL_API friend constexpr bool operator==(const scheduler& __a, const scheduler& __b) noexcept
+  {
+    return __a.__loop_ == __b.__loop_;
+  }
+
+  [[nodiscard]] _CCCL_API friend constexpr bool operator!=(const scheduler& __a, const scheduler& __b) noexcept
+  {
+    return __a.__loop_ != __b.__loop_;
+  }
+};
+
+_CCCL_API inline auto timed_run_loop::get_scheduler() noexcept -> scheduler
+{
+  return scheduler{this};
+}
+
+_CCCL_API inline auto timed_run_loop::__attrs_t::query(get_completion_scheduler_t<set_value_t>) const noexcept
+  -> scheduler
+{
+  return scheduler{__loop_};
+}
+
+_CCCL_API inline auto timed_run_loop::__attrs_t::query(get_completion_scheduler_t<set_stopped_t>) const noexcept
+  -> scheduler
+{
+  return scheduler{__loop_};
+}
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_TIMED_RUN_LOOP
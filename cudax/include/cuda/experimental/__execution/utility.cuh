@@ -25,7 +25,9 @@
 #include <cuda/__utility/immovable.h>
 #include <cuda/std/__concepts/constructible.h>
 #include <cuda/std/__exception/cuda_error.h>
+#include <cuda/std/__exception/exception_macros.h>
 #include <cuda/std/__host_stdlib/new>
+#include <cuda/std/__memory/allocator_traits.h>
 #include <cuda/std/__memory/unique_ptr.h>
 #include <cuda/std/__tuple_dir/ignore.h>
 #include <cuda/std/__type_traits/copy_cvref.h>
@@ -201,6 +203,39 @@ private:
   ~__managed_box() = default;
 };
 
+//! @brief Allocates and constructs a @c _Ty with a copy of @c __alloc rebound to @c _Ty. Used for the operation
+//! states of detached work, which outlive the call that starts them.
+template <class _Ty, class _Alloc, class... _Args>
+[[nodiscard]] _CCCL_API auto __new_with_allocator(const _Alloc& __alloc, _Args&&... __args) -> _Ty*
+{
+  using __alloc_t  = typename ::cuda::std::allocator_traits<_Alloc>::template rebind_alloc<_Ty>;
+  using __traits_t = ::cuda::std::allocator_traits<__alloc_t>;
+  __alloc_t __alloc_copy{__alloc};
+  _Ty* __ptr = __traits_t::allocate(__alloc_copy, 1);
+  _CCCL_TRY
+  {
+    __traits_t::construct(__alloc_copy, __ptr, static_cast<_Args&&>(__args)...);
+  }
+  _CCCL_CATCH_ALL
+  {
+    __traits_t::deallocate(__alloc_copy, __ptr, 1);
+    _CCCL_RETHROW;
+  }
+  return __ptr;
+}
+
+//! @brief Destroys and deallocates an object created by @c __new_with_allocator. @c __alloc may be a member of the
+//! object.
+template <class _Ty, class _Alloc>
+_CCCL_API void __delete_with_allocator(_Ty* __ptr, const _Alloc& __alloc) noexcept
+{
+  using __alloc_t  = typename ::cuda::std::allocator_traits<_Alloc>::template rebind_alloc<_Ty>;
+  using __traits_t = ::cuda::std::allocator_traits<__alloc_t>;
+  __alloc_t __alloc_copy{__alloc};
+  __traits_t::destroy(__alloc_copy, __ptr);
+  __traits_t::deallocate(__alloc_copy, __ptr, 1);
+}
+
 //! @brief A callable that wraps a set of functions and calls the first one that is
 //! callable with a given set of arguments.
 template <class... _Fns>
@@ -18,11 +18,13 @@
 #include <cuda/experimental/__execution/completion_signatures.cuh>
 #include <cuda/experimental/__execution/conditional.cuh>
 #include <cuda/experimental/__execution/continues_on.cuh>
+#include <cuda/experimental/__execution/counting_scope.cuh>
 #include <cuda/experimental/__execution/cpos.cuh>
 #include <cuda/experimental/__execution/domain.cuh>
 #include <cuda/experimental/__execution/env.cuh>
 #include <cuda/experimental/__execution/get_completion_signatures.cuh>
 #include <cuda/experimental/__execution/inline_scheduler.cuh>
+#include <cuda/experimental/__execution/io_context.cuh>
 #include <cuda/experimental/__execution/just.cuh>
 #include <cuda/experimental/__execution/just_from.cuh>
 #include <cuda/experimental/__execution/let_value.cuh>
@@ -32,6 +34,8 @@
 #include <cuda/experimental/__execution/read_env.cuh>
 #include <cuda/experimental/__execution/run_loop.cuh>
 #include <cuda/experimental/__execution/sequence.cuh>
+#include <cuda/experimental/__execution/spawn.cuh>
+#include <cuda/experimental/__execution/spawn_future.cuh>
 #include <cuda/experimental/__execution/start_detached.cuh>
 #include <cuda/experimental/__execution/starts_on.cuh>
 #include <cuda/experimental/__execution/stop_token.cuh>
@@ -40,6 +44,7 @@
 #include <cuda/experimental/__execution/task_scheduler.cuh>
 #include <cuda/experimental/__execution/then.cuh>
 #include <cuda/experimental/__execution/thread_context.cuh>
+#include <cuda/experimental/__execution/timed_run_loop.cuh>
 #include <cuda/experimental/__execution/trampoline_scheduler.cuh>
 #include <cuda/experimental/__execution/transform_completion_signatures.cuh>
 #include <cuda/experimental/__execution/transform_sender.cuh>
@@ -0,0 +1,143 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <thrust/count.h>
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <cuda/experimental/__cuco/bloom_filter.cuh>
+#include <cuda/experimental/__cuco/bloom_filter_policy.cuh>
+#include <cuda/experimental/__cuco/bloom_filter_ref.cuh>
+
+#include <cooperative_groups.h>
+#include <testing.cuh>
+
+#include <c2h/catch2_test_helper.h>
+
+namespace cudax = cuda::experimental;
+
+template <int CGSize, typename Ref, typename InputIt, typename OutputIt>
+__global__ void contains_kernel(Ref ref, InputIt in, std::size_t n, OutputIt out)
+{
+  const auto tile = cooperative_groups::tiled_partition<CGSize>(cooperative_groups::this_thread_block());
+  const auto idx  = (blockIdx.x * blockDim.x + threadIdx.x) / CGSize;
+  if (idx < n)
+  {
+    const bool found = ref.contains(tile, *(in + idx));
+    if (tile.thread_rank() == 0)
+    {
+      *(out + idx) = found;
+    }
+  }
+}
+
+template <typename Hash, typename Word, std::uint32_t WordsPerBlock>
+using policy = cudax::cuco::default_filter_policy<Hash, Word, WordsPerBlock>;
+
+using test_types = c2h::type_list<
+  policy<cudax::cuco::hash<int64_t, cudax::cuco::hash_algorithm::xxhash_64>, std::uint32_t, 8>,
+  policy<cudax::cuco::hash<int64_t, cudax::cuco::hash_algorithm::xxhash_64>, std::uint64_t, 2>,
+  policy<cudax::cuco::hash<int64_t, cudax::cuco::hash_algorithm::murmurhash3_32>, std::uint32_t, 1>>;
+
+C2H_TEST("bloom_filter bulk operations", "[bloom_filter]", test_types)
+{
+  using policy_type = c2h::get<0, TestType>;
+  using filter_type =
+    cudax::cuco::bloom_filter<int64_t, cuda::device_memory_pool_ref, cuda::thread_scope_device, policy_type>;
+
+  const std::size_t num_keys = GENERATE(1, 1000, 1 << 20);
+  CAPTURE(num_keys);
+
+  // 16 bits per key
+  constexpr std::size_t bits_per_block = filter_type::words_per_block * sizeof(typename filter_type::word_type) * 8;
+  const std::size_t num_blocks         = (num_keys * 16 + bits_per_block - 1) / bits_per_block;
+  filter_type filter{num_blocks, policy_type{filter_type::words_per_block * 2}};
+  REQUIRE(filter.block_extent() == num_blocks);
+
+  thrust::device_vector<int64_t> keys(num_keys);
+  thrust::sequence(keys.begin(), keys.end(), int64_t{0});
+  thrust::device_vector<int64_t> other_keys(num_keys);
+  thrust::sequence(other_keys.begin(), other_keys.end(), int64_t{-1}, int64_t{-1});
+
+  thrust::device_vector<bool> contained(num_keys);
+  filter.contains(keys.begin(), keys.end(), contained.begin());
+  REQUIRE(thrust::count(contained.begin(), contained.end(), true) == 0);
+
+  filter.add(keys.begin(), keys.end());
+
+  // There are no false negatives
+  filter.contains(keys.begin(), keys.end(), contained.begin());
+  REQUIRE(thrust::count(contained.begin(), contained.end(), true) == num_keys);
+
+  // False positives are rare
+  filter.contains(other_keys.begin(), other_keys.end(), contained.begin());
+  REQUIRE(thrust::count(contained.begin(), contained.end(), true) <= num_keys / 10 + 1);
+
+  filter.clear();
+  filter.contains(keys.begin(), keys.end(), contained.begin());
+  REQUIRE(thrust::count(contained.begin(), contained.end(), true) == 0);
+}
+
+C2H_TEST("bloom_filter_ref host operations", "[bloom_filter]")
+{
+  using ref_type  = cudax::cuco::bloom_filter_ref<int64_t>;
+  using word_type = typename ref_type::word_type;
+
+  const std::size_t num_keys   = 100000;
+  const std::size_t num_blocks = num_keys / 16;
+  const auto num_threads       = GENERATE(1u, 4u);
+  CAPTURE(num_threads);
+
+  // The storage is accessible from both host and device
+  word_type* storage{};
+  const auto storage_words = ref_type::storage_words(num_blocks);
+  REQUIRE(cudaMallocManaged(&storage, storage_words * sizeof(word_type)) == cudaSuccess);
+
+  ref_type ref{cuda::std::span<word_type>{storage, storage_words}};
+  ref.clear_host(num_threads);
+
+  std::vector<int64_t> keys(num_keys);
+  std::iota(keys.begin(), keys.end(), int64_t{0});
+  ref.add_host(keys.begin(), keys.end(), num_threads);
+
+  std::vector<char> contained(num_keys);
+  ref.contains_host(keys.begin(), keys.end(), contained.begin(), num_threads);
+  REQUIRE(std::count(contained.begin(), contained.end(), 1) == num_keys);
+
+  // A filter built on the host can be queried on the device with the same result
+  std::vector<int64_t> queries(2 * num_keys);
+  std::iota(queries.begin(), queries.end(), int64_t{0});
+  std::vector<char> h_contained(queries.size());
+  ref.contains_host(queries.begin(), queries.end(), h_contained.begin(), num_threads);
+
+  thrust::device_vector<int64_t> d_queries(queries.begin(), queries.end());
+  thrust::device_vector<bool> d_contained(queries.size());
+  constexpr int cg_size    = ref_type::words_per_block;
+  constexpr int block_size = 128;
+  const auto grid_size     = (queries.size() * cg_size + block_size - 1) / block_size;
+  contains_kernel<cg_size><<<grid_size, block_size>>>(ref, d_queries.begin(), d_queries.size(), d_contained.begin());
+  REQUIRE(cudaDeviceSynchronize() == cudaSuccess);
+
+  thrust::host_vector<bool> from_device = d_contained;
+  REQUIRE(std::equal(from_device.begin(), from_device.end(), h_contained.begin(), [](bool a, char b) {
+    return a == static_cast<bool>(b);
+  }));
+
+  REQUIRE(cudaFree(storage) == cudaSuccess);
+}
@@ -9,12 +9,16 @@
 //===----------------------------------------------------------------------===//
 
 #include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
 #include <thrust/sequence.h>
 
 #include <cuda/functional>
 #include <cuda/std/cstddef>
 #include <cuda/std/span>
 
+#include <numeric>
+#include <vector>
+
 #include <cuda/experimental/__cuco/hash_functions.cuh>
 #include <cuda/experimental/__cuco/hyperloglog.cuh>
 #include <cuda/experimental/__cuco/hyperloglog_ref.cuh>
@@ -245,3 +249,57 @@ C2H_TEST("Hyperloglog estimate works with pinned memory pool", "[hyperloglog]")
   REQUIRE(relative_error < tolerance_factor * relative_standard_deviation);
 }
 #endif // _CCCL_CTK_AT_LEAST(12, 9)
+
+C2H_TEST("HyperLogLog host ref matches the device sketch", "[hyperloglog]", test_types)
+{
+  using T              = c2h::get<0, TestType>;
+  using estimator_type = cudax::cuco::hyperloglog<T>;
+  using ref_type       = typename estimator_type::template ref_type<>;
+  using register_type  = typename ref_type::register_type;
+
+  const std::size_t num_items = GENERATE(1000, 1 << 20);
+  const int hll_precision     = GENERATE(4, 12, 18);
+  const typename estimator_type::precision precision(hll_precision);
+
+  CAPTURE(num_items, hll_precision);
+
+  std::vector<T> host_items(num_items);
+  std::iota(host_items.begin(), host_items.end(), T{0});
+  thrust::device_vector<T> items(host_items.begin(), host_items.end());
+
+  estimator_type estimator{precision};
+  estimator.add(items.begin(), items.end());
+  const auto device_estimate = estimator.estimate();
+
+  std::vector<register_type> single_storage(ref_type::sketch_bytes(precision) / sizeof(register_type));
+  std::vector<register_type> parallel_storage(single_storage.size());
+  ref_type single{cuda::std::as_writable_bytes(cuda::std::span{single_storage})};
+  ref_type parallel{cuda::std::as_writable_bytes(cuda::std::span{parallel_storage})};
+  single.clear_host();
+  parallel.clear_host();
+  REQUIRE(single.estimate_host() == 0);
+
+  single.add_host(host_items.begin(), host_items.end(), 1);
+  parallel.add_host(host_items.data(), host_items.data() + num_items, 4);
+
+  // Both paths produce the same registers and therefore the same estimate
+  REQUIRE(single_storage == parallel_storage);
+  REQUIRE(single.estimate_host() == device_estimate);
+
+  const auto device_registers =
+    thrust::device_pointer_cast(reinterpret_cast<register_type*>(estimator.sketch().data()));
+  thrust::host_vector<register_type> device_sketch(device_registers, device_registers + single_storage.size());
+  REQUIRE(std::equal(device_sketch.begin(), device_sketch.end(), single_storage.begin()));
+
+  // Merging a sketch of the first half of the items with one of the second half yields the full sketch
+  std::vector<register_type> first_half_storage(single_storage.size());
+  std::vector<register_type> second_half_storage(single_storage.size());
+  ref_type first_half{cuda::std::as_writable_bytes(cuda::std::span{first_half_storage})};
+  ref_type second_half{cuda::std::as_writable_bytes(cuda::std::span{second_half_storage})};
+  first_half.clear_host();
+  second_half.clear_host();
+  first_half.add_host(host_items.begin(), host_items.begin() + num_items / 2);
+  second_half.add_host(host_items.begin() + num_items / 2, host_items.end());
+  first_half.merge_host(second_half);
+  REQUIRE(first_half_storage == single_storage);
+}
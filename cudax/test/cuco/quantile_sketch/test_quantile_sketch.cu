@@ -0,0 +1,199 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+
+#include <cuda/std/cstddef>
+#include <cuda/std/span>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <cuda/experimental/__cuco/quantile_sketch.cuh>
+#include <cuda/experimental/__cuco/quantile_sketch_ref.cuh>
+
+#include <cooperative_groups.h>
+#include <testing.cuh>
+
+#include <c2h/catch2_test_helper.h>
+
+namespace cudax = cuda::experimental;
+
+template <typename Ref, typename InputIt>
+__global__ void add_kernel(Ref ref, InputIt in, size_t n)
+{
+  for (size_t i = blockDim.x * blockIdx.x + threadIdx.x; i < n; i += gridDim.x * blockDim.x)
+  {
+    ref.add(*(in + i));
+  }
+}
+
+template <typename T>
+std::vector<T> make_values(std::size_t n)
+{
+  // Positive and negative values spread over several orders of magnitude, with some zeros
+  std::vector<T> values(n);
+  std::uint64_t state = 42;
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    state          = state * 6364136223846793005ull + 1442695040888963407ull;
+    const double u = static_cast<double>(state >> 11) / static_cast<double>(1ull << 53);
+    const double x = std::exp(12.0 * u - 4.0);
+    values[i]      = static_cast<T>(i % 7 == 0 ? 0.0 : (i % 3 == 0 ? -x : x));
+  }
+  return values;
+}
+
+std::vector<std::uint64_t> copy_sketch(cuda::std::span<cuda::std::byte> sketch)
+{
+  std::vector<std::uint64_t> result(sketch.size() / sizeof(std::uint64_t));
+  REQUIRE(cudaMemcpy(result.data(), sketch.data(), sketch.size(), cudaMemcpyDeviceToHost) == cudaSuccess);
+  return result;
+}
+
+using test_types = c2h::type_list<float, double>;
+
+C2H_TEST("Quantile sketch accuracy", "[quantile_sketch]", test_types)
+{
+  using T           = c2h::get<0, TestType>;
+  using sketch_type = cudax::cuco::quantile_sketch<T>;
+
+  // 0.01 fits the shared memory ingestion path, 0.001 uses global memory
+  const double alpha          = GENERATE(0.01, 0.001);
+  const std::size_t num_items = GENERATE(1, 1000, 1 << 20);
+
+  CAPTURE(alpha, num_items);
+
+  const auto values = make_values<T>(num_items);
+  thrust::device_vector<T> d_values(values.begin(), values.end());
+
+  sketch_type sketch{typename sketch_type::relative_accuracy{alpha}};
+  REQUIRE(sketch.count() == 0);
+  REQUIRE(std::isnan(sketch.quantile(0.5)));
+
+  sketch.add(d_values.begin(), d_values.end());
+  REQUIRE(sketch.count() == num_items);
+
+  auto sorted = values;
+  std::sort(sorted.begin(), sorted.end());
+
+  const std::vector<double> qs{0.0, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 1.0};
+  std::vector<double> estimates(qs.size());
+  sketch.quantiles(qs.begin(), qs.end(), estimates.begin());
+
+  for (std::size_t i = 0; i < qs.size(); ++i)
+  {
+    const double exact = static_cast<double>(sorted[static_cast<std::size_t>(qs[i] * (num_items - 1))]);
+    CAPTURE(qs[i], exact, estimates[i]);
+    REQUIRE(std::abs(estimates[i] - exact) <= alpha * std::abs(exact) * (1.0 + 1e-6));
+    REQUIRE(sketch.quantile(qs[i]) == estimates[i]);
+  }
+
+  // Values of the bucket of the ranked value may be on either side of it
+  const T median     = sorted[(num_items - 1) / 2];
+  const double slack = 3 * alpha * std::abs(static_cast<double>(median));
+  const auto lo      = std::lower_bound(sorted.begin(), sorted.end(), median - slack) - sorted.begin();
+  const auto hi      = std::upper_bound(sorted.begin(), sorted.end(), median + slack) - sorted.begin();
+  const auto rank    = sketch.rank(median);
+  REQUIRE(rank >= static_cast<std::uint64_t>(lo));
+  REQUIRE(rank <= static_cast<std::uint64_t>(hi));
+
+  sketch.clear();
+  REQUIRE(sketch.count() == 0);
+}
+
+C2H_TEST("Quantile sketch merge and host ingestion", "[quantile_sketch]", test_types)
+{
+  using T           = c2h::get<0, TestType>;
+  using sketch_type = cudax::cuco::quantile_sketch<T>;
+  using ref_type    = typename sketch_type::template ref_type<>;
+
+  const double alpha          = GENERATE(0.01, 0.001);
+  const std::size_t num_items = 1 << 20;
+
+  CAPTURE(alpha);
+
+  const auto values = make_values<T>(num_items);
+  thrust::device_vector<T> d_values(values.begin(), values.end());
+  const typename sketch_type::relative_accuracy accuracy{alpha};
+
+  sketch_type full{accuracy};
+  full.add(d_values.begin(), d_values.end());
+
+  sketch_type first{accuracy};
+  sketch_type second{accuracy};
+  first.add(d_values.begin(), d_values.begin() + num_items / 3);
+  second.add(d_values.begin() + num_items / 3, d_values.end());
+  first.merge(second);
+  REQUIRE(copy_sketch(first.sketch()) == copy_sketch(full.sketch()));
+
+  // Adding through the device ref gives the same counters
+  sketch_type by_ref{accuracy};
+  add_kernel<<<128, 256>>>(by_ref.ref(), d_values.begin(), num_items);
+  REQUIRE(cudaDeviceSynchronize() == cudaSuccess);
+  REQUIRE(copy_sketch(by_ref.sketch()) == copy_sketch(full.sketch()));
+
+  // A sketch built on the host is identical to the one built on the device
+  std::vector<std::uint64_t> host_storage(sketch_type::sketch_bytes(accuracy) / sizeof(std::uint64_t));
+  ref_type host_ref{cuda::std::as_writable_bytes(cuda::std::span{host_storage.data(), host_storage.size()}), accuracy};
+  host_ref.clear_host();
+  host_ref.add_host(values.begin(), values.end(), 4);
+  REQUIRE(host_storage == copy_sketch(full.sketch()));
+  REQUIRE(host_ref.count_host() == num_items);
+  REQUIRE(host_ref.quantile_host(0.5) == full.quantile(0.5));
+  REQUIRE(host_ref.rank_host(T{1}) == full.rank(T{1}));
+
+  // Sketches with different parameters cannot be merged
+  sketch_type coarse{typename sketch_type::relative_accuracy{0.05}};
+  REQUIRE_THROWS_AS(full.merge(coarse), std::invalid_argument);
+}
+
+C2H_TEST("Quantile sketch infinite and large values", "[quantile_sketch]", test_types)
+{
+  using T           = c2h::get<0, TestType>;
+  using sketch_type = cudax::cuco::quantile_sketch<T>;
+  using ref_type    = typename sketch_type::template ref_type<>;
+
+  const double alpha = 0.01;
+  const typename sketch_type::relative_accuracy accuracy{alpha};
+
+  // Magnitudes above the maximum value, up to infinity, are counted in the last bucket of their sign
+  const T inf     = std::numeric_limits<T>::infinity();
+  const T largest = std::numeric_limits<T>::max();
+  const std::vector<T> values{T{1}, inf, largest, T{1e30}, -inf, -largest, T{-1e30}, T{2}};
+  thrust::device_vector<T> d_values(values.begin(), values.end());
+
+  sketch_type sketch{accuracy};
+  sketch.add(d_values.begin(), d_values.end());
+  REQUIRE(sketch.count() == values.size());
+
+  const double max_value = sketch.max_value();
+  CAPTURE(max_value, sketch.quantile(0.0), sketch.quantile(1.0));
+  REQUIRE(std::abs(sketch.quantile(1.0) - max_value) <= alpha * max_value * (1.0 + 1e-6));
+  REQUIRE(std::abs(sketch.quantile(0.0) + max_value) <= alpha * max_value * (1.0 + 1e-6));
+  REQUIRE(sketch.quantile(0.25) < -1e8);
+  REQUIRE(sketch.quantile(0.75) > 1e8);
+
+  // The host ingestion clamps the same way
+  std::vector<std::uint64_t> host_storage(sketch_type::sketch_bytes(accuracy) / sizeof(std::uint64_t));
+  ref_type host_ref{cuda::std::as_writable_bytes(cuda::std::span{host_storage.data(), host_storage.size()}), accuracy};
+  host_ref.clear_host();
+  host_ref.add_host(values.begin(), values.end(), 1);
+  REQUIRE(host_storage == copy_sketch(sketch.sketch()));
+
+  // A sketch cannot cover infinite magnitudes
+  REQUIRE_THROWS_AS(sketch_type::sketch_bytes(accuracy, 1e-9, std::numeric_limits<double>::infinity()),
+                    std::invalid_argument);
+}
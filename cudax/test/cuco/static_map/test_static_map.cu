@@ -0,0 +1,179 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <thrust/count.h>
+#include <thrust/device_vector.h>
+#include <thrust/equal.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <cuda/functional>
+#include <cuda/std/cstddef>
+#include <cuda/std/span>
+#include <cuda/std/utility>
+
+#include <algorithm>
+#include <vector>
+
+#include <cuda/experimental/__cuco/static_map.cuh>
+#include <cuda/experimental/__cuco/static_map_ref.cuh>
+
+#include <cooperative_groups.h>
+#include <testing.cuh>
+
+#include <c2h/catch2_test_helper.h>
+
+namespace cudax = cuda::experimental;
+
+template <typename Ref, typename InputIt, typename OutputIt>
+__global__ void find_kernel(Ref ref, InputIt in, std::size_t n, OutputIt out)
+{
+  const auto tile = cooperative_groups::tiled_partition<Ref::cg_size>(cooperative_groups::this_thread_block());
+  const auto idx  = (blockIdx.x * blockDim.x + threadIdx.x) / Ref::cg_size;
+  if (idx < n)
+  {
+    const auto found = ref.find(tile, *(in + idx));
+    if (tile.thread_rank() == 0)
+    {
+      *(out + idx) = found == ref.end() ? ref.empty_value_sentinel() : found->second;
+    }
+  }
+}
+
+using test_types = c2h::type_list<c2h::type_list<int32_t, int32_t>, c2h::type_list<int64_t, float>>;
+
+C2H_TEST("static_map bulk operations", "[static_map]", test_types)
+{
+  using Key      = c2h::get<0, TestType>;
+  using T        = c2h::get<1, TestType>;
+  using map_type = cudax::cuco::static_map<Key, T>;
+  using pair     = cuda::std::pair<Key, T>;
+
+  const std::size_t num_keys = GENERATE(1, 1000, 1 << 20);
+  CAPTURE(num_keys);
+
+  map_type map{num_keys * 2, cudax::cuco::empty_key<Key>{-1}, cudax::cuco::empty_value<T>{-1}};
+  REQUIRE(map.size() == 0);
+
+  auto pairs = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<Key>(0), cuda::proclaim_return_type<pair>([] __device__(Key i) {
+      return pair{i, static_cast<T>(i * 2)};
+    }));
+
+  REQUIRE(map.insert(pairs, pairs + num_keys) == num_keys);
+  REQUIRE(map.size() == num_keys);
+
+  // Inserting equal keys again should neither change the size nor the mapped values
+  auto other_pairs = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<Key>(0), cuda::proclaim_return_type<pair>([] __device__(Key i) {
+      return pair{i, static_cast<T>(i * 3)};
+    }));
+  REQUIRE(map.insert(other_pairs, other_pairs + num_keys) == 0);
+  REQUIRE(map.size() == num_keys);
+
+  thrust::device_vector<Key> queries(2 * num_keys);
+  thrust::sequence(queries.begin(), queries.end(), Key{0});
+
+  thrust::device_vector<bool> contained(queries.size());
+  map.contains(queries.begin(), queries.end(), contained.begin());
+  REQUIRE(thrust::count(contained.begin(), contained.begin() + num_keys, true) == num_keys);
+  REQUIRE(thrust::count(contained.begin() + num_keys, contained.end(), true) == 0);
+
+  thrust::device_vector<T> expected(num_keys);
+  thrust::sequence(expected.begin(), expected.end(), T{0}, T{2});
+
+  thrust::device_vector<T> found(queries.size());
+  map.find(queries.begin(), queries.end(), found.begin());
+  REQUIRE(thrust::equal(found.begin(), found.begin() + num_keys, expected.begin()));
+  REQUIRE(thrust::count(found.begin() + num_keys, found.end(), map.empty_value_sentinel()) == num_keys);
+
+  // Assigning overwrites the mapped values of present keys
+  map.insert_or_assign(other_pairs, other_pairs + num_keys);
+  REQUIRE(map.size() == num_keys);
+  thrust::sequence(expected.begin(), expected.end(), T{0}, T{3});
+  map.find(queries.begin(), queries.begin() + num_keys, found.begin());
+  REQUIRE(thrust::equal(found.begin(), found.begin() + num_keys, expected.begin()));
+
+  thrust::device_vector<Key> retrieved_keys(num_keys);
+  thrust::device_vector<T> retrieved_values(num_keys);
+  const auto [keys_end, values_end] = map.retrieve_all(retrieved_keys.begin(), retrieved_values.begin());
+  REQUIRE(keys_end == retrieved_keys.end());
+  REQUIRE(values_end == retrieved_values.end());
+  thrust::sort_by_key(retrieved_keys.begin(), retrieved_keys.end(), retrieved_values.begin());
+  REQUIRE(thrust::equal(retrieved_keys.begin(), retrieved_keys.end(), queries.begin()));
+  REQUIRE(thrust::equal(retrieved_values.begin(), retrieved_values.end(), expected.begin()));
+
+  map.clear();
+  REQUIRE(map.size() == 0);
+}
+
+C2H_TEST("static_map_ref host operations", "[static_map]")
+{
+  using Key      = int32_t;
+  using T        = int64_t;
+  using ref_type = cudax::cuco::static_map_ref<Key, T>;
+  using pair     = typename ref_type::value_type;
+
+  const std::size_t num_keys = 100000;
+  const auto num_threads     = GENERATE(1u, 4u);
+  CAPTURE(num_threads);
+
+  // The storage is accessible from both host and device
+  pair* storage{};
+  const auto storage_size = ref_type::storage_size(num_keys * 2);
+  REQUIRE(cudaMallocManaged(&storage, storage_size * sizeof(pair)) == cudaSuccess);
+
+  ref_type ref{cuda::std::span<pair>{storage, storage_size},
+               cudax::cuco::empty_key<Key>{-1},
+               cudax::cuco::empty_value<T>{-1}};
+  ref.initialize_host(num_threads);
+
+  std::vector<pair> pairs(num_keys);
+  for (std::size_t i = 0; i < num_keys; ++i)
+  {
+    pairs[i] = pair{static_cast<Key>(i), static_cast<T>(i * 2)};
+  }
+  REQUIRE(ref.insert_host(pairs.begin(), pairs.end(), num_threads) == num_keys);
+  REQUIRE(ref.size_host(num_threads) == num_keys);
+
+  for (auto& p : pairs)
+  {
+    p.second += 1;
+  }
+  ref.insert_or_assign_host(pairs.begin(), pairs.end(), num_threads);
+  REQUIRE(ref.size_host(num_threads) == num_keys);
+
+  std::vector<Key> queries(2 * num_keys);
+  for (std::size_t i = 0; i < queries.size(); ++i)
+  {
+    queries[i] = static_cast<Key>(i);
+  }
+  std::vector<T> found(queries.size());
+  ref.find_host(queries.begin(), queries.end(), found.begin(), num_threads);
+  for (std::size_t i = 0; i < queries.size(); ++i)
+  {
+    REQUIRE(found[i] == (i < num_keys ? static_cast<T>(i * 2 + 1) : ref.empty_value_sentinel()));
+  }
+
+  // A table built on the host can be queried on the device
+  thrust::device_vector<Key> d_queries(queries.begin(), queries.end());
+  thrust::device_vector<T> d_found(queries.size());
+  constexpr int block_size = 128;
+  const auto grid_size     = (queries.size() * ref_type::cg_size + block_size - 1) / block_size;
+  find_kernel<<<grid_size, block_size>>>(ref, d_queries.begin(), d_queries.size(), d_found.begin());
+  REQUIRE(cudaDeviceSynchronize() == cudaSuccess);
+  thrust::host_vector<T> h_found = d_found;
+  REQUIRE(std::equal(h_found.begin(), h_found.end(), found.begin()));
+
+  REQUIRE(cudaFree(storage) == cudaSuccess);
+}
@@ -0,0 +1,178 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <thrust/count.h>
+#include <thrust/device_vector.h>
+#include <thrust/equal.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <cuda/std/cstddef>
+#include <cuda/std/span>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <cuda/experimental/__cuco/probing_scheme.cuh>
+#include <cuda/experimental/__cuco/static_set.cuh>
+#include <cuda/experimental/__cuco/static_set_ref.cuh>
+
+#include <cooperative_groups.h>
+#include <testing.cuh>
+
+#include <c2h/catch2_test_helper.h>
+
+namespace cudax = cuda::experimental;
+
+template <typename Ref, typename InputIt, typename OutputIt>
+__global__ void contains_kernel(Ref ref, InputIt in, std::size_t n, OutputIt out)
+{
+  const auto tile = cooperative_groups::tiled_partition<Ref::cg_size>(cooperative_groups::this_thread_block());
+  const auto idx  = (blockIdx.x * blockDim.x + threadIdx.x) / Ref::cg_size;
+  if (idx < n)
+  {
+    const bool found = ref.contains(tile, *(in + idx));
+    if (tile.thread_rank() == 0)
+    {
+      *(out + idx) = found;
+    }
+  }
+}
+
+using test_types = c2h::type_list<int32_t, int64_t>;
+
+C2H_TEST("static_set bulk operations", "[static_set]", test_types)
+{
+  using T        = c2h::get<0, TestType>;
+  using set_type = cudax::cuco::static_set<T>;
+
+  const std::size_t num_keys = GENERATE(1, 1000, 1 << 20);
+  CAPTURE(num_keys);
+
+  set_type set{num_keys * 2, cudax::cuco::empty_key<T>{-1}};
+  REQUIRE(set.capacity() >= num_keys * 2);
+  REQUIRE(set.size() == 0);
+
+  thrust::device_vector<T> keys(num_keys);
+  thrust::sequence(keys.begin(), keys.end(), T{0});
+
+  REQUIRE(set.insert(keys.begin(), keys.end()) == num_keys);
+  REQUIRE(set.size() == num_keys);
+
+  // Inserting the same keys again should not change the set
+  REQUIRE(set.insert(keys.begin(), keys.end()) == 0);
+  REQUIRE(set.size() == num_keys);
+
+  // Query present keys and as many absent keys
+  thrust::device_vector<T> queries(2 * num_keys);
+  thrust::sequence(queries.begin(), queries.end(), T{0});
+
+  thrust::device_vector<bool> contained(queries.size());
+  set.contains(queries.begin(), queries.end(), contained.begin());
+  REQUIRE(thrust::count(contained.begin(), contained.begin() + num_keys, true) == num_keys);
+  REQUIRE(thrust::count(contained.begin() + num_keys, contained.end(), true) == 0);
+
+  thrust::device_vector<T> found(queries.size());
+  set.find(queries.begin(), queries.end(), found.begin());
+  REQUIRE(thrust::equal(found.begin(), found.begin() + num_keys, keys.begin()));
+  REQUIRE(thrust::count(found.begin() + num_keys, found.end(), set.empty_key_sentinel()) == num_keys);
+
+  thrust::device_vector<T> retrieved(num_keys);
+  REQUIRE(set.retrieve_all(retrieved.begin()) == retrieved.end());
+  thrust::sort(retrieved.begin(), retrieved.end());
+  REQUIRE(thrust::equal(retrieved.begin(), retrieved.end(), keys.begin()));
+
+  set.clear();
+  REQUIRE(set.size() == 0);
+}
+
+C2H_TEST("static_set device ref", "[static_set]")
+{
+  using T        = int32_t;
+  using set_type = cudax::cuco::static_set<T,
+                                           cuda::device_memory_pool_ref,
+                                           cuda::thread_scope_device,
+                                           cuda::std::equal_to<T>,
+                                           cudax::cuco::linear_probing<8, cudax::cuco::hash<T>>,
+                                           2>;
+
+  const std::size_t num_keys = 10000;
+
+  set_type set{num_keys * 2, cudax::cuco::empty_key<T>{-1}};
+
+  thrust::device_vector<T> keys(num_keys);
+  thrust::sequence(keys.begin(), keys.end(), T{0}, T{2});
+  set.insert(keys.begin(), keys.end());
+
+  thrust::device_vector<T> queries(2 * num_keys);
+  thrust::sequence(queries.begin(), queries.end(), T{0});
+  thrust::device_vector<bool> contained(queries.size());
+
+  constexpr int block_size = 128;
+  const auto grid_size     = (queries.size() * set_type::ref_type::cg_size + block_size - 1) / block_size;
+  contains_kernel<<<grid_size, block_size>>>(set.ref(), queries.begin(), queries.size(), contained.begin());
+  REQUIRE(cudaDeviceSynchronize() == cudaSuccess);
+
+  thrust::host_vector<bool> h_contained = contained;
+  for (std::size_t i = 0; i < h_contained.size(); ++i)
+  {
+    REQUIRE(h_contained[i] == (i % 2 == 0));
+  }
+}
+
+C2H_TEST("static_set_ref host operations", "[static_set]")
+{
+  using T        = int64_t;
+  using ref_type = cudax::cuco::static_set_ref<T>;
+
+  const std::size_t num_keys = 100000;
+  const auto num_threads     = GENERATE(1u, 4u);
+  CAPTURE(num_threads);
+
+  // The storage is accessible from both host and device
+  T* storage{};
+  const auto storage_size = ref_type::storage_size(num_keys * 2);
+  REQUIRE(cudaMallocManaged(&storage, storage_size * sizeof(T)) == cudaSuccess);
+
+  ref_type ref{cuda::std::span<T>{storage, storage_size}, cudax::cuco::empty_key<T>{-1}};
+  ref.initialize_host(num_threads);
+
+  std::vector<T> keys(num_keys);
+  std::iota(keys.begin(), keys.end(), T{0});
+  REQUIRE(ref.insert_host(keys.begin(), keys.end(), num_threads) == num_keys);
+  REQUIRE(ref.insert_host(keys.begin(), keys.begin() + num_keys / 2, num_threads) == 0);
+  REQUIRE(ref.size_host(num_threads) == num_keys);
+
+  std::vector<T> queries(2 * num_keys);
+  std::iota(queries.begin(), queries.end(), T{0});
+  std::vector<char> contained(queries.size());
+  ref.contains_host(queries.begin(), queries.end(), contained.begin(), num_threads);
+  REQUIRE(std::count(contained.begin(), contained.begin() + num_keys, 1) == num_keys);
+  REQUIRE(std::count(contained.begin() + num_keys, contained.end(), 1) == 0);
+
+  std::vector<T> retrieved(num_keys);
+  REQUIRE(ref.retrieve_all_host(retrieved.begin(), num_threads) == retrieved.end());
+  std::sort(retrieved.begin(), retrieved.end());
+  REQUIRE(retrieved == keys);
+
+  // A table built on the host can be queried on the device
+  thrust::device_vector<T> d_queries(queries.begin(), queries.end());
+  thrust::device_vector<bool> d_contained(queries.size());
+  constexpr int block_size = 128;
+  const auto grid_size     = (queries.size() * ref_type::cg_size + block_size - 1) / block_size;
+  contains_kernel<<<grid_size, block_size>>>(ref, d_queries.begin(), d_queries.size(), d_contained.begin());
+  REQUIRE(cudaDeviceSynchronize() == cudaSuccess);
+  REQUIRE(thrust::count(d_contained.begin(), d_contained.begin() + num_keys, true) == num_keys);
+  REQUIRE(thrust::count(d_contained.begin() + num_keys, d_contained.end(), true) == 0);
+
+  REQUIRE(cudaFree(storage) == cudaSuccess);
+}
@@ -204,6 +204,65 @@ struct test_murmurhash3_x64_128
 };
 #endif // _CCCL_HAS_INT128()
 
+// A key of any number of bytes. The hashes only accept keys with a tail if it is the whole key, or if the blocks before
+// it keep the key free of padding, which 3- and 24-byte keys do for all of them.
+template <int32_t Bytes>
+struct bulk_key
+{
+  bulk_key() = default;
+
+  constexpr _CCCL_HOST_DEVICE bulk_key(int32_t value) noexcept
+  {
+    for (int32_t i = 0; i < Bytes; ++i)
+    {
+      data_[i] = static_cast<uint8_t>(value + i * 31);
+    }
+  }
+
+private:
+  uint8_t data_[Bytes];
+};
+
+template <cudax::cuco::hash_algorithm Algorithm>
+struct bulk_hash_test
+{
+  // Not a multiple of the number of lanes, so that the remaining keys are hashed one by one
+  static constexpr int num_keys = 37;
+
+  template <typename Key>
+  _CCCL_HOST_DEVICE void run(uint32_t seed) noexcept
+  {
+    cudax::cuco::hash<Key, Algorithm> hasher(seed);
+
+    Key keys[num_keys];
+    for (int i = 0; i < num_keys; ++i)
+    {
+      keys[i] = Key(i * 7919);
+    }
+
+    using result_type = decltype(hasher(keys[0]));
+    result_type hashes[num_keys] = {};
+    hasher.hash_bulk(cuda::std::span<const Key>(keys), cuda::std::span<result_type>(hashes));
+
+    for (int i = 0; i < num_keys; ++i)
+    {
+      CUDAX_REQUIRE(hashes[i] == hasher(keys[i]));
+    }
+  }
+
+  _CCCL_HOST_DEVICE void operator()() noexcept
+  {
+    for (uint32_t seed : {0u, 42u})
+    {
+      run<int32_t>(seed);
+      run<int64_t>(seed);
+      run<bulk_key<3>>(seed);
+      run<bulk_key<24>>(seed);
+      run<bulk_key<128>>(seed);
+    }
+  }
+};
+
 template <typename TestFn>
 __global__ void test_hasher_kernel(TestFn test_fn)
 {
@@ -238,6 +297,24 @@ TEST_CASE("Test Hasher's on host and device", "")
 #if _CCCL_HAS_INT128()
     test_hasher_on_device(test_murmurhash3_x86_128{});
     test_hasher_on_device(test_murmurhash3_x64_128{});
+#endif // _CCCL_HAS_INT128()
+  }
+
+  SECTION("bulk hash values match the hash values of the individual keys.")
+  {
+    bulk_hash_test<cudax::cuco::hash_algorithm::xxhash_32>{}();
+    bulk_hash_test<cudax::cuco::hash_algorithm::xxhash_64>{}();
+    bulk_hash_test<cudax::cuco::hash_algorithm::murmurhash3_32>{}();
+#if _CCCL_HAS_INT128()
+    bulk_hash_test<cudax::cuco::hash_algorithm::murmurhash3_x86_128>{}();
+    bulk_hash_test<cudax::cuco::hash_algorithm::murmurhash3_x64_128>{}();
+#endif // _CCCL_HAS_INT128()
+    test_hasher_on_device(bulk_hash_test<cudax::cuco::hash_algorithm::xxhash_32>{});
+    test_hasher_on_device(bulk_hash_test<cudax::cuco::hash_algorithm::xxhash_64>{});
+    test_hasher_on_device(bulk_hash_test<cudax::cuco::hash_algorithm::murmurhash3_32>{});
+#if _CCCL_HAS_INT128()
+    test_hasher_on_device(bulk_hash_test<cudax::cuco::hash_algorithm::murmurhash3_x86_128>{});
+    test_hasher_on_device(bulk_hash_test<cudax::cuco::hash_algorithm::murmurhash3_x64_128>{});
 #endif // _CCCL_HAS_INT128()
   }
 }
@@ -0,0 +1,222 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/execution.cuh>
+
+#include <atomic>
+#include <memory>
+
+#include "testing.cuh"
+
+namespace ex = ::cuda::experimental::execution;
+
+#if !_CCCL_DEVICE_COMPILATION()
+
+namespace
+{
+template <class T>
+struct counting_allocator
+{
+  using value_type = T;
+
+  counting_allocator(int* live)
+      : live_(live)
+  {}
+
+  template <class U>
+  counting_allocator(const counting_allocator<U>& other) noexcept
+      : live_(other.live_)
+  {}
+
+  T* allocate(size_t n)
+  {
+    ++*live_;
+    return std::allocator<T>{}.allocate(n);
+  }
+
+  void deallocate(T* p, size_t n) noexcept
+  {
+    --*live_;
+    std::allocator<T>{}.deallocate(p, n);
+  }
+
+  template <class U>
+  bool operator==(const counting_allocator<U>& other) const noexcept
+  {
+    return live_ == other.live_;
+  }
+
+  template <class U>
+  bool operator!=(const counting_allocator<U>& other) const noexcept
+  {
+    return live_ != other.live_;
+  }
+
+  int* live_;
+};
+} // namespace
+
+C2H_TEST("counting_scope satisfies the scope_token concept", "[scope][counting_scope]")
+{
+  STATIC_REQUIRE(ex::scope_token<ex::counting_scope::token>);
+  STATIC_REQUIRE(!ex::scope_token<int>);
+}
+
+C2H_TEST("join completes inline when no work is associated", "[scope][counting_scope]")
+{
+  ex::counting_scope scope;
+  CUDAX_CHECK(ex::sync_wait(scope.join()).has_value());
+}
+
+C2H_TEST("spawn runs work on another thread and join waits for it", "[scope][spawn]")
+{
+  ex::thread_context thread;
+  ex::counting_scope scope;
+  std::atomic<int> count{0};
+
+  for (int i = 0; i < 100; ++i)
+  {
+    ex::spawn(ex::starts_on(thread.get_scheduler(), ex::just()) | ex::then([&] {
+                ++count;
+              }),
+              scope.get_token());
+  }
+
+  scope.close();
+  ex::sync_wait(scope.join());
+  CUDAX_CHECK(count == 100);
+  thread.join();
+}
+
+C2H_TEST("join does not race with the completion of the last associated work", "[scope][counting_scope]")
+{
+  ex::thread_context threads[4];
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    // Allocated on the heap and destroyed as soon as it is joined, so that an access after the last association
+    // ended touches freed memory.
+    auto scope = std::make_unique<ex::counting_scope>();
+    ex::counting_scope joiners;
+    std::atomic<int> count{0};
+
+    for (auto& thread : threads)
+    {
+      ex::spawn(ex::starts_on(thread.get_scheduler(), ex::just()) | ex::then([&] {
+                  ++count;
+                }),
+                scope->get_token());
+    }
+
+    // Another join that races with the one below and with the completion of the spawned work
+    ex::spawn(ex::starts_on(threads[i % 4].get_scheduler(), scope->join()), joiners.get_token());
+
+    scope->close();
+    ex::sync_wait(scope->join());
+    CUDAX_CHECK(count == 4);
+
+    joiners.close();
+    ex::sync_wait(joiners.join());
+    scope.reset();
+  }
+
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+}
+
+C2H_TEST("spawn allocates its operation state with the allocator of the environment", "[scope][spawn]")
+{
+  int live = 0;
+  ex::counting_scope scope;
+  ex::run_loop loop;
+
+  ex::spawn(ex::schedule(loop.get_scheduler()),
+            scope.get_token(),
+            ex::env{ex::prop{ex::get_allocator, counting_allocator<int>{&live}}});
+  CUDAX_CHECK(live == 1);
+
+  loop.finish();
+  loop.run();
+  CUDAX_CHECK(live == 0);
+  ex::sync_wait(scope.join());
+}
+
+C2H_TEST("spawn does not start work on a closed scope", "[scope][spawn]")
+{
+  ex::counting_scope scope;
+  bool called = false;
+  scope.close();
+
+  ex::spawn(ex::just() | ex::then([&] {
+              called = true;
+            }),
+            scope.get_token());
+
+  CUDAX_CHECK(!called);
+  ex::sync_wait(scope.join());
+}
+
+C2H_TEST("the stop token of the scope is visible to spawned work", "[scope][spawn]")
+{
+  ex::counting_scope scope;
+  bool stop_possible = false;
+
+  ex::spawn(ex::read_env(ex::get_stop_token) | ex::then([&](auto token) {
+              stop_possible = token.stop_possible();
+            }),
+            scope.get_token());
+
+  CUDAX_CHECK(stop_possible);
+  ex::sync_wait(scope.join());
+}
+
+C2H_TEST("spawn_future delivers the results of the spawned work", "[scope][spawn_future]")
+{
+  ex::thread_context thread;
+  ex::counting_scope scope;
+
+  auto future   = ex::spawn_future(ex::starts_on(thread.get_scheduler(), ex::just(42)), scope.get_token());
+  auto [result] = ex::sync_wait(std::move(future)).value();
+  CUDAX_CHECK(result == 42);
+
+  scope.close();
+  ex::sync_wait(scope.join());
+  thread.join();
+}
+
+C2H_TEST("spawn_future ends the association when the future is dropped", "[scope][spawn_future]")
+{
+  int live = 0;
+  ex::counting_scope scope;
+
+  {
+    auto future = ex::spawn_future(ex::just(std::make_unique<int>(42)),
+                                   scope.get_token(),
+                                   ex::env{ex::prop{ex::get_allocator, counting_allocator<int>{&live}}});
+    CUDAX_CHECK(live == 1);
+  }
+
+  CUDAX_CHECK(live == 0);
+  ex::sync_wait(scope.join());
+}
+
+C2H_TEST("spawn_future completes with set_stopped on a closed scope", "[scope][spawn_future]")
+{
+  ex::counting_scope scope;
+  scope.close();
+
+  auto future = ex::spawn_future(ex::just(42), scope.get_token());
+  CUDAX_CHECK(!ex::sync_wait(std::move(future)).has_value());
+  ex::sync_wait(scope.join());
+}
+
+#endif // !_CCCL_DEVICE_COMPILATION()
@@ -0,0 +1,148 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/execution.cuh>
+
+#include <algorithm>
+#include <cstdlib>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "testing.cuh"
+
+namespace ex = ::cuda::experimental::execution;
+
+#if !_CCCL_DEVICE_COMPILATION() && _CCCL_OS(LINUX) && __has_include(<linux/io_uring.h>)
+
+namespace
+{
+struct temp_file
+{
+  temp_file()
+  {
+    char name[] = "/tmp/cudax_io_context_XXXXXX";
+    fd_         = ::mkstemp(name);
+    ::unlink(name);
+  }
+
+  ~temp_file()
+  {
+    ::close(fd_);
+  }
+
+  int fd_;
+};
+
+std::vector<cuda::std::byte> make_pattern(size_t size)
+{
+  std::vector<cuda::std::byte> pattern(size);
+  for (size_t i = 0; i < size; ++i)
+  {
+    pattern[i] = static_cast<cuda::std::byte>(i * 7 + 3);
+  }
+  return pattern;
+}
+} // namespace
+
+C2H_TEST("io_context completes schedule on a thread of the context", "[scheduler][io_context]")
+{
+  ex::io_context ctx;
+  auto sched = ctx.get_scheduler();
+
+  auto sndr = ex::schedule(sched) | ex::then([] {
+                return std::this_thread::get_id();
+              });
+  auto [id] = ex::sync_wait(std::move(sndr)).value();
+  CUDAX_CHECK(id != std::this_thread::get_id());
+}
+
+C2H_TEST("async_write_at and async_read_at transfer the bytes", "[scheduler][io_context]")
+{
+  auto size = GENERATE(1u, 4096u, 100000u);
+  // An entry count that io_uring_setup rejects forces the thread pool fallback.
+  auto entries = GENERATE(256u, 0xffffffffu);
+
+  ex::io_context ctx{entries, 2};
+  auto sched = ctx.get_scheduler();
+  temp_file file;
+
+  const auto pattern = make_pattern(size);
+  auto [written]     = ex::sync_wait(ex::async_write_at(sched, file.fd_, 16, cuda::std::span{pattern})).value();
+  CUDAX_CHECK(written == size);
+
+  std::vector<cuda::std::byte> buffer(size);
+  auto [read] = ex::sync_wait(ex::async_read_at(sched, file.fd_, 16, cuda::std::span{buffer})).value();
+  CUDAX_CHECK(read == size);
+  CUDAX_CHECK(buffer == pattern);
+}
+
+C2H_TEST("async_read reads from the current file position", "[scheduler][io_context]")
+{
+  ex::io_context ctx;
+  auto sched = ctx.get_scheduler();
+  temp_file file;
+
+  const auto pattern = make_pattern(64);
+  ex::sync_wait(ex::async_write(sched, file.fd_, cuda::std::span{pattern}));
+  ::lseek(file.fd_, 32, SEEK_SET);
+
+  std::vector<cuda::std::byte> buffer(64);
+  auto [read] = ex::sync_wait(ex::async_read(sched, file.fd_, cuda::std::span{buffer})).value();
+  CUDAX_CHECK(read == 32);
+  CUDAX_CHECK(std::equal(buffer.begin(), buffer.begin() + 32, pattern.begin() + 32));
+}
+
+C2H_TEST("requests on registered buffers transfer the bytes", "[scheduler][io_context]")
+{
+  ex::io_context ctx;
+  auto sched = ctx.get_scheduler();
+  temp_file file;
+
+  auto source = make_pattern(8192);
+  std::vector<cuda::std::byte> sink(8192);
+  const cuda::std::span<cuda::std::byte> buffers[] = {source, sink};
+  ctx.register_buffers(buffers);
+
+  ex::sync_wait(ex::async_write_at(sched, file.fd_, 0, ex::registered_buffer{source, 0}));
+  auto [read] = ex::sync_wait(ex::async_read_at(sched, file.fd_, 0, ex::registered_buffer{sink, 1})).value();
+  CUDAX_CHECK(read == sink.size());
+  CUDAX_CHECK(sink == source);
+}
+
+C2H_TEST("a failed request completes with set_error", "[scheduler][io_context]")
+{
+  ex::io_context ctx;
+  auto sched = ctx.get_scheduler();
+
+  std::vector<cuda::std::byte> buffer(16);
+  auto sndr = ex::async_read_at(sched, -1, 0, cuda::std::span{buffer}) | ex::then([](size_t) {
+                return std::error_code{};
+              })
+            | ex::upon_error([](std::error_code ec) {
+                return ec;
+              });
+  auto [ec] = ex::sync_wait(std::move(sndr)).value();
+  CUDAX_CHECK(ec == std::errc::bad_file_descriptor);
+}
+
+C2H_TEST("a request completes with set_stopped when stop was requested before it starts", "[scheduler][io_context]")
+{
+  ex::io_context ctx;
+  ex::inplace_stop_source source;
+  source.request_stop();
+
+  auto sndr = ex::write_env(ex::schedule(ctx.get_scheduler()), ex::prop{ex::get_stop_token, source.get_token()});
+  CUDAX_CHECK(!ex::sync_wait(std::move(sndr)).has_value());
+}
+
+#endif // !_CCCL_DEVICE_COMPILATION() && _CCCL_OS(LINUX) && __has_include(<linux/io_uring.h>)
@@ -0,0 +1,130 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/execution.cuh>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "testing.cuh"
+
+namespace ex = ::cuda::experimental::execution;
+
+#if !_CCCL_DEVICE_COMPILATION()
+
+using namespace std::chrono_literals;
+
+namespace
+{
+struct loop_thread
+{
+  loop_thread()
+      : thread_{[this] {
+        loop_.run();
+      }}
+  {}
+
+  ~loop_thread()
+  {
+    loop_.finish();
+    thread_.join();
+  }
+
+  ex::timed_run_loop loop_;
+  std::thread thread_;
+};
+} // namespace
+
+C2H_TEST("timed_run_loop schedules work on the thread that runs it", "[scheduler][timed_run_loop]")
+{
+  loop_thread context;
+  auto sched = context.loop_.get_scheduler();
+
+  auto sndr = ex::schedule(sched) | ex::then([] {
+                return std::this_thread::get_id();
+              });
+  auto [id] = ex::sync_wait(std::move(sndr)).value();
+  CUDAX_CHECK(id == context.thread_.get_id());
+}
+
+C2H_TEST("schedule_after completes once the duration has elapsed", "[scheduler][timed_run_loop]")
+{
+  loop_thread context;
+  auto sched = context.loop_.get_scheduler();
+
+  auto sndr = ex::schedule_after(sched, 20ms) | ex::then([] {
+                return std::this_thread::get_id();
+              });
+
+  const auto start = sched.now();
+  auto [id]        = ex::sync_wait(std::move(sndr)).value();
+  CUDAX_CHECK(sched.now() - start >= 20ms);
+  CUDAX_CHECK(id == context.thread_.get_id());
+}
+
+C2H_TEST("timers complete in the order of their deadlines", "[scheduler][timed_run_loop]")
+{
+  loop_thread context;
+  auto sched = context.loop_.get_scheduler();
+  std::vector<int> order;
+
+  const auto start = sched.now();
+  for (int i : {3, 1, 2})
+  {
+    ex::start_detached(ex::schedule_at(sched, start + i * 10ms) | ex::then([&order, i] {
+                         order.push_back(i);
+                       }));
+  }
+
+  ex::sync_wait(ex::schedule_at(sched, start + 40ms));
+  CUDAX_CHECK(order == std::vector<int>{1, 2, 3});
+}
+
+C2H_TEST("a timer completes with set_stopped when stop is requested", "[scheduler][timed_run_loop]")
+{
+  loop_thread context;
+  auto sched = context.loop_.get_scheduler();
+
+  SECTION("before the timer is started")
+  {
+    ex::inplace_stop_source source;
+    source.request_stop();
+    auto sndr = ex::write_env(ex::schedule_after(sched, 1h), ex::prop{ex::get_stop_token, source.get_token()});
+    CUDAX_CHECK(!ex::sync_wait(std::move(sndr)).has_value());
+  }
+
+  SECTION("while the timer is pending")
+  {
+    ex::inplace_stop_source source;
+    std::thread requester{[&] {
+      std::this_thread::sleep_for(10ms);
+      source.request_stop();
+    }};
+    auto sndr = ex::write_env(ex::schedule_after(sched, 1h), ex::prop{ex::get_stop_token, source.get_token()});
+    CUDAX_CHECK(!ex::sync_wait(std::move(sndr)).has_value());
+    requester.join();
+  }
+}
+
+C2H_TEST("finish stops the pending timers", "[scheduler][timed_run_loop]")
+{
+  ex::timed_run_loop loop;
+  bool stopped = false;
+
+  ex::start_detached(ex::schedule_after(loop.get_scheduler(), 1h) | ex::upon_stopped([&] {
+                       stopped = true;
+                     }));
+  loop.finish();
+  loop.run();
+  CUDAX_CHECK(stopped);
+}
+
+#endif // !_CCCL_DEVICE_COMPILATION()
@@ -0,0 +1,327 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___BARRIER_TREE_BARRIER_H
+#define _CUDA___BARRIER_TREE_BARRIER_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if !_CCCL_COMPILER(NVRTC)
+
+#  include <cuda/__cmath/ceil_div.h>
+#  include <cuda/std/__algorithm/max.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__barrier/empty_completion.h>
+#  include <cuda/std/__thread/threading_support.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/atomic>
+#  include <cuda/std/cstddef>
+#  include <cuda/std/cstdint>
+#  include <cuda/std/limits>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA
+
+_CCCL_DIAG_PUSH
+_CCCL_DIAG_SUPPRESS_MSVC(4324) // structure was padded due to alignment specifier
+
+//! @brief Returns a small integer that identifies the calling thread, assigned in the order in which threads first
+//! call it. It selects the leaf of a @c tree_barrier a thread arrives at.
+_CCCL_HOST_API inline ::cuda::std::uint32_t __tree_barrier_thread_slot() noexcept
+{
+  static ::cuda::std::atomic<::cuda::std::uint32_t> __next_slot{0};
+  static thread_local const ::cuda::std::uint32_t __slot = __next_slot.fetch_add(1, ::cuda::std::memory_order_relaxed);
+  return __slot;
+}
+
+//! @brief @c tree_barrier is a barrier for host threads that combines arrivals in a tree of counters.
+//!
+//! @c cuda::std::barrier counts all arrivals on a single atomic, so with many host threads the cache line holding
+//! it moves between all cores, and across sockets, at every arrival. @c tree_barrier spreads the arrivals over leaf
+//! counters of about @c group_size arrivals each, with every counter on its own cache line. The last arrival at a
+//! counter arrives at its parent, so the root only sees one arrival per group of groups. The thread completing the
+//! root runs the completion function, resets the counters and flips the phase. Waiting threads spin briefly and then
+//! sleep on a futex, on Linux, until the phase changes.
+//!
+//! The interface matches @c cuda::std::barrier. Prefer @c tree_barrier over @c cuda::std::barrier from about 32
+//! participating host threads on. It cannot be used from device code.
+//!
+//! @tparam _CompletionF The completion function, invoked by the last arriving thread of every phase.
+template <class _CompletionF = ::cuda::std::__empty_completion>
+class tree_barrier
+{
+public:
+  //! The number of arrivals expected at every leaf counter.
+  static constexpr ::cuda::std::ptrdiff_t group_size = 8;
+  //! The number of children of every inner node of the tree.
+  static constexpr ::cuda::std::size_t fan_in = 8;
+
+  using arrival_token = ::cuda::std::uint32_t;
+
+private:
+  static constexpr ::cuda::std::size_t __cache_line_size = 64;
+  static constexpr ::cuda::std::size_t __no_parent       = ::cuda::std::numeric_limits<::cuda::std::size_t>::max();
+  static constexpr int __spin_count                      = 64;
+  static constexpr int __yield_count                     = 16;
+
+  struct alignas(__cache_line_size) __node
+  {
+    //! The arrivals this node still waits for in the current phase
+    ::cuda::std::ptrdiff_t __pending_;
+    //! The arrivals this node waits for in every phase
+    ::cuda::std::ptrdiff_t __expected_;
+    ::cuda::std::size_t __parent_;
+  };
+
+  struct alignas(__cache_line_size) __aligned_uint32
+  {
+    ::cuda::std::uint32_t __value_;
+  };
+
+  __node* __nodes_                  = nullptr;
+  ::cuda::std::size_t __node_count_ = 0;
+  ::cuda::std::size_t __leaf_count_ = 0;
+  ::cuda::std::ptrdiff_t __expected_;
+  _CompletionF __completion_;
+  // The phase and the number of threads sleeping on it are futex words, so they are plain integers accessed through
+  // atomic_ref
+  mutable __aligned_uint32 __phase_{0};
+  mutable __aligned_uint32 __sleepers_{0};
+  ::cuda::std::atomic<::cuda::std::ptrdiff_t> __dropped_{0};
+
+  [[nodiscard]] _CCCL_HOST_API static ::cuda::std::atomic_ref<::cuda::std::uint32_t>
+  __ref(__aligned_uint32& __word) noexcept
+  {
+    return ::cuda::std::atomic_ref<::cuda::std::uint32_t>{__word.__value_};
+  }
+
+  [[nodiscard]] _CCCL_HOST_API ::cuda::std::atomic_ref<::cuda::std::uint32_t> __phase() const noexcept
+  {
+    return __ref(__phase_);
+  }
+
+  //! @brief Distributes the expected arrivals of a phase over the leaves, and sets the inner nodes to wait for their
+  //! children that expect any arrivals.
+  _CCCL_HOST_API void __reset() noexcept
+  {
+    const auto __leaves = static_cast<::cuda::std::ptrdiff_t>(__leaf_count_);
+    for (::cuda::std::size_t __i = __leaf_count_; __i < __node_count_; ++__i)
+    {
+      __nodes_[__i].__expected_ = 0;
+    }
+    for (::cuda::std::size_t __i = 0; __i < __node_count_; ++__i)
+    {
+      __node& __n = __nodes_[__i];
+      if (__i < __leaf_count_)
+      {
+        __n.__expected_ = __expected_ / __leaves + (static_cast<::cuda::std::ptrdiff_t>(__i) < __expected_ % __leaves);
+      }
+      if (__n.__expected_ > 0 && __n.__parent_ != __no_parent)
+      {
+        ++__nodes_[__n.__parent_].__expected_;
+      }
+      __n.__pending_ = __n.__expected_;
+    }
+  }
+
+  //! @brief Takes up to @p __update arrivals from the pending arrivals of @p __leaf.
+  //! @return The number of arrivals taken, which is 0 if the leaf is complete.
+  [[nodiscard]] _CCCL_HOST_API ::cuda::std::ptrdiff_t
+  __take(::cuda::std::size_t __leaf, ::cuda::std::ptrdiff_t __update, bool& __completed) noexcept
+  {
+    ::cuda::std::atomic_ref<::cuda::std::ptrdiff_t> __pending{__nodes_[__leaf].__pending_};
+    ::cuda::std::ptrdiff_t __current = __pending.load(::cuda::std::memory_order_relaxed);
+    ::cuda::std::ptrdiff_t __taken   = 0;
+    do
+    {
+      if (__current == 0)
+      {
+        return 0;
+      }
+      __taken = (::cuda::std::min) (__current, __update);
+    } while (!__pending.compare_exchange_weak(
+      __current, __current - __taken, ::cuda::std::memory_order_acq_rel, ::cuda::std::memory_order_relaxed));
+    __completed = __current == __taken;
+    return __taken;
+  }
+
+  //! @brief Arrives at the ancestors of the completed node @p __node, and completes the phase if it reaches the root.
+  _CCCL_HOST_API void __complete(::cuda::std::size_t __node, arrival_token __phase)
+  {
+    for (::cuda::std::size_t __parent = __nodes_[__node].__parent_; __parent != __no_parent;
+         __parent                     = __nodes_[__parent].__parent_)
+    {
+      ::cuda::std::atomic_ref<::cuda::std::ptrdiff_t> __pending{__nodes_[__parent].__pending_};
+      if (__pending.fetch_sub(1, ::cuda::std::memory_order_acq_rel) != 1)
+      {
+        return;
+      }
+    }
+
+    __completion_();
+    if (const auto __dropped = __dropped_.exchange(0, ::cuda::std::memory_order_relaxed); __dropped != 0)
+    {
+      __expected_ -= __dropped;
+    }
+    __reset();
+
+    this->__phase().store(__phase + 1, ::cuda::std::memory_order_seq_cst);
+#  if defined(_LIBCUDACXX_HAS_FUTEX)
+    if (__ref(__sleepers_).load(::cuda::std::memory_order_seq_cst) != 0)
+    {
+      ::cuda::std::__cccl_futex_wake_all(&__phase_.__value_);
+    }
+#  endif // _LIBCUDACXX_HAS_FUTEX
+  }
+
+public:
+  //! @brief Constructs a @c tree_barrier.
+  //! @param __expected The number of arrivals expected in every phase.
+  //! @param __completion The completion function.
+  _CCCL_HOST_API explicit tree_barrier(::cuda::std::ptrdiff_t __expected, _CompletionF __completion = _CompletionF())
+      : __expected_(__expected)
+      , __completion_(::cuda::std::move(__completion))
+  {
+    _CCCL_ASSERT(__expected >= 0, "Cannot initialize tree_barrier with negative arrival count");
+    __leaf_count_ =
+      static_cast<::cuda::std::size_t>(::cuda::ceil_div((::cuda::std::max) (__expected, group_size), group_size));
+    __node_count_ = __leaf_count_;
+    for (::cuda::std::size_t __level = __leaf_count_; __level > 1; __level = ::cuda::ceil_div(__level, fan_in))
+    {
+      __node_count_ += ::cuda::ceil_div(__level, fan_in);
+    }
+
+    __nodes_ = new __node[__node_count_];
+    ::cuda::std::size_t __first = 0;
+    for (::cuda::std::size_t __level = __leaf_count_; __level > 1; __level = ::cuda::ceil_div(__level, fan_in))
+    {
+      const ::cuda::std::size_t __next = __first + __level;
+      for (::cuda::std::size_t __i = 0; __i < __level; ++__i)
+      {
+        __nodes_[__first + __i].__parent_ = __next + __i / fan_in;
+      }
+      __first = __next;
+    }
+    __nodes_[__node_count_ - 1].__parent_ = __no_parent;
+    __reset();
+  }
+
+  tree_barrier(const tree_barrier&)            = delete;
+  tree_barrier& operator=(const tree_barrier&) = delete;
+
+  _CCCL_HOST_API ~tree_barrier()
+  {
+    delete[] __nodes_;
+  }
+
+  //! @brief Arrives at the barrier, decrementing the expected count of the current phase by @p __update.
+  //! @return A token for the current phase, to be passed to @c wait.
+  /*discard*/ _CCCL_HOST_API arrival_token arrive(::cuda::std::ptrdiff_t __update = 1)
+  {
+    _CCCL_ASSERT(__update > 0, "tree_barrier::arrive: the update must be positive");
+    const arrival_token __phase = this->__phase().load(::cuda::std::memory_order_relaxed);
+
+    ::cuda::std::size_t __leaf = ::cuda::__tree_barrier_thread_slot() % __leaf_count_;
+    ::cuda::std::size_t __full = 0;
+    while (__update > 0)
+    {
+      _CCCL_ASSERT(__full < __leaf_count_, "tree_barrier::arrive: more arrivals than expected in this phase");
+      bool __completed                     = false;
+      const ::cuda::std::ptrdiff_t __taken = __take(__leaf, __update, __completed);
+      if (__taken == 0)
+      {
+        // This leaf is complete, spill over to the next one
+        __leaf = __leaf + 1 == __leaf_count_ ? 0 : __leaf + 1;
+        ++__full;
+        continue;
+      }
+      __update -= __taken;
+      if (__completed)
+      {
+        __complete(__leaf, __phase);
+      }
+    }
+    return __phase;
+  }
+
+  //! @brief Blocks until the phase identified by @p __token has completed.
+  _CCCL_HOST_API void wait(arrival_token&& __token) const
+  {
+    // Spin for short phases, then give up the core to the threads that have yet to arrive, then sleep
+    for (int __i = 0; __i < __spin_count + __yield_count; ++__i)
+    {
+      if (this->__phase().load(::cuda::std::memory_order_acquire) != __token)
+      {
+        return;
+      }
+      if (__i < __spin_count)
+      {
+        ::cuda::std::__cccl_thread_yield_processor();
+      }
+      else
+      {
+        ::cuda::std::__cccl_thread_yield();
+      }
+    }
+
+#  if defined(_LIBCUDACXX_HAS_FUTEX)
+    // The completing thread stores the phase before it loads the number of sleepers, and sleepers register before
+    // they load the phase, so either the completing thread wakes them or they observe the new phase
+    __ref(__sleepers_).fetch_add(1, ::cuda::std::memory_order_seq_cst);
+    while (this->__phase().load(::cuda::std::memory_order_seq_cst) == __token)
+    {
+      ::cuda::std::__cccl_futex_wait(&__phase_.__value_, __token);
+    }
+    __ref(__sleepers_).fetch_sub(1, ::cuda::std::memory_order_relaxed);
+#  else // ^^^ _LIBCUDACXX_HAS_FUTEX ^^^ / vvv !_LIBCUDACXX_HAS_FUTEX vvv
+    ::cuda::std::__cccl_thread_poll_with_backoff([this, __token] {
+      return this->__phase().load(::cuda::std::memory_order_acquire) != __token;
+    });
+#  endif // ^^^ !_LIBCUDACXX_HAS_FUTEX ^^^
+  }
+
+  //! @brief Arrives at the barrier and blocks until the current phase has completed.
+  _CCCL_HOST_API void arrive_and_wait()
+  {
+    wait(arrive());
+  }
+
+  //! @brief Decrements the expected count of all following phases by one, and arrives at the barrier.
+  _CCCL_HOST_API void arrive_and_drop()
+  {
+    __dropped_.fetch_add(1, ::cuda::std::memory_order_relaxed);
+    (void) arrive();
+  }
+
+  //! @brief Returns the largest expected count supported by @c tree_barrier.
+  [[nodiscard]] _CCCL_HOST_API static constexpr ::cuda::std::ptrdiff_t max() noexcept
+  {
+    return ::cuda::std::numeric_limits<::cuda::std::ptrdiff_t>::max();
+  }
+};
+
+_CCCL_DIAG_POP
+
+_CCCL_END_NAMESPACE_CUDA
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // !_CCCL_COMPILER(NVRTC)
+
+#endif // _CUDA___BARRIER_TREE_BARRIER_H
@@ -0,0 +1,319 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___MDSPAN_FOR_EACH_INDEX_H
+#define _CUDA___MDSPAN_FOR_EACH_INDEX_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__mdspan/extents.h>
+#include <cuda/std/__mdspan/mdspan.h>
+#include <cuda/std/__utility/integer_sequence.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/array>
+#include <cuda/std/cstddef>
+
+#if !_CCCL_COMPILER(NVRTC)
+#  include <cuda/__iterator/counting_iterator.h>
+#  include <cuda/std/__pstl/for_each_n.h>
+#  include <cuda/std/__type_traits/is_execution_policy.h>
+#endif // !_CCCL_COMPILER(NVRTC)
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA
+
+//! The number of consecutive iterations of the innermost loop that form one work item of a parallel traversal.
+inline constexpr ::cuda::std::size_t __mdspan_chunk_size = 4096;
+
+//! @brief Returns the dimensions of a rank @p _Rank index space in row-major order.
+template <::cuda::std::size_t _Rank>
+[[nodiscard]] _CCCL_API constexpr ::cuda::std::array<::cuda::std::size_t, _Rank> __mdspan_row_major_order() noexcept
+{
+  ::cuda::std::array<::cuda::std::size_t, _Rank> __order{};
+  for (::cuda::std::size_t __r = 0; __r < _Rank; ++__r)
+  {
+    __order[__r] = __r;
+  }
+  return __order;
+}
+
+//! @brief Returns the order in which the dimensions of a view with mapping @p __mapping are traversed, outermost
+//! first.
+//!
+//! Strided mappings are traversed by decreasing stride, so that the innermost loop touches adjacent elements. Other
+//! mappings are traversed in row-major order.
+template <class _Mapping>
+[[nodiscard]] _CCCL_API constexpr ::cuda::std::array<::cuda::std::size_t, _Mapping::extents_type::rank()>
+__mdspan_traversal_order([[maybe_unused]] const _Mapping& __mapping) noexcept
+{
+  constexpr ::cuda::std::size_t __rank = _Mapping::extents_type::rank();
+  auto __order                         = ::cuda::__mdspan_row_major_order<__rank>();
+  if constexpr (__rank > 1 && _Mapping::is_always_strided())
+  {
+    const auto __abs_stride = [&__mapping](::cuda::std::size_t __r) {
+      const auto __stride = static_cast<::cuda::std::ptrdiff_t>(__mapping.stride(__r));
+      return __stride < 0 ? -__stride : __stride;
+    };
+    // Insertion sort, which is stable, so that dimensions with equal strides keep their row-major order
+    for (::cuda::std::size_t __i = 1; __i < __rank; ++__i)
+    {
+      const ::cuda::std::size_t __dim = __order[__i];
+      const auto __stride             = __abs_stride(__dim);
+      ::cuda::std::size_t __j         = __i;
+      for (; __j > 0 && __abs_stride(__order[__j - 1]) < __stride; --__j)
+      {
+        __order[__j] = __order[__j - 1];
+      }
+      __order[__j] = __dim;
+    }
+  }
+  return __order;
+}
+
+//! @brief The loop nest that visits every multidimensional index of an extents object in a given order.
+//!
+//! The innermost loop is split into chunks of @c __mdspan_chunk_size iterations. A work item is one chunk at one
+//! position of the outer loops, which is the unit of work of a parallel traversal.
+template <class _Extents>
+struct __mdspan_index_loops
+{
+  using index_type                            = typename _Extents::index_type;
+  static constexpr ::cuda::std::size_t __rank = _Extents::rank();
+  using __index_array                         = ::cuda::std::array<index_type, __rank>;
+  using __order_array                         = ::cuda::std::array<::cuda::std::size_t, __rank>;
+
+  _Extents __extents_;
+  __order_array __order_;
+
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::size_t __extent(::cuda::std::size_t __loop) const noexcept
+  {
+    return static_cast<::cuda::std::size_t>(__extents_.extent(__order_[__loop]));
+  }
+
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::size_t __chunks() const noexcept
+  {
+    return ::cuda::ceil_div(__extent(__rank - 1), __mdspan_chunk_size);
+  }
+
+  //! @brief Returns the number of work items.
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::size_t __size() const noexcept
+  {
+    if constexpr (__rank == 0)
+    {
+      return 1;
+    }
+    else
+    {
+      ::cuda::std::size_t __items = __chunks();
+      for (::cuda::std::size_t __loop = 0; __loop + 1 < __rank; ++__loop)
+      {
+        __items *= __extent(__loop);
+      }
+      return __items;
+    }
+  }
+
+  template <class _Fn, ::cuda::std::size_t... _Is>
+  _CCCL_API static constexpr void
+  __invoke(_Fn& __fn, const __index_array& __idx, ::cuda::std::index_sequence<_Is...>)
+  {
+    __fn(__idx[_Is]...);
+  }
+
+  //! @brief Runs the iterations of the innermost loop in [@p __first, @p __last) at the position of the outer loops
+  //! given by @p __idx.
+  template <class _Fn>
+  _CCCL_API constexpr void
+  __run_inner(__index_array& __idx, ::cuda::std::size_t __first, ::cuda::std::size_t __last, _Fn& __fn) const
+  {
+    const ::cuda::std::size_t __dim = __order_[__rank - 1];
+    for (::cuda::std::size_t __i = __first; __i < __last; ++__i)
+    {
+      __idx[__dim] = static_cast<index_type>(__i);
+      __invoke(__fn, __idx, ::cuda::std::make_index_sequence<__rank>{});
+    }
+  }
+
+  //! @brief Runs the work item @p __item.
+  template <class _Fn>
+  _CCCL_API constexpr void __run(::cuda::std::size_t __item, _Fn& __fn) const
+  {
+    if constexpr (__rank == 0)
+    {
+      __fn();
+    }
+    else
+    {
+      __index_array __idx{};
+      const ::cuda::std::size_t __chunk = __item % __chunks();
+      __item /= __chunks();
+      for (::cuda::std::size_t __loop = __rank - 1; __loop-- > 0;)
+      {
+        const ::cuda::std::size_t __extent = this->__extent(__loop);
+        __idx[__order_[__loop]]            = static_cast<index_type>(__item % __extent);
+        __item /= __extent;
+      }
+      const ::cuda::std::size_t __first = __chunk * __mdspan_chunk_size;
+      __run_inner(__idx, __first, (::cuda::std::min) (__first + __mdspan_chunk_size, __extent(__rank - 1)), __fn);
+    }
+  }
+
+  //! @brief Runs all work items in order. The outer loops are advanced incrementally rather than decomposing every
+  //! work item, which would cost a division per loop and per row.
+  template <class _Fn>
+  _CCCL_API constexpr void __run_all(_Fn& __fn) const
+  {
+    if constexpr (__rank == 0)
+    {
+      __fn();
+    }
+    else
+    {
+      if (__size() == 0)
+      {
+        return;
+      }
+      __index_array __idx{};
+      while (true)
+      {
+        __run_inner(__idx, 0, __extent(__rank - 1), __fn);
+
+        ::cuda::std::size_t __loop = __rank - 1;
+        for (; __loop > 0; --__loop)
+        {
+          const ::cuda::std::size_t __dim = __order_[__loop - 1];
+          if (static_cast<::cuda::std::size_t>(++__idx[__dim]) < __extent(__loop - 1))
+          {
+            break;
+          }
+          __idx[__dim] = 0;
+        }
+        if (__loop == 0)
+        {
+          return;
+        }
+      }
+    }
+  }
+};
+
+template <class _Extents>
+[[nodiscard]] _CCCL_API constexpr __mdspan_index_loops<_Extents> __make_row_major_index_loops(const _Extents& __ext)
+{
+  return {__ext, ::cuda::__mdspan_row_major_order<_Extents::rank()>()};
+}
+
+template <class _Mapping>
+[[nodiscard]] _CCCL_API constexpr __mdspan_index_loops<typename _Mapping::extents_type>
+__make_index_loops(const _Mapping& __mapping)
+{
+  return {__mapping.extents(), ::cuda::__mdspan_traversal_order(__mapping)};
+}
+
+//! @brief Invokes @p __fn with the multidimensional indices of one work item, used by parallel traversals.
+template <class _Extents, class _Fn>
+struct __mdspan_for_each_index_item
+{
+  __mdspan_index_loops<_Extents> __loops_;
+  _Fn __fn_;
+
+  _CCCL_API constexpr void operator()(::cuda::std::size_t __item)
+  {
+    __loops_.__run(__item, __fn_);
+  }
+};
+
+//! @brief Invokes @p __fn with every multidimensional index of @p __ext, in row-major order.
+//! @param __ext The extents to traverse.
+//! @param __fn The callable, which is invoked as <tt>__fn(__i0, ..., __iN)</tt> with values of
+//! <tt>_Extents::index_type</tt>.
+template <class _IndexType, ::cuda::std::size_t... _Extents, class _Fn>
+_CCCL_API constexpr void for_each_index(const ::cuda::std::extents<_IndexType, _Extents...>& __ext, _Fn __fn)
+{
+  ::cuda::__make_row_major_index_loops(__ext).__run_all(__fn);
+}
+
+//! @brief Invokes @p __fn with every multidimensional index of @p __view.
+//!
+//! For strided layouts the loop order follows the strides of the mapping, so that the innermost loop runs over the
+//! dimension with the smallest stride. For instance, a @c layout_left view is traversed in column-major order. Views
+//! with other layouts are traversed in row-major order.
+//! @param __view The view whose indices are traversed. Its elements are not accessed.
+//! @param __fn The callable, which is invoked as <tt>__fn(__i0, ..., __iN)</tt> with values of
+//! <tt>index_type</tt>.
+template <class _Tp, class _Extents, class _Layout, class _Accessor, class _Fn>
+_CCCL_API constexpr void for_each_index(const ::cuda::std::mdspan<_Tp, _Extents, _Layout, _Accessor>& __view, _Fn __fn)
+{
+  ::cuda::__make_index_loops(__view.mapping()).__run_all(__fn);
+}
+
+#if !_CCCL_COMPILER(NVRTC)
+
+//! @brief Invokes @p __fn with every multidimensional index of @p __ext, in parallel according to @p __policy.
+//!
+//! The index space is split into work items, each of which runs a chunk of the innermost loop in row-major order.
+//! @param __policy The execution policy, for example @c cuda::std::execution::par.
+//! @param __ext The extents to traverse.
+//! @param __fn The callable, which is invoked as <tt>__fn(__i0, ..., __iN)</tt> from the execution agents of
+//! @p __policy.
+_CCCL_TEMPLATE(class _Policy, class _IndexType, ::cuda::std::size_t... _Extents, class _Fn)
+_CCCL_REQUIRES(::cuda::std::is_execution_policy_v<_Policy>)
+_CCCL_HOST_API void
+for_each_index(const _Policy& __policy, const ::cuda::std::extents<_IndexType, _Extents...>& __ext, _Fn __fn)
+{
+  using __extents_t = ::cuda::std::extents<_IndexType, _Extents...>;
+  const auto __loops = ::cuda::__make_row_major_index_loops(__ext);
+  ::cuda::std::for_each_n(
+    __policy,
+    ::cuda::counting_iterator<::cuda::std::size_t>{0},
+    __loops.__size(),
+    __mdspan_for_each_index_item<__extents_t, _Fn>{__loops, ::cuda::std::move(__fn)});
+}
+
+//! @brief Invokes @p __fn with every multidimensional index of @p __view, in parallel according to @p __policy.
+//!
+//! The loop order is chosen as for the sequential overload, and the index space is split into work items, each of
+//! which runs a chunk of the innermost loop.
+//! @param __policy The execution policy, for example @c cuda::std::execution::par.
+//! @param __view The view whose indices are traversed. Its elements are not accessed.
+//! @param __fn The callable, which is invoked as <tt>__fn(__i0, ..., __iN)</tt> from the execution agents of
+//! @p __policy.
+_CCCL_TEMPLATE(class _Policy, class _Tp, class _Extents, class _Layout, class _Accessor, class _Fn)
+_CCCL_REQUIRES(::cuda::std::is_execution_policy_v<_Policy>)
+_CCCL_HOST_API void for_each_index(
+  const _Policy& __policy, const ::cuda::std::mdspan<_Tp, _Extents, _Layout, _Accessor>& __view, _Fn __fn)
+{
+  const auto __loops = ::cuda::__make_index_loops(__view.mapping());
+  ::cuda::std::for_each_n(
+    __policy,
+    ::cuda::counting_iterator<::cuda::std::size_t>{0},
+    __loops.__size(),
+    __mdspan_for_each_index_item<_Extents, _Fn>{__loops, ::cuda::std::move(__fn)});
+}
+
+#endif // !_CCCL_COMPILER(NVRTC)
+
+_CCCL_END_NAMESPACE_CUDA
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA___MDSPAN_FOR_EACH_INDEX_H
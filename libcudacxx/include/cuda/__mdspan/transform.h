@@ -0,0 +1,457 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___MDSPAN_TRANSFORM_H
+#define _CUDA___MDSPAN_TRANSFORM_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/__mdspan/for_each_index.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__mdspan/mdspan.h>
+#include <cuda/std/__utility/integer_sequence.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/array>
+#include <cuda/std/cstddef>
+
+#if !_CCCL_COMPILER(NVRTC)
+#  include <cuda/__iterator/counting_iterator.h>
+#  include <cuda/std/__pstl/for_each_n.h>
+#  include <cuda/std/__type_traits/is_execution_policy.h>
+#endif // !_CCCL_COMPILER(NVRTC)
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA
+
+//! The edge length of the square tiles used when the innermost loops of the input and the output disagree.
+inline constexpr ::cuda::std::size_t __mdspan_tile_size = 32;
+
+//! @brief The loop nest that visits the element offsets of two strided views with equal extents.
+//!
+//! The loops follow the strides of the output. Adjacent loops that are contiguous in both views are collapsed into
+//! one, so that, for instance, two views with the same exhaustive layout are traversed by a single loop. If the input
+//! has a smaller stride in one of the outer loops than in the innermost loop, as in a transposition, that loop and the
+//! innermost loop are tiled, so that both views are accessed in cache-sized blocks.
+//!
+//! A work item is either a tile or a chunk of @c __mdspan_chunk_size iterations of the innermost loop, at one
+//! position of the remaining loops.
+template <::cuda::std::size_t _Rank>
+struct __mdspan_strided_loops
+{
+  //! The number of loops after collapsing, at least 1
+  ::cuda::std::size_t __count_ = 0;
+  //! The loop that is tiled together with the innermost loop, or @c __count_ if the loops are not tiled
+  ::cuda::std::size_t __tiled_ = 0;
+  ::cuda::std::array<::cuda::std::size_t, _Rank> __extents_{};
+  ::cuda::std::array<::cuda::std::ptrdiff_t, _Rank> __in_strides_{};
+  ::cuda::std::array<::cuda::std::ptrdiff_t, _Rank> __out_strides_{};
+  ::cuda::std::ptrdiff_t __in_offset_  = 0;
+  ::cuda::std::ptrdiff_t __out_offset_ = 0;
+
+  [[nodiscard]] _CCCL_API constexpr bool __is_tiled() const noexcept
+  {
+    return __tiled_ != __count_;
+  }
+
+  [[nodiscard]] _CCCL_API constexpr bool __is_outer(::cuda::std::size_t __loop) const noexcept
+  {
+    return __loop + 1 != __count_ && __loop != __tiled_;
+  }
+
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::size_t __inner_blocks() const noexcept
+  {
+    return ::cuda::ceil_div(__extents_[__count_ - 1], __is_tiled() ? __mdspan_tile_size : __mdspan_chunk_size);
+  }
+
+  //! @brief Returns the number of work items at every position of the outer loops.
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::size_t __blocks() const noexcept
+  {
+    const ::cuda::std::size_t __inner = __inner_blocks();
+    return __is_tiled() ? __inner * ::cuda::ceil_div(__extents_[__tiled_], __mdspan_tile_size) : __inner;
+  }
+
+  //! @brief Returns the number of work items.
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::size_t __size() const noexcept
+  {
+    ::cuda::std::size_t __items = __blocks();
+    for (::cuda::std::size_t __loop = 0; __loop < __count_; ++__loop)
+    {
+      if (__is_outer(__loop))
+      {
+        __items *= __extents_[__loop];
+      }
+    }
+    return __items;
+  }
+
+  //! @brief Runs the work item @p __block at the position of the outer loops given by the offsets @p __in and
+  //! @p __out. @p __fn is invoked with the offsets of the input and the output element.
+  template <class _Fn>
+  _CCCL_API constexpr void __run_block(
+    ::cuda::std::size_t __block, ::cuda::std::ptrdiff_t __in, ::cuda::std::ptrdiff_t __out, _Fn& __fn) const
+  {
+    const ::cuda::std::size_t __inner         = __count_ - 1;
+    const ::cuda::std::ptrdiff_t __in_stride  = __in_strides_[__inner];
+    const ::cuda::std::ptrdiff_t __out_stride = __out_strides_[__inner];
+    if (__is_tiled())
+    {
+      const ::cuda::std::size_t __inner_blocks = this->__inner_blocks();
+      const ::cuda::std::size_t __first_row    = (__block / __inner_blocks) * __mdspan_tile_size;
+      const ::cuda::std::size_t __first_col    = (__block % __inner_blocks) * __mdspan_tile_size;
+      const auto __last_row = (::cuda::std::min) (__first_row + __mdspan_tile_size, __extents_[__tiled_]);
+      const auto __last_col = (::cuda::std::min) (__first_col + __mdspan_tile_size, __extents_[__inner]);
+      for (::cuda::std::size_t __row = __first_row; __row < __last_row; ++__row)
+      {
+        const auto __r                         = static_cast<::cuda::std::ptrdiff_t>(__row);
+        const ::cuda::std::ptrdiff_t __in_row  = __in + __r * __in_strides_[__tiled_];
+        const ::cuda::std::ptrdiff_t __out_row = __out + __r * __out_strides_[__tiled_];
+        for (::cuda::std::size_t __col = __first_col; __col < __last_col; ++__col)
+        {
+          const auto __c = static_cast<::cuda::std::ptrdiff_t>(__col);
+          __fn(__in_row + __c * __in_stride, __out_row + __c * __out_stride);
+        }
+      }
+      return;
+    }
+
+    const auto __first = static_cast<::cuda::std::ptrdiff_t>(__block * __mdspan_chunk_size);
+    const auto __last  = static_cast<::cuda::std::ptrdiff_t>(
+      (::cuda::std::min) (__block * __mdspan_chunk_size + __mdspan_chunk_size, __extents_[__inner]));
+    if (__in_stride == 1 && __out_stride == 1)
+    {
+      // Separate loop with unit strides, which the compiler can vectorize
+      for (::cuda::std::ptrdiff_t __i = __first; __i < __last; ++__i)
+      {
+        __fn(__in + __i, __out + __i);
+      }
+    }
+    else
+    {
+      for (::cuda::std::ptrdiff_t __i = __first; __i < __last; ++__i)
+      {
+        __fn(__in + __i * __in_stride, __out + __i * __out_stride);
+      }
+    }
+  }
+
+  //! @brief Runs the work item @p __item.
+  template <class _Fn>
+  _CCCL_API constexpr void __run(::cuda::std::size_t __item, _Fn& __fn) const
+  {
+    const ::cuda::std::size_t __blocks = this->__blocks();
+    const ::cuda::std::size_t __block  = __item % __blocks;
+    __item /= __blocks;
+    ::cuda::std::ptrdiff_t __in  = __in_offset_;
+    ::cuda::std::ptrdiff_t __out = __out_offset_;
+    for (::cuda::std::size_t __loop = __count_; __loop-- > 0;)
+    {
+      if (__is_outer(__loop))
+      {
+        const auto __i = static_cast<::cuda::std::ptrdiff_t>(__item % __extents_[__loop]);
+        __item /= __extents_[__loop];
+        __in += __i * __in_strides_[__loop];
+        __out += __i * __out_strides_[__loop];
+      }
+    }
+    __run_block(__block, __in, __out, __fn);
+  }
+
+  //! @brief Runs all work items in order, advancing the outer loops incrementally.
+  template <class _Fn>
+  _CCCL_API constexpr void __run_all(_Fn& __fn) const
+  {
+    const ::cuda::std::size_t __blocks = this->__blocks();
+    ::cuda::std::array<::cuda::std::size_t, _Rank> __idx{};
+    ::cuda::std::ptrdiff_t __in  = __in_offset_;
+    ::cuda::std::ptrdiff_t __out = __out_offset_;
+    while (true)
+    {
+      for (::cuda::std::size_t __block = 0; __block < __blocks; ++__block)
+      {
+        __run_block(__block, __in, __out, __fn);
+      }
+
+      ::cuda::std::size_t __loop = __count_;
+      for (; __loop > 0; --__loop)
+      {
+        const ::cuda::std::size_t __l = __loop - 1;
+        if (!__is_outer(__l))
+        {
+          continue;
+        }
+        __in += __in_strides_[__l];
+        __out += __out_strides_[__l];
+        if (++__idx[__l] < __extents_[__l])
+        {
+          break;
+        }
+        const auto __extent = static_cast<::cuda::std::ptrdiff_t>(__extents_[__l]);
+        __in -= __extent * __in_strides_[__l];
+        __out -= __extent * __out_strides_[__l];
+        __idx[__l] = 0;
+      }
+      if (__loop == 0)
+      {
+        return;
+      }
+    }
+  }
+};
+
+template <class _Mapping, ::cuda::std::size_t... _Is>
+[[nodiscard]] _CCCL_API constexpr ::cuda::std::ptrdiff_t
+__mdspan_first_offset(const _Mapping& __mapping, ::cuda::std::index_sequence<_Is...>) noexcept
+{
+  return static_cast<::cuda::std::ptrdiff_t>(__mapping(static_cast<typename _Mapping::index_type>(_Is * 0)...));
+}
+
+//! The number of loops of the loop nest over views of rank @p _Rank. Views of rank 0 are visited by a single loop.
+template <::cuda::std::size_t _Rank>
+inline constexpr ::cuda::std::size_t __mdspan_loop_capacity = _Rank > 0 ? _Rank : 1;
+
+//! @brief Builds the loop nest over two strided mappings with equal extents. The extents must not be empty.
+template <class _InMapping, class _OutMapping>
+[[nodiscard]] _CCCL_API constexpr __mdspan_strided_loops<__mdspan_loop_capacity<_OutMapping::extents_type::rank()>>
+__make_strided_loops(const _InMapping& __in, const _OutMapping& __out)
+{
+  constexpr ::cuda::std::size_t __rank = _OutMapping::extents_type::rank();
+  __mdspan_strided_loops<__mdspan_loop_capacity<__rank>> __loops{};
+  __loops.__in_offset_  = ::cuda::__mdspan_first_offset(__in, ::cuda::std::make_index_sequence<__rank>{});
+  __loops.__out_offset_ = ::cuda::__mdspan_first_offset(__out, ::cuda::std::make_index_sequence<__rank>{});
+
+  if constexpr (__rank > 0)
+  {
+    const auto __order = ::cuda::__mdspan_traversal_order(__out);
+    for (::cuda::std::size_t __r = 0; __r < __rank; ++__r)
+    {
+      const ::cuda::std::size_t __dim = __order[__r];
+      const auto __extent             = static_cast<::cuda::std::size_t>(__out.extents().extent(__dim));
+      const auto __in_stride          = static_cast<::cuda::std::ptrdiff_t>(__in.stride(__dim));
+      const auto __out_stride         = static_cast<::cuda::std::ptrdiff_t>(__out.stride(__dim));
+      if (__extent == 1)
+      {
+        continue;
+      }
+
+      const ::cuda::std::size_t __prev = __loops.__count_ - 1;
+      const auto __signed_extent       = static_cast<::cuda::std::ptrdiff_t>(__extent);
+      if (__loops.__count_ > 0 && __loops.__in_strides_[__prev] == __in_stride * __signed_extent
+          && __loops.__out_strides_[__prev] == __out_stride * __signed_extent)
+      {
+        __loops.__extents_[__prev] *= __extent;
+        __loops.__in_strides_[__prev]  = __in_stride;
+        __loops.__out_strides_[__prev] = __out_stride;
+      }
+      else
+      {
+        __loops.__extents_[__loops.__count_]     = __extent;
+        __loops.__in_strides_[__loops.__count_]  = __in_stride;
+        __loops.__out_strides_[__loops.__count_] = __out_stride;
+        ++__loops.__count_;
+      }
+    }
+  }
+
+  if (__loops.__count_ == 0)
+  {
+    // A single element
+    __loops.__extents_[0] = 1;
+    __loops.__count_      = 1;
+  }
+
+  const auto __abs = [](::cuda::std::ptrdiff_t __v) {
+    return __v < 0 ? -__v : __v;
+  };
+  const ::cuda::std::size_t __inner = __loops.__count_ - 1;
+  __loops.__tiled_                  = __loops.__count_;
+  for (::cuda::std::size_t __loop = 0; __loop < __inner; ++__loop)
+  {
+    const auto __best = __loops.__is_tiled() ? __loops.__in_strides_[__loops.__tiled_] : __loops.__in_strides_[__inner];
+    if (__abs(__loops.__in_strides_[__loop]) < __abs(__best))
+    {
+      __loops.__tiled_ = __loop;
+    }
+  }
+  return __loops;
+}
+
+//! @brief Applies @p __op to an element of the input and stores the result in the output, addressed by offsets.
+template <class _InView, class _OutView, class _Op>
+struct __mdspan_transform_offsets
+{
+  typename _InView::data_handle_type __in_handle_;
+  typename _InView::accessor_type __in_accessor_;
+  typename _OutView::data_handle_type __out_handle_;
+  typename _OutView::accessor_type __out_accessor_;
+  _Op __op_;
+
+  _CCCL_API constexpr void operator()(::cuda::std::ptrdiff_t __in, ::cuda::std::ptrdiff_t __out)
+  {
+    __out_accessor_.access(__out_handle_, static_cast<::cuda::std::size_t>(__out)) =
+      __op_(__in_accessor_.access(__in_handle_, static_cast<::cuda::std::size_t>(__in)));
+  }
+};
+
+//! @brief Applies @p __op to an element of the input and stores the result in the output, addressed by indices.
+template <class _InView, class _OutView, class _Op>
+struct __mdspan_transform_indices
+{
+  _InView __in_;
+  _OutView __out_;
+  _Op __op_;
+
+  template <class... _Indices>
+  _CCCL_API constexpr void operator()(_Indices... __indices)
+  {
+    __out_(__indices...) = __op_(__in_(__indices...));
+  }
+};
+
+template <class _InView, class _OutView>
+inline constexpr bool __mdspan_transform_is_strided =
+  _InView::mapping_type::is_always_strided() && _OutView::mapping_type::is_always_strided();
+
+template <class _InView, class _OutView, class _Op>
+[[nodiscard]] _CCCL_API constexpr __mdspan_transform_offsets<_InView, _OutView, _Op>
+__make_mdspan_transform_offsets(const _InView& __in, const _OutView& __out, _Op __op)
+{
+  return {__in.data_handle(), __in.accessor(), __out.data_handle(), __out.accessor(), ::cuda::std::move(__op)};
+}
+
+//! @brief Stores <tt>__op(__in(__i...))</tt> into <tt>__out(__i...)</tt> for every multidimensional index of
+//! @p __out.
+//!
+//! If both views have strided layouts, the elements are traversed in the memory order of the output, contiguous
+//! dimensions are collapsed, and transpositions are tiled for cache. Otherwise the traversal follows
+//! @c for_each_index over @p __out.
+//! @param __in The input view.
+//! @param __out The output view. Its extents must be equal to the extents of @p __in, and its mapping must be
+//! unique.
+//! @param __op The unary operation.
+template <class _InTp,
+          class _InExtents,
+          class _InLayout,
+          class _InAccessor,
+          class _OutTp,
+          class _OutExtents,
+          class _OutLayout,
+          class _OutAccessor,
+          class _Op>
+_CCCL_API constexpr void transform(const ::cuda::std::mdspan<_InTp, _InExtents, _InLayout, _InAccessor>& __in,
+                                   const ::cuda::std::mdspan<_OutTp, _OutExtents, _OutLayout, _OutAccessor>& __out,
+                                   _Op __op)
+{
+  using __in_view_t  = ::cuda::std::mdspan<_InTp, _InExtents, _InLayout, _InAccessor>;
+  using __out_view_t = ::cuda::std::mdspan<_OutTp, _OutExtents, _OutLayout, _OutAccessor>;
+  static_assert(_InExtents::rank() == _OutExtents::rank(), "cuda::transform: the views must have the same rank");
+  _CCCL_ASSERT(__in.extents() == __out.extents(), "cuda::transform: the views must have the same extents");
+
+  if constexpr (__mdspan_transform_is_strided<__in_view_t, __out_view_t>)
+  {
+    if (__out.empty())
+    {
+      return;
+    }
+    auto __fn = ::cuda::__make_mdspan_transform_offsets(__in, __out, ::cuda::std::move(__op));
+    ::cuda::__make_strided_loops(__in.mapping(), __out.mapping()).__run_all(__fn);
+  }
+  else
+  {
+    ::cuda::for_each_index(
+      __out, __mdspan_transform_indices<__in_view_t, __out_view_t, _Op>{__in, __out, ::cuda::std::move(__op)});
+  }
+}
+
+#if !_CCCL_COMPILER(NVRTC)
+
+//! @brief Invokes @p __fn with the element offsets of one work item, used by parallel transformations.
+template <::cuda::std::size_t _Rank, class _Fn>
+struct __mdspan_transform_item
+{
+  __mdspan_strided_loops<_Rank> __loops_;
+  _Fn __fn_;
+
+  _CCCL_API constexpr void operator()(::cuda::std::size_t __item)
+  {
+    __loops_.__run(__item, __fn_);
+  }
+};
+
+//! @brief Stores <tt>__op(__in(__i...))</tt> into <tt>__out(__i...)</tt> for every multidimensional index of
+//! @p __out, in parallel according to @p __policy.
+//!
+//! The traversal is split into work items of tiles or chunks of the innermost loop, chosen as for the sequential
+//! overload.
+//! @param __policy The execution policy, for example @c cuda::std::execution::par.
+//! @param __in The input view.
+//! @param __out The output view. Its extents must be equal to the extents of @p __in, and its mapping must be
+//! unique.
+//! @param __op The unary operation, which is invoked from the execution agents of @p __policy.
+_CCCL_TEMPLATE(class _Policy,
+               class _InTp,
+               class _InExtents,
+               class _InLayout,
+               class _InAccessor,
+               class _OutTp,
+               class _OutExtents,
+               class _OutLayout,
+               class _OutAccessor,
+               class _Op)
+_CCCL_REQUIRES(::cuda::std::is_execution_policy_v<_Policy>)
+_CCCL_HOST_API void transform(const _Policy& __policy,
+                              const ::cuda::std::mdspan<_InTp, _InExtents, _InLayout, _InAccessor>& __in,
+                              const ::cuda::std::mdspan<_OutTp, _OutExtents, _OutLayout, _OutAccessor>& __out,
+                              _Op __op)
+{
+  using __in_view_t  = ::cuda::std::mdspan<_InTp, _InExtents, _InLayout, _InAccessor>;
+  using __out_view_t = ::cuda::std::mdspan<_OutTp, _OutExtents, _OutLayout, _OutAccessor>;
+  static_assert(_InExtents::rank() == _OutExtents::rank(), "cuda::transform: the views must have the same rank");
+  _CCCL_ASSERT(__in.extents() == __out.extents(), "cuda::transform: the views must have the same extents");
+
+  if constexpr (__mdspan_transform_is_strided<__in_view_t, __out_view_t>)
+  {
+    if (__out.empty())
+    {
+      return;
+    }
+    using __fn_t       = __mdspan_transform_offsets<__in_view_t, __out_view_t, _Op>;
+    const auto __loops = ::cuda::__make_strided_loops(__in.mapping(), __out.mapping());
+    ::cuda::std::for_each_n(
+      __policy,
+      ::cuda::counting_iterator<::cuda::std::size_t>{0},
+      __loops.__size(),
+      __mdspan_transform_item<__mdspan_loop_capacity<_OutExtents::rank()>, __fn_t>{
+        __loops, ::cuda::__make_mdspan_transform_offsets(__in, __out, ::cuda::std::move(__op))});
+  }
+  else
+  {
+    using __fn_t = __mdspan_transform_indices<__in_view_t, __out_view_t, _Op>;
+    ::cuda::for_each_index(__policy, __out, __fn_t{__in, __out, ::cuda::std::move(__op)});
+  }
+}
+
+#endif // !_CCCL_COMPILER(NVRTC)
+
+_CCCL_END_NAMESPACE_CUDA
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA___MDSPAN_TRANSFORM_H
@@ -0,0 +1,379 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___MEMORY_RESOURCE_MMAP_MEMORY_RESOURCE_H
+#define _CUDA___MEMORY_RESOURCE_MMAP_MEMORY_RESOURCE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_CTK() && !_CCCL_COMPILER(NVRTC)
+
+#  include <cuda/__cmath/pow2.h>
+#  include <cuda/__cmath/round_up.h>
+#  include <cuda/__memory_resource/properties.h>
+#  include <cuda/__memory_resource/resource.h>
+#  include <cuda/std/__exception/exception_macros.h>
+#  include <cuda/std/__host_stdlib/new>
+#  include <cuda/std/__host_stdlib/stdexcept>
+#  include <cuda/std/cstddef>
+#  include <cuda/std/cstdint>
+
+#  if _CCCL_OS(WINDOWS)
+#    include <windows.h>
+#  else // ^^^ _CCCL_OS(WINDOWS) ^^^ / vvv !_CCCL_OS(WINDOWS) vvv
+#    include <sys/mman.h>
+#    include <unistd.h>
+#    if _CCCL_OS(LINUX)
+#      include <sys/syscall.h>
+#    endif // _CCCL_OS(LINUX)
+#  endif // ^^^ !_CCCL_OS(WINDOWS) ^^^
+
+#  include <cuda/std/__cccl/prologue.h>
+
+//! @file
+//! The \c mmap_memory_resource class provides a host memory resource that maps memory directly from the operating
+//! system, optionally backed by huge pages and bound to a NUMA node.
+_CCCL_BEGIN_NAMESPACE_CUDA_MR
+
+//! @brief Selects the kind of pages \c mmap_memory_resource requests from the operating system.
+enum class huge_page_mode
+{
+  //! Use the default page size of the system.
+  none,
+  //! Advise the kernel to back the mapping with transparent huge pages (``MADV_HUGEPAGE``).
+  transparent,
+  //! Map explicit 2 MiB huge pages from the hugetlbfs pool, falling back to the default page size if the pool is
+  //! exhausted.
+  explicit_2mb,
+  //! Map explicit 1 GiB huge pages from the hugetlbfs pool, falling back to the default page size if the pool is
+  //! exhausted.
+  explicit_1gb,
+};
+
+//! @brief \c mmap_memory_resource_properties controls how \c mmap_memory_resource maps memory.
+struct mmap_memory_resource_properties
+{
+  //! The kind of pages used for allocations of at least \c huge_page_threshold bytes.
+  huge_page_mode huge_pages = huge_page_mode::transparent;
+  //! Allocations smaller than this use the default page size regardless of \c huge_pages.
+  size_t huge_page_threshold = size_t{2} << 20;
+  //! The NUMA node the memory is bound to, or \c -1 to keep the default first-touch placement.
+  int numa_node = -1;
+
+  [[nodiscard]] _CCCL_HOST_API friend constexpr bool
+  operator==(const mmap_memory_resource_properties& __lhs, const mmap_memory_resource_properties& __rhs) noexcept
+  {
+    return __lhs.huge_pages == __rhs.huge_pages && __lhs.huge_page_threshold == __rhs.huge_page_threshold
+        && __lhs.numa_node == __rhs.numa_node;
+  }
+#  if _CCCL_STD_VER <= 2017
+  [[nodiscard]] _CCCL_HOST_API friend constexpr bool
+  operator!=(const mmap_memory_resource_properties& __lhs, const mmap_memory_resource_properties& __rhs) noexcept
+  {
+    return !(__lhs == __rhs);
+  }
+#  endif // _CCCL_STD_VER <= 2017
+};
+
+//! @brief \c mmap_memory_resource maps host memory directly from the operating system.
+//!
+//! Every allocation is an independent mapping whose size is rounded up to the page size in use, so the resource is
+//! meant to serve large buffers or to act as the upstream of a pooling resource such as
+//! \c synchronized_pool_resource or \c monotonic_buffer_resource. It does not require a CUDA driver and is safe to
+//! use concurrently from multiple threads.
+//!
+//! On Linux, the memory can be backed by transparent or explicit huge pages to reduce TLB pressure for large random
+//! access workloads, and bound to a NUMA node through ``mbind``. NUMA binding is ignored on other platforms.
+class mmap_memory_resource
+{
+public:
+  //! @brief Construct a new \c mmap_memory_resource.
+  //! @param __properties The properties controlling page size and NUMA placement.
+  //! @throw std::invalid_argument if \p __properties.numa_node is not a valid NUMA node id.
+  _CCCL_HOST_API explicit mmap_memory_resource(mmap_memory_resource_properties __properties = {})
+      : __properties_(__properties)
+  {
+    if (__properties_.numa_node < -1 || __properties_.numa_node >= __max_numa_nodes)
+    {
+      _CCCL_THROW(::std::invalid_argument, "Invalid NUMA node passed to mmap_memory_resource.");
+    }
+  }
+
+  //! @brief Allocate host memory of size at least \p __bytes.
+  //! @param __bytes The size in bytes of the allocation.
+  //! @param __alignment The requested alignment of the allocation. Must be a power of two.
+  //! @throw std::invalid_argument in case of invalid alignment or \c std::bad_alloc if the mapping failed.
+  //! @return Pointer to the newly allocated memory
+  [[nodiscard]] _CCCL_HOST_API void*
+  allocate_sync(const size_t __bytes, const size_t __alignment = alignof(::cuda::std::max_align_t))
+  {
+    if (!::cuda::is_power_of_two(__alignment))
+    {
+      _CCCL_THROW(::std::invalid_argument, "Invalid alignment passed to mmap_memory_resource::allocate_sync.");
+    }
+
+    const size_t __granularity = __page_size_for(__bytes);
+    const size_t __length      = ::cuda::round_up(__bytes == 0 ? size_t{1} : __bytes, __granularity);
+    void* __ptr                = __map(__length, __alignment, __granularity);
+    if (__ptr == nullptr)
+    {
+      _CCCL_THROW(::std::bad_alloc);
+    }
+    return __ptr;
+  }
+
+  //! @brief Deallocate memory pointed to by \p __ptr.
+  //! @param __ptr Pointer to be deallocated. Must have been allocated through a call to `allocate_sync` on an equal
+  //! resource.
+  //! @param __bytes The number of bytes that was passed to the allocation call that returned \p __ptr.
+  //! @param __alignment The alignment that was passed to the allocation call that returned \p __ptr.
+  _CCCL_HOST_API void deallocate_sync(
+    void* __ptr,
+    const size_t __bytes,
+    [[maybe_unused]] const size_t __alignment = alignof(::cuda::std::max_align_t)) noexcept
+  {
+    _CCCL_ASSERT(::cuda::is_power_of_two(__alignment),
+                 "Invalid alignment passed to mmap_memory_resource::deallocate_sync.");
+    const size_t __granularity = __page_size_for(__bytes);
+    __unmap(__ptr, ::cuda::round_up(__bytes == 0 ? size_t{1} : __bytes, __granularity));
+  }
+
+  //! @brief Returns the properties this resource was constructed with.
+  [[nodiscard]] _CCCL_HOST_API constexpr mmap_memory_resource_properties properties() const noexcept
+  {
+    return __properties_;
+  }
+
+  //! @brief Equality comparison with another \c mmap_memory_resource.
+  //! @return Whether both \c mmap_memory_resource were constructed with the same properties.
+  [[nodiscard]] _CCCL_HOST_API constexpr bool operator==(mmap_memory_resource const& __other) const noexcept
+  {
+    return __properties_ == __other.__properties_;
+  }
+#  if _CCCL_STD_VER <= 2017
+  //! @brief Inequality comparison with another \c mmap_memory_resource.
+  //! @return Whether both \c mmap_memory_resource were constructed with different properties.
+  [[nodiscard]] _CCCL_HOST_API constexpr bool operator!=(mmap_memory_resource const& __other) const noexcept
+  {
+    return !(__properties_ == __other.__properties_);
+  }
+#  endif // _CCCL_STD_VER <= 2017
+
+  //! @brief Enables the \c host_accessible property
+  _CCCL_HOST_API friend constexpr void get_property(mmap_memory_resource const&, ::cuda::mr::host_accessible) noexcept
+  {}
+
+  using default_queries = ::cuda::mr::properties_list<::cuda::mr::host_accessible>;
+
+  //! @brief Returns the page size of the system.
+  [[nodiscard]] _CCCL_HOST_API static size_t __system_page_size() noexcept
+  {
+#  if _CCCL_OS(WINDOWS)
+    ::SYSTEM_INFO __info;
+    ::GetSystemInfo(&__info);
+    // VirtualAlloc reserves address space at allocation granularity, not at page granularity
+    return static_cast<size_t>(__info.dwAllocationGranularity);
+#  else // ^^^ _CCCL_OS(WINDOWS) ^^^ / vvv !_CCCL_OS(WINDOWS) vvv
+    static const size_t __page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    return __page_size;
+#  endif // ^^^ !_CCCL_OS(WINDOWS) ^^^
+  }
+
+private:
+  static constexpr int __max_numa_nodes = 1024;
+
+  mmap_memory_resource_properties __properties_{};
+
+  //! @brief Returns the granularity of a mapping of \p __bytes bytes. This only depends on the properties and the
+  //! size, so that deallocation can recompute the length of the mapping.
+  [[nodiscard]] _CCCL_HOST_API size_t __page_size_for(const size_t __bytes) const noexcept
+  {
+    if (__bytes >= __properties_.huge_page_threshold)
+    {
+      switch (__properties_.huge_pages)
+      {
+        case huge_page_mode::explicit_2mb:
+          return size_t{2} << 20;
+        case huge_page_mode::explicit_1gb:
+          return size_t{1} << 30;
+        default:
+          break;
+      }
+    }
+    return __system_page_size();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API bool __uses_explicit_huge_pages(const size_t __granularity) const noexcept
+  {
+    return __granularity != __system_page_size();
+  }
+
+#  if _CCCL_OS(WINDOWS)
+  [[nodiscard]] _CCCL_HOST_API void*
+  __map(const size_t __length, const size_t __alignment, const size_t __granularity) const noexcept
+  {
+    ::DWORD __type = MEM_RESERVE | MEM_COMMIT;
+    if (__uses_explicit_huge_pages(__granularity) && __alignment <= __granularity)
+    {
+      // Large pages require SeLockMemoryPrivilege, so fall back to regular pages on failure
+      void* __ptr = __virtual_alloc(nullptr, __length, __type | MEM_LARGE_PAGES);
+      if (__ptr != nullptr)
+      {
+        return __ptr;
+      }
+    }
+
+    if (__alignment <= __system_page_size())
+    {
+      return __virtual_alloc(nullptr, __length, __type);
+    }
+
+    // Windows cannot release parts of a reservation, so find a suitably aligned range and map it in a second step.
+    // Another thread might take the range in between, so retry a few times.
+    for (int __attempt = 0; __attempt < 8; ++__attempt)
+    {
+      void* __probe = ::VirtualAlloc(nullptr, __length + __alignment, MEM_RESERVE, PAGE_NOACCESS);
+      if (__probe == nullptr)
+      {
+        return nullptr;
+      }
+      const auto __aligned = ::cuda::round_up(reinterpret_cast<::cuda::std::uintptr_t>(__probe), __alignment);
+      ::VirtualFree(__probe, 0, MEM_RELEASE);
+      void* __ptr = __virtual_alloc(reinterpret_cast<void*>(__aligned), __length, __type);
+      if (__ptr != nullptr)
+      {
+        return __ptr;
+      }
+    }
+    return nullptr;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API void*
+  __virtual_alloc(void* __address, const size_t __length, const ::DWORD __type) const noexcept
+  {
+    if (__properties_.numa_node >= 0)
+    {
+      return ::VirtualAllocExNuma(
+        ::GetCurrentProcess(),
+        __address,
+        __length,
+        __type,
+        PAGE_READWRITE,
+        static_cast<::DWORD>(__properties_.numa_node));
+    }
+    return ::VirtualAlloc(__address, __length, __type, PAGE_READWRITE);
+  }
+
+  _CCCL_HOST_API static void __unmap(void* __ptr, size_t) noexcept
+  {
+    ::VirtualFree(__ptr, 0, MEM_RELEASE);
+  }
+#  else // ^^^ _CCCL_OS(WINDOWS) ^^^ / vvv !_CCCL_OS(WINDOWS) vvv
+  [[nodiscard]] _CCCL_HOST_API void*
+  __map(const size_t __length, const size_t __alignment, const size_t __granularity) const noexcept
+  {
+    // mmap only guarantees alignment to the page size, so over-allocate and trim the excess for larger alignments.
+    // Both the head and the tail are multiples of the granularity, so the trimmed mapping stays page aligned.
+    const size_t __padding = __alignment > __granularity ? __alignment : 0;
+    const size_t __mapped  = __length + __padding;
+
+    void* __base = MAP_FAILED;
+    int __flags  = MAP_PRIVATE | MAP_ANONYMOUS;
+#    if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+    if (__uses_explicit_huge_pages(__granularity))
+    {
+      // The huge page size is encoded as its log2 in the bits above MAP_HUGE_SHIFT
+      const int __log2_size  = __granularity == (size_t{1} << 30) ? 30 : 21;
+      const int __huge_flags = MAP_HUGETLB | (__log2_size << MAP_HUGE_SHIFT);
+      __base = ::mmap(nullptr, __mapped, PROT_READ | PROT_WRITE, __flags | __huge_flags, -1, 0);
+    }
+#    endif // MAP_HUGETLB && MAP_HUGE_SHIFT
+    if (__base == MAP_FAILED)
+    {
+      __base = ::mmap(nullptr, __mapped, PROT_READ | PROT_WRITE, __flags, -1, 0);
+    }
+    if (__base == MAP_FAILED)
+    {
+      return nullptr;
+    }
+
+    auto __first         = reinterpret_cast<::cuda::std::uintptr_t>(__base);
+    const auto __aligned = ::cuda::round_up(__first, __alignment);
+    if (__padding != 0)
+    {
+      if (const size_t __head = __aligned - __first; __head != 0)
+      {
+        ::munmap(__base, __head);
+      }
+      if (const size_t __tail = __padding - (__aligned - __first); __tail != 0)
+      {
+        ::munmap(reinterpret_cast<void*>(__aligned + __length), __tail);
+      }
+    }
+    void* __ptr = reinterpret_cast<void*>(__aligned);
+
+#    if defined(MADV_HUGEPAGE)
+    if (__properties_.huge_pages == huge_page_mode::transparent && __length >= __properties_.huge_page_threshold)
+    {
+      // This is only a hint, failure leaves the mapping usable with regular pages
+      ::madvise(__ptr, __length, MADV_HUGEPAGE);
+    }
+#    endif // MADV_HUGEPAGE
+
+    if (__properties_.numa_node >= 0 && !__bind_to_numa_node(__ptr, __length))
+    {
+      ::munmap(__ptr, __length);
+      return nullptr;
+    }
+    return __ptr;
+  }
+
+  //! @brief Binds the pages of the mapping to the configured NUMA node. We call into the kernel directly rather than
+  //! through libnuma to avoid a link time dependency.
+  [[nodiscard]] _CCCL_HOST_API bool __bind_to_numa_node([[maybe_unused]] void* __ptr,
+                                                        [[maybe_unused]] const size_t __length) const noexcept
+  {
+#    if _CCCL_OS(LINUX) && defined(SYS_mbind)
+    constexpr int __mpol_bind    = 2;
+    constexpr size_t __word_bits = sizeof(unsigned long) * 8;
+    unsigned long __node_mask[__max_numa_nodes / __word_bits]{};
+    const auto __node = static_cast<size_t>(__properties_.numa_node);
+    __node_mask[__node / __word_bits] |= 1ul << (__node % __word_bits);
+    return ::syscall(SYS_mbind, __ptr, __length, __mpol_bind, __node_mask, __max_numa_nodes + 1, 0u) == 0;
+#    else // ^^^ _CCCL_OS(LINUX) ^^^ / vvv !_CCCL_OS(LINUX) vvv
+    return true;
+#    endif // ^^^ !_CCCL_OS(LINUX) ^^^
+  }
+
+  _CCCL_HOST_API static void __unmap(void* __ptr, const size_t __length) noexcept
+  {
+    [[maybe_unused]] const int __ret = ::munmap(__ptr, __length);
+    _CCCL_ASSERT(__ret == 0, "mmap_memory_resource::deallocate_sync failed");
+  }
+#  endif // ^^^ !_CCCL_OS(WINDOWS) ^^^
+};
+
+static_assert(::cuda::mr::synchronous_resource_with<mmap_memory_resource, ::cuda::mr::host_accessible>, "");
+
+_CCCL_END_NAMESPACE_CUDA_MR
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_CTK() && !_CCCL_COMPILER(NVRTC)
+
+#endif //_CUDA___MEMORY_RESOURCE_MMAP_MEMORY_RESOURCE_H
@@ -0,0 +1,229 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___MEMORY_RESOURCE_MONOTONIC_BUFFER_RESOURCE_H
+#define _CUDA___MEMORY_RESOURCE_MONOTONIC_BUFFER_RESOURCE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_CTK() && !_CCCL_COMPILER(NVRTC)
+
+#  include <cuda/__cmath/pow2.h>
+#  include <cuda/__cmath/round_up.h>
+#  include <cuda/__memory_resource/get_property.h>
+#  include <cuda/__memory_resource/mmap_memory_resource.h>
+#  include <cuda/__memory_resource/properties.h>
+#  include <cuda/__memory_resource/resource.h>
+#  include <cuda/std/__algorithm/max.h>
+#  include <cuda/std/__exception/exception_macros.h>
+#  include <cuda/std/__host_stdlib/stdexcept>
+#  include <cuda/std/__new_>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+#  include <cuda/std/cstdint>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+//! @file
+//! The \c monotonic_buffer_resource class provides an arena host memory resource with bulk release.
+_CCCL_BEGIN_NAMESPACE_CUDA_MR
+
+//! @brief \c monotonic_buffer_resource hands out host memory by bumping a pointer through buffers obtained from an
+//! upstream host resource, and only releases memory in bulk.
+//!
+//! Deallocation is a no-op. All memory is returned to the upstream resource by \c release or on destruction, which
+//! makes the resource well suited for the temporary allocations of a single phase of work. Each buffer obtained from
+//! upstream is twice as large as the previous one. An optional initial buffer supplied by the user is consumed first
+//! and never returned to upstream.
+//!
+//! The resource is not thread safe and is neither copyable nor movable. Use \c shared_resource to pass it to
+//! \c any_synchronous_resource or to containers.
+//!
+//! @tparam _Upstream The host accessible resource buffers are requested from.
+template <class _Upstream = mmap_memory_resource>
+class monotonic_buffer_resource : public ::cuda::forward_property<monotonic_buffer_resource<_Upstream>, _Upstream>
+{
+  static_assert(::cuda::mr::synchronous_resource_with<_Upstream, ::cuda::mr::host_accessible>,
+                "The upstream resource of monotonic_buffer_resource must provide host accessible memory");
+
+  static constexpr size_t __default_buffer_size = size_t{64} << 10;
+  static constexpr size_t __growth_factor       = 2;
+
+  //! Buffers from upstream carry their bookkeeping in a footer, so the usable space starts at the base.
+  struct __buffer_footer
+  {
+    __buffer_footer* __next_;
+    void* __base_;
+    size_t __bytes_;
+  };
+
+public:
+  //! @brief Construct a new \c monotonic_buffer_resource.
+  //! @param __upstream The resource buffers are requested from.
+  _CCCL_HOST_API explicit monotonic_buffer_resource(_Upstream __upstream = _Upstream{})
+      : monotonic_buffer_resource(__default_buffer_size, ::cuda::std::move(__upstream))
+  {}
+
+  //! @brief Construct a new \c monotonic_buffer_resource.
+  //! @param __initial_size The size of the first buffer requested from upstream.
+  //! @param __upstream The resource buffers are requested from.
+  _CCCL_HOST_API explicit monotonic_buffer_resource(const size_t __initial_size, _Upstream __upstream = _Upstream{})
+      : __upstream_(::cuda::std::move(__upstream))
+      , __initial_size_((::cuda::std::max) (__initial_size, size_t{1}))
+      , __next_size_(__initial_size_)
+  {}
+
+  //! @brief Construct a new \c monotonic_buffer_resource that first allocates from a user supplied buffer.
+  //! @param __buffer The initial buffer. It is not owned by the resource and must outlive it.
+  //! @param __buffer_size The size of \p __buffer in bytes.
+  //! @param __upstream The resource further buffers are requested from.
+  _CCCL_HOST_API monotonic_buffer_resource(void* __buffer, const size_t __buffer_size, _Upstream __upstream = _Upstream{})
+      : __upstream_(::cuda::std::move(__upstream))
+      , __initial_buffer_(__buffer)
+      , __initial_buffer_size_(__buffer_size)
+      , __initial_size_((::cuda::std::max) (__buffer_size * __growth_factor, __default_buffer_size))
+      , __next_size_(__initial_size_)
+      , __current_(static_cast<unsigned char*>(__buffer))
+      , __remaining_(__buffer_size)
+  {}
+
+  monotonic_buffer_resource(const monotonic_buffer_resource&)            = delete;
+  monotonic_buffer_resource& operator=(const monotonic_buffer_resource&) = delete;
+
+  //! @brief Returns all memory owned by the resource to the upstream resource.
+  _CCCL_HOST_API ~monotonic_buffer_resource()
+  {
+    release();
+  }
+
+  //! @brief Allocate host memory of size at least \p __bytes.
+  //! @param __bytes The size in bytes of the allocation.
+  //! @param __alignment The requested alignment of the allocation. Must be a power of two.
+  //! @throw std::invalid_argument in case of invalid alignment, or any exception thrown by the upstream resource.
+  //! @return Pointer to the newly allocated memory
+  [[nodiscard]] _CCCL_HOST_API void*
+  allocate_sync(const size_t __bytes, const size_t __alignment = alignof(::cuda::std::max_align_t))
+  {
+    if (!::cuda::is_power_of_two(__alignment))
+    {
+      _CCCL_THROW(::std::invalid_argument, "Invalid alignment passed to monotonic_buffer_resource::allocate_sync.");
+    }
+
+    if (void* __ptr = __bump(__bytes, __alignment))
+    {
+      return __ptr;
+    }
+
+    __grow(__bytes, __alignment);
+    return __bump(__bytes, __alignment);
+  }
+
+  //! @brief Deallocation is a no-op, memory is only reclaimed by \c release.
+  _CCCL_HOST_API void deallocate_sync(void*, size_t, size_t = alignof(::cuda::std::max_align_t)) noexcept {}
+
+  //! @brief Returns all buffers to the upstream resource and rewinds to the initial buffer, if any. This invalidates
+  //! every outstanding allocation.
+  _CCCL_HOST_API void release() noexcept
+  {
+    while (__buffers_ != nullptr)
+    {
+      __buffer_footer __footer = *__buffers_;
+      __upstream_.deallocate_sync(__footer.__base_, __footer.__bytes_, alignof(__buffer_footer));
+      __buffers_ = __footer.__next_;
+    }
+    __current_   = static_cast<unsigned char*>(__initial_buffer_);
+    __remaining_ = __initial_buffer_size_;
+    __next_size_ = __initial_size_;
+  }
+
+  //! @brief Returns the upstream resource.
+  [[nodiscard]] _CCCL_HOST_API const _Upstream& upstream_resource() const noexcept
+  {
+    return __upstream_;
+  }
+
+  //! @brief Equality comparison with another \c monotonic_buffer_resource.
+  //! @return Whether both refer to the same object.
+  [[nodiscard]] _CCCL_HOST_API bool operator==(monotonic_buffer_resource const& __other) const noexcept
+  {
+    return this == &__other;
+  }
+#  if _CCCL_STD_VER <= 2017
+  //! @brief Inequality comparison with another \c monotonic_buffer_resource.
+  //! @return Whether both refer to different objects.
+  [[nodiscard]] _CCCL_HOST_API bool operator!=(monotonic_buffer_resource const& __other) const noexcept
+  {
+    return this != &__other;
+  }
+#  endif // _CCCL_STD_VER <= 2017
+
+private:
+  _Upstream __upstream_;
+  void* __initial_buffer_       = nullptr;
+  size_t __initial_buffer_size_ = 0;
+  size_t __initial_size_;
+  size_t __next_size_;
+  unsigned char* __current_   = nullptr;
+  size_t __remaining_         = 0;
+  __buffer_footer* __buffers_ = nullptr;
+
+  //! @brief Carves an allocation out of the current buffer.
+  //! @return The allocation, or \c nullptr if the current buffer is exhausted.
+  [[nodiscard]] _CCCL_HOST_API void* __bump(const size_t __bytes, const size_t __alignment) noexcept
+  {
+    if (__current_ == nullptr)
+    {
+      return nullptr;
+    }
+    const auto __address = reinterpret_cast<::cuda::std::uintptr_t>(__current_);
+    const size_t __skip  = ::cuda::round_up(__address, __alignment) - __address;
+    if (__skip > __remaining_ || __bytes > __remaining_ - __skip)
+    {
+      return nullptr;
+    }
+    void* __ptr = __current_ + __skip;
+    __current_ += __skip + __bytes;
+    __remaining_ -= __skip + __bytes;
+    return __ptr;
+  }
+
+  //! @brief Requests a new buffer from upstream that is large enough for an allocation of \p __bytes.
+  _CCCL_HOST_API void __grow(const size_t __bytes, const size_t __alignment)
+  {
+    const size_t __usable = ::cuda::round_up(
+      (::cuda::std::max) (__next_size_, __bytes + __alignment - 1), alignof(__buffer_footer));
+    const size_t __total = __usable + sizeof(__buffer_footer);
+    void* __base         = __upstream_.allocate_sync(__total, alignof(__buffer_footer));
+
+    auto* __first = static_cast<unsigned char*>(__base);
+    __buffers_    = ::new (__first + __usable) __buffer_footer{__buffers_, __base, __total};
+    __current_    = __first;
+    __remaining_  = __usable;
+    __next_size_  = __usable * __growth_factor;
+  }
+};
+
+static_assert(::cuda::mr::synchronous_resource_with<monotonic_buffer_resource<>, ::cuda::mr::host_accessible>, "");
+
+_CCCL_END_NAMESPACE_CUDA_MR
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_CTK() && !_CCCL_COMPILER(NVRTC)
+
+#endif //_CUDA___MEMORY_RESOURCE_MONOTONIC_BUFFER_RESOURCE_H
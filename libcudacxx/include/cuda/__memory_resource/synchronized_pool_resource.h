@@ -0,0 +1,311 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___MEMORY_RESOURCE_SYNCHRONIZED_POOL_RESOURCE_H
+#define _CUDA___MEMORY_RESOURCE_SYNCHRONIZED_POOL_RESOURCE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_CTK() && !_CCCL_COMPILER(NVRTC)
+
+#  include <cuda/__cmath/pow2.h>
+#  include <cuda/__memory_resource/get_property.h>
+#  include <cuda/__memory_resource/mmap_memory_resource.h>
+#  include <cuda/__memory_resource/properties.h>
+#  include <cuda/__memory_resource/resource.h>
+#  include <cuda/std/__algorithm/max.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__bit/integral.h>
+#  include <cuda/std/__exception/exception_macros.h>
+#  include <cuda/std/__host_stdlib/stdexcept>
+#  include <cuda/std/__new_>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <mutex>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+//! @file
+//! The \c synchronized_pool_resource class provides a thread safe pooling host memory resource.
+_CCCL_BEGIN_NAMESPACE_CUDA_MR
+
+//! @brief \c pool_options controls the size classes and chunk sizes of \c synchronized_pool_resource.
+struct pool_options
+{
+  //! The maximum number of blocks a single chunk requested from upstream holds. Chunks start small and grow
+  //! geometrically up to this limit. A value of zero selects an implementation defined default.
+  size_t max_blocks_per_chunk = 0;
+  //! The largest allocation served from the pool. Larger allocations are forwarded to the upstream resource. A value
+  //! of zero selects an implementation defined default.
+  size_t largest_required_pool_block = 0;
+};
+
+//! @brief \c synchronized_pool_resource serves host allocations from power of two size classes, refilled in chunks
+//! from an upstream host resource.
+//!
+//! Each size class keeps an intrusive free list guarded by its own mutex, so threads allocating different sizes do not
+//! contend. Blocks are aligned to their size class. Allocations whose size or alignment exceeds
+//! \c largest_required_pool_block are forwarded to the upstream resource. Memory is only returned to the upstream
+//! resource by \c release or on destruction.
+//!
+//! The resource is neither copyable nor movable. Use \c shared_resource to pass it to \c any_synchronous_resource or
+//! to containers.
+//!
+//! @tparam _Upstream The host accessible resource chunks are requested from.
+template <class _Upstream = mmap_memory_resource>
+class synchronized_pool_resource : public ::cuda::forward_property<synchronized_pool_resource<_Upstream>, _Upstream>
+{
+  static_assert(::cuda::mr::synchronous_resource_with<_Upstream, ::cuda::mr::host_accessible>,
+                "The upstream resource of synchronized_pool_resource must provide host accessible memory");
+
+  static constexpr size_t __min_block_size           = alignof(::cuda::std::max_align_t);
+  static constexpr size_t __default_largest_block    = size_t{64} << 10;
+  static constexpr size_t __default_blocks_per_chunk = 1024;
+  static constexpr size_t __min_chunk_bytes          = size_t{64} << 10;
+  static constexpr size_t __max_size_classes         = 48;
+
+  struct __free_block
+  {
+    __free_block* __next_;
+  };
+
+  //! Chunks carry their bookkeeping in a footer so that blocks start at the aligned base of the chunk.
+  struct __chunk_footer
+  {
+    __chunk_footer* __next_;
+    void* __base_;
+    size_t __bytes_;
+    size_t __alignment_;
+  };
+
+  //! Padded to a cache line so that threads working on different size classes do not share one.
+  struct alignas(64) __size_class
+  {
+    ::std::mutex __mutex_;
+    __free_block* __free_list_ = nullptr;
+    __chunk_footer* __chunks_  = nullptr;
+    size_t __next_blocks_      = 0;
+  };
+
+public:
+  //! @brief Construct a new \c synchronized_pool_resource.
+  //! @param __options The options controlling size classes and chunk growth.
+  //! @param __upstream The resource chunks and oversized allocations are requested from.
+  _CCCL_HOST_API explicit synchronized_pool_resource(pool_options __options = {}, _Upstream __upstream = _Upstream{})
+      : __upstream_(::cuda::std::move(__upstream))
+      , __options_(__normalize(__options))
+      , __num_classes_(::cuda::std::__bit_log2(__options_.largest_required_pool_block / __min_block_size) + 1)
+  {
+    for (size_t __i = 0; __i < __num_classes_; ++__i)
+    {
+      __classes_[__i].__next_blocks_ = __initial_blocks_per_chunk(__i);
+    }
+  }
+
+  //! @brief Construct a new \c synchronized_pool_resource with default options.
+  //! @param __upstream The resource chunks and oversized allocations are requested from.
+  _CCCL_HOST_API explicit synchronized_pool_resource(_Upstream __upstream)
+      : synchronized_pool_resource(pool_options{}, ::cuda::std::move(__upstream))
+  {}
+
+  synchronized_pool_resource(const synchronized_pool_resource&)            = delete;
+  synchronized_pool_resource& operator=(const synchronized_pool_resource&) = delete;
+
+  //! @brief Returns all memory owned by the pool to the upstream resource.
+  _CCCL_HOST_API ~synchronized_pool_resource()
+  {
+    release();
+  }
+
+  //! @brief Allocate host memory of size at least \p __bytes.
+  //! @param __bytes The size in bytes of the allocation.
+  //! @param __alignment The requested alignment of the allocation. Must be a power of two.
+  //! @throw std::invalid_argument in case of invalid alignment, or any exception thrown by the upstream resource.
+  //! @return Pointer to the newly allocated memory
+  [[nodiscard]] _CCCL_HOST_API void*
+  allocate_sync(const size_t __bytes, const size_t __alignment = alignof(::cuda::std::max_align_t))
+  {
+    if (!::cuda::is_power_of_two(__alignment))
+    {
+      _CCCL_THROW(::std::invalid_argument, "Invalid alignment passed to synchronized_pool_resource::allocate_sync.");
+    }
+
+    const size_t __index = __size_class_index(__bytes, __alignment);
+    if (__index == __num_classes_)
+    {
+      return __upstream_.allocate_sync(__bytes, __alignment);
+    }
+
+    __size_class& __class = __classes_[__index];
+    ::std::lock_guard<::std::mutex> __lock(__class.__mutex_);
+    if (__class.__free_list_ == nullptr)
+    {
+      __refill(__class, __block_size(__index));
+    }
+    __free_block* __block = __class.__free_list_;
+    __class.__free_list_  = __block->__next_;
+    return __block;
+  }
+
+  //! @brief Return memory pointed to by \p __ptr to the pool.
+  //! @param __ptr Pointer to be deallocated. Must have been allocated through a call to `allocate_sync` on this
+  //! resource.
+  //! @param __bytes The number of bytes that was passed to the allocation call that returned \p __ptr.
+  //! @param __alignment The alignment that was passed to the allocation call that returned \p __ptr.
+  _CCCL_HOST_API void deallocate_sync(
+    void* __ptr, const size_t __bytes, const size_t __alignment = alignof(::cuda::std::max_align_t)) noexcept
+  {
+    _CCCL_ASSERT(::cuda::is_power_of_two(__alignment),
+                 "Invalid alignment passed to synchronized_pool_resource::deallocate_sync.");
+    const size_t __index = __size_class_index(__bytes, __alignment);
+    if (__index == __num_classes_)
+    {
+      __upstream_.deallocate_sync(__ptr, __bytes, __alignment);
+      return;
+    }
+
+    __size_class& __class = __classes_[__index];
+    ::std::lock_guard<::std::mutex> __lock(__class.__mutex_);
+    __class.__free_list_ = ::new (__ptr) __free_block{__class.__free_list_};
+  }
+
+  //! @brief Returns all chunks to the upstream resource, invalidating every outstanding pooled allocation.
+  //! @note Allocations that were forwarded to the upstream resource are not affected.
+  _CCCL_HOST_API void release() noexcept
+  {
+    for (size_t __i = 0; __i < __num_classes_; ++__i)
+    {
+      __size_class& __class = __classes_[__i];
+      ::std::lock_guard<::std::mutex> __lock(__class.__mutex_);
+      while (__class.__chunks_ != nullptr)
+      {
+        __chunk_footer __footer = *__class.__chunks_;
+        __upstream_.deallocate_sync(__footer.__base_, __footer.__bytes_, __footer.__alignment_);
+        __class.__chunks_ = __footer.__next_;
+      }
+      __class.__free_list_   = nullptr;
+      __class.__next_blocks_ = __initial_blocks_per_chunk(__i);
+    }
+  }
+
+  //! @brief Returns the options of the pool, with defaulted values resolved.
+  [[nodiscard]] _CCCL_HOST_API pool_options options() const noexcept
+  {
+    return __options_;
+  }
+
+  //! @brief Returns the upstream resource.
+  [[nodiscard]] _CCCL_HOST_API const _Upstream& upstream_resource() const noexcept
+  {
+    return __upstream_;
+  }
+
+  //! @brief Equality comparison with another \c synchronized_pool_resource.
+  //! @return Whether both refer to the same object, as memory can only be returned to the pool it came from.
+  [[nodiscard]] _CCCL_HOST_API bool operator==(synchronized_pool_resource const& __other) const noexcept
+  {
+    return this == &__other;
+  }
+#  if _CCCL_STD_VER <= 2017
+  //! @brief Inequality comparison with another \c synchronized_pool_resource.
+  //! @return Whether both refer to different objects.
+  [[nodiscard]] _CCCL_HOST_API bool operator!=(synchronized_pool_resource const& __other) const noexcept
+  {
+    return this != &__other;
+  }
+#  endif // _CCCL_STD_VER <= 2017
+
+private:
+  _Upstream __upstream_;
+  pool_options __options_;
+  size_t __num_classes_;
+  __size_class __classes_[__max_size_classes];
+
+  [[nodiscard]] _CCCL_HOST_API static pool_options __normalize(pool_options __options)
+  {
+    if (__options.max_blocks_per_chunk == 0)
+    {
+      __options.max_blocks_per_chunk = __default_blocks_per_chunk;
+    }
+    if (__options.largest_required_pool_block == 0)
+    {
+      __options.largest_required_pool_block = __default_largest_block;
+    }
+    if (__options.largest_required_pool_block > (size_t{1} << (__max_size_classes - 1)) * __min_block_size)
+    {
+      _CCCL_THROW(::std::invalid_argument, "largest_required_pool_block of synchronized_pool_resource is too large.");
+    }
+    __options.largest_required_pool_block =
+      (::cuda::std::max) (__min_block_size, ::cuda::std::bit_ceil(__options.largest_required_pool_block));
+    return __options;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static constexpr size_t __block_size(const size_t __index) noexcept
+  {
+    return __min_block_size << __index;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API size_t __initial_blocks_per_chunk(const size_t __index) const noexcept
+  {
+    return (::cuda::std::min) (__options_.max_blocks_per_chunk,
+                               (::cuda::std::max) (size_t{1}, __min_chunk_bytes / __block_size(__index)));
+  }
+
+  //! @brief Blocks are aligned to their size, so the size class has to cover the alignment as well.
+  //! @return The index of the size class, or \c __num_classes_ if the allocation bypasses the pool.
+  [[nodiscard]] _CCCL_HOST_API size_t __size_class_index(const size_t __bytes, const size_t __alignment) const noexcept
+  {
+    const size_t __needed = (::cuda::std::max) ({__bytes, __alignment, __min_block_size});
+    if (__needed > __options_.largest_required_pool_block)
+    {
+      return __num_classes_;
+    }
+    return ::cuda::std::__bit_log2(::cuda::std::bit_ceil(__needed) / __min_block_size);
+  }
+
+  //! @brief Requests a new chunk for \p __class and threads its blocks onto the free list. Must be called with the
+  //! mutex of \p __class held.
+  _CCCL_HOST_API void __refill(__size_class& __class, const size_t __block_bytes)
+  {
+    const size_t __blocks = __class.__next_blocks_;
+    const size_t __bytes  = __blocks * __block_bytes + sizeof(__chunk_footer);
+    void* __base          = __upstream_.allocate_sync(__bytes, __block_bytes);
+
+    auto* __first = static_cast<unsigned char*>(__base);
+    __class.__chunks_ =
+      ::new (__first + __blocks * __block_bytes) __chunk_footer{__class.__chunks_, __base, __bytes, __block_bytes};
+
+    // Thread the blocks back to front, so that allocations walk the chunk in address order
+    for (size_t __i = __blocks; __i > 0; --__i)
+    {
+      __class.__free_list_ = ::new (__first + (__i - 1) * __block_bytes) __free_block{__class.__free_list_};
+    }
+    __class.__next_blocks_ = (::cuda::std::min) (__blocks * 2, __options_.max_blocks_per_chunk);
+  }
+};
+
+static_assert(::cuda::mr::synchronous_resource_with<synchronized_pool_resource<>, ::cuda::mr::host_accessible>, "");
+
+_CCCL_END_NAMESPACE_CUDA_MR
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_CTK() && !_CCCL_COMPILER(NVRTC)
+
+#endif //_CUDA___MEMORY_RESOURCE_SYNCHRONIZED_POOL_RESOURCE_H
@@ -0,0 +1,88 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_CONCEPTS_H
+#define _CUDA_STD___LINALG_CONCEPTS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__type_traits/is_assignable.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg::__detail
+{
+// [linalg.helpers.concepts]
+template <class _Tp, size_t _Rank>
+inline constexpr bool __is_mdspan_of_rank_v = false;
+
+template <class _ElementType, class _Extents, class _Layout, class _Accessor, size_t _Rank>
+inline constexpr bool __is_mdspan_of_rank_v<mdspan<_ElementType, _Extents, _Layout, _Accessor>, _Rank> =
+  _Extents::rank() == _Rank;
+
+template <class _Tp, size_t _Rank>
+inline constexpr bool __is_output_mdspan_of_rank_v = false;
+
+template <class _ElementType, class _Extents, class _Layout, class _Accessor, size_t _Rank>
+inline constexpr bool __is_output_mdspan_of_rank_v<mdspan<_ElementType, _Extents, _Layout, _Accessor>, _Rank> =
+  _Extents::rank() == _Rank && is_assignable_v<typename _Accessor::reference, _ElementType>
+  && _Layout::template mapping<_Extents>::is_always_unique();
+
+template <class _Tp>
+_CCCL_CONCEPT __in_vector = __is_mdspan_of_rank_v<_Tp, 1>;
+
+template <class _Tp>
+_CCCL_CONCEPT __out_vector = __is_output_mdspan_of_rank_v<_Tp, 1>;
+
+template <class _Tp>
+_CCCL_CONCEPT __inout_vector = __is_output_mdspan_of_rank_v<_Tp, 1>;
+
+template <class _Tp>
+_CCCL_CONCEPT __in_matrix = __is_mdspan_of_rank_v<_Tp, 2>;
+
+template <class _Tp>
+_CCCL_CONCEPT __out_matrix = __is_output_mdspan_of_rank_v<_Tp, 2>;
+
+template <class _Tp>
+_CCCL_CONCEPT __inout_matrix = __is_output_mdspan_of_rank_v<_Tp, 2>;
+
+//! Whether the columns of \p __a are contiguous in memory, so that column oriented loops access it with unit stride.
+template <class _Mdspan>
+[[nodiscard]] _CCCL_API constexpr bool __has_unit_row_stride(const _Mdspan& __a) noexcept
+{
+  if constexpr (_Mdspan::is_always_strided())
+  {
+    return __a.stride(0) == 1;
+  }
+  else
+  {
+    return false;
+  }
+}
+} // namespace linalg::__detail
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_CONCEPTS_H
@@ -0,0 +1,112 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_DOT_H
+#define _CUDA_STD___LINALG_DOT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__linalg/concepts.h>
+#include <cuda/std/__linalg/conjugated.h>
+#include <cuda/std/__utility/declval.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+namespace __detail
+{
+// Independent partial sums break the dependency chain of the additions, so that the additions of the lanes overlap.
+inline constexpr size_t __dot_lanes = 4;
+
+template <class _InVec1, class _InVec2, class _Scalar>
+[[nodiscard]] _CCCL_API constexpr _Scalar __dot(const _InVec1& __v1, const _InVec2& __v2, _Scalar __init)
+{
+  _CCCL_ASSERT(static_cast<size_t>(__v1.extent(0)) == static_cast<size_t>(__v2.extent(0)),
+               "dot: the vectors must have the same extent");
+  const size_t __n = static_cast<size_t>(__v1.extent(0));
+
+  _Scalar __acc[__dot_lanes]{};
+  size_t __i = 0;
+  for (; __i + __dot_lanes <= __n; __i += __dot_lanes)
+  {
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (size_t __l = 0; __l < __dot_lanes; ++__l)
+    {
+      __acc[__l] += __v1(__i + __l) * __v2(__i + __l);
+    }
+  }
+  for (; __i < __n; ++__i)
+  {
+    __acc[0] += __v1(__i) * __v2(__i);
+  }
+  return __init + ((__acc[0] + __acc[1]) + (__acc[2] + __acc[3]));
+}
+
+template <class _InVec1, class _InVec2>
+using __dot_result_t = decltype(::cuda::std::declval<typename _InVec1::value_type>()
+                                * ::cuda::std::declval<typename _InVec2::value_type>());
+} // namespace __detail
+
+// [linalg.algs.blas1.dot]
+
+//! Returns \p __init plus the sum of the products of the elements of \p __v1 and \p __v2.
+_CCCL_TEMPLATE(class _InVec1, class _InVec2, class _Scalar)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec1> _CCCL_AND __detail::__in_vector<_InVec2>)
+[[nodiscard]] _CCCL_API constexpr _Scalar dot(_InVec1 __v1, _InVec2 __v2, _Scalar __init)
+{
+  return ::cuda::std::linalg::__detail::__dot(__v1, __v2, __init);
+}
+
+//! Returns the sum of the products of the elements of \p __v1 and \p __v2.
+_CCCL_TEMPLATE(class _InVec1, class _InVec2)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec1> _CCCL_AND __detail::__in_vector<_InVec2>)
+[[nodiscard]] _CCCL_API constexpr auto dot(_InVec1 __v1, _InVec2 __v2)
+{
+  return ::cuda::std::linalg::__detail::__dot(__v1, __v2, __detail::__dot_result_t<_InVec1, _InVec2>{});
+}
+
+//! Returns \p __init plus the sum of the products of the conjugated elements of \p __v1 and the elements of \p __v2.
+_CCCL_TEMPLATE(class _InVec1, class _InVec2, class _Scalar)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec1> _CCCL_AND __detail::__in_vector<_InVec2>)
+[[nodiscard]] _CCCL_API constexpr _Scalar dotc(_InVec1 __v1, _InVec2 __v2, _Scalar __init)
+{
+  return ::cuda::std::linalg::__detail::__dot(::cuda::std::linalg::conjugated(__v1), __v2, __init);
+}
+
+//! Returns the sum of the products of the conjugated elements of \p __v1 and the elements of \p __v2.
+_CCCL_TEMPLATE(class _InVec1, class _InVec2)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec1> _CCCL_AND __detail::__in_vector<_InVec2>)
+[[nodiscard]] _CCCL_API constexpr auto dotc(_InVec1 __v1, _InVec2 __v2)
+{
+  auto __conj_v1 = ::cuda::std::linalg::conjugated(__v1);
+  return ::cuda::std::linalg::__detail::__dot(
+    __conj_v1, __v2, __detail::__dot_result_t<decltype(__conj_v1), _InVec2>{});
+}
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_DOT_H
@@ -0,0 +1,117 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_MATRIX_PRODUCT_H
+#define _CUDA_STD___LINALG_MATRIX_PRODUCT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__linalg/concepts.h>
+#include <cuda/std/__linalg/matrix_product_kernel.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+namespace __detail
+{
+template <class _InMat1, class _InMat2, class _OutMat>
+_CCCL_API constexpr void __check_matrix_product_extents(
+  [[maybe_unused]] const _InMat1& __a, [[maybe_unused]] const _InMat2& __b, [[maybe_unused]] const _OutMat& __c)
+{
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(0)) == static_cast<size_t>(__c.extent(0)),
+               "matrix_product: A and C must have the same number of rows");
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(1)) == static_cast<size_t>(__b.extent(0)),
+               "matrix_product: the columns of A must match the rows of B");
+  _CCCL_ASSERT(static_cast<size_t>(__b.extent(1)) == static_cast<size_t>(__c.extent(1)),
+               "matrix_product: B and C must have the same number of columns");
+}
+} // namespace __detail
+
+// [linalg.algs.blas3.gemm]
+
+//! Computes C = A * B with a cache tiled, register blocked kernel that reads A and B through their accessors.
+_CCCL_TEMPLATE(class _InMat1, class _InMat2, class _OutMat)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat1> _CCCL_AND __detail::__in_matrix<_InMat2> _CCCL_AND
+                 __detail::__out_matrix<_OutMat>)
+_CCCL_API constexpr void matrix_product(_InMat1 __a, _InMat2 __b, _OutMat __c)
+{
+  using __value_t = typename _OutMat::value_type;
+  ::cuda::std::linalg::__detail::__check_matrix_product_extents(__a, __b, __c);
+
+  const size_t __m = static_cast<size_t>(__c.extent(0));
+  const size_t __n = static_cast<size_t>(__c.extent(1));
+  const size_t __k = static_cast<size_t>(__a.extent(1));
+  for (size_t __i = 0; __i < __m; ++__i)
+  {
+    for (size_t __j = 0; __j < __n; ++__j)
+    {
+      __c(__i, __j) = __value_t{};
+    }
+  }
+  ::cuda::std::linalg::__detail::__matrix_product_accumulate<false, __value_t>(
+    ::cuda::std::linalg::__detail::__make_offset_matrix(__a),
+    ::cuda::std::linalg::__detail::__make_offset_matrix(__b),
+    ::cuda::std::linalg::__detail::__make_offset_matrix(__c),
+    __m,
+    __n,
+    __k);
+}
+
+//! Computes C = E + A * B. \p __e may be the same as \p __c.
+_CCCL_TEMPLATE(class _InMat1, class _InMat2, class _InMat3, class _OutMat)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat1> _CCCL_AND __detail::__in_matrix<_InMat2> _CCCL_AND
+                 __detail::__in_matrix<_InMat3> _CCCL_AND __detail::__out_matrix<_OutMat>)
+_CCCL_API constexpr void matrix_product(_InMat1 __a, _InMat2 __b, _InMat3 __e, _OutMat __c)
+{
+  using __value_t = typename _OutMat::value_type;
+  ::cuda::std::linalg::__detail::__check_matrix_product_extents(__a, __b, __c);
+  _CCCL_ASSERT(static_cast<size_t>(__e.extent(0)) == static_cast<size_t>(__c.extent(0))
+                 && static_cast<size_t>(__e.extent(1)) == static_cast<size_t>(__c.extent(1)),
+               "matrix_product: E and C must have the same extents");
+
+  const size_t __m = static_cast<size_t>(__c.extent(0));
+  const size_t __n = static_cast<size_t>(__c.extent(1));
+  const size_t __k = static_cast<size_t>(__a.extent(1));
+  for (size_t __i = 0; __i < __m; ++__i)
+  {
+    for (size_t __j = 0; __j < __n; ++__j)
+    {
+      __c(__i, __j) = static_cast<__value_t>(__e(__i, __j));
+    }
+  }
+  ::cuda::std::linalg::__detail::__matrix_product_accumulate<false, __value_t>(
+    ::cuda::std::linalg::__detail::__make_offset_matrix(__a),
+    ::cuda::std::linalg::__detail::__make_offset_matrix(__b),
+    ::cuda::std::linalg::__detail::__make_offset_matrix(__c),
+    __m,
+    __n,
+    __k);
+}
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_MATRIX_PRODUCT_H
@@ -0,0 +1,184 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_MATRIX_PRODUCT_KERNEL_H
+#define _CUDA_STD___LINALG_MATRIX_PRODUCT_KERNEL_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/cstddef>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg::__detail
+{
+//! A view of an mdspan of rank 2 that starts at row \c __row_ and column \c __col_. Elements are still accessed through
+//! the accessor and layout of the mdspan, so that adaptors like \c scaled or \c transposed are applied on the fly.
+template <class _Mdspan>
+struct __offset_matrix
+{
+  _Mdspan __m_;
+  size_t __row_;
+  size_t __col_;
+
+  [[nodiscard]] _CCCL_API constexpr decltype(auto) operator()(const size_t __i, const size_t __j) const
+  {
+    return __m_(__row_ + __i, __col_ + __j);
+  }
+};
+
+template <class _Mdspan>
+[[nodiscard]] _CCCL_API constexpr __offset_matrix<_Mdspan>
+__make_offset_matrix(const _Mdspan& __m, const size_t __row = 0, const size_t __col = 0)
+{
+  return __offset_matrix<_Mdspan>{__m, __row, __col};
+}
+
+// The microkernel keeps a __gemm_mr x __gemm_nr block of the result in scalar registers, so that every element of A and
+// B it loads through the accessors is used __gemm_nr or __gemm_mr times. It does not use vector instructions itself.
+// The iteration space is tiled so that a __gemm_kc x __gemm_nr panel of B stays in L1 while it is multiplied with a
+// __gemm_mc x __gemm_kc tile of A in L2.
+inline constexpr size_t __gemm_mr = 4;
+inline constexpr size_t __gemm_nr = 4;
+inline constexpr size_t __gemm_kc = 256;
+inline constexpr size_t __gemm_mc = 64;
+
+template <bool _Subtract, class _Value, class _Out>
+_CCCL_API constexpr void __gemm_store(const _Out& __c, const size_t __i, const size_t __j, const _Value& __value)
+{
+  if constexpr (_Subtract)
+  {
+    __c(__i, __j) = __c(__i, __j) - __value;
+  }
+  else
+  {
+    __c(__i, __j) = __c(__i, __j) + __value;
+  }
+}
+
+template <bool _Subtract, class _Value, class _InA, class _InB, class _Out>
+_CCCL_API constexpr void __gemm_microkernel(
+  const _InA& __a, const _InB& __b, const _Out& __c, const size_t __i, const size_t __j, size_t __k0, const size_t __k1)
+{
+  _Value __acc[__gemm_mr][__gemm_nr]{};
+  for (; __k0 < __k1; ++__k0)
+  {
+    _Value __av[__gemm_mr]{};
+    _Value __bv[__gemm_nr]{};
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (size_t __r = 0; __r < __gemm_mr; ++__r)
+    {
+      __av[__r] = static_cast<_Value>(__a(__i + __r, __k0));
+    }
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (size_t __s = 0; __s < __gemm_nr; ++__s)
+    {
+      __bv[__s] = static_cast<_Value>(__b(__k0, __j + __s));
+    }
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (size_t __r = 0; __r < __gemm_mr; ++__r)
+    {
+      _CCCL_PRAGMA_UNROLL_FULL()
+      for (size_t __s = 0; __s < __gemm_nr; ++__s)
+      {
+        __acc[__r][__s] += __av[__r] * __bv[__s];
+      }
+    }
+  }
+
+  _CCCL_PRAGMA_UNROLL_FULL()
+  for (size_t __r = 0; __r < __gemm_mr; ++__r)
+  {
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (size_t __s = 0; __s < __gemm_nr; ++__s)
+    {
+      ::cuda::std::linalg::__detail::__gemm_store<_Subtract>(__c, __i + __r, __j + __s, __acc[__r][__s]);
+    }
+  }
+}
+
+//! Handles the partial blocks at the bottom and right edges of the result.
+template <bool _Subtract, class _Value, class _InA, class _InB, class _Out>
+_CCCL_API constexpr void __gemm_edge_kernel(
+  const _InA& __a,
+  const _InB& __b,
+  const _Out& __c,
+  const size_t __i,
+  const size_t __j,
+  const size_t __rows,
+  const size_t __cols,
+  const size_t __k0,
+  const size_t __k1)
+{
+  for (size_t __r = __i; __r < __i + __rows; ++__r)
+  {
+    for (size_t __s = __j; __s < __j + __cols; ++__s)
+    {
+      _Value __acc{};
+      for (size_t __p = __k0; __p < __k1; ++__p)
+      {
+        __acc += static_cast<_Value>(__a(__r, __p)) * static_cast<_Value>(__b(__p, __s));
+      }
+      ::cuda::std::linalg::__detail::__gemm_store<_Subtract>(__c, __r, __s, __acc);
+    }
+  }
+}
+
+//! Computes C += A * B, or C -= A * B if \p _Subtract is set, where A is \p __m x \p __k and B is \p __k x \p __n.
+//! The arguments are callables with the signature of \c mdspan::operator() of rank 2, usually \c __offset_matrix.
+template <bool _Subtract, class _Value, class _InA, class _InB, class _Out>
+_CCCL_API constexpr void __matrix_product_accumulate(
+  const _InA& __a, const _InB& __b, const _Out& __c, const size_t __m, const size_t __n, const size_t __k)
+{
+  for (size_t __kk = 0; __kk < __k; __kk += __gemm_kc)
+  {
+    const size_t __k_end = (::cuda::std::min) (__kk + __gemm_kc, __k);
+    for (size_t __ii = 0; __ii < __m; __ii += __gemm_mc)
+    {
+      const size_t __i_end = (::cuda::std::min) (__ii + __gemm_mc, __m);
+      for (size_t __j = 0; __j < __n; __j += __gemm_nr)
+      {
+        const size_t __cols = (::cuda::std::min) (__gemm_nr, __n - __j);
+        for (size_t __i = __ii; __i < __i_end; __i += __gemm_mr)
+        {
+          const size_t __rows = (::cuda::std::min) (__gemm_mr, __i_end - __i);
+          if (__rows == __gemm_mr && __cols == __gemm_nr)
+          {
+            ::cuda::std::linalg::__detail::__gemm_microkernel<_Subtract, _Value>(
+              __a, __b, __c, __i, __j, __kk, __k_end);
+          }
+          else
+          {
+            ::cuda::std::linalg::__detail::__gemm_edge_kernel<_Subtract, _Value>(
+              __a, __b, __c, __i, __j, __rows, __cols, __kk, __k_end);
+          }
+        }
+      }
+    }
+  }
+}
+} // namespace linalg::__detail
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_MATRIX_PRODUCT_KERNEL_H
@@ -0,0 +1,189 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_MATRIX_VECTOR_PRODUCT_H
+#define _CUDA_STD___LINALG_MATRIX_VECTOR_PRODUCT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__linalg/concepts.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+namespace __detail
+{
+// Number of rows or columns of A processed per pass over x or y.
+inline constexpr size_t __gemv_block = 4;
+
+//! Computes y(i) = y0(i) + A(i, :) * x with one dot product per row, __gemv_block rows at a time. \p __y0 is read
+//! before y(i) is written, so it may alias \p __y.
+template <class _InMat, class _InVec1, class _InVec2, class _OutVec>
+_CCCL_API constexpr void
+__matrix_vector_product_rows(const _InMat& __a, const _InVec1& __x, const _InVec2& __y0, const _OutVec& __y)
+{
+  using __value_t  = typename _OutVec::value_type;
+  const size_t __m = static_cast<size_t>(__a.extent(0));
+  const size_t __n = static_cast<size_t>(__a.extent(1));
+
+  size_t __i = 0;
+  for (; __i + __gemv_block <= __m; __i += __gemv_block)
+  {
+    __value_t __acc[__gemv_block]{};
+    for (size_t __j = 0; __j < __n; ++__j)
+    {
+      const __value_t __xj = static_cast<__value_t>(__x(__j));
+      _CCCL_PRAGMA_UNROLL_FULL()
+      for (size_t __r = 0; __r < __gemv_block; ++__r)
+      {
+        __acc[__r] += static_cast<__value_t>(__a(__i + __r, __j)) * __xj;
+      }
+    }
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (size_t __r = 0; __r < __gemv_block; ++__r)
+    {
+      __y(__i + __r) = static_cast<__value_t>(__y0(__i + __r)) + __acc[__r];
+    }
+  }
+  for (; __i < __m; ++__i)
+  {
+    __value_t __acc{};
+    for (size_t __j = 0; __j < __n; ++__j)
+    {
+      __acc += static_cast<__value_t>(__a(__i, __j)) * static_cast<__value_t>(__x(__j));
+    }
+    __y(__i) = static_cast<__value_t>(__y0(__i)) + __acc;
+  }
+}
+
+//! Computes y += A * x as a sequence of scaled column additions, __gemv_block columns at a time. This accesses A with
+//! unit stride if its columns are contiguous.
+template <class _InMat, class _InVec, class _OutVec>
+_CCCL_API constexpr void __matrix_vector_product_columns(const _InMat& __a, const _InVec& __x, const _OutVec& __y)
+{
+  using __value_t  = typename _OutVec::value_type;
+  const size_t __m = static_cast<size_t>(__a.extent(0));
+  const size_t __n = static_cast<size_t>(__a.extent(1));
+
+  size_t __j = 0;
+  for (; __j + __gemv_block <= __n; __j += __gemv_block)
+  {
+    __value_t __xj[__gemv_block]{};
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (size_t __s = 0; __s < __gemv_block; ++__s)
+    {
+      __xj[__s] = static_cast<__value_t>(__x(__j + __s));
+    }
+    for (size_t __i = 0; __i < __m; ++__i)
+    {
+      __value_t __sum = static_cast<__value_t>(__y(__i));
+      _CCCL_PRAGMA_UNROLL_FULL()
+      for (size_t __s = 0; __s < __gemv_block; ++__s)
+      {
+        __sum += static_cast<__value_t>(__a(__i, __j + __s)) * __xj[__s];
+      }
+      __y(__i) = __sum;
+    }
+  }
+  for (; __j < __n; ++__j)
+  {
+    const __value_t __xj = static_cast<__value_t>(__x(__j));
+    for (size_t __i = 0; __i < __m; ++__i)
+    {
+      __y(__i) = static_cast<__value_t>(__y(__i)) + static_cast<__value_t>(__a(__i, __j)) * __xj;
+    }
+  }
+}
+
+template <class _InMat, class _InVec1, class _InVec2, class _OutVec>
+_CCCL_API constexpr void
+__matrix_vector_product(const _InMat& __a, const _InVec1& __x, const _InVec2& __y0, const _OutVec& __y)
+{
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(1)) == static_cast<size_t>(__x.extent(0)),
+               "matrix_vector_product: the columns of A must match the extent of x");
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(0)) == static_cast<size_t>(__y.extent(0))
+                 && static_cast<size_t>(__y0.extent(0)) == static_cast<size_t>(__y.extent(0)),
+               "matrix_vector_product: the rows of A must match the extent of y");
+
+  if (::cuda::std::linalg::__detail::__has_unit_row_stride(__a))
+  {
+    using __value_t  = typename _OutVec::value_type;
+    const size_t __m = static_cast<size_t>(__y.extent(0));
+    for (size_t __i = 0; __i < __m; ++__i)
+    {
+      __y(__i) = static_cast<__value_t>(__y0(__i));
+    }
+    ::cuda::std::linalg::__detail::__matrix_vector_product_columns(__a, __x, __y);
+  }
+  else
+  {
+    ::cuda::std::linalg::__detail::__matrix_vector_product_rows(__a, __x, __y0, __y);
+  }
+}
+
+//! An input vector of \p _Extents whose elements are all zero.
+template <class _Value, class _Extents>
+struct __zero_vector
+{
+  _Extents __extents_;
+
+  [[nodiscard]] _CCCL_API constexpr auto extent(const size_t __r) const noexcept
+  {
+    return __extents_.extent(__r);
+  }
+
+  [[nodiscard]] _CCCL_API constexpr _Value operator()(size_t) const noexcept
+  {
+    return _Value{};
+  }
+};
+} // namespace __detail
+
+// [linalg.algs.blas2.gemv]
+
+//! Computes y = A * x.
+_CCCL_TEMPLATE(class _InMat, class _InVec, class _OutVec)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__in_vector<_InVec> _CCCL_AND
+                 __detail::__out_vector<_OutVec>)
+_CCCL_API constexpr void matrix_vector_product(_InMat __a, _InVec __x, _OutVec __y)
+{
+  using __zero_t = __detail::__zero_vector<typename _OutVec::value_type, typename _OutVec::extents_type>;
+  ::cuda::std::linalg::__detail::__matrix_vector_product(__a, __x, __zero_t{__y.extents()}, __y);
+}
+
+//! Computes z = y + A * x. \p __y may be the same as \p __z.
+_CCCL_TEMPLATE(class _InMat, class _InVec1, class _InVec2, class _OutVec)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__in_vector<_InVec1> _CCCL_AND
+                 __detail::__in_vector<_InVec2> _CCCL_AND __detail::__out_vector<_OutVec>)
+_CCCL_API constexpr void matrix_vector_product(_InMat __a, _InVec1 __x, _InVec2 __y, _OutVec __z)
+{
+  ::cuda::std::linalg::__detail::__matrix_vector_product(__a, __x, __y, __z);
+}
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_MATRIX_VECTOR_PRODUCT_H
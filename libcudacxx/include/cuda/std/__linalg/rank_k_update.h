@@ -0,0 +1,141 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_RANK_K_UPDATE_H
+#define _CUDA_STD___LINALG_RANK_K_UPDATE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__linalg/concepts.h>
+#include <cuda/std/__linalg/conjugate_transposed.h>
+#include <cuda/std/__linalg/matrix_product_kernel.h>
+#include <cuda/std/__linalg/scaled.h>
+#include <cuda/std/__linalg/tags.h>
+#include <cuda/std/__linalg/transposed.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+namespace __detail
+{
+//! Computes C += A * B for the \p _Triangle of C, where B is the (conjugate) transpose of A, possibly without scaling.
+//! Tiles of C that lie entirely inside the triangle go through the register blocked matrix product kernel, tiles on the
+//! diagonal are computed element by element.
+template <class _Triangle, class _InMat1, class _InMat2, class _InOutMat>
+_CCCL_API constexpr void __rank_k_update(const _InMat1& __a, const _InMat2& __b, const _InOutMat& __c)
+{
+  _CCCL_ASSERT(static_cast<size_t>(__c.extent(0)) == static_cast<size_t>(__c.extent(1)),
+               "matrix_rank_k_update: C must be square");
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(0)) == static_cast<size_t>(__c.extent(0)),
+               "matrix_rank_k_update: A and C must have the same number of rows");
+
+  using __value_t        = typename _InOutMat::value_type;
+  constexpr bool __lower = is_same_v<_Triangle, lower_triangle_t>;
+  const size_t __n       = static_cast<size_t>(__c.extent(0));
+  const size_t __k       = static_cast<size_t>(__a.extent(1));
+  const auto __a_view    = ::cuda::std::linalg::__detail::__make_offset_matrix(__a);
+  const auto __b_view    = ::cuda::std::linalg::__detail::__make_offset_matrix(__b);
+
+  for (size_t __jb = 0; __jb < __n; __jb += __gemm_mc)
+  {
+    const size_t __j_end = (::cuda::std::min) (__jb + __gemm_mc, __n);
+
+    // the tile on the diagonal
+    for (size_t __j = __jb; __j < __j_end; ++__j)
+    {
+      const size_t __i_first = __lower ? __j : __jb;
+      const size_t __i_last  = __lower ? __j_end : __j + 1;
+      for (size_t __i = __i_first; __i < __i_last; ++__i)
+      {
+        __value_t __acc{};
+        for (size_t __p = 0; __p < __k; ++__p)
+        {
+          __acc += static_cast<__value_t>(__a_view(__i, __p)) * static_cast<__value_t>(__b_view(__p, __j));
+        }
+        __c(__i, __j) = static_cast<__value_t>(__c(__i, __j)) + __acc;
+      }
+    }
+
+    // the rectangle below the tile for a lower triangle, above it for an upper one
+    const size_t __i_first = __lower ? __j_end : 0;
+    const size_t __rows    = __lower ? __n - __j_end : __jb;
+    ::cuda::std::linalg::__detail::__matrix_product_accumulate<false, __value_t>(
+      ::cuda::std::linalg::__detail::__make_offset_matrix(__a, __i_first, 0),
+      ::cuda::std::linalg::__detail::__make_offset_matrix(__b, 0, __jb),
+      ::cuda::std::linalg::__detail::__make_offset_matrix(__c, __i_first, __jb),
+      __rows,
+      __j_end - __jb,
+      __k);
+  }
+}
+} // namespace __detail
+
+// [linalg.algs.blas3.rankk]
+
+//! Computes C += alpha * A * A^T, where only the \p _Triangle of C is accessed.
+_CCCL_TEMPLATE(class _ScalingFactor, class _InMat, class _InOutMat, class _Triangle)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__inout_matrix<_InOutMat> _CCCL_AND
+                 __detail::__is_triangle_v<_Triangle>)
+_CCCL_API constexpr void symmetric_matrix_rank_k_update(_ScalingFactor __alpha, _InMat __a, _InOutMat __c, _Triangle)
+{
+  ::cuda::std::linalg::__detail::__rank_k_update<_Triangle>(
+    ::cuda::std::linalg::scaled(__alpha, __a), ::cuda::std::linalg::transposed(__a), __c);
+}
+
+//! Computes C += A * A^T, where only the \p _Triangle of C is accessed.
+_CCCL_TEMPLATE(class _InMat, class _InOutMat, class _Triangle)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__inout_matrix<_InOutMat> _CCCL_AND
+                 __detail::__is_triangle_v<_Triangle>)
+_CCCL_API constexpr void symmetric_matrix_rank_k_update(_InMat __a, _InOutMat __c, _Triangle)
+{
+  ::cuda::std::linalg::__detail::__rank_k_update<_Triangle>(__a, ::cuda::std::linalg::transposed(__a), __c);
+}
+
+//! Computes C += alpha * A * A^H, where only the \p _Triangle of C is accessed.
+_CCCL_TEMPLATE(class _ScalingFactor, class _InMat, class _InOutMat, class _Triangle)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__inout_matrix<_InOutMat> _CCCL_AND
+                 __detail::__is_triangle_v<_Triangle>)
+_CCCL_API constexpr void hermitian_matrix_rank_k_update(_ScalingFactor __alpha, _InMat __a, _InOutMat __c, _Triangle)
+{
+  ::cuda::std::linalg::__detail::__rank_k_update<_Triangle>(
+    ::cuda::std::linalg::scaled(__alpha, __a), ::cuda::std::linalg::conjugate_transposed(__a), __c);
+}
+
+//! Computes C += A * A^H, where only the \p _Triangle of C is accessed.
+_CCCL_TEMPLATE(class _InMat, class _InOutMat, class _Triangle)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__inout_matrix<_InOutMat> _CCCL_AND
+                 __detail::__is_triangle_v<_Triangle>)
+_CCCL_API constexpr void hermitian_matrix_rank_k_update(_InMat __a, _InOutMat __c, _Triangle)
+{
+  ::cuda::std::linalg::__detail::__rank_k_update<_Triangle>(__a, ::cuda::std::linalg::conjugate_transposed(__a), __c);
+}
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_RANK_K_UPDATE_H
@@ -0,0 +1,283 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_TRIANGULAR_MATRIX_SOLVE_H
+#define _CUDA_STD___LINALG_TRIANGULAR_MATRIX_SOLVE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__linalg/concepts.h>
+#include <cuda/std/__linalg/matrix_product_kernel.h>
+#include <cuda/std/__linalg/tags.h>
+#include <cuda/std/__linalg/transposed.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+namespace __detail
+{
+// Rows of the diagonal blocks of a blocked triangular solve. The off-diagonal updates run in the matrix product kernel.
+inline constexpr size_t __trsm_block = 64;
+
+//! Solves A x = x in place, by forward substitution if \p _Triangle is \c lower_triangle_t and back substitution
+//! otherwise.
+template <class _Triangle, class _DiagonalStorage, class _InMat, class _InOutVec>
+_CCCL_API constexpr void __triangular_vector_solve(const _InMat& __a, const _InOutVec& __x)
+{
+  using __value_t                = typename _InOutVec::value_type;
+  constexpr bool __lower         = is_same_v<_Triangle, lower_triangle_t>;
+  constexpr bool __explicit_diag = is_same_v<_DiagonalStorage, explicit_diagonal_t>;
+  const size_t __n               = static_cast<size_t>(__a.extent(0));
+
+  if (::cuda::std::linalg::__detail::__has_unit_row_stride(__a))
+  {
+    // Column oriented: once x(j) is known, eliminate it from the remaining rows, which walks down a column of A.
+    for (size_t __step = 0; __step < __n; ++__step)
+    {
+      const size_t __j = __lower ? __step : __n - 1 - __step;
+      __value_t __xj   = static_cast<__value_t>(__x(__j));
+      if constexpr (__explicit_diag)
+      {
+        __xj     = __xj / static_cast<__value_t>(__a(__j, __j));
+        __x(__j) = __xj;
+      }
+      const size_t __first = __lower ? __j + 1 : 0;
+      const size_t __last  = __lower ? __n : __j;
+      for (size_t __i = __first; __i < __last; ++__i)
+      {
+        __x(__i) = static_cast<__value_t>(__x(__i)) - static_cast<__value_t>(__a(__i, __j)) * __xj;
+      }
+    }
+  }
+  else
+  {
+    // Row oriented: x(i) is the residual of a dot product over a row of A.
+    for (size_t __step = 0; __step < __n; ++__step)
+    {
+      const size_t __i     = __lower ? __step : __n - 1 - __step;
+      const size_t __first = __lower ? 0 : __i + 1;
+      const size_t __last  = __lower ? __i : __n;
+      __value_t __sum      = static_cast<__value_t>(__x(__i));
+      for (size_t __j = __first; __j < __last; ++__j)
+      {
+        __sum -= static_cast<__value_t>(__a(__i, __j)) * static_cast<__value_t>(__x(__j));
+      }
+      if constexpr (__explicit_diag)
+      {
+        __sum = __sum / static_cast<__value_t>(__a(__i, __i));
+      }
+      __x(__i) = __sum;
+    }
+  }
+}
+
+//! Solves A X = X in place for the rows \p __first to \p __last of X, ignoring A outside of that diagonal block.
+template <class _Triangle, class _DiagonalStorage, class _InMat, class _InOutMat>
+_CCCL_API constexpr void
+__triangular_block_solve(const _InMat& __a, const _InOutMat& __x, const size_t __first, const size_t __last)
+{
+  using __value_t                = typename _InOutMat::value_type;
+  constexpr bool __lower         = is_same_v<_Triangle, lower_triangle_t>;
+  constexpr bool __explicit_diag = is_same_v<_DiagonalStorage, explicit_diagonal_t>;
+  const size_t __n               = static_cast<size_t>(__x.extent(1));
+
+  for (size_t __step = __first; __step < __last; ++__step)
+  {
+    const size_t __k = __lower ? __step : __last - 1 - (__step - __first);
+    if constexpr (__explicit_diag)
+    {
+      const __value_t __diag = static_cast<__value_t>(__a(__k, __k));
+      for (size_t __j = 0; __j < __n; ++__j)
+      {
+        __x(__k, __j) = static_cast<__value_t>(__x(__k, __j)) / __diag;
+      }
+    }
+    const size_t __row_first = __lower ? __k + 1 : __first;
+    const size_t __row_last  = __lower ? __last : __k;
+    for (size_t __i = __row_first; __i < __row_last; ++__i)
+    {
+      const __value_t __aik = static_cast<__value_t>(__a(__i, __k));
+      for (size_t __j = 0; __j < __n; ++__j)
+      {
+        __x(__i, __j) = static_cast<__value_t>(__x(__i, __j)) - __aik * static_cast<__value_t>(__x(__k, __j));
+      }
+    }
+  }
+}
+
+//! Solves A X = X in place. Diagonal blocks are solved directly, and their contribution to the remaining rows is
+//! subtracted with the register blocked matrix product kernel.
+template <class _Triangle, class _DiagonalStorage, class _InMat, class _InOutMat>
+_CCCL_API constexpr void __triangular_matrix_left_solve(const _InMat& __a, const _InOutMat& __x)
+{
+  using __value_t        = typename _InOutMat::value_type;
+  constexpr bool __lower = is_same_v<_Triangle, lower_triangle_t>;
+  const size_t __m       = static_cast<size_t>(__x.extent(0));
+  const size_t __n       = static_cast<size_t>(__x.extent(1));
+  const size_t __blocks  = (__m + __trsm_block - 1) / __trsm_block;
+
+  for (size_t __b = 0; __b < __blocks; ++__b)
+  {
+    const size_t __block = __lower ? __b : __blocks - 1 - __b;
+    const size_t __first = __block * __trsm_block;
+    const size_t __last  = (::cuda::std::min) (__first + __trsm_block, __m);
+    ::cuda::std::linalg::__detail::__triangular_block_solve<_Triangle, _DiagonalStorage>(__a, __x, __first, __last);
+
+    // The rows that are still unknown: below the block for a lower triangle, above it for an upper one.
+    const size_t __rest_first = __lower ? __last : 0;
+    const size_t __rest_rows  = __lower ? __m - __last : __first;
+    ::cuda::std::linalg::__detail::__matrix_product_accumulate<true, __value_t>(
+      ::cuda::std::linalg::__detail::__make_offset_matrix(__a, __rest_first, __first),
+      ::cuda::std::linalg::__detail::__make_offset_matrix(__x, __first, 0),
+      ::cuda::std::linalg::__detail::__make_offset_matrix(__x, __rest_first, 0),
+      __rest_rows,
+      __n,
+      __last - __first);
+  }
+}
+
+template <class _InMat, class _InVec, class _OutVec>
+_CCCL_API constexpr void
+__triangular_vector_solve_prepare([[maybe_unused]] const _InMat& __a, const _InVec& __b, const _OutVec& __x)
+{
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(0)) == static_cast<size_t>(__a.extent(1)),
+               "triangular_matrix_vector_solve: A must be square");
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(0)) == static_cast<size_t>(__b.extent(0))
+                 && static_cast<size_t>(__b.extent(0)) == static_cast<size_t>(__x.extent(0)),
+               "triangular_matrix_vector_solve: A, b and x must have matching extents");
+  using __value_t  = typename _OutVec::value_type;
+  const size_t __n = static_cast<size_t>(__x.extent(0));
+  for (size_t __i = 0; __i < __n; ++__i)
+  {
+    __x(__i) = static_cast<__value_t>(__b(__i));
+  }
+}
+
+template <class _InMat1, class _InMat2, class _OutMat>
+_CCCL_API constexpr void __triangular_matrix_solve_prepare(
+  [[maybe_unused]] const size_t __order, [[maybe_unused]] const _InMat1& __a, const _InMat2& __b, const _OutMat& __x)
+{
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(0)) == static_cast<size_t>(__a.extent(1)),
+               "triangular_matrix_matrix_solve: A must be square");
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(0)) == __order,
+               "triangular_matrix_matrix_solve: the order of A must match B");
+  _CCCL_ASSERT(static_cast<size_t>(__b.extent(0)) == static_cast<size_t>(__x.extent(0))
+                 && static_cast<size_t>(__b.extent(1)) == static_cast<size_t>(__x.extent(1)),
+               "triangular_matrix_matrix_solve: B and X must have the same extents");
+  using __value_t  = typename _OutMat::value_type;
+  const size_t __m = static_cast<size_t>(__x.extent(0));
+  const size_t __n = static_cast<size_t>(__x.extent(1));
+  for (size_t __i = 0; __i < __m; ++__i)
+  {
+    for (size_t __j = 0; __j < __n; ++__j)
+    {
+      __x(__i, __j) = static_cast<__value_t>(__b(__i, __j));
+    }
+  }
+}
+} // namespace __detail
+
+// [linalg.algs.blas2.trsv]
+
+//! Solves A x = b for x, where only the \p _Triangle of A is accessed.
+_CCCL_TEMPLATE(class _InMat, class _Triangle, class _DiagonalStorage, class _InVec, class _OutVec)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__is_triangle_v<_Triangle> _CCCL_AND
+                 __detail::__is_diagonal_storage_v<_DiagonalStorage> _CCCL_AND __detail::__in_vector<_InVec>
+                   _CCCL_AND __detail::__out_vector<_OutVec>)
+_CCCL_API constexpr void
+triangular_matrix_vector_solve(_InMat __a, _Triangle, _DiagonalStorage, _InVec __b, _OutVec __x)
+{
+  ::cuda::std::linalg::__detail::__triangular_vector_solve_prepare(__a, __b, __x);
+  ::cuda::std::linalg::__detail::__triangular_vector_solve<_Triangle, _DiagonalStorage>(__a, __x);
+}
+
+//! Solves A x = b for x and overwrites \p __b with the result.
+_CCCL_TEMPLATE(class _InMat, class _Triangle, class _DiagonalStorage, class _InOutVec)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__is_triangle_v<_Triangle> _CCCL_AND
+                 __detail::__is_diagonal_storage_v<_DiagonalStorage> _CCCL_AND __detail::__inout_vector<_InOutVec>)
+_CCCL_API constexpr void triangular_matrix_vector_solve(_InMat __a, _Triangle, _DiagonalStorage, _InOutVec __b)
+{
+  ::cuda::std::linalg::__detail::__triangular_vector_solve_prepare(__a, __b, __b);
+  ::cuda::std::linalg::__detail::__triangular_vector_solve<_Triangle, _DiagonalStorage>(__a, __b);
+}
+
+// [linalg.algs.blas3.trsm]
+
+//! Solves A X = B for X, where only the \p _Triangle of A is accessed.
+_CCCL_TEMPLATE(class _InMat1, class _Triangle, class _DiagonalStorage, class _InMat2, class _OutMat)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat1> _CCCL_AND __detail::__is_triangle_v<_Triangle> _CCCL_AND
+                 __detail::__is_diagonal_storage_v<_DiagonalStorage> _CCCL_AND __detail::__in_matrix<_InMat2>
+                   _CCCL_AND __detail::__out_matrix<_OutMat>)
+_CCCL_API constexpr void
+triangular_matrix_matrix_left_solve(_InMat1 __a, _Triangle, _DiagonalStorage, _InMat2 __b, _OutMat __x)
+{
+  ::cuda::std::linalg::__detail::__triangular_matrix_solve_prepare(static_cast<size_t>(__b.extent(0)), __a, __b, __x);
+  ::cuda::std::linalg::__detail::__triangular_matrix_left_solve<_Triangle, _DiagonalStorage>(__a, __x);
+}
+
+//! Solves A X = B for X and overwrites \p __b with the result.
+_CCCL_TEMPLATE(class _InMat, class _Triangle, class _DiagonalStorage, class _InOutMat)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__is_triangle_v<_Triangle> _CCCL_AND
+                 __detail::__is_diagonal_storage_v<_DiagonalStorage> _CCCL_AND __detail::__inout_matrix<_InOutMat>)
+_CCCL_API constexpr void triangular_matrix_matrix_left_solve(_InMat __a, _Triangle, _DiagonalStorage, _InOutMat __b)
+{
+  ::cuda::std::linalg::__detail::__triangular_matrix_solve_prepare(static_cast<size_t>(__b.extent(0)), __a, __b, __b);
+  ::cuda::std::linalg::__detail::__triangular_matrix_left_solve<_Triangle, _DiagonalStorage>(__a, __b);
+}
+
+//! Solves X A = B for X, where only the \p _Triangle of A is accessed.
+_CCCL_TEMPLATE(class _InMat1, class _Triangle, class _DiagonalStorage, class _InMat2, class _OutMat)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat1> _CCCL_AND __detail::__is_triangle_v<_Triangle> _CCCL_AND
+                 __detail::__is_diagonal_storage_v<_DiagonalStorage> _CCCL_AND __detail::__in_matrix<_InMat2>
+                   _CCCL_AND __detail::__out_matrix<_OutMat>)
+_CCCL_API constexpr void
+triangular_matrix_matrix_right_solve(_InMat1 __a, _Triangle, _DiagonalStorage, _InMat2 __b, _OutMat __x)
+{
+  // X A = B is equivalent to A^T X^T = B^T, which is a left solve with the opposite triangle.
+  ::cuda::std::linalg::__detail::__triangular_matrix_solve_prepare(static_cast<size_t>(__b.extent(1)), __a, __b, __x);
+  ::cuda::std::linalg::__detail::
+    __triangular_matrix_left_solve<__detail::__transpose_triangle_t<_Triangle>, _DiagonalStorage>(
+      ::cuda::std::linalg::transposed(__a), ::cuda::std::linalg::transposed(__x));
+}
+
+//! Solves X A = B for X and overwrites \p __b with the result.
+_CCCL_TEMPLATE(class _InMat, class _Triangle, class _DiagonalStorage, class _InOutMat)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__is_triangle_v<_Triangle> _CCCL_AND
+                 __detail::__is_diagonal_storage_v<_DiagonalStorage> _CCCL_AND __detail::__inout_matrix<_InOutMat>)
+_CCCL_API constexpr void triangular_matrix_matrix_right_solve(_InMat __a, _Triangle, _DiagonalStorage, _InOutMat __b)
+{
+  ::cuda::std::linalg::__detail::__triangular_matrix_solve_prepare(static_cast<size_t>(__b.extent(1)), __a, __b, __b);
+  ::cuda::std::linalg::__detail::
+    __triangular_matrix_left_solve<__detail::__transpose_triangle_t<_Triangle>, _DiagonalStorage>(
+      ::cuda::std::linalg::transposed(__a), ::cuda::std::linalg::transposed(__b));
+}
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_TRIANGULAR_MATRIX_SOLVE_H
@@ -0,0 +1,164 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_VECTOR_TWO_NORM_H
+#define _CUDA_STD___LINALG_VECTOR_TWO_NORM_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cmath/abs.h>
+#include <cuda/std/__cmath/isfinite.h>
+#include <cuda/std/__cmath/roots.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__linalg/concepts.h>
+#include <cuda/std/__type_traits/is_floating_point.h>
+#include <cuda/std/__type_traits/is_unsigned.h>
+#include <cuda/std/__utility/declval.h>
+#include <cuda/std/complex>
+#include <cuda/std/cstddef>
+#include <cuda/std/limits>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+namespace __detail
+{
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr auto __abs_if_needed(const _Tp& __t)
+{
+  if constexpr (is_unsigned_v<_Tp>)
+  {
+    return __t;
+  }
+  else
+  {
+    return ::cuda::std::abs(__t);
+  }
+}
+
+//! Adds \p __x to the sum of squares \p __scale^2 * \p __ssq, rescaling so that no intermediate overflows or
+//! underflows.
+template <class _Scalar>
+_CCCL_API constexpr void __scaled_sum_of_squares(_Scalar& __scale, _Scalar& __ssq, const _Scalar __x)
+{
+  if (__x == _Scalar{})
+  {
+    return;
+  }
+  if (__scale < __x)
+  {
+    const _Scalar __ratio = __scale / __x;
+    __ssq                 = _Scalar{1} + __ssq * __ratio * __ratio;
+    __scale               = __x;
+  }
+  else
+  {
+    const _Scalar __ratio = __x / __scale;
+    __ssq += __ratio * __ratio;
+  }
+}
+
+template <class _InVec, class _Scalar>
+[[nodiscard]] _CCCL_API _Scalar __vector_two_norm(const _InVec& __v, const _Scalar __init)
+{
+  const size_t __n = static_cast<size_t>(__v.extent(0));
+  if constexpr (is_floating_point_v<_Scalar>)
+  {
+    // Sum the squares directly and only fall back to the slower scaled algorithm if the result is not trustworthy.
+    // Squares that underflow are negligible as long as the sum stays well inside the normal range.
+    _Scalar __acc[4]{};
+    size_t __i = 0;
+    for (; __i + 4 <= __n; __i += 4)
+    {
+      _CCCL_PRAGMA_UNROLL_FULL()
+      for (size_t __l = 0; __l < 4; ++__l)
+      {
+        const _Scalar __x = static_cast<_Scalar>(::cuda::std::linalg::__detail::__abs_if_needed(__v(__i + __l)));
+        __acc[__l] += __x * __x;
+      }
+    }
+    for (; __i < __n; ++__i)
+    {
+      const _Scalar __x = static_cast<_Scalar>(::cuda::std::linalg::__detail::__abs_if_needed(__v(__i)));
+      __acc[0] += __x * __x;
+    }
+    const _Scalar __sum = __init * __init + ((__acc[0] + __acc[1]) + (__acc[2] + __acc[3]));
+    if (::cuda::std::isfinite(__sum)
+        && __sum >= numeric_limits<_Scalar>::min() / numeric_limits<_Scalar>::epsilon())
+    {
+      return ::cuda::std::sqrt(__sum);
+    }
+
+    _Scalar __scale{};
+    _Scalar __ssq{1};
+    ::cuda::std::linalg::__detail::__scaled_sum_of_squares(
+      __scale, __ssq, static_cast<_Scalar>(::cuda::std::linalg::__detail::__abs_if_needed(__init)));
+    for (__i = 0; __i < __n; ++__i)
+    {
+      ::cuda::std::linalg::__detail::__scaled_sum_of_squares(
+        __scale, __ssq, static_cast<_Scalar>(::cuda::std::linalg::__detail::__abs_if_needed(__v(__i))));
+    }
+    return __scale * ::cuda::std::sqrt(__ssq);
+  }
+  else
+  {
+    _Scalar __sum = __init * __init;
+    for (size_t __i = 0; __i < __n; ++__i)
+    {
+      const auto __x = ::cuda::std::linalg::__detail::__abs_if_needed(__v(__i));
+      __sum += __x * __x;
+    }
+    using ::cuda::std::sqrt;
+    return static_cast<_Scalar>(sqrt(__sum));
+  }
+}
+
+template <class _InVec>
+using __vector_two_norm_result_t =
+  decltype(::cuda::std::linalg::__detail::__abs_if_needed(::cuda::std::declval<typename _InVec::value_type>()));
+} // namespace __detail
+
+// [linalg.algs.blas1.nrm2]
+
+//! Returns the square root of the sum of the square of \p __init and the squares of the absolute values of the
+//! elements of \p __v. The result does not overflow or underflow unless the norm itself does.
+_CCCL_TEMPLATE(class _InVec, class _Scalar)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec>)
+[[nodiscard]] _CCCL_API _Scalar vector_two_norm(_InVec __v, _Scalar __init)
+{
+  return ::cuda::std::linalg::__detail::__vector_two_norm(__v, __init);
+}
+
+//! Returns the Euclidean norm of \p __v.
+_CCCL_TEMPLATE(class _InVec)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec>)
+[[nodiscard]] _CCCL_API auto vector_two_norm(_InVec __v)
+{
+  return ::cuda::std::linalg::__detail::__vector_two_norm(__v, __detail::__vector_two_norm_result_t<_InVec>{});
+}
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_VECTOR_TWO_NORM_H
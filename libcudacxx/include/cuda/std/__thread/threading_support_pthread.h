@@ -25,6 +25,7 @@
 #  include <cuda/std/__chrono/duration.h>
 #  include <cuda/std/__utility/cmp.h>
 #  include <cuda/std/climits>
+#  include <cuda/std/cstdint>
 #  include <cuda/std/ctime>
 
 #  include <errno.h>
@@ -134,6 +135,25 @@ _CCCL_API inline void __cccl_thread_sleep_for(::cuda::std::chrono::nanoseconds _
     ;
 }
 
+#  if defined(__linux__)
+// Futex
+
+#    define _LIBCUDACXX_HAS_FUTEX
+
+//! Blocks the calling thread while the value at \p __addr equals \p __expected, until it is woken by
+//! \c __cccl_futex_wake_all. Wakeups may be spurious, so callers must recheck the value.
+_CCCL_API inline void __cccl_futex_wait(const uint32_t* __addr, uint32_t __expected)
+{
+  ::syscall(SYS_futex, __addr, FUTEX_WAIT_PRIVATE, __expected, nullptr, nullptr, 0);
+}
+
+//! Wakes all threads blocked in \c __cccl_futex_wait on \p __addr.
+_CCCL_API inline void __cccl_futex_wake_all(const uint32_t* __addr)
+{
+  ::syscall(SYS_futex, __addr, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+}
+#  endif // __linux__
+
 _CCCL_END_NAMESPACE_CUDA_STD
 
 #  include <cuda/std/__cccl/epilogue.h>
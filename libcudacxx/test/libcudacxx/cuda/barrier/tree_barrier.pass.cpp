@@ -0,0 +1,142 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: nvrtc
+// UNSUPPORTED: libcpp-has-no-threads
+
+// <cuda/barrier>
+
+#include <cuda/barrier>
+#include <cuda/std/atomic>
+#include <cuda/std/cassert>
+
+#include <thread>
+#include <vector>
+
+#include "test_macros.h"
+
+struct check_phase
+{
+  cuda::std::atomic<int>* arrived;
+  int* phases;
+  int expected;
+
+  void operator()() noexcept
+  {
+    assert(arrived->load() == expected);
+    arrived->store(0);
+    ++*phases;
+  }
+};
+
+template <class F>
+void launch(int count, F f)
+{
+  std::vector<std::thread> threads;
+  for (int i = 0; i < count; ++i)
+  {
+    threads.emplace_back(f, i);
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+}
+
+void test_phases(int thread_count)
+{
+  constexpr int phase_count = 50;
+  cuda::std::atomic<int> arrived{0};
+  int phases = 0;
+  cuda::tree_barrier<check_phase> barrier{thread_count, check_phase{&arrived, &phases, thread_count}};
+
+  launch(thread_count, [&](int) {
+    for (int phase = 0; phase < phase_count; ++phase)
+    {
+      arrived.fetch_add(1);
+      barrier.arrive_and_wait();
+      // The completion function runs before any thread is unblocked, and the next phase cannot complete before this
+      // thread arrives again
+      assert(phases == phase + 1);
+    }
+  });
+  assert(phases == phase_count);
+}
+
+void test_arrive_and_wait_separately()
+{
+  constexpr int thread_count = 20;
+  cuda::tree_barrier<> barrier{thread_count};
+  cuda::std::atomic<int> arrived{0};
+
+  launch(thread_count, [&](int) {
+    for (int phase = 1; phase <= 10; ++phase)
+    {
+      arrived.fetch_add(1);
+      auto token = barrier.arrive();
+      barrier.wait(cuda::std::move(token));
+      assert(arrived.load() >= phase * thread_count);
+      barrier.arrive_and_wait();
+    }
+  });
+}
+
+void test_update()
+{
+  // A single thread arrives on behalf of many, spilling over several leaves
+  constexpr int expected = 100;
+  cuda::tree_barrier<> barrier{expected};
+  for (int phase = 0; phase < 5; ++phase)
+  {
+    auto token = barrier.arrive(expected - 1);
+    barrier.arrive();
+    barrier.wait(cuda::std::move(token));
+  }
+}
+
+void test_arrive_and_drop()
+{
+  constexpr int thread_count = 40;
+  cuda::tree_barrier<> barrier{thread_count};
+  cuda::std::atomic<int> done{0};
+
+  launch(thread_count, [&](int i) {
+    for (int phase = 0; phase < 20; ++phase)
+    {
+      // Threads leave the barrier one after the other
+      if (phase == i % 20)
+      {
+        barrier.arrive_and_drop();
+        done.fetch_add(1);
+        return;
+      }
+      barrier.arrive_and_wait();
+    }
+  });
+  assert(done.load() == thread_count);
+}
+
+void test()
+{
+  static_assert(cuda::tree_barrier<>::max() > 0);
+
+  test_phases(1);
+  test_phases(7);
+  test_phases(64);
+  test_arrive_and_wait_separately();
+  test_update();
+  test_arrive_and_drop();
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (test();))
+  return 0;
+}
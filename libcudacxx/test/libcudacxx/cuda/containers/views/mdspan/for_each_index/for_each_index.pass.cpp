@@ -0,0 +1,177 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/mdspan>
+
+// template<class IndexType, size_t... Extents, class F>
+//   constexpr void for_each_index(const extents<IndexType, Extents...>& ext, F f);
+//
+// template<class T, class Extents, class Layout, class Accessor, class F>
+//   constexpr void for_each_index(const mdspan<T, Extents, Layout, Accessor>& view, F f);
+
+#include <cuda/mdspan>
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+
+#include "test_macros.h"
+
+// Records the visited indices of a rank 3 index space, linearized in row-major order
+struct recorder
+{
+  int* visited;
+  int* count;
+  int extent1;
+  int extent2;
+
+  template <class I0, class I1, class I2>
+  __host__ __device__ constexpr void operator()(I0 i, I1 j, I2 k) const
+  {
+    visited[(*count)++] = (static_cast<int>(i) * extent1 + static_cast<int>(j)) * extent2 + static_cast<int>(k);
+  }
+};
+
+__host__ __device__ constexpr void test_extents()
+{
+  { // row-major order
+    cuda::std::extents<int, 2, cuda::std::dynamic_extent> ext{3};
+    int visited[6] = {};
+    int count      = 0;
+    cuda::for_each_index(ext, [&](int i, int j) {
+      visited[count++] = i * 3 + j;
+    });
+    assert(count == 6);
+    for (int i = 0; i < 6; ++i)
+    {
+      assert(visited[i] == i);
+    }
+  }
+
+  { // rank 0 calls the function once
+    int count = 0;
+    cuda::for_each_index(cuda::std::extents<int>{}, [&]() {
+      ++count;
+    });
+    assert(count == 1);
+  }
+
+  { // empty extents
+    int count = 0;
+    cuda::for_each_index(cuda::std::dextents<unsigned, 3>{4, 0, 2}, [&](unsigned, unsigned, unsigned) {
+      ++count;
+    });
+    assert(count == 0);
+  }
+
+  { // index type is passed through
+    cuda::for_each_index(cuda::std::extents<short, 2>{}, [](auto i) {
+      static_assert(cuda::std::is_same_v<decltype(i), short>);
+      assert(i < 2);
+    });
+  }
+}
+
+__host__ __device__ constexpr void test_layouts()
+{
+  int data[24] = {};
+
+  { // layout_right is traversed in row-major order
+    cuda::std::mdspan<int, cuda::std::extents<int, 2, 3, 4>> view{data};
+    int visited[24] = {};
+    int count       = 0;
+    cuda::for_each_index(view, recorder{visited, &count, 3, 4});
+    assert(count == 24);
+    for (int i = 0; i < 24; ++i)
+    {
+      assert(visited[i] == i);
+    }
+  }
+
+  { // layout_left is traversed in column-major order
+    cuda::std::mdspan<int, cuda::std::dextents<int, 3>, cuda::std::layout_left> view{data, 2, 3, 4};
+    int visited[24] = {};
+    int count       = 0;
+    cuda::for_each_index(view, recorder{visited, &count, 3, 4});
+    assert(count == 24);
+    int n = 0;
+    for (int k = 0; k < 4; ++k)
+    {
+      for (int j = 0; j < 3; ++j)
+      {
+        for (int i = 0; i < 2; ++i)
+        {
+          assert(visited[n++] == (i * 3 + j) * 4 + k);
+        }
+      }
+    }
+  }
+
+  { // layout_stride is traversed by decreasing stride
+    using extents_t = cuda::std::extents<int, 2, 3, 4>;
+    cuda::std::layout_stride::mapping<extents_t> mapping{extents_t{}, cuda::std::array<int, 3>{1, 8, 2}};
+    cuda::std::mdspan<int, extents_t, cuda::std::layout_stride> view{data, mapping};
+    int visited[24] = {};
+    int count       = 0;
+    cuda::for_each_index(view, recorder{visited, &count, 3, 4});
+    assert(count == 24);
+    int n = 0;
+    for (int j = 0; j < 3; ++j)
+    {
+      for (int k = 0; k < 4; ++k)
+      {
+        for (int i = 0; i < 2; ++i)
+        {
+          assert(visited[n++] == (i * 3 + j) * 4 + k);
+        }
+      }
+    }
+  }
+
+  { // rank 0
+    cuda::std::mdspan<int, cuda::std::extents<int>> view{data};
+    int count = 0;
+    cuda::for_each_index(view, [&]() {
+      ++count;
+    });
+    assert(count == 1);
+  }
+}
+
+__host__ __device__ constexpr bool test()
+{
+  test_extents();
+  test_layouts();
+  return true;
+}
+
+__host__ void test_large()
+{
+  // Rows longer than a work item of the parallel overloads
+  constexpr int rows = 3;
+  constexpr int cols = 5000;
+  static int data[rows * cols];
+  cuda::std::mdspan<int, cuda::std::dextents<int, 2>, cuda::std::layout_left> view{data, rows, cols};
+  int expected = 0;
+  cuda::for_each_index(view, [&](int i, int j) {
+    view(i, j) = expected++;
+  });
+  for (int i = 0; i < rows * cols; ++i)
+  {
+    assert(data[i] == i);
+  }
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  NV_IF_TARGET(NV_IS_HOST, (test_large();))
+  return 0;
+}
@@ -0,0 +1,69 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+// XFAIL: true
+
+// template<class ExecutionPolicy, class IndexType, size_t... Extents, class F>
+//   void for_each_index(ExecutionPolicy&& exec, const extents<IndexType, Extents...>& ext, F f);
+//
+// template<class ExecutionPolicy, class T, class Extents, class Layout, class Accessor, class F>
+//   void for_each_index(ExecutionPolicy&& exec, const mdspan<T, Extents, Layout, Accessor>& view, F f);
+
+#include <cuda/mdspan>
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+
+#include "test_execution_policies.h"
+#include "test_macros.h"
+
+constexpr int rows = 3;
+constexpr int cols = 5000;
+int visited[rows * cols];
+
+struct mark_visited
+{
+  __host__ __device__ void operator()(int i, int j) const
+  {
+    ++visited[i * cols + j];
+  }
+};
+
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    cuda::std::fill(visited, visited + rows * cols, 0);
+    cuda::for_each_index(policy, cuda::std::dextents<int, 2>{rows, cols}, mark_visited{});
+    assert(cuda::std::all_of(visited, visited + rows * cols, [](int v) {
+      return v == 1;
+    }));
+
+    cuda::std::fill(visited, visited + rows * cols, 0);
+    cuda::std::mdspan<int, cuda::std::dextents<int, 2>, cuda::std::layout_left> view{nullptr, rows, cols};
+    cuda::for_each_index(policy, view, mark_visited{});
+    assert(cuda::std::all_of(visited, visited + rows * cols, [](int v) {
+      return v == 1;
+    }));
+  }
+};
+
+__host__ void test()
+{
+  test_execution_policies(Test{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
@@ -0,0 +1,86 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+// XFAIL: true
+
+// template<class ExecutionPolicy, class InT, class InExtents, class InLayout, class InAccessor,
+//          class OutT, class OutExtents, class OutLayout, class OutAccessor, class Op>
+//   void transform(ExecutionPolicy&& exec, const mdspan<InT, InExtents, InLayout, InAccessor>& in,
+//                  const mdspan<OutT, OutExtents, OutLayout, OutAccessor>& out, Op op);
+
+#include <cuda/mdspan>
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+
+#include "test_execution_policies.h"
+#include "test_macros.h"
+
+constexpr int rows = 70;
+constexpr int cols = 4500;
+int input[rows * cols];
+int output[rows * cols];
+
+struct times_two
+{
+  __host__ __device__ int operator()(int value) const
+  {
+    return value * 2;
+  }
+};
+
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    using extents_t = cuda::std::dextents<int, 2>;
+    cuda::std::mdspan<int, extents_t> in{input, rows, cols};
+
+    { // equal layouts
+      cuda::std::fill(output, output + rows * cols, 0);
+      cuda::std::mdspan<int, extents_t> out{output, rows, cols};
+      cuda::transform(policy, in, out, times_two{});
+      for (int i = 0; i < rows * cols; ++i)
+      {
+        assert(output[i] == 2 * input[i]);
+      }
+    }
+
+    { // transposition
+      cuda::std::fill(output, output + rows * cols, 0);
+      cuda::std::mdspan<int, extents_t, cuda::std::layout_left> out{output, rows, cols};
+      cuda::transform(policy, in, out, times_two{});
+      for (int i = 0; i < rows; ++i)
+      {
+        for (int j = 0; j < cols; ++j)
+        {
+          assert(out(i, j) == 2 * in(i, j));
+        }
+      }
+    }
+  }
+};
+
+__host__ void test()
+{
+  for (int i = 0; i < rows * cols; ++i)
+  {
+    input[i] = i;
+  }
+  test_execution_policies(Test{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
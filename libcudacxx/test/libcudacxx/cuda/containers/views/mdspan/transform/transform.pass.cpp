@@ -0,0 +1,149 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/mdspan>
+
+// template<class InT, class InExtents, class InLayout, class InAccessor,
+//          class OutT, class OutExtents, class OutLayout, class OutAccessor, class Op>
+//   constexpr void transform(const mdspan<InT, InExtents, InLayout, InAccessor>& in,
+//                            const mdspan<OutT, OutExtents, OutLayout, OutAccessor>& out, Op op);
+
+#include <cuda/mdspan>
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+
+#include "test_macros.h"
+
+struct times_two
+{
+  template <class T>
+  __host__ __device__ constexpr T operator()(T value) const
+  {
+    return value * 2;
+  }
+};
+
+template <class In, class Out>
+__host__ __device__ constexpr void check_transform(const In& in, const Out& out)
+{
+  cuda::transform(in, out, times_two{});
+  cuda::for_each_index(out, [&](auto... idx) {
+    assert(out(idx...) == 2 * in(idx...));
+  });
+}
+
+__host__ __device__ constexpr bool test()
+{
+  int input[24] = {};
+  for (int i = 0; i < 24; ++i)
+  {
+    input[i] = i + 1;
+  }
+
+  { // equal exhaustive layouts
+    int output[24] = {};
+    cuda::std::mdspan<int, cuda::std::extents<int, 2, 3, 4>> in{input};
+    cuda::std::mdspan<int, cuda::std::dextents<int, 3>> out{output, 2, 3, 4};
+    check_transform(in, out);
+  }
+
+  { // layout_left to layout_right
+    int output[24] = {};
+    cuda::std::mdspan<int, cuda::std::dextents<int, 3>, cuda::std::layout_left> in{input, 2, 3, 4};
+    cuda::std::mdspan<int, cuda::std::dextents<int, 3>> out{output, 2, 3, 4};
+    check_transform(in, out);
+  }
+
+  { // padded rows and a different element type
+    using extents_t = cuda::std::dextents<int, 2>;
+    double output[12] = {};
+    cuda::std::layout_stride::mapping<extents_t> mapping{extents_t{3, 4}, cuda::std::array<int, 2>{6, 1}};
+    cuda::std::mdspan<int, extents_t, cuda::std::layout_stride> in{input, mapping};
+    cuda::std::mdspan<double, extents_t, cuda::std::layout_left> out{output, 3, 4};
+    check_transform(in, out);
+  }
+
+  { // broadcasting a row with a zero stride
+    using extents_t = cuda::std::dextents<int, 2>;
+    int output[12]  = {};
+    cuda::std::layout_stride::mapping<extents_t> mapping{extents_t{3, 4}, cuda::std::array<int, 2>{0, 1}};
+    cuda::std::mdspan<int, extents_t, cuda::std::layout_stride> in{input, mapping};
+    cuda::std::mdspan<int, extents_t> out{output, 3, 4};
+    check_transform(in, out);
+  }
+
+  { // extents of one
+    int output[4] = {};
+    cuda::std::mdspan<int, cuda::std::extents<int, 1, 4, 1>, cuda::std::layout_left> in{input};
+    cuda::std::mdspan<int, cuda::std::extents<int, 1, 4, 1>> out{output};
+    check_transform(in, out);
+  }
+
+  { // non-strided layout
+    using extents_t = cuda::std::extents<int, 4>;
+    using mapping_t = cuda::layout_stride_relaxed::mapping<extents_t>;
+    int output[4]   = {};
+    cuda::std::mdspan<int, extents_t, cuda::layout_stride_relaxed> in{
+      input, mapping_t{extents_t{}, typename mapping_t::strides_type{-1}, 3}};
+    cuda::std::mdspan<int, extents_t> out{output};
+    check_transform(in, out);
+    assert(output[0] == 8);
+  }
+
+  { // rank 0
+    int output = 0;
+    cuda::std::mdspan<int, cuda::std::extents<int>> in{input};
+    cuda::std::mdspan<int, cuda::std::extents<int>> out{&output};
+    cuda::transform(in, out, times_two{});
+    assert(output == 2);
+  }
+
+  { // empty
+    int output[1] = {42};
+    cuda::std::mdspan<int, cuda::std::dextents<int, 2>> in{input, 0, 3};
+    cuda::std::mdspan<int, cuda::std::dextents<int, 2>> out{output, 0, 3};
+    cuda::transform(in, out, times_two{});
+    assert(output[0] == 42);
+  }
+
+  return true;
+}
+
+__host__ void test_large()
+{
+  // Transpositions larger than a tile and rows longer than a work item of the parallel overloads
+  constexpr int rows = 70;
+  constexpr int cols = 4500;
+  static float input[rows * cols];
+  static float output[rows * cols];
+  for (int i = 0; i < rows * cols; ++i)
+  {
+    input[i] = static_cast<float>(i);
+  }
+
+  using extents_t = cuda::std::dextents<int, 2>;
+  cuda::std::mdspan<float, extents_t> in{input, rows, cols};
+  check_transform(in, cuda::std::mdspan<float, extents_t, cuda::std::layout_left>{output, rows, cols});
+  check_transform(in, cuda::std::mdspan<float, extents_t>{output, rows, cols});
+
+  // Every other column of a transposed view
+  cuda::std::layout_stride::mapping<extents_t> mapping{extents_t{cols / 2, rows}, cuda::std::array<int, 2>{2, cols}};
+  cuda::std::mdspan<float, extents_t, cuda::std::layout_stride> strided{input, mapping};
+  check_transform(strided, cuda::std::mdspan<float, extents_t>{output, cols / 2, rows});
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  NV_IF_TARGET(NV_IS_HOST, (test_large();))
+  return 0;
+}
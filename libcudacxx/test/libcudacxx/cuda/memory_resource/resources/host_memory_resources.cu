@@ -0,0 +1,219 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/memory_resource>
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
+
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <testing.cuh>
+#include <utility.cuh>
+
+static_assert(cuda::mr::synchronous_resource_with<cuda::mr::mmap_memory_resource, cuda::mr::host_accessible>, "");
+static_assert(!cuda::has_property<cuda::mr::mmap_memory_resource, cuda::mr::device_accessible>, "");
+static_assert(cuda::std::is_trivially_copy_constructible_v<cuda::mr::mmap_memory_resource>, "");
+
+static_assert(
+  cuda::mr::synchronous_resource_with<cuda::mr::synchronized_pool_resource<>, cuda::mr::host_accessible>, "");
+static_assert(!cuda::has_property<cuda::mr::synchronized_pool_resource<>, cuda::mr::device_accessible>, "");
+static_assert(!cuda::std::is_copy_constructible_v<cuda::mr::synchronized_pool_resource<>>, "");
+
+static_assert(cuda::mr::synchronous_resource_with<cuda::mr::monotonic_buffer_resource<>, cuda::mr::host_accessible>,
+              "");
+static_assert(!cuda::std::is_copy_constructible_v<cuda::mr::monotonic_buffer_resource<>>, "");
+
+static bool is_aligned(void* ptr, size_t alignment)
+{
+  return reinterpret_cast<cuda::std::uintptr_t>(ptr) % alignment == 0;
+}
+
+C2H_CCCLRT_TEST("mmap_memory_resource allocation", "[memory_resource]")
+{
+  cuda::mr::mmap_memory_resource res{};
+
+  { // allocate_sync / deallocate_sync
+    auto* ptr = res.allocate_sync(42);
+    static_assert(cuda::std::is_same<decltype(ptr), void*>::value, "");
+    CHECK(ptr != nullptr);
+    std::memset(ptr, 0xab, 42);
+    res.deallocate_sync(ptr, 42);
+  }
+
+  { // alignment larger than a page
+    constexpr size_t alignment = size_t{2} << 20;
+    auto* ptr                  = res.allocate_sync(5 << 20, alignment);
+    CHECK(is_aligned(ptr, alignment));
+    std::memset(ptr, 0xab, 5 << 20);
+    res.deallocate_sync(ptr, 5 << 20, alignment);
+  }
+
+  { // explicit huge pages fall back to regular pages when none are reserved
+    cuda::mr::mmap_memory_resource huge{{cuda::mr::huge_page_mode::explicit_2mb, size_t{1} << 20, -1}};
+    auto* ptr = huge.allocate_sync(3 << 20, 64);
+    CHECK(ptr != nullptr);
+    std::memset(ptr, 0xab, 3 << 20);
+    huge.deallocate_sync(ptr, 3 << 20, 64);
+
+    CHECK(huge != res);
+    CHECK(huge == cuda::mr::mmap_memory_resource{huge.properties()});
+  }
+
+#if _CCCL_HAS_EXCEPTIONS()
+  { // invalid alignment
+    while (true)
+    {
+      try
+      {
+        [[maybe_unused]] auto* ptr = res.allocate_sync(5, 42);
+      }
+      catch (std::invalid_argument&)
+      {
+        break;
+      }
+      CHECK(false);
+    }
+  }
+
+  { // invalid NUMA node
+    while (true)
+    {
+      try
+      {
+        [[maybe_unused]] cuda::mr::mmap_memory_resource invalid{{cuda::mr::huge_page_mode::none, 0, -2}};
+      }
+      catch (std::invalid_argument&)
+      {
+        break;
+      }
+      CHECK(false);
+    }
+  }
+#endif // _CCCL_HAS_EXCEPTIONS()
+}
+
+C2H_CCCLRT_TEST("synchronized_pool_resource allocation", "[memory_resource]")
+{
+  cuda::mr::synchronized_pool_resource<> pool{cuda::mr::pool_options{64, 4096}};
+  CHECK(pool.options().max_blocks_per_chunk == 64);
+  CHECK(pool.options().largest_required_pool_block == 4096);
+
+  { // blocks are unique, aligned to their size class and reused after deallocation
+    std::set<void*> seen;
+    std::vector<void*> ptrs;
+    for (int i = 0; i < 1000; ++i)
+    {
+      auto* ptr = pool.allocate_sync(24, 8);
+      CHECK(is_aligned(ptr, 32));
+      CHECK(seen.insert(ptr).second);
+      std::memset(ptr, 0xab, 24);
+      ptrs.push_back(ptr);
+    }
+    for (auto* ptr : ptrs)
+    {
+      pool.deallocate_sync(ptr, 24, 8);
+    }
+
+    auto* ptr = pool.allocate_sync(24, 8);
+    CHECK(seen.count(ptr) == 1);
+    pool.deallocate_sync(ptr, 24, 8);
+  }
+
+  { // over-aligned allocations
+    auto* ptr = pool.allocate_sync(8, 1024);
+    CHECK(is_aligned(ptr, 1024));
+    pool.deallocate_sync(ptr, 8, 1024);
+  }
+
+  { // oversized allocations are forwarded upstream
+    auto* ptr = pool.allocate_sync(1 << 20);
+    std::memset(ptr, 0xab, 1 << 20);
+    pool.deallocate_sync(ptr, 1 << 20);
+  }
+
+  { // concurrent allocations
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+      threads.emplace_back([&pool, t] {
+        for (int i = 0; i < 10000; ++i)
+        {
+          const size_t bytes = 1 + (i * 37 + t) % 5000;
+          auto* ptr          = pool.allocate_sync(bytes);
+          std::memset(ptr, t, bytes);
+          pool.deallocate_sync(ptr, bytes);
+        }
+      });
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+  }
+
+  pool.release();
+  auto* ptr = pool.allocate_sync(100);
+  pool.deallocate_sync(ptr, 100);
+
+  CHECK(pool == pool);
+}
+
+C2H_CCCLRT_TEST("monotonic_buffer_resource allocation", "[memory_resource]")
+{
+  { // growing buffers
+    cuda::mr::monotonic_buffer_resource<> arena{128};
+    for (int i = 0; i < 1000; ++i)
+    {
+      auto* ptr = arena.allocate_sync(33, 16);
+      CHECK(is_aligned(ptr, 16));
+      std::memset(ptr, 0xab, 33);
+      arena.deallocate_sync(ptr, 33, 16);
+    }
+
+    auto* ptr = arena.allocate_sync(1 << 22, 4096);
+    CHECK(is_aligned(ptr, 4096));
+    std::memset(ptr, 0xab, 1 << 22);
+    arena.release();
+  }
+
+  { // initial buffer is used first and reused after release
+    alignas(64) unsigned char buffer[256];
+    cuda::mr::monotonic_buffer_resource<> arena{buffer, sizeof(buffer)};
+    CHECK(arena.allocate_sync(64, 64) == buffer);
+    CHECK(arena.allocate_sync(64, 64) == buffer + 64);
+
+    auto* ptr = static_cast<unsigned char*>(arena.allocate_sync(300));
+    CHECK((ptr < buffer || ptr >= buffer + sizeof(buffer)));
+
+    arena.release();
+    CHECK(arena.allocate_sync(64, 64) == buffer);
+  }
+}
+
+C2H_CCCLRT_TEST("host resources in type erased wrappers", "[memory_resource]")
+{
+  using pool_t = cuda::mr::synchronized_pool_resource<>;
+  cuda::mr::shared_resource<pool_t> pool{cuda::std::in_place_type<pool_t>, cuda::mr::pool_options{}};
+
+  cuda::mr::any_synchronous_resource<cuda::mr::host_accessible> any_pool{pool};
+  auto* ptr = any_pool.allocate_sync(100, 16);
+  CHECK(is_aligned(ptr, 16));
+  any_pool.deallocate_sync(ptr, 100, 16);
+
+  cuda::mr::synchronous_resource_ref<cuda::mr::host_accessible> ref{pool.get()};
+  CHECK(ref == pool.get());
+
+  cuda::mr::any_synchronous_resource<cuda::mr::host_accessible> any_mmap{cuda::mr::mmap_memory_resource{}};
+  ptr = any_mmap.allocate_sync(1 << 16);
+  any_mmap.deallocate_sync(ptr, 1 << 16);
+}
@@ -0,0 +1,61 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/complex>
+#include <cuda/std/linalg>
+#include <cuda/std/type_traits>
+
+__host__ __device__ void test_real()
+{
+  using E = cuda::std::dextents<size_t, 1>;
+  cuda::std::array<int, 7> d1{1, 2, 3, 4, 5, 6, 7};
+  cuda::std::array<int, 7> d2{7, 6, 5, 4, 3, 2, 1};
+  cuda::std::mdspan<int, E> v1(d1.data(), 7);
+  cuda::std::mdspan<int, E> v2(d2.data(), 7);
+
+  static_assert(cuda::std::is_same_v<decltype(cuda::std::linalg::dot(v1, v2)), int>, "wrong type");
+  static_assert(cuda::std::is_same_v<decltype(cuda::std::linalg::dot(v1, v2, 0.0)), double>, "wrong type");
+  assert(cuda::std::linalg::dot(v1, v2) == 84);
+  assert(cuda::std::linalg::dot(v1, v2, 16) == 100);
+
+  // adaptors are applied on the fly
+  assert(cuda::std::linalg::dot(cuda::std::linalg::scaled(2, v1), v2) == 168);
+
+  // strided and empty vectors
+  cuda::std::layout_stride::mapping<E> stride2{E{3}, cuda::std::array<size_t, 1>{2}};
+  cuda::std::mdspan<int, E, cuda::std::layout_stride> odd(d1.data(), stride2);
+  assert(cuda::std::linalg::dot(odd, odd) == 1 + 9 + 25);
+  assert(cuda::std::linalg::dot(cuda::std::mdspan<int, E>(d1.data(), 0), cuda::std::mdspan<int, E>(d2.data(), 0), 3)
+         == 3);
+}
+
+__host__ __device__ void test_complex()
+{
+  using C = cuda::std::complex<double>;
+  using E = cuda::std::extents<size_t, 2>;
+  cuda::std::array<C, 2> d1{C{1, 2}, C{3, -1}};
+  cuda::std::array<C, 2> d2{C{2, 0}, C{0, 1}};
+  cuda::std::mdspan<C, E> v1(d1.data());
+  cuda::std::mdspan<C, E> v2(d2.data());
+
+  // (1 + 2i) * 2 + (3 - i) * i = 3 + 7i
+  assert(cuda::std::linalg::dot(v1, v2) == C(3, 7));
+  // (1 - 2i) * 2 + (3 + i) * i = 1 - i
+  assert(cuda::std::linalg::dotc(v1, v2) == C(1, -1));
+  assert(cuda::std::linalg::dotc(v1, v2, C{1, 1}) == C(2, 0));
+}
+
+int main(int, char**)
+{
+  test_real();
+  test_complex();
+  return 0;
+}
@@ -0,0 +1,112 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/linalg>
+
+using E = cuda::std::dextents<size_t, 2>;
+
+__host__ __device__ constexpr int value(size_t i, size_t j, int seed)
+{
+  return static_cast<int>((i * 3 + j * 7 + seed) % 11) - 5;
+}
+
+template <class Layout, size_t M, size_t N, size_t K>
+__host__ __device__ void test_product()
+{
+  cuda::std::array<int, M * K> a_data{};
+  cuda::std::array<int, K * N> b_data{};
+  cuda::std::array<int, M * N> c_data{};
+  cuda::std::array<int, M * N> e_data{};
+  cuda::std::mdspan<int, E, Layout> a(a_data.data(), M, K);
+  cuda::std::mdspan<int, E, Layout> b(b_data.data(), K, N);
+  cuda::std::mdspan<int, E, Layout> c(c_data.data(), M, N);
+  cuda::std::mdspan<int, E, Layout> e(e_data.data(), M, N);
+  for (size_t i = 0; i < M; ++i)
+  {
+    for (size_t k = 0; k < K; ++k)
+    {
+      a(i, k) = value(i, k, 1);
+    }
+    for (size_t j = 0; j < N; ++j)
+    {
+      e(i, j) = value(i, j, 3);
+    }
+  }
+  for (size_t k = 0; k < K; ++k)
+  {
+    for (size_t j = 0; j < N; ++j)
+    {
+      b(k, j) = value(k, j, 2);
+    }
+  }
+
+  auto reference = [&](size_t i, size_t j) {
+    int sum = 0;
+    for (size_t k = 0; k < K; ++k)
+    {
+      sum += a(i, k) * b(k, j);
+    }
+    return sum;
+  };
+
+  // C = A * B
+  cuda::std::linalg::matrix_product(a, b, c);
+  for (size_t i = 0; i < M; ++i)
+  {
+    for (size_t j = 0; j < N; ++j)
+    {
+      assert(c(i, j) == reference(i, j));
+    }
+  }
+
+  // C = E + 2 * A * B
+  cuda::std::linalg::matrix_product(cuda::std::linalg::scaled(2, a), b, e, c);
+  for (size_t i = 0; i < M; ++i)
+  {
+    for (size_t j = 0; j < N; ++j)
+    {
+      assert(c(i, j) == e(i, j) + 2 * reference(i, j));
+    }
+  }
+
+  // E = E + A * B in place
+  cuda::std::linalg::matrix_product(a, b, e, e);
+  for (size_t i = 0; i < M; ++i)
+  {
+    for (size_t j = 0; j < N; ++j)
+    {
+      assert(e(i, j) == value(i, j, 3) + reference(i, j));
+    }
+  }
+
+  // C^T = B^T * A^T
+  cuda::std::array<int, M * N> ct_data{};
+  cuda::std::mdspan<int, E, Layout> ct(ct_data.data(), N, M);
+  cuda::std::linalg::matrix_product(cuda::std::linalg::transposed(b), cuda::std::linalg::transposed(a), ct);
+  for (size_t i = 0; i < M; ++i)
+  {
+    for (size_t j = 0; j < N; ++j)
+    {
+      assert(ct(j, i) == reference(i, j));
+    }
+  }
+}
+
+int main(int, char**)
+{
+  test_product<cuda::std::layout_right, 3, 5, 4>();
+  test_product<cuda::std::layout_left, 8, 8, 8>();
+  // crosses the depth and the row tiles of the kernel
+  test_product<cuda::std::layout_right, 5, 6, 260>();
+  test_product<cuda::std::layout_left, 66, 5, 3>();
+  test_product<cuda::std::layout_right, 0, 3, 2>();
+  return 0;
+}
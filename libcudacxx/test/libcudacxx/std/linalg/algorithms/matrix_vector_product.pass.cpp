@@ -0,0 +1,99 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/linalg>
+
+using E1 = cuda::std::dextents<size_t, 1>;
+using E2 = cuda::std::dextents<size_t, 2>;
+
+__host__ __device__ constexpr int value(size_t i, size_t j, int seed)
+{
+  return static_cast<int>((i * 3 + j * 7 + seed) % 11) - 5;
+}
+
+template <class Layout, size_t M, size_t N>
+__host__ __device__ void test_product()
+{
+  cuda::std::array<int, M * N> a_data{};
+  cuda::std::array<int, N> x_data{};
+  cuda::std::array<int, M> y_data{};
+  cuda::std::array<int, M> z_data{};
+  cuda::std::mdspan<int, E2, Layout> a(a_data.data(), M, N);
+  cuda::std::mdspan<int, E1> x(x_data.data(), N);
+  cuda::std::mdspan<int, E1> y(y_data.data(), M);
+  cuda::std::mdspan<int, E1> z(z_data.data(), M);
+  for (size_t i = 0; i < M; ++i)
+  {
+    for (size_t j = 0; j < N; ++j)
+    {
+      a(i, j) = value(i, j, 1);
+    }
+    z(i) = value(i, 0, 3);
+  }
+  for (size_t j = 0; j < N; ++j)
+  {
+    x(j) = value(j, 1, 2);
+  }
+
+  auto reference = [&](size_t i) {
+    int sum = 0;
+    for (size_t j = 0; j < N; ++j)
+    {
+      sum += a(i, j) * x(j);
+    }
+    return sum;
+  };
+
+  // y = A * x
+  cuda::std::linalg::matrix_vector_product(a, x, y);
+  for (size_t i = 0; i < M; ++i)
+  {
+    assert(y(i) == reference(i));
+  }
+
+  // y = z + 3 * A * x
+  cuda::std::linalg::matrix_vector_product(cuda::std::linalg::scaled(3, a), x, z, y);
+  for (size_t i = 0; i < M; ++i)
+  {
+    assert(y(i) == z(i) + 3 * reference(i));
+  }
+
+  // z = z + A * x in place
+  cuda::std::linalg::matrix_vector_product(a, x, z, z);
+  for (size_t i = 0; i < M; ++i)
+  {
+    assert(z(i) == value(i, 0, 3) + reference(i));
+  }
+
+  // x = A^T * y
+  cuda::std::array<int, N> w_data{};
+  cuda::std::mdspan<int, E1> w(w_data.data(), N);
+  cuda::std::linalg::matrix_vector_product(cuda::std::linalg::transposed(a), y, w);
+  for (size_t j = 0; j < N; ++j)
+  {
+    int sum = 0;
+    for (size_t i = 0; i < M; ++i)
+    {
+      sum += a(i, j) * y(i);
+    }
+    assert(w(j) == sum);
+  }
+}
+
+int main(int, char**)
+{
+  test_product<cuda::std::layout_right, 3, 5>();
+  test_product<cuda::std::layout_left, 3, 5>();
+  test_product<cuda::std::layout_right, 9, 11>();
+  test_product<cuda::std::layout_left, 11, 9>();
+  test_product<cuda::std::layout_left, 4, 0>();
+  return 0;
+}
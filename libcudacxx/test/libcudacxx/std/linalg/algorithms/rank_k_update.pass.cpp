@@ -0,0 +1,100 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/complex>
+#include <cuda/std/linalg>
+
+using E = cuda::std::dextents<size_t, 2>;
+
+__host__ __device__ constexpr int value(size_t i, size_t j)
+{
+  return static_cast<int>((i * 3 + j * 7) % 11) - 5;
+}
+
+template <class Layout, class Triangle, size_t N, size_t K>
+__host__ __device__ void test_symmetric()
+{
+  constexpr bool lower = cuda::std::is_same_v<Triangle, cuda::std::linalg::lower_triangle_t>;
+  cuda::std::array<int, N * K> a_data{};
+  cuda::std::array<int, N * N> c_data{};
+  cuda::std::mdspan<int, E, Layout> a(a_data.data(), N, K);
+  cuda::std::mdspan<int, E, Layout> c(c_data.data(), N, N);
+  for (size_t i = 0; i < N; ++i)
+  {
+    for (size_t k = 0; k < K; ++k)
+    {
+      a(i, k) = value(i, k);
+    }
+    for (size_t j = 0; j < N; ++j)
+    {
+      c(i, j) = 1;
+    }
+  }
+
+  // C += A A^T, then C += 2 A A^T
+  cuda::std::linalg::symmetric_matrix_rank_k_update(a, c, Triangle{});
+  cuda::std::linalg::symmetric_matrix_rank_k_update(2, a, c, Triangle{});
+  for (size_t i = 0; i < N; ++i)
+  {
+    for (size_t j = 0; j < N; ++j)
+    {
+      int sum = 0;
+      for (size_t k = 0; k < K; ++k)
+      {
+        sum += a(i, k) * a(j, k);
+      }
+      const bool in_triangle = lower ? j <= i : j >= i;
+      assert(c(i, j) == (in_triangle ? 1 + 3 * sum : 1));
+    }
+  }
+}
+
+template <class Triangle>
+__host__ __device__ void test_hermitian()
+{
+  using C                = cuda::std::complex<double>;
+  constexpr bool lower   = cuda::std::is_same_v<Triangle, cuda::std::linalg::lower_triangle_t>;
+  constexpr size_t N     = 3;
+  constexpr size_t K     = 2;
+  cuda::std::array<C, N * K> a_data{C{1, 1}, C{0, 2}, C{2, -1}, C{1, 0}, C{-1, 3}, C{0, -1}};
+  cuda::std::array<C, N * N> c_data{};
+  cuda::std::mdspan<C, E> a(a_data.data(), N, K);
+  cuda::std::mdspan<C, E> c(c_data.data(), N, N);
+
+  // C += 2 A A^H
+  cuda::std::linalg::hermitian_matrix_rank_k_update(2.0, a, c, Triangle{});
+  for (size_t i = 0; i < N; ++i)
+  {
+    for (size_t j = 0; j < N; ++j)
+    {
+      C sum{};
+      for (size_t k = 0; k < K; ++k)
+      {
+        sum += a(i, k) * cuda::std::conj(a(j, k));
+      }
+      const bool in_triangle = lower ? j <= i : j >= i;
+      assert(c(i, j) == (in_triangle ? 2.0 * sum : C{}));
+    }
+  }
+}
+
+int main(int, char**)
+{
+  test_symmetric<cuda::std::layout_right, cuda::std::linalg::lower_triangle_t, 5, 3>();
+  test_symmetric<cuda::std::layout_left, cuda::std::linalg::upper_triangle_t, 5, 3>();
+  test_hermitian<cuda::std::linalg::lower_triangle_t>();
+  test_hermitian<cuda::std::linalg::upper_triangle_t>();
+  // crosses the tiles of the update
+  NV_IF_TARGET(NV_IS_HOST,
+               (test_symmetric<cuda::std::layout_right, cuda::std::linalg::lower_triangle_t, 70, 9>();
+                test_symmetric<cuda::std::layout_left, cuda::std::linalg::upper_triangle_t, 70, 9>();))
+  return 0;
+}
@@ -0,0 +1,132 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/cmath>
+#include <cuda/std/linalg>
+
+using E1 = cuda::std::dextents<size_t, 1>;
+using E2 = cuda::std::dextents<size_t, 2>;
+
+// A well conditioned triangular matrix with garbage in the other triangle, which must not be accessed.
+template <class Triangle, class Mdspan>
+__host__ __device__ void fill_triangular(Mdspan a)
+{
+  const size_t n = a.extent(0);
+  for (size_t i = 0; i < n; ++i)
+  {
+    for (size_t j = 0; j < n; ++j)
+    {
+      const bool in_triangle = cuda::std::is_same_v<Triangle, cuda::std::linalg::lower_triangle_t> ? j <= i : j >= i;
+      a(i, j) = !in_triangle ? 1e30 : i == j ? double(n + 1 + i % 3) : double(int((i * 7 + j * 3) % 5) - 2) / 4;
+    }
+  }
+}
+
+// Returns the element (i, j) of A * X for the triangle of A, with the diagonal taken as one if it is implicit.
+template <class Triangle, class Diagonal, class MdspanA, class MdspanX>
+__host__ __device__ double product(MdspanA a, MdspanX x, size_t i, size_t j)
+{
+  const bool lower = cuda::std::is_same_v<Triangle, cuda::std::linalg::lower_triangle_t>;
+  const bool unit  = cuda::std::is_same_v<Diagonal, cuda::std::linalg::implicit_unit_diagonal_t>;
+  double sum       = 0;
+  for (size_t k = lower ? 0 : i; k < (lower ? i + 1 : a.extent(0)); ++k)
+  {
+    sum += (k == i && unit ? 1.0 : a(i, k)) * x(k, j);
+  }
+  return sum;
+}
+
+template <class Layout, class Triangle, class Diagonal, size_t M, size_t N>
+__host__ __device__ void test_solve()
+{
+  cuda::std::array<double, M * M> a_data{};
+  cuda::std::array<double, M * N> b_data{};
+  cuda::std::array<double, M * N> x_data{};
+  cuda::std::mdspan<double, E2, Layout> a(a_data.data(), M, M);
+  cuda::std::mdspan<double, E2, Layout> b(b_data.data(), M, N);
+  cuda::std::mdspan<double, E2, Layout> x(x_data.data(), M, N);
+  fill_triangular<Triangle>(a);
+  for (size_t i = 0; i < M; ++i)
+  {
+    for (size_t j = 0; j < N; ++j)
+    {
+      b(i, j) = double(int((i + 2 * j) % 7) - 3);
+    }
+  }
+
+  // A X = B
+  cuda::std::linalg::triangular_matrix_matrix_left_solve(a, Triangle{}, Diagonal{}, b, x);
+  for (size_t i = 0; i < M; ++i)
+  {
+    for (size_t j = 0; j < N; ++j)
+    {
+      assert(cuda::std::fabs(product<Triangle, Diagonal>(a, x, i, j) - b(i, j)) < 1e-9);
+    }
+  }
+
+  // A x = b for every column, in place
+  for (size_t j = 0; j < N; ++j)
+  {
+    cuda::std::array<double, M> v_data{};
+    cuda::std::mdspan<double, E1> v(v_data.data(), M);
+    for (size_t i = 0; i < M; ++i)
+    {
+      v(i) = b(i, j);
+    }
+    cuda::std::linalg::triangular_matrix_vector_solve(a, Triangle{}, Diagonal{}, v);
+    for (size_t i = 0; i < M; ++i)
+    {
+      assert(cuda::std::fabs(v(i) - x(i, j)) < 1e-9);
+    }
+  }
+
+  // X^T A^T = B^T, in place
+  auto bt = cuda::std::linalg::transposed(b);
+  cuda::std::linalg::triangular_matrix_matrix_right_solve(
+    cuda::std::linalg::transposed(a),
+    cuda::std::linalg::__detail::__transpose_triangle_t<Triangle>{},
+    Diagonal{},
+    bt);
+  for (size_t i = 0; i < M; ++i)
+  {
+    for (size_t j = 0; j < N; ++j)
+    {
+      assert(cuda::std::fabs(b(i, j) - x(i, j)) < 1e-9);
+    }
+  }
+}
+
+template <size_t M, size_t N>
+__host__ __device__ void test_all()
+{
+  using cuda::std::layout_left;
+  using cuda::std::layout_right;
+  using cuda::std::linalg::explicit_diagonal_t;
+  using cuda::std::linalg::implicit_unit_diagonal_t;
+  using cuda::std::linalg::lower_triangle_t;
+  using cuda::std::linalg::upper_triangle_t;
+
+  test_solve<layout_right, lower_triangle_t, explicit_diagonal_t, M, N>();
+  test_solve<layout_left, lower_triangle_t, explicit_diagonal_t, M, N>();
+  test_solve<layout_right, upper_triangle_t, explicit_diagonal_t, M, N>();
+  test_solve<layout_left, upper_triangle_t, explicit_diagonal_t, M, N>();
+  test_solve<layout_right, lower_triangle_t, implicit_unit_diagonal_t, M, N>();
+  test_solve<layout_left, upper_triangle_t, implicit_unit_diagonal_t, M, N>();
+}
+
+int main(int, char**)
+{
+  test_all<1, 1>();
+  test_all<5, 3>();
+  // crosses the diagonal blocks of the blocked solve
+  NV_IF_TARGET(NV_IS_HOST, (test_all<70, 3>();))
+  return 0;
+}
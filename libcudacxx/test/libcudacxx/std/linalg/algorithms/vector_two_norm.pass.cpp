@@ -0,0 +1,71 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/cmath>
+#include <cuda/std/complex>
+#include <cuda/std/limits>
+#include <cuda/std/linalg>
+#include <cuda/std/type_traits>
+
+template <class T>
+__host__ __device__ void test_real()
+{
+  using E = cuda::std::extents<size_t, 5>;
+  cuda::std::array<T, 5> d{3, 0, -4, 0, 12};
+  cuda::std::mdspan<T, E> v(d.data());
+
+  static_assert(cuda::std::is_same_v<decltype(cuda::std::linalg::vector_two_norm(v)), T>, "wrong type");
+  assert(cuda::std::linalg::vector_two_norm(v) == T(13));
+  assert(cuda::std::linalg::vector_two_norm(v, T(84)) == T(85));
+  assert(cuda::std::linalg::vector_two_norm(cuda::std::linalg::scaled(T(2), v)) == T(26));
+
+  // neither overflows nor underflows
+  constexpr T huge = cuda::std::numeric_limits<T>::max() / 4;
+  cuda::std::array<T, 5> big{huge, huge, huge, huge, 0};
+  cuda::std::mdspan<T, E> vbig(big.data());
+  assert(cuda::std::fabs(cuda::std::linalg::vector_two_norm(vbig) / huge - T(2)) < T(1e-5));
+
+  constexpr T tiny = cuda::std::numeric_limits<T>::denorm_min() * 1024;
+  cuda::std::array<T, 5> small{tiny, tiny, tiny, tiny, 0};
+  cuda::std::mdspan<T, E> vsmall(small.data());
+  assert(cuda::std::fabs(cuda::std::linalg::vector_two_norm(vsmall) / tiny - T(2)) < T(1e-2));
+
+  cuda::std::array<T, 5> zero{};
+  assert(cuda::std::linalg::vector_two_norm(cuda::std::mdspan<T, E>(zero.data())) == T(0));
+}
+
+__host__ __device__ void test_complex()
+{
+  using C = cuda::std::complex<double>;
+  using E = cuda::std::extents<size_t, 2>;
+  cuda::std::array<C, 2> d{C{3, 4}, C{0, 12}};
+  cuda::std::mdspan<C, E> v(d.data());
+
+  static_assert(cuda::std::is_same_v<decltype(cuda::std::linalg::vector_two_norm(v)), double>, "wrong type");
+  assert(cuda::std::fabs(cuda::std::linalg::vector_two_norm(v) - 13.0) < 1e-12);
+}
+
+__host__ __device__ void test_integral()
+{
+  using E = cuda::std::extents<size_t, 2>;
+  cuda::std::array<int, 2> d{-3, 4};
+  cuda::std::mdspan<int, E> v(d.data());
+  assert(cuda::std::linalg::vector_two_norm(v) == 5);
+}
+
+int main(int, char**)
+{
+  test_real<float>();
+  test_real<double>();
+  test_complex();
+  test_integral();
+  return 0;
+}
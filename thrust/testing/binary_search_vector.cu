@@ -406,3 +406,87 @@ struct TestVectorBinarySearchDiscardIterator
 };
 VariableUnitTest<TestVectorBinarySearchDiscardIterator, SignedIntegralTypes>
   TestVectorBinarySearchDiscardIteratorInstance;
+
+template <typename T>
+struct TestVectorSearchSortedValues
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_vec = unittest::random_integers<T>(n);
+    thrust::sort(h_vec.begin(), h_vec.end());
+    thrust::device_vector<T> d_vec = h_vec;
+
+    // a sorted run followed by unsorted values, so that both kinds of searches are exercised
+    thrust::host_vector<T> h_input = unittest::random_integers<T>(2 * n);
+    thrust::sort(h_input.begin(), h_input.begin() + n);
+    thrust::device_vector<T> d_input = h_input;
+
+    using int_type = typename thrust::host_vector<T>::difference_type;
+    thrust::host_vector<int_type> h_output(2 * n);
+    thrust::device_vector<int_type> d_output(2 * n);
+
+    thrust::lower_bound(h_vec.begin(), h_vec.end(), h_input.begin(), h_input.end(), h_output.begin());
+    thrust::lower_bound(d_vec.begin(), d_vec.end(), d_input.begin(), d_input.end(), d_output.begin());
+    ASSERT_EQUAL(h_output, d_output);
+
+    thrust::upper_bound(h_vec.begin(), h_vec.end(), h_input.begin(), h_input.end(), h_output.begin());
+    thrust::upper_bound(d_vec.begin(), d_vec.end(), d_input.begin(), d_input.end(), d_output.begin());
+    ASSERT_EQUAL(h_output, d_output);
+
+    thrust::binary_search(h_vec.begin(), h_vec.end(), h_input.begin(), h_input.end(), h_output.begin());
+    thrust::binary_search(d_vec.begin(), d_vec.end(), d_input.begin(), d_input.end(), d_output.begin());
+    ASSERT_EQUAL(h_output, d_output);
+  }
+};
+VariableUnitTest<TestVectorSearchSortedValues, SignedIntegralTypes> TestVectorSearchSortedValuesInstance;
+
+namespace
+{
+struct keyed_record
+{
+  int key;
+  int payload;
+};
+
+// Compares records with keys only, so that the comparator cannot be called with two keys or two records
+struct record_key_less
+{
+  _CCCL_HOST_DEVICE bool operator()(const keyed_record& record, int key) const
+  {
+    return record.key < key;
+  }
+
+  _CCCL_HOST_DEVICE bool operator()(int key, const keyed_record& record) const
+  {
+    return key < record.key;
+  }
+};
+} // namespace
+
+void TestVectorSearchHeterogeneousComparator()
+{
+  thrust::host_vector<keyed_record> h_vec(5);
+  const int keys[5] = {1, 3, 3, 5, 7};
+  for (size_t i = 0; i < h_vec.size(); ++i)
+  {
+    h_vec[i] = keyed_record{keys[i], static_cast<int>(i)};
+  }
+  thrust::device_vector<keyed_record> vec = h_vec;
+
+  // two sorted runs, so that the search restarts in the middle
+  thrust::device_vector<int> input{0, 3, 4, 8, 2, 3, 6};
+  thrust::device_vector<int> output(input.size());
+
+  thrust::lower_bound(vec.begin(), vec.end(), input.begin(), input.end(), output.begin(), record_key_less{});
+  thrust::device_vector<int> lower_ref{0, 1, 3, 5, 1, 1, 4};
+  ASSERT_EQUAL(output, lower_ref);
+
+  thrust::upper_bound(vec.begin(), vec.end(), input.begin(), input.end(), output.begin(), record_key_less{});
+  thrust::device_vector<int> upper_ref{0, 3, 3, 5, 1, 3, 4};
+  ASSERT_EQUAL(output, upper_ref);
+
+  thrust::binary_search(vec.begin(), vec.end(), input.begin(), input.end(), output.begin(), record_key_less{});
+  thrust::device_vector<int> found_ref{0, 1, 0, 0, 0, 1, 0};
+  ASSERT_EQUAL(output, found_ref);
+}
+DECLARE_UNITTEST(TestVectorSearchHeterogeneousComparator);
@@ -0,0 +1,96 @@
+#include <thrust/binary_search.h>
+#include <thrust/eytzinger_index.h>
+#include <thrust/execution_policy.h>
+#include <thrust/sort.h>
+
+#include <cuda/std/functional>
+
+#include <unittest/unittest.h>
+
+template <typename T>
+struct TestEytzingerIndex
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> vec = unittest::random_integers<T>(n);
+    thrust::sort(vec.begin(), vec.end());
+
+    thrust::host_vector<T> input = unittest::random_integers<T>(2 * n);
+
+    thrust::eytzinger_index<T> index(vec.begin(), vec.end());
+    ASSERT_EQUAL(index.size(), n);
+
+    thrust::host_vector<size_t> expected(2 * n);
+    thrust::host_vector<size_t> output(2 * n);
+
+    thrust::lower_bound(vec.begin(), vec.end(), input.begin(), input.end(), expected.begin());
+    thrust::lower_bound(thrust::host, index, input.begin(), input.end(), output.begin());
+    ASSERT_EQUAL(expected, output);
+
+    thrust::upper_bound(vec.begin(), vec.end(), input.begin(), input.end(), expected.begin());
+    thrust::upper_bound(thrust::host, index, input.begin(), input.end(), output.begin());
+    ASSERT_EQUAL(expected, output);
+
+    thrust::binary_search(vec.begin(), vec.end(), input.begin(), input.end(), expected.begin());
+    thrust::binary_search(thrust::host, index, input.begin(), input.end(), output.begin());
+    ASSERT_EQUAL(expected, output);
+  }
+};
+VariableUnitTest<TestEytzingerIndex, SignedIntegralTypes> TestEytzingerIndexInstance;
+
+void TestEytzingerIndexSimple()
+{
+  thrust::host_vector<int> vec{0, 2, 5, 7, 8};
+  thrust::eytzinger_index<int> index(vec.begin(), vec.end());
+
+  ASSERT_EQUAL(index.lower_bound(0), 0u);
+  ASSERT_EQUAL(index.lower_bound(1), 1u);
+  ASSERT_EQUAL(index.lower_bound(7), 3u);
+  ASSERT_EQUAL(index.lower_bound(9), 5u);
+  ASSERT_EQUAL(index.upper_bound(0), 1u);
+  ASSERT_EQUAL(index.upper_bound(8), 5u);
+  ASSERT_EQUAL(index.binary_search(5), true);
+  ASSERT_EQUAL(index.binary_search(6), false);
+
+  thrust::host_vector<int> input{-1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  thrust::host_vector<int> output(input.size());
+
+  // dispatch on the system of the values
+  thrust::host_vector<int>::iterator output_end =
+    thrust::lower_bound(index, input.begin(), input.end(), output.begin());
+  ASSERT_EQUAL(output_end - output.begin(), 11);
+
+  thrust::host_vector<int> ref{0, 0, 1, 1, 2, 2, 2, 3, 3, 4, 5};
+  ASSERT_EQUAL(output, ref);
+}
+DECLARE_UNITTEST(TestEytzingerIndexSimple);
+
+void TestEytzingerIndexEmpty()
+{
+  thrust::host_vector<int> vec;
+  thrust::eytzinger_index<int> index(vec.begin(), vec.end());
+
+  ASSERT_EQUAL(index.empty(), true);
+  ASSERT_EQUAL(index.lower_bound(1), 0u);
+  ASSERT_EQUAL(index.upper_bound(1), 0u);
+  ASSERT_EQUAL(index.binary_search(1), false);
+}
+DECLARE_UNITTEST(TestEytzingerIndexEmpty);
+
+void TestEytzingerIndexDescending()
+{
+  thrust::host_vector<int> vec{8, 7, 7, 5, 2, 0};
+  thrust::eytzinger_index<int, cuda::std::greater<int>> index(vec.begin(), vec.end(), cuda::std::greater<int>{});
+
+  thrust::host_vector<int> input{9, 8, 7, 6, 1, -1};
+  thrust::host_vector<int> output(input.size());
+
+  thrust::lower_bound(thrust::host, index, input.begin(), input.end(), output.begin());
+  thrust::host_vector<int> lower_ref{0, 0, 1, 3, 5, 6};
+  ASSERT_EQUAL(output, lower_ref);
+
+  thrust::upper_bound(thrust::host, index, input.begin(), input.end(), output.begin());
+  thrust::host_vector<int> upper_ref{0, 1, 3, 3, 5, 6};
+  ASSERT_EQUAL(output, upper_ref);
+}
+DECLARE_UNITTEST(TestEytzingerIndexDescending);
@@ -0,0 +1,284 @@
+#include <thrust/histogram.h>
+#include <thrust/iterator/retag.h>
+#include <thrust/sequence.h>
+
+#include <cuda/std/array>
+#include <cuda/std/limits>
+
+#include <algorithm>
+
+#include <unittest/unittest.h>
+
+template <typename InputIterator, typename OutputIterator, typename LevelT>
+OutputIterator
+histogram_even(my_system& system, InputIterator, InputIterator, OutputIterator result, int, LevelT, LevelT)
+{
+  system.validate_dispatch();
+  return result;
+}
+
+void TestHistogramEvenDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::histogram_even(sys, vec.begin(), vec.end(), vec.begin(), 2, 0, 1);
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestHistogramEvenDispatchExplicit);
+
+template <typename InputIterator, typename OutputIterator, typename LevelT>
+OutputIterator histogram_even(my_tag, InputIterator, InputIterator, OutputIterator result, int, LevelT, LevelT)
+{
+  *result = 13;
+  return result;
+}
+
+void TestHistogramEvenDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::histogram_even(
+    thrust::retag<my_tag>(vec.begin()), thrust::retag<my_tag>(vec.end()), thrust::retag<my_tag>(vec.begin()), 2, 0, 1);
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestHistogramEvenDispatchImplicit);
+
+template <typename InputIterator, typename OutputIterator, typename LevelIterator>
+OutputIterator
+histogram_range(my_system& system, InputIterator, InputIterator, OutputIterator result, LevelIterator, LevelIterator)
+{
+  system.validate_dispatch();
+  return result;
+}
+
+void TestHistogramRangeDispatchExplicit()
+{
+  thrust::device_vector<int> vec(2);
+
+  my_system sys(0);
+  thrust::histogram_range(sys, vec.begin(), vec.end(), vec.begin(), vec.begin(), vec.end());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestHistogramRangeDispatchExplicit);
+
+template <class Vector>
+void TestHistogramSimple()
+{
+  using T = typename Vector::value_type;
+
+  Vector samples{2, 6, 7, 2, 3, 0, 2, 2, 6, 99};
+  thrust::device_vector<int> counts(5, -1);
+
+  auto end = thrust::histogram_even(samples.begin(), samples.end(), counts.begin(), 6, T(0), T(10));
+  ASSERT_EQUAL(true, end == counts.end());
+
+  thrust::device_vector<int> ref{1, 5, 0, 3, 0};
+  ASSERT_EQUAL(ref, counts);
+
+  Vector levels{0, 1, 3, 7, 8, 100};
+  end = thrust::histogram_range(samples.begin(), samples.end(), counts.begin(), levels.begin(), levels.end());
+  ASSERT_EQUAL(true, end == counts.end());
+
+  ref = {1, 4, 3, 1, 1};
+  ASSERT_EQUAL(ref, counts);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestHistogramSimple);
+
+void TestHistogramNoBins()
+{
+  thrust::device_vector<int> samples{1, 2, 3};
+  thrust::device_vector<int> counts(1, 7);
+
+  auto end = thrust::histogram_even(samples.begin(), samples.end(), counts.begin(), 1, 0, 10);
+  ASSERT_EQUAL(true, end == counts.begin());
+
+  end = thrust::histogram_range(samples.begin(), samples.end(), counts.begin(), samples.begin(), samples.begin());
+  ASSERT_EQUAL(true, end == counts.begin());
+  ASSERT_EQUAL(7, counts.front());
+
+  // Every count is overwritten, even without samples
+  thrust::histogram_even(samples.begin(), samples.begin(), counts.begin(), 2, 0, 10);
+  ASSERT_EQUAL(0, counts.front());
+}
+DECLARE_UNITTEST(TestHistogramNoBins);
+
+template <typename T>
+struct TestHistogramEven
+{
+  void operator()(const size_t n)
+  {
+    // Samples in [0, 128) counted in ten bins of width 10 starting at 10
+    thrust::host_vector<T> h_samples = unittest::random_integers<T>(n);
+    for (T& sample : h_samples)
+    {
+      sample = static_cast<T>(static_cast<unsigned long long>(sample) % 128);
+    }
+    const thrust::device_vector<T> d_samples = h_samples;
+
+    thrust::host_vector<long long> h_counts(10, 0);
+    for (T sample : h_samples)
+    {
+      if (sample >= T(10) && sample < T(110))
+      {
+        ++h_counts[(static_cast<int>(sample) - 10) / 10];
+      }
+    }
+
+    thrust::device_vector<long long> d_counts(10);
+    thrust::histogram_even(d_samples.begin(), d_samples.end(), d_counts.begin(), 11, T(10), T(110));
+
+    ASSERT_EQUAL(h_counts, d_counts);
+  }
+};
+VariableUnitTest<TestHistogramEven, IntegralTypes> TestHistogramEvenInstance;
+
+template <typename T>
+struct TestHistogramRange
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_samples = unittest::random_integers<T>(n);
+    for (T& sample : h_samples)
+    {
+      sample = static_cast<T>(static_cast<unsigned long long>(sample) % 128);
+    }
+    const thrust::device_vector<T> d_samples = h_samples;
+
+    const thrust::host_vector<T> h_levels{3, 4, 10, 17, 50, 51, 100, 120};
+    const thrust::device_vector<T> d_levels = h_levels;
+    const int num_bins                      = static_cast<int>(h_levels.size()) - 1;
+
+    thrust::host_vector<int> h_counts(num_bins, 0);
+    for (T sample : h_samples)
+    {
+      const auto bin = std::upper_bound(h_levels.begin(), h_levels.end(), sample) - h_levels.begin() - 1;
+      if (bin >= 0 && bin < num_bins)
+      {
+        ++h_counts[bin];
+      }
+    }
+
+    thrust::device_vector<int> d_counts(num_bins);
+    thrust::histogram_range(d_samples.begin(), d_samples.end(), d_counts.begin(), d_levels.begin(), d_levels.end());
+
+    ASSERT_EQUAL(h_counts, d_counts);
+  }
+};
+VariableUnitTest<TestHistogramRange, IntegralTypes> TestHistogramRangeInstance;
+
+template <typename T>
+struct TestHistogramFloatingPoint
+{
+  void operator()(const size_t n)
+  {
+    // Samples in [-1, 11) and NaNs, counted in five bins of width 2 starting at 0
+    const thrust::host_vector<unsigned int> random = unittest::random_integers<unsigned int>(n);
+    thrust::host_vector<T> h_samples(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+      h_samples[i] =
+        i % 17 == 0 ? ::cuda::std::numeric_limits<T>::quiet_NaN() : static_cast<T>(random[i] % 1200) / T(100) - T(1);
+    }
+    const thrust::device_vector<T> d_samples = h_samples;
+
+    thrust::host_vector<int> h_counts(5, 0);
+    for (T sample : h_samples)
+    {
+      if (sample >= T(0) && sample < T(10))
+      {
+        ++h_counts[static_cast<int>(sample / T(2))];
+      }
+    }
+
+    thrust::device_vector<int> d_counts(5);
+    thrust::histogram_even(d_samples.begin(), d_samples.end(), d_counts.begin(), 6, T(0), T(10));
+    ASSERT_EQUAL(h_counts, d_counts);
+
+    const thrust::device_vector<T> d_levels{0, 2, 4, 6, 8, 10};
+    thrust::histogram_range(d_samples.begin(), d_samples.end(), d_counts.begin(), d_levels.begin(), d_levels.end());
+    ASSERT_EQUAL(h_counts, d_counts);
+  }
+};
+VariableUnitTest<TestHistogramFloatingPoint, unittest::type_list<float, double>> TestHistogramFloatingPointInstance;
+
+void TestMultiHistogram()
+{
+  // RGBA pixels of which red, green and blue are counted, and a trailing partial pixel which is not
+  const size_t num_pixels                       = 100003;
+  const thrust::host_vector<unsigned char> h_px = unittest::random_integers<unsigned char>(4 * num_pixels + 3);
+  const thrust::device_vector<unsigned char> d_px = h_px;
+
+  const ::cuda::std::array<int, 3> num_levels{257, 5, 2};
+  const ::cuda::std::array<int, 3> lower_levels{0, 64, 100};
+  const ::cuda::std::array<int, 3> upper_levels{256, 192, 101};
+
+  thrust::host_vector<int> h_red(256, 0);
+  thrust::host_vector<int> h_green(4, 0);
+  thrust::host_vector<int> h_blue(1, 0);
+  for (size_t i = 0; i < num_pixels; ++i)
+  {
+    const int red   = h_px[4 * i];
+    const int green = h_px[4 * i + 1];
+    const int blue  = h_px[4 * i + 2];
+    ++h_red[red];
+    if (green >= 64 && green < 192)
+    {
+      ++h_green[(green - 64) / 32];
+    }
+    if (blue == 100)
+    {
+      ++h_blue[0];
+    }
+  }
+
+  thrust::device_vector<int> d_red(256);
+  thrust::device_vector<int> d_green(4);
+  thrust::device_vector<int> d_blue(1);
+  using iterator = thrust::device_vector<int>::iterator;
+  const ::cuda::std::array<iterator, 3> histograms{d_red.begin(), d_green.begin(), d_blue.begin()};
+
+  thrust::multi_histogram_even<4, 3>(d_px.begin(), d_px.end(), histograms, num_levels, lower_levels, upper_levels);
+
+  ASSERT_EQUAL(h_red, d_red);
+  ASSERT_EQUAL(h_green, d_green);
+  ASSERT_EQUAL(h_blue, d_blue);
+
+  thrust::device_vector<int> d_red_levels(257);
+  thrust::sequence(d_red_levels.begin(), d_red_levels.end());
+  const thrust::device_vector<int> d_green_levels{64, 96, 128, 160, 192};
+  const thrust::device_vector<int> d_blue_levels{100, 101};
+  using level_iterator = thrust::device_vector<int>::const_iterator;
+  const ::cuda::std::array<level_iterator, 3> levels{
+    d_red_levels.cbegin(), d_green_levels.begin(), d_blue_levels.begin()};
+
+  thrust::multi_histogram_range<4, 3>(d_px.begin(), d_px.end(), histograms, num_levels, levels);
+
+  ASSERT_EQUAL(h_red, d_red);
+  ASSERT_EQUAL(h_green, d_green);
+  ASSERT_EQUAL(h_blue, d_blue);
+}
+DECLARE_UNITTEST(TestMultiHistogram);
+
+void TestHistogramMoreBinsThanSamples()
+{
+  const thrust::host_vector<unsigned int> h_samples   = unittest::random_integers<unsigned int>(1000);
+  const thrust::device_vector<unsigned int> d_samples = h_samples;
+
+  // 2^20 bins evenly subdivide all unsigned 32-bit integers
+  thrust::host_vector<unsigned int> h_counts(1 << 20, 0);
+  for (unsigned int sample : h_samples)
+  {
+    ++h_counts[sample >> 12];
+  }
+
+  thrust::device_vector<unsigned int> d_counts(1 << 20, 1);
+  thrust::histogram_even(
+    d_samples.begin(), d_samples.end(), d_counts.begin(), (1 << 20) + 1, 0ull, 1ull << 32);
+
+  ASSERT_EQUAL(h_counts, d_counts);
+}
+DECLARE_UNITTEST(TestHistogramMoreBinsThanSamples);
@@ -0,0 +1,291 @@
+#define THRUST_ENABLE_HOST_INSTRUMENTATION
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/host_vector.h>
+#include <thrust/instrumentation.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system/cpp/execution_policy.h>
+
+#include <cuda/std/functional>
+
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <unittest/unittest.h>
+
+namespace
+{
+std::size_t count_records(const std::vector<thrust::instrumentation::call_record>& records, const char* algorithm)
+{
+  std::size_t count = 0;
+  for (const auto& r : records)
+  {
+    count += std::strcmp(r.algorithm, algorithm) == 0;
+  }
+  return count;
+}
+} // namespace
+
+void TestInstrumentationRecordsHostCalls()
+{
+  thrust::host_vector<int> vec(1000);
+  thrust::sequence(vec.begin(), vec.end());
+
+  thrust::instrumentation::trace_buffer trace(64);
+  trace.attach();
+  const int sum = thrust::reduce(thrust::host, vec.begin(), vec.end());
+  trace.detach();
+
+  ASSERT_EQUAL(sum, 499500);
+
+  const auto records = trace.records();
+  ASSERT_EQUAL(count_records(records, "thrust::reduce"), 1u);
+
+  const auto& r = records.back();
+  ASSERT_EQUAL(std::string(r.algorithm), "thrust::reduce");
+  ASSERT_EQUAL(r.num_items, 1000u);
+  ASSERT_EQUAL(r.input_bytes, 1000u * sizeof(int));
+  ASSERT_EQUAL(r.depth, 0);
+  ASSERT_EQUAL(r.threads >= 1, true);
+  ASSERT_EQUAL(r.threads <= r.max_threads, true);
+  ASSERT_EQUAL(r.wall_time.count() >= 0, true);
+}
+DECLARE_UNITTEST(TestInstrumentationRecordsHostCalls);
+
+void TestInstrumentationIgnoresSequentialCalls()
+{
+  thrust::host_vector<int> vec(100, 1);
+
+  thrust::instrumentation::trace_buffer trace(64);
+  trace.attach();
+  thrust::reduce(thrust::seq, vec.begin(), vec.end());
+  thrust::sort(thrust::seq, vec.begin(), vec.end());
+  trace.detach();
+
+  ASSERT_EQUAL(trace.records().size(), 0u);
+}
+DECLARE_UNITTEST(TestInstrumentationIgnoresSequentialCalls);
+
+void TestInstrumentationDetach()
+{
+  thrust::host_vector<int> vec(100, 1);
+
+  thrust::instrumentation::trace_buffer trace(64);
+  trace.attach();
+  thrust::reduce(thrust::host, vec.begin(), vec.end());
+  trace.detach();
+  thrust::reduce(thrust::host, vec.begin(), vec.end());
+
+  ASSERT_EQUAL(count_records(trace.records(), "thrust::reduce"), 1u);
+}
+DECLARE_UNITTEST(TestInstrumentationDetach);
+
+void TestInstrumentationTraceBufferCapacity()
+{
+  thrust::host_vector<int> vec(100, 1);
+
+  thrust::instrumentation::trace_buffer trace(2);
+  trace.attach();
+  thrust::reduce(thrust::host, vec.begin(), vec.begin() + 10);
+  thrust::reduce(thrust::host, vec.begin(), vec.begin() + 20);
+  thrust::reduce(thrust::host, vec.begin(), vec.begin() + 30);
+  trace.detach();
+
+  const auto records = trace.records();
+  ASSERT_EQUAL(records.size(), 2u);
+  ASSERT_EQUAL(trace.dropped(), 1u);
+  ASSERT_EQUAL(records[0].num_items, 20u);
+  ASSERT_EQUAL(records[1].num_items, 30u);
+
+  trace.clear();
+  ASSERT_EQUAL(trace.records().size(), 0u);
+  ASSERT_EQUAL(trace.dropped(), 0u);
+}
+DECLARE_UNITTEST(TestInstrumentationTraceBufferCapacity);
+
+void TestInstrumentationNestedCalls()
+{
+  thrust::host_vector<int> vec(1000);
+  thrust::sequence(vec.begin(), vec.end());
+
+  thrust::instrumentation::trace_buffer trace(1024);
+  trace.attach();
+  thrust::stable_sort(thrust::host, vec.begin(), vec.end(), ::cuda::std::greater<int>());
+  trace.detach();
+
+  const auto records = trace.records();
+  ASSERT_EQUAL(count_records(records, "thrust::stable_sort"), 1u);
+
+  // Nested calls finish first, so the outermost call is the most recent record
+  const auto& outer = records.back();
+  ASSERT_EQUAL(std::string(outer.algorithm), "thrust::stable_sort");
+  ASSERT_EQUAL(outer.depth, 0);
+  for (const auto& r : records)
+  {
+    ASSERT_EQUAL(r.temporary_bytes <= outer.temporary_bytes, true);
+  }
+}
+DECLARE_UNITTEST(TestInstrumentationNestedCalls);
+
+namespace
+{
+struct increment
+{
+  void operator()(int& x) const
+  {
+    ++x;
+  }
+};
+
+// Calls the same algorithm with the same number of items as the call it is invoked from
+struct nested_increment
+{
+  void operator()(int& x) const
+  {
+    thrust::for_each(thrust::cpp::par, &x, &x + 1, increment{});
+  }
+};
+} // namespace
+
+void TestInstrumentationNestedCallOfSameAlgorithm()
+{
+  thrust::host_vector<int> vec(1, 0);
+
+  thrust::instrumentation::trace_buffer trace(64);
+  trace.attach();
+  thrust::for_each(thrust::cpp::par, vec.begin(), vec.end(), nested_increment{});
+  trace.detach();
+
+  ASSERT_EQUAL(vec[0], 1);
+
+  const auto records = trace.records();
+  ASSERT_EQUAL(records.size(), 2u);
+  ASSERT_EQUAL(count_records(records, "thrust::for_each"), 2u);
+  ASSERT_EQUAL(records[0].num_items, 1u);
+  ASSERT_EQUAL(records[0].depth, 1);
+  ASSERT_EQUAL(records[1].num_items, 1u);
+  ASSERT_EQUAL(records[1].depth, 0);
+}
+DECLARE_UNITTEST(TestInstrumentationNestedCallOfSameAlgorithm);
+
+namespace
+{
+struct counting_callback_state
+{
+  std::size_t calls;
+  int sum;
+};
+
+void counting_callback(const thrust::instrumentation::call_record&, void* user_data)
+{
+  auto* state = static_cast<counting_callback_state*>(user_data);
+  ++state->calls;
+
+  // Calls made by the callback are not recorded
+  int values[3] = {1, 2, 3};
+  state->sum += thrust::reduce(thrust::host, values, values + 3);
+}
+} // namespace
+
+void TestInstrumentationCallback()
+{
+  thrust::host_vector<int> vec(100, 1);
+
+  counting_callback_state state{0, 0};
+  thrust::instrumentation::set_callback(&counting_callback, &state);
+  thrust::reduce(thrust::host, vec.begin(), vec.end());
+  thrust::instrumentation::set_callback(nullptr);
+  thrust::reduce(thrust::host, vec.begin(), vec.end());
+
+  ASSERT_EQUAL(state.calls, 1u);
+  ASSERT_EQUAL(state.sum, 6);
+}
+DECLARE_UNITTEST(TestInstrumentationCallback);
+
+void TestInstrumentationExport()
+{
+  thrust::host_vector<int> vec(100, 1);
+
+  thrust::instrumentation::trace_buffer trace(64);
+  trace.attach();
+  thrust::reduce(thrust::host, vec.begin(), vec.end());
+  thrust::reduce(thrust::host, vec.begin(), vec.begin() + 50);
+  trace.detach();
+
+  const auto records = trace.records();
+  ASSERT_EQUAL(records.size(), 2u);
+
+  std::ostringstream json;
+  thrust::instrumentation::write_chrome_trace(json, records);
+  ASSERT_EQUAL(json.str().find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["), 0u);
+  ASSERT_EQUAL(json.str().find("{\"name\":\"thrust::reduce\",") != std::string::npos, true);
+  ASSERT_EQUAL(json.str().find("\"args\":{\"items\":50,") != std::string::npos, true);
+
+  std::ostringstream csv;
+  thrust::instrumentation::write_counters(csv, records);
+  ASSERT_EQUAL(
+    csv.str().find(
+      "algorithm,system,calls,serial_calls,items,input_bytes,temporary_bytes,temporary_allocations,wall_ns\n"),
+    0u);
+  ASSERT_EQUAL(csv.str().find(std::string("thrust::reduce,") + records[0].system + ",2,") != std::string::npos, true);
+}
+DECLARE_UNITTEST(TestInstrumentationExport);
+
+void TestInstrumentationCountersSerialCalls()
+{
+  thrust::instrumentation::call_record parallel{};
+  parallel.algorithm   = "thrust::sort";
+  parallel.system      = "omp";
+  parallel.num_items   = 100;
+  parallel.input_bytes = 400;
+  parallel.threads     = 8;
+  parallel.max_threads = 8;
+
+  // The same algorithm fell back to a single thread, for example because it was nested in a parallel region
+  thrust::instrumentation::call_record serial = parallel;
+  serial.threads                              = 1;
+
+  // A system which only has one thread is not counted as a serial fallback
+  thrust::instrumentation::call_record sequential = parallel;
+  sequential.system                               = "cpp";
+  sequential.threads                              = 1;
+  sequential.max_threads                          = 1;
+
+  std::ostringstream csv;
+  thrust::instrumentation::write_counters(csv, {parallel, serial, parallel, sequential});
+  ASSERT_EQUAL(csv.str().find("thrust::sort,cpp,1,0,100,400,0,0,0\n") != std::string::npos, true);
+  ASSERT_EQUAL(csv.str().find("thrust::sort,omp,3,1,300,1200,0,0,0\n") != std::string::npos, true);
+
+  std::ostringstream json;
+  thrust::instrumentation::write_chrome_trace(json, {serial});
+  ASSERT_EQUAL(json.str().find("\"threads\":1,\"max_threads\":8,") != std::string::npos, true);
+}
+DECLARE_UNITTEST(TestInstrumentationCountersSerialCalls);
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP || THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+void TestInstrumentationRecordsParallelThreads()
+{
+  thrust::device_vector<int> vec(1 << 16, 1);
+
+  thrust::instrumentation::trace_buffer trace(64);
+  trace.attach();
+  thrust::for_each(thrust::device, vec.begin(), vec.end(), increment{});
+  trace.detach();
+
+  const auto records = trace.records();
+  ASSERT_EQUAL(records.size(), 1u);
+
+  // The parallel region of the call is noted, so a call which ran in parallel is not reported as serial
+  const auto& r = records.back();
+  ASSERT_EQUAL(r.threads >= 1, true);
+  ASSERT_EQUAL(r.threads <= r.max_threads, true);
+  ASSERT_EQUAL(r.max_threads == 1 || r.threads > 1, true);
+}
+DECLARE_UNITTEST(TestInstrumentationRecordsParallelThreads);
+#endif // THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP || THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
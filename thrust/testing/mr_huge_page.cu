@@ -0,0 +1,58 @@
+#include <thrust/fill.h>
+#include <thrust/host_vector.h>
+#include <thrust/mr/allocator.h>
+#include <thrust/mr/huge_page_resource.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <unittest/unittest.h>
+
+void TestHugePageResourceAlignedAllocation()
+{
+  thrust::mr::huge_page_resource memres(4096);
+  ASSERT_EQUAL(memres.threshold(), std::size_t{4096});
+  ASSERT_EQUAL(static_cast<int>(memres.kind()), static_cast<int>(thrust::mr::huge_page_kind::transparent));
+
+  for (std::size_t size : {std::size_t{32}, std::size_t{4095}, std::size_t{4096}, std::size_t{3} << 20})
+  {
+    for (std::size_t alignment = 16; alignment <= (std::size_t{2} << 20); alignment <<= 2)
+    {
+      void* ptr = memres.do_allocate(size, alignment);
+      ASSERT_EQUAL(reinterpret_cast<std::size_t>(ptr) % alignment, 0u);
+
+      char* char_ptr = reinterpret_cast<char*>(ptr);
+      thrust::fill(char_ptr, char_ptr + size, char{1});
+
+      memres.do_deallocate(ptr, size, alignment);
+    }
+  }
+}
+DECLARE_UNITTEST(TestHugePageResourceAlignedAllocation);
+
+void TestHugePageResourceExplicitPagesFallback()
+{
+  // without reserved hugetlbfs pages, the resource falls back to transparent huge pages
+  thrust::mr::huge_page_resource memres(0, thrust::mr::huge_page_kind::explicit_2mb);
+
+  const std::size_t size = std::size_t{5} << 20;
+  void* ptr              = memres.do_allocate(size, 64);
+  char* char_ptr         = reinterpret_cast<char*>(ptr);
+  thrust::fill(char_ptr, char_ptr + size, char{1});
+  memres.do_deallocate(ptr, size, 64);
+}
+DECLARE_UNITTEST(TestHugePageResourceExplicitPagesFallback);
+
+void TestHugePageResourceAllocator()
+{
+  using allocator = thrust::mr::allocator<int, thrust::mr::huge_page_resource>;
+  thrust::mr::huge_page_resource memres(1024);
+
+  thrust::host_vector<int, allocator> v(1 << 20, allocator(&memres));
+  thrust::sequence(v.begin(), v.end(), 0);
+  ASSERT_EQUAL(v[12345], 12345);
+
+  thrust::sort(thrust::host(allocator(&memres)), v.begin(), v.end(), thrust::greater<int>());
+  ASSERT_EQUAL(v.front(), (1 << 20) - 1);
+  ASSERT_EQUAL(v.back(), 0);
+}
+DECLARE_UNITTEST(TestHugePageResourceAllocator);
@@ -0,0 +1,148 @@
+#include <thrust/copy.h>
+#include <thrust/host_vector.h>
+#include <thrust/mr/allocator.h>
+#include <thrust/mr/temporary_storage_cache.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <unittest/unittest.h>
+
+void TestTemporaryStorageCacheReuse()
+{
+  thrust::mr::temporary_storage_cache cache;
+
+  void* first = cache.do_allocate(1000, 8);
+  ASSERT_EQUAL(reinterpret_cast<std::size_t>(first) % thrust::mr::temporary_storage_cache::block_alignment, 0u);
+  cache.do_deallocate(first, 1000, 8);
+
+  thrust::mr::temporary_storage_cache_stats stats = cache.stats();
+  ASSERT_EQUAL(stats.allocations, 1u);
+  ASSERT_EQUAL(stats.cache_hits, 0u);
+  ASSERT_EQUAL(stats.bytes_in_use, 0u);
+  ASSERT_EQUAL(stats.peak_bytes_in_use, 1024u);
+  ASSERT_EQUAL(stats.bytes_cached, 1024u);
+
+  // a request of a similar size is served by the same block
+  void* second = cache.do_allocate(600, 16);
+  ASSERT_EQUAL(second, first);
+  ASSERT_EQUAL(cache.stats().cache_hits, 1u);
+  ASSERT_EQUAL(cache.stats().bytes_cached, 0u);
+
+  // a request of a different size is not
+  void* third = cache.do_allocate(5000, 16);
+  ASSERT_EQUAL(third != first, true);
+  ASSERT_EQUAL(cache.stats().bytes_in_use, 1024u + 8192u);
+  cache.do_deallocate(second, 600, 16);
+  cache.do_deallocate(third, 5000, 16);
+  ASSERT_EQUAL(cache.stats().bytes_cached, 1024u + 8192u);
+
+  cache.reset_stats();
+  ASSERT_EQUAL(cache.stats().allocations, 0u);
+  ASSERT_EQUAL(cache.stats().peak_bytes_in_use, 0u);
+}
+DECLARE_UNITTEST(TestTemporaryStorageCacheReuse);
+
+void TestTemporaryStorageCacheTrim()
+{
+  thrust::mr::temporary_storage_cache cache;
+
+  void* small = cache.do_allocate(256);
+  void* large = cache.do_allocate(1 << 20);
+  cache.do_deallocate(small, 256);
+  cache.do_deallocate(large, 1 << 20);
+  ASSERT_EQUAL(cache.stats().bytes_cached, 256u + (1u << 20));
+
+  // the largest blocks are released first
+  cache.trim(4096);
+  ASSERT_EQUAL(cache.stats().bytes_cached, 256u);
+  ASSERT_EQUAL(cache.do_allocate(100), small);
+  cache.do_deallocate(small, 100);
+
+  cache.trim();
+  ASSERT_EQUAL(cache.stats().bytes_cached, 0u);
+}
+DECLARE_UNITTEST(TestTemporaryStorageCacheTrim);
+
+void TestTemporaryStorageCacheLimit()
+{
+  thrust::mr::temporary_storage_cache cache(4096);
+  ASSERT_EQUAL(cache.max_cached_bytes(), 4096u);
+
+  void* a = cache.do_allocate(4096);
+  void* b = cache.do_allocate(4096);
+  cache.do_deallocate(a, 4096);
+  cache.do_deallocate(b, 4096);
+  ASSERT_EQUAL(cache.stats().bytes_cached, 4096u);
+
+  cache.set_max_cached_bytes(0);
+  ASSERT_EQUAL(cache.stats().bytes_cached, 0u);
+
+  // over-aligned requests bypass the cache
+  void* aligned = cache.do_allocate(100, 4096);
+  ASSERT_EQUAL(reinterpret_cast<std::size_t>(aligned) % 4096, 0u);
+  cache.do_deallocate(aligned, 100, 4096);
+  ASSERT_EQUAL(cache.stats().bytes_in_use, 0u);
+}
+DECLARE_UNITTEST(TestTemporaryStorageCacheLimit);
+
+void TestTemporaryStorageCacheOversized()
+{
+  thrust::mr::temporary_storage_cache cache(4096);
+
+  // a request whose bin exceeds the limit is not rounded up, as its block could never be cached
+  void* large = cache.do_allocate(5000);
+  ASSERT_EQUAL(reinterpret_cast<std::size_t>(large) % thrust::mr::temporary_storage_cache::block_alignment, 0u);
+  ASSERT_EQUAL(cache.stats().bytes_in_use, 5000u);
+  ASSERT_EQUAL(cache.stats().peak_bytes_in_use, 5000u);
+  cache.do_deallocate(large, 5000);
+  ASSERT_EQUAL(cache.stats().bytes_in_use, 0u);
+  ASSERT_EQUAL(cache.stats().bytes_cached, 0u);
+
+  // raising the limit while such a block is in use must not put it into a bin it is too small for
+  large = cache.do_allocate(5000);
+  cache.set_max_cached_bytes(1 << 20);
+  cache.do_deallocate(large, 5000);
+  ASSERT_EQUAL(cache.stats().bytes_in_use, 0u);
+  ASSERT_EQUAL(cache.stats().bytes_cached, 0u);
+
+  // under the new limit, the same request is rounded up and cached
+  large = cache.do_allocate(5000);
+  ASSERT_EQUAL(cache.stats().bytes_in_use, 8192u);
+  cache.do_deallocate(large, 5000);
+  ASSERT_EQUAL(cache.stats().bytes_cached, 8192u);
+  ASSERT_EQUAL(cache.stats().cache_hits, 0u);
+}
+DECLARE_UNITTEST(TestTemporaryStorageCacheOversized);
+
+template <typename T>
+struct TestTemporaryStorageCacheAlgorithms
+{
+  void operator()(std::size_t n)
+  {
+    using allocator = thrust::mr::allocator<char, thrust::mr::temporary_storage_cache>;
+    thrust::mr::temporary_storage_cache& cache = thrust::mr::thread_temporary_storage_cache();
+    cache.trim();
+    cache.reset_stats();
+
+    thrust::host_vector<T> data = unittest::random_integers<T>(n);
+    thrust::host_vector<T> ref  = data;
+    thrust::stable_sort(ref.begin(), ref.end());
+
+    for (int i = 0; i < 4; ++i)
+    {
+      thrust::host_vector<T> keys = data;
+      thrust::stable_sort(thrust::host(allocator(&cache)), keys.begin(), keys.end());
+      ASSERT_EQUAL(keys, ref);
+    }
+
+    // every call after the first one is served from the cache
+    const thrust::mr::temporary_storage_cache_stats stats = cache.stats();
+    ASSERT_EQUAL(stats.bytes_in_use, 0u);
+    if (n > 1)
+    {
+      ASSERT_EQUAL(stats.allocations >= 4, true);
+      ASSERT_EQUAL(stats.allocations - stats.cache_hits <= stats.allocations / 4, true);
+    }
+  }
+};
+VariableUnitTest<TestTemporaryStorageCacheAlgorithms, IntegralTypes> TestTemporaryStorageCacheAlgorithmsInstance;
@@ -0,0 +1,43 @@
+#define THRUST_HOST_TEMPORARY_STORAGE_CACHE
+
+#include <thrust/execution_policy.h>
+#include <thrust/host_vector.h>
+#include <thrust/mr/temporary_storage_cache.h>
+#include <thrust/sort.h>
+
+#include <algorithm>
+
+#include <unittest/unittest.h>
+
+template <typename T>
+struct TestTemporaryStorageCacheOptIn
+{
+  void operator()(std::size_t n)
+  {
+    thrust::mr::temporary_storage_cache& cache = thrust::mr::thread_temporary_storage_cache();
+    cache.trim();
+    cache.reset_stats();
+
+    thrust::host_vector<T> data = unittest::random_integers<T>(n);
+    thrust::host_vector<T> ref  = data;
+    std::stable_sort(ref.begin(), ref.end());
+
+    // the sequential system serves its temporary buffers from the cache of the calling thread, without an allocator
+    // being passed to the execution policy
+    for (int i = 0; i < 4; ++i)
+    {
+      thrust::host_vector<T> keys = data;
+      thrust::stable_sort(thrust::seq, keys.begin(), keys.end());
+      ASSERT_EQUAL(keys, ref);
+    }
+
+    const thrust::mr::temporary_storage_cache_stats stats = cache.stats();
+    ASSERT_EQUAL(stats.bytes_in_use, 0u);
+    if (n > 1)
+    {
+      ASSERT_EQUAL(stats.allocations >= 4, true);
+      ASSERT_EQUAL(stats.allocations - stats.cache_hits <= stats.allocations / 4, true);
+    }
+  }
+};
+VariableUnitTest<TestTemporaryStorageCacheOptIn, IntegralTypes> TestTemporaryStorageCacheOptInInstance;
@@ -0,0 +1,137 @@
+#include <thrust/execution_policy.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+
+#include <cuda/__execution/determinism.h>
+#include <cuda/__execution/require.h>
+
+#include <unittest/unittest.h>
+
+#include <omp.h>
+
+namespace
+{
+auto deterministic_policy()
+{
+  return thrust::omp::par(cuda::execution::require(cuda::execution::determinism::run_to_run));
+}
+
+// Values whose sums are rounded, so that the results depend on the order of the operations
+template <typename T>
+thrust::host_vector<T> fractional_samples(const size_t n)
+{
+  thrust::host_vector<T> vec(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    vec[i] = T{1} / static_cast<T>(1 + i % 97);
+  }
+  return vec;
+}
+
+// Restores the number of OpenMP threads on destruction
+class num_threads_guard
+{
+  int m_num_threads = omp_get_max_threads();
+
+public:
+  ~num_threads_guard()
+  {
+    omp_set_num_threads(m_num_threads);
+  }
+};
+} // namespace
+
+template <typename T>
+struct TestOmpDeterministicReduce
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> input = fractional_samples<T>(n);
+
+    num_threads_guard guard;
+    omp_set_num_threads(1);
+    const T expected = thrust::reduce(deterministic_policy(), input.begin(), input.end(), T{1});
+
+    for (int num_threads : {2, 3, 8})
+    {
+      omp_set_num_threads(num_threads);
+      const T result = thrust::reduce(deterministic_policy(), input.begin(), input.end(), T{1});
+      ASSERT_EQUAL_QUIET(expected, result);
+    }
+
+    // Sums of small integers are exact
+    input = unittest::random_samples<T>(n);
+    ASSERT_EQUAL(thrust::reduce(thrust::host, input.begin(), input.end(), T{1}),
+                 thrust::reduce(deterministic_policy(), input.begin(), input.end(), T{1}));
+  }
+};
+VariableUnitTest<TestOmpDeterministicReduce, FloatingPointTypes> TestOmpDeterministicReduceInstance;
+
+template <typename T>
+struct TestOmpDeterministicScan
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> input = fractional_samples<T>(n);
+    thrust::host_vector<T> expected_inclusive(n);
+    thrust::host_vector<T> expected_exclusive(n);
+    thrust::host_vector<T> result(n);
+
+    num_threads_guard guard;
+    omp_set_num_threads(1);
+    thrust::inclusive_scan(deterministic_policy(), input.begin(), input.end(), expected_inclusive.begin());
+    thrust::exclusive_scan(deterministic_policy(), input.begin(), input.end(), expected_exclusive.begin(), T{1});
+
+    for (int num_threads : {2, 3, 8})
+    {
+      omp_set_num_threads(num_threads);
+
+      thrust::inclusive_scan(deterministic_policy(), input.begin(), input.end(), result.begin());
+      ASSERT_EQUAL_QUIET(expected_inclusive, result);
+
+      thrust::exclusive_scan(deterministic_policy(), input.begin(), input.end(), result.begin(), T{1});
+      ASSERT_EQUAL_QUIET(expected_exclusive, result);
+    }
+
+    input = unittest::random_samples<T>(n);
+    thrust::inclusive_scan(thrust::host, input.begin(), input.end(), expected_inclusive.begin());
+    thrust::inclusive_scan(deterministic_policy(), input.begin(), input.end(), result.begin());
+    ASSERT_EQUAL(expected_inclusive, result);
+  }
+};
+VariableUnitTest<TestOmpDeterministicScan, FloatingPointTypes> TestOmpDeterministicScanInstance;
+
+void TestOmpDeterministicReduceByKey()
+{
+  const size_t n = 100000;
+
+  thrust::host_vector<int> keys(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    keys[i] = static_cast<int>(i / 1000);
+  }
+  thrust::host_vector<float> values = fractional_samples<float>(n);
+
+  thrust::host_vector<int> expected_keys(n);
+  thrust::host_vector<float> expected_values(n);
+  thrust::host_vector<int> result_keys(n);
+  thrust::host_vector<float> result_values(n);
+
+  num_threads_guard guard;
+  omp_set_num_threads(1);
+  thrust::reduce_by_key(
+    deterministic_policy(),
+    keys.begin(),
+    keys.end(),
+    values.begin(),
+    expected_keys.begin(),
+    expected_values.begin());
+
+  omp_set_num_threads(4);
+  thrust::reduce_by_key(
+    deterministic_policy(), keys.begin(), keys.end(), values.begin(), result_keys.begin(), result_values.begin());
+
+  ASSERT_EQUAL(expected_keys, result_keys);
+  ASSERT_EQUAL_QUIET(expected_values, result_values);
+}
+DECLARE_UNITTEST(TestOmpDeterministicReduceByKey);
@@ -91,3 +91,46 @@ struct TestOmpReduceIntervals
   }
 };
 VariableUnitTest<TestOmpReduceIntervals, IntegralTypes> TestOmpReduceIntervalsInstance;
+
+// associative, but not commutative
+template <typename T>
+struct last_element
+{
+  _CCCL_HOST_DEVICE T operator()(T, T rhs) const
+  {
+    return rhs;
+  }
+};
+
+template <typename T>
+struct TestOmpReduceIntervalsOperators
+{
+  void operator()(const size_t n)
+  {
+    using thrust::system::detail::internal::uniform_decomposition;
+    using thrust::system::omp::detail::reduce_intervals;
+
+    thrust::host_vector<T> h_input   = unittest::random_integers<T>(n);
+    thrust::device_vector<T> d_input = h_input;
+
+    // few large intervals, so that they are reduced with multiple accumulators
+    uniform_decomposition<size_t> decomp(n, 7, 3);
+
+    thrust::host_vector<T> h_output(decomp.size());
+    thrust::device_vector<T> d_output(decomp.size());
+    thrust::system::omp::tag omp_tag;
+
+    ::reduce_intervals(h_input.begin(), h_output.begin(), ::cuda::maximum<T>(), decomp);
+    reduce_intervals(omp_tag, d_input.begin(), d_output.begin(), ::cuda::maximum<T>(), decomp);
+    ASSERT_EQUAL(h_output, d_output);
+
+    ::reduce_intervals(h_input.begin(), h_output.begin(), ::cuda::std::bit_xor<T>(), decomp);
+    reduce_intervals(omp_tag, d_input.begin(), d_output.begin(), ::cuda::std::bit_xor<T>(), decomp);
+    ASSERT_EQUAL(h_output, d_output);
+
+    ::reduce_intervals(h_input.begin(), h_output.begin(), last_element<T>(), decomp);
+    reduce_intervals(omp_tag, d_input.begin(), d_output.begin(), last_element<T>(), decomp);
+    ASSERT_EQUAL(h_output, d_output);
+  }
+};
+VariableUnitTest<TestOmpReduceIntervalsOperators, IntegralTypes> TestOmpReduceIntervalsOperatorsInstance;
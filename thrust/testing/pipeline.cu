@@ -0,0 +1,153 @@
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/pipeline.h>
+#include <thrust/sequence.h>
+
+#include <cuda/std/tuple>
+
+#include <unittest/unittest.h>
+
+struct pipeline_square
+{
+  _CCCL_HOST_DEVICE long long operator()(int x) const
+  {
+    return static_cast<long long>(x) * x;
+  }
+};
+
+struct pipeline_is_even
+{
+  template <typename T>
+  _CCCL_HOST_DEVICE bool operator()(T x) const
+  {
+    return x % 2 == 0;
+  }
+};
+
+struct pipeline_is_positive
+{
+  _CCCL_HOST_DEVICE bool operator()(int x) const
+  {
+    return x > 0;
+  }
+};
+
+struct pipeline_sum_of_pair
+{
+  _CCCL_HOST_DEVICE int operator()(const ::cuda::std::tuple<int, int>& t) const
+  {
+    return ::cuda::std::get<0>(t) + ::cuda::std::get<1>(t);
+  }
+};
+
+struct pipeline_max
+{
+  _CCCL_HOST_DEVICE long long operator()(long long a, long long b) const
+  {
+    return a < b ? b : a;
+  }
+};
+
+void TestPipelineSimple()
+{
+  int data[6] = {1, -2, 3, -4, 5, -6};
+
+  const int sum = thrust::pipeline(thrust::host, data, data + 6) | thrust::stages::filter(pipeline_is_positive{})
+                | thrust::stages::reduce(0);
+  ASSERT_EQUAL(sum, 9);
+
+  const long long squares = thrust::pipeline(thrust::host, data, data + 6)
+                          | thrust::stages::filter(pipeline_is_positive{})
+                          | thrust::stages::transform(pipeline_square{}) | thrust::stages::reduce(0LL);
+  ASSERT_EQUAL(squares, 35);
+
+  const auto count = thrust::pipeline(thrust::host, data, data + 6) | thrust::stages::filter(pipeline_is_even{})
+                   | thrust::stages::count();
+  ASSERT_EQUAL(count, 3);
+}
+DECLARE_UNITTEST(TestPipelineSimple);
+
+void TestPipelineTransformFilterReduce(const size_t n)
+{
+  thrust::host_vector<int> h_input = unittest::random_integers<int>(n);
+  for (auto& x : h_input)
+  {
+    x %= 1000;
+  }
+  thrust::device_vector<int> d_input = h_input;
+
+  thrust::host_vector<long long> h_squares(n);
+  thrust::transform(h_input.begin(), h_input.end(), h_squares.begin(), pipeline_square{});
+  thrust::host_vector<long long> h_selected(n);
+  h_selected.erase(thrust::copy_if(h_squares.begin(), h_squares.end(), h_selected.begin(), pipeline_is_even{}),
+                   h_selected.end());
+
+  const auto p = thrust::pipeline(thrust::device, d_input.begin(), d_input.end())
+               | thrust::stages::transform(pipeline_square{}) | thrust::stages::filter(pipeline_is_even{});
+
+  ASSERT_EQUAL(p | thrust::stages::reduce(0LL), thrust::reduce(h_selected.begin(), h_selected.end(), 0LL));
+  ASSERT_EQUAL(p | thrust::stages::reduce(-1LL, pipeline_max{}),
+               thrust::reduce(h_selected.begin(), h_selected.end(), -1LL, pipeline_max{}));
+  ASSERT_EQUAL(static_cast<size_t>(p | thrust::stages::count()), h_selected.size());
+
+  thrust::device_vector<long long> d_selected(n);
+  const auto end = p | thrust::stages::copy(d_selected.begin());
+  d_selected.erase(end, d_selected.end());
+  ASSERT_EQUAL(d_selected, h_selected);
+}
+DECLARE_SIZED_UNITTEST(TestPipelineTransformFilterReduce);
+
+void TestPipelineEmpty()
+{
+  thrust::device_vector<int> vec(10, 1);
+
+  const auto p = thrust::pipeline(thrust::device, vec.begin(), vec.begin());
+  ASSERT_EQUAL(p | thrust::stages::reduce(7), 7);
+  ASSERT_EQUAL(p | thrust::stages::count(), 0);
+
+  // All elements are removed
+  const auto q = thrust::pipeline(thrust::device, vec.begin(), vec.end()) | thrust::stages::filter(pipeline_is_even{});
+  ASSERT_EQUAL(q | thrust::stages::reduce(7), 7);
+  ASSERT_EQUAL(q | thrust::stages::count(), 0);
+
+  thrust::device_vector<int> out(10, 0);
+  ASSERT_EQUAL((q | thrust::stages::copy(out.begin())) - out.begin(), 0);
+}
+DECLARE_UNITTEST(TestPipelineEmpty);
+
+void TestPipelineZipIterator()
+{
+  thrust::device_vector<int> vec(100);
+  thrust::sequence(vec.begin(), vec.end());
+
+  auto first = thrust::make_zip_iterator(vec.begin(), thrust::counting_iterator<int>(100));
+  const auto p =
+    thrust::pipeline(thrust::device, first, first + 100) | thrust::stages::transform(pipeline_sum_of_pair{});
+
+  // The sums are 100, 102, ..., 298
+  ASSERT_EQUAL(p | thrust::stages::reduce(0), 19900);
+  ASSERT_EQUAL(p | thrust::stages::filter(pipeline_is_even{}) | thrust::stages::count(), 100);
+
+  thrust::device_vector<int> out(100);
+  p | thrust::stages::copy(out.begin());
+  ASSERT_EQUAL(out[0], 100);
+  ASSERT_EQUAL(out[99], 298);
+}
+DECLARE_UNITTEST(TestPipelineZipIterator);
+
+void TestPipelineIterators()
+{
+  thrust::device_vector<int> vec(4);
+  thrust::sequence(vec.begin(), vec.end());
+
+  const auto p = thrust::pipeline(thrust::device, vec.begin(), vec.end()) | thrust::stages::filter(pipeline_is_even{});
+  ASSERT_EQUAL(p.end() - p.begin(), 4);
+
+  // Removed elements are empty optionals
+  ASSERT_EQUAL(static_cast<bool>(p.begin()[0]), true);
+  ASSERT_EQUAL(*p.begin()[0], 0);
+  ASSERT_EQUAL(static_cast<bool>(p.begin()[1]), false);
+  ASSERT_EQUAL(*p.begin()[2], 2);
+}
+DECLARE_UNITTEST(TestPipelineIterators);
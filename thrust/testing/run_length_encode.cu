@@ -0,0 +1,252 @@
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/retag.h>
+#include <thrust/run_length_encode.h>
+
+#include <unittest/unittest.h>
+
+template <typename InputIterator, typename OutputIterator1, typename OutputIterator2>
+cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  my_system& system, InputIterator, InputIterator, OutputIterator1 unique_out, OutputIterator2 counts_out)
+{
+  system.validate_dispatch();
+  return cuda::std::make_pair(unique_out, counts_out);
+}
+
+void TestRunLengthEncodeDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::run_length_encode(sys, vec.begin(), vec.begin(), vec.begin(), vec.begin());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestRunLengthEncodeDispatchExplicit);
+
+template <typename InputIterator, typename OutputIterator1, typename OutputIterator2>
+cuda::std::pair<OutputIterator1, OutputIterator2>
+run_length_encode(my_tag, InputIterator, InputIterator, OutputIterator1 unique_out, OutputIterator2 counts_out)
+{
+  *unique_out = 13;
+  return cuda::std::make_pair(unique_out, counts_out);
+}
+
+void TestRunLengthEncodeDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::run_length_encode(thrust::retag<my_tag>(vec.begin()),
+                            thrust::retag<my_tag>(vec.begin()),
+                            thrust::retag<my_tag>(vec.begin()),
+                            thrust::retag<my_tag>(vec.begin()));
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestRunLengthEncodeDispatchImplicit);
+
+template <typename ForwardIterator, typename OutputIterator1, typename OutputIterator2>
+cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  my_system& system, ForwardIterator, ForwardIterator, OutputIterator1 offsets_out, OutputIterator2 lengths_out)
+{
+  system.validate_dispatch();
+  return cuda::std::make_pair(offsets_out, lengths_out);
+}
+
+void TestNonTrivialRunsDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::non_trivial_runs(sys, vec.begin(), vec.begin(), vec.begin(), vec.begin());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestNonTrivialRunsDispatchExplicit);
+
+struct equal_modulo_10
+{
+  template <typename T>
+  _CCCL_HOST_DEVICE bool operator()(const T& lhs, const T& rhs) const
+  {
+    return lhs % 10 == rhs % 10;
+  }
+};
+
+template <class Vector>
+void TestRunLengthEncodeSimple()
+{
+  using T = typename Vector::value_type;
+
+  Vector input{1, 1, 2, 3, 3, 3, 1};
+  Vector unique(7);
+  thrust::device_vector<int> counts(7);
+
+  auto ends = thrust::run_length_encode(input.begin(), input.end(), unique.begin(), counts.begin());
+  ASSERT_EQUAL(4, ends.first - unique.begin());
+  ASSERT_EQUAL(4, ends.second - counts.begin());
+
+  unique.resize(4);
+  counts.resize(4);
+  Vector unique_ref{1, 2, 3, 1};
+  thrust::device_vector<int> counts_ref{2, 1, 3, 1};
+  ASSERT_EQUAL(unique_ref, unique);
+  ASSERT_EQUAL(counts_ref, counts);
+
+  // Runs are formed by the predicate rather than by equality
+  input = {1, 11, 2, 3, 13, 33, 1};
+  unique.resize(7);
+  counts.resize(7);
+  ends = thrust::run_length_encode(input.begin(), input.end(), unique.begin(), counts.begin(), equal_modulo_10());
+  ASSERT_EQUAL(4, ends.first - unique.begin());
+
+  unique.resize(4);
+  counts.resize(4);
+  unique_ref = {T(1), T(2), T(3), T(1)};
+  ASSERT_EQUAL(unique_ref, unique);
+  ASSERT_EQUAL(counts_ref, counts);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestRunLengthEncodeSimple);
+
+template <class Vector>
+void TestNonTrivialRunsSimple()
+{
+  Vector input{1, 1, 2, 3, 3, 3, 1};
+  thrust::device_vector<int> offsets(7);
+  thrust::device_vector<int> lengths(7);
+
+  auto ends = thrust::non_trivial_runs(input.begin(), input.end(), offsets.begin(), lengths.begin());
+  ASSERT_EQUAL(2, ends.first - offsets.begin());
+  ASSERT_EQUAL(2, ends.second - lengths.begin());
+
+  offsets.resize(2);
+  lengths.resize(2);
+  thrust::device_vector<int> offsets_ref{0, 3};
+  thrust::device_vector<int> lengths_ref{2, 3};
+  ASSERT_EQUAL(offsets_ref, offsets);
+  ASSERT_EQUAL(lengths_ref, lengths);
+
+  // Neither an empty input nor one without repetitions has a non-trivial run
+  ends = thrust::non_trivial_runs(input.begin(), input.begin(), offsets.begin(), lengths.begin());
+  ASSERT_EQUAL(true, ends.first == offsets.begin());
+
+  ends = thrust::non_trivial_runs(input.begin() + 1, input.begin() + 4, offsets.begin(), lengths.begin());
+  ASSERT_EQUAL(true, ends.first == offsets.begin());
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestNonTrivialRunsSimple);
+
+template <typename T>
+void run_length_encode_reference(
+  const thrust::host_vector<T>& input,
+  thrust::host_vector<T>& unique,
+  thrust::host_vector<int>& counts,
+  thrust::host_vector<int>& offsets,
+  thrust::host_vector<int>& lengths)
+{
+  int offset = 0;
+  for (size_t i = 0; i < input.size(); ++i)
+  {
+    if (i == 0 || !(input[i - 1] == input[i]))
+    {
+      unique.push_back(input[i]);
+      counts.push_back(1);
+    }
+    else
+    {
+      ++counts.back();
+    }
+  }
+
+  for (int count : counts)
+  {
+    if (count > 1)
+    {
+      offsets.push_back(offset);
+      lengths.push_back(count);
+    }
+    offset += count;
+  }
+}
+
+template <typename T>
+void check_run_length_encode(const thrust::host_vector<T>& h_input)
+{
+  thrust::host_vector<T> h_unique;
+  thrust::host_vector<int> h_counts, h_offsets, h_lengths;
+  run_length_encode_reference(h_input, h_unique, h_counts, h_offsets, h_lengths);
+
+  const thrust::device_vector<T> d_input = h_input;
+  thrust::device_vector<T> d_unique(h_input.size());
+  thrust::device_vector<int> d_counts(h_input.size());
+
+  const auto rle_ends = thrust::run_length_encode(d_input.begin(), d_input.end(), d_unique.begin(), d_counts.begin());
+  ASSERT_EQUAL(h_unique.size(), static_cast<size_t>(rle_ends.first - d_unique.begin()));
+  ASSERT_EQUAL(h_counts.size(), static_cast<size_t>(rle_ends.second - d_counts.begin()));
+
+  d_unique.resize(h_unique.size());
+  d_counts.resize(h_counts.size());
+  ASSERT_EQUAL(h_unique, d_unique);
+  ASSERT_EQUAL(h_counts, d_counts);
+
+  thrust::device_vector<int> d_offsets(h_input.size());
+  thrust::device_vector<int> d_lengths(h_input.size());
+
+  const auto ntr_ends = thrust::non_trivial_runs(d_input.begin(), d_input.end(), d_offsets.begin(), d_lengths.begin());
+  ASSERT_EQUAL(h_offsets.size(), static_cast<size_t>(ntr_ends.first - d_offsets.begin()));
+  ASSERT_EQUAL(h_lengths.size(), static_cast<size_t>(ntr_ends.second - d_lengths.begin()));
+
+  d_offsets.resize(h_offsets.size());
+  d_lengths.resize(h_lengths.size());
+  ASSERT_EQUAL(h_offsets, d_offsets);
+  ASSERT_EQUAL(h_lengths, d_lengths);
+}
+
+template <typename T>
+struct TestRunLengthEncode
+{
+  void operator()(const size_t n)
+  {
+    // Few distinct values, so that runs of all lengths occur
+    thrust::host_vector<T> h_input = unittest::random_integers<T>(n);
+    for (T& x : h_input)
+    {
+      x = static_cast<T>(static_cast<unsigned long long>(x) % 3);
+    }
+
+    check_run_length_encode(h_input);
+  }
+};
+VariableUnitTest<TestRunLengthEncode, IntegralTypes> TestRunLengthEncodeInstance;
+
+void TestRunLengthEncodeLongRuns()
+{
+  // Runs which end right before, at and after multiples of 2^14, and runs which span many multiples of it
+  thrust::host_vector<int> h_input;
+  const int lengths[] = {16383, 1, 1, 16383, 2, 100000, 1, 1, 1, 16384, 16384, 50000, 3};
+  int value           = 0;
+  for (int length : lengths)
+  {
+    h_input.insert(h_input.end(), length, value++);
+  }
+
+  check_run_length_encode(h_input);
+
+  // A single run over the whole input
+  h_input.assign(200000, 7);
+  check_run_length_encode(h_input);
+}
+DECLARE_UNITTEST(TestRunLengthEncodeLongRuns);
+
+void TestRunLengthEncodeDiscard()
+{
+  thrust::device_vector<int> input{4, 4, 4, 5, 6, 6};
+  thrust::device_vector<int> counts(6);
+
+  const auto ends =
+    thrust::run_length_encode(input.begin(), input.end(), thrust::make_discard_iterator(), counts.begin());
+  ASSERT_EQUAL(3, ends.second - counts.begin());
+
+  counts.resize(3);
+  thrust::device_vector<int> ref{3, 1, 2};
+  ASSERT_EQUAL(ref, counts);
+}
+DECLARE_UNITTEST(TestRunLengthEncodeDiscard);
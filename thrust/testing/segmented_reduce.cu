@@ -0,0 +1,194 @@
+#include <thrust/functional.h>
+#include <thrust/iterator/retag.h>
+#include <thrust/reduce.h>
+#include <thrust/segmented_reduce.h>
+
+#include <unittest/unittest.h>
+
+template <typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename OutputIterator>
+OutputIterator segmented_reduce(
+  my_system& system,
+  RandomAccessIterator,
+  BeginOffsetIterator,
+  BeginOffsetIterator,
+  EndOffsetIterator,
+  OutputIterator result)
+{
+  system.validate_dispatch();
+  return result;
+}
+
+void TestSegmentedReduceDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+  thrust::device_vector<int> offsets(2);
+
+  my_system sys(0);
+  thrust::segmented_reduce(sys, vec.begin(), offsets.begin(), offsets.begin() + 1, offsets.begin() + 1, vec.begin());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestSegmentedReduceDispatchExplicit);
+
+template <typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename OutputIterator>
+OutputIterator segmented_reduce(
+  my_tag, RandomAccessIterator, BeginOffsetIterator, BeginOffsetIterator, EndOffsetIterator, OutputIterator result)
+{
+  *result = 13;
+  return result;
+}
+
+void TestSegmentedReduceDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+  thrust::device_vector<int> offsets(2);
+
+  thrust::segmented_reduce(
+    thrust::retag<my_tag>(vec.begin()),
+    offsets.begin(),
+    offsets.begin() + 1,
+    offsets.begin() + 1,
+    thrust::retag<my_tag>(vec.begin()));
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestSegmentedReduceDispatchImplicit);
+
+template <class Vector>
+void TestSegmentedReduceSimple()
+{
+  using T = typename Vector::value_type;
+
+  Vector data{1, 0, 2, 2, 1, 3};
+  Vector result(3);
+
+  // [0, 2), an empty segment and [1, 6), which overlaps the first one
+  thrust::device_vector<int> begin_offsets{0, 2, 1};
+  thrust::device_vector<int> end_offsets{2, 2, 6};
+
+  auto end = thrust::segmented_reduce(
+    data.begin(), begin_offsets.begin(), begin_offsets.end(), end_offsets.begin(), result.begin());
+  ASSERT_EQUAL(true, end == result.end());
+
+  Vector ref{1, 0, 8};
+  ASSERT_EQUAL(ref, result);
+
+  thrust::segmented_reduce(
+    data.begin(), begin_offsets.begin(), begin_offsets.end(), end_offsets.begin(), result.begin(), T(10));
+
+  ref = {11, 10, 18};
+  ASSERT_EQUAL(ref, result);
+
+  thrust::segmented_reduce(
+    data.begin(),
+    begin_offsets.begin(),
+    begin_offsets.end(),
+    end_offsets.begin(),
+    result.begin(),
+    T(-1),
+    ::cuda::maximum<T>());
+
+  ref = {1, -1, 3};
+  ASSERT_EQUAL(ref, result);
+}
+DECLARE_VECTOR_UNITTEST(TestSegmentedReduceSimple);
+
+template <typename T>
+struct plus_mod_10
+{
+  _CCCL_HOST_DEVICE T operator()(T lhs, T rhs) const
+  {
+    return ((lhs % 10) + (rhs % 10)) % 10;
+  }
+};
+
+// Adjacent segments of random sizes up to max_size, with every seventh one empty, that cover exactly n elements
+inline thrust::host_vector<int> random_segment_offsets(const size_t n, const size_t max_size)
+{
+  thrust::host_vector<int> offsets{0};
+  thrust::host_vector<unsigned int> sizes = unittest::random_integers<unsigned int>(n + 1);
+
+  for (size_t i = 0, covered = 0; covered < n; ++i)
+  {
+    const size_t size = i % 7 == 0 ? 0 : 1 + sizes[i % sizes.size()] % max_size;
+    covered           = (std::min) (n, covered + size);
+    offsets.push_back(static_cast<int>(covered));
+  }
+  return offsets;
+}
+
+template <typename T>
+struct TestSegmentedReduce
+{
+  void operator()(const size_t n)
+  {
+    for (size_t max_size : {size_t{1}, size_t{10}, size_t{1000}})
+    {
+      const thrust::host_vector<int> h_offsets   = random_segment_offsets(n, max_size);
+      const thrust::device_vector<int> d_offsets = h_offsets;
+      const size_t num_segments                  = h_offsets.size() - 1;
+
+      const thrust::host_vector<T> h_data   = unittest::random_integers<T>(n);
+      const thrust::device_vector<T> d_data = h_data;
+
+      thrust::host_vector<T> h_result(num_segments);
+      thrust::device_vector<T> d_result(num_segments);
+
+      const T init = 3;
+      for (size_t i = 0; i < num_segments; ++i)
+      {
+        h_result[i] =
+          thrust::reduce(h_data.begin() + h_offsets[i], h_data.begin() + h_offsets[i + 1], init, plus_mod_10<T>());
+      }
+      thrust::segmented_reduce(
+        d_data.begin(),
+        d_offsets.begin(),
+        d_offsets.end() - 1,
+        d_offsets.begin() + 1,
+        d_result.begin(),
+        init,
+        plus_mod_10<T>());
+
+      ASSERT_EQUAL(h_result, d_result);
+    }
+  }
+};
+VariableUnitTest<TestSegmentedReduce, UnsignedIntegralTypes> TestSegmentedReduceInstance;
+
+void TestSegmentedReduceMixedSegmentSizes()
+{
+  // Many tiny segments around a few segments that are large enough to be reduced by all threads
+  thrust::host_vector<int> h_offsets{0};
+  for (int size : {3, 1 << 17, 0, 5, 1 << 16, 2, 70000})
+  {
+    for (int i = 0; i < 1000; ++i)
+    {
+      h_offsets.push_back(h_offsets.back() + i % 9);
+    }
+    h_offsets.push_back(h_offsets.back() + size);
+  }
+  const thrust::device_vector<int> d_offsets = h_offsets;
+  const size_t num_segments                  = h_offsets.size() - 1;
+
+  const thrust::host_vector<long long> h_data   = unittest::random_integers<int>(h_offsets.back());
+  const thrust::device_vector<long long> d_data = h_data;
+
+  thrust::host_vector<long long> h_result(num_segments);
+  thrust::device_vector<long long> d_result(num_segments);
+
+  for (size_t i = 0; i < num_segments; ++i)
+  {
+    h_result[i] = thrust::reduce(h_data.begin() + h_offsets[i], h_data.begin() + h_offsets[i + 1]);
+  }
+  thrust::segmented_reduce(
+    d_data.begin(), d_offsets.begin(), d_offsets.end() - 1, d_offsets.begin() + 1, d_result.begin());
+
+  ASSERT_EQUAL(h_result, d_result);
+}
+DECLARE_UNITTEST(TestSegmentedReduceMixedSegmentSizes);
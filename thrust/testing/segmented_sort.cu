@@ -0,0 +1,185 @@
+#include <thrust/functional.h>
+#include <thrust/iterator/retag.h>
+#include <thrust/segmented_sort.h>
+#include <thrust/sort.h>
+
+#include <unittest/unittest.h>
+
+template <typename RandomAccessIterator, typename BeginOffsetIterator, typename EndOffsetIterator>
+void segmented_sort(
+  my_system& system, RandomAccessIterator, BeginOffsetIterator, BeginOffsetIterator, EndOffsetIterator)
+{
+  system.validate_dispatch();
+}
+
+void TestSegmentedSortDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+  thrust::device_vector<int> offsets(2);
+
+  my_system sys(0);
+  thrust::segmented_sort(sys, vec.begin(), offsets.begin(), offsets.begin() + 1, offsets.begin() + 1);
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestSegmentedSortDispatchExplicit);
+
+template <typename RandomAccessIterator, typename BeginOffsetIterator, typename EndOffsetIterator>
+void segmented_sort(my_tag, RandomAccessIterator first, BeginOffsetIterator, BeginOffsetIterator, EndOffsetIterator)
+{
+  *first = 13;
+}
+
+void TestSegmentedSortDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+  thrust::device_vector<int> offsets(2);
+
+  thrust::segmented_sort(
+    thrust::retag<my_tag>(vec.begin()), offsets.begin(), offsets.begin() + 1, offsets.begin() + 1);
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestSegmentedSortDispatchImplicit);
+
+template <class Vector>
+void TestSegmentedSortSimple()
+{
+  using T = typename Vector::value_type;
+
+  Vector keys{3, 1, 2, 9, 7, 8, 6, 5};
+  thrust::device_vector<int> offsets{0, 3, 4, 8};
+
+  thrust::segmented_sort(keys.begin(), offsets.begin(), offsets.end() - 1, offsets.begin() + 1);
+
+  Vector ref{1, 2, 3, 9, 5, 6, 7, 8};
+  ASSERT_EQUAL(ref, keys);
+
+  thrust::segmented_stable_sort(
+    keys.begin(), offsets.begin(), offsets.end() - 1, offsets.begin() + 1, ::cuda::std::greater<T>());
+
+  ref = {3, 2, 1, 9, 8, 7, 6, 5};
+  ASSERT_EQUAL(ref, keys);
+}
+DECLARE_VECTOR_UNITTEST(TestSegmentedSortSimple);
+
+template <class Vector>
+void TestSegmentedSortGapsAndEmptySegments()
+{
+  Vector keys{9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+
+  // [1, 4), an empty segment, [6, 9) and a segment whose end precedes its begin. 0, 4, 5 and 9 are in no segment.
+  thrust::device_vector<int> begin_offsets{1, 4, 6, 8};
+  thrust::device_vector<int> end_offsets{4, 4, 9, 2};
+
+  thrust::segmented_sort(keys.begin(), begin_offsets.begin(), begin_offsets.end(), end_offsets.begin());
+
+  Vector ref{9, 6, 7, 8, 5, 4, 1, 2, 3, 0};
+  ASSERT_EQUAL(ref, keys);
+}
+DECLARE_VECTOR_UNITTEST(TestSegmentedSortGapsAndEmptySegments);
+
+// Adjacent segments of random sizes up to max_size, with every seventh one empty, that cover exactly n elements
+inline thrust::host_vector<int> random_segment_offsets(const size_t n, const size_t max_size)
+{
+  thrust::host_vector<int> offsets{0};
+  thrust::host_vector<unsigned int> sizes = unittest::random_integers<unsigned int>(n + 1);
+
+  for (size_t i = 0, covered = 0; covered < n; ++i)
+  {
+    const size_t size = i % 7 == 0 ? 0 : 1 + sizes[i % sizes.size()] % max_size;
+    covered           = (std::min) (n, covered + size);
+    offsets.push_back(static_cast<int>(covered));
+  }
+  return offsets;
+}
+
+template <typename T, typename StrictWeakOrdering>
+void segmented_sort_reference(
+  thrust::host_vector<T>& keys, const thrust::host_vector<int>& offsets, StrictWeakOrdering comp)
+{
+  for (size_t i = 0; i + 1 < offsets.size(); ++i)
+  {
+    thrust::stable_sort(keys.begin() + offsets[i], keys.begin() + offsets[i + 1], comp);
+  }
+}
+
+template <typename T>
+struct TestSegmentedSort
+{
+  void operator()(const size_t n)
+  {
+    for (size_t max_size : {size_t{1}, size_t{10}, size_t{1000}})
+    {
+      const thrust::host_vector<int> h_offsets   = random_segment_offsets(n, max_size);
+      const thrust::device_vector<int> d_offsets = h_offsets;
+
+      thrust::host_vector<T> h_keys   = unittest::random_integers<T>(n);
+      thrust::device_vector<T> d_keys = h_keys;
+
+      segmented_sort_reference(h_keys, h_offsets, ::cuda::std::less<T>());
+      thrust::segmented_sort(d_keys.begin(), d_offsets.begin(), d_offsets.end() - 1, d_offsets.begin() + 1);
+
+      ASSERT_EQUAL(h_keys, d_keys);
+    }
+  }
+};
+VariableUnitTest<TestSegmentedSort, IntegralTypes> TestSegmentedSortInstance;
+
+template <typename T>
+struct less_div_10
+{
+  _CCCL_HOST_DEVICE bool operator()(const T& lhs, const T& rhs) const
+  {
+    return lhs / 10 < rhs / 10;
+  }
+};
+
+template <typename T>
+struct TestSegmentedStableSort
+{
+  void operator()(const size_t n)
+  {
+    const thrust::host_vector<int> h_offsets   = random_segment_offsets(n, 100);
+    const thrust::device_vector<int> d_offsets = h_offsets;
+
+    thrust::host_vector<T> h_keys   = unittest::random_integers<T>(n);
+    thrust::device_vector<T> d_keys = h_keys;
+
+    segmented_sort_reference(h_keys, h_offsets, less_div_10<T>());
+    thrust::segmented_stable_sort(
+      d_keys.begin(), d_offsets.begin(), d_offsets.end() - 1, d_offsets.begin() + 1, less_div_10<T>());
+
+    ASSERT_EQUAL(h_keys, d_keys);
+  }
+};
+VariableUnitTest<TestSegmentedStableSort, IntegralTypes> TestSegmentedStableSortInstance;
+
+void TestSegmentedSortMixedSegmentSizes()
+{
+  // Many tiny segments around a few segments that are large enough to be sorted by all threads
+  thrust::host_vector<int> h_offsets{0};
+  for (int size : {3, 1 << 17, 0, 5, 1 << 16, 2, 70000})
+  {
+    for (int i = 0; i < 1000; ++i)
+    {
+      h_offsets.push_back(h_offsets.back() + i % 9);
+    }
+    h_offsets.push_back(h_offsets.back() + size);
+  }
+  const thrust::device_vector<int> d_offsets = h_offsets;
+
+  thrust::host_vector<int> h_keys   = unittest::random_integers<int>(h_offsets.back());
+  thrust::device_vector<int> d_keys = h_keys;
+
+  segmented_sort_reference(h_keys, h_offsets, less_div_10<int>());
+  thrust::segmented_stable_sort(
+    d_keys.begin(), d_offsets.begin(), d_offsets.end() - 1, d_offsets.begin() + 1, less_div_10<int>());
+  ASSERT_EQUAL(h_keys, d_keys);
+
+  segmented_sort_reference(h_keys, h_offsets, ::cuda::std::greater<int>());
+  thrust::segmented_sort(
+    d_keys.begin(), d_offsets.begin(), d_offsets.end() - 1, d_offsets.begin() + 1, ::cuda::std::greater<int>());
+  ASSERT_EQUAL(h_keys, d_keys);
+}
+DECLARE_UNITTEST(TestSegmentedSortMixedSegmentSizes);
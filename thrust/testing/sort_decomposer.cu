@@ -0,0 +1,218 @@
+#include <thrust/decomposer.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <cuda/std/cmath>
+#include <cuda/std/limits>
+#include <cuda/std/tuple>
+
+#include <algorithm>
+
+#include <unittest/unittest.h>
+
+struct order_row
+{
+  int group;
+  double score;
+  unsigned short rank;
+  int id;
+};
+
+// ORDER BY group ASC, score DESC, rank ASC
+struct order_row_decomposer
+{
+  _CCCL_HOST_DEVICE ::cuda::std::tuple<const int&, thrust::descending_field<double>, const unsigned short&>
+  operator()(const order_row& r) const
+  {
+    return {r.group, thrust::make_descending_field(r.score), r.rank};
+  }
+};
+
+struct float_decomposer
+{
+  _CCCL_HOST_DEVICE ::cuda::std::tuple<float> operator()(float x) const
+  {
+    return {x};
+  }
+};
+
+struct pair_decomposer
+{
+  _CCCL_HOST_DEVICE ::cuda::std::tuple<const signed char&, const long long&>
+  operator()(const ::cuda::std::pair<signed char, long long>& p) const
+  {
+    return {p.first, p.second};
+  }
+};
+
+thrust::host_vector<order_row> random_order_rows(const size_t n)
+{
+  thrust::host_vector<unsigned int> bits = unittest::random_integers<unsigned int>(3 * n);
+  thrust::host_vector<order_row> rows(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    rows[i].group = static_cast<int>(bits[3 * i] % 7) - 3;
+    switch (bits[3 * i + 1] % 8)
+    {
+      case 0:
+        rows[i].score = ::cuda::std::numeric_limits<double>::quiet_NaN();
+        break;
+      case 1:
+        rows[i].score = -0.0;
+        break;
+      case 2:
+        rows[i].score = 0.0;
+        break;
+      default:
+        rows[i].score = static_cast<double>(static_cast<int>(bits[3 * i + 1] % 9) - 4) / 3;
+        break;
+    }
+    rows[i].rank = static_cast<unsigned short>(bits[3 * i + 2] % 5);
+    rows[i].id   = static_cast<int>(i);
+  }
+  return rows;
+}
+
+template <typename Compare>
+thrust::host_vector<int> ids_of_sorted_order_rows(thrust::host_vector<order_row> rows, Compare comp)
+{
+  std::stable_sort(rows.begin(), rows.end(), comp);
+
+  thrust::host_vector<int> ids(rows.size());
+  for (size_t i = 0; i < rows.size(); ++i)
+  {
+    ids[i] = rows[i].id;
+  }
+  return ids;
+}
+
+template <typename Vector>
+thrust::host_vector<int> ids_of(const Vector& rows)
+{
+  thrust::host_vector<order_row> h_rows = rows;
+
+  thrust::host_vector<int> ids(h_rows.size());
+  for (size_t i = 0; i < h_rows.size(); ++i)
+  {
+    ids[i] = h_rows[i].id;
+  }
+  return ids;
+}
+
+void TestDecomposedLessSimple()
+{
+  const thrust::decomposed_less<order_row_decomposer> less{};
+  const double nan = ::cuda::std::numeric_limits<double>::quiet_NaN();
+
+  ASSERT_EQUAL(less(order_row{0, 1.0, 0, 0}, order_row{1, 2.0, 0, 0}), true);
+  ASSERT_EQUAL(less(order_row{1, 1.0, 0, 0}, order_row{1, 2.0, 0, 0}), false);
+  ASSERT_EQUAL(less(order_row{1, 2.0, 0, 0}, order_row{1, 1.0, 0, 0}), true);
+  ASSERT_EQUAL(less(order_row{1, 1.0, 0, 0}, order_row{1, 1.0, 1, 0}), true);
+  ASSERT_EQUAL(less(order_row{1, 1.0, 0, 0}, order_row{1, 1.0, 0, 1}), false);
+
+  // NaNs go after all numbers, which in descending order is before them
+  ASSERT_EQUAL(less(order_row{0, nan, 0, 0}, order_row{0, 1.0, 0, 0}), true);
+  ASSERT_EQUAL(less(order_row{0, nan, 0, 0}, order_row{0, nan, 0, 0}), false);
+  ASSERT_EQUAL(less(order_row{0, -0.0, 0, 0}, order_row{0, 0.0, 0, 0}), false);
+  ASSERT_EQUAL(less(order_row{0, 0.0, 0, 0}, order_row{0, -0.0, 0, 0}), false);
+
+  const thrust::decomposed_greater<order_row_decomposer> greater{};
+  ASSERT_EQUAL(greater(order_row{1, 2.0, 0, 0}, order_row{0, 1.0, 0, 0}), true);
+  ASSERT_EQUAL(greater(order_row{1, 1.0, 0, 0}, order_row{1, 2.0, 0, 0}), true);
+  ASSERT_EQUAL(greater(order_row{1, 1.0, 0, 0}, order_row{1, 1.0, 0, 0}), false);
+}
+DECLARE_UNITTEST(TestDecomposedLessSimple);
+
+void TestSortDecomposedLess(const size_t n)
+{
+  thrust::host_vector<order_row> h_rows = random_order_rows(n);
+  const auto ref = ids_of_sorted_order_rows(h_rows, thrust::decomposed_less<order_row_decomposer>());
+
+  thrust::device_vector<order_row> d_rows = h_rows;
+  thrust::stable_sort(h_rows.begin(), h_rows.end(), thrust::decomposed_less<order_row_decomposer>());
+  thrust::stable_sort(d_rows.begin(), d_rows.end(), thrust::decomposed_less<order_row_decomposer>());
+
+  ASSERT_EQUAL(ids_of(h_rows), ref);
+  ASSERT_EQUAL(ids_of(d_rows), ref);
+}
+DECLARE_SIZED_UNITTEST(TestSortDecomposedLess);
+
+void TestSortDecomposedGreater(const size_t n)
+{
+  thrust::host_vector<order_row> h_rows = random_order_rows(n);
+  const auto ref = ids_of_sorted_order_rows(h_rows, thrust::decomposed_greater<order_row_decomposer>());
+
+  thrust::device_vector<order_row> d_rows = h_rows;
+  thrust::stable_sort(h_rows.begin(), h_rows.end(), thrust::decomposed_greater<order_row_decomposer>());
+  thrust::stable_sort(d_rows.begin(), d_rows.end(), thrust::decomposed_greater<order_row_decomposer>());
+
+  ASSERT_EQUAL(ids_of(h_rows), ref);
+  ASSERT_EQUAL(ids_of(d_rows), ref);
+}
+DECLARE_SIZED_UNITTEST(TestSortDecomposedGreater);
+
+void TestSortByKeyDecomposedLess(const size_t n)
+{
+  thrust::host_vector<order_row> h_rows = random_order_rows(n);
+  const auto ref = ids_of_sorted_order_rows(h_rows, thrust::decomposed_less<order_row_decomposer>());
+
+  thrust::device_vector<order_row> d_rows = h_rows;
+  thrust::device_vector<int> d_values(n);
+  thrust::sequence(d_values.begin(), d_values.end());
+
+  thrust::sort_by_key(d_rows.begin(), d_rows.end(), d_values.begin(), thrust::decomposed_less<order_row_decomposer>());
+
+  ASSERT_EQUAL(ids_of(d_rows), ref);
+  ASSERT_EQUAL(d_values, ref);
+}
+DECLARE_SIZED_UNITTEST(TestSortByKeyDecomposedLess);
+
+void TestSortDecomposedFloats()
+{
+  const float inf = ::cuda::std::numeric_limits<float>::infinity();
+  const float nan = ::cuda::std::numeric_limits<float>::quiet_NaN();
+
+  // Long enough to be radix sorted by the host backends
+  const float pattern[8] = {nan, 1.0f, -inf, -0.0f, 2.5f, inf, -nan, -2.0f};
+  thrust::host_vector<float> h_data(1024);
+  for (size_t i = 0; i < h_data.size(); ++i)
+  {
+    h_data[i] = pattern[i % 8];
+  }
+  thrust::device_vector<float> d_data = h_data;
+
+  thrust::sort(d_data.begin(), d_data.end(), thrust::decomposed_less<float_decomposer>());
+
+  h_data = d_data;
+  ASSERT_EQUAL(h_data[0], -inf);
+  ASSERT_EQUAL(h_data[128], -2.0f);
+  ASSERT_EQUAL(h_data[256], 0.0f);
+  ASSERT_EQUAL(h_data[384], 1.0f);
+  ASSERT_EQUAL(h_data[512], 2.5f);
+  ASSERT_EQUAL(h_data[640], inf);
+  for (size_t i = 768; i < h_data.size(); ++i)
+  {
+    ASSERT_EQUAL(::cuda::std::isnan(h_data[i]), true);
+  }
+}
+DECLARE_UNITTEST(TestSortDecomposedFloats);
+
+void TestSortDecomposedPairs(const size_t n)
+{
+  using pair_type = ::cuda::std::pair<signed char, long long>;
+
+  thrust::host_vector<long long> bits = unittest::random_integers<long long>(n);
+  thrust::host_vector<pair_type> h_data(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    h_data[i] = pair_type(static_cast<signed char>(bits[i] >> 40), bits[i]);
+  }
+  thrust::device_vector<pair_type> d_data = h_data;
+
+  std::stable_sort(h_data.begin(), h_data.end());
+  thrust::sort(d_data.begin(), d_data.end(), thrust::decomposed_greater<pair_decomposer>());
+
+  std::reverse(h_data.begin(), h_data.end());
+  ASSERT_EQUAL(d_data == h_data, true);
+}
+DECLARE_SIZED_UNITTEST(TestSortDecomposedPairs);
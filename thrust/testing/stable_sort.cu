@@ -2,6 +2,8 @@
 #include <thrust/iterator/retag.h>
 #include <thrust/sort.h>
 
+#include <algorithm>
+
 #include <unittest/unittest.h>
 
 template <typename RandomAccessIterator>
@@ -135,3 +137,36 @@ void TestStableSortWithIndirection()
   ASSERT_EQUAL(data, ref);
 }
 DECLARE_INTEGRAL_VECTOR_UNITTEST(TestStableSortWithIndirection);
+
+void TestStableSortPresortedRuns(const size_t n)
+{
+  // Ascending, descending and nearly sorted runs of keys, with many equivalent elements
+  thrust::host_vector<int> h_data(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    const int k = static_cast<int>(i);
+    switch (3 * i / (n + 1))
+    {
+      case 0:
+        h_data[i] = k;
+        break;
+      case 1:
+        h_data[i] = static_cast<int>(n) - k;
+        break;
+      default:
+        h_data[i] = (i % 97 == 0) ? k / 2 : k;
+        break;
+    }
+  }
+
+  thrust::host_vector<int> h_ref = h_data;
+  std::stable_sort(h_ref.begin(), h_ref.end(), less_div_10<int>());
+
+  thrust::device_vector<int> d_data = h_data;
+  thrust::stable_sort(h_data.begin(), h_data.end(), less_div_10<int>());
+  thrust::stable_sort(d_data.begin(), d_data.end(), less_div_10<int>());
+
+  ASSERT_EQUAL(h_data, h_ref);
+  ASSERT_EQUAL(d_data, h_ref);
+}
+DECLARE_SIZED_UNITTEST(TestStableSortPresortedRuns);
@@ -1,5 +1,6 @@
 #include <thrust/functional.h>
 #include <thrust/iterator/retag.h>
+#include <thrust/sequence.h>
 #include <thrust/sort.h>
 
 #include <unittest/unittest.h>
@@ -120,3 +121,37 @@ struct TestStableSortByKeySemantics
 VariableUnitTest<TestStableSortByKeySemantics,
                  unittest::type_list<unittest::uint8_t, unittest::uint16_t, unittest::uint32_t>>
   TestStableSortByKeySemanticsInstance;
+
+void TestStableSortByKeyReversedRuns(const size_t n)
+{
+  // Descending runs of keys, each of which repeats every key ten times
+  thrust::host_vector<int> h_keys(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    h_keys[i] = static_cast<int>((i / 1000) * 1000 + 999 - i % 1000);
+  }
+  thrust::device_vector<int> d_keys = h_keys;
+
+  thrust::device_vector<int> d_values(n);
+  thrust::sequence(d_values.begin(), d_values.end());
+
+  thrust::stable_sort_by_key(d_keys.begin(), d_keys.end(), d_values.begin(), less_div_10<int>());
+
+  // Equivalent keys keep the order of their values
+  thrust::host_vector<int> h_sorted_keys   = d_keys;
+  thrust::host_vector<int> h_sorted_values = d_values;
+  for (size_t i = 0; i < n; ++i)
+  {
+    const size_t j = static_cast<size_t>(h_sorted_values[i]);
+    ASSERT_EQUAL(h_sorted_keys[i], h_keys[j]);
+    if (i > 0)
+    {
+      ASSERT_EQUAL(less_div_10<int>()(h_sorted_keys[i], h_sorted_keys[i - 1]), false);
+      if (!less_div_10<int>()(h_sorted_keys[i - 1], h_sorted_keys[i]))
+      {
+        ASSERT_EQUAL(h_sorted_values[i - 1] < h_sorted_values[i], true);
+      }
+    }
+  }
+}
+DECLARE_SIZED_UNITTEST(TestStableSortByKeyReversedRuns);
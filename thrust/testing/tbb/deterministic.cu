@@ -0,0 +1,127 @@
+#include <thrust/execution_policy.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+
+#include <cuda/__execution/determinism.h>
+#include <cuda/__execution/require.h>
+
+#include <unittest/unittest.h>
+
+#include <tbb/task_arena.h>
+
+namespace
+{
+auto deterministic_policy()
+{
+  return thrust::tbb::par(cuda::execution::require(cuda::execution::determinism::run_to_run));
+}
+
+// Values whose sums are rounded, so that the results depend on the order of the operations
+template <typename T>
+thrust::host_vector<T> fractional_samples(const size_t n)
+{
+  thrust::host_vector<T> vec(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    vec[i] = T{1} / static_cast<T>(1 + i % 97);
+  }
+  return vec;
+}
+
+// Runs f on at most num_threads TBB threads
+template <typename F>
+void with_num_threads(int num_threads, F f)
+{
+  ::tbb::task_arena arena(num_threads);
+  arena.execute(f);
+}
+} // namespace
+
+template <typename T>
+struct TestTbbDeterministicReduce
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> input = fractional_samples<T>(n);
+
+    T expected{};
+    with_num_threads(1, [&] {
+      expected = thrust::reduce(deterministic_policy(), input.begin(), input.end(), T{1});
+    });
+
+    for (int num_threads : {2, 3, 8})
+    {
+      T result{};
+      with_num_threads(num_threads, [&] {
+        result = thrust::reduce(deterministic_policy(), input.begin(), input.end(), T{1});
+      });
+      ASSERT_EQUAL_QUIET(expected, result);
+    }
+
+    // Sums of small integers are exact
+    input = unittest::random_samples<T>(n);
+    ASSERT_EQUAL(thrust::reduce(thrust::host, input.begin(), input.end(), T{1}),
+                 thrust::reduce(deterministic_policy(), input.begin(), input.end(), T{1}));
+  }
+};
+VariableUnitTest<TestTbbDeterministicReduce, FloatingPointTypes> TestTbbDeterministicReduceInstance;
+
+template <typename T>
+struct TestTbbDeterministicScan
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> input = fractional_samples<T>(n);
+    thrust::host_vector<T> expected_inclusive(n);
+    thrust::host_vector<T> expected_exclusive(n);
+    thrust::host_vector<T> result(n);
+
+    with_num_threads(1, [&] {
+      thrust::inclusive_scan(deterministic_policy(), input.begin(), input.end(), expected_inclusive.begin());
+      thrust::exclusive_scan(deterministic_policy(), input.begin(), input.end(), expected_exclusive.begin(), T{1});
+    });
+
+    for (int num_threads : {2, 3, 8})
+    {
+      with_num_threads(num_threads, [&] {
+        thrust::inclusive_scan(deterministic_policy(), input.begin(), input.end(), result.begin());
+      });
+      ASSERT_EQUAL_QUIET(expected_inclusive, result);
+
+      with_num_threads(num_threads, [&] {
+        thrust::exclusive_scan(deterministic_policy(), input.begin(), input.end(), result.begin(), T{1});
+      });
+      ASSERT_EQUAL_QUIET(expected_exclusive, result);
+    }
+
+    input = unittest::random_samples<T>(n);
+    thrust::inclusive_scan(thrust::host, input.begin(), input.end(), expected_inclusive.begin());
+    thrust::inclusive_scan(deterministic_policy(), input.begin(), input.end(), result.begin());
+    ASSERT_EQUAL(expected_inclusive, result);
+
+    thrust::exclusive_scan(thrust::host, input.begin(), input.end(), expected_exclusive.begin(), T{1});
+    thrust::exclusive_scan(deterministic_policy(), input.begin(), input.end(), result.begin(), T{1});
+    ASSERT_EQUAL(expected_exclusive, result);
+  }
+};
+VariableUnitTest<TestTbbDeterministicScan, FloatingPointTypes> TestTbbDeterministicScanInstance;
+
+void TestTbbDeterministicScanWithInit()
+{
+  const size_t n = 100000;
+
+  thrust::host_vector<double> input = fractional_samples<double>(n);
+  thrust::host_vector<double> expected(n);
+  thrust::host_vector<double> result(n);
+
+  with_num_threads(1, [&] {
+    thrust::inclusive_scan(deterministic_policy(), input.begin(), input.end(), expected.begin(), 0.5, thrust::plus<>{});
+  });
+
+  with_num_threads(4, [&] {
+    thrust::inclusive_scan(deterministic_policy(), input.begin(), input.end(), result.begin(), 0.5, thrust::plus<>{});
+  });
+
+  ASSERT_EQUAL_QUIET(expected, result);
+}
+DECLARE_UNITTEST(TestTbbDeterministicScanWithInit);
@@ -0,0 +1,220 @@
+#include <thrust/iterator/retag.h>
+#include <thrust/three_way_partition.h>
+
+#include <cuda/std/limits>
+
+#include <unittest/unittest.h>
+
+template <typename ForwardIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename OutputIterator3,
+          typename Predicate1,
+          typename Predicate2>
+cuda::std::tuple<OutputIterator1, OutputIterator2, OutputIterator3> three_way_partition(
+  my_system& system,
+  ForwardIterator,
+  ForwardIterator,
+  OutputIterator1 first_part_out,
+  OutputIterator2 second_part_out,
+  OutputIterator3 unselected_out,
+  Predicate1,
+  Predicate2)
+{
+  system.validate_dispatch();
+  return {first_part_out, second_part_out, unselected_out};
+}
+
+void TestThreeWayPartitionDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::three_way_partition(sys, vec.begin(), vec.begin(), vec.begin(), vec.begin(), vec.begin(), 0, 0);
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestThreeWayPartitionDispatchExplicit);
+
+template <typename ForwardIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename OutputIterator3,
+          typename Predicate1,
+          typename Predicate2>
+cuda::std::tuple<OutputIterator1, OutputIterator2, OutputIterator3> three_way_partition(
+  my_tag,
+  ForwardIterator,
+  ForwardIterator,
+  OutputIterator1 first_part_out,
+  OutputIterator2 second_part_out,
+  OutputIterator3 unselected_out,
+  Predicate1,
+  Predicate2)
+{
+  *first_part_out = 13;
+  return {first_part_out, second_part_out, unselected_out};
+}
+
+void TestThreeWayPartitionDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::three_way_partition(
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()),
+    0,
+    0);
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestThreeWayPartitionDispatchImplicit);
+
+template <typename T>
+struct less_than_pivot
+{
+  T pivot;
+
+  _CCCL_HOST_DEVICE bool operator()(const T& x) const
+  {
+    return x < pivot;
+  }
+};
+
+template <typename T>
+struct greater_than_pivot
+{
+  T pivot;
+
+  _CCCL_HOST_DEVICE bool operator()(const T& x) const
+  {
+    return x > pivot;
+  }
+};
+
+template <class Vector>
+void TestThreeWayPartitionSimple()
+{
+  using T = typename Vector::value_type;
+
+  Vector data{5, 9, 1, 3, 8, 2, 7, 4, 10, 6};
+  Vector small(10);
+  Vector large(10);
+  Vector middle(10);
+
+  const auto ends = thrust::three_way_partition(
+    data.begin(),
+    data.end(),
+    small.begin(),
+    large.begin(),
+    middle.begin(),
+    less_than_pivot<T>{T(3)},
+    greater_than_pivot<T>{T(7)});
+
+  ASSERT_EQUAL(2, cuda::std::get<0>(ends) - small.begin());
+  ASSERT_EQUAL(3, cuda::std::get<1>(ends) - large.begin());
+  ASSERT_EQUAL(5, cuda::std::get<2>(ends) - middle.begin());
+
+  small.resize(2);
+  large.resize(3);
+  middle.resize(5);
+  Vector small_ref{1, 2};
+  Vector large_ref{9, 8, 10};
+  Vector middle_ref{5, 3, 7, 4, 6};
+  ASSERT_EQUAL(small_ref, small);
+  ASSERT_EQUAL(large_ref, large);
+  ASSERT_EQUAL(middle_ref, middle);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestThreeWayPartitionSimple);
+
+void TestThreeWayPartitionOverlappingPredicates()
+{
+  // Elements selected by both predicates belong to the first part
+  thrust::device_vector<int> data{1, 6, 3, 8, 5, 2};
+  thrust::device_vector<int> first_part(6);
+  thrust::device_vector<int> second_part(6);
+  thrust::device_vector<int> unselected(6);
+
+  const auto ends = thrust::three_way_partition(
+    data.begin(),
+    data.end(),
+    first_part.begin(),
+    second_part.begin(),
+    unselected.begin(),
+    less_than_pivot<int>{4},
+    less_than_pivot<int>{7});
+
+  first_part.resize(cuda::std::get<0>(ends) - first_part.begin());
+  second_part.resize(cuda::std::get<1>(ends) - second_part.begin());
+  unselected.resize(cuda::std::get<2>(ends) - unselected.begin());
+
+  thrust::device_vector<int> first_part_ref{1, 3, 2};
+  thrust::device_vector<int> second_part_ref{6, 5};
+  thrust::device_vector<int> unselected_ref{8};
+  ASSERT_EQUAL(first_part_ref, first_part);
+  ASSERT_EQUAL(second_part_ref, second_part);
+  ASSERT_EQUAL(unselected_ref, unselected);
+}
+DECLARE_UNITTEST(TestThreeWayPartitionOverlappingPredicates);
+
+template <typename T>
+struct TestThreeWayPartition
+{
+  void operator()(const size_t n)
+  {
+    const thrust::host_vector<T> h_data   = unittest::random_integers<T>(n);
+    const thrust::device_vector<T> d_data = h_data;
+
+    // Split around the thirds of the value range
+    const T third = static_cast<T>(::cuda::std::numeric_limits<T>::max() / 3);
+    const T lower = static_cast<T>(::cuda::std::numeric_limits<T>::min() / 3 + third);
+    const T upper = static_cast<T>(lower + third);
+    const less_than_pivot<T> select_first_part{lower};
+    const greater_than_pivot<T> select_second_part{upper};
+
+    thrust::host_vector<T> h_first_part, h_second_part, h_unselected;
+    for (const T& x : h_data)
+    {
+      if (select_first_part(x))
+      {
+        h_first_part.push_back(x);
+      }
+      else if (select_second_part(x))
+      {
+        h_second_part.push_back(x);
+      }
+      else
+      {
+        h_unselected.push_back(x);
+      }
+    }
+
+    thrust::device_vector<T> d_first_part(n);
+    thrust::device_vector<T> d_second_part(n);
+    thrust::device_vector<T> d_unselected(n);
+
+    const auto ends = thrust::three_way_partition(
+      d_data.begin(),
+      d_data.end(),
+      d_first_part.begin(),
+      d_second_part.begin(),
+      d_unselected.begin(),
+      select_first_part,
+      select_second_part);
+
+    ASSERT_EQUAL(h_first_part.size(), static_cast<size_t>(cuda::std::get<0>(ends) - d_first_part.begin()));
+    ASSERT_EQUAL(h_second_part.size(), static_cast<size_t>(cuda::std::get<1>(ends) - d_second_part.begin()));
+    ASSERT_EQUAL(h_unselected.size(), static_cast<size_t>(cuda::std::get<2>(ends) - d_unselected.begin()));
+
+    d_first_part.resize(h_first_part.size());
+    d_second_part.resize(h_second_part.size());
+    d_unselected.resize(h_unselected.size());
+    ASSERT_EQUAL(h_first_part, d_first_part);
+    ASSERT_EQUAL(h_second_part, d_second_part);
+    ASSERT_EQUAL(h_unselected, d_unselected);
+  }
+};
+VariableUnitTest<TestThreeWayPartition, IntegralTypes> TestThreeWayPartitionInstance;
@@ -0,0 +1,283 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file decomposer.h
+ *  \brief Comparison operators which order keys by the arithmetic fields returned by a decomposer
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <cuda/std/__type_traits/is_arithmetic.h>
+#include <cuda/std/__type_traits/is_floating_point.h>
+#include <cuda/std/__type_traits/remove_cvref.h>
+#include <cuda/std/__utility/integer_sequence.h>
+#include <cuda/std/cmath>
+#include <cuda/std/tuple>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup function_objects Function Objects
+ */
+
+/*! \addtogroup predefined_function_objects Predefined Function Objects
+ *  \ingroup function_objects
+ */
+
+/*! \addtogroup comparison_operations Comparison Operations
+ *  \ingroup predefined_function_objects
+ *  \{
+ */
+
+/*! \p descending_field wraps a field returned by a decomposer, so that \p decomposed_less and \p decomposed_greater
+ *  order keys by it in the reverse direction.
+ *
+ *  \tparam T The arithmetic type of the field.
+ *
+ *  \see decomposed_less
+ *  \see make_descending_field
+ */
+template <typename T>
+struct descending_field
+{
+  /*! The value of the field.
+   */
+  T value;
+
+  /*! Constructs a \p descending_field from the value of a field.
+   *
+   *  \param x The value of the field.
+   */
+  _CCCL_HOST_DEVICE explicit descending_field(const T& x)
+      : value(x)
+  {}
+};
+
+/*! \p make_descending_field creates a \p descending_field from the value of a field.
+ *
+ *  \param value The value of the field.
+ *  \return A \p descending_field holding \p value.
+ */
+template <typename T>
+_CCCL_HOST_DEVICE descending_field<::cuda::std::remove_cvref_t<T>> make_descending_field(const T& value)
+{
+  return descending_field<::cuda::std::remove_cvref_t<T>>(value);
+}
+
+namespace detail::decomposer_detail
+{
+template <typename T>
+struct field_traits
+{
+  using type                       = ::cuda::std::remove_cvref_t<T>;
+  static constexpr bool descending = false;
+
+  _CCCL_HOST_DEVICE static const type& value(const type& x)
+  {
+    return x;
+  }
+};
+
+template <typename T>
+struct field_traits<descending_field<T>>
+{
+  using type                       = T;
+  static constexpr bool descending = true;
+
+  _CCCL_HOST_DEVICE static const type& value(const descending_field<T>& x)
+  {
+    return x.value;
+  }
+};
+
+template <typename T>
+struct field_traits<const T> : field_traits<T>
+{};
+
+template <typename T>
+struct field_traits<T&> : field_traits<T>
+{};
+
+template <typename T>
+struct field_traits<T&&> : field_traits<T>
+{};
+
+// Returns a negative, zero or positive number if x goes before, is equivalent to or goes after y. NaNs are equivalent
+// to each other and go after all numbers, and negative zero is equivalent to positive zero.
+template <typename T>
+_CCCL_HOST_DEVICE int compare_values(const T& x, const T& y)
+{
+  static_assert(::cuda::std::is_arithmetic_v<T>, "the fields returned by a decomposer must be arithmetic types");
+
+  if constexpr (::cuda::std::is_floating_point_v<T>)
+  {
+    const bool x_nan = ::cuda::std::isnan(x);
+    const bool y_nan = ::cuda::std::isnan(y);
+    if (x_nan || y_nan)
+    {
+      return static_cast<int>(x_nan) - static_cast<int>(y_nan);
+    }
+  }
+  return static_cast<int>(y < x) - static_cast<int>(x < y);
+}
+
+template <typename Field1, typename Field2>
+_CCCL_HOST_DEVICE int compare_fields(const Field1& x, const Field2& y)
+{
+  using traits1 = field_traits<Field1>;
+  using traits2 = field_traits<Field2>;
+  static_assert(traits1::descending == traits2::descending,
+                "a field must be ordered in the same direction for all keys");
+
+  using value_type = typename traits1::type;
+  if constexpr (traits1::descending)
+  {
+    return decomposer_detail::compare_values<value_type>(traits2::value(y), traits1::value(x));
+  }
+  else
+  {
+    return decomposer_detail::compare_values<value_type>(traits1::value(x), traits2::value(y));
+  }
+}
+
+// Compares tuples of fields lexicographically
+template <typename Tuple1, typename Tuple2, ::cuda::std::size_t... Is>
+_CCCL_HOST_DEVICE bool tuple_less(const Tuple1& x, const Tuple2& y, ::cuda::std::index_sequence<Is...>)
+{
+  int order = 0;
+  (void) (((order = decomposer_detail::compare_fields(::cuda::std::get<Is>(x), ::cuda::std::get<Is>(y))) != 0) || ...);
+  return order < 0;
+}
+
+template <typename Decomposer, typename Key1, typename Key2>
+_CCCL_HOST_DEVICE bool decomposed_less(const Decomposer& decomposer, const Key1& x, const Key2& y)
+{
+  using tuple_type = ::cuda::std::remove_cvref_t<decltype(decomposer(x))>;
+  return decomposer_detail::tuple_less(
+    decomposer(x), decomposer(y), ::cuda::std::make_index_sequence<::cuda::std::tuple_size_v<tuple_type>>{});
+}
+} // namespace detail::decomposer_detail
+
+/*! \p decomposed_less is a comparison operator which orders keys lexicographically by the fields that a decomposer
+ *  returns for them, like the decomposers of <tt>cub::DeviceRadixSort</tt>. The decomposer is invoked with a const
+ *  reference to a key, and returns a <tt>cuda::std::tuple</tt> of the values of, or references to, its arithmetic
+ *  fields, in order of significance. A field wrapped in \p descending_field is ordered in descending order.
+ *
+ *  Floating-point fields are totally ordered: NaNs are equivalent to each other and go after all numbers, and
+ *  negative zero is equivalent to positive zero.
+ *
+ *  Besides ordering keys for any algorithm, \p decomposed_less allows the CPP, OMP and TBB backends of \p sort, \p
+ *  stable_sort, \p sort_by_key and \p stable_sort_by_key to sort keys with a radix sort over their fields rather than
+ *  with a merge sort, if all fields are integral or floating-point types of 1, 2, 4 or 8 bytes.
+ *
+ *  The following code snippet demonstrates how to sort records by their first field in ascending order and then by
+ *  their second field in descending order:
+ *
+ *  \code
+ *  #include <thrust/decomposer.h>
+ *  #include <thrust/sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  struct record
+ *  {
+ *    int group;
+ *    float score;
+ *  };
+ *
+ *  struct record_decomposer
+ *  {
+ *    __host__ __device__ cuda::std::tuple<const int&, thrust::descending_field<float>>
+ *    operator()(const record& r) const
+ *    {
+ *      return {r.group, thrust::make_descending_field(r.score)};
+ *    }
+ *  };
+ *  ...
+ *  record data[4] = {{1, 0.5f}, {0, 1.0f}, {1, 2.0f}, {0, 3.0f}};
+ *  thrust::sort(thrust::host, data, data + 4, thrust::decomposed_less<record_decomposer>());
+ *  // data is now {{0, 3.0f}, {0, 1.0f}, {1, 2.0f}, {1, 0.5f}}
+ *  \endcode
+ *
+ *  \tparam Decomposer The type of the function object which maps a key to a tuple of its fields.
+ *
+ *  \see decomposed_greater
+ *  \see descending_field
+ *  \see https://nvidia.github.io/cccl/cub/api/structcub_1_1DeviceRadixSort.html
+ */
+template <typename Decomposer>
+struct decomposed_less
+{
+  /*! The function object which maps a key to a tuple of its fields.
+   */
+  Decomposer decomposer;
+
+  /*! Constructs a \p decomposed_less with a default constructed decomposer.
+   */
+  decomposed_less() = default;
+
+  /*! Constructs a \p decomposed_less from a decomposer.
+   *
+   *  \param d The function object which maps a key to a tuple of its fields.
+   */
+  _CCCL_HOST_DEVICE explicit decomposed_less(Decomposer d)
+      : decomposer(d)
+  {}
+
+  /*! \return \c true if \p x goes before \p y.
+   */
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename Key1, typename Key2>
+  _CCCL_HOST_DEVICE bool operator()(const Key1& x, const Key2& y) const
+  {
+    return detail::decomposer_detail::decomposed_less(decomposer, x, y);
+  }
+};
+
+/*! \p decomposed_greater is the reverse of \p decomposed_less: it orders keys lexicographically by the fields that a
+ *  decomposer returns for them, in descending order, and fields wrapped in \p descending_field in ascending order.
+ *
+ *  \tparam Decomposer The type of the function object which maps a key to a tuple of its fields.
+ *
+ *  \see decomposed_less
+ */
+template <typename Decomposer>
+struct decomposed_greater
+{
+  /*! The function object which maps a key to a tuple of its fields.
+   */
+  Decomposer decomposer;
+
+  /*! Constructs a \p decomposed_greater with a default constructed decomposer.
+   */
+  decomposed_greater() = default;
+
+  /*! Constructs a \p decomposed_greater from a decomposer.
+   *
+   *  \param d The function object which maps a key to a tuple of its fields.
+   */
+  _CCCL_HOST_DEVICE explicit decomposed_greater(Decomposer d)
+      : decomposer(d)
+  {}
+
+  /*! \return \c true if \p x goes after \p y.
+   */
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename Key1, typename Key2>
+  _CCCL_HOST_DEVICE bool operator()(const Key1& x, const Key2& y) const
+  {
+    return detail::decomposer_detail::decomposed_less(decomposer, y, x);
+  }
+};
+
+/*! \} // end comparison_operations
+ */
+
+THRUST_NAMESPACE_END
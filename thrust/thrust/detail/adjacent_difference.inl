@@ -13,6 +13,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/instrumentation.h>
 #include <thrust/system/detail/generic/select_system.h>
 
 // Include all active backend system implementations (generic, sequential, host and device)
@@ -40,6 +41,7 @@ _CCCL_HOST_DEVICE OutputIterator adjacent_difference(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::adjacent_difference");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::adjacent_difference", first, last);
   using thrust::system::detail::generic::adjacent_difference;
 
   return adjacent_difference(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
@@ -55,6 +57,7 @@ _CCCL_HOST_DEVICE OutputIterator adjacent_difference(
   BinaryFunction binary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::adjacent_difference");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::adjacent_difference", first, last);
   using thrust::system::detail::generic::adjacent_difference;
 
   return adjacent_difference(
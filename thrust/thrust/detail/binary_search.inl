@@ -13,6 +13,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/binary_search.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
 
@@ -41,6 +42,7 @@ _CCCL_HOST_DEVICE ForwardIterator lower_bound(
   const LessThanComparable& value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::lower_bound");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::lower_bound", first, last);
   using thrust::system::detail::generic::lower_bound;
   return lower_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 }
@@ -55,6 +57,7 @@ _CCCL_HOST_DEVICE ForwardIterator lower_bound(
   StrictWeakOrdering comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::lower_bound");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::lower_bound", first, last);
   using thrust::system::detail::generic::lower_bound;
   return lower_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value, comp);
 }
@@ -68,6 +71,7 @@ _CCCL_HOST_DEVICE ForwardIterator upper_bound(
   const LessThanComparable& value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::upper_bound");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::upper_bound", first, last);
   using thrust::system::detail::generic::upper_bound;
   return upper_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 }
@@ -82,6 +86,7 @@ _CCCL_HOST_DEVICE ForwardIterator upper_bound(
   StrictWeakOrdering comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::upper_bound");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::upper_bound", first, last);
   using thrust::system::detail::generic::upper_bound;
   return upper_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value, comp);
 }
@@ -95,6 +100,7 @@ _CCCL_HOST_DEVICE bool binary_search(
   const LessThanComparable& value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::binary_search");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::binary_search", first, last);
   using thrust::system::detail::generic::binary_search;
   return binary_search(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 }
@@ -109,6 +115,7 @@ _CCCL_HOST_DEVICE bool binary_search(
   StrictWeakOrdering comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::binary_search");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::binary_search", first, last);
   using thrust::system::detail::generic::binary_search;
   return binary_search(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value, comp);
 }
@@ -123,6 +130,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<ForwardIterator, ForwardIterator> equal_rang
   StrictWeakOrdering comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::equal_range");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::equal_range", first, last);
   using thrust::system::detail::generic::equal_range;
   return equal_range(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value, comp);
 }
@@ -136,6 +144,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<ForwardIterator, ForwardIterator> equal_rang
   const LessThanComparable& value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::equal_range");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::equal_range", first, last);
   using thrust::system::detail::generic::equal_range;
   return equal_range(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 }
@@ -151,6 +160,7 @@ _CCCL_HOST_DEVICE OutputIterator lower_bound(
   OutputIterator output)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::lower_bound");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::lower_bound", first, last);
   using thrust::system::detail::generic::lower_bound;
   return lower_bound(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output);
@@ -172,6 +182,7 @@ _CCCL_HOST_DEVICE OutputIterator lower_bound(
   StrictWeakOrdering comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::lower_bound");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::lower_bound", first, last);
   using thrust::system::detail::generic::lower_bound;
   return lower_bound(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -194,6 +205,7 @@ _CCCL_HOST_DEVICE OutputIterator upper_bound(
   OutputIterator output)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::upper_bound");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::upper_bound", first, last);
   using thrust::system::detail::generic::upper_bound;
   return upper_bound(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output);
@@ -215,6 +227,7 @@ _CCCL_HOST_DEVICE OutputIterator upper_bound(
   StrictWeakOrdering comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::upper_bound");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::upper_bound", first, last);
   using thrust::system::detail::generic::upper_bound;
   return upper_bound(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -237,6 +250,7 @@ _CCCL_HOST_DEVICE OutputIterator binary_search(
   OutputIterator output)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::binary_search");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::binary_search", first, last);
   using thrust::system::detail::generic::binary_search;
   return binary_search(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output);
@@ -258,6 +272,7 @@ _CCCL_HOST_DEVICE OutputIterator binary_search(
   StrictWeakOrdering comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::binary_search");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::binary_search", first, last);
   using thrust::system::detail::generic::binary_search;
   return binary_search(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
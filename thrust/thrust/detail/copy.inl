@@ -13,6 +13,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/copy.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/nvtx_policy.h>
 #include <thrust/system/detail/generic/select_system.h>
 
@@ -41,6 +42,7 @@ copy(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
      OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<DerivedPolicy>(), "thrust::copy");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::copy", first, last);
   using thrust::system::detail::generic::copy;
   return copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end copy()
@@ -51,6 +53,7 @@ _CCCL_HOST_DEVICE OutputIterator copy_n(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, Size n, OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<DerivedPolicy>(), "thrust::copy_n");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::copy_n", first, n);
   using thrust::system::detail::generic::copy_n;
   return copy_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, result);
 } // end copy_n()
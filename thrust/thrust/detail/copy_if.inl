@@ -13,6 +13,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/copy_if.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
 
@@ -42,6 +43,7 @@ _CCCL_HOST_DEVICE OutputIterator copy_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::copy_if");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::copy_if", first, last);
   using thrust::system::detail::generic::copy_if;
   return copy_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, pred);
 } // end copy_if()
@@ -61,6 +63,7 @@ _CCCL_HOST_DEVICE OutputIterator copy_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::copy_if");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::copy_if", first, last);
   using thrust::system::detail::generic::copy_if;
   return copy_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, result, pred);
 } // end copy_if()
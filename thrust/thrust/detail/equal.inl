@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/equal.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -41,6 +42,7 @@ equal(const thrust::detail::execution_policy_base<System>& system,
       InputIterator2 first2)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::equal");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(system, "thrust::equal", first1, last1);
   using thrust::system::detail::generic::equal;
   return equal(thrust::detail::derived_cast(thrust::detail::strip_const(system)), first1, last1, first2);
 } // end equal()
@@ -55,6 +57,7 @@ equal(const thrust::detail::execution_policy_base<System>& system,
       BinaryPredicate binary_pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::equal");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(system, "thrust::equal", first1, last1);
   using thrust::system::detail::generic::equal;
   return equal(thrust::detail::derived_cast(thrust::detail::strip_const(system)), first1, last1, first2, binary_pred);
 } // end equal()
@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__execution/determinism.h>
+#include <cuda/__execution/require.h>
+#include <cuda/std/__execution/env.h>
+#include <cuda/std/__type_traits/decay.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace detail
+{
+//! Execution policy of BaseSystem that carries the requirements passed to cuda::execution::require, e.g.
+//! `thrust::omp::par(cuda::execution::require(cuda::execution::determinism::run_to_run))`.
+//! Requirements are stateless, so they are only recorded in the type of the policy.
+template <typename Requirements, template <typename> class BaseSystem>
+struct execute_with_requirements : BaseSystem<execute_with_requirements<Requirements, BaseSystem>>
+{
+  using requirements_type = Requirements;
+
+  [[nodiscard]] _CCCL_HOST_DEVICE constexpr auto query(::cuda::execution::__get_requirements_t) const noexcept
+    -> Requirements
+  {
+    return Requirements{};
+  }
+};
+
+template <template <typename> class ExecutionPolicyCRTPBase>
+struct requirements_aware_execution_policy
+{
+  template <typename... Requirements>
+  using requirements_prop_t = ::cuda::std::execution::
+    prop<::cuda::execution::__get_requirements_t, ::cuda::std::execution::env<Requirements...>>;
+
+  template <typename... Requirements>
+  using execute_with_requirements_type =
+    execute_with_requirements<::cuda::std::execution::env<Requirements...>, ExecutionPolicyCRTPBase>;
+
+  // One overload per value category, so that these are preferred over the overloads taking allocators
+  template <typename... Requirements>
+  _CCCL_HOST_DEVICE execute_with_requirements_type<Requirements...>
+  operator()(const requirements_prop_t<Requirements...>&) const
+  {
+    return {};
+  }
+
+  template <typename... Requirements>
+  _CCCL_HOST_DEVICE execute_with_requirements_type<Requirements...>
+  operator()(requirements_prop_t<Requirements...>&) const
+  {
+    return {};
+  }
+
+  template <typename... Requirements>
+  _CCCL_HOST_DEVICE execute_with_requirements_type<Requirements...>
+  operator()(requirements_prop_t<Requirements...>&&) const
+  {
+    return {};
+  }
+};
+
+//! Determinism requested through cuda::execution::require for policies of type DerivedPolicy. Without a
+//! requirement, results are not guaranteed to be reproducible.
+template <typename DerivedPolicy>
+inline constexpr auto requested_determinism_v = ::cuda::execution::determinism::__determinism_t::__not_guaranteed;
+
+template <typename Requirements, template <typename> class BaseSystem>
+inline constexpr auto requested_determinism_v<execute_with_requirements<Requirements, BaseSystem>> =
+  ::cuda::std::execution::__query_result_or_t<Requirements,
+                                              ::cuda::execution::determinism::__get_determinism_t,
+                                              ::cuda::execution::determinism::not_guaranteed_t>::value;
+
+//! Whether the results for policies of type DerivedPolicy must not depend on the number of threads or on scheduling
+template <typename DerivedPolicy>
+inline constexpr bool requires_determinism_v =
+  requested_determinism_v<::cuda::std::decay_t<DerivedPolicy>>
+  != ::cuda::execution::determinism::__determinism_t::__not_guaranteed;
+} // namespace detail
+
+THRUST_NAMESPACE_END
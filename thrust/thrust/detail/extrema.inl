@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/extrema.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -38,6 +39,7 @@ _CCCL_HOST_DEVICE ForwardIterator min_element(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
   _CCCL_NVTX_RANGE_SCOPE("min_element");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::min_element", first, last);
   using thrust::system::detail::generic::min_element;
   return min_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end min_element()
@@ -51,6 +53,7 @@ _CCCL_HOST_DEVICE ForwardIterator min_element(
   BinaryPredicate comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("min_element");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::min_element", first, last);
   using thrust::system::detail::generic::min_element;
   return min_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end min_element()
@@ -61,6 +64,7 @@ _CCCL_HOST_DEVICE ForwardIterator max_element(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
   _CCCL_NVTX_RANGE_SCOPE("max_element");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::max_element", first, last);
   using thrust::system::detail::generic::max_element;
   return max_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end max_element()
@@ -74,6 +78,7 @@ _CCCL_HOST_DEVICE ForwardIterator max_element(
   BinaryPredicate comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("max_element");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::max_element", first, last);
   using thrust::system::detail::generic::max_element;
   return max_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end max_element()
@@ -84,6 +89,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<ForwardIterator, ForwardIterator> minmax_ele
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
   _CCCL_NVTX_RANGE_SCOPE("minmax_element");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::minmax_element", first, last);
   using thrust::system::detail::generic::minmax_element;
   return minmax_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end minmax_element()
@@ -97,6 +103,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<ForwardIterator, ForwardIterator> minmax_ele
   BinaryPredicate comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("minmax_element");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::minmax_element", first, last);
   using thrust::system::detail::generic::minmax_element;
   return minmax_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end minmax_element()
@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
 
@@ -40,6 +41,7 @@ find(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
      const T& value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::find");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::find", first, last);
   using thrust::system::detail::generic::find;
   return find(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 } // end find()
@@ -53,6 +55,7 @@ _CCCL_HOST_DEVICE InputIterator find_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::find_if");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::find_if", first, last);
   using thrust::system::detail::generic::find_if;
   return find_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end find_if()
@@ -66,6 +69,7 @@ _CCCL_HOST_DEVICE InputIterator find_if_not(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::find_if_not");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::find_if_not", first, last);
   using thrust::system::detail::generic::find_if_not;
   return find_if_not(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end find_if_not()
@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/nvtx_policy.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/iterator_traits.h>
@@ -42,6 +43,7 @@ _CCCL_HOST_DEVICE InputIterator for_each(
   UnaryFunction f)
 {
   _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<DerivedPolicy>(), "thrust::for_each");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::for_each", first, last);
   using thrust::system::detail::generic::for_each;
 
   return for_each(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, f);
@@ -64,6 +66,7 @@ _CCCL_HOST_DEVICE InputIterator for_each_n(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, Size n, UnaryFunction f)
 {
   _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<DerivedPolicy>(), "thrust::for_each_n");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::for_each_n", first, n);
   using thrust::system::detail::generic::for_each_n;
 
   return for_each_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, f);
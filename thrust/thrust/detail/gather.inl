@@ -13,6 +13,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/instrumentation.h>
 #include <thrust/gather.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -43,6 +44,7 @@ _CCCL_HOST_DEVICE OutputIterator gather(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::gather");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::gather", map_first, map_last);
   using thrust::system::detail::generic::gather;
   return gather(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), map_first, map_last, input_first, result);
@@ -63,6 +65,7 @@ _CCCL_HOST_DEVICE OutputIterator gather_if(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::gather_if");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::gather_if", map_first, map_last);
   using thrust::system::detail::generic::gather_if;
   return gather_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), map_first, map_last, stencil, input_first, result);
@@ -85,6 +88,7 @@ _CCCL_HOST_DEVICE OutputIterator gather_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::gather_if");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::gather_if", map_first, map_last);
   using thrust::system::detail::generic::gather_if;
   return gather_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -0,0 +1,220 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/instrumentation.h>
+#include <thrust/histogram.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+
+// Include all active backend system implementations (generic, sequential, host and device)
+#include <thrust/system/detail/generic/histogram.h>
+#include <thrust/system/detail/sequential/histogram.h>
+#include __THRUST_HOST_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(histogram.h)
+#include __THRUST_DEVICE_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(histogram.h)
+
+// Some build systems need a hint to know which files we could include
+#if 0
+#  include <thrust/system/cpp/detail/histogram.h>
+#  include <thrust/system/cuda/detail/histogram.h>
+#  include <thrust/system/omp/detail/histogram.h>
+#  include <thrust/system/tbb/detail/histogram.h>
+#endif
+
+THRUST_NAMESPACE_BEGIN
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename LevelT>
+_CCCL_HOST_DEVICE OutputIterator histogram_even(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  LevelT lower_level,
+  LevelT upper_level)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::histogram_even");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::histogram_even", first, last);
+  using thrust::system::detail::generic::histogram_even;
+  return histogram_even(thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+                        first,
+                        last,
+                        histogram,
+                        num_levels,
+                        lower_level,
+                        upper_level);
+} // end histogram_even()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename LevelIterator>
+_CCCL_HOST_DEVICE OutputIterator histogram_range(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  LevelIterator levels_first,
+  LevelIterator levels_last)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::histogram_range");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::histogram_range", first, last);
+  using thrust::system::detail::generic::histogram_range;
+  return histogram_range(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, histogram, levels_first, levels_last);
+} // end histogram_range()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <::cuda::std::size_t NumChannels,
+          ::cuda::std::size_t NumActiveChannels,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename LevelT>
+_CCCL_HOST_DEVICE void multi_histogram_even(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  const ::cuda::std::array<OutputIterator, NumActiveChannels>& histograms,
+  const ::cuda::std::array<int, NumActiveChannels>& num_levels,
+  const ::cuda::std::array<LevelT, NumActiveChannels>& lower_levels,
+  const ::cuda::std::array<LevelT, NumActiveChannels>& upper_levels)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::multi_histogram_even");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::multi_histogram_even", first, last);
+  using thrust::system::detail::generic::multi_histogram_even;
+  multi_histogram_even<NumChannels>(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    first,
+    last,
+    histograms,
+    num_levels,
+    lower_levels,
+    upper_levels);
+} // end multi_histogram_even()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <::cuda::std::size_t NumChannels,
+          ::cuda::std::size_t NumActiveChannels,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename LevelIterator>
+_CCCL_HOST_DEVICE void multi_histogram_range(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  const ::cuda::std::array<OutputIterator, NumActiveChannels>& histograms,
+  const ::cuda::std::array<int, NumActiveChannels>& num_levels,
+  const ::cuda::std::array<LevelIterator, NumActiveChannels>& levels)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::multi_histogram_range");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::multi_histogram_range", first, last);
+  using thrust::system::detail::generic::multi_histogram_range;
+  multi_histogram_range<NumChannels>(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, histograms, num_levels, levels);
+} // end multi_histogram_range()
+
+template <typename InputIterator, typename OutputIterator, typename LevelT>
+OutputIterator histogram_even(
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  LevelT lower_level,
+  LevelT upper_level)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::histogram_even");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::histogram_even(
+    select_system(system1, system2), first, last, histogram, num_levels, lower_level, upper_level);
+} // end histogram_even()
+
+template <typename InputIterator, typename OutputIterator, typename LevelIterator>
+OutputIterator histogram_range(
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  LevelIterator levels_first,
+  LevelIterator levels_last)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::histogram_range");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::histogram_range(select_system(system1, system2), first, last, histogram, levels_first, levels_last);
+} // end histogram_range()
+
+template <::cuda::std::size_t NumChannels,
+          ::cuda::std::size_t NumActiveChannels,
+          typename InputIterator,
+          typename OutputIterator,
+          typename LevelT>
+void multi_histogram_even(
+  InputIterator first,
+  InputIterator last,
+  const ::cuda::std::array<OutputIterator, NumActiveChannels>& histograms,
+  const ::cuda::std::array<int, NumActiveChannels>& num_levels,
+  const ::cuda::std::array<LevelT, NumActiveChannels>& lower_levels,
+  const ::cuda::std::array<LevelT, NumActiveChannels>& upper_levels)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::multi_histogram_even");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+
+  thrust::multi_histogram_even<NumChannels>(
+    select_system(system1, system2), first, last, histograms, num_levels, lower_levels, upper_levels);
+} // end multi_histogram_even()
+
+template <::cuda::std::size_t NumChannels,
+          ::cuda::std::size_t NumActiveChannels,
+          typename InputIterator,
+          typename OutputIterator,
+          typename LevelIterator>
+void multi_histogram_range(
+  InputIterator first,
+  InputIterator last,
+  const ::cuda::std::array<OutputIterator, NumActiveChannels>& histograms,
+  const ::cuda::std::array<int, NumActiveChannels>& num_levels,
+  const ::cuda::std::array<LevelIterator, NumActiveChannels>& levels)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::multi_histogram_range");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+
+  thrust::multi_histogram_range<NumChannels>(
+    select_system(system1, system2), first, last, histograms, num_levels, levels);
+} // end multi_histogram_range()
+
+THRUST_NAMESPACE_END
@@ -0,0 +1,229 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if defined(THRUST_ENABLE_HOST_INSTRUMENTATION) && _CCCL_HOST_COMPILATION()
+
+#  include <thrust/detail/execution_policy.h>
+#  include <thrust/instrumentation.h>
+#  include <thrust/iterator/iterator_traits.h>
+
+#  include <cuda/std/__type_traits/is_convertible.h>
+#  include <cuda/std/__type_traits/is_integral.h>
+#  include <cuda/std/__type_traits/is_void.h>
+
+#  include <chrono>
+#  include <cstddef>
+#  include <utility>
+
+#  include <nv/target>
+
+// Include all active backend system implementations (generic, host and device)
+#  include <thrust/system/detail/generic/instrumentation.h>
+#  include __THRUST_HOST_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(instrumentation.h)
+#  include __THRUST_DEVICE_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(instrumentation.h)
+
+// Some build systems need a hint to know which files we could include
+#  if 0
+#    include <thrust/system/cpp/detail/instrumentation.h>
+#    include <thrust/system/cuda/detail/instrumentation.h>
+#    include <thrust/system/omp/detail/instrumentation.h>
+#    include <thrust/system/tbb/detail/instrumentation.h>
+#  endif
+
+THRUST_NAMESPACE_BEGIN
+namespace detail::instrumentation
+{
+// The number of elements in [first, last) or [first, first + n), without traversing single-pass ranges
+template <typename Iterator, typename SizeOrIterator>
+std::size_t num_items(Iterator first, SizeOrIterator last_or_n)
+{
+  if constexpr (::cuda::std::is_integral_v<SizeOrIterator>)
+  {
+    return last_or_n > 0 ? static_cast<std::size_t>(last_or_n) : 0;
+  }
+  else if constexpr (::cuda::std::is_convertible_v<iterator_traversal_t<Iterator>, random_access_traversal_tag>)
+  {
+    const auto n = last_or_n - first;
+    return n > 0 ? static_cast<std::size_t>(n) : 0;
+  }
+  else
+  {
+    return 0;
+  }
+}
+
+template <typename Iterator>
+std::size_t item_size()
+{
+  using value_type = it_value_t<Iterator>;
+  if constexpr (::cuda::std::is_void_v<value_type>)
+  {
+    return 0;
+  }
+  else
+  {
+    return sizeof(value_type);
+  }
+}
+
+// Records an algorithm call of a host system from start() to the end of the enclosing scope, if a callback is
+// registered. The record is only started in host code, like the NVTX ranges of the algorithms.
+class host_call_scope
+{
+public:
+  host_call_scope() = default;
+
+  host_call_scope(const host_call_scope&)            = delete;
+  host_call_scope& operator=(const host_call_scope&) = delete;
+
+  template <typename DerivedPolicy, typename Iterator, typename SizeOrIterator>
+  _CCCL_HOST_API void start(const char* algorithm, DerivedPolicy& policy, Iterator first, SizeOrIterator last_or_n)
+  {
+    // A call which an overload of the same algorithm forwards to is part of the recorded call of that overload
+    if (std::exchange(internal_call_pending(), false))
+    {
+      return;
+    }
+
+    using thrust::system::detail::generic::instrumented_system;
+    const thrust::system::detail::generic::instrumented_system_info system = instrumented_system(policy);
+
+    if (system.name == nullptr || !thrust::instrumentation::detail::registry().enabled.load(std::memory_order_relaxed)
+        || thrust::instrumentation::detail::in_callback())
+    {
+      return;
+    }
+
+    m_record.algorithm    = algorithm;
+    m_record.system       = system.name;
+    m_record.num_items    = num_items(first, last_or_n);
+    m_record.input_bytes  = m_record.num_items * item_size<Iterator>();
+    m_record.threads      = 1;
+    m_record.max_threads  = system.max_threads;
+    m_record.depth        = current() != nullptr ? current()->m_record.depth + 1 : 0;
+    m_record.thread_index = thrust::instrumentation::detail::this_thread_index();
+
+    m_parent  = current();
+    current() = this;
+    m_engaged = true;
+
+    m_record.start = std::chrono::steady_clock::now();
+  }
+
+  _CCCL_API ~host_call_scope()
+  {
+    NV_IF_TARGET(NV_IS_HOST, ({
+                   if (m_engaged)
+                   {
+                     finish();
+                   }
+                 }));
+  }
+
+  // Marks the next call started on this thread as an implementation detail of the algorithm which is running
+  _CCCL_HOST_API static void note_internal_call()
+  {
+    internal_call_pending() = true;
+  }
+
+  // Notes that the innermost recorded call of this thread runs a parallel region on the given number of threads
+  _CCCL_HOST_API static void note_parallel_region(int threads)
+  {
+    if (host_call_scope* call = current(); call != nullptr && call->m_record.threads < threads)
+    {
+      call->m_record.threads = threads;
+    }
+  }
+
+  // Attributes temporary storage to the innermost recorded call of this thread, if any
+  _CCCL_HOST_API static void note_temporary_allocation(std::size_t bytes)
+  {
+    if (host_call_scope* call = current())
+    {
+      call->m_record.temporary_bytes += bytes;
+      ++call->m_record.temporary_allocations;
+    }
+  }
+
+private:
+  thrust::instrumentation::call_record m_record{};
+  host_call_scope* m_parent = nullptr;
+  bool m_engaged            = false;
+
+  _CCCL_HOST_API static host_call_scope*& current()
+  {
+    thread_local host_call_scope* call = nullptr;
+    return call;
+  }
+
+  _CCCL_HOST_API static bool& internal_call_pending()
+  {
+    thread_local bool pending = false;
+    return pending;
+  }
+
+  _CCCL_HOST_API void finish()
+  {
+    m_record.wall_time = std::chrono::steady_clock::now() - m_record.start;
+
+    current() = m_parent;
+    if (m_parent != nullptr)
+    {
+      m_parent->m_record.temporary_bytes += m_record.temporary_bytes;
+      m_parent->m_record.temporary_allocations += m_record.temporary_allocations;
+      if (m_parent->m_record.threads < m_record.threads)
+      {
+        m_parent->m_record.threads = m_record.threads;
+      }
+    }
+
+    thrust::instrumentation::detail::invoke_callback(m_record);
+  }
+};
+} // namespace detail::instrumentation
+THRUST_NAMESPACE_END
+
+// Records the call of the enclosing algorithm, whose first input sequence is [first, last_or_n) or
+// [first, first + last_or_n), if exec is a policy of the cpp, omp or tbb system
+#  define _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, algorithm, first, last_or_n)            \
+    ::thrust::detail::instrumentation::host_call_scope __thrust_host_call_scope;            \
+    NV_IF_TARGET(NV_IS_HOST,                                                                \
+                 (__thrust_host_call_scope.start(                                           \
+                    algorithm,                                                              \
+                    ::thrust::detail::derived_cast(::thrust::detail::strip_const(exec)),    \
+                    first,                                                                  \
+                    last_or_n);))
+
+#  define _THRUST_HOST_INSTRUMENTATION_TEMPORARY_ALLOCATION(bytes) \
+    NV_IF_TARGET(NV_IS_HOST, (::thrust::detail::instrumentation::host_call_scope::note_temporary_allocation(bytes);))
+
+// Notes that the call which is running on this thread runs a parallel region on the given number of threads. Every
+// thread of an OpenMP team may note the region, since only the thread which encountered it is in a recorded call. A
+// TBB thread which steals the work of another call is only in a recorded call which runs in parallel itself.
+#  define _THRUST_HOST_INSTRUMENTATION_PARALLEL_REGION(threads) \
+    NV_IF_TARGET(NV_IS_HOST, (::thrust::detail::instrumentation::host_call_scope::note_parallel_region(threads);))
+
+// Precedes a call of the algorithm by one of its overloads, which must not be recorded as a call of its own
+#  define _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL() \
+    NV_IF_TARGET(NV_IS_HOST, (::thrust::detail::instrumentation::host_call_scope::note_internal_call();))
+
+#else // ^^^ THRUST_ENABLE_HOST_INSTRUMENTATION ^^^ / vvv !THRUST_ENABLE_HOST_INSTRUMENTATION vvv
+
+#  define _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, algorithm, first, last_or_n)
+#  define _THRUST_HOST_INSTRUMENTATION_TEMPORARY_ALLOCATION(bytes)
+#  define _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL()
+#  define _THRUST_HOST_INSTRUMENTATION_PARALLEL_REGION(threads)
+
+#endif // ^^^ !THRUST_ENABLE_HOST_INSTRUMENTATION ^^^
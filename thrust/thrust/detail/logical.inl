@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
 
@@ -40,6 +41,7 @@ all_of(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
        Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("all_of");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::all_of", first, last);
   using thrust::system::detail::generic::all_of;
   return all_of(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end all_of()
@@ -53,6 +55,7 @@ any_of(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
        Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("any_of");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::any_of", first, last);
   using thrust::system::detail::generic::any_of;
   return any_of(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end any_of()
@@ -66,6 +69,7 @@ none_of(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
         Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("none_of");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::none_of", first, last);
   using thrust::system::detail::generic::none_of;
   return none_of(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end none_of()
@@ -13,6 +13,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -44,6 +45,7 @@ _CCCL_HOST_DEVICE OutputIterator merge(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::merge");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::merge", first1, last1);
   using thrust::system::detail::generic::merge;
   return merge(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
 } // end merge()
@@ -64,6 +66,7 @@ _CCCL_HOST_DEVICE OutputIterator merge(
   StrictWeakCompare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::merge");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::merge", first1, last1);
   using thrust::system::detail::generic::merge;
   return merge(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
@@ -89,6 +92,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> merge_by_k
   OutputIterator2 values_result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::merge_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::merge_by_key", keys_first1, keys_last1);
   using thrust::system::detail::generic::merge_by_key;
   return merge_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -124,6 +128,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> merge_by_k
   Compare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::merge_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::merge_by_key", keys_first1, keys_last1);
   using thrust::system::detail::generic::merge_by_key;
   return merge_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
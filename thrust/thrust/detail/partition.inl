@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/partition.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -41,6 +42,7 @@ _CCCL_HOST_DEVICE ForwardIterator partition(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::partition");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::partition", first, last);
   using thrust::system::detail::generic::partition;
   return partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end partition()
@@ -55,6 +57,7 @@ _CCCL_HOST_DEVICE ForwardIterator partition(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::partition");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::partition", first, last);
   using thrust::system::detail::generic::partition;
   return partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred);
 } // end partition()
@@ -74,6 +77,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> partition_
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::partition_copy");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::partition_copy", first, last);
   using thrust::system::detail::generic::partition_copy;
   return partition_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, out_true, out_false, pred);
@@ -96,6 +100,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> partition_
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::partition_copy");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::partition_copy", first, last);
   using thrust::system::detail::generic::partition_copy;
   return partition_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, out_true, out_false, pred);
@@ -110,6 +115,7 @@ _CCCL_HOST_DEVICE ForwardIterator stable_partition(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::stable_partition");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::stable_partition", first, last);
   using thrust::system::detail::generic::stable_partition;
   return stable_partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end stable_partition()
@@ -124,6 +130,7 @@ _CCCL_HOST_DEVICE ForwardIterator stable_partition(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::stable_partition");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::stable_partition", first, last);
   using thrust::system::detail::generic::stable_partition;
   return stable_partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred);
 } // end stable_partition()
@@ -143,6 +150,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> stable_par
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::stable_partition_copy");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::stable_partition_copy", first, last);
   using thrust::system::detail::generic::stable_partition_copy;
   return stable_partition_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, out_true, out_false, pred);
@@ -165,6 +173,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> stable_par
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::stable_partition_copy");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::stable_partition_copy", first, last);
   using thrust::system::detail::generic::stable_partition_copy;
   return stable_partition_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, out_true, out_false, pred);
@@ -179,6 +188,7 @@ _CCCL_HOST_DEVICE ForwardIterator partition_point(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::partition_point");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::partition_point", first, last);
   using thrust::system::detail::generic::partition_point;
   return partition_point(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end partition_point()
@@ -192,6 +202,7 @@ _CCCL_HOST_DEVICE bool is_partitioned(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::is_partitioned");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::is_partitioned", first, last);
   using thrust::system::detail::generic::is_partitioned;
   return is_partitioned(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end is_partitioned()
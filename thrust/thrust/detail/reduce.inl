@@ -13,6 +13,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/nvtx_policy.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/reduce.h>
@@ -48,6 +49,7 @@ _CCCL_HOST_DEVICE detail::it_value_t<InputIterator>
 reduce(const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, InputIterator last)
 {
   _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<DerivedPolicy>(), "thrust::reduce");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::reduce", first, last);
   using thrust::system::detail::generic::reduce;
   return reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end reduce()
@@ -58,6 +60,7 @@ _CCCL_HOST_DEVICE T reduce(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, InputIterator last, T init)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::reduce");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::reduce", first, last);
   using thrust::system::detail::generic::reduce;
   return reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init);
 } // end reduce()
@@ -72,6 +75,7 @@ _CCCL_HOST_DEVICE T reduce(
   BinaryFunction binary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::reduce");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::reduce", first, last);
   using thrust::system::detail::generic::reduce;
   return reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init, binary_op);
 } // end reduce()
@@ -130,6 +134,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_
   OutputIterator2 values_output)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::reduce_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::reduce_by_key", keys_first, keys_last);
   using thrust::system::detail::generic::reduce_by_key;
   return reduce_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -157,6 +162,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_
   BinaryPredicate binary_pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::reduce_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::reduce_by_key", keys_first, keys_last);
   using thrust::system::detail::generic::reduce_by_key;
   return reduce_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -187,6 +193,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_
   BinaryFunction binary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::reduce_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::reduce_by_key", keys_first, keys_last);
   using thrust::system::detail::generic::reduce_by_key;
   return reduce_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/remove.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -41,6 +42,7 @@ _CCCL_HOST_DEVICE ForwardIterator remove(
   const T& value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::remove");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::remove", first, last);
   using thrust::system::detail::generic::remove;
   return remove(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 } // end remove()
@@ -55,6 +57,7 @@ _CCCL_HOST_DEVICE OutputIterator remove_copy(
   const T& value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::remove_copy");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::remove_copy", first, last);
   using thrust::system::detail::generic::remove_copy;
   return remove_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, value);
 } // end remove_copy()
@@ -68,6 +71,7 @@ _CCCL_HOST_DEVICE ForwardIterator remove_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::remove_if");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::remove_if", first, last);
   using thrust::system::detail::generic::remove_if;
   return remove_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end remove_if()
@@ -82,6 +86,7 @@ _CCCL_HOST_DEVICE OutputIterator remove_copy_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::remove_copy_if");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::remove_copy_if", first, last);
   using thrust::system::detail::generic::remove_copy_if;
   return remove_copy_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, pred);
 } // end remove_copy_if()
@@ -96,6 +101,7 @@ _CCCL_HOST_DEVICE ForwardIterator remove_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::remove_if");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::remove_if", first, last);
   using thrust::system::detail::generic::remove_if;
   return remove_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred);
 } // end remove_if()
@@ -115,6 +121,7 @@ _CCCL_HOST_DEVICE OutputIterator remove_copy_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::remove_copy_if");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::remove_copy_if", first, last);
   using thrust::system::detail::generic::remove_copy_if;
   return remove_copy_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, result, pred);
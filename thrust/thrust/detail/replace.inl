@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/replace.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -42,6 +43,7 @@ replace(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
         const T& new_value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::replace");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::replace", first, last);
   using thrust::system::detail::generic::replace;
   return replace(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, old_value, new_value);
 } // end replace()
@@ -56,6 +58,7 @@ _CCCL_HOST_DEVICE void replace_if(
   const T& new_value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::replace_if");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::replace_if", first, last);
   using thrust::system::detail::generic::replace_if;
   return replace_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred, new_value);
 } // end replace_if()
@@ -71,6 +74,7 @@ _CCCL_HOST_DEVICE void replace_if(
   const T& new_value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::replace_if");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::replace_if", first, last);
   using thrust::system::detail::generic::replace_if;
   return replace_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred, new_value);
@@ -87,6 +91,7 @@ _CCCL_HOST_DEVICE OutputIterator replace_copy(
   const T& new_value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::replace_copy");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::replace_copy", first, last);
   using thrust::system::detail::generic::replace_copy;
   return replace_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, old_value, new_value);
@@ -103,6 +108,7 @@ _CCCL_HOST_DEVICE OutputIterator replace_copy_if(
   const T& new_value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::replace_copy_if");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::replace_copy_if", first, last);
   using thrust::system::detail::generic::replace_copy_if;
   return replace_copy_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, pred, new_value);
@@ -125,6 +131,7 @@ _CCCL_HOST_DEVICE OutputIterator replace_copy_if(
   const T& new_value)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::replace_copy_if");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::replace_copy_if", first, last);
   using thrust::system::detail::generic::replace_copy_if;
   return replace_copy_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, result, pred, new_value);
@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/reverse.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -39,6 +40,7 @@ _CCCL_HOST_DEVICE void reverse(const thrust::detail::execution_policy_base<Deriv
                                BidirectionalIterator last)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::reverse");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::reverse", first, last);
   using thrust::system::detail::generic::reverse;
   return reverse(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end reverse()
@@ -52,6 +54,7 @@ _CCCL_HOST_DEVICE OutputIterator reverse_copy(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::reverse_copy");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::reverse_copy", first, last);
   using thrust::system::detail::generic::reverse_copy;
   return reverse_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end reverse_copy()
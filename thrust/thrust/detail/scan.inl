@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/scan.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -49,6 +50,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::inclusive_scan");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::inclusive_scan", first, last);
   using thrust::system::detail::generic::inclusive_scan;
   return inclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end inclusive_scan()
@@ -63,6 +65,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan(
   AssociativeOperator binary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::inclusive_scan");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::inclusive_scan", first, last);
   using thrust::system::detail::generic::inclusive_scan;
   return inclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, binary_op);
 } // end inclusive_scan()
@@ -78,6 +81,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan(
   AssociativeOperator binary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::inclusive_scan");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::inclusive_scan", first, last);
   using thrust::system::detail::generic::inclusive_scan;
   return inclusive_scan(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, init, binary_op);
@@ -92,6 +96,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::exclusive_scan");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::exclusive_scan", first, last);
   using thrust::system::detail::generic::exclusive_scan;
   return exclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end exclusive_scan()
@@ -106,6 +111,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan(
   T init)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::exclusive_scan");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::exclusive_scan", first, last);
   using thrust::system::detail::generic::exclusive_scan;
   return exclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, init);
 } // end exclusive_scan()
@@ -121,6 +127,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan(
   AssociativeOperator binary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::exclusive_scan");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::exclusive_scan", first, last);
   using thrust::system::detail::generic::exclusive_scan;
   return exclusive_scan(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, init, binary_op);
@@ -136,6 +143,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan_by_key(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::inclusive_scan_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::inclusive_scan_by_key", first1, last1);
   using thrust::system::detail::generic::inclusive_scan_by_key;
   return inclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result);
@@ -156,6 +164,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan_by_key(
   BinaryPredicate binary_pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::inclusive_scan_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::inclusive_scan_by_key", first1, last1);
   using thrust::system::detail::generic::inclusive_scan_by_key;
   return inclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, binary_pred);
@@ -178,6 +187,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan_by_key(
   AssociativeOperator binary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::inclusive_scan_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::inclusive_scan_by_key", first1, last1);
   using thrust::system::detail::generic::inclusive_scan_by_key;
   return inclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -199,6 +209,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan_by_key(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::exclusive_scan_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::exclusive_scan_by_key", first1, last1);
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result);
@@ -215,6 +226,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan_by_key(
   T init)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::exclusive_scan_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::exclusive_scan_by_key", first1, last1);
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, init);
@@ -237,6 +249,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan_by_key(
   BinaryPredicate binary_pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::exclusive_scan_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::exclusive_scan_by_key", first1, last1);
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, init, binary_pred);
@@ -261,6 +274,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan_by_key(
   AssociativeOperator binary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::exclusive_scan_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::exclusive_scan_by_key", first1, last1);
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
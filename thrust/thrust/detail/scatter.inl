@@ -13,6 +13,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/scatter.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -43,6 +44,7 @@ scatter(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
         RandomAccessIterator output)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::scatter");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::scatter", first, last);
   using thrust::system::detail::generic::scatter;
   return scatter(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, map, output);
 } // end scatter()
@@ -62,6 +64,7 @@ _CCCL_HOST_DEVICE void scatter_if(
   RandomAccessIterator output)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::scatter_if");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::scatter_if", first, last);
   using thrust::system::detail::generic::scatter_if;
   return scatter_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, map, stencil, output);
 } // end scatter_if()
@@ -83,6 +86,7 @@ _CCCL_HOST_DEVICE void scatter_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::scatter_if");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::scatter_if", first, last);
   using thrust::system::detail::generic::scatter_if;
   return scatter_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, map, stencil, output, pred);
@@ -0,0 +1,208 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/instrumentation.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/segmented_reduce.h>
+#include <thrust/system/detail/generic/select_system.h>
+
+// Include all active backend system implementations (generic, sequential, host and device)
+#include <thrust/system/detail/generic/segmented_reduce.h>
+#include <thrust/system/detail/sequential/segmented_reduce.h>
+#include __THRUST_HOST_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(segmented_reduce.h)
+#include __THRUST_DEVICE_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(segmented_reduce.h)
+
+// Some build systems need a hint to know which files we could include
+#if 0
+#  include <thrust/system/cpp/detail/segmented_reduce.h>
+#  include <thrust/system/cuda/detail/segmented_reduce.h>
+#  include <thrust/system/omp/detail/segmented_reduce.h>
+#  include <thrust/system/tbb/detail/segmented_reduce.h>
+#endif
+
+THRUST_NAMESPACE_BEGIN
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  OutputIterator result)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_reduce");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::segmented_reduce", first, 0);
+  using thrust::system::detail::generic::segmented_reduce;
+  return segmented_reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+                          first,
+                          begin_offsets_first,
+                          begin_offsets_last,
+                          end_offsets_first,
+                          result);
+} // end segmented_reduce()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename OutputIterator,
+          typename T>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  OutputIterator result,
+  T init)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_reduce");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::segmented_reduce", first, 0);
+  using thrust::system::detail::generic::segmented_reduce;
+  return segmented_reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+                          first,
+                          begin_offsets_first,
+                          begin_offsets_last,
+                          end_offsets_first,
+                          result,
+                          init);
+} // end segmented_reduce()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_reduce");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::segmented_reduce", first, 0);
+  using thrust::system::detail::generic::segmented_reduce;
+  return segmented_reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+                          first,
+                          begin_offsets_first,
+                          begin_offsets_last,
+                          end_offsets_first,
+                          result,
+                          init,
+                          binary_op);
+} // end segmented_reduce()
+
+template <typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename OutputIterator,
+          ::cuda::std::enable_if_t<!is_execution_policy_v<RandomAccessIterator>, int>>
+OutputIterator segmented_reduce(
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  OutputIterator result)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_reduce");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::segmented_reduce(
+    select_system(system1, system2), first, begin_offsets_first, begin_offsets_last, end_offsets_first, result);
+} // end segmented_reduce()
+
+template <typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename OutputIterator,
+          typename T,
+          ::cuda::std::enable_if_t<!is_execution_policy_v<RandomAccessIterator>, int>>
+OutputIterator segmented_reduce(
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  OutputIterator result,
+  T init)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_reduce");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::segmented_reduce(
+    select_system(system1, system2), first, begin_offsets_first, begin_offsets_last, end_offsets_first, result, init);
+} // end segmented_reduce()
+
+template <typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction,
+          ::cuda::std::enable_if_t<!is_execution_policy_v<RandomAccessIterator>, int>>
+OutputIterator segmented_reduce(
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_reduce");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::segmented_reduce(
+    select_system(system1, system2),
+    first,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    result,
+    init,
+    binary_op);
+} // end segmented_reduce()
+
+THRUST_NAMESPACE_END
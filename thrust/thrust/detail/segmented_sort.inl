@@ -0,0 +1,214 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/instrumentation.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/segmented_sort.h>
+#include <thrust/system/detail/generic/select_system.h>
+
+// Include all active backend system implementations (generic, sequential, host and device)
+#include <thrust/system/detail/generic/segmented_sort.h>
+#include <thrust/system/detail/sequential/segmented_sort.h>
+#include __THRUST_HOST_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(segmented_sort.h)
+#include __THRUST_DEVICE_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(segmented_sort.h)
+
+// Some build systems need a hint to know which files we could include
+#if 0
+#  include <thrust/system/cpp/detail/segmented_sort.h>
+#  include <thrust/system/cuda/detail/segmented_sort.h>
+#  include <thrust/system/omp/detail/segmented_sort.h>
+#  include <thrust/system/tbb/detail/segmented_sort.h>
+#endif
+
+THRUST_NAMESPACE_BEGIN
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator>
+_CCCL_HOST_DEVICE void segmented_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_sort");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::segmented_sort", first, 0);
+  using thrust::system::detail::generic::segmented_sort;
+  return segmented_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+                        first,
+                        begin_offsets_first,
+                        begin_offsets_last,
+                        end_offsets_first);
+} // end segmented_sort()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_sort");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::segmented_sort", first, 0);
+  using thrust::system::detail::generic::segmented_sort;
+  return segmented_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+                        first,
+                        begin_offsets_first,
+                        begin_offsets_last,
+                        end_offsets_first,
+                        comp);
+} // end segmented_sort()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator>
+_CCCL_HOST_DEVICE void segmented_stable_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_stable_sort");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::segmented_stable_sort", first, 0);
+  using thrust::system::detail::generic::segmented_stable_sort;
+  return segmented_stable_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+                               first,
+                               begin_offsets_first,
+                               begin_offsets_last,
+                               end_offsets_first);
+} // end segmented_stable_sort()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_stable_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_stable_sort");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::segmented_stable_sort", first, 0);
+  using thrust::system::detail::generic::segmented_stable_sort;
+  return segmented_stable_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+                               first,
+                               begin_offsets_first,
+                               begin_offsets_last,
+                               end_offsets_first,
+                               comp);
+} // end segmented_stable_sort()
+
+template <typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          ::cuda::std::enable_if_t<!is_execution_policy_v<RandomAccessIterator>, int>>
+void segmented_sort(RandomAccessIterator first,
+                    BeginOffsetIterator begin_offsets_first,
+                    BeginOffsetIterator begin_offsets_last,
+                    EndOffsetIterator end_offsets_first)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_sort");
+  using thrust::system::detail::generic::select_system;
+
+  using System = typename thrust::iterator_system<RandomAccessIterator>::type;
+
+  System system;
+
+  return thrust::segmented_sort(
+    select_system(system), first, begin_offsets_first, begin_offsets_last, end_offsets_first);
+} // end segmented_sort()
+
+template <typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename StrictWeakOrdering,
+          ::cuda::std::enable_if_t<!is_execution_policy_v<RandomAccessIterator>, int>>
+void segmented_sort(RandomAccessIterator first,
+                    BeginOffsetIterator begin_offsets_first,
+                    BeginOffsetIterator begin_offsets_last,
+                    EndOffsetIterator end_offsets_first,
+                    StrictWeakOrdering comp)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_sort");
+  using thrust::system::detail::generic::select_system;
+
+  using System = typename thrust::iterator_system<RandomAccessIterator>::type;
+
+  System system;
+
+  return thrust::segmented_sort(
+    select_system(system), first, begin_offsets_first, begin_offsets_last, end_offsets_first, comp);
+} // end segmented_sort()
+
+template <typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          ::cuda::std::enable_if_t<!is_execution_policy_v<RandomAccessIterator>, int>>
+void segmented_stable_sort(RandomAccessIterator first,
+                           BeginOffsetIterator begin_offsets_first,
+                           BeginOffsetIterator begin_offsets_last,
+                           EndOffsetIterator end_offsets_first)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_stable_sort");
+  using thrust::system::detail::generic::select_system;
+
+  using System = typename thrust::iterator_system<RandomAccessIterator>::type;
+
+  System system;
+
+  return thrust::segmented_stable_sort(
+    select_system(system), first, begin_offsets_first, begin_offsets_last, end_offsets_first);
+} // end segmented_stable_sort()
+
+template <typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename StrictWeakOrdering,
+          ::cuda::std::enable_if_t<!is_execution_policy_v<RandomAccessIterator>, int>>
+void segmented_stable_sort(RandomAccessIterator first,
+                           BeginOffsetIterator begin_offsets_first,
+                           BeginOffsetIterator begin_offsets_last,
+                           EndOffsetIterator end_offsets_first,
+                           StrictWeakOrdering comp)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_stable_sort");
+  using thrust::system::detail::generic::select_system;
+
+  using System = typename thrust::iterator_system<RandomAccessIterator>::type;
+
+  System system;
+
+  return thrust::segmented_stable_sort(
+    select_system(system), first, begin_offsets_first, begin_offsets_last, end_offsets_first, comp);
+} // end segmented_stable_sort()
+
+THRUST_NAMESPACE_END
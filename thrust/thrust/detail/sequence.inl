@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/sequence.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -38,6 +39,7 @@ _CCCL_HOST_DEVICE void
 sequence(const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::sequence");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::sequence", first, last);
   using thrust::system::detail::generic::sequence;
   return sequence(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end sequence()
@@ -48,6 +50,7 @@ _CCCL_HOST_DEVICE void sequence(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, T init)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::sequence");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::sequence", first, last);
   using thrust::system::detail::generic::sequence;
   return sequence(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init);
 } // end sequence()
@@ -62,6 +65,7 @@ _CCCL_HOST_DEVICE void sequence(
   T step)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::sequence");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::sequence", first, last);
   using thrust::system::detail::generic::sequence;
   return sequence(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init, step);
 } // end sequence()
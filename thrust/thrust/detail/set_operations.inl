@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
 
@@ -42,6 +43,7 @@ _CCCL_HOST_DEVICE OutputIterator set_difference(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_difference");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::set_difference", first1, last1);
   using thrust::system::detail::generic::set_difference;
   return set_difference(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
@@ -63,6 +65,7 @@ _CCCL_HOST_DEVICE OutputIterator set_difference(
   StrictWeakCompare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_difference");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::set_difference", first1, last1);
   using thrust::system::detail::generic::set_difference;
   return set_difference(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
@@ -88,6 +91,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> set_differ
   OutputIterator2 values_result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_difference_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::set_difference_by_key", keys_first1, keys_last1);
   using thrust::system::detail::generic::set_difference_by_key;
   return set_difference_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -123,6 +127,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> set_differ
   StrictWeakCompare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_difference_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::set_difference_by_key", keys_first1, keys_last1);
   using thrust::system::detail::generic::set_difference_by_key;
   return set_difference_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -148,6 +153,7 @@ _CCCL_HOST_DEVICE OutputIterator set_intersection(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_intersection");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::set_intersection", first1, last1);
   using thrust::system::detail::generic::set_intersection;
   return set_intersection(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
@@ -169,6 +175,7 @@ _CCCL_HOST_DEVICE OutputIterator set_intersection(
   StrictWeakCompare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_intersection");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::set_intersection", first1, last1);
   using thrust::system::detail::generic::set_intersection;
   return set_intersection(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
@@ -192,6 +199,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> set_inters
   OutputIterator2 values_result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_intersection_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::set_intersection_by_key", keys_first1, keys_last1);
   using thrust::system::detail::generic::set_intersection_by_key;
   return set_intersection_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -224,6 +232,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> set_inters
   StrictWeakCompare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_intersection_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::set_intersection_by_key", keys_first1, keys_last1);
   using thrust::system::detail::generic::set_intersection_by_key;
   return set_intersection_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -248,6 +257,7 @@ _CCCL_HOST_DEVICE OutputIterator set_symmetric_difference(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_symmetric_difference");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::set_symmetric_difference", first1, last1);
   using thrust::system::detail::generic::set_symmetric_difference;
   return set_symmetric_difference(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
@@ -269,6 +279,7 @@ _CCCL_HOST_DEVICE OutputIterator set_symmetric_difference(
   StrictWeakCompare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_symmetric_difference");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::set_symmetric_difference", first1, last1);
   using thrust::system::detail::generic::set_symmetric_difference;
   return set_symmetric_difference(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
@@ -294,6 +305,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> set_symmet
   OutputIterator2 values_result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_symmetric_difference_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::set_symmetric_difference_by_key", keys_first1, keys_last1);
   using thrust::system::detail::generic::set_symmetric_difference_by_key;
   return set_symmetric_difference_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -329,6 +341,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> set_symmet
   StrictWeakCompare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_symmetric_difference_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::set_symmetric_difference_by_key", keys_first1, keys_last1);
   using thrust::system::detail::generic::set_symmetric_difference_by_key;
   return set_symmetric_difference_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -354,6 +367,7 @@ _CCCL_HOST_DEVICE OutputIterator set_union(
   OutputIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_union");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::set_union", first1, last1);
   using thrust::system::detail::generic::set_union;
   return set_union(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
@@ -375,6 +389,7 @@ _CCCL_HOST_DEVICE OutputIterator set_union(
   StrictWeakCompare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_union");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::set_union", first1, last1);
   using thrust::system::detail::generic::set_union;
   return set_union(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
@@ -400,6 +415,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> set_union_
   OutputIterator2 values_result)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_union_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::set_union_by_key", keys_first1, keys_last1);
   using thrust::system::detail::generic::set_union_by_key;
   return set_union_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -435,6 +451,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> set_union_
   StrictWeakCompare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::set_union_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::set_union_by_key", keys_first1, keys_last1);
   using thrust::system::detail::generic::set_union_by_key;
   return set_union_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
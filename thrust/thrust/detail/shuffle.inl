@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/shuffle.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -25,6 +26,7 @@ _CCCL_HOST_DEVICE void shuffle(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, URBG&& g)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::shuffle");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::shuffle", first, last);
   using thrust::system::detail::generic::shuffle;
   return shuffle(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, g);
 }
@@ -51,6 +53,7 @@ _CCCL_HOST_DEVICE void shuffle_copy(
   URBG&& g)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::shuffle_copy");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::shuffle_copy", first, last);
   using thrust::system::detail::generic::shuffle_copy;
   return shuffle_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, g);
 }
@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/sort.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -39,6 +40,7 @@ _CCCL_HOST_DEVICE void sort(const thrust::detail::execution_policy_base<DerivedP
                             RandomAccessIterator last)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::sort");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::sort", first, last);
   using thrust::system::detail::generic::sort;
   return sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end sort()
@@ -52,6 +54,7 @@ sort(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
      StrictWeakOrdering comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::sort");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::sort", first, last);
   using thrust::system::detail::generic::sort;
   return sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end sort()
@@ -63,6 +66,7 @@ _CCCL_HOST_DEVICE void stable_sort(const thrust::detail::execution_policy_base<D
                                    RandomAccessIterator last)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::stable_sort");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::stable_sort", first, last);
   using thrust::system::detail::generic::stable_sort;
   return stable_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end stable_sort()
@@ -76,6 +80,7 @@ _CCCL_HOST_DEVICE void stable_sort(
   StrictWeakOrdering comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::stable_sort");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::stable_sort", first, last);
   using thrust::system::detail::generic::stable_sort;
   return stable_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end stable_sort()
@@ -89,6 +94,7 @@ _CCCL_HOST_DEVICE void sort_by_key(
   RandomAccessIterator2 values_first)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::sort_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::sort_by_key", keys_first, keys_last);
   using thrust::system::detail::generic::sort_by_key;
   return sort_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first);
@@ -107,6 +113,7 @@ _CCCL_HOST_DEVICE void sort_by_key(
   StrictWeakOrdering comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::sort_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::sort_by_key", keys_first, keys_last);
   using thrust::system::detail::generic::sort_by_key;
   return sort_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, comp);
@@ -121,6 +128,7 @@ _CCCL_HOST_DEVICE void stable_sort_by_key(
   RandomAccessIterator2 values_first)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::stable_sort_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::stable_sort_by_key", keys_first, keys_last);
   using thrust::system::detail::generic::stable_sort_by_key;
   return stable_sort_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first);
@@ -139,6 +147,7 @@ _CCCL_HOST_DEVICE void stable_sort_by_key(
   StrictWeakOrdering comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::stable_sort_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::stable_sort_by_key", keys_first, keys_last);
   using thrust::system::detail::generic::stable_sort_by_key;
   return stable_sort_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, comp);
@@ -150,6 +159,7 @@ _CCCL_HOST_DEVICE bool
 is_sorted(const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::is_sorted");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::is_sorted", first, last);
   using thrust::system::detail::generic::is_sorted;
   return is_sorted(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end is_sorted()
@@ -163,6 +173,7 @@ is_sorted(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
           Compare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::is_sorted");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::is_sorted", first, last);
   using thrust::system::detail::generic::is_sorted;
   return is_sorted(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end is_sorted()
@@ -173,6 +184,7 @@ _CCCL_HOST_DEVICE ForwardIterator is_sorted_until(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::is_sorted_until");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::is_sorted_until", first, last);
   using thrust::system::detail::generic::is_sorted_until;
   return is_sorted_until(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end is_sorted_until()
@@ -186,6 +198,7 @@ _CCCL_HOST_DEVICE ForwardIterator is_sorted_until(
   Compare comp)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::is_sorted_until");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::is_sorted_until", first, last);
   using thrust::system::detail::generic::is_sorted_until;
   return is_sorted_until(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end is_sorted_until()
@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/tabulate.h>
@@ -41,6 +42,7 @@ tabulate(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
          UnaryOperation unary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::tabulate");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::tabulate", first, last);
   using thrust::system::detail::generic::tabulate;
   return tabulate(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, unary_op);
 } // end tabulate()
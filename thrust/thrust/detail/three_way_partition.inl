@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/instrumentation.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/three_way_partition.h>
+
+// Include all active backend system implementations (generic, sequential, host and device)
+#include <thrust/system/detail/generic/three_way_partition.h>
+#include <thrust/system/detail/sequential/three_way_partition.h>
+#include __THRUST_HOST_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(three_way_partition.h)
+#include __THRUST_DEVICE_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(three_way_partition.h)
+
+// Some build systems need a hint to know which files we could include
+#if 0
+#  include <thrust/system/cpp/detail/three_way_partition.h>
+#  include <thrust/system/cuda/detail/three_way_partition.h>
+#  include <thrust/system/omp/detail/three_way_partition.h>
+#  include <thrust/system/tbb/detail/three_way_partition.h>
+#endif
+
+THRUST_NAMESPACE_BEGIN
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename OutputIterator3,
+          typename Predicate1,
+          typename Predicate2>
+_CCCL_HOST_DEVICE ::cuda::std::tuple<OutputIterator1, OutputIterator2, OutputIterator3> three_way_partition(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  ForwardIterator first,
+  ForwardIterator last,
+  OutputIterator1 first_part_out,
+  OutputIterator2 second_part_out,
+  OutputIterator3 unselected_out,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::three_way_partition");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::three_way_partition", first, last);
+  using thrust::system::detail::generic::three_way_partition;
+  return three_way_partition(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    first,
+    last,
+    first_part_out,
+    second_part_out,
+    unselected_out,
+    select_first_part,
+    select_second_part);
+} // end three_way_partition()
+
+template <typename ForwardIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename OutputIterator3,
+          typename Predicate1,
+          typename Predicate2>
+::cuda::std::tuple<OutputIterator1, OutputIterator2, OutputIterator3> three_way_partition(
+  ForwardIterator first,
+  ForwardIterator last,
+  OutputIterator1 first_part_out,
+  OutputIterator2 second_part_out,
+  OutputIterator3 unselected_out,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::three_way_partition");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<ForwardIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputIterator1>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator2>::type;
+  using System4 = typename thrust::iterator_system<OutputIterator3>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::three_way_partition(
+    select_system(system1, system2, system3, system4),
+    first,
+    last,
+    first_part_out,
+    second_part_out,
+    unselected_out,
+    select_first_part,
+    select_second_part);
+} // end three_way_partition()
+
+THRUST_NAMESPACE_END
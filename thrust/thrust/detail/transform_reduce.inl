@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
 
@@ -46,6 +47,7 @@ _CCCL_HOST_DEVICE OutputType transform_reduce(
   BinaryFunction binary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform_reduce");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::transform_reduce", first, last);
   using thrust::system::detail::generic::transform_reduce;
   return transform_reduce(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, unary_op, init, binary_op);
@@ -13,6 +13,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/scan.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -48,6 +49,7 @@ _CCCL_HOST_DEVICE OutputIterator transform_inclusive_scan(
   AssociativeOperator binary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform_inclusive_scan");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::transform_inclusive_scan", first, last);
   using thrust::system::detail::generic::transform_inclusive_scan;
   return transform_inclusive_scan(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, unary_op, binary_op);
@@ -70,6 +72,7 @@ _CCCL_HOST_DEVICE OutputIterator transform_inclusive_scan(
   AssociativeOperator binary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform_inclusive_scan");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::transform_inclusive_scan", first, last);
   using thrust::system::detail::generic::transform_inclusive_scan;
   return transform_inclusive_scan(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, unary_op, init, binary_op);
@@ -92,6 +95,7 @@ _CCCL_HOST_DEVICE OutputIterator transform_exclusive_scan(
   AssociativeOperator binary_op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform_exclusive_scan");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::transform_exclusive_scan", first, last);
   using thrust::system::detail::generic::transform_exclusive_scan;
   return transform_exclusive_scan(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, unary_op, init, binary_op);
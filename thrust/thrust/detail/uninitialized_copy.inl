@@ -13,6 +13,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/uninitialized_copy.h>
@@ -42,6 +43,7 @@ _CCCL_HOST_DEVICE ForwardIterator uninitialized_copy(
   ForwardIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("uninitialized_copy");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::uninitialized_copy", first, last);
   using thrust::system::detail::generic::uninitialized_copy;
   return uninitialized_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end uninitialized_copy()
@@ -52,6 +54,7 @@ _CCCL_HOST_DEVICE ForwardIterator uninitialized_copy_n(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, Size n, ForwardIterator result)
 {
   _CCCL_NVTX_RANGE_SCOPE("uninitialized_copy_n");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::uninitialized_copy_n", first, n);
   using thrust::system::detail::generic::uninitialized_copy_n;
   return uninitialized_copy_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, result);
 } // end uninitialized_copy_n()
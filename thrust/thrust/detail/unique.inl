@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -47,6 +48,7 @@ _CCCL_HOST_DEVICE ForwardIterator
 unique(const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
   _CCCL_NVTX_RANGE_SCOPE("unique");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::unique", first, last);
   using thrust::system::detail::generic::unique;
   return unique(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end unique()
@@ -60,6 +62,7 @@ _CCCL_HOST_DEVICE ForwardIterator unique(
   BinaryPredicate binary_pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("unique");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::unique", first, last);
   using thrust::system::detail::generic::unique;
   return unique(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, binary_pred);
 } // end unique()
@@ -73,6 +76,7 @@ _CCCL_HOST_DEVICE OutputIterator unique_copy(
   OutputIterator output)
 {
   _CCCL_NVTX_RANGE_SCOPE("unique_copy");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::unique_copy", first, last);
   using thrust::system::detail::generic::unique_copy;
   return unique_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, output);
 } // end unique_copy()
@@ -87,6 +91,7 @@ _CCCL_HOST_DEVICE OutputIterator unique_copy(
   BinaryPredicate binary_pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("unique_copy");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::unique_copy", first, last);
   using thrust::system::detail::generic::unique_copy;
   return unique_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, output, binary_pred);
 } // end unique_copy()
@@ -100,6 +105,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<ForwardIterator1, ForwardIterator2> unique_b
   ForwardIterator2 values_first)
 {
   _CCCL_NVTX_RANGE_SCOPE("unique_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::unique_by_key", keys_first, keys_last);
   using thrust::system::detail::generic::unique_by_key;
   return unique_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first);
@@ -115,6 +121,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<ForwardIterator1, ForwardIterator2> unique_b
   BinaryPredicate binary_pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("unique_by_key");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::unique_by_key", keys_first, keys_last);
   using thrust::system::detail::generic::unique_by_key;
   return unique_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, binary_pred);
@@ -135,6 +142,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> unique_by_
   OutputIterator2 values_output)
 {
   _CCCL_NVTX_RANGE_SCOPE("unique_by_key_copy");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::unique_by_key_copy", keys_first, keys_last);
   using thrust::system::detail::generic::unique_by_key_copy;
   return unique_by_key_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -162,6 +170,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> unique_by_
   BinaryPredicate binary_pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("unique_by_key_copy");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::unique_by_key_copy", keys_first, keys_last);
   using thrust::system::detail::generic::unique_by_key_copy;
   return unique_by_key_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -331,6 +340,7 @@ _CCCL_HOST_DEVICE thrust::detail::it_difference_t<ForwardIterator> unique_count(
   BinaryPredicate binary_pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("unique_count");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::unique_count", first, last);
   using thrust::system::detail::generic::unique_count;
   return unique_count(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, binary_pred);
 } // end unique_count()
@@ -341,6 +351,7 @@ _CCCL_HOST_DEVICE thrust::detail::it_difference_t<ForwardIterator> unique_count(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
   _CCCL_NVTX_RANGE_SCOPE("unique_count");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::unique_count", first, last);
   using thrust::system::detail::generic::unique_count;
   return unique_count(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end unique_count()
@@ -0,0 +1,441 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file eytzinger_index.h
+ *  \brief A search-optimized copy of a sorted range for repeated searches on the host.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/function.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/transform.h>
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__bit/countr.h>
+#include <cuda/std/__bit/integral.h>
+#include <cuda/std/__functional/operations.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__type_traits/is_base_of.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup vectorized_binary_search
+ *  \{
+ */
+
+/*! \p eytzinger_index is a copy of a sorted range that is laid out for fast searches, for programs that search the
+ *  same range many times on the host.
+ *
+ *  A binary search over a large sorted array touches a different cache line at every step and cannot know the next
+ *  one before the current comparison resolves. \p eytzinger_index stores the elements in the breadth-first order of
+ *  the implicit binary search tree (the Eytzinger layout): the children of the node at position \c k are at \c 2k and
+ *  <tt>2k+1</tt>. The top levels of the tree share a few cache lines that stay cached across searches, and all
+ *  descendants several levels below a node are adjacent in memory, so each search prefetches them ahead of the
+ *  comparisons that select one of them.
+ *
+ *  The searches return positions in the original sorted range, like the vectorized \p lower_bound, \p upper_bound and
+ *  \p binary_search of <tt>thrust/binary_search.h</tt>, which are overloaded for \p eytzinger_index. Building the index
+ *  takes linear time and the index occupies <tt>sizeof(T) + sizeof(size_t)</tt> bytes per element.
+ *
+ *  \tparam T The type of the elements. It must be default constructible and copy assignable.
+ *  \tparam StrictWeakOrdering The ordering of the sorted range, a model of
+ *  <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  The following code snippet demonstrates how to use \p eytzinger_index to search for many values using the
+ *  \p thrust::host execution policy:
+ *
+ *  \code
+ *  #include <thrust/eytzinger_index.h>
+ *  #include <thrust/execution_policy.h>
+ *  #include <thrust/host_vector.h>
+ *  ...
+ *  thrust::host_vector<int> input = ...; // sorted
+ *  thrust::eytzinger_index<int> index(input.begin(), input.end());
+ *
+ *  thrust::host_vector<int> values = ...;
+ *  thrust::host_vector<size_t> output(values.size());
+ *
+ *  // output[i] is the position of the lower bound of values[i] in input
+ *  thrust::lower_bound(thrust::host, index, values.begin(), values.end(), output.begin());
+ *  \endcode
+ *
+ *  \see \p lower_bound
+ *  \see \p upper_bound
+ *  \see \p binary_search
+ */
+template <typename T, typename StrictWeakOrdering = ::cuda::std::less<T>>
+class eytzinger_index
+{
+public:
+  /*! The type of the elements. */
+  using value_type = T;
+  /*! The type of sizes and positions. */
+  using size_type = ::cuda::std::size_t;
+  /*! The ordering of the elements. */
+  using value_compare = StrictWeakOrdering;
+
+  /*! Builds the index of the sorted range <tt>[first, last)</tt>.
+   *
+   *  \param first The beginning of the sorted range.
+   *  \param last The end of the sorted range.
+   *  \param comp The ordering of the range.
+   *
+   *  \tparam RandomAccessIterator is a model of
+   *  <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+   */
+  template <typename RandomAccessIterator>
+  eytzinger_index(RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp = StrictWeakOrdering())
+      : m_size(static_cast<size_type>(::cuda::std::distance(first, last)))
+      , m_keys(m_size + 1 + keys_per_line)
+      , m_ranks(m_size + 1)
+      , m_comp(comp)
+  {
+    // Align the tree, so that the descendants prefetched together share a cache line
+    const auto misalignment = reinterpret_cast<::cuda::std::uintptr_t>(m_keys.data()) % cache_line_size;
+    if (cache_line_size % sizeof(T) == 0 && misalignment % sizeof(T) == 0)
+    {
+      m_offset = ((cache_line_size - misalignment) % cache_line_size) / sizeof(T);
+    }
+
+    // Position 0 is not part of the tree; searches that end there did not find any element
+    m_ranks[0] = m_size;
+    build(first, 0, 1);
+  }
+
+  /*! \return The number of elements of the indexed range. */
+  size_type size() const noexcept
+  {
+    return m_size;
+  }
+
+  /*! \return Whether the indexed range is empty. */
+  bool empty() const noexcept
+  {
+    return m_size == 0;
+  }
+
+  /*! \return The ordering of the indexed range. */
+  value_compare value_comp() const
+  {
+    return m_comp;
+  }
+
+  /*! \return The position of the first element of the indexed range that is not less than \p value, or \p size() if
+   *  there is none.
+   */
+  template <typename U>
+  size_type lower_bound(const U& value) const
+  {
+    thrust::detail::wrapped_function<StrictWeakOrdering, bool> comp{m_comp};
+    return search([&](const T& key) {
+      return comp(key, value);
+    });
+  }
+
+  /*! \return The position of the first element of the indexed range that is greater than \p value, or \p size() if
+   *  there is none.
+   */
+  template <typename U>
+  size_type upper_bound(const U& value) const
+  {
+    thrust::detail::wrapped_function<StrictWeakOrdering, bool> comp{m_comp};
+    return search([&](const T& key) {
+      return !comp(value, key);
+    });
+  }
+
+  /*! \return Whether the indexed range contains an element equivalent to \p value. */
+  template <typename U>
+  bool binary_search(const U& value) const
+  {
+    thrust::detail::wrapped_function<StrictWeakOrdering, bool> comp{m_comp};
+    const T* keys = tree();
+    size_type k   = descend([&](const T& key) {
+      return comp(key, value);
+    });
+    return k != 0 && !comp(value, keys[k]);
+  }
+
+private:
+  static constexpr size_type cache_line_size = 64;
+  static constexpr size_type keys_per_line   = ::cuda::std::bit_floor(
+    cache_line_size / sizeof(T) > 0 ? cache_line_size / sizeof(T) : size_type{1});
+
+  size_type m_size;
+  size_type m_offset = 0;
+  std::vector<T> m_keys;
+  std::vector<size_type> m_ranks;
+  StrictWeakOrdering m_comp;
+
+  const T* tree() const
+  {
+    return m_keys.data() + m_offset;
+  }
+
+  // Assigns the elements from position i of the sorted range to the subtree rooted at k in order and returns the
+  // position after them. The recursion depth is the height of the tree.
+  template <typename RandomAccessIterator>
+  size_type build(RandomAccessIterator first, size_type i, size_type k)
+  {
+    if (k <= m_size)
+    {
+      i                    = build(first, i, 2 * k);
+      m_keys[m_offset + k] = first[i];
+      m_ranks[k]           = i;
+      i                    = build(first, i + 1, 2 * k + 1);
+    }
+    return i;
+  }
+
+  // Descends from the root, going right whenever precedes(key) holds, and returns the position in the tree of the first
+  // element for which it does not hold, or 0
+  template <typename Precedes>
+  size_type descend(Precedes precedes) const
+  {
+    const T* keys = tree();
+    size_type k   = 1;
+    while (k <= m_size)
+    {
+      // The descendants of k that are log2(keys_per_line) levels below start at k * keys_per_line
+      _CCCL_BUILTIN_PREFETCH(keys + (::cuda::std::min) (k * keys_per_line, m_size))
+      k = 2 * k + static_cast<size_type>(precedes(keys[k]));
+    }
+    // The path ends with a right turn for every trailing one bit after the node of the result
+    return k >> (::cuda::std::countr_one(k) + 1);
+  }
+
+  template <typename Precedes>
+  size_type search(Precedes precedes) const
+  {
+    return m_ranks[descend(precedes)];
+  }
+};
+
+namespace detail
+{
+template <typename Index>
+struct eytzinger_lower_bound
+{
+  const Index* index;
+
+  template <typename U>
+  typename Index::size_type operator()(const U& value) const
+  {
+    return index->lower_bound(value);
+  }
+};
+
+template <typename Index>
+struct eytzinger_upper_bound
+{
+  const Index* index;
+
+  template <typename U>
+  typename Index::size_type operator()(const U& value) const
+  {
+    return index->upper_bound(value);
+  }
+};
+
+template <typename Index>
+struct eytzinger_binary_search
+{
+  const Index* index;
+
+  template <typename U>
+  bool operator()(const U& value) const
+  {
+    return index->binary_search(value);
+  }
+};
+
+template <typename DerivedPolicy>
+inline constexpr bool is_host_execution_policy_v =
+  ::cuda::std::is_base_of_v<thrust::system::detail::sequential::execution_policy<DerivedPolicy>, DerivedPolicy>;
+
+template <typename InputIterator, typename OutputIterator>
+auto select_eytzinger_search_system()
+{
+  using thrust::system::detail::generic::select_system;
+  using system1 = typename thrust::iterator_system<InputIterator>::type;
+  using system2 = typename thrust::iterator_system<OutputIterator>::type;
+  system1 s1;
+  system2 s2;
+  return select_system(s1, s2);
+}
+} // namespace detail
+
+/*! \p lower_bound searches the range indexed by \p index for each value in <tt>[values_first, values_last)</tt> and
+ *  writes the position of its lower bound to \p output, like the vectorized \p lower_bound over the sorted range.
+ *
+ *  \param exec The execution policy to use for parallelization. It must be a policy of a host system.
+ *  \param index The index of the sorted range to search.
+ *  \param values_first The beginning of the search values sequence.
+ *  \param values_last The end of the search values sequence.
+ *  \param output The beginning of the output sequence.
+ *  \return The end of the output sequence.
+ *
+ *  \see \p eytzinger_index
+ */
+template <typename DerivedPolicy,
+          typename T,
+          typename StrictWeakOrdering,
+          typename InputIterator,
+          typename OutputIterator>
+OutputIterator lower_bound(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  const eytzinger_index<T, StrictWeakOrdering>& index,
+  InputIterator values_first,
+  InputIterator values_last,
+  OutputIterator output)
+{
+  static_assert(detail::is_host_execution_policy_v<DerivedPolicy>, "eytzinger_index is only searched on the host");
+  using index_type = eytzinger_index<T, StrictWeakOrdering>;
+  return thrust::transform(exec, values_first, values_last, output, detail::eytzinger_lower_bound<index_type>{&index});
+}
+
+/*! \p lower_bound searches the range indexed by \p index for each value in <tt>[values_first, values_last)</tt> and
+ *  writes the position of its lower bound to \p output, like the vectorized \p lower_bound over the sorted range.
+ *
+ *  \param index The index of the sorted range to search.
+ *  \param values_first The beginning of the search values sequence.
+ *  \param values_last The end of the search values sequence.
+ *  \param output The beginning of the output sequence.
+ *  \return The end of the output sequence.
+ *
+ *  \see \p eytzinger_index
+ */
+template <typename T, typename StrictWeakOrdering, typename InputIterator, typename OutputIterator>
+OutputIterator lower_bound(const eytzinger_index<T, StrictWeakOrdering>& index,
+                           InputIterator values_first,
+                           InputIterator values_last,
+                           OutputIterator output)
+{
+  return thrust::lower_bound(
+    detail::select_eytzinger_search_system<InputIterator, OutputIterator>(), index, values_first, values_last, output);
+}
+
+/*! \p upper_bound searches the range indexed by \p index for each value in <tt>[values_first, values_last)</tt> and
+ *  writes the position of its upper bound to \p output, like the vectorized \p upper_bound over the sorted range.
+ *
+ *  \param exec The execution policy to use for parallelization. It must be a policy of a host system.
+ *  \param index The index of the sorted range to search.
+ *  \param values_first The beginning of the search values sequence.
+ *  \param values_last The end of the search values sequence.
+ *  \param output The beginning of the output sequence.
+ *  \return The end of the output sequence.
+ *
+ *  \see \p eytzinger_index
+ */
+template <typename DerivedPolicy,
+          typename T,
+          typename StrictWeakOrdering,
+          typename InputIterator,
+          typename OutputIterator>
+OutputIterator upper_bound(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  const eytzinger_index<T, StrictWeakOrdering>& index,
+  InputIterator values_first,
+  InputIterator values_last,
+  OutputIterator output)
+{
+  static_assert(detail::is_host_execution_policy_v<DerivedPolicy>, "eytzinger_index is only searched on the host");
+  using index_type = eytzinger_index<T, StrictWeakOrdering>;
+  return thrust::transform(exec, values_first, values_last, output, detail::eytzinger_upper_bound<index_type>{&index});
+}
+
+/*! \p upper_bound searches the range indexed by \p index for each value in <tt>[values_first, values_last)</tt> and
+ *  writes the position of its upper bound to \p output, like the vectorized \p upper_bound over the sorted range.
+ *
+ *  \param index The index of the sorted range to search.
+ *  \param values_first The beginning of the search values sequence.
+ *  \param values_last The end of the search values sequence.
+ *  \param output The beginning of the output sequence.
+ *  \return The end of the output sequence.
+ *
+ *  \see \p eytzinger_index
+ */
+template <typename T, typename StrictWeakOrdering, typename InputIterator, typename OutputIterator>
+OutputIterator upper_bound(const eytzinger_index<T, StrictWeakOrdering>& index,
+                           InputIterator values_first,
+                           InputIterator values_last,
+                           OutputIterator output)
+{
+  return thrust::upper_bound(
+    detail::select_eytzinger_search_system<InputIterator, OutputIterator>(), index, values_first, values_last, output);
+}
+
+/*! \p binary_search searches the range indexed by \p index for each value in <tt>[values_first, values_last)</tt> and
+ *  writes whether the range contains an equivalent element to \p output, like the vectorized \p binary_search over the
+ *  sorted range.
+ *
+ *  \param exec The execution policy to use for parallelization. It must be a policy of a host system.
+ *  \param index The index of the sorted range to search.
+ *  \param values_first The beginning of the search values sequence.
+ *  \param values_last The end of the search values sequence.
+ *  \param output The beginning of the output sequence.
+ *  \return The end of the output sequence.
+ *
+ *  \see \p eytzinger_index
+ */
+template <typename DerivedPolicy,
+          typename T,
+          typename StrictWeakOrdering,
+          typename InputIterator,
+          typename OutputIterator>
+OutputIterator binary_search(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  const eytzinger_index<T, StrictWeakOrdering>& index,
+  InputIterator values_first,
+  InputIterator values_last,
+  OutputIterator output)
+{
+  static_assert(detail::is_host_execution_policy_v<DerivedPolicy>, "eytzinger_index is only searched on the host");
+  using index_type = eytzinger_index<T, StrictWeakOrdering>;
+  return thrust::transform(
+    exec, values_first, values_last, output, detail::eytzinger_binary_search<index_type>{&index});
+}
+
+/*! \p binary_search searches the range indexed by \p index for each value in <tt>[values_first, values_last)</tt> and
+ *  writes whether the range contains an equivalent element to \p output, like the vectorized \p binary_search over the
+ *  sorted range.
+ *
+ *  \param index The index of the sorted range to search.
+ *  \param values_first The beginning of the search values sequence.
+ *  \param values_last The end of the search values sequence.
+ *  \param output The beginning of the output sequence.
+ *  \return The end of the output sequence.
+ *
+ *  \see \p eytzinger_index
+ */
+template <typename T, typename StrictWeakOrdering, typename InputIterator, typename OutputIterator>
+OutputIterator binary_search(const eytzinger_index<T, StrictWeakOrdering>& index,
+                             InputIterator values_first,
+                             InputIterator values_last,
+                             OutputIterator output)
+{
+  return thrust::binary_search(
+    detail::select_eytzinger_search_system<InputIterator, OutputIterator>(), index, values_first, values_last, output);
+}
+
+/*! \} // end vectorized_binary_search
+ */
+
+THRUST_NAMESPACE_END
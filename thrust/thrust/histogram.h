@@ -0,0 +1,444 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file histogram.h
+ *  \brief Functions for counting the samples of a range that fall into bins
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+
+#include <cuda/std/array>
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup reductions
+ *  \{
+ */
+
+/*! \p histogram_even counts the samples of the range <tt>[first, last)</tt> that fall into each of
+ *  <tt>num_levels - 1</tt> bins of equal width, which evenly subdivide <tt>[lower_level, upper_level)</tt>. The
+ *  count of bin \c i is written to <tt>histogram[i]</tt>, overwriting its previous value. Samples outside of
+ *  <tt>[lower_level, upper_level)</tt> are not counted. The bins are the same as those of
+ *  <tt>cub::DeviceHistogram::HistogramEven</tt>.
+ *
+ *  Unlike sorting the samples and searching for the bin boundaries, \p histogram_even does not reorder or copy the
+ *  input, and it runs in linear time on the host backends.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence of samples.
+ *  \param last The end of the sequence of samples.
+ *  \param histogram The beginning of the sequence of <tt>num_levels - 1</tt> bin counts.
+ *  \param num_levels The number of bin boundaries, which is one more than the number of bins.
+ *  \param lower_level The inclusive lower bound of the lowest bin.
+ *  \param upper_level The exclusive upper bound of the highest bin.
+ *  \return The end of the sequence of bin counts.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a> and its \c value_type is an arithmetic type.
+ *  \tparam OutputIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type which is used to count the samples.
+ *  \tparam LevelT is an arithmetic type.
+ *
+ *  \pre \p lower_level shall be less than \p upper_level.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_even to count samples in five bins using the \p
+ *  thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  float samples[10] = {2.2f, 6.f, 7.1f, 2.9f, 3.5f, 0.3f, 2.9f, 2.1f, 6.1f, 999.5f};
+ *  int counts[5];
+ *  thrust::histogram_even(thrust::host, samples, samples + 10, counts, 6, 0.f, 10.f);
+ *  // counts is now {1, 5, 0, 3, 0}
+ *  \endcode
+ *
+ *  \see \p histogram_range
+ *  \see \p multi_histogram_even
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename LevelT>
+_CCCL_HOST_DEVICE OutputIterator histogram_even(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  LevelT lower_level,
+  LevelT upper_level);
+
+/*! \p histogram_even counts the samples of the range <tt>[first, last)</tt> that fall into each of
+ *  <tt>num_levels - 1</tt> bins of equal width, which evenly subdivide <tt>[lower_level, upper_level)</tt>. The
+ *  count of bin \c i is written to <tt>histogram[i]</tt>, overwriting its previous value. Samples outside of
+ *  <tt>[lower_level, upper_level)</tt> are not counted.
+ *
+ *  \param first The beginning of the sequence of samples.
+ *  \param last The end of the sequence of samples.
+ *  \param histogram The beginning of the sequence of <tt>num_levels - 1</tt> bin counts.
+ *  \param num_levels The number of bin boundaries, which is one more than the number of bins.
+ *  \param lower_level The inclusive lower bound of the lowest bin.
+ *  \param upper_level The exclusive upper bound of the highest bin.
+ *  \return The end of the sequence of bin counts.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a> and its \c value_type is an arithmetic type.
+ *  \tparam OutputIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type which is used to count the samples.
+ *  \tparam LevelT is an arithmetic type.
+ *
+ *  \pre \p lower_level shall be less than \p upper_level.
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/device_vector.h>
+ *  ...
+ *  thrust::device_vector<float> samples{2.2f, 6.f, 7.1f, 2.9f, 3.5f, 0.3f, 2.9f, 2.1f, 6.1f, 999.5f};
+ *  thrust::device_vector<int> counts(5);
+ *  thrust::histogram_even(samples.begin(), samples.end(), counts.begin(), 6, 0.f, 10.f);
+ *  // counts is now {1, 5, 0, 3, 0}
+ *  \endcode
+ *
+ *  \see \p histogram_range
+ *  \see \p multi_histogram_even
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename InputIterator, typename OutputIterator, typename LevelT>
+OutputIterator histogram_even(
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  LevelT lower_level,
+  LevelT upper_level);
+
+/*! \p histogram_range counts the samples of the range <tt>[first, last)</tt> that fall into each of the bins
+ *  <tt>[levels_first[i], levels_first[i + 1])</tt>. The count of bin \c i is written to <tt>histogram[i]</tt>,
+ *  overwriting its previous value. Samples that are in no bin are not counted.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence of samples.
+ *  \param last The end of the sequence of samples.
+ *  \param histogram The beginning of the sequence of <tt>levels_last - levels_first - 1</tt> bin counts.
+ *  \param levels_first The beginning of the sorted sequence of bin boundaries.
+ *  \param levels_last The end of the sorted sequence of bin boundaries.
+ *  \return The end of the sequence of bin counts.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a> and its \c value_type is convertible to \p LevelIterator's \c value_type.
+ *  \tparam OutputIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type which is used to count the samples.
+ *  \tparam LevelIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *
+ *  \pre The range <tt>[levels_first, levels_last)</tt> shall be sorted in ascending order.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_range to count samples in bins of different
+ *  widths using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  float samples[10] = {2.2f, 6.f, 7.1f, 2.9f, 3.5f, 0.3f, 2.9f, 2.1f, 6.1f, 999.5f};
+ *  float levels[7]   = {0.f, 2.f, 4.f, 6.f, 8.f, 12.f, 16.f};
+ *  int counts[6];
+ *  thrust::histogram_range(thrust::host, samples, samples + 10, counts, levels, levels + 7);
+ *  // counts is now {1, 5, 0, 3, 0, 0}
+ *  \endcode
+ *
+ *  \see \p histogram_even
+ *  \see \p multi_histogram_range
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename LevelIterator>
+_CCCL_HOST_DEVICE OutputIterator histogram_range(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  LevelIterator levels_first,
+  LevelIterator levels_last);
+
+/*! \p histogram_range counts the samples of the range <tt>[first, last)</tt> that fall into each of the bins
+ *  <tt>[levels_first[i], levels_first[i + 1])</tt>. The count of bin \c i is written to <tt>histogram[i]</tt>,
+ *  overwriting its previous value. Samples that are in no bin are not counted.
+ *
+ *  \param first The beginning of the sequence of samples.
+ *  \param last The end of the sequence of samples.
+ *  \param histogram The beginning of the sequence of <tt>levels_last - levels_first - 1</tt> bin counts.
+ *  \param levels_first The beginning of the sorted sequence of bin boundaries.
+ *  \param levels_last The end of the sorted sequence of bin boundaries.
+ *  \return The end of the sequence of bin counts.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a> and its \c value_type is convertible to \p LevelIterator's \c value_type.
+ *  \tparam OutputIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type which is used to count the samples.
+ *  \tparam LevelIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *
+ *  \pre The range <tt>[levels_first, levels_last)</tt> shall be sorted in ascending order.
+ *
+ *  \see \p histogram_even
+ *  \see \p multi_histogram_range
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename InputIterator, typename OutputIterator, typename LevelIterator>
+OutputIterator histogram_range(
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  LevelIterator levels_first,
+  LevelIterator levels_last);
+
+/*! \p multi_histogram_even computes a separate \p histogram_even for each of the first \p NumActiveChannels channels
+ *  of interleaved samples. The range <tt>[first, last)</tt> is a sequence of pixels of \p NumChannels samples each,
+ *  such as RGBA values, and a trailing partial pixel is ignored. The bins of channel \c c subdivide
+ *  <tt>[lower_levels[c], upper_levels[c])</tt> into <tt>num_levels[c] - 1</tt> bins of equal width, and their counts
+ *  are written to <tt>histograms[c]</tt>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence of interleaved samples.
+ *  \param last The end of the sequence of interleaved samples.
+ *  \param histograms The beginnings of the sequences of bin counts of each active channel.
+ *  \param num_levels The number of bin boundaries of each active channel.
+ *  \param lower_levels The inclusive lower bound of the lowest bin of each active channel.
+ *  \param upper_levels The exclusive upper bound of the highest bin of each active channel.
+ *
+ *  \tparam NumChannels The number of samples per pixel.
+ *  \tparam NumActiveChannels The number of leading channels of each pixel which are counted.
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an arithmetic type.
+ *  \tparam OutputIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type which is used to count the samples.
+ *  \tparam LevelT is an arithmetic type.
+ *
+ *  The following code snippet demonstrates how to use \p multi_histogram_even to count the red, green and blue
+ *  samples of RGBA pixels using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  unsigned char pixels[8] = {2, 6, 7, 5, 3, 0, 2, 1};
+ *  int red[2], green[2], blue[2];
+ *  thrust::multi_histogram_even<4, 3>(
+ *    thrust::host,
+ *    pixels,
+ *    pixels + 8,
+ *    cuda::std::array<int*, 3>{red, green, blue},
+ *    cuda::std::array<int, 3>{3, 3, 3},
+ *    cuda::std::array<int, 3>{0, 0, 0},
+ *    cuda::std::array<int, 3>{8, 8, 8});
+ *  // red is now {2, 0}, green is now {1, 1} and blue is now {1, 1}
+ *  \endcode
+ *
+ *  \see \p histogram_even
+ *  \see \p multi_histogram_range
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <::cuda::std::size_t NumChannels,
+          ::cuda::std::size_t NumActiveChannels,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename LevelT>
+_CCCL_HOST_DEVICE void multi_histogram_even(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  const ::cuda::std::array<OutputIterator, NumActiveChannels>& histograms,
+  const ::cuda::std::array<int, NumActiveChannels>& num_levels,
+  const ::cuda::std::array<LevelT, NumActiveChannels>& lower_levels,
+  const ::cuda::std::array<LevelT, NumActiveChannels>& upper_levels);
+
+/*! \p multi_histogram_even computes a separate \p histogram_even for each of the first \p NumActiveChannels channels
+ *  of interleaved samples. The range <tt>[first, last)</tt> is a sequence of pixels of \p NumChannels samples each,
+ *  and a trailing partial pixel is ignored. The bins of channel \c c subdivide
+ *  <tt>[lower_levels[c], upper_levels[c])</tt> into <tt>num_levels[c] - 1</tt> bins of equal width, and their counts
+ *  are written to <tt>histograms[c]</tt>.
+ *
+ *  \param first The beginning of the sequence of interleaved samples.
+ *  \param last The end of the sequence of interleaved samples.
+ *  \param histograms The beginnings of the sequences of bin counts of each active channel.
+ *  \param num_levels The number of bin boundaries of each active channel.
+ *  \param lower_levels The inclusive lower bound of the lowest bin of each active channel.
+ *  \param upper_levels The exclusive upper bound of the highest bin of each active channel.
+ *
+ *  \tparam NumChannels The number of samples per pixel.
+ *  \tparam NumActiveChannels The number of leading channels of each pixel which are counted.
+ *  \tparam InputIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an arithmetic type.
+ *  \tparam OutputIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type which is used to count the samples.
+ *  \tparam LevelT is an arithmetic type.
+ *
+ *  \see \p histogram_even
+ *  \see \p multi_histogram_range
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <::cuda::std::size_t NumChannels,
+          ::cuda::std::size_t NumActiveChannels,
+          typename InputIterator,
+          typename OutputIterator,
+          typename LevelT>
+void multi_histogram_even(
+  InputIterator first,
+  InputIterator last,
+  const ::cuda::std::array<OutputIterator, NumActiveChannels>& histograms,
+  const ::cuda::std::array<int, NumActiveChannels>& num_levels,
+  const ::cuda::std::array<LevelT, NumActiveChannels>& lower_levels,
+  const ::cuda::std::array<LevelT, NumActiveChannels>& upper_levels);
+
+/*! \p multi_histogram_range computes a separate \p histogram_range for each of the first \p NumActiveChannels
+ *  channels of interleaved samples. The range <tt>[first, last)</tt> is a sequence of pixels of \p NumChannels samples
+ *  each, and a trailing partial pixel is ignored. The bins of channel \c c are
+ *  <tt>[levels[c][i], levels[c][i + 1])</tt> for every \c i in <tt>[0, num_levels[c] - 1)</tt>, and their counts are
+ *  written to <tt>histograms[c]</tt>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence of interleaved samples.
+ *  \param last The end of the sequence of interleaved samples.
+ *  \param histograms The beginnings of the sequences of bin counts of each active channel.
+ *  \param num_levels The number of bin boundaries of each active channel.
+ *  \param levels The beginnings of the sorted sequences of bin boundaries of each active channel.
+ *
+ *  \tparam NumChannels The number of samples per pixel.
+ *  \tparam NumActiveChannels The number of leading channels of each pixel which are counted.
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is convertible to \p LevelIterator's \c value_type.
+ *  \tparam OutputIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type which is used to count the samples.
+ *  \tparam LevelIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *
+ *  \pre Each of the ranges <tt>[levels[c], levels[c] + num_levels[c])</tt> shall be sorted in ascending order.
+ *
+ *  \see \p histogram_range
+ *  \see \p multi_histogram_even
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <::cuda::std::size_t NumChannels,
+          ::cuda::std::size_t NumActiveChannels,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename LevelIterator>
+_CCCL_HOST_DEVICE void multi_histogram_range(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  const ::cuda::std::array<OutputIterator, NumActiveChannels>& histograms,
+  const ::cuda::std::array<int, NumActiveChannels>& num_levels,
+  const ::cuda::std::array<LevelIterator, NumActiveChannels>& levels);
+
+/*! \p multi_histogram_range computes a separate \p histogram_range for each of the first \p NumActiveChannels
+ *  channels of interleaved samples. The range <tt>[first, last)</tt> is a sequence of pixels of \p NumChannels samples
+ *  each, and a trailing partial pixel is ignored. The bins of channel \c c are
+ *  <tt>[levels[c][i], levels[c][i + 1])</tt> for every \c i in <tt>[0, num_levels[c] - 1)</tt>, and their counts are
+ *  written to <tt>histograms[c]</tt>.
+ *
+ *  \param first The beginning of the sequence of interleaved samples.
+ *  \param last The end of the sequence of interleaved samples.
+ *  \param histograms The beginnings of the sequences of bin counts of each active channel.
+ *  \param num_levels The number of bin boundaries of each active channel.
+ *  \param levels The beginnings of the sorted sequences of bin boundaries of each active channel.
+ *
+ *  \tparam NumChannels The number of samples per pixel.
+ *  \tparam NumActiveChannels The number of leading channels of each pixel which are counted.
+ *  \tparam InputIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is convertible to \p LevelIterator's \c value_type.
+ *  \tparam OutputIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type which is used to count the samples.
+ *  \tparam LevelIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *
+ *  \pre Each of the ranges <tt>[levels[c], levels[c] + num_levels[c])</tt> shall be sorted in ascending order.
+ *
+ *  \see \p histogram_range
+ *  \see \p multi_histogram_even
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <::cuda::std::size_t NumChannels,
+          ::cuda::std::size_t NumActiveChannels,
+          typename InputIterator,
+          typename OutputIterator,
+          typename LevelIterator>
+void multi_histogram_range(
+  InputIterator first,
+  InputIterator last,
+  const ::cuda::std::array<OutputIterator, NumActiveChannels>& histograms,
+  const ::cuda::std::array<int, NumActiveChannels>& num_levels,
+  const ::cuda::std::array<LevelIterator, NumActiveChannels>& levels);
+
+/*! \} // end reductions
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/histogram.inl>
@@ -0,0 +1,377 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file
+ *  \brief Records the algorithm calls of the host systems and exports them as traces or counters.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <ios>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace instrumentation
+{
+/** \addtogroup instrumentation Instrumentation
+ *  \ingroup utility
+ *  \{
+ */
+
+/*! The record of a single algorithm call of the \p cpp, \p omp or \p tbb system.
+ *
+ *  Calls are only recorded if \p THRUST_ENABLE_HOST_INSTRUMENTATION is defined before any Thrust header is included.
+ *  Calls with \p thrust::seq and with device systems are never recorded.
+ */
+struct call_record
+{
+  /*! The name of the algorithm, such as <tt>"thrust::sort"</tt>. */
+  const char* algorithm;
+  /*! The name of the system which executed the call: <tt>"cpp"</tt>, <tt>"omp"</tt> or <tt>"tbb"</tt>. */
+  const char* system;
+  /*! The number of elements of the first input sequence, or 0 if it is not known without traversing the sequence. */
+  std::size_t num_items;
+  /*! The size of the first input sequence in bytes, <tt>num_items * sizeof(value_type)</tt>. Other input and output
+   *  sequences are not counted.
+   */
+  std::size_t input_bytes;
+  /*! The number of threads which ran the parallel regions of the call and of the calls it made, or 1 if none of them
+   *  ran in parallel. For \p omp, this is the largest team of a parallel region. For \p tbb, which does not assign
+   *  threads to an algorithm, this is the concurrency of the task arena which ran a parallel algorithm.
+   */
+  int threads;
+  /*! The number of threads the system could use for the call. A call with fewer \p threads ran serially or on a
+   *  smaller team, for example because it was nested in a parallel region or took a sequential code path.
+   */
+  int max_threads;
+  /*! The number of bytes of temporary storage allocated by the call, including those of the calls it made. */
+  std::size_t temporary_bytes;
+  /*! The number of temporary buffers allocated by the call, including those of the calls it made. */
+  std::size_t temporary_allocations;
+  /*! The number of instrumented calls on the same thread that the call was made from. */
+  int depth;
+  /*! A small number identifying the host thread which made the call. */
+  int thread_index;
+  /*! The time at which the call started. */
+  std::chrono::steady_clock::time_point start;
+  /*! The wall time of the call, measured with \p std::chrono::steady_clock. */
+  std::chrono::nanoseconds wall_time;
+};
+
+/*! The type of the functions which are invoked for every recorded call.
+ *
+ *  The callback is invoked on the thread which made the call, after the call finished. Invocations are serialized, and
+ *  algorithm calls made by the callback itself are not recorded.
+ */
+using callback_type = void (*)(const call_record& record, void* user_data);
+
+namespace detail
+{
+struct callback_registry
+{
+  std::mutex mutex;
+  callback_type callback = nullptr;
+  void* user_data        = nullptr;
+  std::atomic<bool> enabled{false};
+};
+
+inline callback_registry& registry()
+{
+  static callback_registry instance;
+  return instance;
+}
+
+inline bool& in_callback()
+{
+  thread_local bool invoking = false;
+  return invoking;
+}
+
+inline int this_thread_index()
+{
+  static std::atomic<int> next_index{0};
+  thread_local const int index = next_index++;
+  return index;
+}
+
+inline void invoke_callback(const call_record& record)
+{
+  callback_registry& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  if (r.callback != nullptr)
+  {
+    in_callback() = true;
+    r.callback(record, r.user_data);
+    in_callback() = false;
+  }
+}
+
+inline void write_json_string(std::ostream& os, const char* s)
+{
+  os << '"';
+  for (; *s != '\0'; ++s)
+  {
+    if (*s == '"' || *s == '\\')
+    {
+      os << '\\';
+    }
+    os << *s;
+  }
+  os << '"';
+}
+} // namespace detail
+
+/*! Registers the function which is invoked for every recorded call, replacing the previous one. Once this function
+ *  returns, the previous callback is no longer invoked.
+ *
+ *  \param callback The function to invoke, or \c nullptr to stop recording.
+ *  \param user_data The pointer passed to \p callback.
+ */
+inline void set_callback(callback_type callback, void* user_data = nullptr)
+{
+  detail::callback_registry& r = detail::registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  r.callback  = callback;
+  r.user_data = user_data;
+  r.enabled.store(callback != nullptr, std::memory_order_relaxed);
+}
+
+/*! A ring buffer which keeps the most recent call records.
+ *
+ *  The following code snippet demonstrates how to trace the algorithm calls of a section of a program:
+ *
+ *  \code
+ *  #define THRUST_ENABLE_HOST_INSTRUMENTATION
+ *  #include <thrust/instrumentation.h>
+ *  #include <thrust/sort.h>
+ *  #include <thrust/system/omp/execution_policy.h>
+ *  #include <fstream>
+ *  ...
+ *  thrust::instrumentation::trace_buffer trace(4096);
+ *  trace.attach();
+ *  thrust::sort(thrust::omp::par, data.begin(), data.end());
+ *  trace.detach();
+ *
+ *  std::ofstream file("trace.json");
+ *  thrust::instrumentation::write_chrome_trace(file, trace.records());
+ *  \endcode
+ */
+class trace_buffer
+{
+public:
+  /*! Constructs a \p trace_buffer.
+   *
+   *  \param capacity The number of records that are kept. Once it is full, every new record replaces the oldest one.
+   */
+  explicit trace_buffer(std::size_t capacity)
+      : m_records(capacity > 0 ? capacity : 1)
+      , m_next(0)
+      , m_size(0)
+      , m_dropped(0)
+  {}
+
+  trace_buffer(const trace_buffer&)            = delete;
+  trace_buffer& operator=(const trace_buffer&) = delete;
+
+  /*! Destructor. Detaches the buffer if it is attached.
+   */
+  ~trace_buffer()
+  {
+    detach();
+  }
+
+  /*! Registers this buffer as the callback of all recorded calls, replacing the previous callback.
+   */
+  void attach()
+  {
+    set_callback(&trace_buffer::callback, this);
+  }
+
+  /*! Stops recording into this buffer if it is the registered callback.
+   */
+  void detach()
+  {
+    detail::callback_registry& r = detail::registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    if (r.callback == &trace_buffer::callback && r.user_data == this)
+    {
+      r.callback  = nullptr;
+      r.user_data = nullptr;
+      r.enabled.store(false, std::memory_order_relaxed);
+    }
+  }
+
+  /*! Adds a record, replacing the oldest one if the buffer is full.
+   */
+  void record(const call_record& r)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_records[m_next] = r;
+    m_next            = (m_next + 1) % m_records.size();
+    if (m_size < m_records.size())
+    {
+      ++m_size;
+    }
+    else
+    {
+      ++m_dropped;
+    }
+  }
+
+  /*! \return The records in the buffer, from the oldest to the most recent.
+   */
+  std::vector<call_record> records() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<call_record> result;
+    result.reserve(m_size);
+    for (std::size_t i = m_records.size() - m_size; i < m_records.size(); ++i)
+    {
+      result.push_back(m_records[(m_next + i) % m_records.size()]);
+    }
+    return result;
+  }
+
+  /*! \return The number of records which were replaced by more recent ones.
+   */
+  std::size_t dropped() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_dropped;
+  }
+
+  /*! Removes all records.
+   */
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_next    = 0;
+    m_size    = 0;
+    m_dropped = 0;
+  }
+
+  /*! A \p callback_type which adds the record to the \p trace_buffer pointed to by \p buffer.
+   */
+  static void callback(const call_record& r, void* buffer)
+  {
+    static_cast<trace_buffer*>(buffer)->record(r);
+  }
+
+private:
+  mutable std::mutex m_mutex;
+  std::vector<call_record> m_records;
+  std::size_t m_next;
+  std::size_t m_size;
+  std::size_t m_dropped;
+};
+
+/*! Writes call records in the Trace Event Format of the Chrome and Perfetto trace viewers. Every call becomes a
+ *  complete event on the track of its host thread, with its sizes and threads as arguments.
+ *
+ *  \param os The stream to write to.
+ *  \param records The records to write.
+ */
+inline void write_chrome_trace(std::ostream& os, const std::vector<call_record>& records)
+{
+  using microseconds = std::chrono::duration<double, std::micro>;
+
+  std::chrono::steady_clock::time_point origin{};
+  for (std::size_t i = 0; i < records.size(); ++i)
+  {
+    if (i == 0 || records[i].start < origin)
+    {
+      origin = records[i].start;
+    }
+  }
+
+  // Timestamps are written in microseconds with nanosecond precision
+  const std::ios_base::fmtflags flags = os.flags();
+  const std::streamsize precision     = os.precision(3);
+  os.setf(std::ios_base::fixed, std::ios_base::floatfield);
+
+  os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  for (std::size_t i = 0; i < records.size(); ++i)
+  {
+    const call_record& r = records[i];
+    os << (i == 0 ? "\n" : ",\n") << "{\"name\":";
+    detail::write_json_string(os, r.algorithm);
+    os << ",\"cat\":";
+    detail::write_json_string(os, r.system);
+    os << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << r.thread_index
+       << ",\"ts\":" << microseconds(r.start - origin).count() << ",\"dur\":" << microseconds(r.wall_time).count()
+       << ",\"args\":{\"items\":" << r.num_items << ",\"input_bytes\":" << r.input_bytes
+       << ",\"threads\":" << r.threads << ",\"max_threads\":" << r.max_threads
+       << ",\"temporary_bytes\":" << r.temporary_bytes << ",\"temporary_allocations\":" << r.temporary_allocations
+       << "}}";
+  }
+  os << "\n]}\n";
+
+  os.flags(flags);
+  os.precision(precision);
+}
+
+/*! Writes the totals of the call records of every algorithm and system as comma-separated values, in the style of
+ *  <tt>perf stat -x,</tt>. The first line names the columns:
+ *  <tt>algorithm,system,calls,serial_calls,items,input_bytes,temporary_bytes,temporary_allocations,wall_ns</tt>.
+ *  \p serial_calls counts the calls which ran on a single thread although the system could use more.
+ *
+ *  \param os The stream to write to.
+ *  \param records The records to sum up.
+ */
+inline void write_counters(std::ostream& os, const std::vector<call_record>& records)
+{
+  struct totals
+  {
+    std::size_t calls;
+    std::size_t serial_calls;
+    std::size_t items;
+    std::size_t input_bytes;
+    std::size_t temporary_bytes;
+    std::size_t temporary_allocations;
+    std::chrono::nanoseconds wall_time;
+  };
+
+  std::map<std::pair<std::string, std::string>, totals> counters;
+  for (const call_record& r : records)
+  {
+    totals& t = counters.try_emplace({r.algorithm, r.system}, totals{}).first->second;
+    ++t.calls;
+    t.serial_calls += r.threads <= 1 && r.max_threads > 1;
+    t.items += r.num_items;
+    t.input_bytes += r.input_bytes;
+    t.temporary_bytes += r.temporary_bytes;
+    t.temporary_allocations += r.temporary_allocations;
+    t.wall_time += r.wall_time;
+  }
+
+  os << "algorithm,system,calls,serial_calls,items,input_bytes,temporary_bytes,temporary_allocations,wall_ns\n";
+  for (const auto& [key, t] : counters)
+  {
+    os << key.first << ',' << key.second << ',' << t.calls << ',' << t.serial_calls << ',' << t.items << ','
+       << t.input_bytes << ',' << t.temporary_bytes << ',' << t.temporary_allocations << ','
+       << t.wall_time.count() << '\n';
+  }
+}
+
+/*! \} // end instrumentation
+ */
+} // namespace instrumentation
+THRUST_NAMESPACE_END
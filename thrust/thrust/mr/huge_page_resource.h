@@ -0,0 +1,205 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file
+ *  \brief A memory resource that backs large host allocations with huge pages.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/new.h>
+#include <thrust/system/detail/bad_alloc.h>
+
+#include <cuda/__cmath/round_up.h>
+#include <cuda/std/cstdint>
+
+#if !_CCCL_OS(WINDOWS)
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif // !_CCCL_OS(WINDOWS)
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+/** \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! The kind of pages \p huge_page_resource requests for large allocations.
+ */
+enum class huge_page_kind
+{
+  /*! Map regular pages and advise the kernel to back them with transparent huge pages (\c MADV_HUGEPAGE). */
+  transparent,
+  /*! Map explicit 2 MiB pages from the hugetlbfs pool, or transparent huge pages if the pool is exhausted. */
+  explicit_2mb,
+  /*! Map explicit 1 GiB pages from the hugetlbfs pool, or transparent huge pages if the pool is exhausted. */
+  explicit_1gb
+};
+
+/*! A memory resource that serves allocations of at least \p threshold bytes with \c mmap, backed by huge pages, and
+ *  forwards smaller allocations to \p new_delete_resource.
+ *
+ *  Multi-gigabyte host buffers mapped with the default 4 KiB pages cause a TLB miss on almost every random access, as
+ *  in \p gather and \p scatter. Backing them with 2 MiB or 1 GiB pages removes most of these misses. Freshly mapped
+ *  memory is zeroed lazily by the kernel, one huge page at a time.
+ *
+ *  Defining \p THRUST_HOST_MEMORY_USE_HUGE_PAGES makes this resource the upstream of the memory resources and the
+ *  temporary buffers of the host systems (cpp, omp and tbb).
+ *
+ *  On platforms without \c mmap, all allocations are forwarded to \p new_delete_resource.
+ */
+class huge_page_resource final : public memory_resource<>
+{
+public:
+  /*! The default threshold, the size of a 2 MiB huge page. */
+  static constexpr std::size_t default_threshold = std::size_t{2} << 20;
+
+  /*! Constructs a \p huge_page_resource.
+   *
+   *  \param threshold the smallest allocation that is mapped with huge pages
+   *  \param kind the kind of huge pages to use
+   */
+  explicit huge_page_resource(std::size_t threshold = default_threshold,
+                              huge_page_kind kind   = huge_page_kind::transparent) noexcept
+      : m_threshold(threshold)
+      , m_kind(kind)
+  {}
+
+  /*! \return the smallest allocation that is mapped with huge pages. */
+  std::size_t threshold() const noexcept
+  {
+    return m_threshold;
+  }
+
+  /*! \return the kind of huge pages used for large allocations. */
+  huge_page_kind kind() const noexcept
+  {
+    return m_kind;
+  }
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+#if !_CCCL_OS(WINDOWS)
+    if (bytes >= m_threshold)
+    {
+      return map(bytes, alignment);
+    }
+#endif // !_CCCL_OS(WINDOWS)
+    return m_small.do_allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+#if !_CCCL_OS(WINDOWS)
+    if (bytes >= m_threshold)
+    {
+      ::munmap(p, ::cuda::round_up(bytes, granularity()));
+      return;
+    }
+#endif // !_CCCL_OS(WINDOWS)
+    m_small.do_deallocate(p, bytes, alignment);
+  }
+
+private:
+  std::size_t m_threshold;
+  huge_page_kind m_kind;
+  new_delete_resource m_small;
+
+#if !_CCCL_OS(WINDOWS)
+  //! The size every mapping is rounded up to. It only depends on the kind, so that deallocation can recompute the
+  //! length of the mapping even if explicit huge pages were not available.
+  std::size_t granularity() const noexcept
+  {
+    switch (m_kind)
+    {
+      case huge_page_kind::explicit_2mb:
+        return std::size_t{2} << 20;
+      case huge_page_kind::explicit_1gb:
+        return std::size_t{1} << 30;
+      default:
+        return static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    }
+  }
+
+  void* map(std::size_t bytes, std::size_t alignment)
+  {
+    const std::size_t page   = granularity();
+    const std::size_t length = ::cuda::round_up(bytes, page);
+    // mmap only aligns to the page size, so over-allocate and trim for larger alignments
+    const std::size_t padding = alignment > page ? alignment : 0;
+    const int prot            = PROT_READ | PROT_WRITE;
+    const int flags           = MAP_PRIVATE | MAP_ANONYMOUS;
+
+    void* base = MAP_FAILED;
+#  if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+    if (m_kind != huge_page_kind::transparent)
+    {
+      const int log2_page = m_kind == huge_page_kind::explicit_1gb ? 30 : 21;
+      base = ::mmap(nullptr, length + padding, prot, flags | MAP_HUGETLB | (log2_page << MAP_HUGE_SHIFT), -1, 0);
+    }
+#  endif // MAP_HUGETLB && MAP_HUGE_SHIFT
+    const bool explicit_pages = base != MAP_FAILED;
+    if (!explicit_pages)
+    {
+      base = ::mmap(nullptr, length + padding, prot, flags, -1, 0);
+    }
+    if (base == MAP_FAILED)
+    {
+      throw thrust::system::detail::bad_alloc("huge_page_resource: mmap failed");
+    }
+
+    const auto first   = reinterpret_cast<std::uintptr_t>(base);
+    const auto aligned = ::cuda::round_up(first, alignment);
+    if (padding != 0)
+    {
+      if (aligned != first)
+      {
+        ::munmap(base, aligned - first);
+      }
+      if (const std::size_t tail = padding - (aligned - first); tail != 0)
+      {
+        ::munmap(reinterpret_cast<void*>(aligned + length), tail);
+      }
+    }
+
+#  if defined(MADV_HUGEPAGE)
+    if (!explicit_pages)
+    {
+      // only a hint, the mapping remains usable with regular pages if it is not honored
+      ::madvise(reinterpret_cast<void*>(aligned), length, MADV_HUGEPAGE);
+    }
+#  endif // MADV_HUGEPAGE
+    return reinterpret_cast<void*>(aligned);
+  }
+#endif // !_CCCL_OS(WINDOWS)
+};
+
+/*! \} // memory_resources
+ */
+} // namespace mr
+
+//! \cond
+namespace system::detail
+{
+// The upstream resource of the native memory resources of the host systems (cpp, omp and tbb).
+#if defined(THRUST_HOST_MEMORY_USE_HUGE_PAGES)
+using host_native_upstream_resource = mr::huge_page_resource;
+#else // ^^^ THRUST_HOST_MEMORY_USE_HUGE_PAGES ^^^ / vvv !THRUST_HOST_MEMORY_USE_HUGE_PAGES vvv
+using host_native_upstream_resource = mr::new_delete_resource;
+#endif // ^^^ !THRUST_HOST_MEMORY_USE_HUGE_PAGES ^^^
+} // namespace system::detail
+//! \endcond
+THRUST_NAMESPACE_END
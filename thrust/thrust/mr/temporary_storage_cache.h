@@ -0,0 +1,273 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file
+ *  \brief A memory resource that caches temporary storage of the host systems across algorithm calls.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/mr/huge_page_resource.h>
+#include <thrust/mr/memory_resource.h>
+
+#include <cuda/__cmath/ilog.h>
+
+#include <algorithm>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+/** \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! Counters describing the state and the effectiveness of a \p temporary_storage_cache.
+ */
+struct temporary_storage_cache_stats
+{
+  /*! The number of allocations served by the cache. */
+  std::size_t allocations;
+  /*! The number of allocations that were served from cached blocks, without calling the upstream resource. */
+  std::size_t cache_hits;
+  /*! The number of bytes currently handed out to callers, after rounding cached requests up to the size of their bins.
+   */
+  std::size_t bytes_in_use;
+  /*! The largest value \p bytes_in_use has reached. */
+  std::size_t peak_bytes_in_use;
+  /*! The number of bytes held in idle blocks, ready to be reused. */
+  std::size_t bytes_cached;
+};
+
+/*! A memory resource adaptor that keeps deallocated blocks for reuse by later allocations of a similar size.
+ *
+ *  Every algorithm of the host systems allocates its temporary storage (block sums of a scan, the buffers of a merge
+ *  sort, the flags of \p copy_if) anew, which costs a call to the upstream resource and, for large buffers, the page
+ *  faults of freshly mapped memory. Tight loops of algorithm calls request the same sizes again and again, so this
+ *  resource rounds every request up to a power of two and caches the blocks it is returned, up to \p max_cached_bytes.
+ *  Requests with an alignment above \p block_alignment bypass the cache, as do requests whose rounded size exceeds
+ *  \p max_cached_bytes: their blocks could never be cached, so they are allocated from upstream at their exact size.
+ *
+ *  Unlike \p unsynchronized_pool_resource, blocks are never carved out of larger chunks, so idle blocks can be returned
+ *  to upstream individually by \p trim.
+ *
+ *  The resource is not thread safe. \p thread_temporary_storage_cache returns an instance per thread, which the host
+ *  systems use for their temporary buffers if \p THRUST_HOST_TEMPORARY_STORAGE_CACHE is defined. To use a cache for a
+ *  single call instead, pass an \p allocator over it to the execution policy, as in
+ *  <tt>thrust::host(mr::allocator<char, temporary_storage_cache>(&cache))</tt>.
+ */
+class temporary_storage_cache final : public memory_resource<>
+{
+  static constexpr std::size_t smallest_bin_log2 = 8;
+  static constexpr std::size_t bin_count         = sizeof(std::size_t) * 8 - smallest_bin_log2;
+
+public:
+  /*! The alignment of all cached blocks. */
+  static constexpr std::size_t block_alignment = 64;
+  /*! The default limit of the idle bytes held by the cache. */
+  static constexpr std::size_t default_max_cached_bytes = std::size_t{1} << 30;
+
+  /*! Constructs a \p temporary_storage_cache.
+   *
+   *  \param upstream the resource blocks are allocated from
+   *  \param max_cached_bytes the largest number of idle bytes held by the cache. Blocks that are deallocated while the
+   *         cache is full are returned to \p upstream.
+   */
+  explicit temporary_storage_cache(memory_resource<>* upstream, std::size_t max_cached_bytes = default_max_cached_bytes)
+      : m_upstream(upstream)
+      , m_max_cached_bytes(max_cached_bytes)
+      , m_stats()
+      , m_bins(bin_count)
+      , m_uncached_blocks()
+  {}
+
+  /*! Constructs a \p temporary_storage_cache over the upstream resource of the host systems, as obtained by calling
+   *  \p get_global_resource.
+   *
+   *  \param max_cached_bytes the largest number of idle bytes held by the cache
+   */
+  explicit temporary_storage_cache(std::size_t max_cached_bytes = default_max_cached_bytes)
+      : temporary_storage_cache(
+          get_global_resource<thrust::system::detail::host_native_upstream_resource>(), max_cached_bytes)
+  {}
+
+  temporary_storage_cache(const temporary_storage_cache&)            = delete;
+  temporary_storage_cache& operator=(const temporary_storage_cache&) = delete;
+
+  /*! Destructor. Returns all idle blocks to upstream. Blocks that are still in use must not be deallocated afterwards.
+   */
+  ~temporary_storage_cache()
+  {
+    trim();
+  }
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    ++m_stats.allocations;
+    if (alignment > block_alignment)
+    {
+      return m_upstream->do_allocate(bytes, alignment);
+    }
+
+    const std::size_t bin       = bin_index(bytes);
+    const std::size_t bin_bytes = bin_size(bin);
+    if (bin_bytes > m_max_cached_bytes)
+    {
+      void* ptr = m_upstream->do_allocate(bytes, block_alignment);
+      m_uncached_blocks.push_back(ptr);
+      add_bytes_in_use(bytes);
+      return ptr;
+    }
+
+    std::vector<void*>& blocks = m_bins[bin];
+    void* ptr                  = nullptr;
+    if (!blocks.empty())
+    {
+      ptr = blocks.back();
+      blocks.pop_back();
+      m_stats.bytes_cached -= bin_bytes;
+      ++m_stats.cache_hits;
+    }
+    else
+    {
+      ptr = m_upstream->do_allocate(bin_bytes, block_alignment);
+    }
+    add_bytes_in_use(bin_bytes);
+    return ptr;
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    if (alignment > block_alignment)
+    {
+      m_upstream->do_deallocate(p, bytes, alignment);
+      return;
+    }
+
+    // The limit may have changed since the block was allocated, so blocks of exact size are told apart by their address.
+    // There are few of them, as each one is larger than the limit.
+    const auto uncached = std::find(m_uncached_blocks.begin(), m_uncached_blocks.end(), p);
+    if (uncached != m_uncached_blocks.end())
+    {
+      *uncached = m_uncached_blocks.back();
+      m_uncached_blocks.pop_back();
+      m_stats.bytes_in_use -= bytes;
+      m_upstream->do_deallocate(p, bytes, block_alignment);
+      return;
+    }
+
+    const std::size_t bin       = bin_index(bytes);
+    const std::size_t bin_bytes = bin_size(bin);
+    m_stats.bytes_in_use -= bin_bytes;
+    if (m_stats.bytes_cached + bin_bytes > m_max_cached_bytes)
+    {
+      m_upstream->do_deallocate(p, bin_bytes, block_alignment);
+      return;
+    }
+    m_bins[bin].push_back(p);
+    m_stats.bytes_cached += bin_bytes;
+  }
+
+  /*! Returns idle blocks to upstream, largest first, until at most \p bytes_to_keep idle bytes remain cached.
+   *
+   *  \param bytes_to_keep the number of idle bytes the cache may keep
+   */
+  void trim(std::size_t bytes_to_keep = 0)
+  {
+    for (std::size_t bin = bin_count; bin-- > 0 && m_stats.bytes_cached > bytes_to_keep;)
+    {
+      std::vector<void*>& blocks = m_bins[bin];
+      while (!blocks.empty() && m_stats.bytes_cached > bytes_to_keep)
+      {
+        m_upstream->do_deallocate(blocks.back(), bin_size(bin), block_alignment);
+        blocks.pop_back();
+        m_stats.bytes_cached -= bin_size(bin);
+      }
+    }
+  }
+
+  /*! \return the counters of this cache. */
+  temporary_storage_cache_stats stats() const noexcept
+  {
+    return m_stats;
+  }
+
+  /*! Resets the \p allocations and \p cache_hits counters, and \p peak_bytes_in_use to the current \p bytes_in_use. */
+  void reset_stats() noexcept
+  {
+    m_stats.allocations       = 0;
+    m_stats.cache_hits        = 0;
+    m_stats.peak_bytes_in_use = m_stats.bytes_in_use;
+  }
+
+  /*! \return the largest number of idle bytes held by the cache. */
+  std::size_t max_cached_bytes() const noexcept
+  {
+    return m_max_cached_bytes;
+  }
+
+  /*! Sets the largest number of idle bytes held by the cache, and trims the cache to it.
+   *
+   *  \param max_cached_bytes the new limit
+   */
+  void set_max_cached_bytes(std::size_t max_cached_bytes)
+  {
+    m_max_cached_bytes = max_cached_bytes;
+    trim(max_cached_bytes);
+  }
+
+private:
+  memory_resource<>* m_upstream;
+  std::size_t m_max_cached_bytes;
+  temporary_storage_cache_stats m_stats;
+  std::vector<std::vector<void*>> m_bins;
+  std::vector<void*> m_uncached_blocks;
+
+  void add_bytes_in_use(std::size_t bytes) noexcept
+  {
+    m_stats.bytes_in_use += bytes;
+    if (m_stats.bytes_in_use > m_stats.peak_bytes_in_use)
+    {
+      m_stats.peak_bytes_in_use = m_stats.bytes_in_use;
+    }
+  }
+
+  static std::size_t bin_index(std::size_t bytes) noexcept
+  {
+    if (bytes <= (std::size_t{1} << smallest_bin_log2))
+    {
+      return 0;
+    }
+    return static_cast<std::size_t>(::cuda::ceil_ilog2(bytes)) - smallest_bin_log2;
+  }
+
+  static std::size_t bin_size(std::size_t bin) noexcept
+  {
+    return std::size_t{1} << (bin + smallest_bin_log2);
+  }
+};
+
+/*! Potentially constructs, if not yet created, and then returns the \p temporary_storage_cache of the calling thread.
+ *  It allocates from the upstream resource of the host systems.
+ */
+_CCCL_HOST inline temporary_storage_cache& thread_temporary_storage_cache()
+{
+  static thread_local temporary_storage_cache cache;
+  return cache;
+}
+
+/*! \} // memory_resources
+ */
+} // namespace mr
+THRUST_NAMESPACE_END
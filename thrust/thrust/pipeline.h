@@ -0,0 +1,474 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file pipeline.h
+ *  \brief Lazily composed chains of maps and filters which are evaluated in a single pass by their final algorithm
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/detail/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/transform_output_iterator.h>
+#include <thrust/reduce.h>
+
+#include <cuda/std/__functional/invoke.h>
+#include <cuda/std/__type_traits/decay.h>
+#include <cuda/std/functional>
+#include <cuda/std/optional>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace detail::pipeline_detail
+{
+// The first stage of every pipeline, which presents every input element
+template <typename Value>
+struct source
+{
+  _CCCL_HOST_DEVICE ::cuda::std::optional<Value> operator()(const Value& x) const
+  {
+    return x;
+  }
+};
+
+template <typename Stage, typename Function>
+struct map
+{
+  Stage stage;
+  Function f;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename Reference>
+  _CCCL_HOST_DEVICE auto operator()(const Reference& x) const
+  {
+    using value_type  = ::cuda::std::decay_t<::cuda::std::invoke_result_t<const Stage&, const Reference&>>;
+    using result_type = ::cuda::std::optional<
+      ::cuda::std::decay_t<::cuda::std::invoke_result_t<const Function&, typename value_type::value_type&>>>;
+
+    auto v = stage(x);
+    return v ? result_type(f(*v)) : result_type();
+  }
+};
+
+template <typename Stage, typename Predicate>
+struct filter
+{
+  Stage stage;
+  Predicate pred;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename Reference>
+  _CCCL_HOST_DEVICE auto operator()(const Reference& x) const
+  {
+    auto v = stage(x);
+    if (v && !static_cast<bool>(pred(*v)))
+    {
+      v.reset();
+    }
+    return v;
+  }
+};
+
+struct is_present
+{
+  template <typename Optional>
+  _CCCL_HOST_DEVICE bool operator()(const Optional& v) const
+  {
+    return v.has_value();
+  }
+};
+
+struct value_of
+{
+  template <typename Optional>
+  _CCCL_HOST_DEVICE auto operator()(const Optional& v) const
+  {
+    return *v;
+  }
+};
+
+// Combines the present values with op, so that removed elements act as an identity
+template <typename T, typename BinaryFunction>
+struct reduce_present
+{
+  BinaryFunction op;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename Optional1, typename Optional2>
+  _CCCL_HOST_DEVICE ::cuda::std::optional<T> operator()(const Optional1& a, const Optional2& b) const
+  {
+    if (a && b)
+    {
+      return static_cast<T>(op(*a, *b));
+    }
+    else if (a)
+    {
+      return static_cast<T>(*a);
+    }
+    else if (b)
+    {
+      return static_cast<T>(*b);
+    }
+    return ::cuda::std::nullopt;
+  }
+};
+
+template <typename Function>
+struct invoke_present
+{
+  Function f;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename Optional>
+  _CCCL_HOST_DEVICE void operator()(const Optional& v) const
+  {
+    if (v)
+    {
+      f(*v);
+    }
+  }
+};
+
+template <typename Function>
+struct transform_stage
+{
+  Function f;
+};
+
+template <typename Predicate>
+struct filter_stage
+{
+  Predicate pred;
+};
+
+template <typename T, typename BinaryFunction>
+struct reduce_stage
+{
+  T init;
+  BinaryFunction op;
+};
+
+struct count_stage
+{};
+
+template <typename OutputIterator>
+struct copy_stage
+{
+  OutputIterator result;
+};
+
+template <typename Function>
+struct for_each_stage
+{
+  Function f;
+};
+} // namespace detail::pipeline_detail
+
+/*! \addtogroup algorithms
+ */
+
+/*! \addtogroup pipelines Pipelines
+ *  \ingroup algorithms
+ *  \{
+ */
+
+/*! \p pipeline is a lazily evaluated chain of stages over the input range <tt>[first, last)</tt>. Stages are
+ *  appended with <tt>operator|</tt>: \p stages::transform maps every element, and \p stages::filter removes the
+ *  elements which do not satisfy a predicate. No work is done until a final stage, \p stages::reduce, \p
+ *  stages::count, \p stages::copy or \p stages::for_each, is appended. The final stage runs a single algorithm over the
+ *  composed stages, so the input is read once, and no intermediate sequence is stored.
+ *
+ *  The composed stages are a \p transform_iterator over the input whose values are <tt>cuda::std::optional</tt>s,
+ *  which are empty for removed elements. It is accessible with \p begin and \p end, and any input iterator works,
+ *  including a \p zip_iterator.
+ *
+ *  The final stages are executed with the execution policy of the \p pipeline. \p stages::reduce, \p stages::count and
+ *  \p stages::for_each evaluate the stages once per element. \p stages::copy may evaluate them twice per element,
+ *  because the host backends count the selected elements of every chunk of the input before they copy them.
+ *
+ *  The following code snippet demonstrates how to sum the squares of the positive elements of a sequence in one pass
+ *  using the \p thrust::host execution policy:
+ *
+ *  \code
+ *  #include <thrust/pipeline.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  struct is_positive
+ *  {
+ *    __host__ __device__ bool operator()(int x) const
+ *    {
+ *      return x > 0;
+ *    }
+ *  };
+ *
+ *  struct square
+ *  {
+ *    __host__ __device__ int operator()(int x) const
+ *    {
+ *      return x * x;
+ *    }
+ *  };
+ *  ...
+ *  int data[6] = {1, -2, 3, -4, 5, -6};
+ *  int sum = thrust::pipeline(thrust::host, data, data + 6)
+ *          | thrust::stages::filter(is_positive{})
+ *          | thrust::stages::transform(square{})
+ *          | thrust::stages::reduce(0);
+ *  // sum is 35
+ *  \endcode
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ *          Iterator</a>.
+ *  \tparam Stage The composed stages, which map a reference of \p InputIterator to a <tt>cuda::std::optional</tt>.
+ *
+ *  \see transform_iterator
+ *  \see transform_reduce
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename Stage = detail::pipeline_detail::source<thrust::detail::it_value_t<InputIterator>>>
+class pipeline
+{
+public:
+  /*! The type of the iterators over the values of the composed stages.
+   */
+  using iterator = transform_iterator<Stage, InputIterator>;
+
+  /*! Constructs a \p pipeline without stages over <tt>[first, last)</tt>.
+   *
+   *  \param exec The execution policy of the final stage.
+   *  \param first The beginning of the input sequence.
+   *  \param last The end of the input sequence.
+   */
+  _CCCL_HOST_DEVICE pipeline(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                             InputIterator first,
+                             InputIterator last)
+      : m_exec(thrust::detail::derived_cast(exec))
+      , m_first(first)
+      , m_last(last)
+      , m_stage()
+  {}
+
+  /*! Constructs a \p pipeline which applies \p stage to <tt>[first, last)</tt>.
+   *
+   *  \param exec The execution policy of the final stage.
+   *  \param first The beginning of the input sequence.
+   *  \param last The end of the input sequence.
+   *  \param stage The composed stages.
+   */
+  _CCCL_HOST_DEVICE pipeline(const DerivedPolicy& exec, InputIterator first, InputIterator last, Stage stage)
+      : m_exec(exec)
+      , m_first(first)
+      , m_last(last)
+      , m_stage(stage)
+  {}
+
+  /*! \return The execution policy of the final stage.
+   */
+  _CCCL_HOST_DEVICE const DerivedPolicy& policy() const
+  {
+    return m_exec;
+  }
+
+  /*! \return The composed stages.
+   */
+  _CCCL_HOST_DEVICE const Stage& stage() const
+  {
+    return m_stage;
+  }
+
+  /*! \return An iterator to the value of the composed stages for the first input element.
+   */
+  _CCCL_HOST_DEVICE iterator begin() const
+  {
+    return iterator(m_first, m_stage);
+  }
+
+  /*! \return An iterator past the value of the composed stages for the last input element.
+   */
+  _CCCL_HOST_DEVICE iterator end() const
+  {
+    return iterator(m_last, m_stage);
+  }
+
+private:
+  DerivedPolicy m_exec;
+  InputIterator m_first;
+  InputIterator m_last;
+  Stage m_stage;
+};
+
+template <typename DerivedPolicy, typename InputIterator>
+_CCCL_HOST_DEVICE pipeline(const thrust::detail::execution_policy_base<DerivedPolicy>&, InputIterator, InputIterator)
+  -> pipeline<DerivedPolicy, InputIterator>;
+
+namespace stages
+{
+/*! \return A stage which replaces every element \c x by <tt>f(x)</tt>.
+ *
+ *  \param f The function to apply.
+ */
+template <typename Function>
+_CCCL_HOST_DEVICE detail::pipeline_detail::transform_stage<Function> transform(Function f)
+{
+  return {f};
+}
+
+/*! \return A stage which removes every element \c x for which <tt>pred(x)</tt> is \c false.
+ *
+ *  \param pred The predicate which selects the elements to keep.
+ */
+template <typename Predicate>
+_CCCL_HOST_DEVICE detail::pipeline_detail::filter_stage<Predicate> filter(Predicate pred)
+{
+  return {pred};
+}
+
+/*! \return A final stage which reduces the elements with \p op, like \p thrust::reduce, and returns the result.
+ *
+ *  \param init The initial value of the reduction.
+ *  \param op The associative binary function of the reduction.
+ */
+template <typename T, typename BinaryFunction>
+_CCCL_HOST_DEVICE detail::pipeline_detail::reduce_stage<T, BinaryFunction> reduce(T init, BinaryFunction op)
+{
+  return {init, op};
+}
+
+/*! \return A final stage which returns the sum of the elements and \p init.
+ *
+ *  \param init The initial value of the sum.
+ */
+template <typename T>
+_CCCL_HOST_DEVICE detail::pipeline_detail::reduce_stage<T, ::cuda::std::plus<T>> reduce(T init)
+{
+  return {init, ::cuda::std::plus<T>()};
+}
+
+/*! \return A final stage which returns the number of elements.
+ */
+inline _CCCL_HOST_DEVICE detail::pipeline_detail::count_stage count()
+{
+  return {};
+}
+
+/*! \return A final stage which copies the elements to \p result, like \p thrust::copy_if, and returns the end of the
+ *          output sequence.
+ *
+ *  \param result The beginning of the output sequence, which shall not overlap with the input sequence.
+ */
+template <typename OutputIterator>
+_CCCL_HOST_DEVICE detail::pipeline_detail::copy_stage<OutputIterator> copy(OutputIterator result)
+{
+  return {result};
+}
+
+/*! \return A final stage which applies \p f to every element, like \p thrust::for_each.
+ *
+ *  \param f The function to apply.
+ */
+template <typename Function>
+_CCCL_HOST_DEVICE detail::pipeline_detail::for_each_stage<Function> for_each(Function f)
+{
+  return {f};
+}
+} // namespace stages
+
+/*! Appends a \p stages::transform stage to a \p pipeline.
+ */
+template <typename DerivedPolicy, typename InputIterator, typename Stage, typename Function>
+_CCCL_HOST_DEVICE pipeline<DerivedPolicy, InputIterator, detail::pipeline_detail::map<Stage, Function>>
+operator|(const pipeline<DerivedPolicy, InputIterator, Stage>& p, detail::pipeline_detail::transform_stage<Function> s)
+{
+  using stage_type = detail::pipeline_detail::map<Stage, Function>;
+  return pipeline<DerivedPolicy, InputIterator, stage_type>(
+    p.policy(), p.begin().base(), p.end().base(), stage_type{p.stage(), s.f});
+}
+
+/*! Appends a \p stages::filter stage to a \p pipeline.
+ */
+template <typename DerivedPolicy, typename InputIterator, typename Stage, typename Predicate>
+_CCCL_HOST_DEVICE pipeline<DerivedPolicy, InputIterator, detail::pipeline_detail::filter<Stage, Predicate>>
+operator|(const pipeline<DerivedPolicy, InputIterator, Stage>& p, detail::pipeline_detail::filter_stage<Predicate> s)
+{
+  using stage_type = detail::pipeline_detail::filter<Stage, Predicate>;
+  return pipeline<DerivedPolicy, InputIterator, stage_type>(
+    p.policy(), p.begin().base(), p.end().base(), stage_type{p.stage(), s.pred});
+}
+
+/*! Evaluates a \p pipeline with a \p stages::reduce stage.
+ *
+ *  \return The reduction of the elements and the initial value.
+ */
+template <typename DerivedPolicy, typename InputIterator, typename Stage, typename T, typename BinaryFunction>
+_CCCL_HOST_DEVICE T operator|(const pipeline<DerivedPolicy, InputIterator, Stage>& p,
+                              detail::pipeline_detail::reduce_stage<T, BinaryFunction> s)
+{
+  // The initial value is present, so the result is as well
+  const ::cuda::std::optional<T> result = thrust::reduce(
+    p.policy(),
+    p.begin(),
+    p.end(),
+    ::cuda::std::optional<T>(s.init),
+    detail::pipeline_detail::reduce_present<T, BinaryFunction>{s.op});
+  return *result;
+}
+
+/*! Evaluates a \p pipeline with a \p stages::count stage.
+ *
+ *  \return The number of elements.
+ */
+template <typename DerivedPolicy, typename InputIterator, typename Stage>
+_CCCL_HOST_DEVICE thrust::detail::it_difference_t<InputIterator>
+operator|(const pipeline<DerivedPolicy, InputIterator, Stage>& p, detail::pipeline_detail::count_stage)
+{
+  return thrust::count_if(p.policy(), p.begin(), p.end(), detail::pipeline_detail::is_present{});
+}
+
+/*! Evaluates a \p pipeline with a \p stages::copy stage.
+ *
+ *  \return The end of the output sequence.
+ */
+template <typename DerivedPolicy, typename InputIterator, typename Stage, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator
+operator|(const pipeline<DerivedPolicy, InputIterator, Stage>& p, detail::pipeline_detail::copy_stage<OutputIterator> s)
+{
+  return thrust::copy_if(p.policy(),
+                         p.begin(),
+                         p.end(),
+                         thrust::make_transform_output_iterator(s.result, detail::pipeline_detail::value_of{}),
+                         detail::pipeline_detail::is_present{})
+    .base();
+}
+
+/*! Evaluates a \p pipeline with a \p stages::for_each stage.
+ */
+template <typename DerivedPolicy, typename InputIterator, typename Stage, typename Function>
+_CCCL_HOST_DEVICE void
+operator|(const pipeline<DerivedPolicy, InputIterator, Stage>& p, detail::pipeline_detail::for_each_stage<Function> s)
+{
+  thrust::for_each(p.policy(), p.begin(), p.end(), detail::pipeline_detail::invoke_present<Function>{s.f});
+}
+
+/*! \} // end pipelines
+ */
+
+THRUST_NAMESPACE_END
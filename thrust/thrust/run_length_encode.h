@@ -0,0 +1,381 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file run_length_encode.h
+ *  \brief Functions for compressing runs of equal elements
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+
+#include <cuda/std/utility>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup reductions
+ *  \{
+ */
+
+/*! \p run_length_encode compresses every maximal run of consecutive equal elements of the range
+ *  <tt>[first, last)</tt> into its first element and its length. The first element of the \c i-th run is written to
+ *  <tt>unique_out[i]</tt> and its length to <tt>counts_out[i]</tt>.
+ *
+ *  This version of \p run_length_encode uses <tt>operator==</tt> to test elements for equality. It is equivalent to
+ *  \p reduce_by_key with a \p constant_iterator of ones as the values, but it needs no temporary storage on the host
+ *  backends.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param unique_out The beginning of the output sequence of the first elements of the runs.
+ *  \param counts_out The beginning of the output sequence of the lengths of the runs.
+ *  \return A \p pair of the ends of the sequences of first elements and of lengths.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a>, and \p InputIterator's \c value_type is <a
+ * href="https://en.cppreference.com/w/cpp/named_req/EqualityComparable">Equality Comparable</a> and convertible to \p
+ * OutputIterator1's \c value_type.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a>.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a> and \p InputIterator's \c difference_type is convertible to \p OutputIterator2's \c value_type.
+ *
+ *  \pre The input range shall not overlap with either output range.
+ *
+ *  The following code snippet demonstrates how to use \p run_length_encode to compress a sequence of integers using
+ *  the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/run_length_encode.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int data[7] = {1, 1, 2, 3, 3, 3, 1};
+ *  int unique[7];
+ *  int counts[7];
+ *  auto ends = thrust::run_length_encode(thrust::host, data, data + 7, unique, counts);
+ *  // ends.first - unique is 4
+ *  // unique is now {1, 2, 3, 1, ...}
+ *  // counts is now {2, 1, 3, 1, ...}
+ *  \endcode
+ *
+ *  \see \p non_trivial_runs
+ *  \see \p reduce_by_key
+ *  \see \p unique_copy
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator1, typename OutputIterator2>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 unique_out,
+  OutputIterator2 counts_out);
+
+/*! \p run_length_encode compresses every maximal run of consecutive equal elements of the range
+ *  <tt>[first, last)</tt> into its first element and its length. The first element of the \c i-th run is written to
+ *  <tt>unique_out[i]</tt> and its length to <tt>counts_out[i]</tt>.
+ *
+ *  This version of \p run_length_encode uses <tt>operator==</tt> to test elements for equality.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param unique_out The beginning of the output sequence of the first elements of the runs.
+ *  \param counts_out The beginning of the output sequence of the lengths of the runs.
+ *  \return A \p pair of the ends of the sequences of first elements and of lengths.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a>, and \p InputIterator's \c value_type is <a
+ * href="https://en.cppreference.com/w/cpp/named_req/EqualityComparable">Equality Comparable</a> and convertible to \p
+ * OutputIterator1's \c value_type.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a>.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a> and \p InputIterator's \c difference_type is convertible to \p OutputIterator2's \c value_type.
+ *
+ *  \pre The input range shall not overlap with either output range.
+ *
+ *  \see \p non_trivial_runs
+ *  \see \p reduce_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename InputIterator, typename OutputIterator1, typename OutputIterator2>
+::cuda::std::pair<OutputIterator1, OutputIterator2>
+run_length_encode(InputIterator first, InputIterator last, OutputIterator1 unique_out, OutputIterator2 counts_out);
+
+/*! \p run_length_encode compresses every maximal run of consecutive equivalent elements of the range
+ *  <tt>[first, last)</tt> into its first element and its length. The first element of the \c i-th run is written to
+ *  <tt>unique_out[i]</tt> and its length to <tt>counts_out[i]</tt>.
+ *
+ *  This version of \p run_length_encode uses the function object \p binary_pred to test elements for equivalence.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param unique_out The beginning of the output sequence of the first elements of the runs.
+ *  \param counts_out The beginning of the output sequence of the lengths of the runs.
+ *  \param binary_pred The binary predicate used to test elements for equivalence.
+ *  \return A \p pair of the ends of the sequences of first elements and of lengths.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a> and \p InputIterator's \c value_type is convertible to \p OutputIterator1's \c value_type.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a>.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a> and \p InputIterator's \c difference_type is convertible to \p OutputIterator2's \c value_type.
+ *  \tparam BinaryPredicate is a model of <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary
+ * Predicate</a> and an equivalence relation.
+ *
+ *  \pre The input range shall not overlap with either output range.
+ *
+ *  \see \p non_trivial_runs
+ *  \see \p reduce_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 unique_out,
+  OutputIterator2 counts_out,
+  BinaryPredicate binary_pred);
+
+/*! \p run_length_encode compresses every maximal run of consecutive equivalent elements of the range
+ *  <tt>[first, last)</tt> into its first element and its length. The first element of the \c i-th run is written to
+ *  <tt>unique_out[i]</tt> and its length to <tt>counts_out[i]</tt>.
+ *
+ *  This version of \p run_length_encode uses the function object \p binary_pred to test elements for equivalence.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param unique_out The beginning of the output sequence of the first elements of the runs.
+ *  \param counts_out The beginning of the output sequence of the lengths of the runs.
+ *  \param binary_pred The binary predicate used to test elements for equivalence.
+ *  \return A \p pair of the ends of the sequences of first elements and of lengths.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a> and \p InputIterator's \c value_type is convertible to \p OutputIterator1's \c value_type.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a>.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a> and \p InputIterator's \c difference_type is convertible to \p OutputIterator2's \c value_type.
+ *  \tparam BinaryPredicate is a model of <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary
+ * Predicate</a> and an equivalence relation.
+ *
+ *  \pre The input range shall not overlap with either output range.
+ *
+ *  \see \p non_trivial_runs
+ *  \see \p reduce_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename InputIterator, typename OutputIterator1, typename OutputIterator2, typename BinaryPredicate>
+::cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 unique_out,
+  OutputIterator2 counts_out,
+  BinaryPredicate binary_pred);
+
+/*! \p non_trivial_runs finds every maximal run of more than one consecutive equal element of the range
+ *  <tt>[first, last)</tt>. The offset of the first element of the \c i-th such run from \p first is written to
+ *  <tt>offsets_out[i]</tt> and its length to <tt>lengths_out[i]</tt>. Runs of a single element are skipped.
+ *
+ *  This version of \p non_trivial_runs uses <tt>operator==</tt> to test elements for equality.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param offsets_out The beginning of the output sequence of the offsets of the runs.
+ *  \param lengths_out The beginning of the output sequence of the lengths of the runs.
+ *  \return A \p pair of the ends of the sequences of offsets and of lengths.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam ForwardIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/forward_iterator">Forward
+ * Iterator</a> and \p ForwardIterator's \c value_type is <a
+ * href="https://en.cppreference.com/w/cpp/named_req/EqualityComparable">Equality Comparable</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a> and \p ForwardIterator's \c difference_type is convertible to \p OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a> and \p ForwardIterator's \c difference_type is convertible to \p OutputIterator2's \c value_type.
+ *
+ *  The following code snippet demonstrates how to use \p non_trivial_runs to find the runs of a sequence of integers
+ *  using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/run_length_encode.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int data[7] = {1, 1, 2, 3, 3, 3, 1};
+ *  int offsets[7];
+ *  int lengths[7];
+ *  auto ends = thrust::non_trivial_runs(thrust::host, data, data + 7, offsets, lengths);
+ *  // ends.first - offsets is 2
+ *  // offsets is now {0, 3, ...}
+ *  // lengths is now {2, 3, ...}
+ *  \endcode
+ *
+ *  \see \p run_length_encode
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy, typename ForwardIterator, typename OutputIterator1, typename OutputIterator2>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  ForwardIterator first,
+  ForwardIterator last,
+  OutputIterator1 offsets_out,
+  OutputIterator2 lengths_out);
+
+/*! \p non_trivial_runs finds every maximal run of more than one consecutive equal element of the range
+ *  <tt>[first, last)</tt>. The offset of the first element of the \c i-th such run from \p first is written to
+ *  <tt>offsets_out[i]</tt> and its length to <tt>lengths_out[i]</tt>. Runs of a single element are skipped.
+ *
+ *  This version of \p non_trivial_runs uses <tt>operator==</tt> to test elements for equality.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param offsets_out The beginning of the output sequence of the offsets of the runs.
+ *  \param lengths_out The beginning of the output sequence of the lengths of the runs.
+ *  \return A \p pair of the ends of the sequences of offsets and of lengths.
+ *
+ *  \tparam ForwardIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/forward_iterator">Forward
+ * Iterator</a> and \p ForwardIterator's \c value_type is <a
+ * href="https://en.cppreference.com/w/cpp/named_req/EqualityComparable">Equality Comparable</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a> and \p ForwardIterator's \c difference_type is convertible to \p OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a> and \p ForwardIterator's \c difference_type is convertible to \p OutputIterator2's \c value_type.
+ *
+ *  \see \p run_length_encode
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename ForwardIterator, typename OutputIterator1, typename OutputIterator2>
+::cuda::std::pair<OutputIterator1, OutputIterator2>
+non_trivial_runs(ForwardIterator first, ForwardIterator last, OutputIterator1 offsets_out, OutputIterator2 lengths_out);
+
+/*! \p non_trivial_runs finds every maximal run of more than one consecutive equivalent element of the range
+ *  <tt>[first, last)</tt>. The offset of the first element of the \c i-th such run from \p first is written to
+ *  <tt>offsets_out[i]</tt> and its length to <tt>lengths_out[i]</tt>. Runs of a single element are skipped.
+ *
+ *  This version of \p non_trivial_runs uses the function object \p binary_pred to test elements for equivalence.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param offsets_out The beginning of the output sequence of the offsets of the runs.
+ *  \param lengths_out The beginning of the output sequence of the lengths of the runs.
+ *  \param binary_pred The binary predicate used to test elements for equivalence.
+ *  \return A \p pair of the ends of the sequences of offsets and of lengths.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam ForwardIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/forward_iterator">Forward
+ * Iterator</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a> and \p ForwardIterator's \c difference_type is convertible to \p OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a> and \p ForwardIterator's \c difference_type is convertible to \p OutputIterator2's \c value_type.
+ *  \tparam BinaryPredicate is a model of <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary
+ * Predicate</a> and an equivalence relation.
+ *
+ *  \see \p run_length_encode
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  ForwardIterator first,
+  ForwardIterator last,
+  OutputIterator1 offsets_out,
+  OutputIterator2 lengths_out,
+  BinaryPredicate binary_pred);
+
+/*! \p non_trivial_runs finds every maximal run of more than one consecutive equivalent element of the range
+ *  <tt>[first, last)</tt>. The offset of the first element of the \c i-th such run from \p first is written to
+ *  <tt>offsets_out[i]</tt> and its length to <tt>lengths_out[i]</tt>. Runs of a single element are skipped.
+ *
+ *  This version of \p non_trivial_runs uses the function object \p binary_pred to test elements for equivalence.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param offsets_out The beginning of the output sequence of the offsets of the runs.
+ *  \param lengths_out The beginning of the output sequence of the lengths of the runs.
+ *  \param binary_pred The binary predicate used to test elements for equivalence.
+ *  \return A \p pair of the ends of the sequences of offsets and of lengths.
+ *
+ *  \tparam ForwardIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/forward_iterator">Forward
+ * Iterator</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a> and \p ForwardIterator's \c difference_type is convertible to \p OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a> and \p ForwardIterator's \c difference_type is convertible to \p OutputIterator2's \c value_type.
+ *  \tparam BinaryPredicate is a model of <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary
+ * Predicate</a> and an equivalence relation.
+ *
+ *  \see \p run_length_encode
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename ForwardIterator, typename OutputIterator1, typename OutputIterator2, typename BinaryPredicate>
+::cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  ForwardIterator first,
+  ForwardIterator last,
+  OutputIterator1 offsets_out,
+  OutputIterator2 lengths_out,
+  BinaryPredicate binary_pred);
+
+/*! \} // end reductions
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/run_length_encode.inl>
@@ -0,0 +1,389 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file segmented_reduce.h
+ *  \brief Functions for reducing many independent segments of a range
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+#include <thrust/type_traits/is_execution_policy.h>
+
+#include <cuda/std/__type_traits/enable_if.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup reductions
+ *  \{
+ */
+
+/*! \p segmented_reduce reduces each segment of a sequence into one output element. Segment \c i is the range
+ *  <tt>[first + begin_offsets_first[i], first + end_offsets_first[i])</tt> for every \c i in
+ *  <tt>[0, begin_offsets_last - begin_offsets_first)</tt>, and its sum is written to <tt>result[i]</tt>. Segments may
+ *  overlap, and the sum of a segment whose end offset is not greater than its begin offset is \c 0.
+ *
+ *  This version of \p segmented_reduce uses \c 0 as the initial value of every reduction and <tt>operator+</tt> to
+ *  sum values. Unlike \p reduce_by_key, the segments need not be adjacent and are described by offsets rather than by
+ *  runs of keys.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param begin_offsets_first The beginning of the sequence of the begin offsets of the segments.
+ *  \param begin_offsets_last The end of the sequence of the begin offsets of the segments.
+ *  \param end_offsets_first The beginning of the sequence of the end offsets of the segments.
+ *  \param result The beginning of the output sequence.
+ *  \return The end of the output sequence.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and if \c x and
+ * \c y are objects of \p RandomAccessIterator's \c value_type, then <tt>x + y</tt> is defined and is convertible to \p
+ * RandomAccessIterator's \c value_type.
+ *  \tparam BeginOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam EndOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a> and \p RandomAccessIterator's \c value_type is convertible to \p OutputIterator's \c value_type.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_reduce to sum three segments of a sequence of
+ *  integers using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_reduce.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int data[6]    = {1, 0, 2, 2, 1, 3};
+ *  int offsets[4] = {0, 2, 2, 6};
+ *  int sums[3];
+ *  thrust::segmented_reduce(thrust::host, data, offsets, offsets + 3, offsets + 1, sums);
+ *  // sums is now {1, 0, 8}
+ *  \endcode
+ *
+ *  \see \p reduce
+ *  \see \p reduce_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  OutputIterator result);
+
+/*! \p segmented_reduce reduces each segment of a sequence into one output element. Segment \c i is the range
+ *  <tt>[first + begin_offsets_first[i], first + end_offsets_first[i])</tt> for every \c i in
+ *  <tt>[0, begin_offsets_last - begin_offsets_first)</tt>, and its sum is written to <tt>result[i]</tt>. Segments may
+ *  overlap, and the sum of a segment whose end offset is not greater than its begin offset is \c 0.
+ *
+ *  This version of \p segmented_reduce uses \c 0 as the initial value of every reduction and <tt>operator+</tt> to
+ *  sum values.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param begin_offsets_first The beginning of the sequence of the begin offsets of the segments.
+ *  \param begin_offsets_last The end of the sequence of the begin offsets of the segments.
+ *  \param end_offsets_first The beginning of the sequence of the end offsets of the segments.
+ *  \param result The beginning of the output sequence.
+ *  \return The end of the output sequence.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and if \c x and
+ * \c y are objects of \p RandomAccessIterator's \c value_type, then <tt>x + y</tt> is defined and is convertible to \p
+ * RandomAccessIterator's \c value_type.
+ *  \tparam BeginOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam EndOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a> and \p RandomAccessIterator's \c value_type is convertible to \p OutputIterator's \c value_type.
+ *
+ *  \see \p reduce
+ *  \see \p reduce_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename OutputIterator,
+          ::cuda::std::enable_if_t<!is_execution_policy_v<RandomAccessIterator>, int> = 0>
+OutputIterator segmented_reduce(
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  OutputIterator result);
+
+/*! \p segmented_reduce reduces each segment of a sequence into one output element. Segment \c i is the range
+ *  <tt>[first + begin_offsets_first[i], first + end_offsets_first[i])</tt> for every \c i in
+ *  <tt>[0, begin_offsets_last - begin_offsets_first)</tt>, and its sum is written to <tt>result[i]</tt>. Segments may
+ *  overlap, and the sum of a segment whose end offset is not greater than its begin offset is \p init.
+ *
+ *  This version of \p segmented_reduce uses \p init as the initial value of every reduction and <tt>operator+</tt> to
+ *  sum values.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param begin_offsets_first The beginning of the sequence of the begin offsets of the segments.
+ *  \param begin_offsets_last The end of the sequence of the begin offsets of the segments.
+ *  \param end_offsets_first The beginning of the sequence of the end offsets of the segments.
+ *  \param result The beginning of the output sequence.
+ *  \param init The initial value of every reduction.
+ *  \return The end of the output sequence.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator's \c value_type is convertible to \c T.
+ *  \tparam BeginOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam EndOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a> and \c T is convertible to \p OutputIterator's \c value_type.
+ *  \tparam T is a model of <a href="https://en.cppreference.com/w/cpp/named_req/CopyAssignable">Assignable</a>, and if
+ * \c x and \c y are objects of type \c T, then <tt>x + y</tt> is defined and is convertible to \c T.
+ *
+ *  \see \p reduce
+ *  \see \p reduce_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename OutputIterator,
+          typename T>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  OutputIterator result,
+  T init);
+
+/*! \p segmented_reduce reduces each segment of a sequence into one output element. Segment \c i is the range
+ *  <tt>[first + begin_offsets_first[i], first + end_offsets_first[i])</tt> for every \c i in
+ *  <tt>[0, begin_offsets_last - begin_offsets_first)</tt>, and its sum is written to <tt>result[i]</tt>. Segments may
+ *  overlap, and the sum of a segment whose end offset is not greater than its begin offset is \p init.
+ *
+ *  This version of \p segmented_reduce uses \p init as the initial value of every reduction and <tt>operator+</tt> to
+ *  sum values.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param begin_offsets_first The beginning of the sequence of the begin offsets of the segments.
+ *  \param begin_offsets_last The end of the sequence of the begin offsets of the segments.
+ *  \param end_offsets_first The beginning of the sequence of the end offsets of the segments.
+ *  \param result The beginning of the output sequence.
+ *  \param init The initial value of every reduction.
+ *  \return The end of the output sequence.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator's \c value_type is convertible to \c T.
+ *  \tparam BeginOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam EndOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a> and \c T is convertible to \p OutputIterator's \c value_type.
+ *  \tparam T is a model of <a href="https://en.cppreference.com/w/cpp/named_req/CopyAssignable">Assignable</a>, and if
+ * \c x and \c y are objects of type \c T, then <tt>x + y</tt> is defined and is convertible to \c T.
+ *
+ *  \see \p reduce
+ *  \see \p reduce_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename OutputIterator,
+          typename T,
+          ::cuda::std::enable_if_t<!is_execution_policy_v<RandomAccessIterator>, int> = 0>
+OutputIterator segmented_reduce(
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  OutputIterator result,
+  T init);
+
+/*! \p segmented_reduce reduces each segment of a sequence into one output element. Segment \c i is the range
+ *  <tt>[first + begin_offsets_first[i], first + end_offsets_first[i])</tt> for every \c i in
+ *  <tt>[0, begin_offsets_last - begin_offsets_first)</tt>, and its reduction is written to <tt>result[i]</tt>.
+ *  Segments may overlap, and the reduction of a segment whose end offset is not greater than its begin offset is
+ *  \p init.
+ *
+ *  This version of \p segmented_reduce uses \p init as the initial value of every reduction and \p binary_op as the
+ *  binary function used for summation. As with \p reduce, \p binary_op is assumed to be associative and commutative.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param begin_offsets_first The beginning of the sequence of the begin offsets of the segments.
+ *  \param begin_offsets_last The end of the sequence of the begin offsets of the segments.
+ *  \param end_offsets_first The beginning of the sequence of the end offsets of the segments.
+ *  \param result The beginning of the output sequence.
+ *  \param init The initial value of every reduction.
+ *  \param binary_op The binary function used to 'sum' values.
+ *  \return The end of the output sequence.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator's \c value_type is convertible to \c T.
+ *  \tparam BeginOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam EndOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a> and \c T is convertible to \p OutputIterator's \c value_type.
+ *  \tparam T is a model of <a href="https://en.cppreference.com/w/cpp/named_req/CopyAssignable">Assignable</a>, and is
+ * convertible to \p BinaryFunction's first and second argument type.
+ *  \tparam BinaryFunction The function's return type must be convertible to \c T.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_reduce to compute the latest event time of every
+ *  user using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_reduce.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int times[6]        = {4, 9, 2, 8, 1, 3};
+ *  int user_offsets[4] = {0, 3, 3, 6};
+ *  int latest[3];
+ *  thrust::segmented_reduce(
+ *    thrust::host, times, user_offsets, user_offsets + 3, user_offsets + 1, latest, -1, ::cuda::maximum<int>());
+ *  // latest is now {9, -1, 8}
+ *  \endcode
+ *
+ *  \see \p reduce
+ *  \see \p reduce_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op);
+
+/*! \p segmented_reduce reduces each segment of a sequence into one output element. Segment \c i is the range
+ *  <tt>[first + begin_offsets_first[i], first + end_offsets_first[i])</tt> for every \c i in
+ *  <tt>[0, begin_offsets_last - begin_offsets_first)</tt>, and its reduction is written to <tt>result[i]</tt>.
+ *  Segments may overlap, and the reduction of a segment whose end offset is not greater than its begin offset is
+ *  \p init.
+ *
+ *  This version of \p segmented_reduce uses \p init as the initial value of every reduction and \p binary_op as the
+ *  binary function used for summation. As with \p reduce, \p binary_op is assumed to be associative and commutative.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param begin_offsets_first The beginning of the sequence of the begin offsets of the segments.
+ *  \param begin_offsets_last The end of the sequence of the begin offsets of the segments.
+ *  \param end_offsets_first The beginning of the sequence of the end offsets of the segments.
+ *  \param result The beginning of the output sequence.
+ *  \param init The initial value of every reduction.
+ *  \param binary_op The binary function used to 'sum' values.
+ *  \return The end of the output sequence.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator's \c value_type is convertible to \c T.
+ *  \tparam BeginOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam EndOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a> and \c T is convertible to \p OutputIterator's \c value_type.
+ *  \tparam T is a model of <a href="https://en.cppreference.com/w/cpp/named_req/CopyAssignable">Assignable</a>, and is
+ * convertible to \p BinaryFunction's first and second argument type.
+ *  \tparam BinaryFunction The function's return type must be convertible to \c T.
+ *
+ *  \see \p reduce
+ *  \see \p reduce_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction,
+          ::cuda::std::enable_if_t<!is_execution_policy_v<RandomAccessIterator>, int> = 0>
+OutputIterator segmented_reduce(
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op);
+
+/*! \} // end reductions
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/segmented_reduce.inl>
@@ -0,0 +1,423 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file segmented_sort.h
+ *  \brief Functions for sorting many independent segments of a range
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+#include <thrust/type_traits/is_execution_policy.h>
+
+#include <cuda/std/__type_traits/enable_if.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup sorting
+ *  \ingroup algorithms
+ *  \{
+ */
+
+/*! \p segmented_sort sorts each segment of a sequence into ascending order. Segment \c i is the range
+ *  <tt>[first + begin_offsets_first[i], first + end_offsets_first[i])</tt> for every \c i in
+ *  <tt>[0, begin_offsets_last - begin_offsets_first)</tt>. Segments must not overlap; elements that belong to no
+ *  segment are left unchanged, and segments whose end offset is not greater than their begin offset are empty. Note:
+ *  \c segmented_sort is not guaranteed to be stable.
+ *
+ *  This is equivalent to calling \p sort on every segment, but sorts all segments at once. The host backends sort
+ *  batches of small segments on different threads and sort each large segment with all threads, so that any mix of
+ *  segment sizes is balanced across threads.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param begin_offsets_first The beginning of the sequence of the begin offsets of the segments.
+ *  \param begin_offsets_last The end of the sequence of the begin offsets of the segments.
+ *  \param end_offsets_first The beginning of the sequence of the end offsets of the segments.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *  \tparam BeginOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam EndOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_sort to sort three segments of a sequence of
+ *  integers using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int A[8]       = {3, 1, 2, 9, 7, 8, 6, 5};
+ *  int offsets[4] = {0, 3, 4, 8};
+ *  thrust::segmented_sort(thrust::host, A, offsets, offsets + 3, offsets + 1);
+ *  // A is now {1, 2, 3, 9, 5, 6, 7, 8}
+ *  \endcode
+ *
+ *  \see \p sort
+ *  \see \p segmented_stable_sort
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator>
+_CCCL_HOST_DEVICE void segmented_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first);
+
+/*! \p segmented_sort sorts each segment of a sequence into ascending order. Segment \c i is the range
+ *  <tt>[first + begin_offsets_first[i], first + end_offsets_first[i])</tt> for every \c i in
+ *  <tt>[0, begin_offsets_last - begin_offsets_first)</tt>. Segments must not overlap; elements that belong to no
+ *  segment are left unchanged, and segments whose end offset is not greater than their begin offset are empty. Note:
+ *  \c segmented_sort is not guaranteed to be stable.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param begin_offsets_first The beginning of the sequence of the begin offsets of the segments.
+ *  \param begin_offsets_last The end of the sequence of the begin offsets of the segments.
+ *  \param end_offsets_first The beginning of the sequence of the end offsets of the segments.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *  \tparam BeginOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam EndOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *
+ *  \see \p sort
+ *  \see \p segmented_stable_sort
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          ::cuda::std::enable_if_t<!is_execution_policy_v<RandomAccessIterator>, int> = 0>
+void segmented_sort(RandomAccessIterator first,
+                    BeginOffsetIterator begin_offsets_first,
+                    BeginOffsetIterator begin_offsets_last,
+                    EndOffsetIterator end_offsets_first);
+
+/*! \p segmented_sort sorts each segment of a sequence into ascending order, as determined by the function object
+ *  \p comp. Segment \c i is the range <tt>[first + begin_offsets_first[i], first + end_offsets_first[i])</tt> for
+ *  every \c i in <tt>[0, begin_offsets_last - begin_offsets_first)</tt>. Segments must not overlap; elements that
+ *  belong to no segment are left unchanged, and segments whose end offset is not greater than their begin offset are
+ *  empty. Note: \c segmented_sort is not guaranteed to be stable.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param begin_offsets_first The beginning of the sequence of the begin offsets of the segments.
+ *  \param begin_offsets_last The end of the sequence of the begin offsets of the segments.
+ *  \param end_offsets_first The beginning of the sequence of the end offsets of the segments.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is convertible to \p
+ * StrictWeakOrdering's first argument type and second argument type.
+ *  \tparam BeginOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam EndOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \see \p sort
+ *  \see \p segmented_stable_sort
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  StrictWeakOrdering comp);
+
+/*! \p segmented_sort sorts each segment of a sequence into ascending order, as determined by the function object
+ *  \p comp. Segment \c i is the range <tt>[first + begin_offsets_first[i], first + end_offsets_first[i])</tt> for
+ *  every \c i in <tt>[0, begin_offsets_last - begin_offsets_first)</tt>. Segments must not overlap; elements that
+ *  belong to no segment are left unchanged, and segments whose end offset is not greater than their begin offset are
+ *  empty. Note: \c segmented_sort is not guaranteed to be stable.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param begin_offsets_first The beginning of the sequence of the begin offsets of the segments.
+ *  \param begin_offsets_last The end of the sequence of the begin offsets of the segments.
+ *  \param end_offsets_first The beginning of the sequence of the end offsets of the segments.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is convertible to \p
+ * StrictWeakOrdering's first argument type and second argument type.
+ *  \tparam BeginOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam EndOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  The following code demonstrates how to sort two segments of a sequence of integers in descending order:
+ *
+ *  \code
+ *  #include <thrust/segmented_sort.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  int A[6]       = {1, 4, 2, 8, 5, 7};
+ *  int offsets[3] = {0, 3, 6};
+ *  thrust::segmented_sort(A, offsets, offsets + 2, offsets + 1, ::cuda::std::greater<int>());
+ *  // A is now {4, 2, 1, 8, 7, 5}
+ *  \endcode
+ *
+ *  \see \p sort
+ *  \see \p segmented_stable_sort
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename StrictWeakOrdering,
+          ::cuda::std::enable_if_t<!is_execution_policy_v<RandomAccessIterator>, int> = 0>
+void segmented_sort(RandomAccessIterator first,
+                    BeginOffsetIterator begin_offsets_first,
+                    BeginOffsetIterator begin_offsets_last,
+                    EndOffsetIterator end_offsets_first,
+                    StrictWeakOrdering comp);
+
+/*! \p segmented_stable_sort is much like \p segmented_sort: it sorts each segment of a sequence into ascending order.
+ *  It is stable, meaning that the relative order of equivalent elements within a segment is preserved.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param begin_offsets_first The beginning of the sequence of the begin offsets of the segments.
+ *  \param begin_offsets_last The end of the sequence of the begin offsets of the segments.
+ *  \param end_offsets_first The beginning of the sequence of the end offsets of the segments.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *  \tparam BeginOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam EndOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *
+ *  \see \p stable_sort
+ *  \see \p segmented_sort
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator>
+_CCCL_HOST_DEVICE void segmented_stable_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first);
+
+/*! \p segmented_stable_sort is much like \p segmented_sort: it sorts each segment of a sequence into ascending order.
+ *  It is stable, meaning that the relative order of equivalent elements within a segment is preserved.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param begin_offsets_first The beginning of the sequence of the begin offsets of the segments.
+ *  \param begin_offsets_last The end of the sequence of the begin offsets of the segments.
+ *  \param end_offsets_first The beginning of the sequence of the end offsets of the segments.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *  \tparam BeginOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam EndOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *
+ *  \see \p stable_sort
+ *  \see \p segmented_sort
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          ::cuda::std::enable_if_t<!is_execution_policy_v<RandomAccessIterator>, int> = 0>
+void segmented_stable_sort(RandomAccessIterator first,
+                           BeginOffsetIterator begin_offsets_first,
+                           BeginOffsetIterator begin_offsets_last,
+                           EndOffsetIterator end_offsets_first);
+
+/*! \p segmented_stable_sort is much like \p segmented_sort: it sorts each segment of a sequence into ascending
+ *  order, as determined by the function object \p comp. It is stable, meaning that the relative order of equivalent
+ *  elements within a segment is preserved.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param begin_offsets_first The beginning of the sequence of the begin offsets of the segments.
+ *  \param begin_offsets_last The end of the sequence of the begin offsets of the segments.
+ *  \param end_offsets_first The beginning of the sequence of the end offsets of the segments.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is convertible to \p
+ * StrictWeakOrdering's first argument type and second argument type.
+ *  \tparam BeginOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam EndOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_stable_sort to sort the events of every user by
+ *  time, keeping events with the same time in their original order, using the \p thrust::host execution policy for
+ *  parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  struct event { int time; int id; };
+ *  struct by_time
+ *  {
+ *    bool operator()(const event& a, const event& b) const { return a.time < b.time; }
+ *  };
+ *  ...
+ *  event events[5]     = {{2, 0}, {1, 1}, {2, 2}, {7, 3}, {5, 4}};
+ *  int user_offsets[3] = {0, 3, 5};
+ *  thrust::segmented_stable_sort(thrust::host, events, user_offsets, user_offsets + 2, user_offsets + 1, by_time{});
+ *  // events is now {{1, 1}, {2, 0}, {2, 2}, {5, 4}, {7, 3}}
+ *  \endcode
+ *
+ *  \see \p stable_sort
+ *  \see \p segmented_sort
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_stable_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  StrictWeakOrdering comp);
+
+/*! \p segmented_stable_sort is much like \p segmented_sort: it sorts each segment of a sequence into ascending
+ *  order, as determined by the function object \p comp. It is stable, meaning that the relative order of equivalent
+ *  elements within a segment is preserved.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param begin_offsets_first The beginning of the sequence of the begin offsets of the segments.
+ *  \param begin_offsets_last The end of the sequence of the begin offsets of the segments.
+ *  \param end_offsets_first The beginning of the sequence of the end offsets of the segments.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is convertible to \p
+ * StrictWeakOrdering's first argument type and second argument type.
+ *  \tparam BeginOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam EndOffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \see \p stable_sort
+ *  \see \p segmented_sort
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename StrictWeakOrdering,
+          ::cuda::std::enable_if_t<!is_execution_policy_v<RandomAccessIterator>, int> = 0>
+void segmented_stable_sort(RandomAccessIterator first,
+                           BeginOffsetIterator begin_offsets_first,
+                           BeginOffsetIterator begin_offsets_last,
+                           EndOffsetIterator end_offsets_first,
+                           StrictWeakOrdering comp);
+
+/*! \} // end sorting
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/segmented_sort.inl>
@@ -0,0 +1,28 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/system/cpp/detail/execution_policy.h>
+#include <thrust/system/detail/generic/instrumentation.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::cpp::detail
+{
+template <typename DerivedPolicy>
+thrust::system::detail::generic::instrumented_system_info instrumented_system(execution_policy<DerivedPolicy>&)
+{
+  return {"cpp", 1};
+}
+} // namespace system::cpp::detail
+THRUST_NAMESPACE_END
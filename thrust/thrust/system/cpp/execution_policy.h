@@ -35,6 +35,7 @@
 #include <thrust/system/cpp/detail/generate.h>
 #include <thrust/system/cpp/detail/get_value.h>
 #include <thrust/system/cpp/detail/inner_product.h>
+#include <thrust/system/cpp/detail/instrumentation.h>
 #include <thrust/system/cpp/detail/iter_swap.h>
 #include <thrust/system/cpp/detail/logical.h>
 #include <thrust/system/cpp/detail/malloc_and_free.h>
@@ -13,6 +13,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/adjacent_difference.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/iterator_traits.h>
@@ -29,6 +30,7 @@ _CCCL_HOST_DEVICE OutputIterator adjacent_difference(
   using InputType = thrust::detail::it_value_t<InputIterator>;
   ::cuda::std::minus<InputType> binary_op;
 
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::adjacent_difference(exec, first, last, result, binary_op);
 } // end adjacent_difference()
 
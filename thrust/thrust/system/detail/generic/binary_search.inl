@@ -14,6 +14,7 @@
 #endif // no system header
 #include <thrust/binary_search.h>
 #include <thrust/detail/function.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/for_each.h>
@@ -181,6 +182,7 @@ template <typename DerivedPolicy, typename ForwardIterator, typename T>
 _CCCL_HOST_DEVICE ForwardIterator
 lower_bound(thrust::execution_policy<DerivedPolicy>& exec, ForwardIterator begin, ForwardIterator end, const T& value)
 {
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::lower_bound(exec, begin, end, value, ::cuda::std::less<>{});
 }
 
@@ -201,6 +203,7 @@ template <typename DerivedPolicy, typename ForwardIterator, typename T>
 _CCCL_HOST_DEVICE ForwardIterator
 upper_bound(thrust::execution_policy<DerivedPolicy>& exec, ForwardIterator begin, ForwardIterator end, const T& value)
 {
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::upper_bound(exec, begin, end, value, ::cuda::std::less<>{});
 }
 
@@ -221,6 +224,7 @@ template <typename DerivedPolicy, typename ForwardIterator, typename T>
 _CCCL_HOST_DEVICE bool
 binary_search(thrust::execution_policy<DerivedPolicy>& exec, ForwardIterator begin, ForwardIterator end, const T& value)
 {
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::binary_search(exec, begin, end, value, ::cuda::std::less<>{});
 }
 
@@ -248,6 +252,7 @@ _CCCL_HOST_DEVICE OutputIterator lower_bound(
   InputIterator values_end,
   OutputIterator output)
 {
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::lower_bound(exec, begin, end, values_begin, values_end, output, ::cuda::std::less<>{});
 }
 
@@ -277,6 +282,7 @@ _CCCL_HOST_DEVICE OutputIterator upper_bound(
   InputIterator values_end,
   OutputIterator output)
 {
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::upper_bound(exec, begin, end, values_begin, values_end, output, ::cuda::std::less<>{});
 }
 
@@ -306,6 +312,7 @@ _CCCL_HOST_DEVICE OutputIterator binary_search(
   InputIterator values_end,
   OutputIterator output)
 {
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::binary_search(exec, begin, end, values_begin, values_end, output, ::cuda::std::less<>{});
 }
 
@@ -333,6 +340,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<ForwardIterator, ForwardIterator> equal_rang
   ForwardIterator last,
   const LessThanComparable& value)
 {
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::equal_range(exec, first, last, value, ::cuda::std::less<>{});
 }
 
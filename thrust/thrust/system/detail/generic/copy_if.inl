@@ -13,6 +13,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/copy_if.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/internal_functional.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/detail/type_traits.h>
@@ -86,6 +87,7 @@ _CCCL_HOST_DEVICE OutputIterator copy_if(
   //     we should probably specialize this case for POD
   //     since we can safely keep the input in a temporary instead
   //     of doing two loads
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::copy_if(exec, first, last, first, result, pred);
 } // end copy_if()
 
@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/mismatch.h>
 #include <thrust/system/detail/generic/equal.h>
@@ -25,6 +26,7 @@ template <typename DerivedPolicy, typename InputIterator1, typename InputIterato
 _CCCL_HOST_DEVICE bool
 equal(thrust::execution_policy<DerivedPolicy>& exec, InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
 {
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::equal(exec, first1, last1, first2, ::cuda::std::equal_to<>());
 }
 
@@ -13,6 +13,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/get_iterator_value.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/extrema.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
@@ -142,6 +143,7 @@ min_element(thrust::execution_policy<DerivedPolicy>& exec, ForwardIterator first
 {
   using value_type = thrust::detail::it_value_t<ForwardIterator>;
 
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::min_element(exec, first, last, ::cuda::std::less<value_type>());
 } // end min_element()
 
@@ -173,6 +175,7 @@ max_element(thrust::execution_policy<DerivedPolicy>& exec, ForwardIterator first
 {
   using value_type = thrust::detail::it_value_t<ForwardIterator>;
 
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::max_element(exec, first, last, ::cuda::std::less<value_type>());
 } // end max_element()
 
@@ -204,6 +207,7 @@ minmax_element(thrust::execution_policy<DerivedPolicy>& exec, ForwardIterator fi
 {
   using value_type = thrust::detail::it_value_t<ForwardIterator>;
 
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::minmax_element(exec, first, last, ::cuda::std::less<value_type>());
 } // end minmax_element()
 
@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/iterator/permutation_iterator.h>
@@ -50,6 +51,7 @@ _CCCL_HOST_DEVICE OutputIterator gather_if(
   RandomAccessIterator input_first,
   OutputIterator result)
 {
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::gather_if(exec, map_first, map_last, stencil, input_first, result, ::cuda::std::identity{});
 } // end gather_if()
 
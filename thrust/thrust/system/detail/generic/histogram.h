@@ -0,0 +1,249 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/tag.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__type_traits/common_type.h>
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__type_traits/is_arithmetic.h>
+#include <cuda/std/__type_traits/is_floating_point.h>
+#include <cuda/std/__type_traits/make_unsigned.h>
+#include <cuda/std/__utility/integer_sequence.h>
+#include <cuda/std/array>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::generic
+{
+namespace histogram_detail
+{
+// Maps a sample to its bin of equal width in [lower_level, upper_level), or to num_bins if it is outside of the range.
+// The computation mirrors cub::DeviceHistogram::HistogramEven.
+template <typename SampleT, typename LevelT>
+struct even_bin_index
+{
+  using common_type = ::cuda::std::common_type_t<SampleT, LevelT>;
+
+  static_assert(::cuda::std::is_arithmetic_v<common_type>, "histogram_even requires arithmetic samples and levels");
+
+  common_type lower;
+  common_type upper;
+  // num_bins / (upper - lower) for floating point types, and unused otherwise
+  common_type reciprocal;
+  int num_bins;
+
+  _CCCL_HOST_DEVICE even_bin_index(int num_levels, LevelT lower_level, LevelT upper_level)
+      : lower(static_cast<common_type>(lower_level))
+      , upper(static_cast<common_type>(upper_level))
+      , reciprocal{}
+      , num_bins((::cuda::std::max) (num_levels - 1, 0))
+  {
+    if constexpr (::cuda::std::is_floating_point_v<common_type>)
+    {
+      reciprocal = static_cast<common_type>(num_bins) / (upper - lower);
+    }
+  }
+
+  // Selects rather than branches, so that a loop over contiguous samples can be vectorized
+  _CCCL_HOST_DEVICE int operator()(const SampleT& sample) const
+  {
+    const common_type s = static_cast<common_type>(sample);
+    const bool valid    = num_bins > 0 && s >= lower && s < upper;
+
+    if constexpr (::cuda::std::is_floating_point_v<common_type>)
+    {
+      // Invalid samples, such as NaN, must not be converted to int. Rounding may push samples just below upper into
+      // bin num_bins.
+      const int bin = static_cast<int>(valid ? (s - lower) * reciprocal : common_type(0));
+      return valid ? (::cuda::std::min) (bin, num_bins - 1) : num_bins;
+    }
+    else
+    {
+      // The product of the offset and the number of bins must not overflow
+      using unsigned_type = ::cuda::std::make_unsigned_t<common_type>;
+      using wide_type     = ::cuda::std::conditional_t<sizeof(common_type) <= sizeof(::cuda::std::uint32_t),
+                                                       ::cuda::std::uint64_t,
+#if _CCCL_HAS_INT128()
+                                                       __uint128_t
+#else // ^^^ _CCCL_HAS_INT128() ^^^ / vvv !_CCCL_HAS_INT128() vvv
+                                                       ::cuda::std::uint64_t
+#endif // !_CCCL_HAS_INT128()
+                                                       >;
+
+      const auto offset = static_cast<unsigned_type>(static_cast<unsigned_type>(s) - static_cast<unsigned_type>(lower));
+      const auto range =
+        static_cast<unsigned_type>(static_cast<unsigned_type>(upper) - static_cast<unsigned_type>(lower));
+
+      return valid
+             ? static_cast<int>(static_cast<wide_type>(offset) * static_cast<wide_type>(num_bins)
+                                / static_cast<wide_type>(range))
+             : num_bins;
+    }
+  }
+};
+
+// Maps a sample to the bin [levels[i], levels[i + 1]) that contains it, or to num_bins if there is none
+template <typename SampleT, typename LevelIterator>
+struct range_bin_index
+{
+  using level_type = thrust::detail::it_value_t<LevelIterator>;
+
+  LevelIterator levels;
+  int num_levels;
+  int num_bins;
+
+  _CCCL_HOST_DEVICE range_bin_index(LevelIterator levels_first, int num_levels)
+      : levels(levels_first)
+      , num_levels(num_levels)
+      , num_bins((::cuda::std::max) (num_levels - 1, 0))
+  {}
+
+  _CCCL_EXEC_CHECK_DISABLE
+  _CCCL_HOST_DEVICE int operator()(const SampleT& sample) const
+  {
+    const level_type s = static_cast<level_type>(sample);
+
+    // The number of levels that are not greater than the sample
+    int first = 0;
+    int len   = num_levels;
+    while (len > 0)
+    {
+      const int half = len / 2;
+      if (!(s < levels[first + half]))
+      {
+        first += half + 1;
+        len -= half + 1;
+      }
+      else
+      {
+        len = half;
+      }
+    }
+
+    const int bin = first - 1;
+    return bin >= 0 && bin < num_bins ? bin : num_bins;
+  }
+};
+
+template <typename SampleT, typename LevelT, ::cuda::std::size_t NumActiveChannels, ::cuda::std::size_t... Channels>
+_CCCL_HOST_DEVICE ::cuda::std::array<even_bin_index<SampleT, LevelT>, NumActiveChannels> make_even_bin_indices(
+  const ::cuda::std::array<int, NumActiveChannels>& num_levels,
+  const ::cuda::std::array<LevelT, NumActiveChannels>& lower_levels,
+  const ::cuda::std::array<LevelT, NumActiveChannels>& upper_levels,
+  ::cuda::std::index_sequence<Channels...>)
+{
+  return {{even_bin_index<SampleT, LevelT>(num_levels[Channels], lower_levels[Channels], upper_levels[Channels])...}};
+}
+
+template <typename SampleT, typename LevelT, ::cuda::std::size_t NumActiveChannels>
+_CCCL_HOST_DEVICE ::cuda::std::array<even_bin_index<SampleT, LevelT>, NumActiveChannels> make_even_bin_indices(
+  const ::cuda::std::array<int, NumActiveChannels>& num_levels,
+  const ::cuda::std::array<LevelT, NumActiveChannels>& lower_levels,
+  const ::cuda::std::array<LevelT, NumActiveChannels>& upper_levels)
+{
+  return make_even_bin_indices<SampleT>(
+    num_levels, lower_levels, upper_levels, ::cuda::std::make_index_sequence<NumActiveChannels>{});
+}
+
+template <typename SampleT,
+          typename LevelIterator,
+          ::cuda::std::size_t NumActiveChannels,
+          ::cuda::std::size_t... Channels>
+_CCCL_HOST_DEVICE ::cuda::std::array<range_bin_index<SampleT, LevelIterator>, NumActiveChannels>
+make_range_bin_indices(const ::cuda::std::array<int, NumActiveChannels>& num_levels,
+                       const ::cuda::std::array<LevelIterator, NumActiveChannels>& levels,
+                       ::cuda::std::index_sequence<Channels...>)
+{
+  return {{range_bin_index<SampleT, LevelIterator>(levels[Channels], num_levels[Channels])...}};
+}
+
+template <typename SampleT, typename LevelIterator, ::cuda::std::size_t NumActiveChannels>
+_CCCL_HOST_DEVICE ::cuda::std::array<range_bin_index<SampleT, LevelIterator>, NumActiveChannels>
+make_range_bin_indices(const ::cuda::std::array<int, NumActiveChannels>& num_levels,
+                       const ::cuda::std::array<LevelIterator, NumActiveChannels>& levels)
+{
+  return make_range_bin_indices<SampleT>(num_levels, levels, ::cuda::std::make_index_sequence<NumActiveChannels>{});
+}
+
+// Counts each of the first NumActiveChannels channels of the pixels of NumChannels samples in [first, last) into the
+// bins given by bin_indices
+template <::cuda::std::size_t NumChannels,
+          ::cuda::std::size_t NumActiveChannels,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename BinIndex>
+_CCCL_HOST_DEVICE void histogram_channels(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  const ::cuda::std::array<OutputIterator, NumActiveChannels>& histograms,
+  const ::cuda::std::array<BinIndex, NumActiveChannels>& bin_indices);
+} // namespace histogram_detail
+
+template <::cuda::std::size_t NumChannels,
+          ::cuda::std::size_t NumActiveChannels,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename LevelT>
+_CCCL_HOST_DEVICE void multi_histogram_even(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  const ::cuda::std::array<OutputIterator, NumActiveChannels>& histograms,
+  const ::cuda::std::array<int, NumActiveChannels>& num_levels,
+  const ::cuda::std::array<LevelT, NumActiveChannels>& lower_levels,
+  const ::cuda::std::array<LevelT, NumActiveChannels>& upper_levels);
+
+template <::cuda::std::size_t NumChannels,
+          ::cuda::std::size_t NumActiveChannels,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename LevelIterator>
+_CCCL_HOST_DEVICE void multi_histogram_range(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  const ::cuda::std::array<OutputIterator, NumActiveChannels>& histograms,
+  const ::cuda::std::array<int, NumActiveChannels>& num_levels,
+  const ::cuda::std::array<LevelIterator, NumActiveChannels>& levels);
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename LevelT>
+_CCCL_HOST_DEVICE OutputIterator histogram_even(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  LevelT lower_level,
+  LevelT upper_level);
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename LevelIterator>
+_CCCL_HOST_DEVICE OutputIterator histogram_range(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  LevelIterator levels_first,
+  LevelIterator levels_last);
+} // namespace system::detail::generic
+THRUST_NAMESPACE_END
+
+#include <thrust/system/detail/generic/histogram.inl>
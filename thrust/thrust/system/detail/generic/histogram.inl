@@ -0,0 +1,177 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/adjacent_difference.h>
+#include <thrust/binary_search.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/histogram.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/generic/histogram.h>
+#include <thrust/transform.h>
+
+#include <cuda/__iterator/strided_iterator.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/array>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::generic
+{
+namespace histogram_detail
+{
+// Counts the bins of the samples [samples_first, samples_last) by sorting their bin indices, since there are no
+// atomic increments in the generic layer
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinIndex>
+_CCCL_HOST_DEVICE void histogram_channel(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator samples_first,
+  InputIterator samples_last,
+  OutputIterator histogram,
+  const BinIndex& bin_index)
+{
+  if (bin_index.num_bins == 0)
+  {
+    return;
+  }
+
+  thrust::detail::temporary_array<int, DerivedPolicy> bins(exec, ::cuda::std::distance(samples_first, samples_last));
+  thrust::transform(exec, samples_first, samples_last, bins.begin(), bin_index);
+  thrust::sort(exec, bins.begin(), bins.end());
+
+  // Samples outside of all bins map to num_bins and are sorted after all others, so they are never counted
+  thrust::counting_iterator<int> bin_first(0);
+  thrust::upper_bound(exec, bins.begin(), bins.end(), bin_first, bin_first + bin_index.num_bins, histogram);
+  thrust::adjacent_difference(exec, histogram, histogram + bin_index.num_bins, histogram);
+}
+
+template <::cuda::std::size_t NumChannels,
+          ::cuda::std::size_t NumActiveChannels,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename BinIndex>
+_CCCL_HOST_DEVICE void histogram_channels(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  const ::cuda::std::array<OutputIterator, NumActiveChannels>& histograms,
+  const ::cuda::std::array<BinIndex, NumActiveChannels>& bin_indices)
+{
+  static_assert(0 < NumActiveChannels && NumActiveChannels <= NumChannels,
+                "the number of active channels must be positive and at most the number of channels");
+
+  if constexpr (NumChannels == 1)
+  {
+    histogram_channel(exec, first, last, histograms[0], bin_indices[0]);
+  }
+  else
+  {
+    // Multi-channel samples are random access, so that each channel can be strided through
+    const auto num_pixels = ::cuda::std::distance(first, last) / NumChannels;
+    for (::cuda::std::size_t channel = 0; channel < NumActiveChannels; ++channel)
+    {
+      const auto samples = ::cuda::make_strided_iterator(first + channel, NumChannels);
+      histogram_channel(exec, samples, samples + num_pixels, histograms[channel], bin_indices[channel]);
+    }
+  }
+}
+} // namespace histogram_detail
+
+template <::cuda::std::size_t NumChannels,
+          ::cuda::std::size_t NumActiveChannels,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename LevelT>
+_CCCL_HOST_DEVICE void multi_histogram_even(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  const ::cuda::std::array<OutputIterator, NumActiveChannels>& histograms,
+  const ::cuda::std::array<int, NumActiveChannels>& num_levels,
+  const ::cuda::std::array<LevelT, NumActiveChannels>& lower_levels,
+  const ::cuda::std::array<LevelT, NumActiveChannels>& upper_levels)
+{
+  using sample_type = thrust::detail::it_value_t<InputIterator>;
+  histogram_detail::histogram_channels<NumChannels>(
+    exec,
+    first,
+    last,
+    histograms,
+    histogram_detail::make_even_bin_indices<sample_type>(num_levels, lower_levels, upper_levels));
+} // end multi_histogram_even()
+
+template <::cuda::std::size_t NumChannels,
+          ::cuda::std::size_t NumActiveChannels,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename LevelIterator>
+_CCCL_HOST_DEVICE void multi_histogram_range(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  const ::cuda::std::array<OutputIterator, NumActiveChannels>& histograms,
+  const ::cuda::std::array<int, NumActiveChannels>& num_levels,
+  const ::cuda::std::array<LevelIterator, NumActiveChannels>& levels)
+{
+  using sample_type = thrust::detail::it_value_t<InputIterator>;
+  histogram_detail::histogram_channels<NumChannels>(
+    exec, first, last, histograms, histogram_detail::make_range_bin_indices<sample_type>(num_levels, levels));
+} // end multi_histogram_range()
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename LevelT>
+_CCCL_HOST_DEVICE OutputIterator histogram_even(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  LevelT lower_level,
+  LevelT upper_level)
+{
+  thrust::multi_histogram_even<1, 1>(
+    exec,
+    first,
+    last,
+    ::cuda::std::array<OutputIterator, 1>{histogram},
+    ::cuda::std::array<int, 1>{num_levels},
+    ::cuda::std::array<LevelT, 1>{lower_level},
+    ::cuda::std::array<LevelT, 1>{upper_level});
+  return histogram + (::cuda::std::max) (num_levels - 1, 0);
+} // end histogram_even()
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename LevelIterator>
+_CCCL_HOST_DEVICE OutputIterator histogram_range(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  LevelIterator levels_first,
+  LevelIterator levels_last)
+{
+  const int num_levels = static_cast<int>(::cuda::std::distance(levels_first, levels_last));
+  thrust::multi_histogram_range<1, 1>(
+    exec,
+    first,
+    last,
+    ::cuda::std::array<OutputIterator, 1>{histogram},
+    ::cuda::std::array<int, 1>{num_levels},
+    ::cuda::std::array<LevelIterator, 1>{levels_first});
+  return histogram + (::cuda::std::max) (num_levels - 1, 0);
+} // end histogram_range()
+} // namespace system::detail::generic
+THRUST_NAMESPACE_END
@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/internal_functional.h>
 #include <thrust/functional.h>
 #include <thrust/system/detail/generic/inner_product.h>
@@ -31,6 +32,7 @@ _CCCL_HOST_DEVICE OutputType inner_product(
 {
   ::cuda::std::plus<OutputType> binary_op1;
   ::cuda::std::multiplies<OutputType> binary_op2;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::inner_product(exec, first1, last1, first2, init, binary_op1, binary_op2);
 } // end inner_product()
 
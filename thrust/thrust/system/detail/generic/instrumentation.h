@@ -0,0 +1,35 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/detail/generic/tag.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::generic
+{
+// The name of a host system and the number of threads it may use, or a null name if the calls of the system are not
+// instrumented
+struct instrumented_system_info
+{
+  const char* name;
+  int max_threads;
+};
+
+// Device systems and thrust::seq are not instrumented
+template <typename DerivedPolicy>
+instrumented_system_info instrumented_system(thrust::execution_policy<DerivedPolicy>&)
+{
+  return {nullptr, 0};
+}
+} // namespace system::detail::generic
+THRUST_NAMESPACE_END
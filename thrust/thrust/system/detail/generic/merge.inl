@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/internal_functional.h>
 #include <thrust/detail/static_assert.h>
 #include <thrust/functional.h>
@@ -50,6 +51,7 @@ _CCCL_HOST_DEVICE OutputIterator merge(
   OutputIterator result)
 {
   using value_type = thrust::detail::it_value_t<InputIterator1>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::merge(exec, first1, last1, first2, last2, result, ::cuda::std::less<value_type>());
 } // end merge()
 
@@ -117,6 +119,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> merge_by_k
   OutputIterator2 values_result)
 {
   using value_type = thrust::detail::it_value_t<InputIterator1>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::merge_by_key(
     exec,
     keys_first1,
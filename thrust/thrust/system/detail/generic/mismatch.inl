@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/internal_functional.h>
 #include <thrust/find.h>
 #include <thrust/iterator/iterator_traits.h>
@@ -26,6 +27,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<InputIterator1, InputIterator2> mismatch(
 {
   using namespace thrust::placeholders;
 
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::mismatch(exec, first1, last1, first2, _1 == _2);
 } // end mismatch()
 
@@ -13,6 +13,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/static_assert.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/iterator_traits.h>
@@ -29,6 +30,7 @@ reduce(thrust::execution_policy<ExecutionPolicy>& exec, InputIterator first, Inp
   using T = thrust::detail::it_value_t<InputIterator>;
 
   // use T(0) as init by default
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::reduce(exec, first, last, T(0));
 } // end reduce()
 
@@ -37,6 +39,7 @@ _CCCL_HOST_DEVICE T
 reduce(thrust::execution_policy<ExecutionPolicy>& exec, InputIterator first, InputIterator last, T init)
 {
   // use plus<T> by default
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::reduce(exec, first, last, init, ::cuda::std::plus<T>());
 } // end reduce()
 
@@ -13,6 +13,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/internal_functional.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/detail/type_traits.h>
@@ -140,6 +141,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_
   using KeyType = thrust::detail::it_value_t<InputIterator1>;
 
   // use equal_to<KeyType> as default BinaryPredicate
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::reduce_by_key(
     exec, keys_first, keys_last, values_first, keys_output, values_output, ::cuda::std::equal_to<KeyType>());
 } // end reduce_by_key()
@@ -164,6 +166,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_
                              thrust::detail::it_value_t<OutputIterator2>>;
 
   // use plus<T> as default BinaryFunction
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::reduce_by_key(
     exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, ::cuda::std::plus<T>());
 } // end reduce_by_key()
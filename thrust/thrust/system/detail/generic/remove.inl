@@ -13,6 +13,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/copy_if.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/internal_functional.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
@@ -86,6 +87,7 @@ _CCCL_HOST_DEVICE OutputIterator remove_copy_if(
   OutputIterator result,
   Predicate pred)
 {
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::remove_copy_if(exec, first, last, first, result, pred);
 } // end remove_copy_if()
 
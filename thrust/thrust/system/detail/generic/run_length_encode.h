@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/tag.h>
+
+#include <cuda/std/utility>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::generic
+{
+namespace run_length_encode_detail
+{
+// Selects the runs which are longer than a single element
+struct is_non_trivial_run
+{
+  template <typename Size>
+  _CCCL_HOST_DEVICE bool operator()(const Size& length) const
+  {
+    return length > Size(1);
+  }
+};
+} // namespace run_length_encode_detail
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator1, typename OutputIterator2>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 unique_out,
+  OutputIterator2 counts_out);
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 unique_out,
+  OutputIterator2 counts_out,
+  BinaryPredicate binary_pred);
+
+template <typename DerivedPolicy, typename ForwardIterator, typename OutputIterator1, typename OutputIterator2>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForwardIterator first,
+  ForwardIterator last,
+  OutputIterator1 offsets_out,
+  OutputIterator2 lengths_out);
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForwardIterator first,
+  ForwardIterator last,
+  OutputIterator1 offsets_out,
+  OutputIterator2 lengths_out,
+  BinaryPredicate binary_pred);
+} // namespace system::detail::generic
+THRUST_NAMESPACE_END
+
+#include <thrust/system/detail/generic/run_length_encode.inl>
@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/copy.h>
+#include <thrust/detail/instrumentation.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/run_length_encode.h>
+#include <thrust/scan.h>
+#include <thrust/system/detail/generic/run_length_encode.h>
+
+#include <cuda/std/__functional/operations.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/tuple>
+#include <cuda/std/utility>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::generic
+{
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator1, typename OutputIterator2>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 unique_out,
+  OutputIterator2 counts_out)
+{
+  using value_type = thrust::detail::it_value_t<InputIterator>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
+  return thrust::run_length_encode(exec, first, last, unique_out, counts_out, ::cuda::std::equal_to<value_type>());
+} // end run_length_encode()
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 unique_out,
+  OutputIterator2 counts_out,
+  BinaryPredicate binary_pred)
+{
+  // The length of a run is the sum of a one for each of its elements
+  using size_type = thrust::detail::it_difference_t<InputIterator>;
+  return thrust::reduce_by_key(
+    exec, first, last, thrust::make_constant_iterator(size_type(1)), unique_out, counts_out, binary_pred);
+} // end run_length_encode()
+
+template <typename DerivedPolicy, typename ForwardIterator, typename OutputIterator1, typename OutputIterator2>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForwardIterator first,
+  ForwardIterator last,
+  OutputIterator1 offsets_out,
+  OutputIterator2 lengths_out)
+{
+  using value_type = thrust::detail::it_value_t<ForwardIterator>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
+  return thrust::non_trivial_runs(exec, first, last, offsets_out, lengths_out, ::cuda::std::equal_to<value_type>());
+} // end non_trivial_runs()
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForwardIterator first,
+  ForwardIterator last,
+  OutputIterator1 offsets_out,
+  OutputIterator2 lengths_out,
+  BinaryPredicate binary_pred)
+{
+  using size_type = thrust::detail::it_difference_t<ForwardIterator>;
+
+  // Encode all runs, locate them by their lengths, and keep those longer than a single element
+  thrust::detail::temporary_array<size_type, DerivedPolicy> lengths(exec, ::cuda::std::distance(first, last));
+  const auto num_runs =
+    thrust::reduce_by_key(
+      exec,
+      first,
+      last,
+      thrust::make_constant_iterator(size_type(1)),
+      thrust::make_discard_iterator(),
+      lengths.begin(),
+      binary_pred)
+      .second
+    - lengths.begin();
+
+  thrust::detail::temporary_array<size_type, DerivedPolicy> offsets(exec, num_runs);
+  thrust::exclusive_scan(exec, lengths.begin(), lengths.begin() + num_runs, offsets.begin());
+
+  const auto runs = thrust::make_zip_iterator(offsets.begin(), lengths.begin());
+  const auto ends =
+    thrust::copy_if(
+      exec,
+      runs,
+      runs + num_runs,
+      lengths.begin(),
+      thrust::make_zip_iterator(offsets_out, lengths_out),
+      run_length_encode_detail::is_non_trivial_run())
+      .get_iterator_tuple();
+
+  return {::cuda::std::get<0>(ends), ::cuda::std::get<1>(ends)};
+} // end non_trivial_runs()
+} // namespace system::detail::generic
+THRUST_NAMESPACE_END
@@ -13,6 +13,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/scan.h>
 #include <thrust/system/detail/generic/scan.h>
@@ -27,6 +28,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan(
   thrust::execution_policy<ExecutionPolicy>& exec, InputIterator first, InputIterator last, OutputIterator result)
 {
   // assume plus as the associative operator
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::inclusive_scan(exec, first, last, result, ::cuda::std::plus<>());
 } // end inclusive_scan()
 
@@ -45,6 +47,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan(
 {
   // Use the input iterator's value type per https://wg21.link/P0571
   using ValueType = thrust::detail::it_value_t<InputIterator>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::exclusive_scan(exec, first, last, result, ValueType{});
 }
 
@@ -57,6 +60,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan(
   T init)
 {
   // assume plus as the associative operator
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::exclusive_scan(exec, first, last, result, init, ::cuda::std::plus<>());
 }
 
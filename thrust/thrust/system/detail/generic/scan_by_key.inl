@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/internal_functional.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/functional.h>
@@ -57,6 +58,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan_by_key(
   InputIterator2 first2,
   OutputIterator result)
 {
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::inclusive_scan_by_key(exec, first1, last1, first2, result, ::cuda::std::equal_to<>());
 }
 
@@ -73,6 +75,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan_by_key(
   OutputIterator result,
   BinaryPredicate binary_pred)
 {
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::inclusive_scan_by_key(exec, first1, last1, first2, result, binary_pred, ::cuda::std::plus<>());
 }
 
@@ -128,6 +131,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan_by_key(
   OutputIterator result)
 {
   using InitType = thrust::detail::it_value_t<InputIterator2>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::exclusive_scan_by_key(exec, first1, last1, first2, result, InitType{});
 }
 
@@ -140,6 +144,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan_by_key(
   OutputIterator result,
   T init)
 {
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::exclusive_scan_by_key(exec, first1, last1, first2, result, init, ::cuda::std::equal_to<>());
 }
 
@@ -158,6 +163,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan_by_key(
   T init,
   BinaryPredicate binary_pred)
 {
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::exclusive_scan_by_key(exec, first1, last1, first2, result, init, binary_pred, ::cuda::std::plus<>());
 }
 
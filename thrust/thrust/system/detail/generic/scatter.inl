@@ -13,6 +13,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/copy.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/iterator/permutation_iterator.h>
@@ -45,6 +46,7 @@ _CCCL_HOST_DEVICE void scatter_if(
   InputIterator3 stencil,
   RandomAccessIterator output)
 {
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   thrust::scatter_if(exec, first, last, map, stencil, output, ::cuda::std::identity{});
 } // end scatter_if()
 
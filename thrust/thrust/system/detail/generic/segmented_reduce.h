@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/instrumentation.h>
+#include <thrust/detail/seq.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/reduce.h>
+#include <thrust/segmented_reduce.h>
+#include <thrust/system/detail/generic/tag.h>
+
+#include <cuda/std/__functional/operations.h>
+#include <cuda/std/__iterator/distance.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::generic
+{
+namespace detail
+{
+// Reduces a single segment sequentially. Every segment is reduced by a different invocation.
+template <typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+struct reduce_segment
+{
+  RandomAccessIterator first;
+  BeginOffsetIterator begin_offsets_first;
+  EndOffsetIterator end_offsets_first;
+  OutputIterator result;
+  T init;
+  BinaryFunction binary_op;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename Size>
+  _CCCL_HOST_DEVICE void operator()(Size segment) const
+  {
+    using difference_type = thrust::detail::it_difference_t<RandomAccessIterator>;
+
+    const auto begin = static_cast<difference_type>(begin_offsets_first[segment]);
+    const auto end   = static_cast<difference_type>(end_offsets_first[segment]);
+
+    result[segment] = begin < end ? thrust::reduce(thrust::seq, first + begin, first + end, init, binary_op) : init;
+  }
+};
+} // namespace detail
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  OutputIterator result)
+{
+  using T = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  // use T(0) as init by default
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
+  return thrust::segmented_reduce(
+    exec, first, begin_offsets_first, begin_offsets_last, end_offsets_first, result, T(0));
+} // end segmented_reduce()
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename OutputIterator,
+          typename T>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  OutputIterator result,
+  T init)
+{
+  // use plus<T> by default
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
+  return thrust::segmented_reduce(
+    exec, first, begin_offsets_first, begin_offsets_last, end_offsets_first, result, init, ::cuda::std::plus<T>());
+} // end segmented_reduce()
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op)
+{
+  using size_type = thrust::detail::it_difference_t<BeginOffsetIterator>;
+
+  const size_type num_segments = ::cuda::std::distance(begin_offsets_first, begin_offsets_last);
+
+  using reduce_segment_type = detail::
+    reduce_segment<RandomAccessIterator, BeginOffsetIterator, EndOffsetIterator, OutputIterator, T, BinaryFunction>;
+
+  thrust::counting_iterator<size_type, thrust::use_default, thrust::use_default, size_type> segments(0);
+
+  thrust::for_each(
+    exec,
+    segments,
+    segments + num_segments,
+    reduce_segment_type{first, begin_offsets_first, end_offsets_first, result, init, binary_op});
+
+  return result + num_segments;
+} // end segmented_reduce()
+} // namespace system::detail::generic
+THRUST_NAMESPACE_END
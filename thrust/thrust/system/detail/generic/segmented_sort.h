@@ -0,0 +1,216 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/binary_search.h>
+#include <thrust/detail/instrumentation.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/scatter.h>
+#include <thrust/segmented_sort.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/generic/tag.h>
+#include <thrust/transform.h>
+#include <thrust/transform_scan.h>
+
+#include <cuda/std/__functional/operations.h>
+#include <cuda/std/__iterator/distance.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::generic
+{
+namespace detail
+{
+// The number of elements of a segment, or zero for the index one past the last segment
+template <typename Size, typename BeginOffsetIterator, typename EndOffsetIterator>
+struct segment_size
+{
+  BeginOffsetIterator begin_offsets_first;
+  EndOffsetIterator end_offsets_first;
+  Size num_segments;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  _CCCL_HOST_DEVICE Size operator()(Size segment) const
+  {
+    if (segment == num_segments)
+    {
+      return 0;
+    }
+
+    const auto begin = static_cast<Size>(begin_offsets_first[segment]);
+    const auto end   = static_cast<Size>(end_offsets_first[segment]);
+    return begin < end ? end - begin : Size{0};
+  }
+};
+
+// The position in the sequence of an element of the concatenated segments, given the segment it belongs to plus one
+template <typename Size, typename BeginOffsetIterator>
+struct element_position
+{
+  const Size* offsets;
+  BeginOffsetIterator begin_offsets_first;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  _CCCL_HOST_DEVICE Size operator()(Size i, Size label) const
+  {
+    return static_cast<Size>(begin_offsets_first[label - 1]) + (i - offsets[label - 1]);
+  }
+};
+
+// Gathers the elements of all segments into a contiguous buffer, each labeled with its segment, and sorts the buffer
+// by key and then stably by label. This sorts every segment with a few device-wide sorts, the second one a radix sort,
+// regardless of how the elements are distributed over the segments.
+template <bool Stable,
+          typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void sort_segments(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  using size_type  = thrust::detail::it_difference_t<RandomAccessIterator>;
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  const auto num_segments = static_cast<size_type>(::cuda::std::distance(begin_offsets_first, begin_offsets_last));
+  if (num_segments == 0)
+  {
+    return;
+  }
+
+  thrust::counting_iterator<size_type, thrust::use_default, thrust::use_default, size_type> indices(0);
+
+  // offsets[i] is the number of elements of all segments before segment i, so offsets[num_segments] is the total
+  thrust::detail::temporary_array<size_type, DerivedPolicy> offsets(exec, num_segments + 1);
+  thrust::transform_exclusive_scan(
+    exec,
+    indices,
+    indices + (num_segments + 1),
+    offsets.begin(),
+    segment_size<size_type, BeginOffsetIterator, EndOffsetIterator>{
+      begin_offsets_first, end_offsets_first, num_segments},
+    size_type{0},
+    ::cuda::std::plus<size_type>());
+
+  const size_type n = offsets[num_segments];
+  if (n == 0)
+  {
+    return;
+  }
+
+  // The label of an element is its segment plus one, which is the number of segments that start at or before it
+  thrust::detail::temporary_array<size_type, DerivedPolicy> labels(exec, n);
+  thrust::upper_bound(exec, offsets.begin(), offsets.begin() + num_segments, indices, indices + n, labels.begin());
+
+  thrust::detail::temporary_array<size_type, DerivedPolicy> positions(exec, n);
+  thrust::transform(
+    exec,
+    indices,
+    indices + n,
+    labels.begin(),
+    positions.begin(),
+    element_position<size_type, BeginOffsetIterator>{thrust::raw_pointer_cast(offsets.data()), begin_offsets_first});
+
+  thrust::detail::temporary_array<value_type, DerivedPolicy> keys(
+    exec, thrust::make_permutation_iterator(first, positions.begin()), n);
+
+  if constexpr (Stable)
+  {
+    thrust::stable_sort_by_key(exec, keys.begin(), keys.end(), labels.begin(), comp);
+  }
+  else
+  {
+    thrust::sort_by_key(exec, keys.begin(), keys.end(), labels.begin(), comp);
+  }
+  thrust::stable_sort_by_key(exec, labels.begin(), labels.end(), keys.begin());
+
+  // Every segment keeps its place in the buffer, so the elements go back to the positions they were gathered from
+  thrust::scatter(exec, keys.begin(), keys.end(), positions.begin(), first);
+}
+} // namespace detail
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator>
+_CCCL_HOST_DEVICE void segmented_sort(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
+  thrust::segmented_sort(
+    exec, first, begin_offsets_first, begin_offsets_last, end_offsets_first, ::cuda::std::less<value_type>());
+} // end segmented_sort()
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  detail::sort_segments<false>(exec, first, begin_offsets_first, begin_offsets_last, end_offsets_first, comp);
+} // end segmented_sort()
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator>
+_CCCL_HOST_DEVICE void segmented_stable_sort(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
+  thrust::segmented_stable_sort(
+    exec, first, begin_offsets_first, begin_offsets_last, end_offsets_first, ::cuda::std::less<value_type>());
+} // end segmented_stable_sort()
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_stable_sort(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  detail::sort_segments<true>(exec, first, begin_offsets_first, begin_offsets_last, end_offsets_first, comp);
+} // end segmented_stable_sort()
+} // namespace system::detail::generic
+THRUST_NAMESPACE_END
@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/internal_functional.h>
 #include <thrust/detail/static_assert.h>
 #include <thrust/functional.h>
@@ -33,6 +34,7 @@ _CCCL_HOST_DEVICE OutputIterator set_difference(
   OutputIterator result)
 {
   using value_type = thrust::detail::it_value_t<InputIterator1>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::set_difference(exec, first1, last1, first2, last2, result, ::cuda::std::less<value_type>());
 } // end set_difference()
 
@@ -55,6 +57,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> set_differ
   OutputIterator2 values_result)
 {
   using value_type = thrust::detail::it_value_t<InputIterator1>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::set_difference_by_key(
     exec,
     keys_first1,
@@ -123,6 +126,7 @@ _CCCL_HOST_DEVICE OutputIterator set_intersection(
   OutputIterator result)
 {
   using value_type = thrust::detail::it_value_t<InputIterator1>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::set_intersection(exec, first1, last1, first2, last2, result, ::cuda::std::less<value_type>());
 } // end set_intersection()
 
@@ -143,6 +147,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> set_inters
   OutputIterator2 values_result)
 {
   using value_type = thrust::detail::it_value_t<InputIterator1>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::set_intersection_by_key(
     exec,
     keys_first1,
@@ -215,6 +220,7 @@ _CCCL_HOST_DEVICE OutputIterator set_symmetric_difference(
   OutputIterator result)
 {
   using value_type = thrust::detail::it_value_t<InputIterator1>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::set_symmetric_difference(exec, first1, last1, first2, last2, result, ::cuda::std::less<value_type>());
 } // end set_symmetric_difference()
 
@@ -237,6 +243,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> set_symmet
   OutputIterator2 values_result)
 {
   using value_type = thrust::detail::it_value_t<InputIterator1>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::set_symmetric_difference_by_key(
     exec,
     keys_first1,
@@ -306,6 +313,7 @@ _CCCL_HOST_DEVICE OutputIterator set_union(
   OutputIterator result)
 {
   using value_type = thrust::detail::it_value_t<InputIterator1>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::set_union(exec, first1, last1, first2, last2, result, ::cuda::std::less<value_type>());
 } // end set_union()
 
@@ -328,6 +336,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> set_union_
   OutputIterator2 values_result)
 {
   using value_type = thrust::detail::it_value_t<InputIterator1>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::set_union_by_key(
     exec,
     keys_first1,
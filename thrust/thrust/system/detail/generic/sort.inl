@@ -12,6 +12,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/internal_functional.h>
 #include <thrust/find.h>
 #include <thrust/functional.h>
@@ -32,6 +33,7 @@ _CCCL_HOST_DEVICE void
 sort(thrust::execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last)
 {
   using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   thrust::sort(exec, first, last, ::cuda::std::less<value_type>());
 } // end sort()
 
@@ -54,6 +56,7 @@ _CCCL_HOST_DEVICE void sort_by_key(
   RandomAccessIterator2 values_first)
 {
   using value_type = thrust::detail::it_value_t<RandomAccessIterator1>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   thrust::sort_by_key(exec, keys_first, keys_last, values_first, ::cuda::std::less<value_type>());
 } // end sort_by_key()
 
@@ -77,6 +80,7 @@ _CCCL_HOST_DEVICE void
 stable_sort(thrust::execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last)
 {
   using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   thrust::stable_sort(exec, first, last, ::cuda::std::less<value_type>());
 } // end stable_sort()
 
@@ -88,6 +92,7 @@ _CCCL_HOST_DEVICE void stable_sort_by_key(
   RandomAccessIterator2 values_first)
 {
   using value_type = thrust::detail::it_value_t<RandomAccessIterator1>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   thrust::stable_sort_by_key(exec, keys_first, keys_last, values_first, ::cuda::std::less<value_type>());
 } // end stable_sort_by_key()
 
@@ -111,6 +116,7 @@ is_sorted_until(thrust::execution_policy<DerivedPolicy>& exec, ForwardIterator f
 {
   using InputType = thrust::detail::it_value_t<ForwardIterator>;
 
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::is_sorted_until(exec, first, last, ::cuda::std::less<InputType>());
 } // end is_sorted_until()
 
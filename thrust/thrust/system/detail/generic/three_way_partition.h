@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/detail/generic/tag.h>
+
+#include <cuda/std/tuple>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::generic
+{
+namespace three_way_partition_detail
+{
+// Selects the elements of the second part, which are those not selected for the first part
+template <typename Predicate1, typename Predicate2>
+struct select_second_part
+{
+  Predicate1 select_first_part;
+  Predicate2 select_second_part;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename T>
+  _CCCL_HOST_DEVICE bool operator()(const T& x)
+  {
+    return !select_first_part(x) && select_second_part(x);
+  }
+};
+
+// Selects the elements of neither part
+template <typename Predicate1, typename Predicate2>
+struct select_unselected
+{
+  Predicate1 select_first_part;
+  Predicate2 select_second_part;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename T>
+  _CCCL_HOST_DEVICE bool operator()(const T& x)
+  {
+    return !select_first_part(x) && !select_second_part(x);
+  }
+};
+} // namespace three_way_partition_detail
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename OutputIterator3,
+          typename Predicate1,
+          typename Predicate2>
+_CCCL_HOST_DEVICE ::cuda::std::tuple<OutputIterator1, OutputIterator2, OutputIterator3> three_way_partition(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForwardIterator first,
+  ForwardIterator last,
+  OutputIterator1 first_part_out,
+  OutputIterator2 second_part_out,
+  OutputIterator3 unselected_out,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part);
+} // namespace system::detail::generic
+THRUST_NAMESPACE_END
+
+#include <thrust/system/detail/generic/three_way_partition.inl>
@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/copy.h>
+#include <thrust/system/detail/generic/three_way_partition.h>
+
+#include <cuda/std/tuple>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::generic
+{
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename OutputIterator3,
+          typename Predicate1,
+          typename Predicate2>
+_CCCL_HOST_DEVICE ::cuda::std::tuple<OutputIterator1, OutputIterator2, OutputIterator3> three_way_partition(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForwardIterator first,
+  ForwardIterator last,
+  OutputIterator1 first_part_out,
+  OutputIterator2 second_part_out,
+  OutputIterator3 unselected_out,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part)
+{
+  using select_second_part_t = three_way_partition_detail::select_second_part<Predicate1, Predicate2>;
+  using select_unselected_t  = three_way_partition_detail::select_unselected<Predicate1, Predicate2>;
+
+  select_second_part_t select_second{select_first_part, select_second_part};
+  select_unselected_t select_neither{select_first_part, select_second_part};
+
+  return {thrust::copy_if(exec, first, last, first_part_out, select_first_part),
+          thrust::copy_if(exec, first, last, second_part_out, select_second),
+          thrust::copy_if(exec, first, last, unselected_out, select_neither)};
+} // end three_way_partition()
+} // namespace system::detail::generic
+THRUST_NAMESPACE_END
@@ -14,6 +14,7 @@
 #endif // no system header
 #include <thrust/detail/copy_if.h>
 #include <thrust/detail/count.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/internal_functional.h>
 #include <thrust/detail/range/head_flags.h>
 #include <thrust/detail/temporary_array.h>
@@ -34,6 +35,7 @@ unique(thrust::execution_policy<DerivedPolicy>& exec, ForwardIterator first, For
 {
   using InputType = thrust::detail::it_value_t<ForwardIterator>;
 
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::unique(exec, first, last, ::cuda::std::equal_to<InputType>());
 } // end unique()
 
@@ -56,6 +58,7 @@ _CCCL_HOST_DEVICE OutputIterator unique_copy(
   thrust::execution_policy<DerivedPolicy>& exec, InputIterator first, InputIterator last, OutputIterator output)
 {
   using value_type = thrust::detail::it_value_t<InputIterator>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::unique_copy(exec, first, last, output, ::cuda::std::equal_to<value_type>());
 } // end unique_copy()
 
@@ -93,6 +96,7 @@ _CCCL_HOST_DEVICE thrust::detail::it_difference_t<ForwardIterator>
 unique_count(thrust::execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
   using value_type = thrust::detail::it_value_t<ForwardIterator>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::unique_count(exec, first, last, ::cuda::std::equal_to<value_type>());
 } // end unique_copy()
 } // namespace system::detail::generic
@@ -13,6 +13,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/copy_if.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/internal_functional.h>
 #include <thrust/detail/range/head_flags.h>
 #include <thrust/detail/temporary_array.h>
@@ -33,6 +34,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<ForwardIterator1, ForwardIterator2> unique_b
   ForwardIterator2 values_first)
 {
   using KeyType = thrust::detail::it_value_t<ForwardIterator1>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::unique_by_key(exec, keys_first, keys_last, values_first, ::cuda::std::equal_to<KeyType>());
 } // end unique_by_key()
 
@@ -69,6 +71,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> unique_by_
   OutputIterator2 values_output)
 {
   using KeyType = thrust::detail::it_value_t<InputIterator1>;
+  _THRUST_HOST_INSTRUMENTATION_INTERNAL_CALL();
   return thrust::unique_by_key_copy(
     exec, keys_first, keys_last, values_first, keys_output, values_output, ::cuda::std::equal_to<KeyType>());
 } // end unique_by_key_copy()
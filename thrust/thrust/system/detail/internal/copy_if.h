@@ -0,0 +1,196 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/copy_if.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+// The input is cut into chunks of this many elements, which are the units of parallel work
+inline constexpr ::cuda::std::size_t copy_if_chunk_size = 1 << 14;
+
+namespace copy_if_detail
+{
+// Stands for the stencil of copy_if without a stencil, whose predicate is applied to the copied elements
+struct no_stencil
+{};
+
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Size, typename Predicate>
+bool is_selected(RandomAccessIterator1 first, RandomAccessIterator2 stencil, Size i, const Predicate& pred)
+{
+  if constexpr (::cuda::std::is_same_v<RandomAccessIterator2, no_stencil>)
+  {
+    return pred(first[i]);
+  }
+  else
+  {
+    return pred(stencil[i]);
+  }
+}
+
+//! Copies the elements of the n at first whose stencil satisfies pred to result, and returns their number.
+//!
+//! The selected elements of every chunk are counted in parallel, the counts are scanned sequentially, and every chunk
+//! then copies its elements in parallel. Only the counts are stored, so a chain of lazily transformed input is read
+//! twice but never materialized. Without a stencil, each element is dereferenced once per pass.
+//! parallel_for(num_chunks, f) must invoke f(i) for every i in [0, num_chunks).
+template <typename DerivedPolicy,
+          typename ParallelFor,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename Size,
+          typename RandomAccessIterator3,
+          typename Predicate>
+Size copy_chunks(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ParallelFor parallel_for,
+  RandomAccessIterator1 first,
+  RandomAccessIterator2 stencil,
+  Size n,
+  RandomAccessIterator3 result,
+  Predicate pred)
+{
+  if (n == 0)
+  {
+    return 0;
+  }
+
+  // Predicates are invoked on raw references, like those of the generic implementation
+  const thrust::detail::wrapped_function<Predicate, bool> selected{pred};
+
+  const Size chunk_size = static_cast<Size>(copy_if_chunk_size);
+  const Size num_chunks = ::cuda::ceil_div(n, chunk_size);
+  thrust::detail::temporary_array<Size, DerivedPolicy> count_storage(exec, num_chunks);
+  Size* counts = thrust::raw_pointer_cast(count_storage.data());
+
+  parallel_for(num_chunks, [&](Size chunk) {
+    const Size chunk_first = chunk * chunk_size;
+    const Size chunk_last  = (::cuda::std::min) (chunk_first + chunk_size, n);
+
+    Size count = 0;
+    for (Size i = chunk_first; i < chunk_last; ++i)
+    {
+      count += is_selected(first, stencil, i, selected) ? 1 : 0;
+    }
+    counts[chunk] = count;
+  });
+
+  Size total = 0;
+  for (Size chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    const Size count = counts[chunk];
+    counts[chunk]    = total;
+    total += count;
+  }
+
+  parallel_for(num_chunks, [&](Size chunk) {
+    const Size chunk_first = chunk * chunk_size;
+    const Size chunk_last  = (::cuda::std::min) (chunk_first + chunk_size, n);
+
+    Size k = counts[chunk];
+    for (Size i = chunk_first; i < chunk_last; ++i)
+    {
+      if constexpr (::cuda::std::is_same_v<RandomAccessIterator2, no_stencil>)
+      {
+        auto&& x = first[i];
+        if (selected(x))
+        {
+          result[k++] = x;
+        }
+      }
+      else
+      {
+        if (selected(stencil[i]))
+        {
+          result[k++] = first[i];
+        }
+      }
+    }
+  });
+
+  return total;
+}
+} // namespace copy_if_detail
+
+//! Implements copy_if with a stencil of a host backend with copy_chunks, or with the generic implementation unless all
+//! iterators are random access.
+template <typename DerivedPolicy,
+          typename ParallelFor,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename Predicate>
+OutputIterator copy_if(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ParallelFor parallel_for,
+  InputIterator1 first,
+  InputIterator1 last,
+  InputIterator2 stencil,
+  OutputIterator result,
+  Predicate pred)
+{
+  using traversal = thrust::detail::minimum_type<iterator_traversal_t<InputIterator1>,
+                                                 iterator_traversal_t<InputIterator2>,
+                                                 iterator_traversal_t<OutputIterator>>;
+
+  if constexpr (::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
+  {
+    const auto n = ::cuda::std::distance(first, last);
+    return result + copy_if_detail::copy_chunks(exec, parallel_for, first, stencil, n, result, pred);
+  }
+  else
+  {
+    return generic::copy_if(exec, first, last, stencil, result, pred);
+  }
+}
+
+//! Implements copy_if without a stencil of a host backend with copy_chunks, or with the generic implementation unless
+//! all iterators are random access.
+template <typename DerivedPolicy, typename ParallelFor, typename InputIterator, typename OutputIterator, typename Predicate>
+OutputIterator copy_if(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ParallelFor parallel_for,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  Predicate pred)
+{
+  using traversal =
+    thrust::detail::minimum_type<iterator_traversal_t<InputIterator>, iterator_traversal_t<OutputIterator>>;
+
+  if constexpr (::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
+  {
+    const auto n = ::cuda::std::distance(first, last);
+    return result
+         + copy_if_detail::copy_chunks(exec, parallel_for, first, copy_if_detail::no_stencil{}, n, result, pred);
+  }
+  else
+  {
+    return generic::copy_if(exec, first, last, result, pred);
+  }
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file deterministic.h
+ *  \brief Reductions and scans of the host backends whose results do not depend on the number of threads.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/function.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/system/detail/internal/reduce_interval.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__numeric/exclusive_scan.h>
+#include <cuda/std/__numeric/inclusive_scan.h>
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+// The input is split into chunks of this many elements regardless of the number of threads. The chunks are the units
+// of parallel work, so they must be large enough to amortize scheduling them.
+inline constexpr ::cuda::std::size_t deterministic_chunk_size = 1 << 14;
+
+//! Reduces the non-empty range [first, first + n) with binary_op, such that the result only depends on n.
+//!
+//! Each chunk is reduced with reduce_interval and the per-chunk results are reduced the same way, which fixes the shape
+//! of the whole reduction tree. parallel_for(num_chunks, f) must invoke f(i) for every i in [0, num_chunks).
+template <typename OutputType,
+          typename DerivedPolicy,
+          typename ParallelFor,
+          typename RandomAccessIterator,
+          typename Size,
+          typename BinaryFunction>
+OutputType deterministic_reduce(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ParallelFor parallel_for,
+  RandomAccessIterator first,
+  Size n,
+  BinaryFunction binary_op)
+{
+  const Size chunk_size = static_cast<Size>(deterministic_chunk_size);
+
+  if (n <= chunk_size)
+  {
+    return reduce_interval<OutputType>(first, n, binary_op);
+  }
+
+  const Size num_chunks = ::cuda::ceil_div(n, chunk_size);
+  thrust::detail::temporary_array<OutputType, DerivedPolicy> chunk_sums(exec, num_chunks);
+
+  parallel_for(num_chunks, [&](Size chunk) {
+    const Size offset = chunk * chunk_size;
+    chunk_sums[chunk] =
+      reduce_interval<OutputType>(first + offset, (::cuda::std::min) (chunk_size, n - offset), binary_op);
+  });
+
+  return deterministic_reduce<OutputType>(exec, parallel_for, chunk_sums.begin(), num_chunks, binary_op);
+}
+
+//! Scans the non-empty range [first, first + n) into result, such that the results only depend on n.
+//!
+//! The sums of all but the last chunk are computed in parallel and scanned sequentially, then each chunk is scanned
+//! in parallel starting from the sum of its predecessors. Without HasInit, init is ignored; exclusive scans always
+//! have an initial value.
+template <bool IsInclusive,
+          bool HasInit,
+          typename AccumT,
+          typename DerivedPolicy,
+          typename ParallelFor,
+          typename InputIterator,
+          typename Size,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction>
+void deterministic_scan(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ParallelFor parallel_for,
+  InputIterator first,
+  Size n,
+  OutputIterator result,
+  [[maybe_unused]] InitialValueType init,
+  BinaryFunction binary_op)
+{
+  static_assert(IsInclusive || HasInit, "exclusive scans require an initial value");
+
+  thrust::detail::wrapped_function<BinaryFunction, AccumT> wrapped_binary_op{binary_op};
+
+  const Size chunk_size = static_cast<Size>(deterministic_chunk_size);
+  const Size num_chunks = ::cuda::ceil_div(n, chunk_size);
+
+  // prefixes[i] is the sum of the initial value and all chunks before chunk i. prefixes[0] is unused without HasInit.
+  thrust::detail::temporary_array<AccumT, DerivedPolicy> prefixes(exec, num_chunks);
+
+  // A single chunk needs no prefix. Skipping the empty loop also keeps gcc from warning about the loop in
+  // reduce_interval, which it otherwise analyzes for a chunk count of zero.
+  if (num_chunks > 1)
+  {
+    parallel_for(num_chunks - 1, [&](Size chunk) {
+      prefixes[chunk + 1] = reduce_interval<AccumT>(first + chunk * chunk_size, chunk_size, binary_op);
+    });
+  }
+
+  if constexpr (HasInit)
+  {
+    prefixes[0] = init;
+    ::cuda::std::inclusive_scan(prefixes.begin(), prefixes.end(), prefixes.begin(), wrapped_binary_op);
+  }
+  else if (num_chunks > 1)
+  {
+    ::cuda::std::inclusive_scan(prefixes.begin() + 1, prefixes.end(), prefixes.begin() + 1, wrapped_binary_op);
+  }
+
+  parallel_for(num_chunks, [&](Size chunk) {
+    const Size offset             = chunk * chunk_size;
+    const InputIterator chunk_end = first + offset + (::cuda::std::min) (chunk_size, n - offset);
+
+    if constexpr (!IsInclusive)
+    {
+      const AccumT prefix = prefixes[chunk];
+      ::cuda::std::exclusive_scan(first + offset, chunk_end, result + offset, prefix, wrapped_binary_op);
+    }
+    else if (HasInit || chunk > 0)
+    {
+      const AccumT prefix = prefixes[chunk];
+      ::cuda::std::inclusive_scan(first + offset, chunk_end, result + offset, wrapped_binary_op, prefix);
+    }
+    else
+    {
+      ::cuda::std::inclusive_scan(first + offset, chunk_end, result + offset, wrapped_binary_op);
+    }
+  });
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
@@ -0,0 +1,213 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/histogram.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/clamp.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/array>
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+// Every worker counts at least this many pixels into its private bins, so that counting outweighs zeroing and merging
+inline constexpr ::cuda::std::size_t histogram_pixels_per_worker = 1 << 14;
+
+// The bin indices of a tile of pixels are computed before any bin is incremented
+inline constexpr int histogram_tile_size = 1024;
+
+// The private bins are merged in blocks of this many bins, which are the units of parallel work
+inline constexpr ::cuda::std::size_t histogram_merge_block_size = 1 << 12;
+
+namespace histogram_detail
+{
+// Counts the pixels [pixel_first, pixel_last) into bins, in which channel c owns the num_bins[c] + 1 counters starting
+// at offsets[c]. The last counter of each channel counts the samples that are in no bin, so that counting does not
+// branch.
+template <::cuda::std::size_t NumChannels,
+          ::cuda::std::size_t NumActiveChannels,
+          typename RandomAccessIterator,
+          typename Size,
+          typename Counter,
+          typename BinIndex>
+void count_pixels(
+  RandomAccessIterator first,
+  Size pixel_first,
+  Size pixel_last,
+  Counter* bins,
+  const ::cuda::std::array<::cuda::std::size_t, NumActiveChannels>& offsets,
+  const ::cuda::std::array<BinIndex, NumActiveChannels>& bin_indices)
+{
+  int indices[histogram_tile_size];
+
+  for (Size tile_first = pixel_first; tile_first < pixel_last; tile_first += histogram_tile_size)
+  {
+    const int tile_size = static_cast<int>((::cuda::std::min) (pixel_last - tile_first, Size{histogram_tile_size}));
+    const RandomAccessIterator tile = first + tile_first * NumChannels;
+
+    for (::cuda::std::size_t channel = 0; channel < NumActiveChannels; ++channel)
+    {
+      const BinIndex bin_index = bin_indices[channel];
+
+      // Independent of the counters, so that this loop can be vectorized for even bins
+      for (int i = 0; i < tile_size; ++i)
+      {
+        indices[i] = bin_index(tile[i * NumChannels + channel]);
+      }
+
+      Counter* channel_bins = bins + offsets[channel];
+      for (int i = 0; i < tile_size; ++i)
+      {
+        ++channel_bins[indices[i]];
+      }
+    }
+  }
+}
+} // namespace histogram_detail
+
+//! Counts each of the first NumActiveChannels channels of the num_pixels pixels of NumChannels samples starting at
+//! first into the bins given by bin_indices, and overwrites histograms with the counts.
+//!
+//! Each of up to max_workers workers counts a contiguous slice of the pixels into private bins, which need neither
+//! atomics nor locks, and the private bins are then summed in parallel into the output. The number of workers is
+//! limited so that each of them counts at least as many pixels as there are bins. parallel_for(num, f) must invoke
+//! f(i) for every i in [0, num).
+template <::cuda::std::size_t NumChannels,
+          ::cuda::std::size_t NumActiveChannels,
+          typename DerivedPolicy,
+          typename ParallelFor,
+          typename RandomAccessIterator,
+          typename Size,
+          typename OutputIterator,
+          typename BinIndex>
+void privatized_histogram(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ParallelFor parallel_for,
+  int max_workers,
+  RandomAccessIterator first,
+  Size num_pixels,
+  const ::cuda::std::array<OutputIterator, NumActiveChannels>& histograms,
+  const ::cuda::std::array<BinIndex, NumActiveChannels>& bin_indices)
+{
+  using counter_type = thrust::detail::it_value_t<OutputIterator>;
+  using size_type    = ::cuda::std::size_t;
+
+  ::cuda::std::array<size_type, NumActiveChannels> offsets{};
+  size_type num_counters = 0;
+  for (::cuda::std::size_t channel = 0; channel < NumActiveChannels; ++channel)
+  {
+    offsets[channel] = num_counters;
+    num_counters += static_cast<size_type>(bin_indices[channel].num_bins) + 1;
+  }
+
+  const size_type pixels_per_worker = (::cuda::std::max) (histogram_pixels_per_worker, num_counters);
+  const size_type max_num_workers   = static_cast<size_type>((::cuda::std::max) (max_workers, 1));
+  const int num_workers             = static_cast<int>((::cuda::std::clamp) (
+    ::cuda::ceil_div(static_cast<size_type>(num_pixels), pixels_per_worker), size_type{1}, max_num_workers));
+
+  thrust::detail::temporary_array<counter_type, DerivedPolicy> private_bins(exec, num_workers * num_counters);
+  counter_type* bins = thrust::raw_pointer_cast(private_bins.data());
+
+  parallel_for(num_workers, [&](int worker) {
+    counter_type* worker_bins = bins + worker * num_counters;
+    for (size_type i = 0; i < num_counters; ++i)
+    {
+      worker_bins[i] = counter_type(0);
+    }
+
+    const Size pixel_first = static_cast<Size>(num_pixels * worker / num_workers);
+    const Size pixel_last  = static_cast<Size>(num_pixels * (worker + 1) / num_workers);
+    histogram_detail::count_pixels<NumChannels>(first, pixel_first, pixel_last, worker_bins, offsets, bin_indices);
+  });
+
+  const size_type num_blocks = ::cuda::ceil_div(num_counters, histogram_merge_block_size);
+  parallel_for(num_blocks, [&](size_type block) {
+    const size_type block_first = block * histogram_merge_block_size;
+    const size_type block_last  = (::cuda::std::min) (block_first + histogram_merge_block_size, num_counters);
+
+    size_type channel = NumActiveChannels - 1;
+    while (offsets[channel] > block_first)
+    {
+      --channel;
+    }
+
+    for (size_type i = block_first; i < block_last; ++i)
+    {
+      if (channel + 1 < NumActiveChannels && i == offsets[channel + 1])
+      {
+        ++channel;
+      }
+
+      const size_type bin = i - offsets[channel];
+      if (bin == static_cast<size_type>(bin_indices[channel].num_bins))
+      {
+        continue;
+      }
+
+      counter_type count = bins[i];
+      for (int worker = 1; worker < num_workers; ++worker)
+      {
+        count += bins[worker * num_counters + i];
+      }
+      histograms[channel][bin] = count;
+    }
+  });
+}
+
+//! Implements the multi-channel histograms of a host backend with privatized_histogram, or with the generic
+//! implementation unless all iterators are random access.
+template <::cuda::std::size_t NumChannels,
+          ::cuda::std::size_t NumActiveChannels,
+          typename DerivedPolicy,
+          typename ParallelFor,
+          typename InputIterator,
+          typename OutputIterator,
+          typename BinIndex>
+void multi_histogram(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ParallelFor parallel_for,
+  int max_workers,
+  InputIterator first,
+  InputIterator last,
+  const ::cuda::std::array<OutputIterator, NumActiveChannels>& histograms,
+  const ::cuda::std::array<BinIndex, NumActiveChannels>& bin_indices)
+{
+  static_assert(0 < NumActiveChannels && NumActiveChannels <= NumChannels,
+                "the number of active channels must be positive and at most the number of channels");
+
+  using traversal =
+    thrust::detail::minimum_type<iterator_traversal_t<InputIterator>, iterator_traversal_t<OutputIterator>>;
+
+  if constexpr (::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
+  {
+    const auto num_pixels = ::cuda::std::distance(first, last) / NumChannels;
+    privatized_histogram<NumChannels>(exec, parallel_for, max_workers, first, num_pixels, histograms, bin_indices);
+  }
+  else
+  {
+    generic::histogram_detail::histogram_channels<NumChannels>(exec, first, last, histograms, bin_indices);
+  }
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
@@ -0,0 +1,171 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file reduce_interval.h
+ *  \brief Sequential reduction of the interval processed by one thread of the host backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_reference_cast.h>
+
+#include <cuda/__functional/maximum.h>
+#include <cuda/__functional/minimum.h>
+#include <cuda/__functional/operator_properties.h>
+#include <cuda/__type_traits/is_floating_point.h>
+#include <cuda/std/__functional/operations.h>
+#include <cuda/std/__type_traits/is_integer.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+namespace reduce_interval_detail
+{
+template <template <typename> class Operator, typename BinaryFunction, typename T>
+inline constexpr bool is_operator_v =
+  ::cuda::std::is_same_v<BinaryFunction, Operator<T>> || ::cuda::std::is_same_v<BinaryFunction, Operator<void>>;
+
+template <typename BinaryFunction, typename T>
+inline constexpr bool is_arithmetic_operator_v =
+  is_operator_v<::cuda::std::plus, BinaryFunction, T> || is_operator_v<::cuda::std::multiplies, BinaryFunction, T>
+  || is_operator_v<::cuda::minimum, BinaryFunction, T> || is_operator_v<::cuda::maximum, BinaryFunction, T>;
+
+template <typename BinaryFunction, typename T>
+inline constexpr bool is_bitwise_operator_v =
+  is_operator_v<::cuda::std::bit_and, BinaryFunction, T> || is_operator_v<::cuda::std::bit_or, BinaryFunction, T>
+  || is_operator_v<::cuda::std::bit_xor, BinaryFunction, T>;
+
+// Operators whose properties are described for T by <cuda/__functional/operator_properties.h>
+template <typename BinaryFunction, typename T>
+inline constexpr bool is_builtin_operator_v =
+  ::cuda::std::__cccl_is_cv_integer_v<T>
+    ? is_arithmetic_operator_v<BinaryFunction, T> || is_bitwise_operator_v<BinaryFunction, T>
+    : ::cuda::is_floating_point_v<T> && is_arithmetic_operator_v<BinaryFunction, T>;
+
+template <typename BinaryFunction, typename T, bool = is_builtin_operator_v<BinaryFunction, T>>
+inline constexpr bool is_commutative_v = false;
+
+template <typename BinaryFunction, typename T>
+inline constexpr bool is_commutative_v<BinaryFunction, T, true> = ::cuda::__is_commutative_v<BinaryFunction, T>;
+
+// Interleaved accumulators combine elements out of order, which is only valid for commutative operators. Reordering
+// floating-point sums is accepted here just as it is by the parallel decomposition of the reduction.
+template <typename BinaryFunction, typename OutputType>
+inline constexpr bool use_interleaved_accumulators_v = is_commutative_v<BinaryFunction, OutputType>;
+
+// Enough independent accumulators to fill a 512 bit vector register
+template <typename OutputType>
+inline constexpr ::cuda::std::size_t num_interleaved_accumulators =
+  sizeof(OutputType) >= 8 ? 8 : 64 / sizeof(OutputType);
+
+inline constexpr ::cuda::std::size_t num_blocked_accumulators = 4;
+
+// Below this size the setup of the accumulators is not amortized
+inline constexpr ::cuda::std::size_t min_accumulated_size = 64;
+} // namespace reduce_interval_detail
+
+//! Reduces the non-empty interval [first, first + n) with binary_op and returns the result.
+//!
+//! A single chain of dependent binary_op calls is limited to one operation per latency of binary_op. Instead, the
+//! interval is reduced into several independent accumulators that are combined at the end:
+//! - Commutative builtin operators on arithmetic types use accumulators that each process every k-th element, so
+//!   that the inner loop maps onto SIMD lanes.
+//! - Other operators use accumulators that each process one contiguous block of the interval, which only relies on
+//!   the associativity of binary_op that the reduction algorithms require anyway.
+//! In both cases binary_op is invoked n - 1 times, as in a sequential reduction.
+template <typename OutputType, typename RandomAccessIterator, typename Size, typename BinaryFunction>
+OutputType reduce_interval(RandomAccessIterator first, Size n, BinaryFunction binary_op)
+{
+  namespace detail = reduce_interval_detail;
+
+  thrust::detail::wrapped_function<BinaryFunction, OutputType> wrapped_binary_op{binary_op};
+
+  if (static_cast<::cuda::std::size_t>(n) < detail::min_accumulated_size)
+  {
+    OutputType sum = thrust::raw_reference_cast(*first);
+    for (Size i = 1; i < n; ++i)
+    {
+      sum = wrapped_binary_op(sum, first[i]);
+    }
+    return sum;
+  }
+
+  if constexpr (detail::use_interleaved_accumulators_v<BinaryFunction, OutputType>)
+  {
+    constexpr Size num_lanes = static_cast<Size>(detail::num_interleaved_accumulators<OutputType>);
+
+    OutputType lanes[num_lanes];
+    for (Size lane = 0; lane < num_lanes; ++lane)
+    {
+      lanes[lane] = thrust::raw_reference_cast(first[lane]);
+    }
+
+    Size i = num_lanes;
+    for (; i + num_lanes <= n; i += num_lanes)
+    {
+      for (Size lane = 0; lane < num_lanes; ++lane)
+      {
+        lanes[lane] = wrapped_binary_op(lanes[lane], first[i + lane]);
+      }
+    }
+    for (; i < n; ++i)
+    {
+      lanes[0] = wrapped_binary_op(lanes[0], first[i]);
+    }
+
+    for (Size width = num_lanes / 2; width > 0; width /= 2)
+    {
+      for (Size lane = 0; lane < width; ++lane)
+      {
+        lanes[lane] = wrapped_binary_op(lanes[lane], lanes[lane + width]);
+      }
+    }
+    return lanes[0];
+  }
+  else
+  {
+    // OutputType need not be default constructible, so the accumulators are named rather than stored in an array
+    const Size block_size = n / static_cast<Size>(detail::num_blocked_accumulators);
+
+    const RandomAccessIterator first0 = first;
+    const RandomAccessIterator first1 = first0 + block_size;
+    const RandomAccessIterator first2 = first1 + block_size;
+    const RandomAccessIterator first3 = first2 + block_size;
+
+    OutputType sum0 = thrust::raw_reference_cast(*first0);
+    OutputType sum1 = thrust::raw_reference_cast(*first1);
+    OutputType sum2 = thrust::raw_reference_cast(*first2);
+    OutputType sum3 = thrust::raw_reference_cast(*first3);
+
+    for (Size i = 1; i < block_size; ++i)
+    {
+      sum0 = wrapped_binary_op(sum0, first0[i]);
+      sum1 = wrapped_binary_op(sum1, first1[i]);
+      sum2 = wrapped_binary_op(sum2, first2[i]);
+      sum3 = wrapped_binary_op(sum3, first3[i]);
+    }
+
+    // The last block also takes the remainder of the interval
+    for (Size i = block_size; i < n - 3 * block_size; ++i)
+    {
+      sum3 = wrapped_binary_op(sum3, first3[i]);
+    }
+
+    return wrapped_binary_op(wrapped_binary_op(sum0, sum1), wrapped_binary_op(sum2, sum3));
+  }
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
@@ -0,0 +1,281 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/run_length_encode.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__utility/pair.h>
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+// The input is cut into chunks of this many elements, which are the units of parallel work
+inline constexpr ::cuda::std::size_t run_length_encode_chunk_size = 1 << 14;
+
+namespace run_length_encode_detail
+{
+// The runs which start in a chunk, where the positions are n if none does
+template <typename Size>
+struct chunk_runs
+{
+  Size first_start;
+  Size last_start;
+  // The number of selected runs that start and end within the chunk
+  Size num_selected;
+  // The start of the first run after the chunk
+  Size next_start;
+  // The number of selected runs that start before the chunk
+  Size output_offset;
+};
+
+struct select_all_runs
+{
+  template <typename Size>
+  bool operator()(Size) const
+  {
+    return true;
+  }
+};
+
+struct select_non_trivial_runs
+{
+  template <typename Size>
+  bool operator()(Size length) const
+  {
+    return length > Size(1);
+  }
+};
+
+//! Invokes f(start, length) for every run of n elements which starts and ends in [chunk_first, chunk_last), in order,
+//! where is_start(i) tells whether a run starts at element i. Returns the start of the last run that starts in the
+//! chunk, or n if none does.
+template <typename Size, typename IsStart, typename F>
+Size for_each_complete_run(Size n, Size chunk_first, Size chunk_last, IsStart is_start, F f)
+{
+  Size start = n;
+  for (Size i = chunk_first; i < chunk_last; ++i)
+  {
+    if (is_start(i))
+    {
+      if (start != n)
+      {
+        f(start, i - start);
+      }
+      start = i;
+    }
+  }
+  return start;
+}
+
+//! Emits emit(k, start, length) for the k-th run of the n elements at first that select(length) accepts, and returns
+//! the number of those runs. A run starts at every element which binary_pred does not relate to its predecessor.
+//!
+//! The run starts of every chunk are found and stored in parallel, the chunks are linked to their successors and
+//! scanned sequentially, and every chunk then emits its runs in parallel from the stored starts, so binary_pred is
+//! evaluated once per element. parallel_for(num_chunks, f) must invoke f(i) for every i in [0, num_chunks).
+template <typename DerivedPolicy,
+          typename ParallelFor,
+          typename RandomAccessIterator,
+          typename Size,
+          typename BinaryPredicate,
+          typename Select,
+          typename Emit>
+Size encode_runs(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ParallelFor parallel_for,
+  RandomAccessIterator first,
+  Size n,
+  BinaryPredicate binary_pred,
+  Select select,
+  Emit emit)
+{
+  if (n == 0)
+  {
+    return 0;
+  }
+
+  const Size chunk_size = static_cast<Size>(run_length_encode_chunk_size);
+  const Size num_chunks = ::cuda::ceil_div(n, chunk_size);
+  thrust::detail::temporary_array<chunk_runs<Size>, DerivedPolicy> chunk_storage(exec, num_chunks);
+  chunk_runs<Size>* chunks = thrust::raw_pointer_cast(chunk_storage.data());
+  thrust::detail::temporary_array<bool, DerivedPolicy> start_storage(exec, n);
+  bool* starts = thrust::raw_pointer_cast(start_storage.data());
+
+  const auto for_each_run_of_chunk = [&](Size chunk, auto is_start, auto f) {
+    const Size chunk_first = chunk * chunk_size;
+    const Size chunk_last  = (::cuda::std::min) (chunk_first + chunk_size, n);
+    return for_each_complete_run(n, chunk_first, chunk_last, is_start, f);
+  };
+
+  const auto find_start = [&](Size i) {
+    return starts[i] = i == 0 || !binary_pred(first[i - 1], first[i]);
+  };
+  const auto stored_start = [&](Size i) {
+    return starts[i];
+  };
+
+  parallel_for(num_chunks, [&](Size chunk) {
+    chunk_runs<Size> runs{n, n, 0, n, 0};
+    runs.last_start = for_each_run_of_chunk(chunk, find_start, [&](Size start, Size length) {
+      if (runs.first_start == n)
+      {
+        runs.first_start = start;
+      }
+      if (select(length))
+      {
+        ++runs.num_selected;
+      }
+    });
+    if (runs.first_start == n)
+    {
+      runs.first_start = runs.last_start;
+    }
+    chunks[chunk] = runs;
+  });
+
+  Size next_start = n;
+  for (Size chunk = num_chunks; chunk-- > 0;)
+  {
+    chunks[chunk].next_start = next_start;
+    if (chunks[chunk].first_start != n)
+    {
+      next_start = chunks[chunk].first_start;
+    }
+  }
+
+  Size num_selected = 0;
+  for (Size chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    chunk_runs<Size>& runs = chunks[chunk];
+    runs.output_offset     = num_selected;
+    num_selected += runs.num_selected;
+    if (runs.last_start != n && select(runs.next_start - runs.last_start))
+    {
+      ++num_selected;
+    }
+  }
+
+  parallel_for(num_chunks, [&](Size chunk) {
+    const chunk_runs<Size> runs = chunks[chunk];
+    Size k                      = runs.output_offset;
+    const Size last_start = for_each_run_of_chunk(chunk, stored_start, [&](Size start, Size length) {
+      if (select(length))
+      {
+        emit(k++, start, length);
+      }
+    });
+    if (last_start != n && select(runs.next_start - last_start))
+    {
+      emit(k, last_start, runs.next_start - last_start);
+    }
+  });
+
+  return num_selected;
+}
+} // namespace run_length_encode_detail
+
+//! Implements run_length_encode of a host backend with encode_runs, or with the generic implementation unless all
+//! iterators are random access.
+template <typename DerivedPolicy,
+          typename ParallelFor,
+          typename InputIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+::cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ParallelFor parallel_for,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 unique_out,
+  OutputIterator2 counts_out,
+  BinaryPredicate binary_pred)
+{
+  using traversal = thrust::detail::minimum_type<iterator_traversal_t<InputIterator>,
+                                                 iterator_traversal_t<OutputIterator1>,
+                                                 iterator_traversal_t<OutputIterator2>>;
+
+  if constexpr (::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
+  {
+    const auto num_runs = run_length_encode_detail::encode_runs(
+      exec,
+      parallel_for,
+      first,
+      ::cuda::std::distance(first, last),
+      binary_pred,
+      run_length_encode_detail::select_all_runs{},
+      [&](auto k, auto start, auto length) {
+        unique_out[k] = first[start];
+        counts_out[k] = length;
+      });
+    return {unique_out + num_runs, counts_out + num_runs};
+  }
+  else
+  {
+    return generic::run_length_encode(exec, first, last, unique_out, counts_out, binary_pred);
+  }
+}
+
+//! Implements non_trivial_runs of a host backend with encode_runs, or with the generic implementation unless all
+//! iterators are random access.
+template <typename DerivedPolicy,
+          typename ParallelFor,
+          typename ForwardIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+::cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ParallelFor parallel_for,
+  ForwardIterator first,
+  ForwardIterator last,
+  OutputIterator1 offsets_out,
+  OutputIterator2 lengths_out,
+  BinaryPredicate binary_pred)
+{
+  using traversal = thrust::detail::minimum_type<iterator_traversal_t<ForwardIterator>,
+                                                 iterator_traversal_t<OutputIterator1>,
+                                                 iterator_traversal_t<OutputIterator2>>;
+
+  if constexpr (::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
+  {
+    const auto num_runs = run_length_encode_detail::encode_runs(
+      exec,
+      parallel_for,
+      first,
+      ::cuda::std::distance(first, last),
+      binary_pred,
+      run_length_encode_detail::select_non_trivial_runs{},
+      [&](auto k, auto start, auto length) {
+        offsets_out[k] = start;
+        lengths_out[k] = length;
+      });
+    return {offsets_out + num_runs, lengths_out + num_runs};
+  }
+  else
+  {
+    return generic::non_trivial_runs(exec, first, last, offsets_out, lengths_out, binary_pred);
+  }
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
@@ -0,0 +1,237 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file segmented.h
+ *  \brief Segmented sorts and reductions of the host backends that balance segments of any sizes across threads.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/function.h>
+#include <thrust/detail/seq.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/internal/reduce_interval.h>
+
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/cstddef>
+
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+// Segments of at least this many elements are processed with all threads, one segment after the other. Smaller
+// segments are processed sequentially, each by a single thread.
+inline constexpr ::cuda::std::size_t segmented_large_segment_size = 1 << 16;
+
+// Consecutive small segments are batched until they contain at least this many elements. The batches are the units of
+// parallel work, so that millions of tiny segments do not cost one scheduling decision each.
+inline constexpr ::cuda::std::size_t segmented_batch_size = 1 << 14;
+
+namespace segmented_detail
+{
+template <typename Difference, typename BeginOffsetIterator, typename EndOffsetIterator>
+struct segments
+{
+  BeginOffsetIterator begin_offsets_first;
+  EndOffsetIterator end_offsets_first;
+
+  template <typename Size>
+  Difference begin(Size segment) const
+  {
+    return static_cast<Difference>(begin_offsets_first[segment]);
+  }
+
+  template <typename Size>
+  Difference end(Size segment) const
+  {
+    return static_cast<Difference>(end_offsets_first[segment]);
+  }
+
+  // Empty segments, including those whose end precedes their begin, have size 0
+  template <typename Size>
+  Difference size(Size segment) const
+  {
+    const Difference n = end(segment) - begin(segment);
+    return n > 0 ? n : Difference{0};
+  }
+};
+
+//! Invokes process_small(segment) for every segment with fewer than segmented_large_segment_size elements, in
+//! parallel, and then process_large(segment) for every other segment, in order.
+//!
+//! A sequential pass over the offsets first cuts the segments into batches of roughly segmented_batch_size small
+//! elements and lists the large segments. parallel_for(num_batches, f) must invoke f(i) for every i in
+//! [0, num_batches) and should schedule the batches dynamically, since their costs still vary.
+template <typename Size,
+          typename Difference,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename ParallelFor,
+          typename ProcessSmall,
+          typename ProcessLarge>
+void for_each_segment(
+  const segments<Difference, BeginOffsetIterator, EndOffsetIterator>& segs,
+  Size num_segments,
+  ParallelFor parallel_for,
+  ProcessSmall process_small,
+  ProcessLarge process_large)
+{
+  const Difference large_size = static_cast<Difference>(segmented_large_segment_size);
+  const Difference batch_size = static_cast<Difference>(segmented_batch_size);
+
+  // Batch i holds the segments in [batch_bounds[i], batch_bounds[i + 1])
+  std::vector<Size> batch_bounds{Size{0}};
+  std::vector<Size> large_segments;
+
+  Difference batch_elements = 0;
+  for (Size segment = 0; segment < num_segments; ++segment)
+  {
+    const Difference n = segs.size(segment);
+    if (n >= large_size)
+    {
+      large_segments.push_back(segment);
+    }
+    else if ((batch_elements += n) >= batch_size)
+    {
+      batch_bounds.push_back(segment + 1);
+      batch_elements = 0;
+    }
+  }
+  if (batch_bounds.back() != num_segments)
+  {
+    batch_bounds.push_back(num_segments);
+  }
+
+  const Size num_batches = static_cast<Size>(batch_bounds.size() - 1);
+  parallel_for(num_batches, [&](Size batch) {
+    for (Size segment = batch_bounds[batch]; segment < batch_bounds[batch + 1]; ++segment)
+    {
+      if (segs.size(segment) < large_size)
+      {
+        process_small(segment);
+      }
+    }
+  });
+
+  for (const Size segment : large_segments)
+  {
+    process_large(segment);
+  }
+}
+} // namespace segmented_detail
+
+//! Sorts every segment [first + begin_offsets_first[i], first + end_offsets_first[i]) with comp.
+//!
+//! Small segments are sorted sequentially by the thread that owns their batch. Large segments are sorted one after the
+//! other with the parallel sort of exec, so that a few huge segments still use all threads.
+template <bool Stable,
+          typename DerivedPolicy,
+          typename ParallelFor,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename StrictWeakOrdering>
+void segmented_sort(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ParallelFor parallel_for,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  using difference_type = thrust::detail::it_difference_t<RandomAccessIterator>;
+  using size_type       = thrust::detail::it_difference_t<BeginOffsetIterator>;
+
+  const segmented_detail::segments<difference_type, BeginOffsetIterator, EndOffsetIterator> segs{
+    begin_offsets_first, end_offsets_first};
+
+  auto sort_segment = [&](auto&& policy, size_type segment) {
+    if constexpr (Stable)
+    {
+      thrust::stable_sort(policy, first + segs.begin(segment), first + segs.end(segment), comp);
+    }
+    else
+    {
+      thrust::sort(policy, first + segs.begin(segment), first + segs.end(segment), comp);
+    }
+  };
+
+  segmented_detail::for_each_segment(
+    segs,
+    ::cuda::std::distance(begin_offsets_first, begin_offsets_last),
+    parallel_for,
+    [&](size_type segment) {
+      if (segs.size(segment) > 1)
+      {
+        sort_segment(thrust::seq, segment);
+      }
+    },
+    [&](size_type segment) {
+      sort_segment(exec, segment);
+    });
+}
+
+//! Reduces every segment [first + begin_offsets_first[i], first + end_offsets_first[i]) with binary_op, starting from
+//! init, into result[i] and returns the end of the output.
+//!
+//! Small segments are reduced sequentially with reduce_interval by the thread that owns their batch. Large segments
+//! are reduced one after the other with the parallel reduction of exec.
+template <typename DerivedPolicy,
+          typename ParallelFor,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+OutputIterator segmented_reduce(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ParallelFor parallel_for,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op)
+{
+  using difference_type = thrust::detail::it_difference_t<RandomAccessIterator>;
+  using size_type       = thrust::detail::it_difference_t<BeginOffsetIterator>;
+
+  const segmented_detail::segments<difference_type, BeginOffsetIterator, EndOffsetIterator> segs{
+    begin_offsets_first, end_offsets_first};
+  const size_type num_segments = ::cuda::std::distance(begin_offsets_first, begin_offsets_last);
+
+  segmented_detail::for_each_segment(
+    segs,
+    num_segments,
+    parallel_for,
+    [&](size_type segment) {
+      thrust::detail::wrapped_function<BinaryFunction, T> wrapped_binary_op{binary_op};
+
+      const difference_type n = segs.size(segment);
+      result[segment] =
+        n == 0 ? init : wrapped_binary_op(init, reduce_interval<T>(first + segs.begin(segment), n, binary_op));
+    },
+    [&](size_type segment) {
+      result[segment] = thrust::reduce(exec, first + segs.begin(segment), first + segs.end(segment), init, binary_op);
+    });
+
+  return result + num_segments;
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
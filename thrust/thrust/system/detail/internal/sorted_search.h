@@ -0,0 +1,207 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file sorted_search.h
+ *  \brief Vectorized binary searches of the host backends that exploit sorted runs of values.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/function.h>
+#include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/binary_search.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+enum class search_kind
+{
+  lower_bound,
+  upper_bound,
+  binary_search
+};
+
+// The values are searched in blocks of this many values, which are the units of parallel work. Within a block, the
+// search of each value that does not precede the position found for its predecessor starts from that position.
+inline constexpr ::cuda::std::size_t sorted_search_block_size = 1 << 12;
+
+namespace sorted_search_detail
+{
+// Whether element precedes the position searched for value. This is true for a prefix of a sorted range.
+template <search_kind Kind, typename Element, typename T, typename StrictWeakOrdering>
+bool precedes(StrictWeakOrdering& comp, const Element& element, const T& value)
+{
+  if constexpr (Kind == search_kind::upper_bound)
+  {
+    return !comp(value, element);
+  }
+  else
+  {
+    return comp(element, value);
+  }
+}
+
+// Returns the first position in [lo, hi) whose element does not precede value, or hi if there is none
+template <search_kind Kind, typename RandomAccessIterator, typename Size, typename T, typename StrictWeakOrdering>
+Size bisect(RandomAccessIterator first, Size lo, Size hi, const T& value, StrictWeakOrdering& comp)
+{
+  Size len = hi - lo;
+  while (len > 0)
+  {
+    const Size half = len / 2;
+    if (precedes<Kind>(comp, first[lo + half], value))
+    {
+      lo += half + 1;
+      len -= half + 1;
+    }
+    else
+    {
+      len = half;
+    }
+  }
+  return lo;
+}
+
+// Returns the first position in [lo, n) whose element does not precede value, or n if there is none. The distance
+// from lo is doubled until the position is bracketed, so that the search costs O(log(result - lo)) comparisons.
+template <search_kind Kind, typename RandomAccessIterator, typename Size, typename T, typename StrictWeakOrdering>
+Size gallop(RandomAccessIterator first, Size lo, Size n, const T& value, StrictWeakOrdering& comp)
+{
+  Size step = 1;
+  Size hi   = lo;
+  while (hi < n && precedes<Kind>(comp, first[hi], value))
+  {
+    lo = hi + 1;
+    hi = (n - lo > step) ? lo + step : n;
+    step *= 2;
+  }
+  return bisect<Kind>(first, lo, hi, value, comp);
+}
+} // namespace sorted_search_detail
+
+//! Searches each of the num_values values starting at values_first in the sorted range [first, first + n) and writes
+//! the results to output, like the vectorized lower_bound, upper_bound and binary_search.
+//!
+//! Every block of values is searched sequentially. A value whose position is not before the position of its
+//! predecessor is searched by galloping from that position, which costs O(log(gap)) instead of O(log(n)) comparisons
+//! and walks the range in order, so sorted runs of values are merged with the range rather than searched
+//! independently. Any other value is searched by bisecting the range before that position, and starts a new run.
+//! Values are only compared with elements of the range, so comp need not be callable with two values.
+//! parallel_for(num_blocks, f) must invoke f(i) for every i in [0, num_blocks).
+template <search_kind Kind,
+          typename ParallelFor,
+          typename RandomAccessIterator,
+          typename Size,
+          typename InputIterator,
+          typename ValuesSize,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+void sorted_search(
+  ParallelFor parallel_for,
+  RandomAccessIterator first,
+  Size n,
+  InputIterator values_first,
+  ValuesSize num_values,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  namespace detail = sorted_search_detail;
+
+  const ValuesSize block_size = static_cast<ValuesSize>(sorted_search_block_size);
+  const ValuesSize num_blocks = ::cuda::ceil_div(num_values, block_size);
+
+  parallel_for(num_blocks, [&](ValuesSize block) {
+    thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+    const ValuesSize block_first = block * block_size;
+    const ValuesSize block_last  = block_first + (::cuda::std::min) (block_size, num_values - block_first);
+
+    // The position of the previous value, for lower_bound in case of binary_search
+    constexpr search_kind position_kind =
+      Kind == search_kind::upper_bound ? search_kind::upper_bound : search_kind::lower_bound;
+    Size position = 0;
+
+    for (ValuesSize i = block_first; i < block_last; ++i)
+    {
+      const auto& value = values_first[i];
+
+      // The value continues the run if the element before the previous position precedes it
+      const bool in_run = position == 0 || detail::precedes<position_kind>(wrapped_comp, first[position - 1], value);
+      position =
+        in_run
+          ? detail::gallop<position_kind>(first, position, n, value, wrapped_comp)
+          : detail::bisect<position_kind>(first, Size{0}, position - 1, value, wrapped_comp);
+
+      if constexpr (Kind == search_kind::binary_search)
+      {
+        output[i] = position != n && !wrapped_comp(value, first[position]);
+      }
+      else
+      {
+        output[i] = position;
+      }
+    }
+  });
+}
+
+//! Implements the vectorized lower_bound, upper_bound and binary_search of a host backend with sorted_search, or with
+//! the generic implementation unless all iterators are random access.
+template <search_kind Kind,
+          typename DerivedPolicy,
+          typename ParallelFor,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator vectorized_search(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ParallelFor parallel_for,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  using traversal = thrust::detail::minimum_type<iterator_traversal_t<ForwardIterator>,
+                                                 iterator_traversal_t<InputIterator>,
+                                                 iterator_traversal_t<OutputIterator>>;
+
+  if constexpr (::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
+  {
+    const auto num_values = ::cuda::std::distance(values_begin, values_end);
+    sorted_search<Kind>(parallel_for, begin, ::cuda::std::distance(begin, end), values_begin, num_values, output, comp);
+    return output + num_values;
+  }
+  else if constexpr (Kind == search_kind::lower_bound)
+  {
+    return generic::lower_bound(exec, begin, end, values_begin, values_end, output, comp);
+  }
+  else if constexpr (Kind == search_kind::upper_bound)
+  {
+    return generic::upper_bound(exec, begin, end, values_begin, values_end, output, comp);
+  }
+  else
+  {
+    return generic::binary_search(exec, begin, end, values_begin, values_end, output, comp);
+  }
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
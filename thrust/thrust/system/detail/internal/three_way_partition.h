@@ -0,0 +1,203 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/three_way_partition.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/tuple>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+// The input is cut into chunks of this many elements, which are the units of parallel work
+inline constexpr ::cuda::std::size_t three_way_partition_chunk_size = 1 << 14;
+
+namespace three_way_partition_detail
+{
+// The part an element is copied to
+enum class part : unsigned char
+{
+  first,
+  second,
+  unselected
+};
+
+// The numbers of elements of a chunk, or of all chunks before it, in the first and the second part
+template <typename Size>
+struct part_sizes
+{
+  Size first_part;
+  Size second_part;
+};
+
+//! Copies the n elements at first into the three parts, and returns the sizes of the first and the second part.
+//!
+//! The elements of every chunk are classified and counted in parallel, the counts are scanned sequentially, and every
+//! chunk then copies its elements in parallel. The part of every element is stored in the first pass, so each predicate
+//! is evaluated at most once per element. parallel_for(num_chunks, f) must invoke f(i) for every i in [0, num_chunks).
+template <typename DerivedPolicy,
+          typename ParallelFor,
+          typename RandomAccessIterator,
+          typename Size,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename OutputIterator3,
+          typename Predicate1,
+          typename Predicate2>
+part_sizes<Size> partition_chunks(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ParallelFor parallel_for,
+  RandomAccessIterator first,
+  Size n,
+  OutputIterator1 first_part_out,
+  OutputIterator2 second_part_out,
+  OutputIterator3 unselected_out,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part)
+{
+  if (n == 0)
+  {
+    return {0, 0};
+  }
+
+  const Size chunk_size = static_cast<Size>(three_way_partition_chunk_size);
+  const Size num_chunks = ::cuda::ceil_div(n, chunk_size);
+  thrust::detail::temporary_array<part_sizes<Size>, DerivedPolicy> size_storage(exec, num_chunks);
+  part_sizes<Size>* sizes = thrust::raw_pointer_cast(size_storage.data());
+  thrust::detail::temporary_array<part, DerivedPolicy> part_storage(exec, n);
+  part* parts = thrust::raw_pointer_cast(part_storage.data());
+
+  parallel_for(num_chunks, [&](Size chunk) {
+    const Size chunk_first = chunk * chunk_size;
+    const Size chunk_last  = (::cuda::std::min) (chunk_first + chunk_size, n);
+
+    part_sizes<Size> chunk_sizes{0, 0};
+    for (Size i = chunk_first; i < chunk_last; ++i)
+    {
+      if (select_first_part(first[i]))
+      {
+        parts[i] = part::first;
+        ++chunk_sizes.first_part;
+      }
+      else if (select_second_part(first[i]))
+      {
+        parts[i] = part::second;
+        ++chunk_sizes.second_part;
+      }
+      else
+      {
+        parts[i] = part::unselected;
+      }
+    }
+    sizes[chunk] = chunk_sizes;
+  });
+
+  part_sizes<Size> total{0, 0};
+  for (Size chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    const part_sizes<Size> chunk_sizes = sizes[chunk];
+    sizes[chunk]                       = total;
+    total.first_part += chunk_sizes.first_part;
+    total.second_part += chunk_sizes.second_part;
+  }
+
+  parallel_for(num_chunks, [&](Size chunk) {
+    const Size chunk_first = chunk * chunk_size;
+    const Size chunk_last  = (::cuda::std::min) (chunk_first + chunk_size, n);
+
+    Size k1 = sizes[chunk].first_part;
+    Size k2 = sizes[chunk].second_part;
+    // The unselected elements before the chunk are all others
+    Size k3 = chunk_first - k1 - k2;
+    for (Size i = chunk_first; i < chunk_last; ++i)
+    {
+      switch (parts[i])
+      {
+        case part::first:
+          first_part_out[k1++] = first[i];
+          break;
+        case part::second:
+          second_part_out[k2++] = first[i];
+          break;
+        default:
+          unselected_out[k3++] = first[i];
+          break;
+      }
+    }
+  });
+
+  return total;
+}
+} // namespace three_way_partition_detail
+
+//! Implements three_way_partition of a host backend with partition_chunks, or with the generic implementation unless
+//! all iterators are random access.
+template <typename DerivedPolicy,
+          typename ParallelFor,
+          typename ForwardIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename OutputIterator3,
+          typename Predicate1,
+          typename Predicate2>
+::cuda::std::tuple<OutputIterator1, OutputIterator2, OutputIterator3> three_way_partition(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ParallelFor parallel_for,
+  ForwardIterator first,
+  ForwardIterator last,
+  OutputIterator1 first_part_out,
+  OutputIterator2 second_part_out,
+  OutputIterator3 unselected_out,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part)
+{
+  using traversal = thrust::detail::minimum_type<iterator_traversal_t<ForwardIterator>,
+                                                 iterator_traversal_t<OutputIterator1>,
+                                                 iterator_traversal_t<OutputIterator2>,
+                                                 iterator_traversal_t<OutputIterator3>>;
+
+  if constexpr (::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
+  {
+    const auto n     = ::cuda::std::distance(first, last);
+    const auto sizes = three_way_partition_detail::partition_chunks(
+      exec,
+      parallel_for,
+      first,
+      n,
+      first_part_out,
+      second_part_out,
+      unselected_out,
+      select_first_part,
+      select_second_part);
+    return {first_part_out + sizes.first_part,
+            second_part_out + sizes.second_part,
+            unselected_out + (n - sizes.first_part - sizes.second_part)};
+  }
+  else
+  {
+    return generic::three_way_partition(
+      exec, first, last, first_part_out, second_part_out, unselected_out, select_first_part, select_second_part);
+  }
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/histogram.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+#include <cuda/std/array>
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::sequential
+{
+namespace histogram_detail
+{
+// Counts complete pixels in a single pass, so that the samples may be read through an input iterator
+template <::cuda::std::size_t NumChannels,
+          ::cuda::std::size_t NumActiveChannels,
+          typename InputIterator,
+          typename OutputIterator,
+          typename BinIndex>
+_CCCL_HOST_DEVICE void histogram_channels(
+  InputIterator first,
+  InputIterator last,
+  const ::cuda::std::array<OutputIterator, NumActiveChannels>& histograms,
+  const ::cuda::std::array<BinIndex, NumActiveChannels>& bin_indices)
+{
+  static_assert(0 < NumActiveChannels && NumActiveChannels <= NumChannels,
+                "the number of active channels must be positive and at most the number of channels");
+
+  using counter_type = thrust::detail::it_value_t<OutputIterator>;
+
+  for (::cuda::std::size_t channel = 0; channel < NumActiveChannels; ++channel)
+  {
+    for (int bin = 0; bin < bin_indices[channel].num_bins; ++bin)
+    {
+      histograms[channel][bin] = counter_type(0);
+    }
+  }
+
+  int bins[NumActiveChannels];
+  ::cuda::std::size_t channel = 0;
+  for (; first != last; ++first)
+  {
+    if (channel < NumActiveChannels)
+    {
+      bins[channel] = bin_indices[channel](*first);
+    }
+
+    if (++channel == NumChannels)
+    {
+      channel = 0;
+      for (::cuda::std::size_t c = 0; c < NumActiveChannels; ++c)
+      {
+        if (bins[c] < bin_indices[c].num_bins)
+        {
+          ++histograms[c][bins[c]];
+        }
+      }
+    }
+  }
+}
+} // namespace histogram_detail
+
+template <::cuda::std::size_t NumChannels,
+          ::cuda::std::size_t NumActiveChannels,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename LevelT>
+_CCCL_HOST_DEVICE void multi_histogram_even(
+  sequential::execution_policy<DerivedPolicy>&,
+  InputIterator first,
+  InputIterator last,
+  const ::cuda::std::array<OutputIterator, NumActiveChannels>& histograms,
+  const ::cuda::std::array<int, NumActiveChannels>& num_levels,
+  const ::cuda::std::array<LevelT, NumActiveChannels>& lower_levels,
+  const ::cuda::std::array<LevelT, NumActiveChannels>& upper_levels)
+{
+  using sample_type = thrust::detail::it_value_t<InputIterator>;
+  histogram_detail::histogram_channels<NumChannels>(
+    first,
+    last,
+    histograms,
+    generic::histogram_detail::make_even_bin_indices<sample_type>(num_levels, lower_levels, upper_levels));
+}
+
+template <::cuda::std::size_t NumChannels,
+          ::cuda::std::size_t NumActiveChannels,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename LevelIterator>
+_CCCL_HOST_DEVICE void multi_histogram_range(
+  sequential::execution_policy<DerivedPolicy>&,
+  InputIterator first,
+  InputIterator last,
+  const ::cuda::std::array<OutputIterator, NumActiveChannels>& histograms,
+  const ::cuda::std::array<int, NumActiveChannels>& num_levels,
+  const ::cuda::std::array<LevelIterator, NumActiveChannels>& levels)
+{
+  using sample_type = thrust::detail::it_value_t<InputIterator>;
+  histogram_detail::histogram_channels<NumChannels>(
+    first, last, histograms, generic::histogram_detail::make_range_bin_indices<sample_type>(num_levels, levels));
+}
+} // namespace system::detail::sequential
+THRUST_NAMESPACE_END
@@ -0,0 +1,466 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::sequential
+{
+namespace powersort_detail
+{
+// Runs which are shorter than this are extended by insertion sort
+inline constexpr int min_run = 32;
+
+// The number of consecutive elements a merge takes from the same run before it starts to gallop
+inline constexpr int min_gallop = 7;
+
+// The maximum number of pending runs, which is one more than the number of bits of a run length
+inline constexpr int max_pending_runs = 65;
+
+// The number of leading elements of the sorted range [first, first + n) which go before key: those which are not
+// greater than key if Upper, and those which are less than key otherwise. The search probes 1, 3, 7, ... elements from
+// the beginning if FromLeft, and from the end otherwise, so it is fast if the result is close to that end.
+_CCCL_EXEC_CHECK_DISABLE
+template <bool Upper,
+          bool FromLeft,
+          typename RandomAccessIterator,
+          typename Size,
+          typename T,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE Size gallop(RandomAccessIterator first, Size n, const T& key, StrictWeakOrdering& comp)
+{
+  auto goes_before = [&](Size i) {
+    if constexpr (Upper)
+    {
+      return !comp(key, first[i]);
+    }
+    else
+    {
+      return static_cast<bool>(comp(first[i], key));
+    }
+  };
+
+  // The result is in [lo, hi]
+  Size lo = 0;
+  Size hi = n;
+  if constexpr (FromLeft)
+  {
+    Size last = 0;
+    Size ofs  = 1;
+    while (ofs <= n && goes_before(ofs - 1))
+    {
+      last = ofs;
+      ofs  = 2 * ofs + 1;
+    }
+    lo = last;
+    hi = (::cuda::std::min) (ofs - 1, n);
+  }
+  else
+  {
+    Size last = 0;
+    Size ofs  = 1;
+    while (ofs <= n && !goes_before(n - ofs))
+    {
+      last = ofs;
+      ofs  = 2 * ofs + 1;
+    }
+    lo = n - (::cuda::std::min) (ofs - 1, n);
+    hi = n - last;
+  }
+
+  while (lo < hi)
+  {
+    const Size mid = lo + (hi - lo) / 2;
+    if (goes_before(mid))
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+// Returns the length of the run at the beginning of [first, first + n). A strictly descending run is reversed, which
+// keeps the order of equivalent elements because they cannot be part of it.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename Size, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE Size find_run(RandomAccessIterator first, Size n, StrictWeakOrdering& comp)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  if (n <= 1)
+  {
+    return n;
+  }
+
+  Size len = 2;
+  if (comp(first[1], first[0]))
+  {
+    while (len < n && comp(first[len], first[len - 1]))
+    {
+      ++len;
+    }
+
+    for (Size i = 0, j = len - 1; i < j; ++i, --j)
+    {
+      value_type tmp = first[i];
+      first[i]       = first[j];
+      first[j]       = tmp;
+    }
+  }
+  else
+  {
+    while (len < n && !comp(first[len], first[len - 1]))
+    {
+      ++len;
+    }
+  }
+  return len;
+}
+
+// Extends the sorted range [first, first + sorted) to [first, first + n) by insertion
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename Size, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void extend_run(RandomAccessIterator first, Size sorted, Size n, StrictWeakOrdering& comp)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  for (Size i = sorted; i < n; ++i)
+  {
+    value_type tmp = first[i];
+    Size j         = i;
+    for (; j > 0 && comp(tmp, first[j - 1]); --j)
+    {
+      first[j] = first[j - 1];
+    }
+    first[j] = tmp;
+  }
+}
+
+// Merges [first, first + n1) with [first + n1, first + n1 + n2) while n1 <= n2, using buffer for the first run
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename Size, typename Pointer, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void
+merge_low(RandomAccessIterator first, Size n1, Size n2, Pointer buffer, StrictWeakOrdering& comp)
+{
+  for (Size i = 0; i < n1; ++i)
+  {
+    buffer[i] = first[i];
+  }
+
+  Size a         = 0;
+  Size b         = n1;
+  Size out       = 0;
+  const Size end = n1 + n2;
+
+  while (a < n1 && b < end)
+  {
+    // Take one element at a time until one run wins min_gallop times in a row
+    int a_wins = 0;
+    int b_wins = 0;
+    while (a < n1 && b < end && a_wins < min_gallop && b_wins < min_gallop)
+    {
+      if (comp(first[b], buffer[a]))
+      {
+        first[out++] = first[b++];
+        ++b_wins;
+        a_wins = 0;
+      }
+      else
+      {
+        first[out++] = buffer[a++];
+        ++a_wins;
+        b_wins = 0;
+      }
+    }
+
+    // Then move blocks found by galloping while they are long
+    bool galloping = true;
+    while (galloping && a < n1 && b < end)
+    {
+      const Size k1 = gallop<true, true>(buffer + a, n1 - a, first[b], comp);
+      for (Size i = 0; i < k1; ++i)
+      {
+        first[out++] = buffer[a++];
+      }
+      if (a == n1)
+      {
+        break;
+      }
+      first[out++] = first[b++];
+      if (b == end)
+      {
+        break;
+      }
+
+      const Size k2 = gallop<false, true>(first + b, end - b, buffer[a], comp);
+      for (Size i = 0; i < k2; ++i)
+      {
+        first[out++] = first[b++];
+      }
+      if (b == end)
+      {
+        break;
+      }
+      first[out++] = buffer[a++];
+
+      galloping = k1 >= Size{min_gallop} || k2 >= Size{min_gallop};
+    }
+  }
+
+  // The rest of the second run is in place already
+  while (a < n1)
+  {
+    first[out++] = buffer[a++];
+  }
+}
+
+// Merges [first, first + n1) with [first + n1, first + n1 + n2) while n2 < n1, using buffer for the second run
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename Size, typename Pointer, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void
+merge_high(RandomAccessIterator first, Size n1, Size n2, Pointer buffer, StrictWeakOrdering& comp)
+{
+  for (Size i = 0; i < n2; ++i)
+  {
+    buffer[i] = first[n1 + i];
+  }
+
+  // The elements are taken from the ends of the runs
+  Size a   = n1;
+  Size b   = n2;
+  Size out = n1 + n2;
+
+  while (a > 0 && b > 0)
+  {
+    int a_wins = 0;
+    int b_wins = 0;
+    while (a > 0 && b > 0 && a_wins < min_gallop && b_wins < min_gallop)
+    {
+      if (comp(buffer[b - 1], first[a - 1]))
+      {
+        first[--out] = first[--a];
+        ++a_wins;
+        b_wins = 0;
+      }
+      else
+      {
+        first[--out] = buffer[--b];
+        ++b_wins;
+        a_wins = 0;
+      }
+    }
+
+    bool galloping = true;
+    while (galloping && a > 0 && b > 0)
+    {
+      // The elements of the first run which are greater than the last of the second run
+      const Size k1 = a - gallop<true, false>(first, a, buffer[b - 1], comp);
+      for (Size i = 0; i < k1; ++i)
+      {
+        first[--out] = first[--a];
+      }
+      if (a == 0)
+      {
+        break;
+      }
+      first[--out] = buffer[--b];
+      if (b == 0)
+      {
+        break;
+      }
+
+      // The elements of the second run which are not less than the last of the first run
+      const Size k2 = b - gallop<false, false>(buffer, b, first[a - 1], comp);
+      for (Size i = 0; i < k2; ++i)
+      {
+        first[--out] = buffer[--b];
+      }
+      if (b == 0)
+      {
+        break;
+      }
+      first[--out] = first[--a];
+
+      galloping = k1 >= Size{min_gallop} || k2 >= Size{min_gallop};
+    }
+  }
+
+  // The rest of the first run is in place already
+  while (b > 0)
+  {
+    first[--out] = buffer[--b];
+  }
+}
+
+// Merges the adjacent sorted runs [first, first + n1) and [first + n1, first + n1 + n2). Elements which are in place
+// already are skipped by galloping, so runs which overlap little are merged in logarithmic time.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename Size, typename Pointer, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void
+merge_runs(RandomAccessIterator first, Size n1, Size n2, Pointer buffer, StrictWeakOrdering& comp)
+{
+  if (n1 == 0 || n2 == 0 || !comp(first[n1], first[n1 - 1]))
+  {
+    return;
+  }
+
+  // The elements of the first run which are not greater than the first of the second run are in place
+  const Size k = gallop<true, true>(first, n1, first[n1], comp);
+  first += k;
+  n1 -= k;
+
+  // The elements of the second run which are not less than the last of the first run are in place
+  n2 = gallop<false, false>(first + n1, n2, first[n1 - 1], comp);
+
+  if (n1 <= n2)
+  {
+    merge_low(first, n1, n2, buffer, comp);
+  }
+  else
+  {
+    merge_high(first, n1, n2, buffer, comp);
+  }
+}
+
+// The depth of the boundary between the runs [begin1, begin2) and [begin2, end2) in a perfectly balanced merge tree
+// of [0, n). This is the merge policy of powersort by Munro and Wild.
+template <typename Size>
+_CCCL_HOST_DEVICE int node_power(Size n, Size begin1, Size begin2, Size end2)
+{
+  // The midpoints of the runs, as fractions of 2 * n
+  const Size n2 = 2 * n;
+  Size a        = begin1 + begin2;
+  Size b        = begin2 + end2;
+
+  int power = 0;
+  while (true)
+  {
+    ++power;
+    a *= 2;
+    b *= 2;
+    const bool a_bit = a >= n2;
+    const bool b_bit = b >= n2;
+    if (a_bit != b_bit)
+    {
+      return power;
+    }
+    if (a_bit)
+    {
+      a -= n2;
+      b -= n2;
+    }
+  }
+}
+
+template <typename Size>
+struct pending_run
+{
+  Size begin;
+  int power;
+};
+} // namespace powersort_detail
+
+//! Sorts [first, last) stably with powersort, an adaptive merge sort. The input is split into maximal ascending or
+//! strictly descending runs, which short runs extend to min_run elements with insertion sort. Runs are merged
+//! with galloping in the order determined by their node powers, which is optimal for the run lengths up to a constant.
+//! So a sorted or reversed input takes n - 1 comparisons, and an input of k presorted runs takes O(n log k) time.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void powersort(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+  using size_type  = ::cuda::std::size_t;
+  using powersort_detail::min_run;
+
+  const size_type n = static_cast<size_type>(last - first);
+  if (n < 2)
+  {
+    return;
+  }
+
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+  // Finds the run at begin and extends it to min_run elements if it is shorter
+  auto next_run_end = [&](size_type begin) {
+    const size_type remaining = n - begin;
+    const size_type run       = powersort_detail::find_run(first + begin, remaining, wrapped_comp);
+    const size_type extended  = (::cuda::std::min) (remaining, static_cast<size_type>(min_run));
+    if (run < extended)
+    {
+      powersort_detail::extend_run(first + begin, run, extended, wrapped_comp);
+      return begin + extended;
+    }
+    return begin + run;
+  };
+
+  const size_type end1 = next_run_end(0);
+  if (end1 == n)
+  {
+    return;
+  }
+
+  // A merge buffers the shorter of its runs
+  thrust::detail::temporary_array<value_type, DerivedPolicy> buffer_storage(exec, n / 2);
+  value_type* buffer = thrust::raw_pointer_cast(buffer_storage.data());
+
+  powersort_detail::pending_run<size_type> stack[powersort_detail::max_pending_runs];
+  int top = 0;
+
+  size_type begin1 = 0;
+  size_type end    = end1;
+  while (end < n)
+  {
+    const size_type end2 = next_run_end(end);
+    const int power      = powersort_detail::node_power(n, begin1, end, end2);
+
+    // Merge the pending runs which are deeper in the merge tree than the boundary at end
+    while (top > 0 && stack[top - 1].power > power)
+    {
+      const size_type begin0 = stack[top - 1].begin;
+      powersort_detail::merge_runs(first + begin0, begin1 - begin0, end - begin1, buffer, wrapped_comp);
+      begin1 = begin0;
+      --top;
+    }
+
+    stack[top++] = {begin1, power};
+    begin1       = end;
+    end          = end2;
+  }
+
+  while (top > 0)
+  {
+    const size_type begin0 = stack[top - 1].begin;
+    powersort_detail::merge_runs(first + begin0, begin1 - begin0, n - begin1, buffer, wrapped_comp);
+    begin1 = begin0;
+    --top;
+  }
+}
+} // namespace system::detail::sequential
+THRUST_NAMESPACE_END
@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/run_length_encode.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+#include <cuda/std/__utility/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::sequential
+{
+// Each element is compared with the head of its run, as in reduce_by_key, so that the input is read only once
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  sequential::execution_policy<DerivedPolicy>&,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 unique_out,
+  OutputIterator2 counts_out,
+  BinaryPredicate binary_pred)
+{
+  using value_type = thrust::detail::it_value_t<InputIterator>;
+  using size_type  = thrust::detail::it_difference_t<InputIterator>;
+
+  if (first != last)
+  {
+    value_type head = *first;
+    size_type count = 1;
+
+    for (++first; first != last; ++first)
+    {
+      value_type x = *first;
+
+      if (binary_pred(head, x))
+      {
+        ++count;
+      }
+      else
+      {
+        *unique_out = head;
+        *counts_out = count;
+
+        ++unique_out;
+        ++counts_out;
+
+        head  = x;
+        count = 1;
+      }
+    }
+
+    *unique_out = head;
+    *counts_out = count;
+
+    ++unique_out;
+    ++counts_out;
+  }
+
+  return ::cuda::std::make_pair(unique_out, counts_out);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  sequential::execution_policy<DerivedPolicy>&,
+  ForwardIterator first,
+  ForwardIterator last,
+  OutputIterator1 offsets_out,
+  OutputIterator2 lengths_out,
+  BinaryPredicate binary_pred)
+{
+  using size_type = thrust::detail::it_difference_t<ForwardIterator>;
+
+  if (first != last)
+  {
+    ForwardIterator head = first;
+    size_type offset     = 0;
+    size_type i          = 1;
+
+    for (++first; first != last; ++first, (void) ++i)
+    {
+      if (!binary_pred(*head, *first))
+      {
+        if (i - offset > 1)
+        {
+          *offsets_out = offset;
+          *lengths_out = i - offset;
+
+          ++offsets_out;
+          ++lengths_out;
+        }
+
+        head   = first;
+        offset = i;
+      }
+    }
+
+    if (i - offset > 1)
+    {
+      *offsets_out = offset;
+      *lengths_out = i - offset;
+
+      ++offsets_out;
+      ++lengths_out;
+    }
+  }
+
+  return ::cuda::std::make_pair(offsets_out, lengths_out);
+}
+} // namespace system::detail::sequential
+THRUST_NAMESPACE_END
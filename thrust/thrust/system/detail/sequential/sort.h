@@ -17,13 +17,17 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/decomposer.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/reverse.h>
 #include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/system/detail/sequential/stable_decomposed_radix_sort.h>
 #include <thrust/system/detail/sequential/stable_merge_sort.h>
 #include <thrust/system/detail/sequential/stable_primitive_sort.h>
 
+#include <cuda/std/cstddef>
+
 #include <nv/target>
 
 THRUST_NAMESPACE_BEGIN
@@ -43,6 +47,27 @@ inline constexpr bool use_primitive_sort =
 
 template <typename KeyType, typename Compare>
 inline constexpr bool needs_reverse = ::cuda::std::is_same_v<Compare, ::cuda::std::greater<KeyType>>;
+
+// decomposed_less and decomposed_greater radix sort the keys by the fields of their decomposer
+template <typename KeyType, typename Compare>
+inline constexpr bool use_decomposed_radix_sort = false;
+
+template <typename KeyType, typename Decomposer>
+inline constexpr bool use_decomposed_radix_sort<KeyType, thrust::decomposed_less<Decomposer>> =
+  decomposed_radix_sort_detail::is_radix_decomposer<Decomposer, KeyType>;
+
+template <typename KeyType, typename Decomposer>
+inline constexpr bool use_decomposed_radix_sort<KeyType, thrust::decomposed_greater<Decomposer>> =
+  decomposed_radix_sort_detail::is_radix_decomposer<Decomposer, KeyType>;
+
+template <typename Compare>
+inline constexpr bool inverts_decomposed_order = false;
+
+template <typename Decomposer>
+inline constexpr bool inverts_decomposed_order<thrust::decomposed_greater<Decomposer>> = true;
+
+// Shorter sequences are merge sorted, because a radix sort has to clear and scan a histogram for every byte of a key
+inline constexpr ::cuda::std::ptrdiff_t decomposed_radix_sort_threshold = 512;
 } // end namespace sort_detail
 
 template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
@@ -64,6 +89,16 @@ _CCCL_HOST_DEVICE void stable_sort(
         {
           thrust::reverse(exec, first, last);
         }
+      } else if constexpr (sort_detail::use_decomposed_radix_sort<KeyType, StrictWeakOrdering>) {
+        if (last - first < sort_detail::decomposed_radix_sort_threshold)
+        {
+          thrust::system::detail::sequential::stable_merge_sort(exec, first, last, comp);
+        }
+        else
+        {
+          thrust::system::detail::sequential::stable_decomposed_radix_sort<
+            sort_detail::inverts_decomposed_order<StrictWeakOrdering>>(exec, first, last, comp.decomposer);
+        }
       } else { thrust::system::detail::sequential::stable_merge_sort(exec, first, last, comp); }),
     ( // NV_IS_DEVICE:
       // the compilation time of stable_primitive_sort is too expensive to use within a single CUDA thread
@@ -102,6 +137,16 @@ _CCCL_HOST_DEVICE void stable_sort_by_key(
           thrust::reverse(exec, first1, last1);
           thrust::reverse(exec, first2, first2 + (last1 - first1));
         }
+      } else if constexpr (sort_detail::use_decomposed_radix_sort<KeyType, StrictWeakOrdering>) {
+        if (last1 - first1 < sort_detail::decomposed_radix_sort_threshold)
+        {
+          thrust::system::detail::sequential::stable_merge_sort_by_key(exec, first1, last1, first2, comp);
+        }
+        else
+        {
+          thrust::system::detail::sequential::stable_decomposed_radix_sort_by_key<
+            sort_detail::inverts_decomposed_order<StrictWeakOrdering>>(exec, first1, last1, first2, comp.decomposer);
+        }
       } else { thrust::system::detail::sequential::stable_merge_sort_by_key(exec, first1, last1, first2, comp); }),
     ( // NV_IS_DEVICE:
       // the compilation time of stable_primitive_sort is too expensive to use within a single CUDA thread
@@ -0,0 +1,372 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/copy.h>
+#include <thrust/decomposer.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/raw_reference_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+#include <cuda/std/__bit/bit_cast.h>
+#include <cuda/std/__functional/invoke.h>
+#include <cuda/std/__type_traits/integral_constant.h>
+#include <cuda/std/__type_traits/is_arithmetic.h>
+#include <cuda/std/__type_traits/is_floating_point.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/__type_traits/is_signed.h>
+#include <cuda/std/__type_traits/remove_cvref.h>
+#include <cuda/std/__type_traits/void_t.h>
+#include <cuda/std/__utility/integer_sequence.h>
+#include <cuda/std/cmath>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/limits>
+#include <cuda/std/tuple>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::sequential
+{
+namespace decomposed_radix_sort_detail
+{
+inline constexpr unsigned int radix_bits = 8;
+inline constexpr unsigned int radix_size = 1u << radix_bits;
+
+template <::cuda::std::size_t Size>
+struct unsigned_bits;
+
+template <>
+struct unsigned_bits<1>
+{
+  using type = ::cuda::std::uint8_t;
+};
+
+template <>
+struct unsigned_bits<2>
+{
+  using type = ::cuda::std::uint16_t;
+};
+
+template <>
+struct unsigned_bits<4>
+{
+  using type = ::cuda::std::uint32_t;
+};
+
+template <>
+struct unsigned_bits<8>
+{
+  using type = ::cuda::std::uint64_t;
+};
+
+template <typename T>
+inline constexpr bool is_radix_field =
+  ::cuda::std::is_arithmetic_v<T> && !::cuda::std::is_same_v<T, long double>
+  && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+template <typename Field>
+using field_traits = thrust::detail::decomposer_detail::field_traits<Field>;
+
+template <typename Decomposer, typename Key>
+using decomposed_tuple = ::cuda::std::remove_cvref_t<::cuda::std::invoke_result_t<const Decomposer&, const Key&>>;
+
+template <typename Tuple, typename Indices = ::cuda::std::make_index_sequence<::cuda::std::tuple_size_v<Tuple>>>
+inline constexpr bool all_radix_fields = false;
+
+template <typename Tuple, ::cuda::std::size_t... Is>
+inline constexpr bool all_radix_fields<Tuple, ::cuda::std::index_sequence<Is...>> =
+  sizeof...(Is) > 0 && (is_radix_field<typename field_traits<::cuda::std::tuple_element_t<Is, Tuple>>::type> && ...);
+
+// Whether the keys can be radix sorted by the fields the decomposer returns for them
+template <typename Decomposer, typename Key, typename = void>
+inline constexpr bool is_radix_decomposer = false;
+
+template <typename Decomposer, typename Key>
+inline constexpr bool
+  is_radix_decomposer<Decomposer, Key, ::cuda::std::void_t<decomposed_tuple<Decomposer, Key>>> =
+    all_radix_fields<decomposed_tuple<Decomposer, Key>>;
+
+// Maps a field to an unsigned integer of the same size with the same order, in which NaNs go after all numbers and
+// negative zero is equal to positive zero, like in compare_values
+template <typename T>
+_CCCL_HOST_DEVICE typename unsigned_bits<sizeof(T)>::type encode(T x)
+{
+  using U = typename unsigned_bits<sizeof(T)>::type;
+
+  constexpr U sign_bit = static_cast<U>(U{1} << (8 * sizeof(T) - 1));
+
+  if constexpr (::cuda::std::is_floating_point_v<T>)
+  {
+    if (::cuda::std::isnan(x))
+    {
+      x = ::cuda::std::numeric_limits<T>::quiet_NaN();
+    }
+    else if (x == T(0))
+    {
+      x = T(0);
+    }
+
+    const U u = ::cuda::std::bit_cast<U>(x);
+    return (u & sign_bit) ? static_cast<U>(~u) : static_cast<U>(u | sign_bit);
+  }
+  else if constexpr (::cuda::std::is_same_v<T, bool>)
+  {
+    return static_cast<U>(x);
+  }
+  else if constexpr (::cuda::std::is_signed_v<T>)
+  {
+    return static_cast<U>(static_cast<U>(x) ^ sign_bit);
+  }
+  else
+  {
+    return static_cast<U>(x);
+  }
+}
+
+// The encoding of field I of a decomposed key, inverted if the field is ordered in descending order
+template <::cuda::std::size_t I, bool Invert, typename Tuple>
+_CCCL_HOST_DEVICE auto encode_field(const Tuple& fields)
+{
+  using traits = field_traits<::cuda::std::tuple_element_t<I, Tuple>>;
+
+  const auto x = decomposed_radix_sort_detail::encode(traits::value(::cuda::std::get<I>(fields)));
+  if constexpr (Invert != traits::descending)
+  {
+    return static_cast<decltype(x)>(~x);
+  }
+  else
+  {
+    return x;
+  }
+}
+
+template <typename Tuple, ::cuda::std::size_t I>
+inline constexpr unsigned int field_size = sizeof(typename field_traits<::cuda::std::tuple_element_t<I, Tuple>>::type);
+
+// The number of digits of the fields after field I, whose histograms come before those of field I, because the least
+// significant digits are sorted first
+template <typename Tuple, ::cuda::std::size_t I>
+_CCCL_HOST_DEVICE constexpr unsigned int digit_offset()
+{
+  unsigned int offset = 0;
+  if constexpr (I + 1 < ::cuda::std::tuple_size_v<Tuple>)
+  {
+    offset = field_size<Tuple, I + 1> + digit_offset<Tuple, I + 1>();
+  }
+  return offset;
+}
+
+// Invokes f with an integral_constant for every index
+template <typename Function, ::cuda::std::size_t... Is>
+_CCCL_HOST_DEVICE void for_each_index(Function&& f, ::cuda::std::index_sequence<Is...>)
+{
+  (f(::cuda::std::integral_constant<::cuda::std::size_t, Is>{}), ...);
+}
+
+// Counts the digits of the fields of a key in all histograms
+template <bool Invert, typename Tuple>
+_CCCL_HOST_DEVICE void count_digits(const Tuple& fields, ::cuda::std::size_t* histograms)
+{
+  auto count_field = [&](auto field) {
+    constexpr ::cuda::std::size_t I = decltype(field)::value;
+
+    const auto x                          = decomposed_radix_sort_detail::encode_field<I, Invert>(fields);
+    ::cuda::std::size_t* field_histograms = histograms + radix_size * digit_offset<Tuple, I>();
+    for (unsigned int digit = 0; digit < field_size<Tuple, I>; ++digit)
+    {
+      ++field_histograms[radix_size * digit + ((x >> (radix_bits * digit)) & (radix_size - 1))];
+    }
+  };
+  decomposed_radix_sort_detail::for_each_index(
+    count_field, ::cuda::std::make_index_sequence<::cuda::std::tuple_size_v<Tuple>>{});
+}
+
+// Moves the keys (and values) from (keys1, vals1) to (keys2, vals2) in the stable order of a digit of field I
+template <::cuda::std::size_t I,
+          bool Invert,
+          bool HasValues,
+          typename Decomposer,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4>
+_CCCL_HOST_DEVICE void shuffle(
+  const Decomposer& decomposer,
+  RandomAccessIterator1 keys1,
+  RandomAccessIterator2 keys2,
+  RandomAccessIterator3 vals1,
+  RandomAccessIterator4 vals2,
+  const ::cuda::std::size_t n,
+  unsigned int shift,
+  ::cuda::std::size_t* histogram)
+{
+  for (::cuda::std::size_t i = 0; i < n; ++i)
+  {
+    const auto x =
+      decomposed_radix_sort_detail::encode_field<I, Invert>(decomposer(thrust::raw_reference_cast(keys1[i])));
+    const ::cuda::std::size_t j = histogram[(x >> shift) & (radix_size - 1)]++;
+
+    keys2[j] = keys1[i];
+    if constexpr (HasValues)
+    {
+      vals2[j] = vals1[i];
+    }
+  }
+}
+
+//! LSD radix sorts the keys of [keys1, keys1 + n), and the corresponding values of vals1, by the fields their
+//! decomposer returns, using (keys2, vals2) as temporary storage. The digits of all fields are counted in one pass
+//! over the keys, and the digits which are the same for all keys are not shuffled, so narrow values in wide fields
+//! cost no more than their significant digits. If Invert, the keys are sorted in descending order, and the order of
+//! equivalent keys is still preserved.
+template <bool Invert,
+          bool HasValues,
+          typename DerivedPolicy,
+          typename Decomposer,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4>
+_CCCL_HOST_DEVICE void radix_sort(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  const Decomposer& decomposer,
+  RandomAccessIterator1 keys1,
+  RandomAccessIterator2 keys2,
+  RandomAccessIterator3 vals1,
+  RandomAccessIterator4 vals2,
+  const ::cuda::std::size_t n)
+{
+  using KeyType = thrust::detail::it_value_t<RandomAccessIterator1>;
+  using Tuple   = decomposed_tuple<Decomposer, KeyType>;
+
+  constexpr ::cuda::std::size_t num_fields = ::cuda::std::tuple_size_v<Tuple>;
+  constexpr unsigned int num_digits        = field_size<Tuple, 0> + digit_offset<Tuple, 0>();
+
+  thrust::detail::temporary_array<::cuda::std::size_t, DerivedPolicy> histogram_storage(
+    exec, static_cast<::cuda::std::size_t>(num_digits) * radix_size);
+  ::cuda::std::size_t* histograms = thrust::raw_pointer_cast(histogram_storage.data());
+  for (::cuda::std::size_t i = 0; i < num_digits * radix_size; ++i)
+  {
+    histograms[i] = 0;
+  }
+
+  // compute histograms
+  for (::cuda::std::size_t i = 0; i < n; ++i)
+  {
+    decomposed_radix_sort_detail::count_digits<Invert>(
+      decomposer(thrust::raw_reference_cast(keys1[i])), histograms);
+  }
+
+  // scan histograms, and see which passes can be eliminated
+  bool skip_shuffle[num_digits] = {};
+  for (unsigned int digit = 0; digit < num_digits; ++digit)
+  {
+    ::cuda::std::size_t* histogram = histograms + radix_size * digit;
+    ::cuda::std::size_t sum        = 0;
+    for (unsigned int j = 0; j < radix_size; ++j)
+    {
+      const ::cuda::std::size_t bin = histogram[j];
+      skip_shuffle[digit]           = skip_shuffle[digit] || bin == n;
+      histogram[j]                  = sum;
+      sum += bin;
+    }
+  }
+
+  // false if most recent data is stored in (keys1, vals1)
+  bool flip = false;
+
+  // shuffle by the digits of the least significant field first
+  auto sort_field = [&](auto field) {
+    constexpr ::cuda::std::size_t I = num_fields - 1 - decltype(field)::value;
+    constexpr unsigned int offset   = digit_offset<Tuple, I>();
+
+    for (unsigned int digit = 0; digit < field_size<Tuple, I>; ++digit)
+    {
+      if (skip_shuffle[offset + digit])
+      {
+        continue;
+      }
+
+      ::cuda::std::size_t* histogram = histograms + radix_size * (offset + digit);
+      if (flip)
+      {
+        decomposed_radix_sort_detail::shuffle<I, Invert, HasValues>(
+          decomposer, keys2, keys1, vals2, vals1, n, radix_bits * digit, histogram);
+      }
+      else
+      {
+        decomposed_radix_sort_detail::shuffle<I, Invert, HasValues>(
+          decomposer, keys1, keys2, vals1, vals2, n, radix_bits * digit, histogram);
+      }
+      flip = !flip;
+    }
+  };
+  decomposed_radix_sort_detail::for_each_index(sort_field, ::cuda::std::make_index_sequence<num_fields>{});
+
+  // ensure final values are in (keys1, vals1)
+  if (flip)
+  {
+    thrust::copy(exec, keys2, keys2 + n, keys1);
+    if constexpr (HasValues)
+    {
+      thrust::copy(exec, vals2, vals2 + n, vals1);
+    }
+  }
+}
+} // namespace decomposed_radix_sort_detail
+
+template <bool Invert, typename DerivedPolicy, typename RandomAccessIterator, typename Decomposer>
+_CCCL_HOST_DEVICE void stable_decomposed_radix_sort(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  const Decomposer& decomposer)
+{
+  using KeyType = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  const ::cuda::std::size_t n = last - first;
+
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> temp(exec, n);
+
+  decomposed_radix_sort_detail::radix_sort<Invert, false>(
+    exec, decomposer, first, temp.begin(), static_cast<int*>(0), static_cast<int*>(0), n);
+}
+
+template <bool Invert,
+          typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename Decomposer>
+_CCCL_HOST_DEVICE void stable_decomposed_radix_sort_by_key(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  const Decomposer& decomposer)
+{
+  using KeyType   = thrust::detail::it_value_t<RandomAccessIterator1>;
+  using ValueType = thrust::detail::it_value_t<RandomAccessIterator2>;
+
+  const ::cuda::std::size_t n = last1 - first1;
+
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> temp1(exec, n);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> temp2(exec, n);
+
+  decomposed_radix_sort_detail::radix_sort<Invert, true>(
+    exec, decomposer, first1, temp1.begin(), first2, temp2.begin(), n);
+}
+} // namespace system::detail::sequential
+THRUST_NAMESPACE_END
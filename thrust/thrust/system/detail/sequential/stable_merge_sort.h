@@ -13,11 +13,14 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/internal_functional.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/zip_iterator.h>
 #include <thrust/merge.h>
 #include <thrust/system/detail/sequential/execution_policy.h>
 #include <thrust/system/detail/sequential/insertion_sort.h>
+#include <thrust/system/detail/sequential/powersort.h>
 
 #include <cuda/std/__algorithm/min.h>
 
@@ -28,49 +31,6 @@ namespace system::detail::sequential
 {
 namespace stable_merge_sort_detail
 {
-template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
-_CCCL_HOST_DEVICE void inplace_merge(
-  sequential::execution_policy<DerivedPolicy>& exec,
-  RandomAccessIterator first,
-  RandomAccessIterator middle,
-  RandomAccessIterator last,
-  StrictWeakOrdering comp)
-{
-  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
-
-  thrust::detail::temporary_array<value_type, DerivedPolicy> a(exec, first, middle);
-  thrust::detail::temporary_array<value_type, DerivedPolicy> b(exec, middle, last);
-
-  thrust::merge(exec, a.begin(), a.end(), b.begin(), b.end(), first, comp);
-}
-
-template <typename DerivedPolicy,
-          typename RandomAccessIterator1,
-          typename RandomAccessIterator2,
-          typename StrictWeakOrdering>
-_CCCL_HOST_DEVICE void inplace_merge_by_key(
-  sequential::execution_policy<DerivedPolicy>& exec,
-  RandomAccessIterator1 first1,
-  RandomAccessIterator1 middle1,
-  RandomAccessIterator1 last1,
-  RandomAccessIterator2 first2,
-  StrictWeakOrdering comp)
-{
-  using value_type1 = thrust::detail::it_value_t<RandomAccessIterator1>;
-  using value_type2 = thrust::detail::it_value_t<RandomAccessIterator2>;
-
-  RandomAccessIterator2 middle2 = first2 + (middle1 - first1);
-  RandomAccessIterator2 last2   = first2 + (last1 - first1);
-
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> lhs1(exec, first1, middle1);
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> rhs1(exec, middle1, last1);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> lhs2(exec, first2, middle2);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> rhs2(exec, middle2, last2);
-
-  thrust::merge_by_key(
-    exec, lhs1.begin(), lhs1.end(), rhs1.begin(), rhs1.end(), lhs2.begin(), rhs2.begin(), first1, first2, comp);
-}
-
 template <typename RandomAccessIterator, typename Size, typename StrictWeakOrdering>
 _CCCL_HOST_DEVICE void
 insertion_sort_each(RandomAccessIterator first, RandomAccessIterator last, Size partition_size, StrictWeakOrdering comp)
@@ -257,52 +217,6 @@ _CCCL_HOST_DEVICE void iterative_stable_merge_sort_by_key(
   } // end if
 } // end iterative_stable_merge_sort()
 
-template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
-_CCCL_HOST_DEVICE void recursive_stable_merge_sort(
-  sequential::execution_policy<DerivedPolicy>& exec,
-  RandomAccessIterator first,
-  RandomAccessIterator last,
-  StrictWeakOrdering comp)
-{
-  if (last - first <= 32)
-  {
-    thrust::system::detail::sequential::insertion_sort(first, last, comp);
-  } // end if
-  else
-  {
-    RandomAccessIterator middle = first + (last - first) / 2;
-
-    stable_merge_sort_detail::recursive_stable_merge_sort(exec, first, middle, comp);
-    stable_merge_sort_detail::recursive_stable_merge_sort(exec, middle, last, comp);
-    stable_merge_sort_detail::inplace_merge(exec, first, middle, last, comp);
-  } // end else
-} // end recursive_stable_merge_sort()
-
-template <typename DerivedPolicy,
-          typename RandomAccessIterator1,
-          typename RandomAccessIterator2,
-          typename StrictWeakOrdering>
-_CCCL_HOST_DEVICE void recursive_stable_merge_sort_by_key(
-  sequential::execution_policy<DerivedPolicy>& exec,
-  RandomAccessIterator1 first1,
-  RandomAccessIterator1 last1,
-  RandomAccessIterator2 first2,
-  StrictWeakOrdering comp)
-{
-  if (last1 - first1 <= 32)
-  {
-    thrust::system::detail::sequential::insertion_sort_by_key(first1, last1, first2, comp);
-  } // end if
-  else
-  {
-    RandomAccessIterator1 middle1 = first1 + (last1 - first1) / 2;
-    RandomAccessIterator2 middle2 = first2 + (last1 - first1) / 2;
-
-    stable_merge_sort_detail::recursive_stable_merge_sort_by_key(exec, first1, middle1, first2, comp);
-    stable_merge_sort_detail::recursive_stable_merge_sort_by_key(exec, middle1, last1, middle2, comp);
-    stable_merge_sort_detail::inplace_merge_by_key(exec, first1, middle1, last1, first2, comp);
-  } // end else
-} // end recursive_stable_merge_sort_by_key()
 } // end namespace stable_merge_sort_detail
 
 template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
@@ -316,7 +230,7 @@ _CCCL_HOST_DEVICE void stable_merge_sort(
                (
                  // avoid recursion in CUDA threads
                  stable_merge_sort_detail::iterative_stable_merge_sort(exec, first, last, comp);),
-               (stable_merge_sort_detail::recursive_stable_merge_sort(exec, first, last, comp);));
+               (sequential::powersort(exec, first, last, comp);));
 }
 
 template <typename DerivedPolicy,
@@ -334,7 +248,12 @@ _CCCL_HOST_DEVICE void stable_merge_sort_by_key(
                (
                  // avoid recursion in CUDA threads
                  stable_merge_sort_detail::iterative_stable_merge_sort_by_key(exec, first1, last1, first2, comp);),
-               (stable_merge_sort_detail::recursive_stable_merge_sort_by_key(exec, first1, last1, first2, comp);));
+               (
+                 // the keys and values are permuted together as tuples
+                 sequential::powersort(exec,
+                                       thrust::make_zip_iterator(first1, first2),
+                                       thrust::make_zip_iterator(last1, first2 + (last1 - first1)),
+                                       thrust::detail::compare_first<StrictWeakOrdering>{comp});));
 }
 } // namespace system::detail::sequential
 THRUST_NAMESPACE_END
@@ -13,4 +13,57 @@
 #  pragma system_header
 #endif // no system header
 
-// this system has no special temporary buffer functions
+// Unless huge pages or caching are requested, this system has no special temporary buffer functions
+#if defined(THRUST_HOST_MEMORY_USE_HUGE_PAGES) || defined(THRUST_HOST_TEMPORARY_STORAGE_CACHE)
+
+#  include <thrust/detail/pointer.h>
+#  include <thrust/detail/raw_pointer_cast.h>
+#  include <thrust/mr/huge_page_resource.h>
+#  include <thrust/mr/temporary_storage_cache.h>
+#  include <thrust/system/detail/sequential/execution_policy.h>
+
+#  include <cuda/std/__utility/pair.h>
+#  include <cuda/std/cstdlib>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::sequential
+{
+// Temporary storage of the host systems is served by a memory resource, which needs the size on deallocation and
+// therefore cannot go through malloc and free.
+_CCCL_HOST inline thrust::mr::memory_resource<>* temporary_buffer_resource()
+{
+#  if defined(THRUST_HOST_TEMPORARY_STORAGE_CACHE)
+  return &thrust::mr::thread_temporary_storage_cache();
+#  else // ^^^ THRUST_HOST_TEMPORARY_STORAGE_CACHE ^^^ / vvv !THRUST_HOST_TEMPORARY_STORAGE_CACHE vvv
+  return thrust::mr::get_global_resource<host_native_upstream_resource>();
+#  endif // ^^^ !THRUST_HOST_TEMPORARY_STORAGE_CACHE ^^^
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename T, typename DerivedPolicy>
+_CCCL_HOST_DEVICE ::cuda::std::pair<thrust::pointer<T, DerivedPolicy>, std::ptrdiff_t>
+get_temporary_buffer(sequential::execution_policy<DerivedPolicy>&, std::ptrdiff_t n)
+{
+  void* ptr = nullptr;
+  NV_IF_ELSE_TARGET(
+    NV_IS_HOST,
+    (ptr = temporary_buffer_resource()->allocate(sizeof(T) * n, alignof(T));),
+    (ptr = ::cuda::std::malloc(sizeof(T) * n);));
+  return ::cuda::std::make_pair(thrust::pointer<T, DerivedPolicy>(static_cast<T*>(ptr)), ptr ? n : 0);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename Pointer>
+_CCCL_HOST_DEVICE void
+return_temporary_buffer(sequential::execution_policy<DerivedPolicy>&, Pointer p, std::ptrdiff_t n)
+{
+  using T = typename thrust::detail::pointer_traits<Pointer>::element_type;
+  NV_IF_ELSE_TARGET(
+    NV_IS_HOST,
+    (temporary_buffer_resource()->deallocate(thrust::raw_pointer_cast(p), sizeof(T) * n, alignof(T));),
+    (::cuda::std::free(thrust::raw_pointer_cast(p));));
+}
+} // namespace system::detail::sequential
+THRUST_NAMESPACE_END
+
+#endif // THRUST_HOST_MEMORY_USE_HUGE_PAGES || THRUST_HOST_TEMPORARY_STORAGE_CACHE
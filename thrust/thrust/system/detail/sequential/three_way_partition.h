@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/system/detail/generic/three_way_partition.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+#include <cuda/std/tuple>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::sequential
+{
+// Evaluates each predicate at most once per element in a single pass
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename OutputIterator3,
+          typename Predicate1,
+          typename Predicate2>
+_CCCL_HOST_DEVICE ::cuda::std::tuple<OutputIterator1, OutputIterator2, OutputIterator3> three_way_partition(
+  sequential::execution_policy<DerivedPolicy>&,
+  ForwardIterator first,
+  ForwardIterator last,
+  OutputIterator1 first_part_out,
+  OutputIterator2 second_part_out,
+  OutputIterator3 unselected_out,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part)
+{
+  for (; first != last; ++first)
+  {
+    if (select_first_part(*first))
+    {
+      *first_part_out = *first;
+      ++first_part_out;
+    }
+    else if (select_second_part(*first))
+    {
+      *second_part_out = *first;
+      ++second_part_out;
+    }
+    else
+    {
+      *unselected_out = *first;
+      ++unselected_out;
+    }
+  }
+
+  return {first_part_out, second_part_out, unselected_out};
+}
+} // namespace system::detail::sequential
+THRUST_NAMESPACE_END
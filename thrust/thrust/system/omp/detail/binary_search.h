@@ -14,7 +14,9 @@
 #endif // no system header
 
 #include <thrust/system/detail/generic/binary_search.h>
+#include <thrust/system/detail/internal/sorted_search.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/parallel_for_index.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
@@ -53,5 +55,65 @@ bool binary_search(execution_policy<DerivedPolicy>& exec,
   // omp prefers generic::binary_search to cpp::binary_search
   return thrust::system::detail::generic::binary_search(exec, begin, end, value, comp);
 }
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator lower_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  using thrust::system::detail::internal::search_kind;
+  // The cost of a block depends on how many of its values are sorted
+  return thrust::system::detail::internal::vectorized_search<search_kind::lower_bound>(
+    exec, parallel_for_index<true>{}, begin, end, values_begin, values_end, output, comp);
+}
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator upper_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  using thrust::system::detail::internal::search_kind;
+  // The cost of a block depends on how many of its values are sorted
+  return thrust::system::detail::internal::vectorized_search<search_kind::upper_bound>(
+    exec, parallel_for_index<true>{}, begin, end, values_begin, values_end, output, comp);
+}
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator binary_search(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  using thrust::system::detail::internal::search_kind;
+  // The cost of a block depends on how many of its values are sorted
+  return thrust::system::detail::internal::vectorized_search<search_kind::binary_search>(
+    exec, parallel_for_index<true>{}, begin, end, values_begin, values_end, output, comp);
+}
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
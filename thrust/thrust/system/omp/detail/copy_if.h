@@ -14,11 +14,20 @@
 #endif // no system header
 
 #include <thrust/system/detail/generic/copy_if.h>
+#include <thrust/system/detail/internal/copy_if.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/parallel_for_index.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename Predicate>
+OutputIterator copy_if(
+  execution_policy<DerivedPolicy>& exec, InputIterator first, InputIterator last, OutputIterator result, Predicate pred)
+{
+  return thrust::system::detail::internal::copy_if(exec, parallel_for_index<>{}, first, last, result, pred);
+} // end copy_if()
+
 template <typename DerivedPolicy,
           typename InputIterator1,
           typename InputIterator2,
@@ -32,8 +41,7 @@ OutputIterator copy_if(
   OutputIterator result,
   Predicate pred)
 {
-  // omp prefers generic::copy_if to cpp::copy_if
-  return thrust::system::detail::generic::copy_if(exec, first, last, stencil, result, pred);
+  return thrust::system::detail::internal::copy_if(exec, parallel_for_index<>{}, first, last, stencil, result, pred);
 } // end copy_if()
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
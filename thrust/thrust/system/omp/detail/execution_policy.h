@@ -14,6 +14,7 @@
 #endif // no system header
 
 #include <thrust/detail/allocator_aware_execution_policy.h>
+#include <thrust/detail/execute_with_requirements.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/iterator/detail/any_system_tag.h>
 #include <thrust/system/cpp/detail/execution_policy.h>
@@ -55,7 +56,11 @@ struct execution_policy : cpp::execution_policy<Derived>
 struct par_t
     : execution_policy<par_t>
     , thrust::detail::allocator_aware_execution_policy<execution_policy>
-{};
+    , thrust::detail::requirements_aware_execution_policy<execution_policy>
+{
+  using thrust::detail::allocator_aware_execution_policy<execution_policy>::operator();
+  using thrust::detail::requirements_aware_execution_policy<execution_policy>::operator();
+};
 
 // select_system(tbb, omp) & select_system(omp, tbb) are ambiguous because both convert to cpp without these overloads,
 // which we arbitrarily define in the omp backend
@@ -95,6 +100,10 @@ using detail::execution_policy;
 //!
 //! The type of \p thrust::omp::par is implementation-defined.
 //!
+//! \p reduce, \p transform_reduce, \p inclusive_scan, \p exclusive_scan and the algorithms built on them group the
+//! operations depending on the number of threads. Results that are bitwise identical across runs and thread counts are
+//! obtained with <tt>thrust::omp::par(cuda::execution::require(cuda::execution::determinism::run_to_run))</tt>.
+//!
 //! The following code snippet demonstrates how to use \p thrust::omp::par to explicitly dispatch an invocation of \p
 //! thrust::for_each to the OpenMP backend system:
 //!
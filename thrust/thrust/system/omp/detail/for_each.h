@@ -19,6 +19,7 @@
 #endif // no system header
 
 #include <thrust/detail/function.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/static_assert.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/iterator_traits.h>
@@ -27,6 +28,11 @@
 
 #include <cuda/std/__iterator/distance.h>
 
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
@@ -54,11 +60,16 @@ RandomAccessIterator for_each_n(execution_policy<DerivedPolicy>&, RandomAccessIt
   using DifferenceType    = thrust::detail::it_difference_t<RandomAccessIterator>;
   DifferenceType signed_n = n;
 
-  THRUST_PRAGMA_OMP(parallel for)
-  for (DifferenceType i = 0; i < signed_n; ++i)
+  THRUST_PRAGMA_OMP(parallel)
   {
-    RandomAccessIterator temp = first + i;
-    wrapped_f(*temp);
+    _THRUST_HOST_INSTRUMENTATION_PARALLEL_REGION(omp_get_num_threads());
+
+    THRUST_PRAGMA_OMP(for)
+    for (DifferenceType i = 0; i < signed_n; ++i)
+    {
+      RandomAccessIterator temp = first + i;
+      wrapped_f(*temp);
+    }
   }
 
   return first + n;
@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/system/detail/generic/histogram.h>
+#include <thrust/system/detail/internal/histogram.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/parallel_for_index.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
+#include <cuda/std/array>
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+namespace histogram_detail
+{
+inline int max_workers()
+{
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  return omp_get_max_threads();
+#else // ^^^ omp support ^^^ / vvv no omp support vvv
+  return 1;
+#endif // no omp support
+}
+} // namespace histogram_detail
+
+template <::cuda::std::size_t NumChannels,
+          ::cuda::std::size_t NumActiveChannels,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename LevelT>
+void multi_histogram_even(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  const ::cuda::std::array<OutputIterator, NumActiveChannels>& histograms,
+  const ::cuda::std::array<int, NumActiveChannels>& num_levels,
+  const ::cuda::std::array<LevelT, NumActiveChannels>& lower_levels,
+  const ::cuda::std::array<LevelT, NumActiveChannels>& upper_levels)
+{
+  using sample_type = thrust::detail::it_value_t<InputIterator>;
+  thrust::system::detail::internal::multi_histogram<NumChannels>(
+    exec,
+    parallel_for_index<>{},
+    histogram_detail::max_workers(),
+    first,
+    last,
+    histograms,
+    thrust::system::detail::generic::histogram_detail::make_even_bin_indices<sample_type>(
+      num_levels, lower_levels, upper_levels));
+}
+
+template <::cuda::std::size_t NumChannels,
+          ::cuda::std::size_t NumActiveChannels,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename LevelIterator>
+void multi_histogram_range(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  const ::cuda::std::array<OutputIterator, NumActiveChannels>& histograms,
+  const ::cuda::std::array<int, NumActiveChannels>& num_levels,
+  const ::cuda::std::array<LevelIterator, NumActiveChannels>& levels)
+{
+  using sample_type = thrust::detail::it_value_t<InputIterator>;
+  thrust::system::detail::internal::multi_histogram<NumChannels>(
+    exec,
+    parallel_for_index<>{},
+    histogram_detail::max_workers(),
+    first,
+    last,
+    histograms,
+    thrust::system::detail::generic::histogram_detail::make_range_bin_indices<sample_type>(num_levels, levels));
+}
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
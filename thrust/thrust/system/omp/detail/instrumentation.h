@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/system/detail/generic/instrumentation.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+template <typename DerivedPolicy>
+thrust::system::detail::generic::instrumented_system_info instrumented_system(execution_policy<DerivedPolicy>&)
+{
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  return {"omp", omp_get_max_threads()};
+#else // ^^^ omp support ^^^ / vvv no omp support vvv
+  return {"omp", 1};
+#endif // no omp support
+}
+} // namespace system::omp::detail
+THRUST_NAMESPACE_END
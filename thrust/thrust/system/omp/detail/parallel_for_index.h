@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/instrumentation.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+//! Invokes f(i) for every i in [0, n) on the OpenMP threads. The indices are distributed statically, which suits
+//! work of the same cost per index. Set DynamicSchedule when the cost differs between the indices.
+template <bool DynamicSchedule = false>
+struct parallel_for_index
+{
+  template <typename Size, typename F>
+  void operator()(Size n, F f) const
+  {
+    THRUST_PRAGMA_OMP(parallel)
+    {
+      _THRUST_HOST_INSTRUMENTATION_PARALLEL_REGION(omp_get_num_threads());
+
+      if constexpr (DynamicSchedule)
+      {
+        THRUST_PRAGMA_OMP(for schedule(dynamic))
+        for (Size i = 0; i < n; ++i)
+        {
+          f(i);
+        }
+      }
+      else
+      {
+        THRUST_PRAGMA_OMP(for schedule(static))
+        for (Size i = 0; i < n; ++i)
+        {
+          f(i);
+        }
+      }
+    }
+  }
+};
+} // namespace system::omp::detail
+THRUST_NAMESPACE_END
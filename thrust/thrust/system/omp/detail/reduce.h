@@ -17,10 +17,15 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/execute_with_requirements.h>
+#include <thrust/detail/function.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/deterministic.h>
 #include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/parallel_for_index.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
 #include <thrust/system/omp/detail/reduce_intervals.h>
 
 #include <cuda/std/__iterator/distance.h>
@@ -39,6 +44,19 @@ OutputType reduce(execution_policy<DerivedPolicy>& exec,
 
   const difference_type n = ::cuda::std::distance(first, last);
 
+  if constexpr (thrust::detail::requires_determinism_v<DerivedPolicy>)
+  {
+    if (n == 0)
+    {
+      return init;
+    }
+
+    thrust::detail::wrapped_function<BinaryFunction, OutputType> wrapped_binary_op{binary_op};
+    return wrapped_binary_op(
+      init,
+      thrust::system::detail::internal::deterministic_reduce<OutputType>(exec, parallel_for_index<>{}, first, n, binary_op));
+  }
+
   // determine first and second level decomposition
   thrust::system::detail::internal::uniform_decomposition<difference_type> decomp1 =
     thrust::system::omp::detail::default_decomposition(n);
@@ -17,14 +17,20 @@
 #  pragma system_header
 #endif // no system header
 
-#include <thrust/detail/function.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/static_assert.h> // for depend_on_instantiation
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/reduce_interval.h>
 #include <thrust/system/omp/detail/execution_policy.h>
 #include <thrust/system/omp/detail/pragma_omp.h>
 
 #include <cuda/std/cstdint>
 
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
@@ -52,33 +58,25 @@ void reduce_intervals(
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
   using OutputType = thrust::detail::it_value_t<OutputIterator>;
 
-  // wrap binary_op
-  thrust::detail::wrapped_function<BinaryFunction, OutputType> wrapped_binary_op{binary_op};
-
   using index_type = std::intptr_t;
 
   index_type n = static_cast<index_type>(decomp.size());
 
-  THRUST_PRAGMA_OMP(parallel for)
-  for (index_type i = 0; i < n; i++)
+  THRUST_PRAGMA_OMP(parallel)
   {
-    InputIterator begin = input + decomp[i].begin();
-    InputIterator end   = input + decomp[i].end();
+    _THRUST_HOST_INSTRUMENTATION_PARALLEL_REGION(omp_get_num_threads());
 
-    if (begin != end)
+    THRUST_PRAGMA_OMP(for)
+    for (index_type i = 0; i < n; i++)
     {
-      OutputType sum = thrust::raw_reference_cast(*begin);
+      const auto interval_size = decomp[i].end() - decomp[i].begin();
 
-      ++begin;
-
-      while (begin != end)
+      if (interval_size > 0)
       {
-        sum = wrapped_binary_op(sum, *begin);
-        ++begin;
+        OutputIterator tmp = output + i;
+        *tmp               = thrust::system::detail::internal::reduce_interval<OutputType>(
+          input + decomp[i].begin(), interval_size, binary_op);
       }
-
-      OutputIterator tmp = output + i;
-      *tmp               = sum;
     }
   }
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/system/detail/generic/run_length_encode.h>
+#include <thrust/system/detail/internal/run_length_encode.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/parallel_for_index.h>
+
+#include <cuda/std/__utility/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+::cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 unique_out,
+  OutputIterator2 counts_out,
+  BinaryPredicate binary_pred)
+{
+  return thrust::system::detail::internal::run_length_encode(
+    exec, parallel_for_index<>{}, first, last, unique_out, counts_out, binary_pred);
+}
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+::cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator first,
+  ForwardIterator last,
+  OutputIterator1 offsets_out,
+  OutputIterator2 lengths_out,
+  BinaryPredicate binary_pred)
+{
+  return thrust::system::detail::internal::non_trivial_runs(
+    exec, parallel_for_index<>{}, first, last, offsets_out, lengths_out, binary_pred);
+}
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
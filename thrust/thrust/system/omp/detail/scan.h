@@ -14,10 +14,14 @@
 #endif // no system header
 
 // OMP parallel scan implementation
+#include <thrust/detail/execute_with_requirements.h>
 #include <thrust/detail/function.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/deterministic.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/parallel_for_index.h>
 #include <thrust/system/omp/detail/pragma_omp.h>
 
 #include <cuda/__cmath/ceil_div.h>
@@ -71,6 +75,13 @@ OutputIterator scan_impl(
     return result;
   }
 
+  if constexpr (requires_determinism_v<DerivedPolicy>)
+  {
+    thrust::system::detail::internal::deterministic_scan<IsInclusive, has_init, accum_t>(
+      exec, parallel_for_index<>{}, first, n, result, init, binary_op);
+    return result + n;
+  }
+
   auto wrapped_binary_op = wrapped_function<BinaryFunction, accum_t>{binary_op};
 
   const int num_threads = omp_get_max_threads();
@@ -103,6 +114,8 @@ OutputIterator scan_impl(
   // Step 1: Reduce each block (N reads)
   THRUST_PRAGMA_OMP(parallel num_threads(num_threads))
   {
+    _THRUST_HOST_INSTRUMENTATION_PARALLEL_REGION(omp_get_num_threads());
+
     const int tid         = omp_get_thread_num();
     const Size block_size = ::cuda::ceil_div(n, num_threads);
     const Size start      = tid * block_size;
@@ -132,6 +145,8 @@ OutputIterator scan_impl(
   // Step 3: Scan each block with offset (N reads/writes)
   THRUST_PRAGMA_OMP(parallel num_threads(num_threads))
   {
+    _THRUST_HOST_INSTRUMENTATION_PARALLEL_REGION(omp_get_num_threads());
+
     const int tid         = omp_get_thread_num();
     const Size block_size = ::cuda::ceil_div(n, num_threads);
     const Size start      = tid * block_size;
@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/system/detail/internal/segmented.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/parallel_for_index.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename StrictWeakOrdering>
+void segmented_sort(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  // The cost of a batch depends on the sizes of its segments
+  thrust::system::detail::internal::segmented_sort<false>(
+    exec, parallel_for_index<true>{}, first, begin_offsets_first, begin_offsets_last, end_offsets_first, comp);
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename BeginOffsetIterator,
+          typename EndOffsetIterator,
+          typename StrictWeakOrdering>
+void segmented_stable_sort(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  BeginOffsetIterator begin_offsets_first,
+  BeginOffsetIterator begin_offsets_last,
+  EndOffsetIterator end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  // The cost of a batch depends on the sizes of its segments
+  thrust::system::detail::internal::segmented_sort<true>(
+    exec, parallel_for_index<true>{}, first, begin_offsets_first, begin_offsets_last, end_offsets_first, comp);
+}
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
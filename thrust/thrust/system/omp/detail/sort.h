@@ -20,6 +20,8 @@
 #  include <omp.h>
 #endif // omp support
 
+#include <thrust/detail/function.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
@@ -42,6 +44,13 @@ void inplace_merge(execution_policy<DerivedPolicy>& exec,
 {
   using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
 
+  // Sorted chunks of presorted input are often in order already
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+  if (first == middle || middle == last || !wrapped_comp(*middle, *(middle - 1)))
+  {
+    return;
+  }
+
   thrust::detail::temporary_array<value_type, DerivedPolicy> a(exec, first, middle);
   thrust::detail::temporary_array<value_type, DerivedPolicy> b(exec, middle, last);
 
@@ -63,6 +72,12 @@ void inplace_merge_by_key(
   using value_type1 = thrust::detail::it_value_t<RandomAccessIterator1>;
   using value_type2 = thrust::detail::it_value_t<RandomAccessIterator2>;
 
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+  if (first1 == middle1 || middle1 == last1 || !wrapped_comp(*middle1, *(middle1 - 1)))
+  {
+    return;
+  }
+
   RandomAccessIterator2 middle2 = first2 + (middle1 - first1);
   RandomAccessIterator2 last2   = first2 + (last1 - first1);
 
@@ -100,6 +115,8 @@ void stable_sort(
 
   THRUST_PRAGMA_OMP(parallel)
   {
+    _THRUST_HOST_INSTRUMENTATION_PARALLEL_REGION(omp_get_num_threads());
+
     thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(last - first, 1, omp_get_num_threads());
 
     // process id
@@ -181,6 +198,8 @@ void stable_sort_by_key(
 
   THRUST_PRAGMA_OMP(parallel)
   {
+    _THRUST_HOST_INSTRUMENTATION_PARALLEL_REGION(omp_get_num_threads());
+
     thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(
       keys_last - keys_first, 1, omp_get_num_threads());
 
@@ -34,6 +34,7 @@
 #include <thrust/system/omp/detail/generate.h>
 #include <thrust/system/omp/detail/get_value.h>
 #include <thrust/system/omp/detail/inner_product.h>
+#include <thrust/system/omp/detail/instrumentation.h>
 #include <thrust/system/omp/detail/iter_swap.h>
 #include <thrust/system/omp/detail/logical.h>
 #include <thrust/system/omp/detail/malloc_and_free.h>
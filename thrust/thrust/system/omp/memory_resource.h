@@ -18,6 +18,7 @@
 #endif // no system header
 
 #include <thrust/mr/fancy_pointer_resource.h>
+#include <thrust/mr/huge_page_resource.h>
 #include <thrust/mr/new.h>
 #include <thrust/system/omp/pointer.h>
 
@@ -27,10 +28,12 @@ namespace system::omp
 //! \cond
 namespace detail
 {
-using native_resource = thrust::mr::fancy_pointer_resource<thrust::mr::new_delete_resource, thrust::omp::pointer<void>>;
+using native_resource =
+  thrust::mr::fancy_pointer_resource<thrust::system::detail::host_native_upstream_resource, thrust::omp::pointer<void>>;
 
 using universal_native_resource =
-  thrust::mr::fancy_pointer_resource<thrust::mr::new_delete_resource, thrust::omp::universal_pointer<void>>;
+  thrust::mr::fancy_pointer_resource<thrust::system::detail::host_native_upstream_resource,
+                                     thrust::omp::universal_pointer<void>>;
 } // namespace detail
 //! \endcond
 
@@ -39,12 +42,12 @@ using universal_native_resource =
  *  \{
  */
 
-/*! The memory resource for the OpenMP system. Uses \p mr::new_delete_resource
- *  and tags it with \p omp::pointer.
+/*! The memory resource for the OpenMP system. Uses \p mr::new_delete_resource, or \p mr::huge_page_resource if
+ *  \p THRUST_HOST_MEMORY_USE_HUGE_PAGES is defined, and tags it with \p omp::pointer.
  */
 using memory_resource = detail::native_resource;
-/*! The unified memory resource for the OpenMP system. Uses
- *  \p mr::new_delete_resource and tags it with \p omp::universal_pointer.
+/*! The unified memory resource for the OpenMP system. Uses the same upstream resource as \p omp::memory_resource
+ *  and tags it with \p omp::universal_pointer.
  */
 using universal_memory_resource = detail::universal_native_resource;
 
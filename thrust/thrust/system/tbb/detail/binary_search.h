@@ -13,5 +13,71 @@
 #  pragma system_header
 #endif // no system header
 
-// this system inherits binary_search
+#include <thrust/system/detail/internal/sorted_search.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/parallel_for_index.h>
+
+// this system inherits the scalar binary_search
 #include <thrust/system/cpp/detail/binary_search.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator lower_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  using thrust::system::detail::internal::search_kind;
+  return thrust::system::detail::internal::vectorized_search<search_kind::lower_bound>(
+    exec, parallel_for_index{}, begin, end, values_begin, values_end, output, comp);
+}
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator upper_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  using thrust::system::detail::internal::search_kind;
+  return thrust::system::detail::internal::vectorized_search<search_kind::upper_bound>(
+    exec, parallel_for_index{}, begin, end, values_begin, values_end, output, comp);
+}
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator binary_search(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  using thrust::system::detail::internal::search_kind;
+  return thrust::system::detail::internal::vectorized_search<search_kind::binary_search>(
+    exec, parallel_for_index{}, begin, end, values_begin, values_end, output, comp);
+}
+} // end namespace system::tbb::detail
+THRUST_NAMESPACE_END
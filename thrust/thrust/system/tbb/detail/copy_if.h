@@ -14,6 +14,7 @@
 #endif // no system header
 
 #include <thrust/detail/function.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
@@ -22,6 +23,7 @@
 
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_scan.h>
+#include <tbb/task_arena.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb::detail
@@ -107,6 +109,7 @@ copy_if(tag, InputIterator1 first, InputIterator1 last, InputIterator2 stencil,
   if (n != 0)
   {
     Body body(first, stencil, result, pred);
+    _THRUST_HOST_INSTRUMENTATION_PARALLEL_REGION(::tbb::this_task_arena::max_concurrency());
     ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), body);
     ::cuda::std::advance(result, body.sum);
   }
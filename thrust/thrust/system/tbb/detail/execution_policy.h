@@ -13,6 +13,7 @@
 #endif // no system header
 
 #include <thrust/detail/allocator_aware_execution_policy.h>
+#include <thrust/detail/execute_with_requirements.h>
 #include <thrust/system/cpp/detail/execution_policy.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
@@ -51,7 +52,11 @@ struct execution_policy : cpp::execution_policy<Derived>
 struct par_t
     : execution_policy<par_t>
     , thrust::detail::allocator_aware_execution_policy<execution_policy>
-{};
+    , thrust::detail::requirements_aware_execution_policy<execution_policy>
+{
+  using thrust::detail::allocator_aware_execution_policy<execution_policy>::operator();
+  using thrust::detail::requirements_aware_execution_policy<execution_policy>::operator();
+};
 } // namespace detail
 
 //! \addtogroup execution_policies
@@ -76,6 +81,10 @@ using detail::execution_policy;
 //!
 //! The type of \p thrust::tbb::par is implementation-defined.
 //!
+//! \p reduce, \p transform_reduce, \p inclusive_scan, \p exclusive_scan and the algorithms built on them group the
+//! operations depending on the number of threads. Results that are bitwise identical across runs and thread counts are
+//! obtained with <tt>thrust::tbb::par(cuda::execution::require(cuda::execution::determinism::run_to_run))</tt>.
+//!
 //! The following code snippet demonstrates how to use \p thrust::tbb::par to explicitly dispatch an invocation of \p
 //! thrust::for_each to the TBB backend system:
 //!
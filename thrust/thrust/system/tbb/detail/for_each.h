@@ -13,6 +13,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/static_assert.h>
 #include <thrust/iterator/iterator_traits.h>
@@ -22,6 +23,7 @@
 
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb::detail
@@ -56,6 +58,7 @@ body<RandomAccessIterator, Size, UnaryFunction> make_body(RandomAccessIterator f
 template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename UnaryFunction>
 RandomAccessIterator for_each_n(execution_policy<DerivedPolicy>&, RandomAccessIterator first, Size n, UnaryFunction f)
 {
+  _THRUST_HOST_INSTRUMENTATION_PARALLEL_REGION(::tbb::this_task_arena::max_concurrency());
   ::tbb::parallel_for(::tbb::blocked_range<Size>(0, n), for_each_detail::make_body<Size>(first, f));
 
   // return the end of the range
@@ -0,0 +1,30 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/system/detail/generic/instrumentation.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+template <typename DerivedPolicy>
+thrust::system::detail::generic::instrumented_system_info instrumented_system(execution_policy<DerivedPolicy>&)
+{
+  return {"tbb", ::tbb::this_task_arena::max_concurrency()};
+}
+} // namespace system::tbb::detail
+THRUST_NAMESPACE_END
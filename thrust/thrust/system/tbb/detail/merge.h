@@ -13,6 +13,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/binary_search.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
@@ -20,6 +21,7 @@
 #include <thrust/system/tbb/detail/execution_policy.h>
 
 #include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb::detail
@@ -248,6 +250,7 @@ merge(execution_policy<DerivedPolicy>&,
   Range range(first1, last1, first2, last2, result, comp);
   Body body;
 
+  _THRUST_HOST_INSTRUMENTATION_PARALLEL_REGION(::tbb::this_task_arena::max_concurrency());
   ::tbb::parallel_for(range, body);
 
   ::cuda::std::advance(result, ::cuda::std::distance(first1, last1) + ::cuda::std::distance(first2, last2));
@@ -289,6 +292,7 @@ template <typename DerivedPolicy,
     keys_first1, keys_last1, keys_first2, keys_last2, values_first3, values_first4, keys_result, values_result, comp);
   Body body;
 
+  _THRUST_HOST_INSTRUMENTATION_PARALLEL_REGION(::tbb::this_task_arena::max_concurrency());
   ::tbb::parallel_for(range, body);
 
   ::cuda::std::advance(keys_result,
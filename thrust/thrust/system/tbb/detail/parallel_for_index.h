@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/instrumentation.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+//! Invokes f(i) for every i in [0, n) on the TBB worker threads. Every index may become a task of its own, so that
+//! work stealing balances indices of different cost.
+struct parallel_for_index
+{
+  template <typename Size, typename F>
+  void operator()(Size n, F f) const
+  {
+    _THRUST_HOST_INSTRUMENTATION_PARALLEL_REGION(::tbb::this_task_arena::max_concurrency());
+    ::tbb::parallel_for(::tbb::blocked_range<Size>(0, n, 1), [&](const ::tbb::blocked_range<Size>& r) {
+      for (Size i = r.begin(); i != r.end(); ++i)
+      {
+        f(i);
+      }
+    });
+  }
+};
+} // namespace system::tbb::detail
+THRUST_NAMESPACE_END
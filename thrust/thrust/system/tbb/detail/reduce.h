@@ -16,16 +16,22 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/execute_with_requirements.h>
 #include <thrust/detail/function.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/static_assert.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/reduce.h>
+#include <thrust/system/detail/internal/deterministic.h>
+#include <thrust/system/detail/internal/reduce_interval.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/parallel_for_index.h>
 
 #include <cuda/std/__iterator/distance.h>
 
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_reduce.h>
+#include <tbb/task_arena.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb::detail
@@ -66,16 +72,8 @@ struct body
       return; // nothing to do
     }
 
-    RandomAccessIterator iter = first + r.begin();
-
-    OutputType temp = thrust::raw_reference_cast(*iter);
-
-    ++iter;
-
-    for (Size i = r.begin() + 1; i != r.end(); ++i, ++iter)
-    {
-      temp = binary_op(temp, *iter);
-    }
+    OutputType temp =
+      thrust::system::detail::internal::reduce_interval<OutputType>(first + r.begin(), r.size(), binary_op.m_f);
 
     if (first_call)
     {
@@ -98,8 +96,11 @@ struct body
 } // namespace reduce_detail
 
 template <typename DerivedPolicy, typename InputIterator, typename OutputType, typename BinaryFunction>
-OutputType reduce(
-  execution_policy<DerivedPolicy>&, InputIterator begin, InputIterator end, OutputType init, BinaryFunction binary_op)
+OutputType reduce(execution_policy<DerivedPolicy>& exec,
+                  InputIterator begin,
+                  InputIterator end,
+                  OutputType init,
+                  BinaryFunction binary_op)
 {
   using Size = thrust::detail::it_difference_t<InputIterator>;
 
@@ -109,10 +110,18 @@ OutputType reduce(
   {
     return init;
   }
+  else if constexpr (thrust::detail::requires_determinism_v<DerivedPolicy>)
+  {
+    thrust::detail::wrapped_function<BinaryFunction, OutputType> wrapped_binary_op{binary_op};
+    return wrapped_binary_op(
+      init,
+      thrust::system::detail::internal::deterministic_reduce<OutputType>(exec, parallel_for_index{}, begin, n, binary_op));
+  }
   else
   {
     using Body = typename reduce_detail::body<InputIterator, OutputType, BinaryFunction>;
     Body reduce_body(begin, init, binary_op);
+    _THRUST_HOST_INSTRUMENTATION_PARALLEL_REGION(::tbb::this_task_arena::max_concurrency());
     ::tbb::parallel_reduce(::tbb::blocked_range<Size>(0, n), reduce_body);
     return binary_op(init, reduce_body.sum);
   }
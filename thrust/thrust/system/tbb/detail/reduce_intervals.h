@@ -12,10 +12,11 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
-#include <thrust/detail/seq.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/reduce.h>
 #include <thrust/system/cpp/memory.h>
+#include <thrust/system/detail/internal/reduce_interval.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
 #include <cuda/std/__algorithm/min.h>
@@ -23,6 +24,7 @@
 #include <cuda/std/cassert>
 
 #include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb::detail
@@ -63,10 +65,9 @@ struct body
     RandomAccessIterator1 my_first = first + offset_to_first;
     RandomAccessIterator1 my_last  = first + offset_to_last;
 
-    // carefully pass the init value for the interval with raw_reference_cast
     using sum_type = ::cuda::std::decay_t<decltype(binary_op(*my_first, *my_first))>;
     result[interval_idx] =
-      thrust::reduce(thrust::seq, my_first + 1, my_last, sum_type(thrust::raw_reference_cast(*my_first)), binary_op);
+      thrust::system::detail::internal::reduce_interval<sum_type>(my_first, my_last - my_first, binary_op);
   }
 };
 
@@ -96,6 +97,7 @@ void reduce_intervals(
 
   Size num_intervals = reduce_intervals_detail::divide_ri(n, interval_size);
 
+  _THRUST_HOST_INSTRUMENTATION_PARALLEL_REGION(::tbb::this_task_arena::max_concurrency());
   ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_intervals, 1),
                       reduce_intervals_detail::make_body(first, result, Size(n), interval_size, binary_op),
                       ::tbb::simple_partitioner());
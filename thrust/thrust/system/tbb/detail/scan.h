@@ -16,17 +16,23 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/execute_with_requirements.h>
 #include <thrust/detail/function.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/deterministic.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/parallel_for_index.h>
 
 #include <cuda/std/__functional/invoke.h>
 #include <cuda/std/__iterator/advance.h>
 #include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__type_traits/enable_if.h>
 
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_scan.h>
+#include <tbb/task_arena.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb::detail
@@ -234,6 +240,7 @@ inclusive_scan(tag, InputIterator first, InputIterator last, OutputIterator resu
   {
     using Body = typename scan_detail::inclusive_body<InputIterator, OutputIterator, BinaryFunction, ValueType, false>;
     Body scan_body(first, result, binary_op, *first);
+    _THRUST_HOST_INSTRUMENTATION_PARALLEL_REGION(::tbb::this_task_arena::max_concurrency());
     ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), scan_body);
   }
 
@@ -259,6 +266,7 @@ OutputIterator inclusive_scan(
   {
     using Body = typename scan_detail::inclusive_body<InputIterator, OutputIterator, BinaryFunction, ValueType, true>;
     Body scan_body(first, result, binary_op, init);
+    _THRUST_HOST_INSTRUMENTATION_PARALLEL_REGION(::tbb::this_task_arena::max_concurrency());
     ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), scan_body);
   }
 
@@ -283,6 +291,7 @@ OutputIterator exclusive_scan(
   {
     using Body = typename scan_detail::exclusive_body<InputIterator, OutputIterator, BinaryFunction, ValueType>;
     Body scan_body(first, result, binary_op, init);
+    _THRUST_HOST_INSTRUMENTATION_PARALLEL_REGION(::tbb::this_task_arena::max_concurrency());
     ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), scan_body);
   }
 
@@ -290,5 +299,94 @@ OutputIterator exclusive_scan(
 
   return result;
 }
+
+// Policies that require determinism are scanned in fixed chunks instead of with tbb::parallel_scan, whose partition of
+// the input depends on the scheduling
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename BinaryFunction,
+          ::cuda::std::enable_if_t<thrust::detail::requires_determinism_v<DerivedPolicy>, int> = 0>
+OutputIterator inclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  BinaryFunction binary_op)
+{
+  // Use the input iterator's value type per https://wg21.link/P0571
+  using ValueType = thrust::detail::it_value_t<InputIterator>;
+
+  using Size = thrust::detail::it_difference_t<InputIterator>;
+  Size n     = ::cuda::std::distance(first, last);
+
+  if (n != 0)
+  {
+    thrust::system::detail::internal::deterministic_scan<true, false, ValueType>(
+      exec, parallel_for_index{}, first, n, result, *first, binary_op);
+  }
+
+  return result + n;
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction,
+          ::cuda::std::enable_if_t<thrust::detail::requires_determinism_v<DerivedPolicy>, int> = 0>
+OutputIterator inclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  InitialValueType init,
+  BinaryFunction binary_op)
+{
+  // Use the input iterator's value type and the initial value type per wg21.link/p2322
+  using ValueType =
+    typename ::cuda::std::__accumulator_t<BinaryFunction, thrust::detail::it_value_t<InputIterator>, InitialValueType>;
+
+  using Size = thrust::detail::it_difference_t<InputIterator>;
+  Size n     = ::cuda::std::distance(first, last);
+
+  if (n != 0)
+  {
+    thrust::system::detail::internal::deterministic_scan<true, true, ValueType>(
+      exec, parallel_for_index{}, first, n, result, init, binary_op);
+  }
+
+  return result + n;
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction,
+          ::cuda::std::enable_if_t<thrust::detail::requires_determinism_v<DerivedPolicy>, int> = 0>
+OutputIterator exclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  InitialValueType init,
+  BinaryFunction binary_op)
+{
+  // Use the initial value type per https://wg21.link/P0571
+  using ValueType = InitialValueType;
+
+  using Size = thrust::detail::it_difference_t<InputIterator>;
+  Size n     = ::cuda::std::distance(first, last);
+
+  if (n != 0)
+  {
+    thrust::system::detail::internal::deterministic_scan<false, true, ValueType>(
+      exec, parallel_for_index{}, first, n, result, init, binary_op);
+  }
+
+  return result + n;
+}
 } // end namespace system::tbb::detail
 THRUST_NAMESPACE_END
@@ -13,6 +13,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/copy.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
@@ -23,6 +24,7 @@
 #include <cuda/std/__iterator/distance.h>
 
 #include <tbb/parallel_invoke.h>
+#include <tbb/task_arena.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb::detail
@@ -103,6 +105,7 @@ void merge_sort(execution_policy<DerivedPolicy>& exec,
   Closure left(exec, first1, mid1, first2, comp, !inplace);
   Closure right(exec, mid1, last1, mid2, comp, !inplace);
 
+  _THRUST_HOST_INSTRUMENTATION_PARALLEL_REGION(::tbb::this_task_arena::max_concurrency());
   ::tbb::parallel_invoke(left, right);
 
   if (inplace)
@@ -224,6 +227,7 @@ void merge_sort_by_key(
   Closure left(exec, first1, mid1, first2, first3, first4, comp, !inplace);
   Closure right(exec, mid1, last1, mid2, mid3, mid4, comp, !inplace);
 
+  _THRUST_HOST_INSTRUMENTATION_PARALLEL_REGION(::tbb::this_task_arena::max_concurrency());
   ::tbb::parallel_invoke(left, right);
 
   if (inplace)
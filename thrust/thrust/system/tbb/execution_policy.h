@@ -34,6 +34,7 @@
 #include <thrust/system/tbb/detail/generate.h>
 #include <thrust/system/tbb/detail/get_value.h>
 #include <thrust/system/tbb/detail/inner_product.h>
+#include <thrust/system/tbb/detail/instrumentation.h>
 #include <thrust/system/tbb/detail/iter_swap.h>
 #include <thrust/system/tbb/detail/logical.h>
 #include <thrust/system/tbb/detail/malloc_and_free.h>
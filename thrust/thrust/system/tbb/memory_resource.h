@@ -17,6 +17,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/mr/fancy_pointer_resource.h>
+#include <thrust/mr/huge_page_resource.h>
 #include <thrust/mr/new.h>
 #include <thrust/system/tbb/pointer.h>
 
@@ -26,10 +27,12 @@ namespace system::tbb
 //! \cond
 namespace detail
 {
-using native_resource = thrust::mr::fancy_pointer_resource<thrust::mr::new_delete_resource, thrust::tbb::pointer<void>>;
+using native_resource =
+  thrust::mr::fancy_pointer_resource<thrust::system::detail::host_native_upstream_resource, thrust::tbb::pointer<void>>;
 
 using universal_native_resource =
-  thrust::mr::fancy_pointer_resource<thrust::mr::new_delete_resource, thrust::tbb::universal_pointer<void>>;
+  thrust::mr::fancy_pointer_resource<thrust::system::detail::host_native_upstream_resource,
+                                     thrust::tbb::universal_pointer<void>>;
 } // namespace detail
 //! \endcond
 
@@ -38,12 +41,12 @@ using universal_native_resource =
  *  \{
  */
 
-/*! The memory resource for the TBB system. Uses \p mr::new_delete_resource and
- *  tags it with \p tbb::pointer.
+/*! The memory resource for the TBB system. Uses \p mr::new_delete_resource, or \p mr::huge_page_resource if
+ *  \p THRUST_HOST_MEMORY_USE_HUGE_PAGES is defined, and tags it with \p tbb::pointer.
  */
 using memory_resource = detail::native_resource;
-/*! The unified memory resource for the TBB system. Uses
- *  \p mr::new_delete_resource and tags it with \p tbb::universal_pointer.
+/*! The unified memory resource for the TBB system. Uses the same upstream resource as \p tbb::memory_resource
+ *  and tags it with \p tbb::universal_pointer.
  */
 using universal_memory_resource = detail::universal_native_resource;
 
@@ -0,0 +1,184 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file three_way_partition.h
+ *  \brief Functions for splitting a range into three partitions
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+
+#include <cuda/std/tuple>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup reordering
+ *  \ingroup algorithms
+ *
+ *  \addtogroup partitioning
+ *  \ingroup reordering
+ *  \{
+ */
+
+/*! \p three_way_partition copies the elements of the range <tt>[first, last)</tt> into three output sequences in a
+ *  single call. The elements which satisfy \p select_first_part are copied to \p first_part_out. Of the remaining
+ *  elements, those which satisfy \p select_second_part are copied to \p second_part_out, and all others are copied to
+ *  \p unselected_out. The relative order of the elements in each output sequence is the same as in the input.
+ *
+ *  \p three_way_partition is equivalent to two calls to \p stable_partition_copy, but the host backends store no
+ *  intermediate partition. It partitions like <tt>cub::DevicePartition::If</tt> with two selection operators.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param first_part_out The beginning of the output sequence of the elements which satisfy \p select_first_part.
+ *  \param second_part_out The beginning of the output sequence of the other elements which satisfy \p
+ *         select_second_part.
+ *  \param unselected_out The beginning of the output sequence of the elements which satisfy neither predicate.
+ *  \param select_first_part The predicate which selects the elements of the first part.
+ *  \param select_second_part The predicate which selects the elements of the second part.
+ *  \return A \p tuple of the ends of the three output sequences.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam ForwardIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/forward_iterator">Forward
+ * Iterator</a>, and \p ForwardIterator's \c value_type is convertible to the argument types of both predicates and to
+ * the \c value_types of all output iterators.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a>.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a>.
+ *  \tparam OutputIterator3 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a>.
+ *  \tparam Predicate1 is a model of <a href="https://en.cppreference.com/w/cpp/concepts/predicate">Predicate</a>.
+ *  \tparam Predicate2 is a model of <a href="https://en.cppreference.com/w/cpp/concepts/predicate">Predicate</a>.
+ *
+ *  \pre The input range shall not overlap with any output range.
+ *
+ *  The following code snippet demonstrates how to use \p three_way_partition to split a sequence of integers around
+ *  a range of pivots using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/three_way_partition.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  struct less_than
+ *  {
+ *    int pivot;
+ *    __host__ __device__ bool operator()(int x) const
+ *    {
+ *      return x < pivot;
+ *    }
+ *  };
+ *
+ *  struct greater_than
+ *  {
+ *    int pivot;
+ *    __host__ __device__ bool operator()(int x) const
+ *    {
+ *      return x > pivot;
+ *    }
+ *  };
+ *  ...
+ *  int data[10] = {5, 9, 1, 3, 8, 2, 7, 4, 10, 6};
+ *  int small[10], large[10], middle[10];
+ *  auto ends = thrust::three_way_partition(
+ *    thrust::host, data, data + 10, small, large, middle, less_than{3}, greater_than{7});
+ *  // small is now {1, 2, ...}
+ *  // large is now {9, 8, 10, ...}
+ *  // middle is now {5, 3, 7, 4, 6, ...}
+ *  // ends is {small + 2, large + 3, middle + 5}
+ *  \endcode
+ *
+ *  \see \p stable_partition_copy
+ *  \see \p partition_copy
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename OutputIterator3,
+          typename Predicate1,
+          typename Predicate2>
+_CCCL_HOST_DEVICE ::cuda::std::tuple<OutputIterator1, OutputIterator2, OutputIterator3> three_way_partition(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  ForwardIterator first,
+  ForwardIterator last,
+  OutputIterator1 first_part_out,
+  OutputIterator2 second_part_out,
+  OutputIterator3 unselected_out,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part);
+
+/*! \p three_way_partition copies the elements of the range <tt>[first, last)</tt> into three output sequences in a
+ *  single call. The elements which satisfy \p select_first_part are copied to \p first_part_out. Of the remaining
+ *  elements, those which satisfy \p select_second_part are copied to \p second_part_out, and all others are copied to
+ *  \p unselected_out. The relative order of the elements in each output sequence is the same as in the input.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param first_part_out The beginning of the output sequence of the elements which satisfy \p select_first_part.
+ *  \param second_part_out The beginning of the output sequence of the other elements which satisfy \p
+ *         select_second_part.
+ *  \param unselected_out The beginning of the output sequence of the elements which satisfy neither predicate.
+ *  \param select_first_part The predicate which selects the elements of the first part.
+ *  \param select_second_part The predicate which selects the elements of the second part.
+ *  \return A \p tuple of the ends of the three output sequences.
+ *
+ *  \tparam ForwardIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/forward_iterator">Forward
+ * Iterator</a>, and \p ForwardIterator's \c value_type is convertible to the argument types of both predicates and to
+ * the \c value_types of all output iterators.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a>.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a>.
+ *  \tparam OutputIterator3 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ * Iterator</a>.
+ *  \tparam Predicate1 is a model of <a href="https://en.cppreference.com/w/cpp/concepts/predicate">Predicate</a>.
+ *  \tparam Predicate2 is a model of <a href="https://en.cppreference.com/w/cpp/concepts/predicate">Predicate</a>.
+ *
+ *  \pre The input range shall not overlap with any output range.
+ *
+ *  \see \p stable_partition_copy
+ *  \see \p partition_copy
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.4.0
+ *  \endverbatim
+ */
+template <typename ForwardIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename OutputIterator3,
+          typename Predicate1,
+          typename Predicate2>
+::cuda::std::tuple<OutputIterator1, OutputIterator2, OutputIterator3> three_way_partition(
+  ForwardIterator first,
+  ForwardIterator last,
+  OutputIterator1 first_part_out,
+  OutputIterator2 second_part_out,
+  OutputIterator3 unselected_out,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part);
+
+/*! \} // end partitioning
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/three_way_partition.inl>
@@ -18,6 +18,7 @@
 #endif // no system header
 
 #include <thrust/detail/execution_policy.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
 
@@ -111,6 +112,7 @@ _CCCL_HOST_DEVICE OutputIterator transform(
   UnaryFunction op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::transform", first, last);
   using thrust::system::detail::generic::transform;
   return transform(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, op);
 }
@@ -253,6 +255,7 @@ _CCCL_HOST_DEVICE OutputIterator transform(
   BinaryFunction op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::transform", first1, last1);
   using thrust::system::detail::generic::transform;
   return transform(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, op);
 }
@@ -414,6 +417,7 @@ _CCCL_HOST_DEVICE ForwardIterator transform_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform_if");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::transform_if", first, last);
   using thrust::system::detail::generic::transform_if;
   return transform_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, op, pred);
 }
@@ -583,6 +587,7 @@ _CCCL_HOST_DEVICE ForwardIterator transform_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform_if");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::transform_if", first, last);
   using thrust::system::detail::generic::transform_if;
   return transform_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, result, op, pred);
@@ -768,6 +773,7 @@ _CCCL_HOST_DEVICE ForwardIterator transform_if(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform_if");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::transform_if", first1, last1);
   using thrust::system::detail::generic::transform_if;
   return transform_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -893,6 +899,7 @@ _CCCL_HOST_DEVICE OutputIterator transform_n(
   UnaryFunction op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform_n");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::transform_n", first, count);
   using thrust::system::detail::generic::transform_n;
   return transform_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, count, result, op);
 }
@@ -932,6 +939,7 @@ _CCCL_HOST_DEVICE OutputIterator transform_n(
   BinaryFunction op)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform_n");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::transform_n", first1, count);
   using thrust::system::detail::generic::transform_n;
   return transform_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, count, first2, result, op);
 }
@@ -976,6 +984,7 @@ _CCCL_HOST_DEVICE ForwardIterator transform_if_n(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform_if_n");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::transform_if_n", first, count);
   using thrust::system::detail::generic::transform_if_n;
   return transform_if_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, count, result, op, pred);
 }
@@ -1021,6 +1030,7 @@ _CCCL_HOST_DEVICE ForwardIterator transform_if_n(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform_if_n");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::transform_if_n", first, count);
   using thrust::system::detail::generic::transform_if_n;
   return transform_if_n(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, count, stencil, result, op, pred);
@@ -1075,6 +1085,7 @@ _CCCL_HOST_DEVICE ForwardIterator transform_if_n(
   Predicate pred)
 {
   _CCCL_NVTX_RANGE_SCOPE("thrust::transform_if_n");
+  _THRUST_HOST_INSTRUMENTATION_SCOPE(exec, "thrust::transform_if_n", first1, count);
   using thrust::system::detail::generic::transform_if_n;
   return transform_if_n(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),